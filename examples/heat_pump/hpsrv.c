@@ -55,13 +55,6 @@ struct Hpsrv {
 
 #define HPSRV(obj) ((Hpsrv*)(obj))
 
-typedef struct MpcData MpcData;
-
-struct MpcData {
-  MuMpcMeasurementNameId name;
-  int32_t value;
-};
-
 static const uint32_t kHeartbeatTimeoutSeconds = 60;
 
 static const ElectricalConnectionIdType kHpsrvElectricalConnectionId = 0;
@@ -285,21 +278,6 @@ void HpsrvUnregisterRemoteSki(HpsrvObject* self, const char* ski) {
   EEBUS_SERVICE_UNREGISTER_REMOTE_SKI(HPSRV(self)->service, ski);
 }
 
-EebusError SetMpcData(Hpsrv* self, const MpcData* mpc_data, size_t mpc_data_size) {
-  EebusError err = kEebusErrorOk;
-
-  for (size_t i = 0; i < mpc_data_size; ++i) {
-    const ScaledValue value = {.value = mpc_data[i].value, .scale = kScaleDefault};
-
-    err = MuMpcSetMeasurementDataCache(self->mu_mpc, mpc_data[i].name, &value, NULL, NULL);
-    if (err != kEebusErrorOk) {
-      return err;
-    }
-  }
-
-  return kEebusErrorOk;
-}
-
 EebusError HpsrvSetPowerTotal(HpsrvObject* self, int32_t power_total) {
   Hpsrv* const hpsrv = HPSRV(self);
 
@@ -316,18 +294,13 @@ EebusError
 HpsrvSetPowerPerPhase(HpsrvObject* self, int32_t power_phase_a, int32_t power_phase_b, int32_t power_phase_c) {
   Hpsrv* const hpsrv = HPSRV(self);
 
-  const MpcData power_phase_data[] = {
-      {kMpcPowerPhaseA, power_phase_a},
-      {kMpcPowerPhaseB, power_phase_b},
-      {kMpcPowerPhaseC, power_phase_c},
+  const MuMpcMeasurementSample power_phase_data[] = {
+      {kMpcPowerPhaseA, {power_phase_a, kScaleDefault}},
+      {kMpcPowerPhaseB, {power_phase_b, kScaleDefault}},
+      {kMpcPowerPhaseC, {power_phase_c, kScaleDefault}},
   };
 
-  EebusError err = SetMpcData(hpsrv, power_phase_data, ARRAY_SIZE(power_phase_data));
-  if (err != kEebusErrorOk) {
-    return err;
-  }
-
-  return MuMpcUpdate(hpsrv->mu_mpc);
+  return MuMpcUpdateMeasurementData(hpsrv->mu_mpc, power_phase_data, ARRAY_SIZE(power_phase_data));
 }
 
 EebusError HpsrvSetEnergyConsumed(HpsrvObject* self, int32_t energy_consumed) {
@@ -362,18 +335,13 @@ EebusError HpsrvSetAcCurrentPerPhase(
 ) {
   Hpsrv* const hpsrv = HPSRV(self);
 
-  const MpcData current_phase_data[] = {
-      {kMpcCurrentPhaseA, current_phase_a},
-      {kMpcCurrentPhaseB, current_phase_b},
-      {kMpcCurrentPhaseC, current_phase_c},
+  const MuMpcMeasurementSample current_phase_data[] = {
+      {kMpcCurrentPhaseA, {current_phase_a, kScaleDefault}},
+      {kMpcCurrentPhaseB, {current_phase_b, kScaleDefault}},
+      {kMpcCurrentPhaseC, {current_phase_c, kScaleDefault}},
   };
 
-  EebusError err = SetMpcData(hpsrv, current_phase_data, ARRAY_SIZE(current_phase_data));
-  if (err != kEebusErrorOk) {
-    return err;
-  }
-
-  return MuMpcUpdate(hpsrv->mu_mpc);
+  return MuMpcUpdateMeasurementData(hpsrv->mu_mpc, current_phase_data, ARRAY_SIZE(current_phase_data));
 }
 
 EebusError HpsrvSetVoltagePerPhase(
@@ -387,21 +355,16 @@ EebusError HpsrvSetVoltagePerPhase(
 ) {
   Hpsrv* const hpsrv = HPSRV(self);
 
-  const MpcData voltage_phase_data[] = {
-      { kMpcVoltagePhaseA,  voltage_phase_a},
-      { kMpcVoltagePhaseB,  voltage_phase_b},
-      { kMpcVoltagePhaseC,  voltage_phase_c},
-      {kMpcVoltagePhaseAb, voltage_phase_ab},
-      {kMpcVoltagePhaseBc, voltage_phase_bc},
-      {kMpcVoltagePhaseAc, voltage_phase_ac},
+  const MuMpcMeasurementSample voltage_phase_data[] = {
+      { kMpcVoltagePhaseA,  {voltage_phase_a, kScaleDefault}},
+      { kMpcVoltagePhaseB,  {voltage_phase_b, kScaleDefault}},
+      { kMpcVoltagePhaseC,  {voltage_phase_c, kScaleDefault}},
+      {kMpcVoltagePhaseAb, {voltage_phase_ab, kScaleDefault}},
+      {kMpcVoltagePhaseBc, {voltage_phase_bc, kScaleDefault}},
+      {kMpcVoltagePhaseAc, {voltage_phase_ac, kScaleDefault}},
   };
 
-  EebusError err = SetMpcData(hpsrv, voltage_phase_data, ARRAY_SIZE(voltage_phase_data));
-  if (err != kEebusErrorOk) {
-    return err;
-  }
-
-  return MuMpcUpdate(hpsrv->mu_mpc);
+  return MuMpcUpdateMeasurementData(hpsrv->mu_mpc, voltage_phase_data, ARRAY_SIZE(voltage_phase_data));
 }
 
 EebusError HpsrvSetAcFrequency(HpsrvObject* self, int32_t ac_frequency) {
@@ -0,0 +1,701 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief End-to-end SHIP loopback benchmark
+ *
+ * Runs the Heat Pump (CS LPC, MU MPC) and the HEMS (EG LPC, MA MPC) EEBUS services within the same process,
+ * connected over 127.0.0.1 through the full TLS, websocket, SHIP and SPINE stack. mDNS is not used,
+ * the services are given each other's address and the SKIs of the self-signed certificates generated at start.
+ *
+ * Measured:
+ * - Connection establishment time, from the services start until both HEMS use cases see the remote entity
+ * - LPC write latency, from the EG limit write until the CS listener receives it and until the updated
+ *   limit is notified back to the EG
+ * - MPC notify throughput for the different number of measurements sent within a single notify
+ */
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "src/common/array_util.h"
+#include "src/common/eebus_errors.h"
+#include "src/common/eebus_thread/eebus_thread.h"
+#include "src/common/string_util.h"
+#include "src/service/api/service_reader_interface.h"
+#include "src/service/service/eebus_service.h"
+#include "src/ship/tls_certificate/tls_certificate.h"
+#include "src/spine/entity/entity_local.h"
+#include "src/use_case/actor/cs/lpc/cs_lpc.h"
+#include "src/use_case/actor/eg/lpc/eg_lpc.h"
+#include "src/use_case/actor/ma/mpc/ma_mpc.h"
+#include "src/use_case/actor/mu/mpc/mu_mpc.h"
+
+/** Benchmark Peer (single EEBUS Service) type definition */
+typedef struct BenchPeer BenchPeer;
+
+/** Benchmark Peer (single EEBUS Service) structure */
+struct BenchPeer {
+  /** Implements the Service Reader Interface */
+  ServiceReaderObject service_reader;
+
+  EebusServiceConfig* cfg;
+  EebusServiceObject* service;
+  EntityLocalObject* entity;
+  const char* ski;
+};
+
+/** Benchmark type definition */
+typedef struct Bench Bench;
+
+/** Benchmark structure */
+struct Bench {
+  BenchPeer heat_pump;
+  BenchPeer hems;
+
+  CsLpcListenerObject cs_lpc_listener;
+  EgLpcListenerObject eg_lpc_listener;
+  MaMpcListenerObject ma_mpc_listener;
+
+  CsLpcUseCaseObject* cs_lpc;
+  MuMpcUseCaseObject* mu_mpc;
+  EgLpcUseCaseObject* eg_lpc;
+  MaMpcUseCaseObject* ma_mpc;
+
+  /** Heat Pump entity address as seen by HEMS, written once before connected_num is incremented */
+  EntityAddressType* eg_lpc_remote_entity_addr;
+  atomic_bool is_ma_mpc_connected;
+  atomic_int_fast64_t connected_num;
+
+  atomic_int_fast64_t cs_limit_received;
+  atomic_int_fast64_t eg_limit_received;
+  atomic_int_fast64_t measurements_received;
+};
+
+static const uint32_t kHeartbeatTimeoutSeconds = 60;
+static const uint32_t kCertificateValidDays    = 1;
+static const int32_t kDefaultPort              = 4711;
+static const size_t kDefaultIterations         = 200;
+static const uint64_t kWaitTimeoutNs           = 10ULL * 1000 * 1000 * 1000;
+static const uint64_t kWarmupAttemptTimeoutNs  = 100ULL * 1000 * 1000;
+static const int32_t kPollIntervalUs           = 10;
+
+static const ElectricalConnectionIdType kElectricalConnectionId = 0;
+
+/** The benchmark state is shared with the use case listeners called from the SPINE thread */
+static Bench bench;
+
+static void PeerDestruct(ServiceReaderObject* self);
+static void OnRemoteSkiConnected(ServiceReaderObject* self, EebusServiceObject* service, const char* ski);
+static void OnRemoteSkiDisconnected(ServiceReaderObject* self, EebusServiceObject* service, const char* ski);
+static void OnRemoteServicesUpdate(ServiceReaderObject* self, EebusServiceObject* service, const Vector* entries);
+static void OnShipIdUpdate(ServiceReaderObject* self, const char* ski, const char* shipd_id);
+static void OnShipStateUpdate(ServiceReaderObject* self, const char* ski, SmeState state);
+static bool IsWaitingForTrustAllowed(const ServiceReaderObject* self, const char* ski);
+
+static const ServiceReaderInterface bench_peer_methods = {
+    .destruct                     = PeerDestruct,
+    .on_remote_ski_connected      = OnRemoteSkiConnected,
+    .on_remote_ski_disconnected   = OnRemoteSkiDisconnected,
+    .on_remote_services_update    = OnRemoteServicesUpdate,
+    .on_ship_id_update            = OnShipIdUpdate,
+    .on_ship_state_update         = OnShipStateUpdate,
+    .is_waiting_for_trust_allowed = IsWaitingForTrustAllowed,
+};
+
+static void CsLpcListenerDestruct(CsLpcListenerObject* self);
+static void CsLpcOnPowerLimitReceive(
+    CsLpcListenerObject* self,
+    const ScaledValue* power_limit,
+    const DurationType* duration,
+    bool is_active
+);
+static void CsLpcOnFailsafePowerLimitReceive(CsLpcListenerObject* self, const ScaledValue* power_limit);
+static void CsLpcOnFailsafeDurationReceive(CsLpcListenerObject* self, const DurationType* duration);
+static void CsLpcOnHeartbeatReceive(CsLpcListenerObject* self, uint64_t heartbeat_counter);
+
+static const CsLpcListenerInterface cs_lpc_listener_methods = {
+    .destruct                        = CsLpcListenerDestruct,
+    .on_power_limit_receive          = CsLpcOnPowerLimitReceive,
+    .on_failsafe_power_limit_receive = CsLpcOnFailsafePowerLimitReceive,
+    .on_failsafe_duration_receive    = CsLpcOnFailsafeDurationReceive,
+    .on_heartbeat_receive            = CsLpcOnHeartbeatReceive,
+};
+
+static void EgLpcListenerDestruct(EgLpcListenerObject* self);
+static void EgLpcOnRemoteEntityConnect(EgLpcListenerObject* self, const EntityAddressType* entity_addr);
+static void EgLpcOnRemoteEntityDisconnect(EgLpcListenerObject* self, const EntityAddressType* entity_addr);
+static void EgLpcOnPowerLimitReceive(
+    EgLpcListenerObject* self,
+    const ScaledValue* power_limit,
+    const DurationType* duration,
+    bool is_active
+);
+static void EgLpcOnFailsafePowerLimitReceive(EgLpcListenerObject* self, const ScaledValue* power_limit);
+static void EgLpcOnFailsafeDurationReceive(EgLpcListenerObject* self, const DurationType* duration);
+static void EgLpcOnHeartbeatReceive(EgLpcListenerObject* self, uint64_t heartbeat_counter);
+
+static const EgLpcListenerInterface eg_lpc_listener_methods = {
+    .destruct                        = EgLpcListenerDestruct,
+    .on_remote_entity_connect        = EgLpcOnRemoteEntityConnect,
+    .on_remote_entity_disconnect     = EgLpcOnRemoteEntityDisconnect,
+    .on_power_limit_receive          = EgLpcOnPowerLimitReceive,
+    .on_failsafe_power_limit_receive = EgLpcOnFailsafePowerLimitReceive,
+    .on_failsafe_duration_receive    = EgLpcOnFailsafeDurationReceive,
+    .on_heartbeat_receive            = EgLpcOnHeartbeatReceive,
+};
+
+static void MaMpcListenerDestruct(MaMpcListenerObject* self);
+static void MaMpcOnRemoteEntityConnect(MaMpcListenerObject* self, const EntityAddressType* entity_addr);
+static void MaMpcOnRemoteEntityDisconnect(MaMpcListenerObject* self, const EntityAddressType* entity_addr);
+static void MaMpcOnMeasurementReceive(
+    MaMpcListenerObject* self,
+    MuMpcMeasurementNameId name_id,
+    const ScaledValue* measurement_value,
+    const EntityAddressType* remote_entity_addr
+);
+
+static const MaMpcListenerInterface ma_mpc_listener_methods = {
+    .destruct                    = MaMpcListenerDestruct,
+    .on_remote_entity_connect    = MaMpcOnRemoteEntityConnect,
+    .on_remote_entity_disconnect = MaMpcOnRemoteEntityDisconnect,
+    .on_measurement_receive      = MaMpcOnMeasurementReceive,
+};
+
+void PeerDestruct(ServiceReaderObject* self) {
+  BenchPeer* const peer = (BenchPeer*)self;
+
+  if (peer->service != NULL) {
+    EEBUS_SERVICE_STOP(peer->service);
+    EebusServiceDelete(peer->service);
+    peer->service = NULL;
+  }
+
+  EebusServiceConfigDelete(peer->cfg);
+  peer->cfg = NULL;
+
+  StringDelete((char*)peer->ski);
+  peer->ski = NULL;
+}
+
+void OnRemoteSkiConnected(ServiceReaderObject* self, EebusServiceObject* service, const char* ski) {}
+
+void OnRemoteSkiDisconnected(ServiceReaderObject* self, EebusServiceObject* service, const char* ski) {}
+
+void OnRemoteServicesUpdate(ServiceReaderObject* self, EebusServiceObject* service, const Vector* entries) {}
+
+void OnShipIdUpdate(ServiceReaderObject* self, const char* ski, const char* shipd_id) {}
+
+void OnShipStateUpdate(ServiceReaderObject* self, const char* ski, SmeState state) {}
+
+bool IsWaitingForTrustAllowed(const ServiceReaderObject* self, const char* ski) {
+  return true;
+}
+
+void CsLpcListenerDestruct(CsLpcListenerObject* self) {}
+
+void CsLpcOnPowerLimitReceive(
+    CsLpcListenerObject* self,
+    const ScaledValue* power_limit,
+    const DurationType* duration,
+    bool is_active
+) {
+  atomic_store(&bench.cs_limit_received, power_limit->value);
+}
+
+void CsLpcOnFailsafePowerLimitReceive(CsLpcListenerObject* self, const ScaledValue* power_limit) {}
+
+void CsLpcOnFailsafeDurationReceive(CsLpcListenerObject* self, const DurationType* duration) {}
+
+void CsLpcOnHeartbeatReceive(CsLpcListenerObject* self, uint64_t heartbeat_counter) {}
+
+void EgLpcListenerDestruct(EgLpcListenerObject* self) {}
+
+void EgLpcOnRemoteEntityConnect(EgLpcListenerObject* self, const EntityAddressType* entity_addr) {
+  if (bench.eg_lpc_remote_entity_addr == NULL) {
+    bench.eg_lpc_remote_entity_addr = EntityAddressCopy(entity_addr);
+    atomic_fetch_add(&bench.connected_num, 1);
+  }
+}
+
+void EgLpcOnRemoteEntityDisconnect(EgLpcListenerObject* self, const EntityAddressType* entity_addr) {}
+
+void EgLpcOnPowerLimitReceive(
+    EgLpcListenerObject* self,
+    const ScaledValue* power_limit,
+    const DurationType* duration,
+    bool is_active
+) {
+  atomic_store(&bench.eg_limit_received, power_limit->value);
+}
+
+void EgLpcOnFailsafePowerLimitReceive(EgLpcListenerObject* self, const ScaledValue* power_limit) {}
+
+void EgLpcOnFailsafeDurationReceive(EgLpcListenerObject* self, const DurationType* duration) {}
+
+void EgLpcOnHeartbeatReceive(EgLpcListenerObject* self, uint64_t heartbeat_counter) {}
+
+void MaMpcListenerDestruct(MaMpcListenerObject* self) {}
+
+void MaMpcOnRemoteEntityConnect(MaMpcListenerObject* self, const EntityAddressType* entity_addr) {
+  if (!atomic_exchange(&bench.is_ma_mpc_connected, true)) {
+    atomic_fetch_add(&bench.connected_num, 1);
+  }
+}
+
+void MaMpcOnRemoteEntityDisconnect(MaMpcListenerObject* self, const EntityAddressType* entity_addr) {}
+
+void MaMpcOnMeasurementReceive(
+    MaMpcListenerObject* self,
+    MuMpcMeasurementNameId name_id,
+    const ScaledValue* measurement_value,
+    const EntityAddressType* remote_entity_addr
+) {
+  atomic_fetch_add(&bench.measurements_received, 1);
+}
+
+static uint64_t NowNs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000 * 1000 * 1000 + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Waits until the value updated by the listeners reaches the expected one
+ * @return true if reached within the timeout, false otherwise
+ */
+static bool WaitFor(atomic_int_fast64_t* value, int64_t expected, uint64_t timeout_ns) {
+  const uint64_t start = NowNs();
+  while (atomic_load(value) < expected) {
+    if (NowNs() - start > timeout_ns) {
+      return false;
+    }
+
+    EebusThreadUsleep(kPollIntervalUs);
+  }
+
+  return true;
+}
+
+static int CompareUint64(const void* a, const void* b) {
+  const uint64_t lhs = *(const uint64_t*)a;
+  const uint64_t rhs = *(const uint64_t*)b;
+  return (lhs > rhs) - (lhs < rhs);
+}
+
+static void PrintLatency(const char* name, uint64_t* samples, size_t samples_size) {
+  qsort(samples, samples_size, sizeof(samples[0]), CompareUint64);
+
+  printf(
+      "%-24s min %8.1f us, p50 %8.1f us, p99 %8.1f us, max %8.1f us\n",
+      name,
+      (double)samples[0] / 1000.0,
+      (double)samples[samples_size / 2] / 1000.0,
+      (double)samples[(samples_size * 99) / 100] / 1000.0,
+      (double)samples[samples_size - 1] / 1000.0
+  );
+}
+
+static EebusError PeerCreate(
+    BenchPeer* self,
+    const char* model,
+    const char* device_type,
+    int32_t port,
+    const char* role,
+    EntityTypeType entity_type
+) {
+  SERVICE_READER_INTERFACE(self) = &bench_peer_methods;
+
+  self->cfg     = NULL;
+  self->service = NULL;
+  self->entity  = NULL;
+  self->ski     = NULL;
+
+  TlsCertificateObject* const tls_certificate = TlsCertificateCreateSelfSigned(model, kCertificateValidDays);
+  if (tls_certificate == NULL) {
+    return kEebusErrorInit;
+  }
+
+  self->ski = StringCopy(TLS_CERTIFICATE_GET_SKI(tls_certificate));
+
+  self->cfg = EebusServiceConfigCreate("OpenEEBUS", "OpenEEBUS", model, "123456789", device_type, port);
+  if ((self->ski == NULL) || (self->cfg == NULL)) {
+    TlsCertificateDelete(tls_certificate);
+    return kEebusErrorMemoryAllocate;
+  }
+
+  EebusServiceConfigSetMdnsDisabled(self->cfg, true);
+
+  // Service takes over the certificate
+  self->service = EebusServiceCreate(self->cfg, role, tls_certificate, SERVICE_READER_OBJECT(self));
+  if (self->service == NULL) {
+    return kEebusErrorInit;
+  }
+
+  DeviceLocalObject* const device_local = EEBUS_SERVICE_GET_LOCAL_DEVICE(self->service);
+
+  uint32_t entity_ids[1] = {VectorGetSize(DEVICE_LOCAL_GET_ENTITIES(device_local))};
+
+  self->entity = EntityLocalCreate(device_local, entity_type, entity_ids, 1, kHeartbeatTimeoutSeconds);
+  if (self->entity == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  return kEebusErrorOk;
+}
+
+static EebusError AddHeatPumpUseCases(Bench* self) {
+  static const MuMpcMeasurementConfig measurement_default_cfg = {
+      .value_source = kMeasurementValueSourceTypeMeasuredValue,
+  };
+
+  static const MuMpcMonitorEnergyConfig energy_cfg = {
+      .energy_production_cfg  = &measurement_default_cfg,
+      .energy_consumption_cfg = &measurement_default_cfg,
+  };
+
+  static const MuMpcMonitorCurrentConfig current_cfg = {
+      .current_phase_a_cfg = &measurement_default_cfg,
+      .current_phase_b_cfg = &measurement_default_cfg,
+      .current_phase_c_cfg = &measurement_default_cfg,
+  };
+
+  static const MuMpcMonitorVoltageConfig voltage_cfg = {
+      .voltage_phase_a_cfg  = &measurement_default_cfg,
+      .voltage_phase_b_cfg  = &measurement_default_cfg,
+      .voltage_phase_c_cfg  = &measurement_default_cfg,
+      .voltage_phase_ab_cfg = &measurement_default_cfg,
+      .voltage_phase_bc_cfg = &measurement_default_cfg,
+      .voltage_phase_ac_cfg = &measurement_default_cfg,
+  };
+
+  static const MuMpcMonitorFrequencyConfig frequency_cfg = {
+      .frequency_cfg = {.value_source = kMeasurementValueSourceTypeMeasuredValue},
+  };
+
+  static const MuMpcConfig cfg = {
+    .power_cfg = {
+        .power_total_cfg   = {.value_source = kMeasurementValueSourceTypeMeasuredValue},
+        .power_phase_a_cfg = &measurement_default_cfg,
+        .power_phase_b_cfg = &measurement_default_cfg,
+        .power_phase_c_cfg = &measurement_default_cfg,
+    },
+
+    .energy_cfg    = &energy_cfg,
+    .current_cfg   = &current_cfg,
+    .voltage_cfg   = &voltage_cfg,
+    .frequency_cfg = &frequency_cfg
+  };
+
+  CS_LPC_LISTENER_INTERFACE(&self->cs_lpc_listener) = &cs_lpc_listener_methods;
+
+  self->cs_lpc = CsLpcUseCaseCreate(self->heat_pump.entity, kElectricalConnectionId, &self->cs_lpc_listener);
+  self->mu_mpc = MuMpcUseCaseCreate(self->heat_pump.entity, kElectricalConnectionId, &cfg);
+  if ((self->cs_lpc == NULL) || (self->mu_mpc == NULL)) {
+    return kEebusErrorInit;
+  }
+
+  return kEebusErrorOk;
+}
+
+static EebusError AddHemsUseCases(Bench* self) {
+  EG_LPC_LISTENER_INTERFACE(&self->eg_lpc_listener) = &eg_lpc_listener_methods;
+  MA_MPC_LISTENER_INTERFACE(&self->ma_mpc_listener) = &ma_mpc_listener_methods;
+
+  self->eg_lpc = EgLpcUseCaseCreate(self->hems.entity, &self->eg_lpc_listener);
+  self->ma_mpc = MaMpcUseCaseCreate(self->hems.entity, &self->ma_mpc_listener);
+  if ((self->eg_lpc == NULL) || (self->ma_mpc == NULL)) {
+    return kEebusErrorInit;
+  }
+
+  return kEebusErrorOk;
+}
+
+static EebusError BenchOpen(Bench* self, int32_t port) {
+  EebusError err = PeerCreate(
+      &self->heat_pump,
+      "HeatPump",
+      "HeatGenerationSystem",
+      port,
+      "server",
+      kEntityTypeTypeHeatPumpAppliance
+  );
+
+  if (err == kEebusErrorOk) {
+    err = PeerCreate(&self->hems, "HEMS", "EnergyManagementSystem", port + 1, "client", kEntityTypeTypeCEM);
+  }
+
+  if (err == kEebusErrorOk) {
+    err = AddHeatPumpUseCases(self);
+  }
+
+  if (err == kEebusErrorOk) {
+    err = AddHemsUseCases(self);
+  }
+
+  if (err != kEebusErrorOk) {
+    return err;
+  }
+
+  DEVICE_LOCAL_ADD_ENTITY(EEBUS_SERVICE_GET_LOCAL_DEVICE(self->heat_pump.service), self->heat_pump.entity);
+  self->heat_pump.entity = NULL;
+  DEVICE_LOCAL_ADD_ENTITY(EEBUS_SERVICE_GET_LOCAL_DEVICE(self->hems.service), self->hems.entity);
+  self->hems.entity = NULL;
+
+  // Trust each other in advance
+  EEBUS_SERVICE_REGISTER_REMOTE_SKI(self->heat_pump.service, self->hems.ski, true);
+  EEBUS_SERVICE_REGISTER_REMOTE_SKI(self->hems.service, self->heat_pump.ski, true);
+
+  const MdnsEntry heat_pump_entry = {
+      .name    = "OpenEEBUS-HeatPump-123456789",
+      .host    = "127.0.0.1",
+      .port    = (uint16_t)port,
+      .txtvers = "1",
+      .id      = "OpenEEBUS-HeatPump-123456789",
+      .path    = "/ship/",
+      .ski     = self->heat_pump.ski,
+      .reg     = "false",
+  };
+
+  EEBUS_SERVICE_ADD_REMOTE_SERVICE(self->hems.service, &heat_pump_entry);
+  return kEebusErrorOk;
+}
+
+static void BenchClose(Bench* self) {
+  // Stop the services first, no more listener calls are expected afterwards
+  PeerDestruct(SERVICE_READER_OBJECT(&self->hems));
+  PeerDestruct(SERVICE_READER_OBJECT(&self->heat_pump));
+
+  EntityLocalDelete(self->heat_pump.entity);
+  self->heat_pump.entity = NULL;
+  EntityLocalDelete(self->hems.entity);
+  self->hems.entity = NULL;
+
+  UseCaseDelete(USE_CASE_OBJECT(self->cs_lpc));
+  self->cs_lpc = NULL;
+  UseCaseDelete(USE_CASE_OBJECT(self->mu_mpc));
+  self->mu_mpc = NULL;
+  UseCaseDelete(USE_CASE_OBJECT(self->eg_lpc));
+  self->eg_lpc = NULL;
+  UseCaseDelete(USE_CASE_OBJECT(self->ma_mpc));
+  self->ma_mpc = NULL;
+
+  EntityAddressDelete(self->eg_lpc_remote_entity_addr);
+  self->eg_lpc_remote_entity_addr = NULL;
+}
+
+static bool BenchConnect(Bench* self) {
+  const uint64_t start = NowNs();
+
+  EEBUS_SERVICE_START(self->heat_pump.service);
+  EEBUS_SERVICE_START(self->hems.service);
+
+  if (!WaitFor(&self->connected_num, 2, kWaitTimeoutNs)) {
+    printf("Connection not established within the timeout\n");
+    return false;
+  }
+
+  printf("Connection established in %.3f ms\n", (double)(NowNs() - start) / 1000.0 / 1000.0);
+  return true;
+}
+
+static EebusError WriteLimit(Bench* self, int64_t value) {
+  const LoadLimit limit = {
+      .value     = {.value = value, .scale = 0},
+      .is_active = true,
+  };
+
+  return EgLpcSetActivePowerConsumptionLimit(self->eg_lpc, self->eg_lpc_remote_entity_addr, &limit);
+}
+
+static bool RunLpcWrite(Bench* self, size_t iterations) {
+  // The first write is possible once the limit descriptions are read by EG
+  int64_t value        = 1000;
+  const uint64_t start = NowNs();
+  while ((WriteLimit(self, value) != kEebusErrorOk)
+         || !WaitFor(&self->eg_limit_received, value, kWarmupAttemptTimeoutNs)) {
+    if (NowNs() - start > kWaitTimeoutNs) {
+      printf("LPC write not acknowledged within the timeout\n");
+      return false;
+    }
+  }
+
+  uint64_t* const applied    = (uint64_t*)calloc(iterations, sizeof(uint64_t));
+  uint64_t* const round_trip = (uint64_t*)calloc(iterations, sizeof(uint64_t));
+
+  bool ok = (applied != NULL) && (round_trip != NULL);
+  for (size_t i = 0; ok && (i < iterations); ++i) {
+    ++value;
+
+    const uint64_t t0 = NowNs();
+
+    ok = (WriteLimit(self, value) == kEebusErrorOk) && WaitFor(&self->cs_limit_received, value, kWaitTimeoutNs);
+    applied[i] = NowNs() - t0;
+
+    ok            = ok && WaitFor(&self->eg_limit_received, value, kWaitTimeoutNs);
+    round_trip[i] = NowNs() - t0;
+  }
+
+  if (ok) {
+    printf("LPC write, %zu iterations\n", iterations);
+    PrintLatency("  applied by CS", applied, iterations);
+    PrintLatency("  notified back to EG", round_trip, iterations);
+  } else {
+    printf("LPC write failed\n");
+  }
+
+  free(applied);
+  free(round_trip);
+  return ok;
+}
+
+static bool RunMpcNotify(Bench* self, const MuMpcMeasurementNameId* names, size_t names_size, size_t iterations) {
+  MuMpcMeasurementSample samples[16] = {0};
+  if (names_size > ARRAY_SIZE(samples)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < names_size; ++i) {
+    samples[i].name = names[i];
+  }
+
+  // Only the changed measurements are notified, so every iteration sets the new values
+  int64_t value = 0;
+
+  // The first notify is received once the measurement descriptions are read by MA
+  const uint64_t start = NowNs();
+  int64_t expected     = 0;
+  do {
+    if (NowNs() - start > kWaitTimeoutNs) {
+      printf("MPC notify not received within the timeout\n");
+      return false;
+    }
+
+    ++value;
+    for (size_t i = 0; i < names_size; ++i) {
+      samples[i].value = (ScaledValue){.value = value, .scale = 0};
+    }
+
+    expected = atomic_load(&self->measurements_received) + (int64_t)names_size;
+    if (MuMpcUpdateMeasurementData(self->mu_mpc, samples, names_size) != kEebusErrorOk) {
+      return false;
+    }
+  } while (!WaitFor(&self->measurements_received, expected, kWarmupAttemptTimeoutNs));
+
+  expected          = atomic_load(&self->measurements_received) + (int64_t)(names_size * iterations);
+  const uint64_t t0 = NowNs();
+
+  for (size_t n = 0; n < iterations; ++n) {
+    ++value;
+    for (size_t i = 0; i < names_size; ++i) {
+      samples[i].value = (ScaledValue){.value = value, .scale = 0};
+    }
+
+    if (MuMpcUpdateMeasurementData(self->mu_mpc, samples, names_size) != kEebusErrorOk) {
+      return false;
+    }
+  }
+
+  if (!WaitFor(&self->measurements_received, expected, kWaitTimeoutNs)) {
+    printf("MPC notify of %zu measurements not received within the timeout\n", names_size);
+    return false;
+  }
+
+  const double seconds = (double)(NowNs() - t0) / 1000.0 / 1000.0 / 1000.0;
+  printf(
+      "MPC notify, %2zu measurements: %9.1f notifies/s, %9.1f measurements/s\n",
+      names_size,
+      (double)iterations / seconds,
+      (double)(iterations * names_size) / seconds
+  );
+
+  return true;
+}
+
+static bool RunMpc(Bench* self, size_t iterations) {
+  static const MuMpcMeasurementNameId power_total[] = {kMpcPowerTotal};
+
+  static const MuMpcMeasurementNameId power_per_phase[] = {kMpcPowerPhaseA, kMpcPowerPhaseB, kMpcPowerPhaseC};
+
+  static const MuMpcMeasurementNameId voltage_per_phase[] = {
+      kMpcVoltagePhaseA,
+      kMpcVoltagePhaseB,
+      kMpcVoltagePhaseC,
+      kMpcVoltagePhaseAb,
+      kMpcVoltagePhaseBc,
+      kMpcVoltagePhaseAc,
+  };
+
+  static const MuMpcMeasurementNameId all[] = {
+      kMpcPowerTotal,
+      kMpcPowerPhaseA,
+      kMpcPowerPhaseB,
+      kMpcPowerPhaseC,
+      kMpcEnergyConsumed,
+      kMpcEnergyProduced,
+      kMpcCurrentPhaseA,
+      kMpcCurrentPhaseB,
+      kMpcCurrentPhaseC,
+      kMpcVoltagePhaseA,
+      kMpcVoltagePhaseB,
+      kMpcVoltagePhaseC,
+      kMpcVoltagePhaseAb,
+      kMpcVoltagePhaseBc,
+      kMpcVoltagePhaseAc,
+      kMpcFrequency,
+  };
+
+  return RunMpcNotify(self, power_total, ARRAY_SIZE(power_total), iterations)
+         && RunMpcNotify(self, power_per_phase, ARRAY_SIZE(power_per_phase), iterations)
+         && RunMpcNotify(self, voltage_per_phase, ARRAY_SIZE(voltage_per_phase), iterations)
+         && RunMpcNotify(self, all, ARRAY_SIZE(all), iterations);
+}
+
+static void PrintUsage(void) {
+  printf("General Usage:\n");
+  printf("ship_benchmark [<server_port> [<iterations>]]\n");
+}
+
+int main(int argc, char** argv) {
+  if (argc > 3) {
+    PrintUsage();
+    return -1;
+  }
+
+  const int32_t port      = (argc > 1) ? atoi(argv[1]) : kDefaultPort;
+  const size_t iterations = (argc > 2) ? (size_t)atoi(argv[2]) : kDefaultIterations;
+  if ((port <= 0) || (port >= UINT16_MAX) || (iterations == 0)) {
+    PrintUsage();
+    return -1;
+  }
+
+  bool ok = (BenchOpen(&bench, port) == kEebusErrorOk);
+  if (!ok) {
+    printf("Failed to open the EEBUS services!\n");
+  }
+
+  ok = ok && BenchConnect(&bench);
+  ok = ok && RunLpcWrite(&bench, iterations);
+  ok = ok && RunMpc(&bench, iterations);
+
+  BenchClose(&bench);
+
+  return ok ? 0 : -1;
+}
@@ -0,0 +1,703 @@
+#!/usr/bin/env python3
+# Copyright 2025 NIBE AB
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate the specialized SPINE codecs from the EEBUS Data configuration tables.
+
+The SPINE model tables (src/spine/model/*.inc) are interpreted at runtime by the
+EEBUS Data methods: every field is looked up by name and every operation goes
+through the interface function pointers. For the choice elements opted in with
+EEBUS_DATA_CHOICE_ELEMENT_CODEC() this script emits straight-line C code doing the
+same on the data structures directly. The emitted file is included by
+command_frame_types.inc when EEBUS_SPINE_CODECS is defined.
+
+Fields the generator has no specialized code for (tags, date and time values,
+lists of simple types) keep being handled by their EEBUS Data methods. Sequences
+that can not be specialized (e.g. having a choice) are left to the interpreted
+path entirely.
+
+Usage: spine_codecs.py <model directory> <output file>
+"""
+
+import os
+import re
+import sys
+
+# Max number of sequence fields, limited by the size of the "found" fields bit mask
+MAX_FIELDS = 64
+
+MAX_LINE_LENGTH = 120
+
+NUMERIC_TYPES = {
+    "UINT8": "Uint8",
+    "UINT16": "Uint16",
+    "UINT32": "Uint32",
+    "UINT64": "Uint64",
+    "INT8": "Int8",
+    "INT16": "Int16",
+    "INT32": "Int32",
+    "INT64": "Int64",
+}
+
+# Fields handled by their EEBUS Data methods, looked up by name same as specialized ones
+GENERIC_FIELDS = {
+    "TAG",
+    "DATE",
+    "TIME",
+    "DATE_TIME",
+    "DURATION",
+    "ABSOLUTE_OR_RELATIVE_TIME",
+}
+
+LICENSE = """/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */"""
+
+
+class Field:
+    """A single entry of EEBUS Data configuration table"""
+
+    def __init__(self, macro, args):
+        self.macro = macro
+        self.args = args
+        self.kind = None
+        self.name = None
+        self.struct_name = None
+        self.member = None
+        # Numeric type name, enum lookup table or child configuration depending on kind
+        self.param = None
+        self.child = None
+
+
+class Codec:
+    """Specialized codec of a single sequence configuration table"""
+
+    def __init__(self, cfg_name, struct_name, fields):
+        self.cfg_name = cfg_name
+        self.struct_name = struct_name
+        self.fields = fields
+        self.prefix = "Codec" + camel_case(cfg_name)
+
+
+def camel_case(cfg_name):
+    base = cfg_name[: -len("_cfg")] if cfg_name.endswith("_cfg") else cfg_name
+    return "".join(word[:1].upper() + word[1:] for word in base.split("_"))
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def split_args(text):
+    """Split the macro arguments on top level commas"""
+    args = []
+    depth = 0
+    current = ""
+    for c in text:
+        if c in "([{":
+            depth += 1
+        elif c in ")]}":
+            depth -= 1
+
+        if c == "," and depth == 0:
+            args.append(current.strip())
+            current = ""
+        else:
+            current += c
+
+    if current.strip():
+        args.append(current.strip())
+
+    return args
+
+
+def parse_macros(text):
+    """Return the list of (macro name, arguments) of top level macro calls found in text"""
+    macros = []
+    pos = 0
+    rx = re.compile(r"\b(EEBUS_DATA_\w+)\s*(\(?)")
+    while True:
+        m = rx.search(text, pos)
+        if m is None:
+            return macros
+
+        if not m.group(2):
+            # Argument-less macro, e.g. EEBUS_DATA_END
+            macros.append((m.group(1), []))
+            pos = m.end()
+            continue
+
+        depth = 1
+        i = m.end()
+        while depth > 0:
+            if text[i] == "(":
+                depth += 1
+            elif text[i] == ")":
+                depth -= 1
+            i += 1
+
+        macros.append((m.group(1), split_args(text[m.end() : i - 1])))
+        pos = i
+
+
+def parse_tables(model_dir):
+    """Collect the configuration tables (arrays) and single entries of all model files"""
+    tables = {}
+    singles = {}
+    for file_name in sorted(os.listdir(model_dir)):
+        if not file_name.endswith(".inc"):
+            continue
+
+        with open(os.path.join(model_dir, file_name), encoding="utf-8") as f:
+            text = strip_comments(f.read())
+
+        for m in re.finditer(r"static\s+const\s+EebusDataCfg\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};", text, re.S):
+            tables[m.group(1)] = parse_macros(m.group(2))
+
+        for m in re.finditer(r"static\s+const\s+EebusDataCfg\s+(\w+)\s*=\s*(EEBUS_DATA_\w+\s*\(.*?\))\s*;", text, re.S):
+            singles[m.group(1)] = parse_macros(m.group(2))[0]
+
+    return tables, singles
+
+
+def parse_codec_elements(model_dir):
+    """Collect the configuration tables of choice elements opted in for the specialized codecs"""
+    with open(os.path.join(model_dir, "command_frame_types.inc"), encoding="utf-8") as f:
+        text = strip_comments(f.read())
+
+    elements = []
+    for macro, args in parse_macros(text):
+        if (macro == "EEBUS_DATA_CHOICE_ELEMENT_CODEC") and (len(args) == 3) and (args[0] != "ed_name"):
+            elements.append(args[2])
+
+    return elements
+
+
+class Generator:
+    def __init__(self, tables, singles):
+        self.tables = tables
+        self.singles = singles
+        # Codecs in the order of definition: children go before parents
+        self.codecs = []
+        # Configuration table name to codec, None if the table can not be specialized
+        self.specialized = {}
+
+    def codec(self, cfg_name):
+        """Get the specialized codec of sequence configuration table, None if not possible"""
+        if cfg_name in self.specialized:
+            return self.specialized[cfg_name]
+
+        # Guard against the recursive data types
+        self.specialized[cfg_name] = None
+
+        entries = self.tables.get(cfg_name)
+        if (entries is None) or (not entries) or (entries[-1][0] != "EEBUS_DATA_END"):
+            return None
+
+        fields = [self.field(macro, args) for macro, args in entries[:-1]]
+        if (not fields) or (len(fields) > MAX_FIELDS) or any(field is None for field in fields):
+            return None
+
+        # Fields are looked up ignoring the case, same as Json object items are
+        names = [field.name.lower() for field in fields]
+        if len(set(names)) != len(names):
+            return None
+
+        struct_names = set(field.struct_name for field in fields)
+        if len(struct_names) != 1:
+            return None
+
+        codec = Codec(cfg_name, struct_names.pop(), fields)
+        self.codecs.append(codec)
+        self.specialized[cfg_name] = codec
+        return codec
+
+    def field(self, macro, args):
+        name = macro[len("EEBUS_DATA_") :]
+        if name.endswith("_WITH_FLAGS"):
+            name = name[: -len("_WITH_FLAGS")]
+
+        if (len(args) < 3) or (not args[0].startswith('"')):
+            return None
+
+        field = Field(macro, args)
+        field.name = args[0].strip('"')
+        field.struct_name = args[1]
+        field.member = args[2]
+
+        if name in NUMERIC_TYPES:
+            field.kind = "numeric"
+            field.param = NUMERIC_TYPES[name]
+        elif name == "ENUM":
+            field.kind = "enum"
+            field.param = args[3]
+        elif name == "BOOL":
+            field.kind = "bool"
+        elif name == "STRING":
+            field.kind = "string"
+        elif name == "SEQUENCE":
+            field.child = self.codec(args[3])
+            field.kind = "sequence" if field.child is not None else "generic"
+        elif name == "LIST":
+            field.child = self.list_element_codec(args[3])
+            field.kind = "list" if field.child is not None else "generic"
+        elif name in GENERIC_FIELDS:
+            field.kind = "generic"
+        else:
+            # Unknown data type, e.g. a choice
+            return None
+
+        return field
+
+    def list_element_codec(self, element_cfg):
+        if not element_cfg.startswith("&"):
+            return None
+
+        element = self.singles.get(element_cfg[1:])
+        if (element is None) or (element[0] != "EEBUS_DATA_LIST_ELEMENT") or (element[1][0] != "sequence"):
+            return None
+
+        return self.codec(element[1][2])
+
+
+def wrap_call(indent, head, args, tail):
+    """Format the function call the way clang-format does with the project settings"""
+    line = indent + head + ", ".join(args) + tail
+    if len(line) <= MAX_LINE_LENGTH:
+        return [line]
+
+    lines = [indent + head + args[0]]
+    for arg in args[1:]:
+        if len(lines[-1]) + len(arg) + 2 + len(tail) <= MAX_LINE_LENGTH:
+            lines[-1] += ", " + arg
+        else:
+            lines[-1] += ","
+            lines.append(indent[: len(indent) - len(indent.lstrip())] + "    " + arg)
+
+    lines[-1] += tail
+    return lines
+
+
+def fit_line(line):
+    """Break the long declaration the way clang-format does with the project settings"""
+    if len(line) <= MAX_LINE_LENGTH:
+        return [line]
+
+    indent = line[: len(line) - len(line.lstrip())]
+    if " = " in line:
+        lhs, rhs = line.split(" = ", 1)
+        return [lhs, indent + "    = " + rhs]
+
+    m = re.match(r"(static \w+)\s+(.*)", line)
+    if m is not None:
+        return [m.group(1), m.group(2)]
+
+    return [line]
+
+
+def emit_names(codec):
+    out = ["static const char* const {}_names[] = {{".format(codec.cfg_name)]
+    out += ['    "{}",'.format(field.name) for field in codec.fields]
+    out += ["};", ""]
+    return out
+
+
+def from_json_call(codec, idx, field):
+    member = "&buf->" + field.member
+    if field.kind == "numeric":
+        return "SpineCodec{}FromJson".format(field.param), [member, "json_field"]
+    if field.kind == "enum":
+        return "SpineCodecEnumFromJson", ["(const int32_t**)" + member, field.param, "json_field"]
+    if field.kind == "bool":
+        return "SpineCodecBoolFromJson", [member, "json_field"]
+    if field.kind == "string":
+        return "SpineCodecStringFromJson", ["(char**)" + member, "json_field"]
+    if field.kind == "sequence":
+        return field.child.prefix + "FromJson", ["(void**)" + member, "json_field"]
+    if field.kind == "list":
+        return "SpineCodecListFromJson", [
+            "(void***)" + member,
+            member + "_size",
+            "json_field",
+            field.child.prefix + "FromJson",
+        ]
+
+    return "EEBUS_DATA_FROM_JSON_OBJECT_ITEM", ["&{}[{}]".format(codec.cfg_name, idx), "buf", "json_field"]
+
+
+def to_json_call(codec, idx, field):
+    value = "buf->" + field.member
+    if field.kind == "numeric":
+        return "SpineCodec{}ToJson".format(field.param), [value, "&json_item"]
+    if field.kind == "enum":
+        return "SpineCodecEnumToJson", ["(const int32_t*)" + value, field.param, "&json_item"]
+    if field.kind == "bool":
+        return "SpineCodecBoolToJson", [value, "&json_item"]
+    if field.kind == "string":
+        return "SpineCodecStringToJson", [value, "&json_item"]
+    if field.kind == "sequence":
+        return field.child.prefix + "ToJson", [value, "&json_item"]
+    if field.kind == "list":
+        return "SpineCodecListToJson", [
+            "(const void* const*)" + value,
+            value + "_size",
+            "&json_item",
+            field.child.prefix + "ToJson",
+        ]
+
+    return "EEBUS_DATA_TO_JSON_OBJECT_ITEM", ["&{}[{}]".format(codec.cfg_name, idx), "buf", "&json_item"]
+
+
+def write_call(codec, idx, field):
+    member = "&buf->" + field.member
+    src = "src_buf->" + field.member
+    if field.kind == "numeric":
+        return "SpineCodec{}Write".format(field.param), [member, src]
+    if field.kind == "enum":
+        return "SpineCodecEnumWrite", ["(const int32_t**)" + member, "(const int32_t*)" + src]
+    if field.kind == "bool":
+        return "SpineCodecBoolWrite", [member, src]
+    if field.kind == "string":
+        return "SpineCodecStringWrite", ["(char**)" + member, src]
+    if field.kind == "sequence":
+        return field.child.prefix + "Write", ["(void**)" + member, src]
+    if field.kind == "list":
+        return "SpineCodecListWrite", [
+            "(void***)" + member,
+            member + "_size",
+            "(const void* const*)" + src,
+            src + "_size",
+            field.child.prefix + "Write",
+            field.child.prefix + "Delete",
+        ]
+
+    return "EEBUS_DATA_WRITE", ["&{}[{}]".format(codec.cfg_name, idx), "buf", "src_buf"]
+
+
+def compare_call(codec, idx, field):
+    a = "a_buf->" + field.member
+    b = "b_buf->" + field.member
+    if field.kind == "numeric":
+        return "SpineCodec{}Compare".format(field.param), [a, b]
+    if field.kind == "enum":
+        return "SpineCodecEnumCompare", ["(const int32_t*)" + a, "(const int32_t*)" + b]
+    if field.kind == "bool":
+        return "SpineCodecBoolCompare", [a, b]
+    if field.kind == "string":
+        return "SpineCodecStringCompare", [a, b]
+    if field.kind == "sequence":
+        return field.child.prefix + "Compare", [a, b]
+    if field.kind == "list":
+        return "SpineCodecListCompare", [
+            "(const void* const*)" + a,
+            a + "_size",
+            "(const void* const*)" + b,
+            b + "_size",
+            field.child.prefix + "Compare",
+        ]
+
+    cfg = "&{}[{}]".format(codec.cfg_name, idx)
+    return "EEBUS_DATA_COMPARE", [cfg, "a_buf", cfg, "b_buf"]
+
+
+def delete_call(codec, idx, field):
+    member = "&buf->" + field.member
+    if field.kind == "numeric":
+        return "SpineCodec{}Delete".format(field.param), [member]
+    if field.kind == "enum":
+        return "SpineCodecEnumDelete", ["(const int32_t**)" + member]
+    if field.kind == "bool":
+        return "SpineCodecBoolDelete", [member]
+    if field.kind == "string":
+        return "SpineCodecStringDelete", ["(char**)" + member]
+    if field.kind == "sequence":
+        return field.child.prefix + "Delete", ["(void**)" + member]
+    if field.kind == "list":
+        return "SpineCodecListDelete", ["(void***)" + member, member + "_size", field.child.prefix + "Delete"]
+
+    return "EEBUS_DATA_DELETE", ["&{}[{}]".format(codec.cfg_name, idx), "buf"]
+
+
+def emit_prototypes(codec):
+    p = codec.prefix
+    return [
+        "static EebusError {}FromJson(void** data, const JsonObject* json_seq);".format(p),
+        "static EebusError {}ToJson(const void* data, JsonObject** json_seq);".format(p),
+        "static EebusError {}Write(void** data, const void* src);".format(p),
+        "static bool {}Compare(const void* a, const void* b);".format(p),
+        "static void {}Delete(void** data);".format(p),
+    ]
+
+
+def emit_from_json(codec):
+    s = codec.struct_name
+    out = [
+        "EebusError {}FromJson(void** data, const JsonObject* json_seq) {{".format(codec.prefix),
+        "  if (!JsonIsArray(json_seq)) {",
+        "    return kEebusErrorParse;",
+        "  }",
+        "",
+        "  if (SpineCodecCreate(data, sizeof({})) == NULL) {{".format(s),
+        "    return kEebusErrorMemoryAllocate;",
+        "  }",
+        "",
+        "  {0}* const buf = ({0}*)*data;".format(s),
+        "",
+        "  // Only the first item of each name is taken, same as with the item lookup by name",
+        "  uint64_t found = 0;",
+        "  size_t hint    = 0;",
+        "  for (const JsonObject* json_el = JsonGetChild(json_seq); json_el != NULL; json_el = JsonGetNext(json_el)) {",
+        "    for (const JsonObject* json_field = JsonGetChild(json_el); json_field != NULL;",
+        "         json_field = JsonGetNext(json_field)) {",
+    ]
+    out += wrap_call(
+        "      ",
+        "const size_t idx = SpineCodecFindField(",
+        ["{}_names".format(codec.cfg_name), str(len(codec.fields)), "hint", "JsonGetName(json_field)"],
+        ");",
+    )
+    out += [
+        "      if ((idx == SPINE_CODEC_NO_FIELD) || ((found & ((uint64_t)1 << idx)) != 0)) {",
+        "        continue;",
+        "      }",
+        "",
+        "      found |= (uint64_t)1 << idx;",
+        "      hint = idx + 1;",
+        "",
+        "      EebusError ret = kEebusErrorOk;",
+        "      switch (idx) {",
+    ]
+    for idx, field in enumerate(codec.fields):
+        func, args = from_json_call(codec, idx, field)
+        out.append("        case {}:".format(idx))
+        out += wrap_call("          ", "ret = {}(".format(func), args, ");")
+        out.append("          break;")
+
+    out += [
+        "        default:",
+        "          break;",
+        "      }",
+        "",
+        "      if (ret != kEebusErrorOk) {",
+        "        return ret;",
+        "      }",
+        "    }",
+        "  }",
+        "",
+        "  return kEebusErrorOk;",
+        "}",
+        "",
+    ]
+    return out
+
+
+def emit_to_json(codec):
+    s = codec.struct_name
+    out = [
+        "EebusError {}ToJson(const void* data, JsonObject** json_seq) {{".format(codec.prefix),
+        "  const {0}* const buf = (const {0}*)data;".format(s),
+        "  if (buf == NULL) {",
+        "    *json_seq = NULL;",
+        "    return kEebusErrorOk;",
+        "  }",
+        "",
+        "  *json_seq = JsonCreateArray();",
+        "  if (*json_seq == NULL) {",
+        "    return kEebusErrorMemoryAllocate;",
+        "  }",
+        "",
+        "  JsonObject* json_item = NULL;",
+        "  EebusError ret        = kEebusErrorOk;",
+    ]
+    for idx, field in enumerate(codec.fields):
+        func, args = to_json_call(codec, idx, field)
+        out.append("")
+        out += wrap_call("  ", "ret = {}(".format(func), args, ");")
+        out += wrap_call("  ", "ret = SpineCodecSequenceAppend(", ["json_seq", '"{}"'.format(field.name), "json_item", "ret"], ");")
+        out += [
+            "  if (ret != kEebusErrorOk) {",
+            "    return ret;",
+            "  }",
+        ]
+
+    out += [
+        "",
+        "  return kEebusErrorOk;",
+        "}",
+        "",
+    ]
+    return out
+
+
+def emit_write(codec):
+    s = codec.struct_name
+    out = [
+        "EebusError {}Write(void** data, const void* src) {{".format(codec.prefix),
+        "  const {0}* const src_buf = (const {0}*)src;".format(s),
+        "  if (src_buf == NULL) {",
+        "    {}Delete(data);".format(codec.prefix),
+        "    return kEebusErrorOk;",
+        "  }",
+        "",
+        "  if ((*data == NULL) && (SpineCodecCreate(data, sizeof(*src_buf)) == NULL)) {",
+        "    return kEebusErrorMemoryAllocate;",
+        "  }",
+        "",
+        "  {0}* const buf = ({0}*)*data;".format(s),
+        "",
+        "  EebusError ret = kEebusErrorOk;",
+    ]
+    for idx, field in enumerate(codec.fields):
+        func, args = write_call(codec, idx, field)
+        out.append("")
+        out += wrap_call("  ", "ret = {}(".format(func), args, ");")
+        out += [
+            "  if (ret != kEebusErrorOk) {",
+            "    return ret;",
+            "  }",
+        ]
+
+    out += [
+        "",
+        "  return kEebusErrorOk;",
+        "}",
+        "",
+    ]
+    return out
+
+
+def emit_compare(codec):
+    s = codec.struct_name
+    out = [
+        "bool {}Compare(const void* a, const void* b) {{".format(codec.prefix),
+        "  const {0}* const a_buf = (const {0}*)a;".format(s),
+        "  const {0}* const b_buf = (const {0}*)b;".format(s),
+        "  if ((a_buf == NULL) || (b_buf == NULL)) {",
+        "    return a_buf == b_buf;",
+        "  }",
+        "",
+    ]
+    for idx, field in enumerate(codec.fields):
+        func, args = compare_call(codec, idx, field)
+        head = "  return " if idx == 0 else "      && "
+        tail = ";" if idx == len(codec.fields) - 1 else ""
+        out += wrap_call(head, "{}(".format(func), args, ")" + tail)
+
+    out += [
+        "}",
+        "",
+    ]
+    return out
+
+
+def emit_delete(codec):
+    s = codec.struct_name
+    out = [
+        "void {}Delete(void** data) {{".format(codec.prefix),
+        "  {0}* const buf = ({0}*)*data;".format(s),
+        "  if (buf == NULL) {",
+        "    return;",
+        "  }",
+        "",
+    ]
+    for idx, field in enumerate(codec.fields):
+        func, args = delete_call(codec, idx, field)
+        out += wrap_call("  ", "{}(".format(func), args, ");")
+
+    out += [
+        "  SpineCodecFree(data);",
+        "}",
+        "",
+    ]
+    return out
+
+
+def generate(model_dir):
+    tables, singles = parse_tables(model_dir)
+    generator = Generator(tables, singles)
+
+    containers = []
+    for cfg_name in parse_codec_elements(model_dir):
+        codec = generator.codec(cfg_name)
+        if codec is None:
+            sys.exit("spine_codecs: {} can not be specialized".format(cfg_name))
+
+        containers.append(codec)
+
+    out = [
+        LICENSE,
+        "/**",
+        " * @file",
+        " * @brief SPINE specialized codecs",
+        " *",
+        " * Generated by scripts/codegen/spine_codecs.py from the SPINE model tables, do not edit.",
+        " */",
+        "",
+        "#ifndef SRC_SPINE_MODEL_SPINE_CODECS_INC_",
+        "#define SRC_SPINE_MODEL_SPINE_CODECS_INC_",
+        "",
+        '#include "src/spine/model/spine_codec_util.h"',
+        "",
+    ]
+
+    for codec in generator.codecs:
+        out += emit_prototypes(codec)
+
+    out.append("")
+
+    for codec in generator.codecs:
+        out += emit_names(codec)
+        out += emit_from_json(codec)
+        out += emit_to_json(codec)
+        out += emit_write(codec)
+        out += emit_compare(codec)
+        out += emit_delete(codec)
+
+    for codec in containers:
+        out += wrap_call("", "SPINE_CODEC_CONTAINER_DECL(", [codec.cfg_name, camel_case(codec.cfg_name)], ")")
+
+    out += [
+        "",
+        "#endif  // SRC_SPINE_MODEL_SPINE_CODECS_INC_",
+        "",
+    ]
+    return "\n".join(fitted for line in out for fitted in fit_line(line))
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("Usage: {} <model directory> <output file>".format(sys.argv[0]))
+
+    text = generate(sys.argv[1])
+
+    os.makedirs(os.path.dirname(os.path.abspath(sys.argv[2])), exist_ok=True)
+    with open(sys.argv[2], "w", encoding="utf-8") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()
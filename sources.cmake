@@ -11,6 +11,7 @@ set(SOURCES
   src/common/eebus_data/eebus_data_enum.c
   src/common/eebus_data/eebus_data_list.c
   src/common/eebus_data/eebus_data_numeric.c
+  src/common/eebus_data/eebus_data_selectors_map.c
   src/common/eebus_data/eebus_data_sequence.c
   src/common/eebus_data/eebus_data_simple.c
   src/common/eebus_data/eebus_data_string.c
@@ -31,6 +32,7 @@ set(SOURCES
   src/service/service/eebus_service_config.c
   src/service/service/eebus_service.c
   src/ship/mdns/mdns_entry.c
+  src/ship/mdns/mdns_entry_list.c
   src/ship/ship_connection/ship_connection.c
   src/ship/ship_connection/ship_connection_debug.c
   src/ship/ship_connection/ship_message.c
@@ -39,6 +41,7 @@ set(SOURCES
   src/ship/ship_connection/client.c
   src/ship/ship_connection/server.c
   src/ship/ship_node/ship_node.c
+  src/ship/ship_node/ship_node_reconnect.c
   src/ship/websocket/websocket.c
   src/ship/websocket/websocket_client_creator.c
   src/ship/websocket/websocket_server_creator.c
@@ -46,11 +49,13 @@ set(SOURCES
   src/ship/websocket/websocket_server.c
   src/ship/websocket/http_server.c
   src/ship/websocket/websocket_debug.c
+  src/ship/websocket/tls_session_cache.c
   src/spine/binding/binding_manager.c
   src/spine/device/data_reader.c
   src/spine/device/device_local.c
   src/spine/device/device_remote.c
   src/spine/device/device.c
+  src/spine/device/remote_device_cache.c
   src/spine/device/sender.c
   src/spine/entity/entity_local.c
   src/spine/entity/entity_remote.c
@@ -62,6 +67,7 @@ set(SOURCES
   src/spine/feature/feature.c
   src/spine/feature/feature_functions.c
   src/spine/feature/operations.c
+  src/spine/feature/pending_requests.c
   src/spine/feature_link/feature_link.c
   src/spine/feature_link/feature_link_container.c
   src/spine/function/function.c
@@ -101,6 +107,7 @@ set(SOURCES
   src/use_case/actor/ma/mpc/ma_mpc.c
   src/use_case/actor/ma/mpc/ma_mpc_events.c
   src/use_case/actor/ma/mpc/ma_mpc_measurement.c
+  src/use_case/actor/ma/mpc/ma_mpc_measurement_index.c
   src/use_case/actor/ma/mpc/ma_mpc_public.c
   src/use_case/actor/mu/mpc/mu_mpc.c
   src/use_case/actor/mu/mpc/mu_mpc_measurement.c
@@ -134,6 +141,7 @@ set(HEADERS
   src/common/api/eebus_queue_interface.h
   src/common/api/eebus_timer_interface.h
   src/common/array_util.h
+  src/common/cbor.h
   src/common/debug.h
   src/common/eebus_device_info.h
   src/common/eebus_assert.h
@@ -147,6 +155,7 @@ set(HEADERS
   src/common/eebus_arguments.h
   src/common/eebus_mutex/eebus_mutex.h
   src/common/eebus_queue/eebus_queue.h
+  src/common/eebus_queue/eebus_queue_mpsc.h
   src/common/eebus_thread/eebus_thread.h
   src/common/service_details.h
   src/common/string_lut.h
@@ -163,20 +172,24 @@ set(HEADERS
   src/ship/api/data_writer_interface.h
   src/ship/api/info_provider_interface.h
   src/ship/api/mdns_entry.h
+  src/ship/api/message_priority.h
   src/ship/api/ship_mdns_interface.h
   src/ship/api/ship_connection_interface.h
   src/ship/api/ship_message.h
   src/ship/api/ship_node_interface.h
   src/ship/api/ship_node_reader_interface.h
   src/ship/api/tls_certificate_interface.h
+  src/ship/api/tls_session_cache_interface.h
   src/ship/api/websocket_creator_interface.h
   src/ship/api/http_server_interface.h
   src/ship/api/websocket_interface.h
+  src/ship/mdns/mdns_entry_list.h
   src/ship/mdns/ship_mdns.h
   src/ship/model/model.h
   src/ship/model/types.h
   src/ship/ship_node/ship_node.h
   src/ship/ship_node/ship_node_internal.h
+  src/ship/ship_node/ship_node_reconnect.h
   src/ship/ship_connection/ship_connection.h
   src/ship/ship_connection/ship_connection_debug.h
   src/ship/ship_connection/ship_connection_internal.h
@@ -193,6 +206,7 @@ set(HEADERS
   src/ship/websocket/websocket_client_creator.h
   src/ship/websocket/websocket_server_creator.h
   src/ship/websocket/websocket_debug.h
+  src/ship/websocket/tls_session_cache.h
   src/ship/tls_certificate/tls_certificate.h
   src/spine/api/binding_manager_interface.h
   src/spine/api/device_interface.h
@@ -227,6 +241,7 @@ set(HEADERS
   src/spine/feature/feature.h
   src/spine/feature/feature_functions.h
   src/spine/feature/operations.h
+  src/spine/feature/pending_requests.h
   src/spine/function/function.h
   src/spine/heartbeat/heartbeat_manager.h
   src/spine/model/actuator_level_types.h
@@ -303,6 +318,7 @@ set(HEADERS
   src/spine/model/smart_energy_management_ps_types.h
   src/spine/model/smart_energy_management_ps_types.inc
   src/spine/model/specification_version.h
+  src/spine/model/spine_codec_util.h
   src/spine/model/state_information_types.h
   src/spine/model/state_information_types.inc
   src/spine/model/subscription_management_types.h
@@ -342,6 +358,7 @@ set(HEADERS
   src/use_case/actor/ma/mpc/ma_mpc_events.h
   src/use_case/actor/ma/mpc/ma_mpc_internal.h
   src/use_case/actor/ma/mpc/ma_mpc_measurement.h
+  src/use_case/actor/ma/mpc/ma_mpc_measurement_index.h
   src/use_case/actor/mu/mpc/mu_mpc.h
   src/use_case/actor/mu/mpc/mu_mpc_internal.h
   src/use_case/actor/mu/mpc/mu_mpc_monitor.h
@@ -380,6 +397,7 @@ else()
   list(APPEND SOURCES
     src/common/eebus_mutex/eebus_mutex.c
     src/common/eebus_queue/eebus_queue.c
+    src/common/eebus_queue/eebus_queue_mpsc.c
     src/common/eebus_thread/eebus_thread.c
     src/ship/mdns/ship_mdns_bonjour.c
     src/ship/tls_certificate/tls_certificate.c
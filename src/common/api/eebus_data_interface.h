@@ -58,6 +58,8 @@ struct EebusDataInterface {
   void* (*create_empty)(const EebusDataCfg* cfg, void* base_addr);
   void* (*parse)(const EebusDataCfg* cfg, const char* s);
   char* (*print_unformatted)(const EebusDataCfg* cfg, const void* base_addr);
+  void* (*parse_cbor)(const EebusDataCfg* cfg, const uint8_t* buf, size_t buf_size);
+  uint8_t* (*print_cbor)(const EebusDataCfg* cfg, const void* base_addr, size_t* size);
   EebusError (*from_json_object_item)(const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_item);
   EebusError (*from_json_object)(const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_obj, bool is_root);
   EebusError (*to_json_object_item)(const EebusDataCfg* cfg, const void* base_addr, JsonObject** json_item);
@@ -152,6 +154,17 @@ struct EebusDataCfg {
  */
 #define EEBUS_DATA_PRINT_UNFORMATTED(cfg, base_addr) (EEBUS_DATA_INTERFACE(cfg)->print_unformatted(cfg, base_addr))
 
+/**
+ * @brief EEBUS Data Parse CBOR caller definition
+ */
+#define EEBUS_DATA_PARSE_CBOR(cfg, buf, buf_size) (EEBUS_DATA_INTERFACE(cfg)->parse_cbor(cfg, buf, buf_size))
+
+/**
+ * @brief EEBUS Data Print CBOR caller definition.
+ * The returned buffer is to be deallocated with JsonFree()
+ */
+#define EEBUS_DATA_PRINT_CBOR(cfg, base_addr, size) (EEBUS_DATA_INTERFACE(cfg)->print_cbor(cfg, base_addr, size))
+
 /**
  * @brief EEBUS Data From Json Object Item caller definition
  */
@@ -22,6 +22,7 @@
 #define SRC_COMMON_API_EEBUS_QUEUE_INTERFACE_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "src/common/eebus_errors.h"
@@ -50,6 +51,7 @@ struct EebusQueueInterface {
   void (*destruct)(EebusQueueObject* self);
   EebusError (*send)(EebusQueueObject* self, const void* msg, uint32_t timeout_ms);
   EebusError (*receive)(EebusQueueObject* self, void* msg, uint32_t timeout_ms);
+  EebusError (*receive_many)(EebusQueueObject* self, void* msgs, size_t max_num, size_t* num, uint32_t timeout_ms);
   bool (*is_empty)(const EebusQueueObject* self);
   bool (*is_full)(const EebusQueueObject* self);
   void (*clear)(EebusQueueObject* self);
@@ -87,6 +89,14 @@ struct EebusQueueObject {
  */
 #define EEBUS_QUEUE_RECEIVE(obj, msg, timeout_ms) (EEBUS_QUEUE_INTERFACE(obj)->receive(obj, msg, timeout_ms))
 
+/**
+ * @brief Eebus Queue Receive Many caller definition.
+ * Waits up to timeout_ms for the first message and then moves the messages already queued,
+ * up to max_num in total, to the msgs array. The number of messages received is returned in num
+ */
+#define EEBUS_QUEUE_RECEIVE_MANY(obj, msgs, max_num, num, timeout_ms) \
+  (EEBUS_QUEUE_INTERFACE(obj)->receive_many(obj, msgs, max_num, num, timeout_ms))
+
 /**
  * @brief Eebus Queue Is Empty caller definition
  */
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Minimal CBOR (RFC 8949) data item head encoding and decoding
+ *
+ * Only the definite length items are supported, this is enough to carry
+ * the Json data model in a compact binary form
+ */
+#ifndef SRC_COMMON_CBOR_H_
+#define SRC_COMMON_CBOR_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+#define CBOR_MAJOR_TYPE_UINT   0
+#define CBOR_MAJOR_TYPE_NEGINT 1
+#define CBOR_MAJOR_TYPE_BYTES  2
+#define CBOR_MAJOR_TYPE_TEXT   3
+#define CBOR_MAJOR_TYPE_ARRAY  4
+#define CBOR_MAJOR_TYPE_MAP    5
+#define CBOR_MAJOR_TYPE_TAG    6
+#define CBOR_MAJOR_TYPE_SIMPLE 7
+
+#define CBOR_SIMPLE_FALSE   20
+#define CBOR_SIMPLE_TRUE    21
+#define CBOR_SIMPLE_NULL    22
+#define CBOR_SIMPLE_FLOAT32 26
+#define CBOR_SIMPLE_FLOAT64 27
+
+/** Maximum size of the data item head: initial byte followed by 8 bytes argument */
+#define CBOR_HEAD_MAX_SIZE 9
+
+/**
+ * @brief Encode the data item head using the shortest argument form
+ * @param buf Buffer of at least CBOR_HEAD_MAX_SIZE bytes, NULL to get the head size only
+ * @param major_type Major type of the data item
+ * @param value Head argument: value, length or number of items depending on @p major_type
+ * @return Number of bytes the head takes
+ */
+static inline size_t CborEncodeHead(uint8_t* buf, uint8_t major_type, uint64_t value) {
+  const uint8_t initial_byte = (uint8_t)(major_type << 5);
+
+  size_t arg_size = 0;
+  if (value < 24) {
+    if (buf != NULL) {
+      buf[0] = initial_byte | (uint8_t)value;
+    }
+
+    return 1;
+  } else if (value <= UINT8_MAX) {
+    arg_size = 1;
+  } else if (value <= UINT16_MAX) {
+    arg_size = 2;
+  } else if (value <= UINT32_MAX) {
+    arg_size = 4;
+  } else {
+    arg_size = 8;
+  }
+
+  if (buf != NULL) {
+    // Additional information 24..27 stands for 1, 2, 4 and 8 bytes argument
+    const uint8_t additional_info = (arg_size == 1) ? 24 : (arg_size == 2) ? 25 : (arg_size == 4) ? 26 : 27;
+
+    buf[0] = initial_byte | additional_info;
+    for (size_t i = 0; i < arg_size; ++i) {
+      buf[1 + i] = (uint8_t)(value >> (8 * (arg_size - 1 - i)));
+    }
+  }
+
+  return 1 + arg_size;
+}
+
+/**
+ * @brief Decode the data item head
+ * @param buf Buffer to decode the head from
+ * @param buf_size Number of bytes available in @p buf
+ * @param major_type Decoded major type
+ * @param additional_info Decoded additional information (distinguishes the float widths of simple values)
+ * @param value Decoded head argument
+ * @return Number of bytes the head takes, 0 if the head is truncated or
+ * has an indefinite length which is not supported
+ */
+static inline size_t CborDecodeHead(
+    const uint8_t* buf,
+    size_t buf_size,
+    uint8_t* major_type,
+    uint8_t* additional_info,
+    uint64_t* value
+) {
+  if ((buf == NULL) || (buf_size == 0)) {
+    return 0;
+  }
+
+  *major_type      = buf[0] >> 5;
+  *additional_info = buf[0] & 0x1F;
+
+  size_t arg_size = 0;
+  if (*additional_info < 24) {
+    *value = *additional_info;
+    return 1;
+  } else if (*additional_info == 24) {
+    arg_size = 1;
+  } else if (*additional_info == 25) {
+    arg_size = 2;
+  } else if (*additional_info == 26) {
+    arg_size = 4;
+  } else if (*additional_info == 27) {
+    arg_size = 8;
+  } else {
+    return 0;
+  }
+
+  if (buf_size < 1 + arg_size) {
+    return 0;
+  }
+
+  *value = 0;
+  for (size_t i = 0; i < arg_size; ++i) {
+    *value = (*value << 8) | buf[1 + i];
+  }
+
+  return 1 + arg_size;
+}
+
+/**
+ * @brief Check whether the buffer starts with a CBOR map.
+ * Used to tell a CBOR encoded object from a Json text which always starts with '{'
+ */
+static inline bool CborIsMap(const uint8_t* buf, size_t buf_size) {
+  return (buf != NULL) && (buf_size > 0) && ((buf[0] >> 5) == CBOR_MAJOR_TYPE_MAP);
+}
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_COMMON_CBOR_H_
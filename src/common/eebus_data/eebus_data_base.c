@@ -27,6 +27,9 @@
 #include "src/common/eebus_errors.h"
 #include "src/common/eebus_malloc.h"
 
+static void* EebusDataBaseFromJsonRoot(const EebusDataCfg* cfg, JsonObject* json_root);
+static JsonObject* EebusDataBaseToJsonRoot(const EebusDataCfg* cfg, const void* base_addr);
+
 void* EebusDataBaseCreateEmpty(const EebusDataCfg* cfg, void* base_addr) {
   if (base_addr == NULL) {
     EEBUS_ASSERT_ALWAYS();
@@ -46,8 +49,7 @@ void* EebusDataBaseCreateEmpty(const EebusDataCfg* cfg, void* base_addr) {
   return *buf;
 }
 
-void* EebusDataBaseParse(const EebusDataCfg* cfg, const char* s) {
-  const JsonObject* const json_root = JsonParse(s);
+void* EebusDataBaseFromJsonRoot(const EebusDataCfg* cfg, JsonObject* json_root) {
   if (json_root == NULL) {
     return NULL;
   }
@@ -55,7 +57,7 @@ void* EebusDataBaseParse(const EebusDataCfg* cfg, const char* s) {
   void* buf = NULL;
 
   const EebusError ret = EEBUS_DATA_FROM_JSON_OBJECT(cfg, &buf, json_root, true);
-  JsonDelete((JsonObject*)json_root);
+  JsonDelete(json_root);
   if (ret != kEebusErrorOk) {
     EEBUS_DATA_DELETE(cfg, &buf);
     return NULL;
@@ -64,21 +66,50 @@ void* EebusDataBaseParse(const EebusDataCfg* cfg, const char* s) {
   return buf;
 }
 
-char* EebusDataBasePrintUnformatted(const EebusDataCfg* cfg, const void* base_addr) {
+JsonObject* EebusDataBaseToJsonRoot(const EebusDataCfg* cfg, const void* base_addr) {
   JsonObject* const json_root = JsonCreateObject();
   if (json_root == NULL) {
     return NULL;
   }
 
-  char* s = NULL;
-  if (EEBUS_DATA_TO_JSON_OBJECT(cfg, base_addr, json_root, true) == kEebusErrorOk) {
-    s = JsonPrintUnformatted(json_root);
+  if (EEBUS_DATA_TO_JSON_OBJECT(cfg, base_addr, json_root, true) != kEebusErrorOk) {
+    JsonDelete(json_root);
+    return NULL;
   }
 
+  return json_root;
+}
+
+void* EebusDataBaseParse(const EebusDataCfg* cfg, const char* s) {
+  return EebusDataBaseFromJsonRoot(cfg, JsonParse(s));
+}
+
+char* EebusDataBasePrintUnformatted(const EebusDataCfg* cfg, const void* base_addr) {
+  JsonObject* const json_root = EebusDataBaseToJsonRoot(cfg, base_addr);
+  if (json_root == NULL) {
+    return NULL;
+  }
+
+  char* const s = JsonPrintUnformatted(json_root);
   JsonDelete(json_root);
   return s;
 }
 
+void* EebusDataBaseParseCbor(const EebusDataCfg* cfg, const uint8_t* buf, size_t buf_size) {
+  return EebusDataBaseFromJsonRoot(cfg, JsonParseCbor(buf, buf_size));
+}
+
+uint8_t* EebusDataBasePrintCbor(const EebusDataCfg* cfg, const void* base_addr, size_t* size) {
+  JsonObject* const json_root = EebusDataBaseToJsonRoot(cfg, base_addr);
+  if (json_root == NULL) {
+    return NULL;
+  }
+
+  uint8_t* const buf = JsonPrintCbor(json_root, size);
+  JsonDelete(json_root);
+  return buf;
+}
+
 EebusError EebusDataBaseFromJsonObject(
     const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_obj, bool is_root) {
   const JsonObject* const json_item = JsonGetItem(json_obj, cfg->name, is_root);
@@ -23,6 +23,8 @@
 #define SRC_COMMON_EEBUS_DATA_EEBUS_DATA_BASE_H_
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "src/common/api/eebus_data_interface.h"
 #include "src/common/eebus_errors.h"
@@ -37,6 +39,10 @@ void* EebusDataBaseParse(const EebusDataCfg* cfg, const char* s);
 
 char* EebusDataBasePrintUnformatted(const EebusDataCfg* cfg, const void* base_addr);
 
+void* EebusDataBaseParseCbor(const EebusDataCfg* cfg, const uint8_t* buf, size_t buf_size);
+
+uint8_t* EebusDataBasePrintCbor(const EebusDataCfg* cfg, const void* base_addr, size_t* size);
+
 EebusError EebusDataBaseFromJsonObject(
     const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_obj, bool is_root);
 
@@ -34,6 +34,8 @@ const EebusDataInterface eebus_data_bool_methods = {
     .create_empty          = EebusDataBaseCreateEmpty,
     .parse                 = EebusDataBaseParse,
     .print_unformatted     = EebusDataBasePrintUnformatted,
+    .parse_cbor            = EebusDataBaseParseCbor,
+    .print_cbor            = EebusDataBasePrintCbor,
     .from_json_object_item = FromJsonObjectItem,
     .from_json_object      = EebusDataBaseFromJsonObject,
     .to_json_object_item   = ToJsonObjectItem,
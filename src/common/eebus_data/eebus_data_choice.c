@@ -50,6 +50,8 @@ const EebusDataInterface eebus_data_choice_methods = {
     .create_empty          = CreateEmpty,
     .parse                 = EebusDataBaseParse,
     .print_unformatted     = EebusDataBasePrintUnformatted,
+    .parse_cbor            = EebusDataBaseParseCbor,
+    .print_cbor            = EebusDataBasePrintCbor,
     .from_json_object_item = FromJsonObjectItem,
     .from_json_object      = FromJsonObject,
     .to_json_object_item   = ToJsonObjectItem,
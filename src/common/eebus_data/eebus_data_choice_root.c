@@ -29,6 +29,8 @@
 
 static void* Parse(const EebusDataCfg* cfg, const char* s);
 static char* PrintUnformatted(const EebusDataCfg* cfg, const void* base_addr);
+static void* ParseCbor(const EebusDataCfg* cfg, const uint8_t* buf, size_t buf_size);
+static uint8_t* PrintCbor(const EebusDataCfg* cfg, const void* base_addr, size_t* size);
 static EebusError FromJsonObjectItem(const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_obj);
 static EebusError FromJsonObject(const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_obj, bool is_root);
 static EebusError ToJsonObjectItem(const EebusDataCfg* cfg, const void* base_addr, JsonObject** json_obj);
@@ -52,11 +54,15 @@ static void DeletePartial(const EebusDataCfg* cfg, void* base_addr, const EebusD
     const void* selectors_base_addr, SelectorsMatcher selectors_matcher, const EebusDataCfg* elements_cfg,
     const void* elements_base_addr);
 static void Delete(const EebusDataCfg* cfg, void* base_addr);
+static void* FromJsonRoot(const EebusDataCfg* cfg, JsonObject* json_root);
+static JsonObject* ToJsonRoot(const EebusDataCfg* cfg, const void* base_addr);
 
 const EebusDataInterface eebus_data_choice_root_methods = {
     .create_empty          = EebusDataBaseCreateEmpty,
     .parse                 = Parse,
     .print_unformatted     = PrintUnformatted,
+    .parse_cbor            = ParseCbor,
+    .print_cbor            = PrintCbor,
     .from_json_object_item = FromJsonObjectItem,
     .from_json_object      = FromJsonObject,
     .to_json_object_item   = ToJsonObjectItem,
@@ -78,21 +84,21 @@ const EebusDataInterface eebus_data_choice_root_methods = {
     .delete_               = Delete,
 };
 
-void* Parse(const EebusDataCfg* cfg, const char* s) {
-  const JsonObject* const json_root = JsonParse(s);
+void* FromJsonRoot(const EebusDataCfg* cfg, JsonObject* json_root) {
   if (json_root == NULL) {
     return NULL;
   }
 
   void* const buf = EEBUS_DATA_CREATE_EMPTY(cfg, (void*)&buf);
   if (buf == NULL) {
+    JsonDelete(json_root);
     return NULL;
   }
 
   const EebusDataCfg* const choice_cfg = (const EebusDataCfg*)cfg->metadata;
 
   const EebusError ret = EEBUS_DATA_FROM_JSON_OBJECT(choice_cfg, buf, json_root, true);
-  JsonDelete((JsonObject*)json_root);
+  JsonDelete(json_root);
   if (ret != kEebusErrorOk) {
     EEBUS_DATA_DELETE(cfg, (void*)&buf);
     return NULL;
@@ -101,7 +107,7 @@ void* Parse(const EebusDataCfg* cfg, const char* s) {
   return buf;
 }
 
-char* PrintUnformatted(const EebusDataCfg* cfg, const void* base_addr) {
+JsonObject* ToJsonRoot(const EebusDataCfg* cfg, const void* base_addr) {
   if (base_addr == NULL) {
     return NULL;
   }
@@ -111,20 +117,46 @@ char* PrintUnformatted(const EebusDataCfg* cfg, const void* base_addr) {
     return NULL;
   }
 
-  char* s = NULL;
-
   const EebusDataCfg* const choice_cfg = (const EebusDataCfg*)cfg->metadata;
 
   void** const buf     = (void**)base_addr;
   const EebusError ret = EEBUS_DATA_TO_JSON_OBJECT(choice_cfg, *buf, json_root, true);
-  if (ret == kEebusErrorOk) {
-    s = JsonPrintUnformatted(json_root);
+  if (ret != kEebusErrorOk) {
+    JsonDelete(json_root);
+    return NULL;
   }
 
+  return json_root;
+}
+
+void* Parse(const EebusDataCfg* cfg, const char* s) { return FromJsonRoot(cfg, JsonParse(s)); }
+
+char* PrintUnformatted(const EebusDataCfg* cfg, const void* base_addr) {
+  JsonObject* const json_root = ToJsonRoot(cfg, base_addr);
+  if (json_root == NULL) {
+    return NULL;
+  }
+
+  char* const s = JsonPrintUnformatted(json_root);
   JsonDelete(json_root);
   return s;
 }
 
+void* ParseCbor(const EebusDataCfg* cfg, const uint8_t* buf, size_t buf_size) {
+  return FromJsonRoot(cfg, JsonParseCbor(buf, buf_size));
+}
+
+uint8_t* PrintCbor(const EebusDataCfg* cfg, const void* base_addr, size_t* size) {
+  JsonObject* const json_root = ToJsonRoot(cfg, base_addr);
+  if (json_root == NULL) {
+    return NULL;
+  }
+
+  uint8_t* const buf = JsonPrintCbor(json_root, size);
+  JsonDelete(json_root);
+  return buf;
+}
+
 EebusError FromJsonObjectItem(const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_obj) {
   EEBUS_ASSERT_ALWAYS();
   return kEebusErrorOther;
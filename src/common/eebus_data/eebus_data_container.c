@@ -21,50 +21,40 @@
 #include "src/common/api/eebus_data_interface.h"
 #include "src/common/eebus_assert.h"
 #include "src/common/eebus_data/eebus_data_base.h"
+#include "src/common/eebus_data/eebus_data_container.h"
 #include "src/common/eebus_data/eebus_data_list.h"
 #include "src/common/eebus_data/eebus_data_sequence.h"
 #include "src/common/eebus_data/eebus_data_util.h"
 
-static EebusError
-CopyMatching(const EebusDataCfg* cfg, const void* base_addr, void* dst_base_addr, const void* data_to_match_base_addr);
-
-static bool SelectorsMatch(
-    const EebusDataCfg* cfg, const void* base_addr, const EebusDataCfg* selectors_cfg, const void* selectors_base_addr);
-
-static EebusError WritePartial(const EebusDataCfg* cfg, void* base_addr, const void* src_base_addr,
-    const EebusDataCfg* selectors_cfg, const void* selectors_base_addr, SelectorsMatcher selectors_matcher);
-
-static void DeletePartial(const EebusDataCfg* cfg, void* base_addr, const EebusDataCfg* selectors_cfg,
-    const void* selectors_base_addr, SelectorsMatcher selectors_matcher, const EebusDataCfg* elements_cfg,
-    const void* elements_base_addr);
-
 const EebusDataInterface eebus_data_container_methods = {
     .create_empty          = EebusDataBaseCreateEmpty,
     .parse                 = EebusDataBaseParse,
     .print_unformatted     = EebusDataBasePrintUnformatted,
+    .parse_cbor            = EebusDataBaseParseCbor,
+    .print_cbor            = EebusDataBasePrintCbor,
     .from_json_object_item = EebusDataSequenceFromJsonObjectItem,
     .from_json_object      = EebusDataBaseFromJsonObject,
     .to_json_object_item   = EebusDataSequenceToJsonObjectItem,
     .to_json_object        = EebusDataBaseToJsonObject,
     .copy                  = EebusDataBaseCopy,
-    .copy_matching         = CopyMatching,
+    .copy_matching         = EebusDataContainerCopyMatching,
     .compare               = EebusDataSequenceCompare,
     .is_null               = EebusDataSequenceIsNull,
     .is_empty              = EebusDataSequenceIsEmpty,
     .has_identifiers       = EebusDataSequenceHasIdentifiers,
-    .selectors_match       = SelectorsMatch,
+    .selectors_match       = EebusDataContainerSelectorsMatch,
     .identifiers_match     = EebusDataSequenceIdentifiersMatch,
     .read_elements         = EebusDataSequenceReadElements,
     .write                 = EebusDataSequenceWrite,
     .write_elements        = EebusDataSequenceWriteElements,
-    .write_partial         = WritePartial,
+    .write_partial         = EebusDataContainerWritePartial,
     .delete_elements       = EebusDataSequenceDeleteElements,
-    .delete_partial        = DeletePartial,
+    .delete_partial        = EebusDataContainerDeletePartial,
     .delete_               = EebusDataSequenceDelete,
 };
 
-EebusError
-CopyMatching(const EebusDataCfg* cfg, const void* base_addr, void* dst_base_addr, const void* data_to_match_base_addr) {
+EebusError EebusDataContainerCopyMatching(
+    const EebusDataCfg* cfg, const void* base_addr, void* dst_base_addr, const void* data_to_match_base_addr) {
   const EebusDataCfg* const list_cfg = (const EebusDataCfg*)cfg->metadata;
   if (!EEBUS_DATA_IS_LIST(list_cfg)) {
     EEBUS_ASSERT_ALWAYS();
@@ -88,13 +78,13 @@ CopyMatching(const EebusDataCfg* cfg, const void* base_addr, void* dst_base_addr
   return EEBUS_DATA_COPY_MATCHING(list_cfg, *buf, *dst_buf, data_to_match_base_addr);
 }
 
-bool SelectorsMatch(const EebusDataCfg* cfg, const void* base_addr, const EebusDataCfg* selectors_cfg,
-    const void* selectors_base_addr) {
+bool EebusDataContainerSelectorsMatch(const EebusDataCfg* cfg, const void* base_addr,
+    const EebusDataCfg* selectors_cfg, const void* selectors_base_addr) {
   EEBUS_ASSERT_ALWAYS();
   return false;
 }
 
-EebusError WritePartial(const EebusDataCfg* cfg, void* base_addr, const void* src_base_addr,
+EebusError EebusDataContainerWritePartial(const EebusDataCfg* cfg, void* base_addr, const void* src_base_addr,
     const EebusDataCfg* selectors_cfg, const void* selectors_base_addr, SelectorsMatcher selectors_matcher) {
   const EebusDataCfg* const list_cfg = (const EebusDataCfg*)cfg->metadata;
   if (!EEBUS_DATA_IS_LIST(list_cfg)) {
@@ -119,7 +109,7 @@ EebusError WritePartial(const EebusDataCfg* cfg, void* base_addr, const void* sr
   return EEBUS_DATA_WRITE_PARTIAL(list_cfg, *buf, *src_buf, selectors_cfg, selectors_base_addr, selectors_matcher);
 }
 
-void DeletePartial(const EebusDataCfg* cfg, void* base_addr, const EebusDataCfg* selectors_cfg,
+void EebusDataContainerDeletePartial(const EebusDataCfg* cfg, void* base_addr, const EebusDataCfg* selectors_cfg,
     const void* selectors_base_addr, SelectorsMatcher selectors_matcher, const EebusDataCfg* elements_cfg,
     const void* elements_base_addr) {
   const EebusDataCfg* const list_cfg = (const EebusDataCfg*)cfg->metadata;
@@ -140,9 +130,9 @@ void DeletePartial(const EebusDataCfg* cfg, void* base_addr, const EebusDataCfg*
 
 void EbusDataContainerListMatchFirst(
     const EebusDataCfg* cfg,
-    void* base_addr,
+    const void* base_addr,
     EebusDataListMatchIterator* it,
-    void* data_to_match_base_addr
+    const void* data_to_match_base_addr
 ) {
   const EebusDataCfg* const list_cfg = (const EebusDataCfg*)cfg->metadata;
   if (!EEBUS_DATA_IS_LIST(list_cfg)) {
@@ -37,9 +37,10 @@ extern "C" {
 extern const EebusDataInterface eebus_data_container_methods;
 
 /**
- * @brief EEBUS Data Container type check
+ * @brief EEBUS Data Container type check. The interfaces overriding the container methods
+ * (e.g. generated SPINE codecs) are recognised by the partial write method they inherit
  */
-#define EEBUS_DATA_IS_CONTAINER(cfg) (EEBUS_DATA_INTERFACE(cfg) == &eebus_data_container_methods)
+#define EEBUS_DATA_IS_CONTAINER(cfg) (EEBUS_DATA_INTERFACE(cfg)->write_partial == EebusDataContainerWritePartial)
 
 /**
  * @brief EEBUS Data Container configuration. Comparing to EEBUS Data Sequence,
@@ -58,6 +59,21 @@ extern const EebusDataInterface eebus_data_container_methods;
       .metadata   = ce_cfg,                                              \
   }
 
+/**
+ * @defgroup EebusDataContainerMethods EEBUS Data Container implementation inherited by generated codecs
+ * @{
+ */
+EebusError EebusDataContainerCopyMatching(
+    const EebusDataCfg* cfg, const void* base_addr, void* dst_base_addr, const void* data_to_match_base_addr);
+bool EebusDataContainerSelectorsMatch(const EebusDataCfg* cfg, const void* base_addr,
+    const EebusDataCfg* selectors_cfg, const void* selectors_base_addr);
+EebusError EebusDataContainerWritePartial(const EebusDataCfg* cfg, void* base_addr, const void* src_base_addr,
+    const EebusDataCfg* selectors_cfg, const void* selectors_base_addr, SelectorsMatcher selectors_matcher);
+void EebusDataContainerDeletePartial(const EebusDataCfg* cfg, void* base_addr, const EebusDataCfg* selectors_cfg,
+    const void* selectors_base_addr, SelectorsMatcher selectors_matcher, const EebusDataCfg* elements_cfg,
+    const void* elements_base_addr);
+/** @} */
+
 void EbusDataContainerListMatchFirst(
     const EebusDataCfg* cfg,
     const void* base_addr,
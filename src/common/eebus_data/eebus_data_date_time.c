@@ -22,6 +22,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "src/common/api/eebus_data_interface.h"
 #include "src/common/eebus_data/eebus_data_simple.h"
@@ -31,33 +32,35 @@
 #include "src/common/eebus_date_time/eebus_time.h"
 #include "src/common/eebus_errors.h"
 #include "src/common/eebus_malloc.h"
-#include "src/common/string_util.h"
 #include "src/spine/model/common_data_types.h"
 
-#define DATE_TIME_PARSE(interface, s, buf, buf_size) ((interface)->parse(s, buf, buf_size))
-
-#define DATE_TIME_TO_STRING(interface, buf, buf_size) ((interface)->to_string(buf, buf_size))
-
-#define DATE_TIME_PARSE_DECL(name, type)                                     \
-  static EebusError Parse##type(const char* s, void* buf, size_t buf_size) { \
-    if (buf_size != sizeof(type)) {                                          \
-      return kEebusErrorInputArgument;                                       \
-    }                                                                        \
-                                                                             \
-    return type##Parse(s, (type*)buf);                                       \
-  }                                                                          \
-                                                                             \
-  static char* ToString##type(const void* buf, size_t buf_size) {            \
-    if (buf_size != sizeof(type)) {                                          \
-      return NULL;                                                           \
-    }                                                                        \
-                                                                             \
-    return type##ToString((const type*)buf);                                 \
-  }                                                                          \
-                                                                             \
-  const DateTimeParseInterface name = {                                      \
-      .parse     = Parse##type,                                              \
-      .to_string = ToString##type,                                           \
+#define DATE_TIME_PARSE(interface, s, len, buf, buf_size) ((interface)->parse(s, len, buf, buf_size))
+
+#define DATE_TIME_FORMAT(interface, buf, buf_size, s, s_size) ((interface)->format(buf, buf_size, s, s_size))
+
+// The duration has the longest string representation of all the date & time types
+#define DATE_TIME_STRING_SIZE EEBUS_DURATION_STRING_SIZE
+
+#define DATE_TIME_PARSE_DECL(name, type)                                                 \
+  static EebusError Parse##type(const char* s, size_t len, void* buf, size_t buf_size) { \
+    if (buf_size != sizeof(type)) {                                                      \
+      return kEebusErrorInputArgument;                                                   \
+    }                                                                                    \
+                                                                                         \
+    return type##ParseWithLength(s, len, (type*)buf);                                    \
+  }                                                                                      \
+                                                                                         \
+  static size_t Format##type(const void* buf, size_t buf_size, char* s, size_t s_size) { \
+    if (buf_size != sizeof(type)) {                                                      \
+      return 0;                                                                          \
+    }                                                                                    \
+                                                                                         \
+    return type##Format((const type*)buf, s, s_size);                                    \
+  }                                                                                      \
+                                                                                         \
+  const DateTimeParseInterface name = {                                                  \
+      .parse  = Parse##type,                                                             \
+      .format = Format##type,                                                            \
   };
 
 DATE_TIME_PARSE_DECL(duration_parser, EebusDuration);
@@ -65,16 +68,16 @@ DATE_TIME_PARSE_DECL(date_parser, EebusDate);
 DATE_TIME_PARSE_DECL(time_parser, EebusTime);
 DATE_TIME_PARSE_DECL(date_time_parser, EebusDateTime);
 
-static EebusError ParseAbsoluteOrRelativeTime(const char* s, void* buf, size_t buf_size) {
+static EebusError ParseAbsoluteOrRelativeTime(const char* s, size_t len, void* buf, size_t buf_size) {
   if (buf_size != sizeof(AbsoluteOrRelativeTimeType)) {
     return kEebusErrorInputArgument;
   }
 
   AbsoluteOrRelativeTimeType* const time_buf = (AbsoluteOrRelativeTimeType*)buf;
-  if (EebusDurationParse(s, &time_buf->duration) == kEebusErrorOk) {
+  if (EebusDurationParseWithLength(s, len, &time_buf->duration) == kEebusErrorOk) {
     time_buf->type = kAbsoluteOrRelativeTimeTypeDuration;
     return kEebusErrorOk;
-  } else if (EebusDateTimeParse(s, &time_buf->date_time) == kEebusErrorOk) {
+  } else if (EebusDateTimeParseWithLength(s, len, &time_buf->date_time) == kEebusErrorOk) {
     time_buf->type = kAbsoluteOrRelativeTimeTypeDateTime;
     return kEebusErrorOk;
   } else {
@@ -82,24 +85,24 @@ static EebusError ParseAbsoluteOrRelativeTime(const char* s, void* buf, size_t b
   }
 }
 
-static char* ToStringAbsoluteOrRelativeTime(const void* buf, size_t buf_size) {
+static size_t FormatAbsoluteOrRelativeTime(const void* buf, size_t buf_size, char* s, size_t s_size) {
   if (buf_size != sizeof(AbsoluteOrRelativeTimeType)) {
-    return NULL;
+    return 0;
   }
 
   const AbsoluteOrRelativeTimeType* const time_buf = (AbsoluteOrRelativeTimeType*)buf;
   if (time_buf->type == kAbsoluteOrRelativeTimeTypeDuration) {
-    return EebusDurationToString(&time_buf->duration);
+    return EebusDurationFormat(&time_buf->duration, s, s_size);
   } else if ((time_buf->type == kAbsoluteOrRelativeTimeTypeDateTime)) {
-    return EebusDateTimeToString(&time_buf->date_time);
+    return EebusDateTimeFormat(&time_buf->date_time, s, s_size);
   } else {
-    return NULL;  // Invalid type
+    return 0;  // Invalid type
   }
 }
 
 const DateTimeParseInterface absolute_or_relative_time_parser = {
-    .parse     = ParseAbsoluteOrRelativeTime,
-    .to_string = ToStringAbsoluteOrRelativeTime,
+    .parse  = ParseAbsoluteOrRelativeTime,
+    .format = FormatAbsoluteOrRelativeTime,
 };
 
 static EebusError FromJsonObjectItem(const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_item);
@@ -109,6 +112,8 @@ const EebusDataInterface eebus_data_absolute_or_relative_time_methods = {
     .create_empty          = EebusDataBaseCreateEmpty,
     .parse                 = EebusDataBaseParse,
     .print_unformatted     = EebusDataBasePrintUnformatted,
+    .parse_cbor            = EebusDataBaseParseCbor,
+    .print_cbor            = EebusDataBasePrintCbor,
     .from_json_object_item = FromJsonObjectItem,
     .from_json_object      = EebusDataBaseFromJsonObject,
     .to_json_object_item   = ToJsonObjectItem,
@@ -142,7 +147,7 @@ EebusError FromJsonObjectItem(const EebusDataCfg* cfg, void* base_addr, const Js
   const DateTimeParseInterface* const parser = (const DateTimeParseInterface*)cfg->metadata;
 
   const char* s = JsonGetString(json_obj);
-  if (DATE_TIME_PARSE(parser, s, buf, cfg->size) != kEebusErrorOk) {
+  if (DATE_TIME_PARSE(parser, s, strlen(s), buf, cfg->size) != kEebusErrorOk) {
     EEBUS_DATA_DELETE(cfg, base_addr);
     return kEebusErrorParse;
   }
@@ -159,9 +164,12 @@ EebusError ToJsonObjectItem(const EebusDataCfg* cfg, const void* base_addr, Json
 
   const DateTimeParseInterface* const parser = (const DateTimeParseInterface*)cfg->metadata;
 
-  const char* const s = DATE_TIME_TO_STRING(parser, *buf, cfg->size);
+  char s[DATE_TIME_STRING_SIZE];
+  if (DATE_TIME_FORMAT(parser, *buf, cfg->size, s, sizeof(s)) == 0) {
+    *json_obj = NULL;
+    return kEebusErrorInputArgument;
+  }
 
   *json_obj = JsonCreateString(s);
-  StringDelete((char*)s);
   return (*json_obj != NULL) ? kEebusErrorOk : kEebusErrorMemoryAllocate;
 }
@@ -37,8 +37,8 @@ typedef struct DateTimeParseInterface DateTimeParseInterface;
  * @brief Json Date Time Converter interface type definition
  */
 struct DateTimeParseInterface {
-  EebusError (*parse)(const char* s, void* buf, size_t buf_size);
-  char* (*to_string)(const void* buf, size_t buf_size);
+  EebusError (*parse)(const char* s, size_t len, void* buf, size_t buf_size);
+  size_t (*format)(const void* buf, size_t buf_size, char* s, size_t s_size);
 };
 
 /**
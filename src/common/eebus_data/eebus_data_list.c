@@ -25,6 +25,7 @@
 #include "src/common/eebus_assert.h"
 #include "src/common/eebus_data/eebus_data_base.h"
 #include "src/common/eebus_data/eebus_data_list.h"
+#include "src/common/eebus_data/eebus_data_sequence.h"
 #include "src/common/eebus_data/eebus_data_simple.h"
 #include "src/common/eebus_errors.h"
 #include "src/common/eebus_malloc.h"
@@ -71,11 +72,15 @@ static void DeletePartial(
     const void* elements_base_addr
 );
 static void Delete(const EebusDataCfg* cfg, void* base_addr);
+static bool ElementSelectorsMatch(const EebusDataCfg* ar_element_cfg, const void* element_base_addr,
+    const EebusDataCfg* selectors_cfg, const void* selectors_base_addr, const SelectorsMap* selectors_map);
 
 const EebusDataInterface eebus_data_list_methods = {
     .create_empty          = CreateEmpty,
     .parse                 = EebusDataBaseParse,
     .print_unformatted     = EebusDataBasePrintUnformatted,
+    .parse_cbor            = EebusDataBaseParseCbor,
+    .print_cbor            = EebusDataBasePrintCbor,
     .from_json_object_item = FromJsonObjectItem,
     .from_json_object      = EebusDataBaseFromJsonObject,
     .to_json_object_item   = ToJsonObjectItem,
@@ -204,12 +209,14 @@ CopyMatching(const EebusDataCfg* cfg, const void* base_addr, void* dst_base_addr
   }
 
   const EebusDataCfg* const ar_element_cfg = (EebusDataCfg*)cfg->metadata;
+  const SelectorsMap* const selectors_map  = EebusDataSequenceGetSelectorsMap(ar_element_cfg, ar_element_cfg);
 
   // 2. Get the number of elements
   size_t new_dst_size = 0;
   for (size_t i = 0; i < *ar_size; ++i) {
     // Data to match fields are processed same as selectors
-    if (EEBUS_DATA_SELECTORS_MATCH(ar_element_cfg, (void*)&(*ar)[i], ar_element_cfg, data_to_match_base_addr)) {
+    if (ElementSelectorsMatch(
+            ar_element_cfg, (void*)&(*ar)[i], ar_element_cfg, data_to_match_base_addr, selectors_map)) {
       ++new_dst_size;
     }
   }
@@ -228,7 +235,8 @@ CopyMatching(const EebusDataCfg* cfg, const void* base_addr, void* dst_base_addr
   // 4. Copy the matching list items
   EebusError ret = kEebusErrorOk;
   for (size_t i = 0; i < *ar_size; ++i) {
-    if (EEBUS_DATA_SELECTORS_MATCH(ar_element_cfg, (void*)&(*ar)[i], ar_element_cfg, data_to_match_base_addr)) {
+    if (ElementSelectorsMatch(
+            ar_element_cfg, (void*)&(*ar)[i], ar_element_cfg, data_to_match_base_addr, selectors_map)) {
       ret = EEBUS_DATA_WRITE(ar_element_cfg, &(*dst_ar)[*dst_ar_size], (void*)&(*ar)[i]);
       if (ret != kEebusErrorOk) {
         return ret;
@@ -344,6 +352,17 @@ EebusError Write(const EebusDataCfg* cfg, void* base_addr, const void* src_base_
   return kEebusErrorOk;
 }
 
+bool ElementSelectorsMatch(const EebusDataCfg* ar_element_cfg, const void* element_base_addr,
+    const EebusDataCfg* selectors_cfg, const void* selectors_base_addr, const SelectorsMap* selectors_map) {
+  // The selectors map is looked up once per list, not for each of the list items
+  if (EEBUS_DATA_IS_SEQUENCE(ar_element_cfg)) {
+    return EebusDataSequenceSelectorsMatchWithMap(
+        ar_element_cfg, element_base_addr, selectors_cfg, selectors_base_addr, selectors_map);
+  }
+
+  return EEBUS_DATA_SELECTORS_MATCH(ar_element_cfg, element_base_addr, selectors_cfg, selectors_base_addr);
+}
+
 EebusError CopyToSelectedData(
     const EebusDataCfg* cfg,
     void* base_addr,
@@ -362,9 +381,10 @@ EebusError CopyToSelectedData(
   const void*** const src_ar = (const void***)((const uint8_t*)src_base_addr + cfg->offset);
 
   const EebusDataCfg* const ar_element_cfg = (EebusDataCfg*)cfg->metadata;
+  const SelectorsMap* const selectors_map  = EebusDataSequenceGetSelectorsMap(ar_element_cfg, selectors_cfg);
   // Write the non-null elements from src[0] to the selected list items
   for (size_t i = 0; i < *ar_size; ++i) {
-    if (EEBUS_DATA_SELECTORS_MATCH(ar_element_cfg, (void*)&(*ar)[i], selectors_cfg, selectors_base_addr)) {
+    if (ElementSelectorsMatch(ar_element_cfg, (void*)&(*ar)[i], selectors_cfg, selectors_base_addr, selectors_map)) {
       const EebusError ret = EEBUS_DATA_WRITE_ELEMENTS(ar_element_cfg, (void*)&(*ar)[i], (void*)&(*src_ar)[0]);
       if (ret != kEebusErrorOk) {
         return ret;
@@ -501,11 +521,12 @@ void DeleteListItems(
   size_t* const ar_size = (size_t*)((uint8_t*)base_addr + cfg->size_offset);
 
   const EebusDataCfg* const ar_element_cfg = (EebusDataCfg*)cfg->metadata;
+  const SelectorsMap* const selectors_map  = EebusDataSequenceGetSelectorsMap(ar_element_cfg, selectors_cfg);
 
   // 1. Get the number of elements
   size_t new_size = *ar_size;
   for (size_t i = 0; i < *ar_size; ++i) {
-    if (EEBUS_DATA_SELECTORS_MATCH(ar_element_cfg, (void*)&(*ar)[i], selectors_cfg, selectors_base_addr)) {
+    if (ElementSelectorsMatch(ar_element_cfg, (void*)&(*ar)[i], selectors_cfg, selectors_base_addr, selectors_map)) {
       --new_size;
     }
   }
@@ -523,7 +544,7 @@ void DeleteListItems(
 
   // 3. Delete the selected elements and move the others to new buffer
   for (size_t i = 0, j = 0; i < *ar_size; ++i) {
-    if (EEBUS_DATA_SELECTORS_MATCH(ar_element_cfg, (void*)&(*ar)[i], selectors_cfg, selectors_base_addr)) {
+    if (ElementSelectorsMatch(ar_element_cfg, (void*)&(*ar)[i], selectors_cfg, selectors_base_addr, selectors_map)) {
       EEBUS_DATA_DELETE(ar_element_cfg, (void*)&(*ar)[i]);
     } else {
       new_ar[j++] = (*ar)[i];
@@ -551,9 +572,10 @@ void DeleteListItemsElements(
   size_t* const ar_size = (size_t*)((uint8_t*)base_addr + cfg->size_offset);
 
   const EebusDataCfg* const ar_element_cfg = (EebusDataCfg*)cfg->metadata;
+  const SelectorsMap* const selectors_map  = EebusDataSequenceGetSelectorsMap(ar_element_cfg, selectors_cfg);
   for (size_t i = 0; i < *ar_size; ++i) {
     if ((elements_base_addr == NULL)
-        || EEBUS_DATA_SELECTORS_MATCH(ar_element_cfg, (void*)&(*ar)[i], selectors_cfg, selectors_base_addr)) {
+        || ElementSelectorsMatch(ar_element_cfg, (void*)&(*ar)[i], selectors_cfg, selectors_base_addr, selectors_map)) {
       EEBUS_DATA_DELETE_ELEMENTS(ar_element_cfg, (void*)&(*ar)[i], elements_cfg, elements_base_addr);
     }
   }
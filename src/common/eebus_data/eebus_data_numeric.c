@@ -32,34 +32,41 @@
 
 #define CONVERT_NUM_TO_JSON(interface, buf, buf_size) ((interface)->num_to_json(buf, buf_size))
 
-#define JSON_NUM_CONV_DECL(name, type)                                                 \
-  EebusError JsonToNum##type(const JsonObject* json_obj, void* buf, size_t buf_size) { \
-    if (buf_size != sizeof(type)) {                                                    \
-      return kEebusErrorInputArgument;                                                 \
-    }                                                                                  \
-                                                                                       \
-    *(type*)buf = (type)JsonGetNumber(json_obj);                                       \
-    return kEebusErrorOk;                                                              \
-  }                                                                                    \
-                                                                                       \
-  JsonObject* NumToJson##type(const void* buf, size_t buf_size) {                      \
-    return (buf_size == sizeof(type)) ? JsonCreateNumber((double)*(type*)buf) : NULL;  \
-  }                                                                                    \
-                                                                                       \
-  const JsonNumConvInterface name = {                                                  \
-      .json_to_num = JsonToNum##type,                                                  \
-      .num_to_json = NumToJson##type,                                                  \
+// Integers are parsed and printed as exact decimal text via the 64-bit type of the same signedness,
+// the value out of the field type range fails to parse instead of being truncated
+#define JSON_NUM_CONV_DECL(name, type, wide_type, get_wide, create_wide)                  \
+  EebusError JsonToNum##type(const JsonObject* json_obj, void* buf, size_t buf_size) {    \
+    if (buf_size != sizeof(type)) {                                                       \
+      return kEebusErrorInputArgument;                                                    \
+    }                                                                                     \
+                                                                                          \
+    wide_type value = 0;                                                                  \
+    if (!get_wide(json_obj, &value) || ((wide_type)(type)value != value)) {               \
+      return kEebusErrorParse;                                                            \
+    }                                                                                     \
+                                                                                          \
+    *(type*)buf = (type)value;                                                            \
+    return kEebusErrorOk;                                                                 \
+  }                                                                                       \
+                                                                                          \
+  JsonObject* NumToJson##type(const void* buf, size_t buf_size) {                         \
+    return (buf_size == sizeof(type)) ? create_wide((wide_type)*(const type*)buf) : NULL; \
+  }                                                                                       \
+                                                                                          \
+  const JsonNumConvInterface name = {                                                     \
+      .json_to_num = JsonToNum##type,                                                     \
+      .num_to_json = NumToJson##type,                                                     \
   };
 
-JSON_NUM_CONV_DECL(json_num_conv_uint8, uint8_t);
-JSON_NUM_CONV_DECL(json_num_conv_uint16, uint16_t);
-JSON_NUM_CONV_DECL(json_num_conv_uint32, uint32_t);
-JSON_NUM_CONV_DECL(json_num_conv_uint64, uint64_t);
+JSON_NUM_CONV_DECL(json_num_conv_uint8, uint8_t, uint64_t, JsonGetUint64, JsonCreateUint64);
+JSON_NUM_CONV_DECL(json_num_conv_uint16, uint16_t, uint64_t, JsonGetUint64, JsonCreateUint64);
+JSON_NUM_CONV_DECL(json_num_conv_uint32, uint32_t, uint64_t, JsonGetUint64, JsonCreateUint64);
+JSON_NUM_CONV_DECL(json_num_conv_uint64, uint64_t, uint64_t, JsonGetUint64, JsonCreateUint64);
 
-JSON_NUM_CONV_DECL(json_num_conv_int8, int8_t);
-JSON_NUM_CONV_DECL(json_num_conv_int16, int16_t);
-JSON_NUM_CONV_DECL(json_num_conv_int32, int32_t);
-JSON_NUM_CONV_DECL(json_num_conv_int64, int64_t);
+JSON_NUM_CONV_DECL(json_num_conv_int8, int8_t, int64_t, JsonGetInt64, JsonCreateInt64);
+JSON_NUM_CONV_DECL(json_num_conv_int16, int16_t, int64_t, JsonGetInt64, JsonCreateInt64);
+JSON_NUM_CONV_DECL(json_num_conv_int32, int32_t, int64_t, JsonGetInt64, JsonCreateInt64);
+JSON_NUM_CONV_DECL(json_num_conv_int64, int64_t, int64_t, JsonGetInt64, JsonCreateInt64);
 
 static EebusError FromJsonObjectItem(const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_item);
 static EebusError ToJsonObjectItem(const EebusDataCfg* cfg, const void* base_addr, JsonObject** json_item);
@@ -68,6 +75,8 @@ const EebusDataInterface eebus_data_numeric_methods = {
     .create_empty          = EebusDataBaseCreateEmpty,
     .parse                 = EebusDataBaseParse,
     .print_unformatted     = EebusDataBasePrintUnformatted,
+    .parse_cbor            = EebusDataBaseParseCbor,
+    .print_cbor            = EebusDataBasePrintCbor,
     .from_json_object_item = FromJsonObjectItem,
     .from_json_object      = EebusDataBaseFromJsonObject,
     .to_json_object_item   = ToJsonObjectItem,
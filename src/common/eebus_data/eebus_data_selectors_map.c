@@ -0,0 +1,190 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief EEBUS Data Sequence selectors to data fields maps cache implementation
+ *
+ * The name lookup of the selectors fields is done once per (data, selectors) configuration
+ * pair, the resulting field index table is kept in an open addressing cache keyed by the two
+ * configuration pointers. The cache is filled lock-free: a slot is reserved with an atomic
+ * state change, and the lookup falls back to the names while a map is being built.
+ */
+
+#include "src/common/eebus_data/eebus_data_selectors_map.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "src/common/eebus_malloc.h"
+
+typedef enum SelectorsMapState {
+  kSelectorsMapStateEmpty,
+  kSelectorsMapStateBuilding,
+  kSelectorsMapStateReady,
+} SelectorsMapState;
+
+struct SelectorsMap {
+  atomic_uint state;
+  /** Data sequence items configuration (the key) */
+  const EebusDataCfg* data_cfg_first;
+  /** Selectors sequence items configuration (the key) */
+  const EebusDataCfg* selectors_cfg_first;
+  /** False if the selectors have more fields than the map is able to keep */
+  bool is_complete;
+  /** Data field index for each of the selectors fields */
+  uint8_t data_idx[SELECTORS_MAP_FIELDS_MAX];
+};
+
+struct SelectorsMapCache {
+  SelectorsMap* maps;
+  size_t capacity;
+};
+
+static SelectorsMap default_maps[SELECTORS_MAP_CACHE_SIZE];
+
+static SelectorsMapCache default_cache = {
+    .maps     = default_maps,
+    .capacity = SELECTORS_MAP_CACHE_SIZE,
+};
+
+static void SelectorsMapBuild(SelectorsMap* map);
+static SelectorsMap* SelectorsMapCacheFind(SelectorsMapCache* self, const EebusDataCfg* data_cfg_first,
+    const EebusDataCfg* selectors_cfg_first, bool* is_reserved);
+
+SelectorsMapCache* SelectorsMapCacheGetDefault(void) { return &default_cache; }
+
+SelectorsMapCache* SelectorsMapCacheCreate(size_t capacity) {
+  if ((capacity == 0) || ((capacity & (capacity - 1)) != 0)) {
+    return NULL;
+  }
+
+  SelectorsMapCache* const cache = (SelectorsMapCache*)EEBUS_MALLOC(sizeof(SelectorsMapCache));
+  if (cache == NULL) {
+    return NULL;
+  }
+
+  cache->maps = (SelectorsMap*)EEBUS_MALLOC(capacity * sizeof(SelectorsMap));
+  if (cache->maps == NULL) {
+    EEBUS_FREE(cache);
+    return NULL;
+  }
+
+  cache->capacity = capacity;
+  for (size_t i = 0; i < capacity; ++i) {
+    atomic_init(&cache->maps[i].state, kSelectorsMapStateEmpty);
+  }
+
+  return cache;
+}
+
+void SelectorsMapCacheDelete(SelectorsMapCache* self) {
+  if ((self == NULL) || (self == &default_cache)) {
+    return;
+  }
+
+  EEBUS_FREE(self->maps);
+  EEBUS_FREE(self);
+}
+
+void SelectorsMapBuild(SelectorsMap* map) {
+  const EebusDataCfg* const data_cfg_first = map->data_cfg_first;
+
+  map->is_complete = true;
+
+  size_t i = 0;
+  for (const EebusDataCfg* selectors_cfg_it = map->selectors_cfg_first; selectors_cfg_it->name != NULL;
+       ++selectors_cfg_it) {
+    if (i >= SELECTORS_MAP_FIELDS_MAX) {
+      map->is_complete = false;
+      return;
+    }
+
+    map->data_idx[i] = SELECTORS_MAP_NO_FIELD;
+    for (size_t j = 0; (j < SELECTORS_MAP_NO_FIELD) && (data_cfg_first[j].name != NULL); ++j) {
+      if (!strcmp(data_cfg_first[j].name, selectors_cfg_it->name)) {
+        map->data_idx[i] = (uint8_t)j;
+        break;
+      }
+    }
+
+    ++i;
+  }
+}
+
+SelectorsMap* SelectorsMapCacheFind(SelectorsMapCache* self, const EebusDataCfg* data_cfg_first,
+    const EebusDataCfg* selectors_cfg_first, bool* is_reserved) {
+  const size_t hash = (size_t)(((uintptr_t)data_cfg_first >> 4) * 31 + ((uintptr_t)selectors_cfg_first >> 4));
+
+  *is_reserved = false;
+  for (size_t i = 0; i < self->capacity; ++i) {
+    SelectorsMap* const map = &self->maps[(hash + i) & (self->capacity - 1)];
+
+    unsigned int state = atomic_load_explicit(&map->state, memory_order_acquire);
+    if (state == kSelectorsMapStateEmpty) {
+      if (atomic_compare_exchange_strong(&map->state, &state, kSelectorsMapStateBuilding)) {
+        // The key is read by the others only once the map is ready
+        map->data_cfg_first      = data_cfg_first;
+        map->selectors_cfg_first = selectors_cfg_first;
+
+        *is_reserved = true;
+        return map;
+      }
+
+      // Another thread has just taken the slot, state holds the updated value
+    }
+
+    if (state != kSelectorsMapStateReady) {
+      // The key is not published yet, match by names this time
+      return NULL;
+    }
+
+    if ((map->data_cfg_first == data_cfg_first) && (map->selectors_cfg_first == selectors_cfg_first)) {
+      return map;
+    }
+  }
+
+  return NULL;
+}
+
+const SelectorsMap* SelectorsMapCacheGet(
+    SelectorsMapCache* self, const EebusDataCfg* data_cfg_first, const EebusDataCfg* selectors_cfg_first) {
+  bool is_reserved        = false;
+  SelectorsMap* const map = SelectorsMapCacheFind(self, data_cfg_first, selectors_cfg_first, &is_reserved);
+  if (is_reserved) {
+    SelectorsMapCachePublish(map);
+  }
+
+  // The incomplete map stays in the cache, so that it is not rebuilt on each lookup
+  return ((map != NULL) && map->is_complete) ? map : NULL;
+}
+
+SelectorsMap* SelectorsMapCacheReserve(
+    SelectorsMapCache* self, const EebusDataCfg* data_cfg_first, const EebusDataCfg* selectors_cfg_first) {
+  bool is_reserved        = false;
+  SelectorsMap* const map = SelectorsMapCacheFind(self, data_cfg_first, selectors_cfg_first, &is_reserved);
+  return is_reserved ? map : NULL;
+}
+
+void SelectorsMapCachePublish(SelectorsMap* map) {
+  SelectorsMapBuild(map);
+  atomic_store_explicit(&map->state, kSelectorsMapStateReady, memory_order_release);
+}
+
+uint8_t SelectorsMapGetDataIdx(const SelectorsMap* self, size_t selector_idx) {
+  return (selector_idx < SELECTORS_MAP_FIELDS_MAX) ? self->data_idx[selector_idx] : SELECTORS_MAP_NO_FIELD;
+}
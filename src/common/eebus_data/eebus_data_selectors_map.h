@@ -0,0 +1,105 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief EEBUS Data Sequence selectors to data fields maps cache
+ */
+
+#ifndef SRC_COMMON_EEBUS_DATA_EEBUS_DATA_SELECTORS_MAP_H_
+#define SRC_COMMON_EEBUS_DATA_EEBUS_DATA_SELECTORS_MAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "src/common/api/eebus_data_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/** Maximum number of the selectors fields kept in the map, the wider selectors are matched by names */
+#define SELECTORS_MAP_FIELDS_MAX 16
+
+/** Default selectors maps cache capacity, a power of 2 well above the number of the selectors types */
+#define SELECTORS_MAP_CACHE_SIZE 128
+
+/** Field index of the selector having no data field of the same name */
+#define SELECTORS_MAP_NO_FIELD UINT8_MAX
+
+typedef struct SelectorsMap SelectorsMap;
+
+typedef struct SelectorsMapCache SelectorsMapCache;
+
+/**
+ * @brief Get the process wide selectors maps cache used by the EEBUS Data Sequence
+ * @return Default selectors maps cache
+ */
+SelectorsMapCache* SelectorsMapCacheGetDefault(void);
+
+/**
+ * @brief Create the selectors maps cache
+ * @param capacity Number of the maps to be kept, shall be a power of 2
+ * @return Selectors maps cache, NULL on failure
+ */
+SelectorsMapCache* SelectorsMapCacheCreate(size_t capacity);
+
+/**
+ * @brief Delete the selectors maps cache created with SelectorsMapCacheCreate()
+ * @param self Selectors maps cache
+ */
+void SelectorsMapCacheDelete(SelectorsMapCache* self);
+
+/**
+ * @brief Get the map of the (data, selectors) sequence items configuration pair, build it on first use
+ * @param self Selectors maps cache
+ * @param data_cfg_first Data sequence items configuration
+ * @param selectors_cfg_first Selectors sequence items configuration
+ * @return Selectors map, NULL if the selectors are to be matched by names: the selectors have
+ * more than SELECTORS_MAP_FIELDS_MAX fields, the cache is full or the map is being built by another thread
+ */
+const SelectorsMap* SelectorsMapCacheGet(
+    SelectorsMapCache* self, const EebusDataCfg* data_cfg_first, const EebusDataCfg* selectors_cfg_first);
+
+/**
+ * @brief Reserve the cache slot for the configuration pair without building the map yet.
+ * Until SelectorsMapCachePublish() is called, the lookups of the pair fall back to the names
+ * @param self Selectors maps cache
+ * @param data_cfg_first Data sequence items configuration
+ * @param selectors_cfg_first Selectors sequence items configuration
+ * @return Reserved map, NULL if the pair is in the cache already or the cache is full
+ */
+SelectorsMap* SelectorsMapCacheReserve(
+    SelectorsMapCache* self, const EebusDataCfg* data_cfg_first, const EebusDataCfg* selectors_cfg_first);
+
+/**
+ * @brief Build the reserved map and make it visible to the lookups
+ * @param map Map returned by SelectorsMapCacheReserve()
+ */
+void SelectorsMapCachePublish(SelectorsMap* map);
+
+/**
+ * @brief Get the data field index of the selectors field
+ * @param self Selectors map
+ * @param selector_idx Selectors field index
+ * @return Data field index, SELECTORS_MAP_NO_FIELD if there is no data field of the same name
+ */
+uint8_t SelectorsMapGetDataIdx(const SelectorsMap* self, size_t selector_idx);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_COMMON_EEBUS_DATA_EEBUS_DATA_SELECTORS_MAP_H_
@@ -16,15 +16,22 @@
 /**
  * @file
  * @brief EEEBUS Data Sequence implementation
+ *
+ * Selectors are matched against the data fields of the same name. The name lookup
+ * is done once per (data, selectors) configuration pair: the resulting field index
+ * table is kept in the selectors maps cache, so that filtering the list items is
+ * reduced to the field comparisons.
  */
 
 #include "src/common/eebus_data/eebus_data_sequence.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "src/common/api/eebus_data_interface.h"
 #include "src/common/eebus_data/eebus_data_base.h"
+#include "src/common/eebus_data/eebus_data_selectors_map.h"
 #include "src/common/eebus_data/eebus_data_util.h"
 #include "src/common/eebus_malloc.h"
 
@@ -35,6 +42,8 @@ const EebusDataInterface eebus_data_sequence_methods = {
     .create_empty          = EebusDataBaseCreateEmpty,
     .parse                 = EebusDataBaseParse,
     .print_unformatted     = EebusDataBasePrintUnformatted,
+    .parse_cbor            = EebusDataBaseParseCbor,
+    .print_cbor            = EebusDataBasePrintCbor,
     .from_json_object_item = EebusDataSequenceFromJsonObjectItem,
     .from_json_object      = EebusDataBaseFromJsonObject,
     .to_json_object_item   = EebusDataSequenceToJsonObjectItem,
@@ -189,6 +198,20 @@ const EebusDataCfg* GetItemWithName(const EebusDataCfg* cfg, const char* name) {
 
 bool SelectorsMatch(const EebusDataCfg* cfg, const void* base_addr, const EebusDataCfg* selectors_cfg,
     const void* selectors_base_addr) {
+  const SelectorsMap* const map = EebusDataSequenceGetSelectorsMap(cfg, selectors_cfg);
+  return EebusDataSequenceSelectorsMatchWithMap(cfg, base_addr, selectors_cfg, selectors_base_addr, map);
+}
+
+const SelectorsMap* EebusDataSequenceGetSelectorsMap(const EebusDataCfg* cfg, const EebusDataCfg* selectors_cfg) {
+  if (!EEBUS_DATA_IS_SEQUENCE(cfg) || !EEBUS_DATA_IS_SEQUENCE(selectors_cfg)) {
+    return NULL;
+  }
+
+  return SelectorsMapCacheGet(SelectorsMapCacheGetDefault(), cfg->metadata, selectors_cfg->metadata);
+}
+
+bool EebusDataSequenceSelectorsMatchWithMap(const EebusDataCfg* cfg, const void* base_addr,
+    const EebusDataCfg* selectors_cfg, const void* selectors_base_addr, const SelectorsMap* map) {
   if (!EEBUS_DATA_IS_SEQUENCE(selectors_cfg)) {
     return false;
   }
@@ -196,13 +219,23 @@ bool SelectorsMatch(const EebusDataCfg* cfg, const void* base_addr, const EebusD
   void** const buf       = (void**)((uint8_t*)base_addr + cfg->offset);
   void** const selectors = (void**)((uint8_t*)selectors_base_addr + selectors_cfg->offset);
 
-  const EebusDataCfg* selectors_cfg_it = (const EebusDataCfg*)selectors_cfg->metadata;
-  for (; selectors_cfg_it->name != NULL; ++selectors_cfg_it) {
+  const EebusDataCfg* const data_cfg_first      = (const EebusDataCfg*)cfg->metadata;
+  const EebusDataCfg* const selectors_cfg_first = (const EebusDataCfg*)selectors_cfg->metadata;
+
+  size_t i = 0;
+  for (const EebusDataCfg* selectors_cfg_it = selectors_cfg_first; selectors_cfg_it->name != NULL;
+       ++selectors_cfg_it, ++i) {
     if (EEBUS_DATA_IS_NULL(selectors_cfg_it, *selectors)) {
       continue;
     }
 
-    const EebusDataCfg* data_cfg_it = GetItemWithName(cfg, selectors_cfg_it->name);
+    const EebusDataCfg* data_cfg_it = NULL;
+    if (map == NULL) {
+      data_cfg_it = GetItemWithName(cfg, selectors_cfg_it->name);
+    } else if (SelectorsMapGetDataIdx(map, i) != SELECTORS_MAP_NO_FIELD) {
+      data_cfg_it = &data_cfg_first[SelectorsMapGetDataIdx(map, i)];
+    }
+
     if (data_cfg_it == NULL) {
       // TODO: Handle each specific selectors case
       continue;
@@ -22,6 +22,7 @@
 #define SRC_COMMON_EEBUS_DATA_EEBUS_DATA_SEQUENCE_H_
 
 #include "src/common/api/eebus_data_interface.h"
+#include "src/common/eebus_data/eebus_data_selectors_map.h"
 #include "src/common/struct_util.h"
 
 #ifdef __cplusplus
@@ -150,6 +151,26 @@ void EebusDataSequenceDeleteElements(
 void EebusDataSequenceDelete(const EebusDataCfg* cfg, void* base_addr);
 /** @} */
 
+/**
+ * @brief Get the selectors map once for matching a number of the sequences of the same configuration
+ * @param cfg Data sequence configuration
+ * @param selectors_cfg Selectors configuration
+ * @return Selectors map, NULL if the selectors are to be matched by names
+ */
+const SelectorsMap* EebusDataSequenceGetSelectorsMap(const EebusDataCfg* cfg, const EebusDataCfg* selectors_cfg);
+
+/**
+ * @brief Check whether the sequence matches the selectors using the map obtained beforehand
+ * @param cfg Data sequence configuration
+ * @param base_addr Data sequence base address
+ * @param selectors_cfg Selectors configuration
+ * @param selectors_base_addr Selectors base address
+ * @param map Map returned by EebusDataSequenceGetSelectorsMap() for the same configurations
+ * @return true if the sequence matches the selectors, false otherwise
+ */
+bool EebusDataSequenceSelectorsMatchWithMap(const EebusDataCfg* cfg, const void* base_addr,
+    const EebusDataCfg* selectors_cfg, const void* selectors_base_addr, const SelectorsMap* map);
+
 #ifdef __cplusplus
 }
 #endif  // __cplusplus
@@ -29,6 +29,8 @@
 static void* CreateEmpty(const EebusDataCfg* cfg, void* base_addr);
 static void* Parse(const EebusDataCfg* cfg, const char* s);
 static char* PrintUnformatted(const EebusDataCfg* cfg, const void* base_addr);
+static void* ParseCbor(const EebusDataCfg* cfg, const uint8_t* buf, size_t buf_size);
+static uint8_t* PrintCbor(const EebusDataCfg* cfg, const void* base_addr, size_t* size);
 static EebusError FromJsonObjectItem(const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_obj);
 static EebusError FromJsonObject(const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_obj, bool is_root);
 static EebusError ToJsonObjectItem(const EebusDataCfg* cfg, const void* base_addr, JsonObject** json_obj);
@@ -58,6 +60,8 @@ const EebusDataInterface eebus_data_stub_methods = {
     .create_empty          = CreateEmpty,
     .parse                 = Parse,
     .print_unformatted     = PrintUnformatted,
+    .parse_cbor            = ParseCbor,
+    .print_cbor            = PrintCbor,
     .from_json_object_item = FromJsonObjectItem,
     .from_json_object      = FromJsonObject,
     .to_json_object_item   = ToJsonObjectItem,
@@ -84,6 +88,10 @@ void* Parse(const EebusDataCfg* cfg, const char* s) { return NULL; }
 
 char* PrintUnformatted(const EebusDataCfg* cfg, const void* base_addr) { return NULL; }
 
+void* ParseCbor(const EebusDataCfg* cfg, const uint8_t* buf, size_t buf_size) { return NULL; }
+
+uint8_t* PrintCbor(const EebusDataCfg* cfg, const void* base_addr, size_t* size) { return NULL; }
+
 EebusError FromJsonObjectItem(const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_obj) {
   return kEebusErrorOk;
 }
@@ -26,6 +26,7 @@
 #include "src/common/eebus_malloc.h"
 
 #include "src/common/eebus_date_time/eebus_date.h"
+#include "src/common/eebus_date_time/eebus_date_time_digits.h"
 
 static const int days_per_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
 
@@ -104,6 +105,26 @@ EebusError EebusDateParse(const char* s, EebusDate* date) {
   return kEebusErrorOk;
 }
 
+EebusError EebusDateParseWithLength(const char* s, size_t len, EebusDate* date) {
+  if ((s == NULL) || (date == NULL)) {
+    return kEebusErrorInputArgumentNull;
+  }
+
+  // Fast path for the fixed width "YYYY-MM-DD"
+  if ((len == EEBUS_DATE_STRING_SIZE - 1) && (s[4] == '-') && (s[7] == '-')
+      && EebusDateTimeParseDigits(&s[0], 4, &date->year) && EebusDateTimeParseDigits(&s[5], 2, &date->month)
+      && EebusDateTimeParseDigits(&s[8], 2, &date->day)) {
+    return EebusDateIsValid(date) ? kEebusErrorOk : kEebusErrorParse;
+  }
+
+  char buf[EEBUS_DATE_TIME_PARSE_BUF_SIZE];
+  if (EebusDateTimeCopyToBuf(s, len, buf, sizeof(buf)) != kEebusErrorOk) {
+    return kEebusErrorParse;
+  }
+
+  return EebusDateParse(buf, date);
+}
+
 char* EebusDateToString(const EebusDate* self) {
   if ((self == NULL) || (!EebusDateIsValid(self))) {
     return NULL;
@@ -123,6 +144,20 @@ char* EebusDateToString(const EebusDate* self) {
   return buffer;
 }
 
+size_t EebusDateFormat(const EebusDate* self, char* buf, size_t buf_size) {
+  if ((buf == NULL) || (buf_size < EEBUS_DATE_STRING_SIZE) || (!EebusDateIsValid(self))) {
+    return 0;
+  }
+
+  char* p = EebusDateTimeFormatDigits(buf, self->year, 4);
+  *p++    = '-';
+  p       = EebusDateTimeFormatDigits(p, self->month, 2);
+  *p++    = '-';
+  p       = EebusDateTimeFormatDigits(p, self->day, 2);
+  *p      = '\0';
+  return (size_t)(p - buf);
+}
+
 int32_t EebusDateCompare(const EebusDate* self, const EebusDate* other) {
   if (self->year != other->year) {
     return self->year - other->year;
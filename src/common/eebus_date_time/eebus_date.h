@@ -22,6 +22,7 @@
 #define SRC_COMMON_DATE_EEBUS_DATE_TIME_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "src/common/eebus_errors.h"
@@ -30,6 +31,11 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Buffer size required to format a date, including the null terminator
+ */
+#define EEBUS_DATE_STRING_SIZE (sizeof("YYYY-MM-DD"))
+
 typedef struct EebusDate EebusDate;
 
 struct EebusDate {
@@ -63,6 +69,21 @@ bool EebusDateIsValid(const EebusDate* self);
  */
 EebusError EebusDateParse(const char* s, EebusDate* date);
 
+/**
+ * @brief Parses a ISO 8061 date string view without heap allocation.
+ *
+ * The fixed width "YYYY-MM-DD" form is parsed in a single pass, any other
+ * spelling accepted by EebusDateParse() is handed over to it.
+ *
+ * @param s The input ISO 8061 date string, not necessarily null terminated.
+ * @param len The input string length.
+ * @param date A pointer to an EebusDate structure where the parsed date will
+ *             be stored.
+ *
+ * @return kEebusErrorOk on success, error code otherwise.
+ */
+EebusError EebusDateParseWithLength(const char* s, size_t len, EebusDate* date);
+
 /**
  * @brief Converts an EebusDate object to ISO 8061 date string representation.
  *
@@ -73,6 +94,16 @@ EebusError EebusDateParse(const char* s, EebusDate* date);
  */
 char* EebusDateToString(const EebusDate* self);
 
+/**
+ * @brief Formats an EebusDate object as "YYYY-MM-DD" into the caller buffer.
+ *
+ * @param self Pointer to the EebusDate object to be formatted.
+ * @param buf Output buffer, null terminated on success.
+ * @param buf_size Output buffer size, at least EEBUS_DATE_STRING_SIZE.
+ * @return The string length written, 0 if the date is invalid or the buffer is too small.
+ */
+size_t EebusDateFormat(const EebusDate* self, char* buf, size_t buf_size);
+
 /**
  * @brief Compares two EebusDate objects.
  *
@@ -20,6 +20,7 @@
 
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 
 #include "src/common/array_util.h"
@@ -65,6 +66,29 @@ EebusError EebusDateTimeParse(const char* s, EebusDateTime* date_time) {
   return EebusTimeParse(t_pos + 1, &date_time->time);
 }
 
+EebusError EebusDateTimeParseWithLength(const char* s, size_t len, EebusDateTime* date_time) {
+  if ((s == NULL) || (date_time == NULL)) {
+    return kEebusErrorInputArgumentNull;
+  }
+
+  const char* const t_pos = (const char*)memchr(s, 'T', len);
+  if (t_pos == NULL) {
+    return kEebusErrorParse;  // Invalid format, missing 'T'
+  }
+
+  const size_t date_len = t_pos - s;
+  if (date_len >= DATE_BUF_SIZE) {
+    return kEebusErrorParse;  // Invalid date format
+  }
+
+  const EebusError date_parse_err = EebusDateParseWithLength(s, date_len, &date_time->date);
+  if (date_parse_err != kEebusErrorOk) {
+    return date_parse_err;
+  }
+
+  return EebusTimeParseWithLength(t_pos + 1, len - date_len - 1, &date_time->time);
+}
+
 char* EebusDateTimeToString(const EebusDateTime* self) {
   if ((self == NULL) || (!EebusDateTimeIsValid(self))) {
     return NULL;
@@ -94,6 +118,22 @@ char* EebusDateTimeToString(const EebusDateTime* self) {
   return buffer;
 }
 
+size_t EebusDateTimeFormat(const EebusDateTime* self, char* buf, size_t buf_size) {
+  if ((self == NULL) || (buf_size < EEBUS_DATE_TIME_STRING_SIZE)) {
+    return 0;
+  }
+
+  const size_t date_len = EebusDateFormat(&self->date, buf, buf_size);
+  if (date_len == 0) {
+    return 0;
+  }
+
+  buf[date_len] = 'T';
+
+  const size_t time_len = EebusTimeFormat(&self->time, &buf[date_len + 1], buf_size - date_len - 1);
+  return (time_len != 0) ? date_len + 1 + time_len : 0;
+}
+
 static void Normalize(int32_t* filed, int32_t* filed_next, int32_t max) {
   const int32_t rem = *filed % max;
   if (*filed >= max) {
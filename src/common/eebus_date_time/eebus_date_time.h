@@ -30,6 +30,11 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Buffer size required to format a date-time, including the null terminator
+ */
+#define EEBUS_DATE_TIME_STRING_SIZE (sizeof("YYYY-MM-DDTHH:MM:SSZ"))
+
 typedef struct EebusDateTime EebusDateTime;
 
 struct EebusDateTime {
@@ -113,6 +118,21 @@ char* EebusTimeToString(const EebusTime* self);
  */
 EebusError EebusDateTimeParse(const char* s, EebusDateTime* date_time);
 
+/**
+ * @brief Parses a date-time string view into EebusDateTime structure without heap allocation.
+ *
+ * Accepts the same formats as EebusDateTimeParse(). The date and time parts are
+ * parsed with EebusDateParseWithLength() and EebusTimeParseWithLength() in place.
+ *
+ * @param[in] s The input date-time string, not necessarily null terminated. Must not be null.
+ * @param[in] len The input string length.
+ * @param[out] date_time Pointer to an EebusDateTime structure where the parsed
+ *                       date-time will be stored. Must not be null.
+ *
+ * @return EebusError Returns kEebusErrorOk on success, error code otherwise.
+ */
+EebusError EebusDateTimeParseWithLength(const char* s, size_t len, EebusDateTime* date_time);
+
 /**
  * @brief Converts an EebusDateTime structure to a string representation.
  *
@@ -128,6 +148,17 @@ EebusError EebusDateTimeParse(const char* s, EebusDateTime* date_time);
  */
 char* EebusDateTimeToString(const EebusDateTime* self);
 
+/**
+ * @brief Formats an EebusDateTime structure as "YYYY-MM-DDTHH:MM:SSZ" into the caller buffer.
+ *
+ * @param[in] self Pointer to the EebusDateTime structure to be formatted.
+ * @param[out] buf Output buffer, null terminated on success.
+ * @param[in] buf_size Output buffer size, at least EEBUS_DATE_TIME_STRING_SIZE.
+ *
+ * @return The string length written, 0 if the date-time is invalid or the buffer is too small.
+ */
+size_t EebusDateTimeFormat(const EebusDateTime* self, char* buf, size_t buf_size);
+
 /**
  * @brief Adds EebusDuration to an EebusDateTime.
  *
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief EEBUS Date & Time fixed width digits helpers shared by the parsers and formatters
+ */
+
+#ifndef SRC_COMMON_EEBUS_DATE_TIME_EEBUS_DATE_TIME_DIGITS_H_
+#define SRC_COMMON_EEBUS_DATE_TIME_EEBUS_DATE_TIME_DIGITS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "src/common/eebus_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Max string length handed over to the generic (strtol based) parsers
+ * when the input does not match the fixed width fast path
+ */
+#define EEBUS_DATE_TIME_PARSE_BUF_SIZE 64
+
+/**
+ * @brief Parses exactly n decimal digits, no sign, no whitespace
+ * @param s Digits to be parsed, n shall not exceed 9 to stay in int32_t range
+ * @param n Digits number
+ * @param value Parsed value
+ * @return true if all of n characters are digits, false otherwise
+ */
+static inline bool EebusDateTimeParseDigits(const char* s, size_t n, int32_t* value) {
+  int32_t v = 0;
+  for (size_t i = 0; i < n; ++i) {
+    const uint32_t digit = (uint32_t)(s[i] - '0');
+    if (digit > 9) {
+      return false;
+    }
+
+    v = v * 10 + (int32_t)digit;
+  }
+
+  *value = v;
+  return true;
+}
+
+/**
+ * @brief Writes the value as exactly width digits with leading zeros
+ * @param p Output position
+ * @param value Value in range [0, 10^width)
+ * @param width Digits number
+ * @return The output position after the last digit written
+ */
+static inline char* EebusDateTimeFormatDigits(char* p, int32_t value, size_t width) {
+  for (size_t i = width; i > 0; --i) {
+    p[i - 1] = (char)('0' + (value % 10));
+    value /= 10;
+  }
+
+  return p + width;
+}
+
+/**
+ * @brief Writes the value in decimal without leading zeros
+ * @param p Output position, shall have room for 10 digits
+ * @param value Value to be written
+ * @return The output position after the last digit written
+ */
+static inline char* EebusDateTimeFormatUint(char* p, uint32_t value) {
+  char digits[10];
+  size_t n = 0;
+  do {
+    digits[n++] = (char)('0' + (value % 10));
+    value /= 10;
+  } while (value != 0);
+
+  while (n > 0) {
+    *p++ = digits[--n];
+  }
+
+  return p;
+}
+
+/**
+ * @brief Copies the string view to a null terminated buffer to be passed to the generic parser
+ * @return kEebusErrorOk on success, kEebusErrorParse if the buffer is too small
+ */
+static inline EebusError EebusDateTimeCopyToBuf(const char* s, size_t len, char* buf, size_t buf_size) {
+  if (len >= buf_size) {
+    return kEebusErrorParse;
+  }
+
+  memcpy(buf, s, len);
+  buf[len] = '\0';
+  return kEebusErrorOk;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // SRC_COMMON_EEBUS_DATE_TIME_EEBUS_DATE_TIME_DIGITS_H_
@@ -25,6 +25,7 @@
 #include <string.h>
 
 #include "src/common/array_util.h"
+#include "src/common/eebus_date_time/eebus_date_time_digits.h"
 #include "src/common/eebus_date_time/eebus_duration.h"
 #include "src/common/eebus_malloc.h"
 
@@ -39,6 +40,8 @@ static const int32_t seconds_per_year   = 31536000;  // 365 * 86400 (Approximati
 
 static EebusError EebusDurationSetValue(EebusDuration* self, char key, bool is_time, int32_t value);
 static size_t EebusDurationGetStringLength(const EebusDuration* self);
+static bool EebusDurationParseFixedOrder(const char* s, size_t len, EebusDuration* duration);
+static char* EebusDurationFormatComponent(char* p, int32_t value, bool is_negative, char designator);
 
 void EebusDurationInvertSign(EebusDuration* duration) {
   if (duration == NULL) {
@@ -134,6 +137,95 @@ EebusError EebusDurationParse(const char* s, EebusDuration* duration) {
   return kEebusErrorOk;
 }
 
+bool EebusDurationParseFixedOrder(const char* s, size_t len, EebusDuration* duration) {
+  // Designators in the order of appearance, the date ones followed by the time ones
+  static const char designators[] = "YMDHMS";
+  static const size_t time_idx    = 3;
+  static const size_t max_digits  = 9;
+
+  int32_t* const fields[] = {
+      &duration->years,
+      &duration->months,
+      &duration->days,
+      &duration->hours,
+      &duration->minutes,
+      &duration->seconds,
+  };
+
+  memset(duration, 0, sizeof(*duration));
+
+  size_t i = 0;
+  if ((len > 0) && ((s[0] == '-') || (s[0] == '+'))) {
+    ++i;
+  }
+
+  if ((i >= len) || (s[i] != 'P')) {
+    return false;
+  }
+
+  size_t next_idx = 0;  // Index of the first designator allowed next
+  bool is_time    = false;
+  for (++i; i < len;) {
+    if (s[i] == 'T') {
+      if (is_time) {
+        return false;
+      }
+
+      is_time  = true;
+      next_idx = time_idx;
+      ++i;
+      continue;
+    }
+
+    size_t digits_num = 0;
+    while ((i + digits_num < len) && ((uint32_t)(s[i + digits_num] - '0') <= 9)) {
+      ++digits_num;
+    }
+
+    if ((digits_num == 0) || (digits_num > max_digits) || (i + digits_num >= len)) {
+      return false;
+    }
+
+    const size_t end_idx = is_time ? ARRAY_SIZE(designators) - 1 : time_idx;
+
+    size_t idx = next_idx;
+    while ((idx < end_idx) && (designators[idx] != s[i + digits_num])) {
+      ++idx;
+    }
+
+    if (idx >= end_idx) {
+      return false;
+    }
+
+    EebusDateTimeParseDigits(&s[i], digits_num, fields[idx]);
+    next_idx = idx + 1;
+    i += digits_num + 1;
+  }
+
+  if (s[0] == '-') {
+    EebusDurationInvertSign(duration);
+  }
+
+  return true;
+}
+
+EebusError EebusDurationParseWithLength(const char* s, size_t len, EebusDuration* duration) {
+  if ((s == NULL) || (duration == NULL)) {
+    return kEebusErrorInputArgumentNull;
+  }
+
+  if (EebusDurationParseFixedOrder(s, len, duration)) {
+    return kEebusErrorOk;
+  }
+
+  char buf[EEBUS_DATE_TIME_PARSE_BUF_SIZE];
+  if (EebusDateTimeCopyToBuf(s, len, buf, sizeof(buf)) != kEebusErrorOk) {
+    return kEebusErrorParse;
+  }
+
+  return EebusDurationParse(buf, duration);
+}
+
 bool EebusDurationIsZero(const EebusDuration* self) {
   if (self == NULL) {
     return false;
@@ -259,6 +351,60 @@ char* EebusDurationToString(const EebusDuration* self) {
   return buffer;
 }
 
+char* EebusDurationFormatComponent(char* p, int32_t value, bool is_negative, char designator) {
+  if (value == 0) {
+    return p;
+  }
+
+  p    = EebusDateTimeFormatUint(p, is_negative ? 0u - (uint32_t)value : (uint32_t)value);
+  *p++ = designator;
+  return p;
+}
+
+size_t EebusDurationFormat(const EebusDuration* self, char* buf, size_t buf_size) {
+  if ((buf == NULL) || (!EebusDurationIsValid(self))) {
+    return 0;
+  }
+
+  if (EebusDurationIsZero(self)) {
+    if (buf_size < ARRAY_SIZE(zero_duration)) {
+      return 0;
+    }
+
+    memcpy(buf, zero_duration, ARRAY_SIZE(zero_duration));
+    return ARRAY_SIZE(zero_duration) - 1;
+  }
+
+  char tmp[EEBUS_DURATION_STRING_SIZE];
+  char* p = tmp;
+
+  const bool is_negative = EebusDurationIsNegative(self);
+  if (is_negative) {
+    *p++ = '-';
+  }
+
+  *p++ = 'P';
+  p    = EebusDurationFormatComponent(p, self->years, is_negative, 'Y');
+  p    = EebusDurationFormatComponent(p, self->months, is_negative, 'M');
+  p    = EebusDurationFormatComponent(p, self->days, is_negative, 'D');
+
+  if ((self->hours != 0) || (self->minutes != 0) || (self->seconds != 0)) {
+    *p++ = 'T';
+    p    = EebusDurationFormatComponent(p, self->hours, is_negative, 'H');
+    p    = EebusDurationFormatComponent(p, self->minutes, is_negative, 'M');
+    p    = EebusDurationFormatComponent(p, self->seconds, is_negative, 'S');
+  }
+
+  const size_t len = (size_t)(p - tmp);
+  if (len >= buf_size) {
+    return 0;
+  }
+
+  memcpy(buf, tmp, len);
+  buf[len] = '\0';
+  return len;
+}
+
 int64_t EebusDurationToSeconds(const EebusDuration* self) {
   if ((self == NULL) || (!EebusDurationIsValid(self))) {
     return 0;  // Return 0 for invalid input
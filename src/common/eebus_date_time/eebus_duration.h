@@ -22,6 +22,7 @@
 #define SRC_COMMON_EEBUS_DATE_TIME_DURATION_EEBUS_DURATION_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "src/common/eebus_errors.h"
@@ -30,6 +31,11 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Buffer size required to format any valid duration, including the null terminator
+ */
+#define EEBUS_DURATION_STRING_SIZE (sizeof("-P2147483648Y2147483648M2147483648DT2147483648H2147483648M2147483648S"))
+
 typedef struct EebusDuration EebusDuration;
 
 /**
@@ -94,6 +100,22 @@ bool EebusDurationIsValid(const EebusDuration* self);
  */
 EebusError EebusDurationParse(const char* s, EebusDuration* duration);
 
+/**
+ * @brief Parses a duration string view into an EebusDuration structure without heap allocation.
+ *
+ * Durations with unsigned components of up to 9 digits in the "PnYnMnDTnHnMnS" order
+ * are parsed in a single pass, any other spelling accepted by EebusDurationParse()
+ * is handed over to it.
+ *
+ * @param[in] s The input string, not necessarily null terminated. Must not be null.
+ * @param[in] len The input string length.
+ * @param[out] duration Pointer to an EebusDuration structure where the parsed duration will be stored.
+ *                      Must not be null.
+ *
+ * @return EebusError Returns kEebusErrorOk on success, error code otherwise.
+ */
+EebusError EebusDurationParseWithLength(const char* s, size_t len, EebusDuration* duration);
+
 /**
  * @brief Converts an EebusDuration structure to a string representation.
  *
@@ -108,6 +130,20 @@ EebusError EebusDurationParse(const char* s, EebusDuration* duration);
  */
 char* EebusDurationToString(const EebusDuration* self);
 
+/**
+ * @brief Formats an EebusDuration structure as "PnYnMnDTnHnMnS" into the caller buffer.
+ *
+ * Zero components are omitted, a negative duration is prefixed with "-"
+ * and the zero duration is formatted as "PT0S".
+ *
+ * @param[in] self Pointer to the EebusDuration structure to be formatted.
+ * @param[out] buf Output buffer, null terminated on success.
+ * @param[in] buf_size Output buffer size, EEBUS_DURATION_STRING_SIZE fits any valid duration.
+ *
+ * @return The string length written, 0 if the duration is invalid or the buffer is too small.
+ */
+size_t EebusDurationFormat(const EebusDuration* self, char* buf, size_t buf_size);
+
 /**
  * @brief Converts an EebusDuration object to its equivalent duration in seconds.
  *
@@ -27,12 +27,15 @@
 #include "src/common/eebus_errors.h"
 #include "src/common/eebus_malloc.h"
 
+#include "src/common/eebus_date_time/eebus_date_time_digits.h"
 #include "src/common/eebus_date_time/eebus_time.h"
 
 static const int32_t seconds_per_minute = 60;
 static const int32_t minutes_per_hour   = 60;
 static const int32_t hours_per_day      = 24;
 
+static bool EebusTimeParseFixedWidth(const char* s, size_t len, EebusTime* time);
+
 bool EebusTimeIsValid(const EebusTime* self) {
   if (self == NULL) {
     return false;
@@ -105,6 +108,45 @@ EebusError EebusTimeParse(const char* s, EebusTime* time) {
   return kEebusErrorOk;
 }
 
+bool EebusTimeParseFixedWidth(const char* s, size_t len, EebusTime* time) {
+  static const size_t hh_mm_ss_len = ARRAY_SIZE("HH:MM:SS") - 1;
+
+  if ((len < hh_mm_ss_len) || (s[2] != ':') || (s[5] != ':') || !EebusDateTimeParseDigits(&s[0], 2, &time->hour)
+      || !EebusDateTimeParseDigits(&s[3], 2, &time->min) || !EebusDateTimeParseDigits(&s[6], 2, &time->sec)) {
+    return false;
+  }
+
+  size_t i = hh_mm_ss_len;
+  if ((i < len) && (s[i] == '.')) {
+    // Fractional seconds are skipped
+    for (++i; (i < len) && ((uint32_t)(s[i] - '0') <= 9); ++i) {
+    }
+  }
+
+  if ((i < len) && (s[i] == 'Z')) {
+    ++i;
+  }
+
+  return i == len;
+}
+
+EebusError EebusTimeParseWithLength(const char* s, size_t len, EebusTime* time) {
+  if ((s == NULL) || (time == NULL)) {
+    return kEebusErrorInputArgumentNull;
+  }
+
+  if (EebusTimeParseFixedWidth(s, len, time)) {
+    return EebusTimeIsValid(time) ? kEebusErrorOk : kEebusErrorParse;
+  }
+
+  char buf[EEBUS_DATE_TIME_PARSE_BUF_SIZE];
+  if (EebusDateTimeCopyToBuf(s, len, buf, sizeof(buf)) != kEebusErrorOk) {
+    return kEebusErrorParse;
+  }
+
+  return EebusTimeParse(buf, time);
+}
+
 char* EebusTimeToString(const EebusTime* self) {
   if ((self == NULL) || (!EebusTimeIsValid(self))) {
     return NULL;
@@ -124,6 +166,21 @@ char* EebusTimeToString(const EebusTime* self) {
   return buffer;
 }
 
+size_t EebusTimeFormat(const EebusTime* self, char* buf, size_t buf_size) {
+  if ((buf == NULL) || (buf_size < EEBUS_TIME_STRING_SIZE) || (!EebusTimeIsValid(self))) {
+    return 0;
+  }
+
+  char* p = EebusDateTimeFormatDigits(buf, self->hour, 2);
+  *p++    = ':';
+  p       = EebusDateTimeFormatDigits(p, self->min, 2);
+  *p++    = ':';
+  p       = EebusDateTimeFormatDigits(p, self->sec, 2);
+  *p++    = 'Z';
+  *p      = '\0';
+  return (size_t)(p - buf);
+}
+
 int32_t EebusTimeCompare(const EebusTime* self, const EebusTime* other) {
   if (self->hour != other->hour) {
     return self->hour - other->hour;
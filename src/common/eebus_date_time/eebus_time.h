@@ -22,6 +22,7 @@
 #define SRC_COMMON_DATE_TIME_EEBUS_TIME_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "src/common/eebus_date_time/eebus_duration.h"
@@ -31,6 +32,11 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Buffer size required to format a time, including the null terminator
+ */
+#define EEBUS_TIME_STRING_SIZE (sizeof("HH:MM:SSZ"))
+
 typedef struct EebusTime EebusTime;
 
 struct EebusTime {
@@ -60,6 +66,21 @@ bool EebusTimeIsValid(const EebusTime* self);
  */
 EebusError EebusTimeParse(const char* s, EebusTime* time);
 
+/**
+ * @brief Parses a ISO 8061 time string view without heap allocation.
+ *
+ * The fixed width "HH:MM:SS" form with optional fractional seconds and "Z" suffix
+ * is parsed in a single pass, any other spelling accepted by EebusTimeParse()
+ * is handed over to it.
+ *
+ * @param s The input ISO 8061 time string, not necessarily null terminated.
+ * @param len The input string length.
+ * @param time A pointer to an EebusTime structure where the parsed time will
+ *             be stored. The structure must be allocated by the caller.
+ * @return kEebusErrorOk on success, error code otherwise.
+ */
+EebusError EebusTimeParseWithLength(const char* s, size_t len, EebusTime* time);
+
 /**
  * @brief Converts an EebusTime object to ISO 8061 time string representation.
  *
@@ -69,6 +90,16 @@ EebusError EebusTimeParse(const char* s, EebusTime* time);
  */
 char* EebusTimeToString(const EebusTime* self);
 
+/**
+ * @brief Formats an EebusTime object as "HH:MM:SSZ" into the caller buffer.
+ *
+ * @param self Pointer to the EebusTime object to be formatted.
+ * @param buf Output buffer, null terminated on success.
+ * @param buf_size Output buffer size, at least EEBUS_TIME_STRING_SIZE.
+ * @return The string length written, 0 if the time is invalid or the buffer is too small.
+ */
+size_t EebusTimeFormat(const EebusTime* self, char* buf, size_t buf_size);
+
 /**
  * @brief Compares two EebusTime objects.
  *
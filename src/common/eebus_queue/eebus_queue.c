@@ -81,17 +81,19 @@ struct EebusQueue {
 static void Destruct(EebusQueueObject* self);
 static EebusError Send(EebusQueueObject* self, const void* msg, uint32_t timeout_ms);
 static EebusError Receive(EebusQueueObject* self, void* msg, uint32_t timeout_ms);
+static EebusError ReceiveMany(EebusQueueObject* self, void* msgs, size_t max_num, size_t* num, uint32_t timeout_ms);
 static bool IsEmpty(const EebusQueueObject* self);
 static bool IsFull(const EebusQueueObject* self);
 static void Clear(EebusQueueObject* self);
 
 static const EebusQueueInterface eebus_queue_methods = {
-    .destruct = Destruct,
-    .send     = Send,
-    .receive  = Receive,
-    .is_empty = IsEmpty,
-    .is_full  = IsFull,
-    .clear    = Clear,
+    .destruct     = Destruct,
+    .send         = Send,
+    .receive      = Receive,
+    .receive_many = ReceiveMany,
+    .is_empty     = IsEmpty,
+    .is_full      = IsFull,
+    .clear        = Clear,
 };
 
 static EebusError
@@ -104,6 +106,7 @@ static bool SendPredicate(void* ctx);
 static EebusError SendInternal(EebusQueue* self, const void* msg, uint32_t timeout_ms);
 static bool ReceivePredicate(void* ctx);
 static EebusError ReceiveInternal(EebusQueue* self, void* msg, uint32_t timeout_ms);
+static void PopInternal(EebusQueue* self, void* msg);
 
 EebusError EebusQueueConstruct(EebusQueue* self, size_t max_msg, size_t msg_size, QueueMsgDeallocator msg_deallocator) {
   // Override "virtual functions table"
@@ -295,6 +298,13 @@ EebusError ReceiveInternal(EebusQueue* self, void* msg, uint32_t timeout_ms) {
     return kEebusErrorNoChange;
   }
 
+  PopInternal(self, msg);
+  pthread_cond_signal(&self->is_not_full_cond);
+
+  return kEebusErrorOk;
+}
+
+void PopInternal(EebusQueue* self, void* msg) {
   memcpy(msg, self->tail, self->msg_size);
   self->tail += self->msg_size;
   if (self->tail >= self->msg_buf + self->msg_size * self->max_msg) {
@@ -303,10 +313,6 @@ EebusError ReceiveInternal(EebusQueue* self, void* msg, uint32_t timeout_ms) {
 
   self->is_full  = false;
   self->is_empty = (self->head == self->tail);
-
-  pthread_cond_signal(&self->is_not_full_cond);
-
-  return kEebusErrorOk;
 }
 
 EebusError Receive(EebusQueueObject* self, void* msg, uint32_t timeout_ms) {
@@ -323,6 +329,34 @@ EebusError Receive(EebusQueueObject* self, void* msg, uint32_t timeout_ms) {
   return err;
 }
 
+EebusError ReceiveMany(EebusQueueObject* self, void* msgs, size_t max_num, size_t* num, uint32_t timeout_ms) {
+  EebusQueue* const queue = EEBUS_QUEUE(self);
+
+  *num = 0;
+  if (max_num == 0) {
+    return kEebusErrorInputArgument;
+  }
+
+  EebusError err = kEebusErrorNoChange;
+
+  pthread_mutex_lock(&queue->mutex);
+  if (!queue->is_closed) {
+    err = ReceiveInternal(queue, msgs, timeout_ms);
+  }
+
+  if (err == kEebusErrorOk) {
+    // Take the rest of the burst within the same critical section
+    for (*num = 1; (*num < max_num) && !queue->is_empty; ++(*num)) {
+      PopInternal(queue, (uint8_t*)msgs + *num * queue->msg_size);
+    }
+
+    pthread_cond_broadcast(&queue->is_not_full_cond);
+  }
+
+  pthread_mutex_unlock(&queue->mutex);
+  return err;
+}
+
 bool IsEmpty(const EebusQueueObject* self) {
   return EEBUS_QUEUE(self)->is_empty;
 }
@@ -332,7 +366,8 @@ bool IsFull(const EebusQueueObject* self) {
 }
 
 void ClearInternal(EebusQueue* self) {
-  while (self->tail != self->head) {
+  // Head equals tail on a full queue as well, so rely on the empty flag
+  while (!self->is_empty) {
     if (self->msg_deallocator != NULL) {
       self->msg_deallocator(self->tail);
     }
@@ -341,6 +376,8 @@ void ClearInternal(EebusQueue* self) {
     if (self->tail >= self->msg_buf + self->msg_size * self->max_msg) {
       self->tail = self->msg_buf;
     }
+
+    self->is_empty = (self->tail == self->head);
   }
 
   self->is_empty = true;
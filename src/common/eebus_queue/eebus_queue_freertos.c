@@ -55,17 +55,19 @@ struct EebusQueue {
 static void Destruct(EebusQueueObject* self);
 static EebusError Send(EebusQueueObject* self, const void* msg, uint32_t timeout_ms);
 static EebusError Receive(EebusQueueObject* self, void* msg, uint32_t timeout_ms);
+static EebusError ReceiveMany(EebusQueueObject* self, void* msgs, size_t max_num, size_t* num, uint32_t timeout_ms);
 static bool IsEmpty(const EebusQueueObject* self);
 static bool IsFull(const EebusQueueObject* self);
 static void Clear(EebusQueueObject* self);
 
 static const EebusQueueInterface eebus_queue_methods = {
-    .destruct = Destruct,
-    .send     = Send,
-    .receive  = Receive,
-    .is_empty = IsEmpty,
-    .is_full  = IsFull,
-    .clear    = Clear,
+    .destruct     = Destruct,
+    .send         = Send,
+    .receive      = Receive,
+    .receive_many = ReceiveMany,
+    .is_empty     = IsEmpty,
+    .is_full      = IsFull,
+    .clear        = Clear,
 };
 
 static EebusError
@@ -158,6 +160,28 @@ EebusError Receive(EebusQueueObject* self, void* msg, uint32_t timeout_ms) {
   }
 }
 
+EebusError ReceiveMany(EebusQueueObject* self, void* msgs, size_t max_num, size_t* num, uint32_t timeout_ms) {
+  EebusQueue* const queue = EEBUS_QUEUE(self);
+
+  *num = 0;
+  if (max_num == 0) {
+    return kEebusErrorInputArgument;
+  }
+
+  const EebusError err = Receive(self, msgs, timeout_ms);
+  if (err != kEebusErrorOk) {
+    return err;
+  }
+
+  for (*num = 1; *num < max_num; ++(*num)) {
+    if (xQueueReceive(queue->queue_handle, (uint8_t*)msgs + *num * queue->msg_size, 0) != pdTRUE) {
+      break;
+    }
+  }
+
+  return kEebusErrorOk;
+}
+
 bool IsEmpty(const EebusQueueObject* self) {
   const EebusQueue* const queue = EEBUS_QUEUE(self);
 
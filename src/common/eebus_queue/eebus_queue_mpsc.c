@@ -0,0 +1,504 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Lock-free Eebus Queue implementation
+ *
+ * Bounded multi-producer/single-consumer ring: each slot carries a sequence number telling
+ * whether it is free for the producer at the given position or holds the message for the consumer
+ * at that position. Producers claim the positions with a compare-and-swap, the consumer owns the
+ * read position exclusively. The threads only park (futex on Linux, condition variable elsewhere)
+ * when the queue is empty or full and the wakeup is only issued if somebody is actually parked.
+ */
+
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "src/common/api/eebus_queue_interface.h"
+#include "src/common/eebus_errors.h"
+#include "src/common/eebus_malloc.h"
+#include "src/common/eebus_queue/eebus_queue.h"
+#include "src/common/eebus_queue/eebus_queue_mpsc.h"
+
+/** Padding separating the producer and consumer positions, not to share the cache line */
+#define CACHE_LINE_SIZE 64
+
+typedef struct QueueEvent QueueEvent;
+
+/** Event count the threads park on, signalled only when there are waiters */
+struct QueueEvent {
+  /** Incremented on every notification, the futex word */
+  atomic_uint seq;
+  /** Number of threads about to park or parked */
+  atomic_uint num_waiters;
+#ifndef __linux__
+  /** Mutex initialisation return value */
+  int mutex_init_ret;
+  /** Condition variable initialisation return value */
+  int cond_init_ret;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+#endif
+};
+
+typedef struct EebusQueueMpsc EebusQueueMpsc;
+
+struct EebusQueueMpsc {
+  /** Implements the Eebus Queue Interface */
+  EebusQueueObject obj;
+
+  /** Number of slots, power of two */
+  size_t capacity;
+  /** Queue message size */
+  size_t msg_size;
+  /** Queue message deallocator (used to clear pending messages when deallocating queue) */
+  QueueMsgDeallocator msg_deallocator;
+  /** Slot sequence numbers */
+  atomic_size_t* slot_seqs;
+  /** Slot messages, msg_size each */
+  uint8_t* msg_buf;
+  /** Scratch message used to clear the queue */
+  uint8_t* msg_tmp;
+  /** Queue is closed for any send/receive operations */
+  atomic_bool is_closed;
+  /** Next position to be claimed by the producers */
+  atomic_size_t wr_pos;
+  uint8_t wr_pad[CACHE_LINE_SIZE - sizeof(atomic_size_t)];
+  /** Next position to be read by the consumer */
+  atomic_size_t rd_pos;
+  uint8_t rd_pad[CACHE_LINE_SIZE - sizeof(atomic_size_t)];
+  /** Signalled on send when the consumer is parked */
+  QueueEvent not_empty_event;
+  /** Signalled on receive when any producer is parked */
+  QueueEvent not_full_event;
+};
+
+#define EEBUS_QUEUE_MPSC(obj) ((EebusQueueMpsc*)(obj))
+
+static void Destruct(EebusQueueObject* self);
+static EebusError Send(EebusQueueObject* self, const void* msg, uint32_t timeout_ms);
+static EebusError Receive(EebusQueueObject* self, void* msg, uint32_t timeout_ms);
+static EebusError ReceiveMany(EebusQueueObject* self, void* msgs, size_t max_num, size_t* num, uint32_t timeout_ms);
+static bool IsEmpty(const EebusQueueObject* self);
+static bool IsFull(const EebusQueueObject* self);
+static void Clear(EebusQueueObject* self);
+
+static const EebusQueueInterface eebus_queue_mpsc_methods = {
+    .destruct     = Destruct,
+    .send         = Send,
+    .receive      = Receive,
+    .receive_many = ReceiveMany,
+    .is_empty     = IsEmpty,
+    .is_full      = IsFull,
+    .clear        = Clear,
+};
+
+static EebusError
+EebusQueueMpscConstruct(EebusQueueMpsc* self, size_t max_msg, size_t msg_size, QueueMsgDeallocator msg_deallocator);
+static EebusError QueueEventInit(QueueEvent* self);
+static void QueueEventDeinit(QueueEvent* self);
+static unsigned int QueueEventPrepareWait(QueueEvent* self);
+static void QueueEventWait(QueueEvent* self, unsigned int seq, uint32_t timeout_ms);
+static void QueueEventCancelWait(QueueEvent* self);
+static void QueueEventNotify(QueueEvent* self, bool force);
+static uint64_t GetTimeMs(void);
+static uint32_t GetRemainingMs(uint64_t deadline_ms, uint32_t timeout_ms);
+static bool TrySend(EebusQueueMpsc* self, const void* msg);
+static bool TryReceive(EebusQueueMpsc* self, void* msg);
+
+EebusError QueueEventInit(QueueEvent* self) {
+  atomic_init(&self->seq, 0);
+  atomic_init(&self->num_waiters, 0);
+
+#ifndef __linux__
+  self->cond_init_ret  = -1;
+  self->mutex_init_ret = pthread_mutex_init(&self->mutex, NULL);
+  if (self->mutex_init_ret != 0) {
+    return kEebusErrorInit;
+  }
+
+  self->cond_init_ret = pthread_cond_init(&self->cond, NULL);
+  if (self->cond_init_ret != 0) {
+    return kEebusErrorInit;
+  }
+#endif
+
+  return kEebusErrorOk;
+}
+
+void QueueEventDeinit(QueueEvent* self) {
+#ifndef __linux__
+  if (self->cond_init_ret == 0) {
+    pthread_cond_destroy(&self->cond);
+    self->cond_init_ret = -1;
+  }
+
+  if (self->mutex_init_ret == 0) {
+    pthread_mutex_destroy(&self->mutex);
+    self->mutex_init_ret = -1;
+  }
+#else
+  (void)self;
+#endif
+}
+
+unsigned int QueueEventPrepareWait(QueueEvent* self) {
+  // Register as a waiter first, so that the notifier either sees the waiter
+  // or the waiter sees the queue state change on the check done after this call
+  atomic_fetch_add(&self->num_waiters, 1);
+  return atomic_load(&self->seq);
+}
+
+void QueueEventWait(QueueEvent* self, unsigned int seq, uint32_t timeout_ms) {
+#ifdef __linux__
+  struct timespec ts = {.tv_sec = timeout_ms / 1000, .tv_nsec = (long)(timeout_ms % 1000) * 1000000};
+  syscall(
+      SYS_futex,
+      &self->seq,
+      FUTEX_WAIT_PRIVATE,
+      seq,
+      (timeout_ms == kTimeoutInfinite) ? NULL : &ts,
+      NULL,
+      0
+  );
+#else
+  struct timespec ts = {0};
+  if (timeout_ms != kTimeoutInfinite) {
+    timespec_get(&ts, TIME_UTC);
+    ts.tv_sec += timeout_ms / 1000;
+    ts.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+    if (ts.tv_nsec >= 1000000000) {
+      ts.tv_sec += ts.tv_nsec / 1000000000;
+      ts.tv_nsec %= 1000000000;
+    }
+  }
+
+  pthread_mutex_lock(&self->mutex);
+  if (atomic_load(&self->seq) == seq) {
+    if (timeout_ms == kTimeoutInfinite) {
+      pthread_cond_wait(&self->cond, &self->mutex);
+    } else {
+      pthread_cond_timedwait(&self->cond, &self->mutex, &ts);
+    }
+  }
+
+  pthread_mutex_unlock(&self->mutex);
+#endif
+}
+
+void QueueEventCancelWait(QueueEvent* self) {
+  atomic_fetch_sub(&self->num_waiters, 1);
+}
+
+void QueueEventNotify(QueueEvent* self, bool force) {
+  // Pairs with the waiter registration in QueueEventPrepareWait()
+  atomic_thread_fence(memory_order_seq_cst);
+  if (!force && (atomic_load(&self->num_waiters) == 0)) {
+    return;
+  }
+
+  // A single message or slot satisfies a single waiter, the others would only contend for it
+#ifdef __linux__
+  atomic_fetch_add(&self->seq, 1);
+  syscall(SYS_futex, &self->seq, FUTEX_WAKE_PRIVATE, force ? INT_MAX : 1, NULL, NULL, 0);
+#else
+  pthread_mutex_lock(&self->mutex);
+  atomic_fetch_add(&self->seq, 1);
+  if (force) {
+    pthread_cond_broadcast(&self->cond);
+  } else {
+    pthread_cond_signal(&self->cond);
+  }
+
+  pthread_mutex_unlock(&self->mutex);
+#endif
+}
+
+uint64_t GetTimeMs(void) {
+  struct timespec ts = {0};
+#ifdef __linux__
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+  timespec_get(&ts, TIME_UTC);
+#endif
+  return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+uint32_t GetRemainingMs(uint64_t deadline_ms, uint32_t timeout_ms) {
+  if ((timeout_ms == 0) || (timeout_ms == kTimeoutInfinite)) {
+    return timeout_ms;
+  }
+
+  const uint64_t now_ms = GetTimeMs();
+  return (now_ms >= deadline_ms) ? 0 : (uint32_t)(deadline_ms - now_ms);
+}
+
+EebusError
+EebusQueueMpscConstruct(EebusQueueMpsc* self, size_t max_msg, size_t msg_size, QueueMsgDeallocator msg_deallocator) {
+  // Override "virtual functions table"
+  EEBUS_QUEUE_INTERFACE(self) = &eebus_queue_mpsc_methods;
+
+  self->capacity        = 2;
+  self->msg_size        = msg_size;
+  self->msg_deallocator = msg_deallocator;
+  self->slot_seqs       = NULL;
+  self->msg_buf         = NULL;
+  self->msg_tmp         = NULL;
+  atomic_init(&self->is_closed, false);
+  atomic_init(&self->wr_pos, 0);
+  atomic_init(&self->rd_pos, 0);
+
+  const EebusError not_empty_event_err = QueueEventInit(&self->not_empty_event);
+  const EebusError not_full_event_err  = QueueEventInit(&self->not_full_event);
+  if ((not_empty_event_err != kEebusErrorOk) || (not_full_event_err != kEebusErrorOk)) {
+    return kEebusErrorInit;
+  }
+
+  if ((max_msg == 0) || (msg_size == 0) || (max_msg > SIZE_MAX / 2)) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  // Power of two capacity keeps the slot index valid across the position counter wrap-around.
+  // At least two slots are needed to tell the published message from the slot free for the next lap
+  while (self->capacity < max_msg) {
+    self->capacity <<= 1;
+  }
+
+  if (self->capacity > SIZE_MAX / msg_size) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  self->slot_seqs = (atomic_size_t*)EEBUS_MALLOC(self->capacity * sizeof(atomic_size_t));
+  self->msg_buf   = (uint8_t*)EEBUS_MALLOC(self->capacity * msg_size);
+  self->msg_tmp   = (uint8_t*)EEBUS_MALLOC(msg_size);
+  if ((self->slot_seqs == NULL) || (self->msg_buf == NULL) || (self->msg_tmp == NULL)) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  for (size_t i = 0; i < self->capacity; ++i) {
+    atomic_init(&self->slot_seqs[i], i);
+  }
+
+  return kEebusErrorOk;
+}
+
+EebusQueueObject* EebusQueueMpscCreate(size_t max_msg, size_t msg_size, QueueMsgDeallocator msg_deallocator) {
+  EebusQueueMpsc* const eebus_queue = (EebusQueueMpsc*)EEBUS_MALLOC(sizeof(EebusQueueMpsc));
+  if (eebus_queue == NULL) {
+    return NULL;
+  }
+
+  const EebusError err = EebusQueueMpscConstruct(eebus_queue, max_msg, msg_size, msg_deallocator);
+  if (err != kEebusErrorOk) {
+    EebusQueueDelete(EEBUS_QUEUE_OBJECT(eebus_queue));
+    return NULL;
+  }
+
+  return EEBUS_QUEUE_OBJECT(eebus_queue);
+}
+
+void Destruct(EebusQueueObject* self) {
+  EebusQueueMpsc* const queue = EEBUS_QUEUE_MPSC(self);
+
+  atomic_store(&queue->is_closed, true);
+
+  // The buffers are only allocated once both of the events are initialised
+  if ((queue->slot_seqs != NULL) && (queue->msg_buf != NULL) && (queue->msg_tmp != NULL)) {
+    QueueEventNotify(&queue->not_empty_event, true);
+    QueueEventNotify(&queue->not_full_event, true);
+    Clear(self);
+  }
+
+  QueueEventDeinit(&queue->not_empty_event);
+  QueueEventDeinit(&queue->not_full_event);
+
+  EEBUS_FREE(queue->slot_seqs);
+  queue->slot_seqs = NULL;
+  EEBUS_FREE(queue->msg_buf);
+  queue->msg_buf = NULL;
+  EEBUS_FREE(queue->msg_tmp);
+  queue->msg_tmp = NULL;
+}
+
+bool TrySend(EebusQueueMpsc* self, const void* msg) {
+  size_t pos = atomic_load_explicit(&self->wr_pos, memory_order_relaxed);
+
+  for (;;) {
+    atomic_size_t* const slot_seq = &self->slot_seqs[pos & (self->capacity - 1)];
+
+    const size_t seq = atomic_load_explicit(slot_seq, memory_order_acquire);
+    const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+    if (diff < 0) {
+      // The slot still holds the message from the previous lap
+      return false;
+    }
+
+    if (diff > 0) {
+      // Another producer has claimed this position in the meantime
+      pos = atomic_load_explicit(&self->wr_pos, memory_order_relaxed);
+      continue;
+    }
+
+    if (atomic_compare_exchange_weak_explicit(
+            &self->wr_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed
+        )) {
+      memcpy(&self->msg_buf[(pos & (self->capacity - 1)) * self->msg_size], msg, self->msg_size);
+      atomic_store_explicit(slot_seq, pos + 1, memory_order_release);
+      return true;
+    }
+  }
+}
+
+EebusError Send(EebusQueueObject* self, const void* msg, uint32_t timeout_ms) {
+  EebusQueueMpsc* const queue = EEBUS_QUEUE_MPSC(self);
+
+  uint64_t deadline_ms = 0;
+  if ((timeout_ms != 0) && (timeout_ms != kTimeoutInfinite)) {
+    deadline_ms = GetTimeMs() + timeout_ms;
+  }
+
+  for (;;) {
+    if (atomic_load(&queue->is_closed)) {
+      return kEebusErrorNoChange;
+    }
+
+    if (TrySend(queue, msg)) {
+      QueueEventNotify(&queue->not_empty_event, false);
+      return kEebusErrorOk;
+    }
+
+    const uint32_t remaining_ms = GetRemainingMs(deadline_ms, timeout_ms);
+    if (remaining_ms == 0) {
+      return kEebusErrorTime;
+    }
+
+    const unsigned int seq = QueueEventPrepareWait(&queue->not_full_event);
+    if (IsFull(self) && !atomic_load(&queue->is_closed)) {
+      QueueEventWait(&queue->not_full_event, seq, remaining_ms);
+    }
+
+    QueueEventCancelWait(&queue->not_full_event);
+  }
+}
+
+bool TryReceive(EebusQueueMpsc* self, void* msg) {
+  const size_t pos = atomic_load_explicit(&self->rd_pos, memory_order_relaxed);
+
+  atomic_size_t* const slot_seq = &self->slot_seqs[pos & (self->capacity - 1)];
+  if (atomic_load_explicit(slot_seq, memory_order_acquire) != pos + 1) {
+    // Empty or the producer has claimed the slot but not published the message yet
+    return false;
+  }
+
+  memcpy(msg, &self->msg_buf[(pos & (self->capacity - 1)) * self->msg_size], self->msg_size);
+  atomic_store_explicit(&self->rd_pos, pos + 1, memory_order_relaxed);
+  atomic_store_explicit(slot_seq, pos + self->capacity, memory_order_release);
+  return true;
+}
+
+EebusError Receive(EebusQueueObject* self, void* msg, uint32_t timeout_ms) {
+  EebusQueueMpsc* const queue = EEBUS_QUEUE_MPSC(self);
+
+  uint64_t deadline_ms = 0;
+  if ((timeout_ms != 0) && (timeout_ms != kTimeoutInfinite)) {
+    deadline_ms = GetTimeMs() + timeout_ms;
+  }
+
+  for (;;) {
+    if (atomic_load(&queue->is_closed)) {
+      return kEebusErrorNoChange;
+    }
+
+    if (TryReceive(queue, msg)) {
+      QueueEventNotify(&queue->not_full_event, false);
+      return kEebusErrorOk;
+    }
+
+    const uint32_t remaining_ms = GetRemainingMs(deadline_ms, timeout_ms);
+    if (remaining_ms == 0) {
+      return kEebusErrorTime;
+    }
+
+    const unsigned int seq = QueueEventPrepareWait(&queue->not_empty_event);
+    if (IsEmpty(self) && !atomic_load(&queue->is_closed)) {
+      QueueEventWait(&queue->not_empty_event, seq, remaining_ms);
+    }
+
+    QueueEventCancelWait(&queue->not_empty_event);
+  }
+}
+
+EebusError ReceiveMany(EebusQueueObject* self, void* msgs, size_t max_num, size_t* num, uint32_t timeout_ms) {
+  EebusQueueMpsc* const queue = EEBUS_QUEUE_MPSC(self);
+
+  *num = 0;
+  if (max_num == 0) {
+    return kEebusErrorInputArgument;
+  }
+
+  const EebusError err = Receive(self, msgs, timeout_ms);
+  if (err != kEebusErrorOk) {
+    return err;
+  }
+
+  for (*num = 1; *num < max_num; ++(*num)) {
+    if (!TryReceive(queue, (uint8_t*)msgs + *num * queue->msg_size)) {
+      break;
+    }
+
+    QueueEventNotify(&queue->not_full_event, false);
+  }
+
+  return kEebusErrorOk;
+}
+
+bool IsEmpty(const EebusQueueObject* self) {
+  EebusQueueMpsc* const queue = EEBUS_QUEUE_MPSC(self);
+
+  const size_t pos = atomic_load_explicit(&queue->rd_pos, memory_order_relaxed);
+  return atomic_load(&queue->slot_seqs[pos & (queue->capacity - 1)]) != pos + 1;
+}
+
+bool IsFull(const EebusQueueObject* self) {
+  EebusQueueMpsc* const queue = EEBUS_QUEUE_MPSC(self);
+
+  const size_t pos = atomic_load(&queue->wr_pos);
+  const size_t seq = atomic_load(&queue->slot_seqs[pos & (queue->capacity - 1)]);
+  return ((intptr_t)seq - (intptr_t)pos) < 0;
+}
+
+void Clear(EebusQueueObject* self) {
+  EebusQueueMpsc* const queue = EEBUS_QUEUE_MPSC(self);
+
+  while (TryReceive(queue, queue->msg_tmp)) {
+    if (queue->msg_deallocator != NULL) {
+      queue->msg_deallocator(queue->msg_tmp);
+    }
+  }
+
+  QueueEventNotify(&queue->not_full_event, false);
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Lock-free Eebus Queue implementation declarations
+ */
+
+#ifndef SRC_COMMON_EEBUS_QUEUE_EEBUS_QUEUE_MPSC_H_
+#define SRC_COMMON_EEBUS_QUEUE_EEBUS_QUEUE_MPSC_H_
+
+#include <stddef.h>
+
+#include "src/common/api/eebus_queue_interface.h"
+#include "src/common/eebus_queue/eebus_queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Create the bounded lock-free multi-producer/single-consumer queue.
+ * Any thread may send, but receive, is empty and clear must only be called from the one consumer thread.
+ * The queue is destroyed with EebusQueueDelete() as the mutex based one
+ * @param max_msg Minimal queue capacity, rounded up to the power of two, two at least
+ * @param msg_size Queue message size
+ * @param msg_deallocator Deallocator of the messages left in the queue on clear, can be NULL
+ * @return Queue object on success, NULL otherwise
+ */
+EebusQueueObject* EebusQueueMpscCreate(size_t max_msg, size_t msg_size, QueueMsgDeallocator msg_deallocator);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_COMMON_EEBUS_QUEUE_EEBUS_QUEUE_MPSC_H_
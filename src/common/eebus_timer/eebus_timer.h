@@ -22,6 +22,7 @@
 #define SRC_COMMON_EEBUS_TIMER_EEBUS_TIMER_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "src/common/api/eebus_timer_interface.h"
 #include "src/common/eebus_malloc.h"
@@ -32,6 +33,12 @@ extern "C" {
 
 EebusTimerObject* EebusTimerCreate(EebusTimerTimeoutCallback cb, void* ctx);
 
+/**
+ * @brief Get the monotonic time, not affected by the system clock adjustments
+ * @return Time in ms elapsed since an unspecified starting point
+ */
+uint64_t EebusTimerGetMonotonicTimeMs(void);
+
 static inline void EebusTimerDelete(EebusTimerObject* eebus_timer) {
   if (eebus_timer != NULL) {
     EEBUS_TIMER_DESTRUCT(eebus_timer);
@@ -21,6 +21,7 @@
 #include <stdbool.h>
 
 #include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "freertos/timers.h"
 
 #include "src/common/api/eebus_timer_interface.h"
@@ -149,3 +150,12 @@ EebusTimerState GetTimerState(const EebusTimerObject* self) {
   EebusTimer* const eebus_timer = EEBUS_TIMER(self);
   return eebus_timer->timer_state;
 }
+
+uint64_t EebusTimerGetMonotonicTimeMs(void) {
+  // The tick counter wraps around, the time out state keeps the overflows count as well
+  TimeOut_t time_out;
+  vTaskSetTimeOutState(&time_out);
+
+  const uint64_t ticks = ((uint64_t)time_out.xOverflowCount << (sizeof(TickType_t) * 8)) + time_out.xTimeOnEntering;
+  return ticks * portTICK_PERIOD_MS;
+}
@@ -262,4 +262,11 @@ EebusTimerState GetTimerState(const EebusTimerObject* self) {
   return eebus_timer->timer_state;
 }
 
+uint64_t EebusTimerGetMonotonicTimeMs(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+}
+
 #endif  // __linux__
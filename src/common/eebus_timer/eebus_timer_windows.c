@@ -176,4 +176,6 @@ EebusTimerState GetTimerState(const EebusTimerObject* self) {
   return eebus_timer->timer_state;
 }
 
+uint64_t EebusTimerGetMonotonicTimeMs(void) { return (uint64_t)GetTickCount64(); }
+
 #endif  // _WIN32
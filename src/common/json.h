@@ -23,6 +23,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -55,6 +56,79 @@ JsonObject* JsonParseWithLength(const char* s, size_t len);
 char* JsonPrintUnformatted(const JsonObject* json_obj);
 void JsonDelete(JsonObject* json_obj);
 
+/**
+ * @brief Get the first item of Json array or object.
+ * Iterating the items with JsonGetNext() avoids the per index lookup of JsonGetArrayItem()
+ * @param json_obj Json array or object
+ * @return First item, NULL if @p json_obj has no items
+ */
+const JsonObject* JsonGetChild(const JsonObject* json_obj);
+
+/**
+ * @brief Get the next item of the same Json array or object
+ * @param json_item Json array or object item
+ * @return Next item, NULL if @p json_item is the last one
+ */
+const JsonObject* JsonGetNext(const JsonObject* json_item);
+
+/**
+ * @brief Get the name of Json object item
+ * @param json_item Json object item
+ * @return Item name, NULL for the array items
+ */
+const char* JsonGetName(const JsonObject* json_item);
+
+/**
+ * @brief Get the Json number as unsigned integer.
+ * The integers beyond the double precision are taken from the exact decimal text.
+ * A fractional number is rejected rather than truncated, so the message holding it fails to parse
+ * @param json_obj Json number
+ * @param value Integer value
+ * @return true on success, false if @p json_obj is not an integer number within the uint64_t range
+ */
+bool JsonGetUint64(const JsonObject* json_obj, uint64_t* value);
+
+/**
+ * @brief Get the Json number as signed integer.
+ * A fractional number is rejected rather than truncated, so the message holding it fails to parse
+ * @param json_obj Json number
+ * @param value Integer value
+ * @return true on success, false if @p json_obj is not an integer number within the int64_t range
+ */
+bool JsonGetInt64(const JsonObject* json_obj, int64_t* value);
+
+/**
+ * @brief Create the Json number printed as exact decimal integer, without the double conversion
+ * @param value Integer value
+ * @return Json number, NULL on failure
+ */
+JsonObject* JsonCreateUint64(uint64_t value);
+
+/**
+ * @brief Create the Json number printed as exact decimal integer, without the double conversion
+ * @param value Integer value
+ * @return Json number, NULL on failure
+ */
+JsonObject* JsonCreateInt64(int64_t value);
+
+/**
+ * @brief Parse the CBOR (RFC 8949) encoded Json data model
+ * @param buf Buffer holding exactly one CBOR data item
+ * @param buf_size Size of @p buf
+ * @return Json object on success, NULL if @p buf is malformed or uses
+ * the CBOR features beyond the Json data model (e.g. byte strings, tags)
+ */
+JsonObject* JsonParseCbor(const uint8_t* buf, size_t buf_size);
+
+/**
+ * @brief Encode the Json object with CBOR (RFC 8949).
+ * Integral numbers are encoded as integers, the rest as double precision floats
+ * @param json_obj Json object to be encoded
+ * @param size Size of the returned buffer
+ * @return CBOR encoded buffer to be deallocated with JsonFree(), NULL on failure
+ */
+uint8_t* JsonPrintCbor(const JsonObject* json_obj, size_t* size);
+
 /**
  * @brief Free the json allocated data
  * @param p pointer to data to be deallocated
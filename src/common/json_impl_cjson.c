@@ -20,12 +20,68 @@
 #else
 #include <cjson/cJSON.h>
 #endif  // __freertos__
+#include <limits.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/common/cbor.h"
 
 struct JsonObject {
   cJSON impl;
 };
 
+typedef struct JsonNumberScanner JsonNumberScanner;
+
+struct JsonNumberScanner {
+  const char* p;
+  const char* end;
+};
+
+typedef struct JsonCborWriter JsonCborWriter;
+
+struct JsonCborWriter {
+  /** Output buffer, NULL while counting the encoded size */
+  uint8_t* buf;
+  size_t len;
+};
+
+typedef struct JsonCborReader JsonCborReader;
+
+struct JsonCborReader {
+  const uint8_t* buf;
+  size_t buf_size;
+  size_t pos;
+};
+
+/** Nesting limit protecting the stack from malicious CBOR input */
+static const size_t kJsonCborMaxDepth = 64;
+
+/** Doubles hold every integer up to 2^53 exactly, the wider ones are kept as decimal text */
+static const double kJsonExactIntegerMax = 9007199254740992.0;
+
+/** Size of the decimal text buffer fitting INT64_MIN and UINT64_MAX with the terminating null */
+#define JSON_INTEGER_TEXT_SIZE 21
+
+static size_t JsonUint64ToText(uint64_t value, char* buf);
+static size_t JsonInt64ToText(int64_t value, char* buf);
+static bool JsonTextToUint64(const char* s, uint64_t* value);
+static bool JsonTextToInt64(const char* s, int64_t* value);
+static bool JsonIsInexactInteger(double num);
+static bool JsonHasInexactInteger(const cJSON* item);
+static bool JsonScanNextNumber(JsonNumberScanner* scanner, const char** token, size_t* token_len);
+static bool JsonRestoreIntegers(cJSON* item, JsonNumberScanner* scanner);
+static cJSON* JsonParseExact(const char* s, size_t len);
+static void JsonCborWriteBytes(JsonCborWriter* writer, const void* data, size_t size);
+static void JsonCborWriteHead(JsonCborWriter* writer, uint8_t major_type, uint64_t value);
+static void JsonCborWriteText(JsonCborWriter* writer, const char* s);
+static void JsonCborWriteNumber(JsonCborWriter* writer, double num);
+static bool JsonCborWriteItem(JsonCborWriter* writer, const cJSON* item, size_t depth);
+static char* JsonCborReadText(JsonCborReader* reader);
+static cJSON* JsonCborReadSimple(uint8_t additional_info, uint64_t value);
+static cJSON* JsonCborReadItem(JsonCborReader* reader, size_t depth);
+
 JsonObject* JsonCreateObject(void) { return (JsonObject*)cJSON_CreateObject(); }
 
 const JsonObject* JsonGetItem(const JsonObject* json_obj, const char* name, bool is_root) {
@@ -100,12 +156,78 @@ bool JsonAddItem(JsonObject* json_obj, const char* name, JsonObject* json_item,
   }
 }
 
-bool JsonIsNumber(const JsonObject* json_obj) { return cJSON_IsNumber((const cJSON*)json_obj); }
+// Raw items are only created by this layer, they hold the exact decimal text of wide integers
+bool JsonIsNumber(const JsonObject* json_obj) {
+  return cJSON_IsNumber((const cJSON*)json_obj) || cJSON_IsRaw((const cJSON*)json_obj);
+}
 
-double JsonGetNumber(const JsonObject* json_obj) { return cJSON_GetNumberValue((const cJSON*)json_obj); }
+double JsonGetNumber(const JsonObject* json_obj) {
+  const cJSON* const item = (const cJSON*)json_obj;
+  return cJSON_IsRaw(item) ? strtod(item->valuestring, NULL) : cJSON_GetNumberValue(item);
+}
 
 JsonObject* JsonCreateNumber(double num) { return (JsonObject*)cJSON_CreateNumber(num); }
 
+bool JsonGetUint64(const JsonObject* json_obj, uint64_t* value) {
+  const cJSON* const item = (const cJSON*)json_obj;
+  if (cJSON_IsRaw(item)) {
+    return JsonTextToUint64(item->valuestring, value);
+  }
+
+  if (!cJSON_IsNumber(item)) {
+    return false;
+  }
+
+  // NaN fails the range check, the fractional values fail the round trip
+  const double num = item->valuedouble;
+  if (!((num >= 0.0) && (num < 18446744073709551616.0)) || ((double)(uint64_t)num != num)) {
+    return false;
+  }
+
+  *value = (uint64_t)num;
+  return true;
+}
+
+bool JsonGetInt64(const JsonObject* json_obj, int64_t* value) {
+  const cJSON* const item = (const cJSON*)json_obj;
+  if (cJSON_IsRaw(item)) {
+    return JsonTextToInt64(item->valuestring, value);
+  }
+
+  if (!cJSON_IsNumber(item)) {
+    return false;
+  }
+
+  const double num = item->valuedouble;
+  if (!((num >= -9223372036854775808.0) && (num < 9223372036854775808.0)) || ((double)(int64_t)num != num)) {
+    return false;
+  }
+
+  *value = (int64_t)num;
+  return true;
+}
+
+JsonObject* JsonCreateUint64(uint64_t value) {
+  // cJSON prints the int range with "%d", the wider values would go through the float formatting
+  if (value <= INT_MAX) {
+    return (JsonObject*)cJSON_CreateNumber((double)value);
+  }
+
+  char buf[JSON_INTEGER_TEXT_SIZE];
+  JsonUint64ToText(value, buf);
+  return (JsonObject*)cJSON_CreateRaw(buf);
+}
+
+JsonObject* JsonCreateInt64(int64_t value) {
+  if ((value >= INT_MIN) && (value <= INT_MAX)) {
+    return (JsonObject*)cJSON_CreateNumber((double)value);
+  }
+
+  char buf[JSON_INTEGER_TEXT_SIZE];
+  JsonInt64ToText(value, buf);
+  return (JsonObject*)cJSON_CreateRaw(buf);
+}
+
 bool JsonIsString(const JsonObject* json_object) { return cJSON_IsString((const cJSON*)json_object); }
 
 const char* JsonGetString(const JsonObject* json_object) { return cJSON_GetStringValue((const cJSON*)json_object); }
@@ -132,14 +254,490 @@ bool JsonGetBool(const JsonObject* json_obj) { return cJSON_IsTrue((const cJSON*
 
 JsonObject* JsonCreateBool(bool b) { return (JsonObject*)cJSON_CreateBool(b); }
 
-JsonObject* JsonParse(const char* s) { return (JsonObject*)cJSON_Parse(s); }
+JsonObject* JsonParse(const char* s) { return (s != NULL) ? (JsonObject*)JsonParseExact(s, strlen(s)) : NULL; }
 
-JsonObject* JsonParseWithLength(const char* s, size_t len) {
-  return (JsonObject*)cJSON_ParseWithLength(s, len);
-}
+JsonObject* JsonParseWithLength(const char* s, size_t len) { return (JsonObject*)JsonParseExact(s, len); }
 
 char* JsonPrintUnformatted(const JsonObject* json_obj) { return cJSON_PrintUnformatted((const cJSON*)json_obj); }
 
 void JsonDelete(JsonObject* json_obj) { cJSON_Delete((cJSON*)json_obj); }
 
+const JsonObject* JsonGetChild(const JsonObject* json_obj) {
+  return (json_obj != NULL) ? (const JsonObject*)((const cJSON*)json_obj)->child : NULL;
+}
+
+const JsonObject* JsonGetNext(const JsonObject* json_item) {
+  return (json_item != NULL) ? (const JsonObject*)((const cJSON*)json_item)->next : NULL;
+}
+
+const char* JsonGetName(const JsonObject* json_item) {
+  return (json_item != NULL) ? ((const cJSON*)json_item)->string : NULL;
+}
+
 void JsonFree(void* p) { cJSON_free(p); }
+
+size_t JsonUint64ToText(uint64_t value, char* buf) {
+  static const char kDigitPairs[] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                                    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                                    "8081828384858687888990919293949596979899";
+
+  // Fill the digits from the end, two at once
+  char tmp[JSON_INTEGER_TEXT_SIZE];
+  char* p = tmp + sizeof(tmp);
+  while (value >= 100) {
+    const size_t pair = (size_t)(value % 100) * 2;
+    value /= 100;
+    *--p = kDigitPairs[pair + 1];
+    *--p = kDigitPairs[pair];
+  }
+
+  if (value >= 10) {
+    *--p = kDigitPairs[value * 2 + 1];
+    *--p = kDigitPairs[value * 2];
+  } else {
+    *--p = (char)('0' + value);
+  }
+
+  const size_t len = (size_t)(tmp + sizeof(tmp) - p);
+  memcpy(buf, p, len);
+  buf[len] = '\0';
+  return len;
+}
+
+size_t JsonInt64ToText(int64_t value, char* buf) {
+  if (value >= 0) {
+    return JsonUint64ToText((uint64_t)value, buf);
+  }
+
+  // Negate in the unsigned domain, so that INT64_MIN does not overflow
+  buf[0] = '-';
+  return 1 + JsonUint64ToText(0 - (uint64_t)value, buf + 1);
+}
+
+bool JsonTextToUint64(const char* s, uint64_t* value) {
+  if ((*s < '0') || (*s > '9')) {
+    return false;
+  }
+
+  uint64_t result = 0;
+  for (; (*s >= '0') && (*s <= '9'); ++s) {
+    const uint64_t digit = (uint64_t)(*s - '0');
+    if (result > (UINT64_MAX - digit) / 10) {
+      return false;
+    }
+
+    result = result * 10 + digit;
+  }
+
+  if (*s != '\0') {
+    return false;
+  }
+
+  *value = result;
+  return true;
+}
+
+bool JsonTextToInt64(const char* s, int64_t* value) {
+  const bool is_negative = (*s == '-');
+
+  uint64_t magnitude = 0;
+  if (!JsonTextToUint64(is_negative ? s + 1 : s, &magnitude)) {
+    return false;
+  }
+
+  if (is_negative) {
+    if (magnitude > (uint64_t)INT64_MAX + 1) {
+      return false;
+    }
+
+    *value = (magnitude == (uint64_t)INT64_MAX + 1) ? INT64_MIN : -(int64_t)magnitude;
+  } else {
+    if (magnitude > (uint64_t)INT64_MAX) {
+      return false;
+    }
+
+    *value = (int64_t)magnitude;
+  }
+
+  return true;
+}
+
+bool JsonIsInexactInteger(double num) { return (num >= kJsonExactIntegerMax) || (num <= -kJsonExactIntegerMax); }
+
+bool JsonHasInexactInteger(const cJSON* item) {
+  if (cJSON_IsNumber(item)) {
+    return JsonIsInexactInteger(item->valuedouble);
+  }
+
+  const cJSON* child = NULL;
+  cJSON_ArrayForEach(child, item) {
+    if (JsonHasInexactInteger(child)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool JsonScanNextNumber(JsonNumberScanner* scanner, const char** token, size_t* token_len) {
+  const char* p = scanner->p;
+  while (p < scanner->end) {
+    if (*p == '"') {
+      // Skip the string (object keys included), these are the only places digits may occur in besides numbers
+      for (++p; (p < scanner->end) && (*p != '"'); ++p) {
+        if (*p == '\\') {
+          ++p;
+        }
+      }
+
+      ++p;
+    } else if ((*p == '-') || ((*p >= '0') && (*p <= '9'))) {
+      const char* const start = p;
+      while ((p < scanner->end) && (strchr("0123456789+-.eE", *p) != NULL) && (*p != '\0')) {
+        ++p;
+      }
+
+      *token     = start;
+      *token_len = (size_t)(p - start);
+      scanner->p = p;
+      return true;
+    } else {
+      ++p;
+    }
+  }
+
+  scanner->p = p;
+  return false;
+}
+
+bool JsonRestoreIntegers(cJSON* item, JsonNumberScanner* scanner) {
+  if (cJSON_IsNumber(item)) {
+    const char* token = NULL;
+    size_t token_len  = 0;
+    if (!JsonScanNextNumber(scanner, &token, &token_len)) {
+      return false;
+    }
+
+    if (!JsonIsInexactInteger(item->valuedouble) || (token_len >= JSON_INTEGER_TEXT_SIZE)) {
+      return true;
+    }
+
+    for (size_t i = 0; i < token_len; ++i) {
+      if ((token[i] == '.') || (token[i] == 'e') || (token[i] == 'E')) {
+        // Not an integer, the double is as good as it gets
+        return true;
+      }
+    }
+
+    char* const s = (char*)cJSON_malloc(token_len + 1);
+    if (s == NULL) {
+      return false;
+    }
+
+    memcpy(s, token, token_len);
+    s[token_len] = '\0';
+
+    int64_t i     = 0;
+    uint64_t u    = 0;
+    const bool ok = (*s == '-') ? JsonTextToInt64(s, &i) : JsonTextToUint64(s, &u);
+    if (!ok) {
+      // Out of the 64-bit range, the double is the best possible value then
+      cJSON_free(s);
+      return true;
+    }
+
+    item->type        = (item->type & ~0xFF) | cJSON_Raw;
+    item->valuestring = s;
+    return true;
+  }
+
+  cJSON* child = NULL;
+  cJSON_ArrayForEach(child, item) {
+    if (!JsonRestoreIntegers(child, scanner)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+cJSON* JsonParseExact(const char* s, size_t len) {
+  cJSON* const json_root = cJSON_ParseWithLength(s, len);
+  if ((json_root == NULL) || !JsonHasInexactInteger(json_root)) {
+    return json_root;
+  }
+
+  // cJSON converts every number with strtod, replacing its number parser is out of scope.
+  // Rare case: the integers beyond 2^53 lost precision with the double conversion.
+  // The number tokens follow in the text in the same order as the number items in the tree,
+  // so the exact decimal text of these is picked up with one more pass over the text
+  JsonNumberScanner scanner = {.p = s, .end = s + len};
+  if (!JsonRestoreIntegers(json_root, &scanner)) {
+    cJSON_Delete(json_root);
+    return NULL;
+  }
+
+  return json_root;
+}
+
+void JsonCborWriteBytes(JsonCborWriter* writer, const void* data, size_t size) {
+  if (writer->buf != NULL) {
+    memcpy(writer->buf + writer->len, data, size);
+  }
+
+  writer->len += size;
+}
+
+void JsonCborWriteHead(JsonCborWriter* writer, uint8_t major_type, uint64_t value) {
+  uint8_t head[CBOR_HEAD_MAX_SIZE];
+
+  const size_t head_size = CborEncodeHead(head, major_type, value);
+  JsonCborWriteBytes(writer, head, head_size);
+}
+
+void JsonCborWriteText(JsonCborWriter* writer, const char* s) {
+  const size_t len = strlen(s);
+
+  JsonCborWriteHead(writer, CBOR_MAJOR_TYPE_TEXT, len);
+  JsonCborWriteBytes(writer, s, len);
+}
+
+void JsonCborWriteNumber(JsonCborWriter* writer, double num) {
+  // Integers within the range a double holds exactly take the short integer form,
+  // NaN fails both of the comparisons and goes the float way
+  if ((num >= -9007199254740992.0) && (num <= 9007199254740992.0) && ((double)(int64_t)num == num)) {
+    const int64_t i = (int64_t)num;
+    if (i >= 0) {
+      JsonCborWriteHead(writer, CBOR_MAJOR_TYPE_UINT, (uint64_t)i);
+    } else {
+      JsonCborWriteHead(writer, CBOR_MAJOR_TYPE_NEGINT, (uint64_t)(-1 - i));
+    }
+
+    return;
+  }
+
+  uint64_t bits = 0;
+  memcpy(&bits, &num, sizeof(bits));
+
+  uint8_t float_buf[1 + sizeof(bits)];
+  float_buf[0] = (uint8_t)((CBOR_MAJOR_TYPE_SIMPLE << 5) | CBOR_SIMPLE_FLOAT64);
+  for (size_t i = 0; i < sizeof(bits); ++i) {
+    float_buf[1 + i] = (uint8_t)(bits >> (8 * (sizeof(bits) - 1 - i)));
+  }
+
+  JsonCborWriteBytes(writer, float_buf, sizeof(float_buf));
+}
+
+bool JsonCborWriteItem(JsonCborWriter* writer, const cJSON* item, size_t depth) {
+  if (depth > kJsonCborMaxDepth) {
+    return false;
+  }
+
+  if (cJSON_IsNumber(item)) {
+    JsonCborWriteNumber(writer, cJSON_GetNumberValue(item));
+  } else if (cJSON_IsRaw(item)) {
+    int64_t i  = 0;
+    uint64_t u = 0;
+    if (JsonTextToUint64(item->valuestring, &u)) {
+      JsonCborWriteHead(writer, CBOR_MAJOR_TYPE_UINT, u);
+    } else if (JsonTextToInt64(item->valuestring, &i) && (i < 0)) {
+      JsonCborWriteHead(writer, CBOR_MAJOR_TYPE_NEGINT, (uint64_t)(-1 - i));
+    } else {
+      return false;
+    }
+  } else if (cJSON_IsString(item)) {
+    JsonCborWriteText(writer, cJSON_GetStringValue(item));
+  } else if (cJSON_IsBool(item)) {
+    JsonCborWriteHead(writer, CBOR_MAJOR_TYPE_SIMPLE, cJSON_IsTrue(item) ? CBOR_SIMPLE_TRUE : CBOR_SIMPLE_FALSE);
+  } else if (cJSON_IsNull(item)) {
+    JsonCborWriteHead(writer, CBOR_MAJOR_TYPE_SIMPLE, CBOR_SIMPLE_NULL);
+  } else if (cJSON_IsArray(item) || cJSON_IsObject(item)) {
+    const bool is_object     = cJSON_IsObject(item);
+    const uint8_t major_type = is_object ? CBOR_MAJOR_TYPE_MAP : CBOR_MAJOR_TYPE_ARRAY;
+    JsonCborWriteHead(writer, major_type, (uint64_t)cJSON_GetArraySize(item));
+
+    const cJSON* child = NULL;
+    cJSON_ArrayForEach(child, item) {
+      if (is_object) {
+        if (child->string == NULL) {
+          return false;
+        }
+
+        JsonCborWriteText(writer, child->string);
+      }
+
+      if (!JsonCborWriteItem(writer, child, depth + 1)) {
+        return false;
+      }
+    }
+  } else {
+    return false;
+  }
+
+  return true;
+}
+
+uint8_t* JsonPrintCbor(const JsonObject* json_obj, size_t* size) {
+  if ((json_obj == NULL) || (size == NULL)) {
+    return NULL;
+  }
+
+  // Count the encoded size first to allocate the buffer exactly once
+  JsonCborWriter writer = {.buf = NULL, .len = 0};
+  if (!JsonCborWriteItem(&writer, (const cJSON*)json_obj, 0)) {
+    return NULL;
+  }
+
+  uint8_t* const buf = (uint8_t*)cJSON_malloc(writer.len);
+  if (buf == NULL) {
+    return NULL;
+  }
+
+  writer = (JsonCborWriter){.buf = buf, .len = 0};
+  JsonCborWriteItem(&writer, (const cJSON*)json_obj, 0);
+
+  *size = writer.len;
+  return buf;
+}
+
+char* JsonCborReadText(JsonCborReader* reader) {
+  uint8_t major_type      = 0;
+  uint8_t additional_info = 0;
+  uint64_t len            = 0;
+
+  const size_t head_size = CborDecodeHead(
+      reader->buf + reader->pos, reader->buf_size - reader->pos, &major_type, &additional_info, &len);
+  if ((head_size == 0) || (major_type != CBOR_MAJOR_TYPE_TEXT)) {
+    return NULL;
+  }
+
+  reader->pos += head_size;
+  if (len > reader->buf_size - reader->pos) {
+    return NULL;
+  }
+
+  char* const s = (char*)cJSON_malloc((size_t)len + 1);
+  if (s == NULL) {
+    return NULL;
+  }
+
+  memcpy(s, reader->buf + reader->pos, (size_t)len);
+  s[(size_t)len] = '\0';
+  reader->pos += (size_t)len;
+  return s;
+}
+
+cJSON* JsonCborReadSimple(uint8_t additional_info, uint64_t value) {
+  if (additional_info == CBOR_SIMPLE_FLOAT64) {
+    double num = 0;
+    memcpy(&num, &value, sizeof(num));
+    return cJSON_CreateNumber(num);
+  } else if (additional_info == CBOR_SIMPLE_FLOAT32) {
+    const uint32_t bits = (uint32_t)value;
+
+    float num = 0;
+    memcpy(&num, &bits, sizeof(num));
+    return cJSON_CreateNumber(num);
+  } else if (value == CBOR_SIMPLE_FALSE) {
+    return cJSON_CreateBool(false);
+  } else if (value == CBOR_SIMPLE_TRUE) {
+    return cJSON_CreateBool(true);
+  } else if (value == CBOR_SIMPLE_NULL) {
+    return cJSON_CreateNull();
+  } else {
+    return NULL;
+  }
+}
+
+cJSON* JsonCborReadItem(JsonCborReader* reader, size_t depth) {
+  if ((depth > kJsonCborMaxDepth) || (reader->pos >= reader->buf_size)) {
+    return NULL;
+  }
+
+  // Text is read with the head, so that it is not decoded twice
+  if ((reader->buf[reader->pos] >> 5) == CBOR_MAJOR_TYPE_TEXT) {
+    char* const s     = JsonCborReadText(reader);
+    cJSON* const item = (s != NULL) ? cJSON_CreateString(s) : NULL;
+    cJSON_free(s);
+    return item;
+  }
+
+  uint8_t major_type      = 0;
+  uint8_t additional_info = 0;
+  uint64_t value          = 0;
+
+  const size_t head_size = CborDecodeHead(
+      reader->buf + reader->pos, reader->buf_size - reader->pos, &major_type, &additional_info, &value);
+  if (head_size == 0) {
+    return NULL;
+  }
+
+  reader->pos += head_size;
+
+  const size_t remaining = reader->buf_size - reader->pos;
+  switch (major_type) {
+    case CBOR_MAJOR_TYPE_UINT: return (cJSON*)JsonCreateUint64(value);
+    case CBOR_MAJOR_TYPE_NEGINT:
+      // Values below INT64_MIN are beyond the data model, the double is the best fit for these
+      return (value <= (uint64_t)INT64_MAX) ? (cJSON*)JsonCreateInt64(-1 - (int64_t)value)
+                                            : cJSON_CreateNumber(-1.0 - (double)value);
+    case CBOR_MAJOR_TYPE_SIMPLE: return JsonCborReadSimple(additional_info, value);
+    case CBOR_MAJOR_TYPE_ARRAY: {
+      // Every item takes one byte at least, this rejects the bogus lengths early
+      if (value > remaining) {
+        return NULL;
+      }
+
+      cJSON* const array = cJSON_CreateArray();
+      for (uint64_t i = 0; (array != NULL) && (i < value); ++i) {
+        cJSON* const item = JsonCborReadItem(reader, depth + 1);
+        if ((item == NULL) || !cJSON_AddItemToArray(array, item)) {
+          cJSON_Delete(item);
+          cJSON_Delete(array);
+          return NULL;
+        }
+      }
+
+      return array;
+    }
+    case CBOR_MAJOR_TYPE_MAP: {
+      if (value > remaining / 2) {
+        return NULL;
+      }
+
+      cJSON* const object = cJSON_CreateObject();
+      for (uint64_t i = 0; (object != NULL) && (i < value); ++i) {
+        char* const key   = JsonCborReadText(reader);
+        cJSON* const item = (key != NULL) ? JsonCborReadItem(reader, depth + 1) : NULL;
+        if ((item == NULL) || !cJSON_AddItemToObject(object, key, item)) {
+          cJSON_free(key);
+          cJSON_Delete(item);
+          cJSON_Delete(object);
+          return NULL;
+        }
+
+        cJSON_free(key);
+      }
+
+      return object;
+    }
+    default: return NULL;
+  }
+}
+
+JsonObject* JsonParseCbor(const uint8_t* buf, size_t buf_size) {
+  if ((buf == NULL) || (buf_size == 0)) {
+    return NULL;
+  }
+
+  JsonCborReader reader = {.buf = buf, .buf_size = buf_size, .pos = 0};
+
+  cJSON* const json_root = JsonCborReadItem(&reader, 0);
+  if ((json_root != NULL) && (reader.pos != buf_size)) {
+    // Exactly one data item is expected
+    cJSON_Delete(json_root);
+    return NULL;
+  }
+
+  return (JsonObject*)json_root;
+}
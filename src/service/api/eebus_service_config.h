@@ -114,6 +114,20 @@ struct EebusServiceConfig {
    */
   bool register_auto_accept;
 
+  /**
+   * Directory to keep the remote devices topology, use cases and feature descriptions in, optional.
+   * If set, the remote device model known from the previous connection is restored on reconnection
+   * without waiting for the detailed discovery, use case and description replies
+   */
+  const char* remote_device_cache_dir;
+
+  /**
+   * Whether mDNS shall not be used, optional.
+   * If enabled, the service is not announced and no remote services are browsed,
+   * the remote services known in advance are added with EEBUS_SERVICE_ADD_REMOTE_SERVICE()
+   */
+  bool mdns_disabled;
+
   /**
    * Generated identifier. Format: brand-model-serial_number.
    * Can be used for both SHIP Id and mDNS service name if corresponding alternate
@@ -193,6 +207,23 @@ static inline void EebusServiceConfigSetRegisterAutoAccept(EebusServiceConfig* c
   cfg->register_auto_accept = auto_accept;
 }
 
+static inline const char* EebusServiceConfigGetRemoteDeviceCacheDir(const EebusServiceConfig* cfg) {
+  return cfg->remote_device_cache_dir;
+}
+
+static inline bool EebusServiceConfigGetMdnsDisabled(const EebusServiceConfig* cfg) {
+  return cfg->mdns_disabled;
+}
+
+static inline void EebusServiceConfigSetMdnsDisabled(EebusServiceConfig* cfg, bool mdns_disabled) {
+  cfg->mdns_disabled = mdns_disabled;
+}
+
+static inline void EebusServiceConfigSetRemoteDeviceCacheDir(EebusServiceConfig* cfg, const char* dir) {
+  StringDelete((char*)cfg->remote_device_cache_dir);
+  cfg->remote_device_cache_dir = StringCopy(dir);
+}
+
 /**
  * @brief Get the SHIP ID
  * Return the first valid identifier found in order:
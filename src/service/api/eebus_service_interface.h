@@ -23,6 +23,7 @@
 
 #include "src/common/service_details.h"
 #include "src/service/api/eebus_service_config.h"
+#include "src/ship/api/mdns_entry.h"
 #include "src/ship/api/ship_node_reader_interface.h"
 #include "src/spine/api/device_local_interface.h"
 
@@ -61,6 +62,8 @@ struct EebusServiceInterface {
   void (*cancel_pairing_with_ski)(EebusServiceObject* self, const char* ski);
   void (*set_pairing_possible)(EebusServiceObject* self, bool is_pairing_possible);
   const char* (*get_local_ski)(EebusServiceObject* self);
+  void (*add_remote_service)(EebusServiceObject* self, const MdnsEntry* entry);
+  void (*set_cbor_enabled_for_ski)(EebusServiceObject* self, const char* ski, bool enable);
 };
 
 /**
@@ -140,6 +143,21 @@ struct EebusServiceObject {
  */
 #define EEBUS_SERVICE_GET_LOCAL_SKI(obj) (EEBUS_SERVICE_INTERFACE(obj)->get_local_ski(obj))
 
+/**
+ * @brief EEBUS Service Add Remote Service caller definition.
+ * Adds the remote service with the address known in advance (host, port, path and SKI),
+ * e.g. when running without mDNS (see EebusServiceConfigSetMdnsDisabled())
+ */
+#define EEBUS_SERVICE_ADD_REMOTE_SERVICE(obj, entry) (EEBUS_SERVICE_INTERFACE(obj)->add_remote_service(obj, entry))
+
+/**
+ * @brief EEBUS Service Set CBOR Enabled For Ski caller definition.
+ * Opts the remote service in the "openeebus-CBOR" encoding of SPINE datagrams offered on the SHIP protocol
+ * handshake. Both peers have to opt in each other, the remote services are JSON only by default
+ */
+#define EEBUS_SERVICE_SET_CBOR_ENABLED_FOR_SKI(obj, ski, enable) \
+  (EEBUS_SERVICE_INTERFACE(obj)->set_cbor_enabled_for_ski(obj, ski, enable))
+
 #ifdef __cplusplus
 }
 #endif  // __cplusplus
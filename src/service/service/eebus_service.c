@@ -28,6 +28,7 @@
 #include "src/ship/tls_certificate/tls_certificate.h"
 #include "src/spine/api/device_local_interface.h"
 #include "src/spine/device/device_local.h"
+#include "src/spine/device/remote_device_cache.h"
 #include "src/spine/entity/entity_local.h"
 
 typedef struct EebusService EebusService;
@@ -66,6 +67,8 @@ static void UnregisterRemoteSki(EebusServiceObject* self, const char* ski);
 static void CancelPairingWithSki(EebusServiceObject* self, const char* ski);
 static void SetPairingPossible(EebusServiceObject* self, bool is_pairing_possible);
 static const char* GetLocalSki(EebusServiceObject* self);
+static void AddRemoteService(EebusServiceObject* self, const MdnsEntry* entry);
+static void SetCborEnabledForSki(EebusServiceObject* self, const char* ski, bool enable);
 
 static const EebusServiceInterface service_methods = {
     .ship_node_reader_interface = {
@@ -90,6 +93,8 @@ static const EebusServiceInterface service_methods = {
     .cancel_pairing_with_ski             = CancelPairingWithSki,
     .set_pairing_possible                = SetPairingPossible,
     .get_local_ski                       = GetLocalSki,
+    .add_remote_service                  = AddRemoteService,
+    .set_cbor_enabled_for_ski            = SetCborEnabledForSki,
 };
 
 static EebusError ServiceConstruct(
@@ -145,7 +150,18 @@ EebusError ServiceConstruct(
     return kEebusErrorInit;
   }
 
-  const char* const service_name = EebusServiceConfigGetMdnsServiceName(cfg);
+  const char* const cache_dir = EebusServiceConfigGetRemoteDeviceCacheDir(cfg);
+  if (!StringIsEmpty(cache_dir)) {
+    RemoteDeviceCacheObject* const cache = RemoteDeviceCacheCreate(cache_dir);
+    if (cache == NULL) {
+      return kEebusErrorInit;
+    }
+
+    DEVICE_LOCAL_SET_REMOTE_DEVICE_CACHE(self->spine_local_device, cache);
+  }
+
+  const char* const service_name
+      = EebusServiceConfigGetMdnsDisabled(cfg) ? NULL : EebusServiceConfigGetMdnsServiceName(cfg);
   const int32_t port             = EebusServiceConfigGetPort(cfg);
 
   self->tls_certificate = tls_certificate;
@@ -299,3 +315,11 @@ const char* GetLocalSki(EebusServiceObject* self) {
   EebusService* const service = EEBUS_SERVICE(self);
   return service->local_service_details->ski;
 }
+
+void AddRemoteService(EebusServiceObject* self, const MdnsEntry* entry) {
+  SHIP_NODE_ADD_REMOTE_SERVICE(EEBUS_SERVICE(self)->ship_node, entry);
+}
+
+void SetCborEnabledForSki(EebusServiceObject* self, const char* ski, bool enable) {
+  SHIP_NODE_SET_CBOR_ENABLED_FOR_SKI(EEBUS_SERVICE(self)->ship_node, ski, enable);
+}
@@ -86,8 +86,10 @@ EebusError EebusServiceConfigConstruct(
 
   cfg->port = (port != 0) ? port : kDefaultPort;
 
-  cfg->register_auto_accept = false;
-  cfg->generated_id         = GenerateIdentifier(cfg);
+  cfg->register_auto_accept    = false;
+  cfg->remote_device_cache_dir = NULL;
+  cfg->mdns_disabled           = false;
+  cfg->generated_id            = GenerateIdentifier(cfg);
   if (cfg->generated_id == NULL) {
     return kEebusErrorMemoryAllocate;
   }
@@ -141,6 +143,9 @@ void EebusServiceConfigDestruct(EebusServiceConfig* cfg) {
   StringDelete((char*)cfg->device_type);
   cfg->device_type = NULL;
 
+  StringDelete((char*)cfg->remote_device_cache_dir);
+  cfg->remote_device_cache_dir = NULL;
+
   StringDelete((char*)cfg->generated_id);
   cfg->generated_id = NULL;
 }
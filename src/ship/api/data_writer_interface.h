@@ -31,6 +31,10 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "src/common/eebus_errors.h"
+#include "src/ship/api/message_priority.h"
+#include "src/ship/model/model.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif  // __cplusplus
@@ -60,8 +64,19 @@ struct DataWriterInterface {
    * connection (the SHIP message includes payload)
    *
    * Transformed from WriteShipMessageWithPayload()
+   *
+   * The call never waits for the write credit, the message is kept in the connection backlog
+   * until the outgoing messages queued before it are drained
+   *
+   * @param priority Priority class the message is written to the websocket with
+   * @return kEebusErrorOk if the message is queued or put into the backlog
+   */
+  EebusError (*write_message)(DataWriterObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority);
+  /**
+   * @brief Get the message protocol format agreed on the SHIP protocol handshake,
+   * the outgoing SPINE messages have to be encoded with
    */
-  void (*write_message)(DataWriterObject* self, const uint8_t* msg, size_t msg_size);
+  MessageProtocolFormatType (*get_format)(const DataWriterObject* self);
 };
 
 /**
@@ -89,7 +104,13 @@ struct DataWriterObject {
 /**
  * @brief Data Writer Write Message caller definition
  */
-#define DATA_WRITER_WRITE_MESSAGE(obj, msg, sz) (DATA_WRITER_INTERFACE(obj)->write_message(obj, msg, sz))
+#define DATA_WRITER_WRITE_MESSAGE(obj, msg, sz, priority) \
+  (DATA_WRITER_INTERFACE(obj)->write_message(obj, msg, sz, priority))
+
+/**
+ * @brief Data Writer Get Format caller definition
+ */
+#define DATA_WRITER_GET_FORMAT(obj) (DATA_WRITER_INTERFACE(obj)->get_format(obj))
 
 #ifdef __cplusplus
 }
@@ -84,6 +84,11 @@ struct InfoProviderInterface {
    * @brief Report an approved handshake by a remote device
    */
   DataReaderObject* (*setup_remote_device)(InfoProviderObject* self, const char* ski, DataWriterObject* data_writer);
+  /**
+   * @brief Check if the CBOR encoding of SPINE datagrams may be negotiated with the SKI,
+   * the peers not opted in use JSON only
+   */
+  bool (*is_cbor_enabled_for_ski)(InfoProviderObject* self, const char* ski);
 };
 
 /**
@@ -144,6 +149,12 @@ struct InfoProviderObject {
 #define INFO_PROVIDER_SETUP_REMOTE_DEVICE(obj, ski, dw) \
   (INFO_PROVIDER_INTERFACE(obj)->setup_remote_device(INFO_PROVIDER_OBJECT(obj), (ski), (dw)))
 
+/**
+ * @brief Info Provider Is CBOR Enabled For SKI caller definition
+ */
+#define INFO_PROVIDER_IS_CBOR_ENABLED_FOR_SKI(obj, ski) \
+  (INFO_PROVIDER_INTERFACE(obj)->is_cbor_enabled_for_ski(INFO_PROVIDER_OBJECT(obj), (ski)))
+
 #ifdef __cplusplus
 }
 #endif  // __cplusplus
@@ -123,6 +123,13 @@ struct MdnsEntry {
 
 MdnsEntry* MdnsEntryCreate(const char* name, const char* domain, uint32_t iface);
 
+/**
+ * @brief Create a deep copy of the mDNS entry
+ * @param entry mDNS entry to be copied
+ * @return mDNS entry copy on success, NULL otherwise
+ */
+MdnsEntry* MdnsEntryCopy(const MdnsEntry* entry);
+
 void MdnsEntryDestruct(MdnsEntry* entry);
 
 static inline void MdnsEntryDelete(MdnsEntry* entry) {
@@ -145,6 +152,12 @@ MdnsEntrySetValue(MdnsEntry* entry, const char* key_ptr, size_t key_size, const
 
 bool MdnsEntryIsValid(const MdnsEntry* entry);
 
+/**
+ * @brief Check whether both of the entries describe the same service the same way,
+ * i.e. service location and SHIP TXT record fields match
+ */
+bool MdnsEntryIsEqual(const MdnsEntry* entry_a, const MdnsEntry* entry_b);
+
 static inline const char* MdnsEntryGetName(const MdnsEntry* entry) { return entry->name; }
 
 static inline const char* MdnsEntryGetHost(const MdnsEntry* entry) { return entry->host; }
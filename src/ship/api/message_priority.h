@@ -0,0 +1,46 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Outgoing message priority classes
+ *
+ * The messages are written to the websocket in the priority order, so that the
+ * latency sensitive ones are not stuck behind large data messages. Only the
+ * messages carrying no state may overtake the others, all the SPINE messages
+ * carrying state share a single class and are written in the order they were sent
+ */
+
+#ifndef SRC_SHIP_API_MESSAGE_PRIORITY_H_
+#define SRC_SHIP_API_MESSAGE_PRIORITY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+enum MessagePriority {
+  kMessagePriorityControl, /**< SHIP control messages: handshake, ping, prolongation, close */
+  kMessagePriorityResult,  /**< SPINE results and heartbeat notifies */
+  kMessagePriorityData,    /**< All the other SPINE messages: reads, replies, writes, notifies and calls */
+  kMessagePriorityNum,     /**< Number of the priority classes */
+};
+
+typedef enum MessagePriority MessagePriority;
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_SHIP_API_MESSAGE_PRIORITY_H_
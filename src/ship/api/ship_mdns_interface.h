@@ -37,12 +37,22 @@ enum MdnsBrowseInterval {
 
 typedef enum MdnsBrowseInterval MdnsBrowseInterval;
 
+enum MdnsEntryChange {
+  kMdnsEntryAdded,    /**< Service has appeared */
+  kMdnsEntryRemoved,  /**< Service has disappeared */
+  kMdnsEntryChanged,  /**< Service has been re-announced with different location or TXT record */
+};
+
+typedef enum MdnsEntryChange MdnsEntryChange;
+
 /**
- * @brief On MDNS entries found callback
+ * @brief On mDNS entry changed callback
  *
- * Callback is used instead of MdnsSearchInterface
+ * Callback is used instead of MdnsSearchInterface. Only the changes of the discovered
+ * services set are reported, the entries are matched by the service name.
+ * The entry is owned by the mDNS instance and is valid within the callback only
  */
-typedef void (*OnMdnsEntriesFoundCallback)(Vector* found_entries, void* context);
+typedef void (*OnMdnsEntryChangedCallback)(const MdnsEntry* entry, MdnsEntryChange change, void* context);
 
 /**
  * @brief SHIP mDNS Interface
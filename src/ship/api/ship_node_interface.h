@@ -30,6 +30,7 @@
 #include "src/common/vector.h"
 #include "src/service/api/service_reader_interface.h"
 #include "src/ship/api/info_provider_interface.h"
+#include "src/ship/api/mdns_entry.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -78,6 +79,16 @@ struct ShipNodeInterface {
    * @brief Transformed from CancelPairingWithSKI()
    */
   void (*cancel_pairing_with_ski)(ShipNodeObject* self, const char* ski);
+  /**
+   * @brief Add the remote service with the address known in advance,
+   * the same as if it was found with mDNS browsing
+   */
+  void (*add_remote_service)(ShipNodeObject* self, const MdnsEntry* entry);
+  /**
+   * @brief Opt the remote service in or out of the CBOR encoding of SPINE datagrams,
+   * the remote services are JSON only by default. Takes effect on the next connection
+   */
+  void (*set_cbor_enabled_for_ski)(ShipNodeObject* self, const char* ski, bool enable);
 };
 
 /**
@@ -123,6 +134,17 @@ struct ShipNodeObject {
  */
 #define SHIP_NODE_CANCEL_PAIRING_WITH_SKI(obj, ski) (SHIP_NODE_INTERFACE(obj)->cancel_pairing_with_ski(obj, ski))
 
+/**
+ * @brief Ship Node Add Remote Service caller definition
+ */
+#define SHIP_NODE_ADD_REMOTE_SERVICE(obj, entry) (SHIP_NODE_INTERFACE(obj)->add_remote_service(obj, entry))
+
+/**
+ * @brief Ship Node Set CBOR Enabled For SKI caller definition
+ */
+#define SHIP_NODE_SET_CBOR_ENABLED_FOR_SKI(obj, ski, enable) \
+  (SHIP_NODE_INTERFACE(obj)->set_cbor_enabled_for_ski(obj, ski, enable))
+
 #ifdef __cplusplus
 }
 #endif  // __cplusplus
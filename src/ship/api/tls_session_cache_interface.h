@@ -0,0 +1,108 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Tls Session Cache interface declarations
+ */
+
+#ifndef SRC_SHIP_API_TLS_SESSION_CACHE_INTERFACE_H_
+#define SRC_SHIP_API_TLS_SESSION_CACHE_INTERFACE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "src/common/eebus_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Tls Session Cache Interface
+ * (Tls Session Cache "virtual functions table" declaration)
+ */
+typedef struct TlsSessionCacheInterface TlsSessionCacheInterface;
+
+/**
+ * @brief Tls Session Cache Object type definition
+ * ("abstract class", has no members but only pointer to
+ * "virtual functions table")
+ */
+typedef struct TlsSessionCacheObject TlsSessionCacheObject;
+
+/**
+ * @brief Tls Session Cache Interface Structure
+ */
+struct TlsSessionCacheInterface {
+  void (*destruct)(TlsSessionCacheObject* self);
+  EebusError (*store)(TlsSessionCacheObject* self, const char* ski, const uint8_t* session, size_t session_size);
+  size_t (*load)(TlsSessionCacheObject* self, const char* ski, uint8_t* buf, size_t buf_size);
+  void (*remove)(TlsSessionCacheObject* self, const char* ski);
+  size_t (*get_size)(const TlsSessionCacheObject* self);
+};
+
+/**
+ * @brief Tls Session Cache Object Structure
+ */
+struct TlsSessionCacheObject {
+  const TlsSessionCacheInterface* interface_;
+};
+
+/**
+ * @brief Tls Session Cache pointer typecast
+ */
+#define TLS_SESSION_CACHE_OBJECT(obj) ((TlsSessionCacheObject*)(obj))
+
+/**
+ * @brief Tls Session Cache Interface class pointer typecast
+ */
+#define TLS_SESSION_CACHE_INTERFACE(obj) (TLS_SESSION_CACHE_OBJECT(obj)->interface_)
+
+/**
+ * @brief Tls Session Cache Destruct caller definition
+ */
+#define TLS_SESSION_CACHE_DESTRUCT(obj) (TLS_SESSION_CACHE_INTERFACE(obj)->destruct(obj))
+
+/**
+ * @brief Tls Session Cache Store caller definition.
+ * Stores a copy of the serialised session of the remote device with the given SKI,
+ * the least recently used session is dropped when the cache is full
+ */
+#define TLS_SESSION_CACHE_STORE(obj, ski, session, session_size) \
+  (TLS_SESSION_CACHE_INTERFACE(obj)->store(obj, ski, session, session_size))
+
+/**
+ * @brief Tls Session Cache Load caller definition.
+ * Returns the size of the session stored for the given SKI or 0 if there is none.
+ * The session is copied to buf only if buf_size is large enough to hold it
+ */
+#define TLS_SESSION_CACHE_LOAD(obj, ski, buf, buf_size) (TLS_SESSION_CACHE_INTERFACE(obj)->load(obj, ski, buf, buf_size))
+
+/**
+ * @brief Tls Session Cache Remove caller definition
+ */
+#define TLS_SESSION_CACHE_REMOVE(obj, ski) (TLS_SESSION_CACHE_INTERFACE(obj)->remove(obj, ski))
+
+/**
+ * @brief Tls Session Cache Get Size caller definition
+ */
+#define TLS_SESSION_CACHE_GET_SIZE(obj) (TLS_SESSION_CACHE_INTERFACE(obj)->get_size(obj))
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_SHIP_API_TLS_SESSION_CACHE_INTERFACE_H_
@@ -32,6 +32,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "src/common/eebus_errors.h"
+#include "src/ship/api/message_priority.h"
 #include "src/ship/model/types.h"
 
 #ifdef __cplusplus
@@ -42,14 +44,18 @@ enum WebsocketCallbackType {
   kWebsocketCallbackTypeError,
   kWebsocketCallbackTypeRead,
   kWebsocketCallbackTypeClose,
+  /** The message passed as the callback data has been written to the socket */
+  kWebsocketCallbackTypeWriteDone,
 };
 
 typedef enum WebsocketCallbackType WebsocketCallbackType;
 
 /**
  * @brief On message read callback type definition
+ * @return kEebusErrorCommunicationBusy if the read message cannot be accepted at the moment,
+ * the websocket then throttles the receiving and passes the message again later
  */
-typedef void (*WebsocketCallback)(WebsocketCallbackType type, const void* in, size_t size, void* ctx);
+typedef EebusError (*WebsocketCallback)(WebsocketCallbackType type, const void* in, size_t size, void* ctx);
 
 /**
  * @brief Websocket Interface
@@ -72,7 +78,7 @@ typedef struct WebsocketObject WebsocketObject;
  */
 struct WebsocketInterface {
   void (*destruct)(WebsocketObject* self);
-  int32_t (*write)(WebsocketObject* self, const uint8_t* msg, size_t msg_size);
+  int32_t (*write)(WebsocketObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority);
   void (*close)(WebsocketObject* self, int32_t close_code, const char* reason);
   bool (*is_closed)(const WebsocketObject* self);
   int32_t (*get_close_error)(const WebsocketObject* self);
@@ -102,9 +108,10 @@ struct WebsocketObject {
 #define WEBSOCKET_DESTRUCT(obj) (WEBSOCKET_INTERFACE(obj)->destruct(obj))
 
 /**
- * @brief Websocket Write caller definition
+ * @brief Websocket Write caller definition.
+ * The queued messages are written out in the priority order
  */
-#define WEBSOCKET_WRITE(obj, msg, msg_size) (WEBSOCKET_INTERFACE(obj)->write(obj, msg, msg_size))
+#define WEBSOCKET_WRITE(obj, msg, msg_size, priority) (WEBSOCKET_INTERFACE(obj)->write(obj, msg, msg_size, priority))
 
 /**
  * @brief Websocket Close caller definition
@@ -75,6 +75,7 @@ typedef struct {
 #define MDNS_ENTRY_MAPPING(key, field) {key, MDNS_ENTRY_FIELD_OFFSET(field)}
 
 static void MdnsEntryConstruct(MdnsEntry* entry, const char* name, const char* domain, uint32_t iface);
+static bool MdnsEntryStringsEqual(const char* a, const char* b);
 
 void MdnsEntryConstruct(MdnsEntry* entry, const char* name, const char* domain, uint32_t iface) {
   // Service location fields
@@ -106,6 +107,31 @@ MdnsEntry* MdnsEntryCreate(const char* name, const char* domain, uint32_t iface)
   return new_entry;
 }
 
+MdnsEntry* MdnsEntryCopy(const MdnsEntry* entry) {
+  if (entry == NULL) {
+    return NULL;
+  }
+
+  MdnsEntry* const copy = MdnsEntryCreate(entry->name, entry->domain, entry->iface);
+  if (copy == NULL) {
+    return NULL;
+  }
+
+  copy->host = StringCopy(entry->host);
+  copy->port = entry->port;
+
+  copy->txtvers = StringCopy(entry->txtvers);
+  copy->id      = StringCopy(entry->id);
+  copy->path    = StringCopy(entry->path);
+  copy->ski     = StringCopy(entry->ski);
+  copy->reg     = StringCopy(entry->reg);
+  copy->brand   = StringCopy(entry->brand);
+  copy->type    = StringCopy(entry->type);
+  copy->model   = StringCopy(entry->model);
+
+  return copy;
+}
+
 void MdnsEntryDestruct(MdnsEntry* entry) {
   // Service location fields
   StringDelete((char*)entry->name);
@@ -239,3 +265,34 @@ bool MdnsEntryIsValid(const MdnsEntry* entry) {
 
   return is_valid;
 }
+
+bool MdnsEntryStringsEqual(const char* a, const char* b) {
+  if ((a == NULL) || (b == NULL)) {
+    return a == b;
+  }
+
+  return strcmp(a, b) == 0;
+}
+
+bool MdnsEntryIsEqual(const MdnsEntry* entry_a, const MdnsEntry* entry_b) {
+  bool is_equal = true;
+
+  // Compare service location
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->name, entry_b->name);
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->host, entry_b->host);
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->domain, entry_b->domain);
+  is_equal = is_equal && (entry_a->port == entry_b->port);
+  is_equal = is_equal && (entry_a->iface == entry_b->iface);
+
+  // Compare SHIP Txt Record fields
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->txtvers, entry_b->txtvers);
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->id, entry_b->id);
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->path, entry_b->path);
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->ski, entry_b->ski);
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->reg, entry_b->reg);
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->brand, entry_b->brand);
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->type, entry_b->type);
+  is_equal = is_equal && MdnsEntryStringsEqual(entry_a->model, entry_b->model);
+
+  return is_equal;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief mDNS entry list implementation
+ */
+
+#include "src/ship/mdns/mdns_entry_list.h"
+
+#include <string.h>
+
+MdnsEntry* MdnsEntryListFind(const Vector* entries, const char* name) {
+  for (size_t i = 0; i < VectorGetSize(entries); ++i) {
+    MdnsEntry* const entry = (MdnsEntry*)VectorGetElement(entries, i);
+    if (strcmp(entry->name, name) == 0) {
+      return entry;
+    }
+  }
+
+  return NULL;
+}
+
+bool MdnsEntryListMerge(Vector* entries, MdnsEntry* entry, MdnsEntryChange* change) {
+  MdnsEntry* const known_entry = MdnsEntryListFind(entries, entry->name);
+  if (known_entry == NULL) {
+    VectorPushBack(entries, entry);
+    *change = kMdnsEntryAdded;
+    return true;
+  }
+
+  if (MdnsEntryIsEqual(known_entry, entry)) {
+    MdnsEntryDelete(entry);
+    return false;
+  }
+
+  VectorRemove(entries, known_entry);
+  MdnsEntryDelete(known_entry);
+  VectorPushBack(entries, entry);
+  *change = kMdnsEntryChanged;
+  return true;
+}
+
+void MdnsEntryListDiff(Vector* known_entries, Vector* new_entries, OnMdnsEntryChangedCallback cb, void* ctx) {
+  for (size_t i = 0; i < VectorGetSize(known_entries); ++i) {
+    const MdnsEntry* const entry = (const MdnsEntry*)VectorGetElement(known_entries, i);
+    if (MdnsEntryListFind(new_entries, entry->name) == NULL) {
+      cb(entry, kMdnsEntryRemoved, ctx);
+    }
+  }
+
+  for (size_t i = 0; i < VectorGetSize(new_entries); ++i) {
+    const MdnsEntry* const entry     = (const MdnsEntry*)VectorGetElement(new_entries, i);
+    const MdnsEntry* const old_entry = MdnsEntryListFind(known_entries, entry->name);
+    if (old_entry == NULL) {
+      cb(entry, kMdnsEntryAdded, ctx);
+    } else if (!MdnsEntryIsEqual(old_entry, entry)) {
+      cb(entry, kMdnsEntryChanged, ctx);
+    }
+  }
+
+  VectorFreeElements(known_entries);
+  VectorMove(known_entries, new_entries);
+}
+
+EebusError MdnsEntryListApplyChange(Vector* entries, const MdnsEntry* entry, MdnsEntryChange change) {
+  MdnsEntry* const known_entry = MdnsEntryListFind(entries, entry->name);
+  if (known_entry != NULL) {
+    VectorRemove(entries, known_entry);
+    MdnsEntryDelete(known_entry);
+  }
+
+  if (change == kMdnsEntryRemoved) {
+    return kEebusErrorOk;
+  }
+
+  MdnsEntry* const entry_copy = MdnsEntryCopy(entry);
+  if (entry_copy == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  VectorPushBack(entries, entry_copy);
+  return kEebusErrorOk;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief mDNS entry list declarations.
+ * Keeps the set of discovered services, the entries are matched by the service name
+ */
+
+#ifndef SRC_SHIP_MDNS_MDNS_ENTRY_LIST_H_
+#define SRC_SHIP_MDNS_MDNS_ENTRY_LIST_H_
+
+#include <stdbool.h>
+
+#include "src/common/eebus_errors.h"
+#include "src/common/vector.h"
+#include "src/ship/api/mdns_entry.h"
+#include "src/ship/api/ship_mdns_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Find the entry with the service name specified
+ * @param entries List of MdnsEntry elements
+ * @param name Service name to look for
+ * @return Entry found or NULL if there is no such entry
+ */
+MdnsEntry* MdnsEntryListFind(const Vector* entries, const char* name);
+
+/**
+ * @brief Merge the resolved entry into the list, the list takes over the entry ownership
+ * @param entries List of MdnsEntry elements
+ * @param entry Resolved entry, released if equal to the one already known
+ * @param change Set to kMdnsEntryAdded or kMdnsEntryChanged if the list has changed
+ * @return true if the list has changed, false otherwise
+ */
+bool MdnsEntryListMerge(Vector* entries, MdnsEntry* entry, MdnsEntryChange* change);
+
+/**
+ * @brief Report the difference between the known and the new entries and replace the known ones with the new.
+ * The removed entries are reported first
+ * @param known_entries List of MdnsEntry elements known so far, receives the new entries
+ * @param new_entries List of MdnsEntry elements found most recently, left empty
+ * @param cb Callback to be invoked for each of the changes
+ * @param ctx Callback context
+ */
+void MdnsEntryListDiff(Vector* known_entries, Vector* new_entries, OnMdnsEntryChangedCallback cb, void* ctx);
+
+/**
+ * @brief Apply the reported change to the list, the entry is copied
+ * @param entries List of MdnsEntry elements
+ * @param entry Entry the change is reported for
+ * @param change Change reported
+ * @return kEebusErrorOk on success, error code on fail
+ */
+EebusError MdnsEntryListApplyChange(Vector* entries, const MdnsEntry* entry, MdnsEntryChange change);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_SHIP_MDNS_MDNS_ENTRY_LIST_H_
@@ -36,7 +36,7 @@ ShipMdnsObject* ShipMdnsCreate(
     const EebusDeviceInfo* device_info,
     const char* service_name,
     int port,
-    OnMdnsEntriesFoundCallback cb,
+    OnMdnsEntryChangedCallback cb,
     void* ctx
 );
 
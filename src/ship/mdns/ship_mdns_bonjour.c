@@ -91,6 +91,7 @@
 #include "src/common/eebus_thread/eebus_thread.h"
 #include "src/common/vector.h"
 #include "src/ship/api/ship_mdns_interface.h"
+#include "src/ship/mdns/mdns_entry_list.h"
 #include "src/ship/ship_connection/types.h"
 
 /** Set MDNS_DEBUG 1 to enable debug prints */
@@ -109,13 +110,26 @@ static const char* kShipServiceType   = "_ship._tcp";
 static const char* kShipServicePath   = "/ship/";
 static const char* kShipServiceTxtVer = "1";
 
+/**
+ * The browser thread blocks in select() until mDNS responder has got an event,
+ * the timeout only bounds the time needed to notice the stop request
+ */
 static const struct timeval select_timeout = {
     .tv_sec  = 0,
-    .tv_usec = 100000,
+    .tv_usec = 500000,
 };
 
 typedef struct Mdns Mdns;
 
+typedef struct MdnsResolve MdnsResolve;
+
+/** Service resolve in progress, all of them share the single mDNS responder connection */
+struct MdnsResolve {
+  Mdns* mdns;
+  DNSServiceRef service_resolve_ref;
+  MdnsEntry* entry;
+};
+
 struct Mdns {
   /** Implements the Mdns Interface */
   ShipMdnsObject obj;
@@ -125,22 +139,22 @@ struct Mdns {
   int port;
   bool autoaccept;
 
-  MdnsEntry* entry;
-  OnMdnsEntriesFoundCallback on_entries_found_cb;
+  OnMdnsEntryChangedCallback on_entry_changed_cb;
   void* context;
 
   EebusThreadObject* thread;
+  /** Connection to the mDNS responder shared by the browser and all of the resolves */
+  DNSServiceRef dns_service_connection_ref;
   DNSServiceRef dns_service_browser_ref;
   DNSServiceRef dns_service_register_ref;
+  /** Resolves in progress, MdnsResolve elements */
+  Vector* resolves;
+  /** Resolved and valid services, MdnsEntry elements matched by the service name */
   Vector* found_entries;
   pthread_cond_t mdns_browse_cond;
   pthread_mutex_t mdns_browse_mutex;
 
-  bool done;
-  bool is_browsing;
   bool service_registered;
-  bool service_browse_done;
-  bool service_resolve_done;
   bool cancel;
 };
 
@@ -177,12 +191,19 @@ static void MdnsConstruct(
     const EebusDeviceInfo* device_info,
     const char* service_name,
     int port,
-    OnMdnsEntriesFoundCallback cb,
+    OnMdnsEntryChangedCallback cb,
     void* ctx
 );
 
 static void MdnsProcessResults(Mdns* self);
 static inline uint16_t OpaquePortToUint16(uint16_t opaque_port);
+static MdnsResolve* MdnsFindResolve(const Mdns* self, const char* name);
+static void MdnsResolveDelete(MdnsResolve* resolve);
+static void MdnsResolveDeallocator(void* p);
+static void MdnsResolveStart(Mdns* self, const char* name, const char* domain, uint32_t iface);
+static void MdnsResolveFinish(MdnsResolve* resolve);
+static void MdnsHandleServiceResolved(Mdns* self, MdnsEntry* entry);
+static void MdnsHandleServiceRemoved(Mdns* self, const char* name, uint32_t iface);
 static void MdnsResolveServiceCallback(
     DNSServiceRef service_ref,
     const DNSServiceFlags flags,
@@ -205,7 +226,7 @@ static void MdnsBrowseServicesCallback(
     const char* domain,
     void* ctx
 );
-static void MdnsBrowseServices(Mdns* self);
+static EebusError MdnsBrowseServices(Mdns* self);
 static void* MdnsBrowserLoop(void* parameters);
 static void MdnsRegisterServiceCallback(
     DNSServiceRef ref,
@@ -218,7 +239,8 @@ static void MdnsRegisterServiceCallback(
 );
 static DNSServiceErrorType MdnsCreateTextRecord(TXTRecordRef* txt_record, const Mdns* mdns);
 static void MdnsBrowserReset(Mdns* self);
-static void MdnsSleepRandomInterval(Mdns* self);
+static void MdnsReportAllRemoved(Mdns* self);
+static void MdnsWaitRetryInterval(Mdns* self);
 
 void MdnsConstruct(
     Mdns* self,
@@ -226,7 +248,7 @@ void MdnsConstruct(
     const EebusDeviceInfo* device_info,
     const char* service_name,
     int port,
-    OnMdnsEntriesFoundCallback cb,
+    OnMdnsEntryChangedCallback cb,
     void* ctx
 ) {
   // Override "virtual functions table"
@@ -237,27 +259,21 @@ void MdnsConstruct(
   self->service_name        = service_name;
   self->port                = port;
   self->autoaccept          = false;
-  self->entry               = NULL;
-  self->on_entries_found_cb = cb;
+  self->on_entry_changed_cb = cb;
   self->context             = ctx;
 
-  self->thread                   = NULL;
-  self->dns_service_browser_ref  = NULL;
-  self->dns_service_register_ref = NULL;
-  self->found_entries            = VectorCreateWithDeallocator(MdnsEntryDeallocator);
+  self->thread                     = NULL;
+  self->dns_service_connection_ref = NULL;
+  self->dns_service_browser_ref    = NULL;
+  self->dns_service_register_ref   = NULL;
+  self->resolves                   = VectorCreateWithDeallocator(MdnsResolveDeallocator);
+  self->found_entries              = VectorCreateWithDeallocator(MdnsEntryDeallocator);
 
   pthread_cond_init(&self->mdns_browse_cond, NULL);
   pthread_mutex_init(&self->mdns_browse_mutex, NULL);
 
-  self->done                 = false;
-  self->is_browsing          = false;
-  self->service_registered   = false;
-  self->service_browse_done  = false;
-  self->service_resolve_done = false;
-  self->cancel               = false;
-
-  // Seed random number generator
-  srand((int)time(NULL));
+  self->service_registered = false;
+  self->cancel             = false;
 }
 
 ShipMdnsObject* ShipMdnsCreate(
@@ -265,7 +281,7 @@ ShipMdnsObject* ShipMdnsCreate(
     const EebusDeviceInfo* device_info,
     const char* service_name,
     int port,
-    OnMdnsEntriesFoundCallback cb,
+    OnMdnsEntryChangedCallback cb,
     void* ctx
 ) {
   Mdns* const mdns = (Mdns*)EEBUS_MALLOC(sizeof(Mdns));
@@ -276,11 +292,22 @@ ShipMdnsObject* ShipMdnsCreate(
 }
 
 void MdnsBrowserReset(Mdns* mdns) {
+  // Subordinate service refs shall be released prior to the shared connection
+  if (mdns->resolves != NULL) {
+    VectorFreeElements(mdns->resolves);
+    VectorClear(mdns->resolves);
+  }
+
   if (mdns->dns_service_browser_ref != NULL) {
     DNSServiceRefDeallocate(mdns->dns_service_browser_ref);
     mdns->dns_service_browser_ref = NULL;
   }
 
+  if (mdns->dns_service_connection_ref != NULL) {
+    DNSServiceRefDeallocate(mdns->dns_service_connection_ref);
+    mdns->dns_service_connection_ref = NULL;
+  }
+
   if (mdns->found_entries != NULL) {
     VectorFreeElements(mdns->found_entries);
     VectorClear(mdns->found_entries);
@@ -298,6 +325,12 @@ void Destruct(ShipMdnsObject* self) {
     mdns->dns_service_register_ref = NULL;
   }
 
+  if (mdns->resolves != NULL) {
+    VectorDestruct(mdns->resolves);
+    EEBUS_FREE(mdns->resolves);
+    mdns->resolves = NULL;
+  }
+
   if (mdns->found_entries != NULL) {
     VectorFreeElements(mdns->found_entries);
     VectorDestruct(mdns->found_entries);
@@ -308,26 +341,20 @@ void Destruct(ShipMdnsObject* self) {
   pthread_mutex_destroy(&mdns->mdns_browse_mutex);
   pthread_cond_destroy(&mdns->mdns_browse_cond);
 
-  MdnsEntryDelete(mdns->entry);
-  mdns->entry = NULL;
-
   EebusDeviceInfoDelete(mdns->device_info);
   mdns->device_info = NULL;
 }
 
 void MdnsProcessResults(Mdns* self) {
-  const int dns_sd_fd = DNSServiceRefSockFD(self->dns_service_browser_ref);
+  const int dns_sd_fd = DNSServiceRefSockFD(self->dns_service_connection_ref);
   const int nfds      = dns_sd_fd + 1;
   fd_set readfds;
-  bool stop_handling = false;
 
-  self->done = false;
-
-  while (!stop_handling && !self->cancel && !self->done) {
+  while (!self->cancel) {
     // 1. Set up the fd_set as usual here.
     FD_ZERO(&readfds);
 
-    // 2. Add the fd for our dns_service_browser_ref(s) to the fd_set
+    // 2. Add the fd of the shared connection, browse and resolve events all arrive there
     FD_SET(dns_sd_fd, &readfds);
 
     // 3. Set up the timeout. Note: passing constant to select() directly leads to crash!
@@ -335,20 +362,14 @@ void MdnsProcessResults(Mdns* self) {
 
     const int result = select(nfds, &readfds, (fd_set*)NULL, (fd_set*)NULL, &tv);
     if (result > 0) {
-      DNSServiceErrorType err = kDNSServiceErr_NoError;
-      if (FD_ISSET(dns_sd_fd, &readfds)) {
-        err = DNSServiceProcessResult(self->dns_service_browser_ref);
-      }
-
-      if (err) {
+      const DNSServiceErrorType err = DNSServiceProcessResult(self->dns_service_connection_ref);
+      if (err != kDNSServiceErr_NoError) {
         MDNS_DEBUG_PRINTF("DNSServiceProcessResult returned %d\n", err);
-        stop_handling = true;
+        return;
       }
-    } else if (result == 0) {
-      stop_handling = true;
-    } else {
+    } else if ((result < 0) && (errno != EINTR)) {
       MDNS_DEBUG_PRINTF("select() returned %d errno %d %s\n", result, errno, strerror(errno));
-      stop_handling = (errno != EINTR);
+      return;
     }
   }
 }
@@ -362,6 +383,105 @@ uint16_t OpaquePortToUint16(uint16_t opaque_port) {
   return ((uint16_t)port.b[0]) << 8 | port.b[1];
 }
 
+MdnsResolve* MdnsFindResolve(const Mdns* self, const char* name) {
+  for (size_t i = 0; i < VectorGetSize(self->resolves); ++i) {
+    MdnsResolve* const resolve = (MdnsResolve*)VectorGetElement(self->resolves, i);
+    if (strcmp(resolve->entry->name, name) == 0) {
+      return resolve;
+    }
+  }
+
+  return NULL;
+}
+
+void MdnsResolveDelete(MdnsResolve* resolve) {
+  if (resolve->service_resolve_ref != NULL) {
+    DNSServiceRefDeallocate(resolve->service_resolve_ref);
+    resolve->service_resolve_ref = NULL;
+  }
+
+  MdnsEntryDelete(resolve->entry);
+  resolve->entry = NULL;
+
+  EEBUS_FREE(resolve);
+}
+
+void MdnsResolveDeallocator(void* p) {
+  MdnsResolveDelete((MdnsResolve*)p);
+}
+
+void MdnsResolveStart(Mdns* self, const char* name, const char* domain, uint32_t iface) {
+  MdnsResolve* const resolve = (MdnsResolve*)EEBUS_MALLOC(sizeof(MdnsResolve));
+  if (resolve == NULL) {
+    return;
+  }
+
+  resolve->mdns  = self;
+  resolve->entry = MdnsEntryCreate(name, domain, iface);
+  // Resolve shares the connection, its events are handled along with the browse ones
+  resolve->service_resolve_ref = self->dns_service_connection_ref;
+
+  if (resolve->entry == NULL) {
+    MDNS_DEBUG_PRINTF("Failed to create mDNS entry\n");
+    resolve->service_resolve_ref = NULL;
+    MdnsResolveDelete(resolve);
+    return;
+  }
+
+  const DNSServiceErrorType err = DNSServiceResolve(
+      &resolve->service_resolve_ref,
+      kDNSServiceFlagsShareConnection,
+      iface,
+      name,
+      kShipServiceType,
+      domain,
+      MdnsResolveServiceCallback,
+      resolve
+  );
+
+  if (err != kDNSServiceErr_NoError) {
+    MDNS_DEBUG_PRINTF("DNSServiceResolve() returned error %d\n", err);
+    resolve->service_resolve_ref = NULL;
+    MdnsResolveDelete(resolve);
+    return;
+  }
+
+  VectorPushBack(self->resolves, resolve);
+}
+
+void MdnsResolveFinish(MdnsResolve* resolve) {
+  // Releasing the subordinate service ref from within its own callback is allowed
+  VectorRemove(resolve->mdns->resolves, resolve);
+  MdnsResolveDelete(resolve);
+}
+
+void MdnsHandleServiceResolved(Mdns* self, MdnsEntry* entry) {
+  // Re-announcement with the same location and TXT record is not a change
+  MdnsEntryChange change;
+  if (MdnsEntryListMerge(self->found_entries, entry, &change)) {
+    MDNS_DEBUG_PRINTF("%s entry: %s\n", (change == kMdnsEntryAdded) ? "Added" : "Changed", entry->name);
+    self->on_entry_changed_cb(entry, change, self->context);
+  }
+}
+
+void MdnsHandleServiceRemoved(Mdns* self, const char* name, uint32_t iface) {
+  MdnsResolve* const resolve = MdnsFindResolve(self, name);
+  if ((resolve != NULL) && (resolve->entry->iface == iface)) {
+    MdnsResolveFinish(resolve);
+  }
+
+  // Service announced on several interfaces stays until it is gone from the resolved one
+  MdnsEntry* const known_entry = MdnsEntryListFind(self->found_entries, name);
+  if ((known_entry == NULL) || (known_entry->iface != iface)) {
+    return;
+  }
+
+  MDNS_DEBUG_PRINTF("Removed entry: %s\n", name);
+  VectorRemove(self->found_entries, known_entry);
+  self->on_entry_changed_cb(known_entry, kMdnsEntryRemoved, self->context);
+  MdnsEntryDelete(known_entry);
+}
+
 void MdnsResolveServiceCallback(
     DNSServiceRef service_ref,
     const DNSServiceFlags flags,
@@ -377,6 +497,9 @@ void MdnsResolveServiceCallback(
   UNUSED(service_ref);
   UNUSED(iface);
 
+  MdnsResolve* const resolve = (MdnsResolve*)ctx;
+  Mdns* const mdns           = resolve->mdns;
+
   MDNS_DEBUG_PRINTF("%s(), %s, ", __func__, name);
 
   if (err != kDNSServiceErr_NoError) {
@@ -386,6 +509,11 @@ void MdnsResolveServiceCallback(
       MDNS_DEBUG_PRINTF(" error code: %d\n", err);
     }
 
+    MdnsResolveFinish(resolve);
+    return;
+  }
+
+  if (flags & kDNSServiceFlagsMoreComing) {
     return;
   }
 
@@ -399,18 +527,19 @@ void MdnsResolveServiceCallback(
     MDNS_DEBUG_PRINTF(", txt_record: %s\n", txt_record);
   }
 
-  Mdns* const mdns = (Mdns*)ctx;
-  if (mdns->entry == NULL) {
-    MDNS_DEBUG_PRINTF("%s(), NULL mDNS entry\n", __func__);
-    return;
-  }
+  MdnsEntry* const entry = resolve->entry;
+  resolve->entry         = NULL;
+
+  MdnsEntrySetHost(entry, host);
+  MdnsEntrySetPort(entry, port);
+  MdnsEntryParseTxtRecord(entry, (const char*)txt_record, txt_record_size);
+
+  MdnsResolveFinish(resolve);
 
-  if (!(flags & kDNSServiceFlagsMoreComing)) {
-    MdnsEntrySetHost(mdns->entry, host);
-    MdnsEntrySetPort(mdns->entry, port);
-    MdnsEntryParseTxtRecord(mdns->entry, (const char*)txt_record, txt_record_size);
-    mdns->done                 = true;
-    mdns->service_resolve_done = true;
+  if (MdnsEntryIsValid(entry) && (strcmp(entry->ski, mdns->ski) != 0)) {
+    MdnsHandleServiceResolved(mdns, entry);
+  } else {
+    MdnsEntryDelete(entry);
   }
 }
 
@@ -444,73 +573,74 @@ void MdnsBrowseServicesCallback(
     return;
   }
 
-  mdns->entry = MdnsEntryCreate(name, domain, iface);
-  if (mdns->entry == NULL) {
-    MDNS_DEBUG_PRINTF("Failed to create mDNS entry\n");
+  if (!(flags & kDNSServiceFlagsAdd)) {
+    MdnsHandleServiceRemoved(mdns, name, iface);
     return;
   }
 
-  DNSServiceRef service_resolve_ref = NULL;
-  DNSServiceResolve(&service_resolve_ref, 0, iface, name, kShipServiceType, domain, MdnsResolveServiceCallback, mdns);
-  DNSServiceProcessResult(service_resolve_ref);
-
-  if (service_resolve_ref != NULL) {
-    DNSServiceRefDeallocate(service_resolve_ref);
-    service_resolve_ref = NULL;
-  }
-
-  if (MdnsEntryIsValid(mdns->entry) && (strcmp(mdns->entry->ski, mdns->ski) != 0)) {
-    MDNS_DEBUG_PRINTF("Added entry: %s\n", mdns->entry->name);
-    VectorPushBack(mdns->found_entries, mdns->entry);
-    mdns->entry = NULL;
+  // Service (re)announcement, resolve it again to catch up the location or TXT record changes.
+  // The resolves run concurrently, the result is handled whenever it arrives
+  if (MdnsFindResolve(mdns, name) == NULL) {
+    MdnsResolveStart(mdns, name, domain, iface);
   }
 }
 
-void MdnsBrowseServices(Mdns* self) {
-  if (self->dns_service_browser_ref != NULL) {
-    DNSServiceRefDeallocate(self->dns_service_browser_ref);
-    self->dns_service_browser_ref = NULL;
+EebusError MdnsBrowseServices(Mdns* self) {
+  DNSServiceErrorType err = DNSServiceCreateConnection(&self->dns_service_connection_ref);
+  if (err != kDNSServiceErr_NoError) {
+    MDNS_DEBUG_PRINTF("DNSServiceCreateConnection() returned error %d\n", err);
+    self->dns_service_connection_ref = NULL;
+    return kEebusErrorInit;
   }
 
-  const DNSServiceErrorType err = DNSServiceBrowse(
+  // Browser shares the connection, so that a single fd carries all of the events
+  self->dns_service_browser_ref = self->dns_service_connection_ref;
+
+  err = DNSServiceBrowse(
       &self->dns_service_browser_ref,
-      0,                             // No flags
-      kDNSServiceInterfaceIndexAny,  // Browse on all network interfaces
-      kShipServiceType,              // Browse for SHIP TCP services
-      NULL,                          // Browse on the default domain (e.g. local.)
-      MdnsBrowseServicesCallback,    // Callback function when Bonjour events occur
+      kDNSServiceFlagsShareConnection,  // Use the shared connection
+      kDNSServiceInterfaceIndexAny,     // Browse on all network interfaces
+      kShipServiceType,                 // Browse for SHIP TCP services
+      NULL,                             // Browse on the default domain (e.g. local.)
+      MdnsBrowseServicesCallback,       // Callback function when Bonjour events occur
       self
   );  // Pass mDNS instance to callback
 
   if (err != kDNSServiceErr_NoError) {
     MDNS_DEBUG_PRINTF("DNSServiceBrowse() returned error %d\n", err);
-    return;
+    self->dns_service_browser_ref = NULL;
+    return kEebusErrorInit;
   }
 
-  if (self->dns_service_browser_ref == NULL) {
-    MDNS_DEBUG_PRINTF("DNSServiceBrowse() created no service ref\n");
-    return;
+  return kEebusErrorOk;
+}
+
+void MdnsReportAllRemoved(Mdns* self) {
+  while (VectorGetSize(self->found_entries) > 0) {
+    MdnsEntry* const entry = (MdnsEntry*)VectorGetElement(self->found_entries, 0);
+    VectorRemove(self->found_entries, entry);
+    self->on_entry_changed_cb(entry, kMdnsEntryRemoved, self->context);
+    MdnsEntryDelete(entry);
   }
 }
 
-void MdnsSleepRandomInterval(Mdns* self) {
-  uint8_t update_interval
-      = kMdnsBrowseIntervalMinSeconds + rand() % (kMdnsBrowseIntervalMaxSeconds - kMdnsBrowseIntervalMinSeconds);
+void MdnsWaitRetryInterval(Mdns* self) {
   struct timespec timeout;
 #ifdef _WIN32
   // Windows doesn't have clock_gettime, use time() + conversion
   time_t now      = time(NULL);
-  timeout.tv_sec  = now + update_interval;
+  timeout.tv_sec  = now + kMdnsBrowseIntervalMinSeconds;
   timeout.tv_nsec = 0;
 #else
   clock_gettime(CLOCK_REALTIME, &timeout);
-  timeout.tv_sec += update_interval;
+  timeout.tv_sec += kMdnsBrowseIntervalMinSeconds;
   timeout.tv_nsec = 0;
 #endif
-  MDNS_DEBUG_PRINTF("mDNS entry update interval: %us\n", update_interval);
 
   pthread_mutex_lock(&self->mdns_browse_mutex);
-  pthread_cond_timedwait(&self->mdns_browse_cond, &self->mdns_browse_mutex, &timeout);
+  if (!self->cancel) {
+    pthread_cond_timedwait(&self->mdns_browse_cond, &self->mdns_browse_mutex, &timeout);
+  }
   pthread_mutex_unlock(&self->mdns_browse_mutex);
 }
 
@@ -518,18 +648,23 @@ void* MdnsBrowserLoop(void* parameters) {
   Mdns* const mdns = (Mdns*)parameters;
 
   while (!mdns->cancel) {
-    MdnsBrowseServices(mdns);
-    MdnsProcessResults(mdns);
-    MDNS_DEBUG_PRINTF("Number of found entries: %d\n", VectorGetSize(mdns->found_entries));
-    mdns->on_entries_found_cb(mdns->found_entries, mdns->context);
+    // Single long-lived browse session, the found services set is updated incrementally
+    if (MdnsBrowseServices(mdns) == kEebusErrorOk) {
+      MdnsProcessResults(mdns);
+    }
+
+    if (mdns->cancel) {
+      break;
+    }
 
-    MdnsSleepRandomInterval(mdns);
+    // Connection to the mDNS responder is lost, discover the services from scratch
+    MDNS_DEBUG_PRINTF("mDNS browsing failed, retry in %us\n", kMdnsBrowseIntervalMinSeconds);
+    MdnsReportAllRemoved(mdns);
     MdnsBrowserReset(mdns);
+    MdnsWaitRetryInterval(mdns);
   }
 
-  mdns->service_browse_done = true;
-  mdns->done                = true;
-
+  MdnsBrowserReset(mdns);
   return NULL;
 }
 
@@ -623,7 +758,7 @@ EebusError Start(ShipMdnsObject* self) {
     return ret;
   }
 
-  if (mdns->on_entries_found_cb == NULL) {
+  if (mdns->on_entry_changed_cb == NULL) {
     MDNS_DEBUG_PRINTF("No callback function set\n");
     return kEebusErrorInit;
   }
@@ -30,6 +30,7 @@
 #include "src/common/eebus_thread/eebus_thread.h"
 #include "src/ship/api/mdns_entry.h"
 #include "src/ship/api/ship_mdns_interface.h"
+#include "src/ship/mdns/mdns_entry_list.h"
 #include "src/ship/mdns/ship_mdns.h"
 
 /** Set MDNS_DEBUG 1 to enable debug prints */
@@ -58,7 +59,7 @@ struct Mdns {
   /** Implements the Mdns Interface */
   ShipMdnsObject obj;
 
-  OnMdnsEntriesFoundCallback on_entries_found_cb;
+  OnMdnsEntryChangedCallback on_entry_changed_cb;
   void* context;
 
   bool cancel;
@@ -67,6 +68,7 @@ struct Mdns {
   const char* service_name;
   int port;
   bool autoaccept;
+  /** Services found by the latest query, used to report the changes only */
   Vector* found_entries;
   EebusThreadObject* thread;
   SemaphoreHandle_t semaphore;
@@ -103,7 +105,7 @@ static EebusError MdnsConstruct(
     const EebusDeviceInfo* device_info,
     const char* service_name,
     int port,
-    OnMdnsEntriesFoundCallback cb,
+    OnMdnsEntryChangedCallback cb,
     void* ctx
 );
 
@@ -113,7 +115,7 @@ EebusError MdnsConstruct(
     const EebusDeviceInfo* device_info,
     const char* service_name,
     int port,
-    OnMdnsEntriesFoundCallback cb,
+    OnMdnsEntryChangedCallback cb,
     void* ctx
 ) {
   // Override "virtual functions table"
@@ -121,7 +123,7 @@ EebusError MdnsConstruct(
 
   self->cancel              = false;
   self->ski                 = StringCopy(ski);
-  self->on_entries_found_cb = cb;
+  self->on_entry_changed_cb = cb;
   self->context             = ctx;
   self->device_info         = EebusDeviceInfoCopy(device_info);
   self->service_name        = StringCopy(service_name);
@@ -140,7 +142,7 @@ ShipMdnsObject* ShipMdnsCreate(
     const EebusDeviceInfo* device_info,
     const char* service_name,
     int port,
-    OnMdnsEntriesFoundCallback cb,
+    OnMdnsEntryChangedCallback cb,
     void* ctx
 ) {
   Mdns* const mdns = (Mdns*)EEBUS_MALLOC(sizeof(Mdns));
@@ -226,33 +228,41 @@ void MdnsProcessSearchResult(Mdns* mdns, mdns_search_once_t* search) {
     return;
   }
 
-  if (results == NULL) {
-    MDNS_DEBUG_PRINTF("mdns_query_async_get_results() returned no results\n");
-    return;
-  }
+  Vector new_entries;
+  VectorConstructWithDeallocator(&new_entries, MdnsEntryDeallocator);
 
   mdns_result_t* r = results;
   while (r) {
     MdnsEntry* const entry = MdnsEntryCreateWithMdnsResult(r);
     if (entry == NULL) {
       MDNS_DEBUG_PRINTF("Failed to create mDNS entry\n");
+      // Incomplete results would be reported as removals
+      mdns_query_results_free(results);
+      VectorFreeElements(&new_entries);
+      VectorDestruct(&new_entries);
       return;
+    }
+
+    if (MdnsEntryIsValid(entry) && (strcmp(entry->ski, mdns->ski) != 0)
+        && (MdnsEntryListFind(&new_entries, entry->name) == NULL)) {
+      MDNS_DEBUG_PRINTF("Found entry: %s, ski: %s\n", entry->name, entry->ski);
+      VectorPushBack(&new_entries, entry);
     } else {
-      if (MdnsEntryIsValid(entry) && (strcmp(entry->ski, mdns->ski) != 0)) {
-        MDNS_DEBUG_PRINTF("Added entry: %s, ski: %s\n", entry->name, entry->ski);
-        VectorPushBack(mdns->found_entries, entry);
-      } else {
-        MDNS_DEBUG_PRINTF("Ignored entry: %s, ski: %s\n", entry->name, entry->ski);
-        MdnsEntryDelete(entry);
-      }
+      MDNS_DEBUG_PRINTF("Ignored entry: %s, ski: %s\n", entry->name, entry->ski);
+      MdnsEntryDelete(entry);
     }
 
     r = r->next;
   }
 
-  mdns_query_results_free(results);
+  if (results != NULL) {
+    mdns_query_results_free(results);
+  }
 
-  mdns->on_entries_found_cb(mdns->found_entries, mdns->context);
+  // The ESP-IDF mDNS has no continuous browsing, so the query results are compared
+  // with the previous ones to report the changes only
+  MdnsEntryListDiff(mdns->found_entries, &new_entries, mdns->on_entry_changed_cb, mdns->context);
+  VectorDestruct(&new_entries);
 }
 
 uint32_t GetUpdateIntervalMs(void) {
@@ -268,8 +278,6 @@ void* MdnsBrowserLoop(void* parameters) {
   mdns_search_once_t* search = NULL;
 
   while (!mdns->cancel) {
-    VectorFreeElements(mdns->found_entries);
-
     search = mdns_query_async_new(
         NULL,
         kShipServiceType,
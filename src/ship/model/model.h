@@ -79,15 +79,16 @@ typedef struct {
 enum MessageProtocolFormatType {
   kMessageProtocolFormatTypeUTF8  = 0,  // "JSON-UTF8"
   kMessageProtocolFormatTypeUTF16 = 1,  // "JSON-UTF16"
+  kMessageProtocolFormatTypeCbor  = 2,  // "openeebus-CBOR", understood by openeebus peers only
 };
 
 typedef enum MessageProtocolFormatType MessageProtocolFormatType;
 
 typedef struct {
   // 13.4.4.2.1, "Permitted values for the child element "format"
-  // are "JSON-UTF8" and "JSON-UTF16""
-  // so currently limit formats array to contain 2 elements
-  MessageProtocolFormatType format[2];  // `json:"format"`
+  // are "JSON-UTF8" and "JSON-UTF16"", plus the openeebus specific CBOR
+  // so currently limit formats array to contain 3 elements
+  MessageProtocolFormatType format[3];  // `json:"format"`
   size_t format_size;                   // Actual number of formats used
 } MessageProtocolFormats;
 
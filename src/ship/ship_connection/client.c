@@ -155,7 +155,7 @@ void CmiStateClientSend(ShipConnection* self) {
   MessageBuffer buf = {0};
   MessageBufferInitWithDeallocator(&buf, (uint8_t*)kShipInitMessage, ARRAY_SIZE(kShipInitMessage), NULL);
 
-  if (ShipConnectionSend(self, &buf) == kEebusErrorOk) {
+  if (ShipConnectionSend(self, &buf, kMessagePriorityControl) == kEebusErrorOk) {
     ShipConnectionSetSmeState(self, kCmiStateClientWait);
   } else {
     ShipConnectionCloseWithError(self, "CMI client send failed");
@@ -185,6 +185,9 @@ void CmiStateClientEvaluate(ShipConnection* self) {
 void SmeProtHandshakeStateClientInit(ShipConnection* self) {
   EEBUS_TIMER_STOP(self->wait_for_ready_timer);
 
+  // CBOR is not standard, it is offered only to the servers the application has opted in explicitly
+  self->is_cbor_offered = INFO_PROVIDER_IS_CBOR_ENABLED_FOR_SKI(self->info_provider, self->remote_ski);
+
   const MessageProtocolHandshake sme_prot_hs = {
       .handshake_type = kProtocolHandshakeTypeAnnounceMax,
       .version= {
@@ -192,9 +195,10 @@ void SmeProtHandshakeStateClientInit(ShipConnection* self) {
           .minor = SHIP_PROTOCOL_MAX_SUPPORTED_MINOR_VERSION,
       },
 
+      // JSON goes first, so that the peers not aware of CBOR select it
       .formats = {
-          .format      = {kMessageProtocolFormatTypeUTF8},
-          .format_size = 1,
+          .format      = {kMessageProtocolFormatTypeUTF8, kMessageProtocolFormatTypeCbor},
+          .format_size = self->is_cbor_offered ? 2 : 1,
       },
     };
 
@@ -207,7 +211,7 @@ void SmeProtHandshakeStateClientInit(ShipConnection* self) {
   ShipConnectionSetSmeState(self, kSmeProtHStateClientListenChoice);
 }
 
-bool SmeProtHandshakeStateMessageCheck(const MessageProtocolHandshake* sme_prot_hs) {
+bool SmeProtHandshakeStateMessageCheck(const ShipConnection* self, const MessageProtocolHandshake* sme_prot_hs) {
   if (sme_prot_hs->handshake_type != kProtocolHandshakeTypeSelect) {
     SHIP_CONNECTION_DEBUG_PRINTF("Invalid protocol handshake response\n");
     return false;
@@ -228,7 +232,9 @@ bool SmeProtHandshakeStateMessageCheck(const MessageProtocolHandshake* sme_prot_
     return false;
   }
 
-  if (sme_prot_hs->formats.format[0] != kMessageProtocolFormatTypeUTF8) {
+  const MessageProtocolFormatType format = sme_prot_hs->formats.format[0];
+  if ((format != kMessageProtocolFormatTypeUTF8)
+      && ((format != kMessageProtocolFormatTypeCbor) || !self->is_cbor_offered)) {
     SHIP_CONNECTION_DEBUG_PRINTF("Unsupported format\n");
     return false;
   }
@@ -245,7 +251,7 @@ EebusError SmeProtHandshakeStateSendMaximumSupportedShipVersion(ShipConnection*
       },
 
       .formats = {
-          .format      = {kMessageProtocolFormatTypeUTF8},
+          .format      = {self->format},
           .format_size = 1,
       },
   };
@@ -267,12 +273,14 @@ void SmeProtHandshakeStateClientListenChoice(ShipConnection* self) {
   if ((msg_value_type == kSmeProtocolHandshake) && (sme_prot_hs != NULL)) {
     EEBUS_TIMER_STOP(self->wait_for_ready_timer);
 
-    if (!SmeProtHandshakeStateMessageCheck(sme_prot_hs)) {
+    if (!SmeProtHandshakeStateMessageCheck(self, sme_prot_hs)) {
       ShipMessageDeserializeDelete(deserialize);
       SmeProtHandshakeStateAbort(self, kMessageProtocolHandshakeErrorTypeSelectionMismatch);
       return;
     }
 
+    self->format = sme_prot_hs->formats.format[0];
+
     if (SmeProtHandshakeStateSendMaximumSupportedShipVersion(self) != kEebusErrorOk) {
       ShipMessageDeserializeDelete(deserialize);
       ShipConnectionCloseWithError(self, "Error serializing protocol handshake ship message");
@@ -170,7 +170,7 @@ void CmiStateServerEvaluate(ShipConnection* self) {
     return;
   }
 
-  if (ShipConnectionSend(self, &buf) != kEebusErrorOk) {
+  if (ShipConnectionSend(self, &buf, kMessagePriorityControl) != kEebusErrorOk) {
     MessageBufferRelease(&self->msg);
     ShipConnectionCloseWithError(self, "Server CMI message send failed");
     return;
@@ -195,7 +195,7 @@ EebusError SmeProtHandshakeStateSendAgreementMessage(ShipConnection* self, uint8
       },
 
       .formats = {
-          .format      = {kMessageProtocolFormatTypeUTF8},
+          .format      = {self->format},
           .format_size = 1,
       },
   };
@@ -203,6 +203,25 @@ EebusError SmeProtHandshakeStateSendAgreementMessage(ShipConnection* self, uint8
   return ShipConnectionSerializeAndSendMessage(self, &sme_prot_hs_send, kSmeProtocolHandshake);
 }
 
+MessageProtocolFormatType SmeProtHandshakeStateAgreeOnFormat(
+    const ShipConnection* self,
+    const MessageProtocolHandshake* sme_prot_hs
+) {
+  // CBOR is selected only if the client has offered it and the application has opted the client in,
+  // JSON is the fallback for everyone else
+  if (!INFO_PROVIDER_IS_CBOR_ENABLED_FOR_SKI(self->info_provider, self->remote_ski)) {
+    return kMessageProtocolFormatTypeUTF8;
+  }
+
+  for (size_t i = 0; i < sme_prot_hs->formats.format_size; ++i) {
+    if (sme_prot_hs->formats.format[i] == kMessageProtocolFormatTypeCbor) {
+      return kMessageProtocolFormatTypeCbor;
+    }
+  }
+
+  return kMessageProtocolFormatTypeUTF8;
+}
+
 bool SmeProtHandshakeStateAgreeOnProtocolVersion(
     const MessageProtocolHandshake* sme_prot_hs, uint8_t* agreed_major, uint8_t* agreed_minor) {
   if ((sme_prot_hs->version.major <= SHIP_PROTOCOL_MAX_SUPPORTED_MAJOR_VERSION)
@@ -245,6 +264,8 @@ void SmeProtHandshakeStateServerListenProposal(ShipConnection* self) {
       return;
     }
 
+    self->format = SmeProtHandshakeStateAgreeOnFormat(self, msg_value);
+
     if (SmeProtHandshakeStateSendAgreementMessage(self, agreed_version_major, agreed_version_minor) != kEebusErrorOk) {
       ShipMessageDeserializeDelete(deserialize);
       ShipConnectionCloseWithError(self, "Error serializing protocol handshake ship message");
@@ -17,17 +17,20 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include <time.h>
 
 #include "src/common/array_util.h"
 #include "src/common/debug.h"
 #include "src/common/eebus_errors.h"
 #include "src/common/eebus_malloc.h"
+#include "src/common/eebus_mutex/eebus_mutex.h"
 #include "src/common/eebus_queue/eebus_queue.h"
 #include "src/common/eebus_thread/eebus_thread.h"
 #include "src/common/eebus_timer/eebus_timer.h"
 #include "src/common/message_buffer.h"
 #include "src/common/string_util.h"
+#include "src/common/vector.h"
 #include "src/ship/api/connection_state.h"
 #include "src/ship/api/data_reader_interface.h"
 #include "src/ship/api/data_writer_interface.h"
@@ -49,7 +52,9 @@
 static EebusError Start(ShipConnectionObject* self, WebsocketCreatorObject* websocket_creator);
 static void Stop(ShipConnectionObject* self);
 static void Destruct(DataWriterObject* self);
-static void WriteMessage(DataWriterObject* self, const uint8_t* message, size_t messageSize);
+static EebusError
+WriteMessage(DataWriterObject* self, const uint8_t* message, size_t messageSize, MessagePriority priority);
+static MessageProtocolFormatType GetFormat(const DataWriterObject* self);
 
 static WebsocketObject* GetWebsocketConnection(ShipConnectionObject* self);
 static void CloseConnection(ShipConnectionObject* self, bool safe, int32_t code, const char* reason);
@@ -59,12 +64,26 @@ static void AbortPendingHandshake(ShipConnectionObject* self);
 
 static SmeState GetState(ShipConnectionObject* self, EebusError* err);
 static void ShipConnectionTimeoutCallback(void* timer_data);
+static void ShipConnectionBeginClose(ShipConnection* self, const ConnectionClose* sme_close, bool is_hs_ended);
+static void ShipConnectionCompleteClose(ShipConnection* self);
+static bool ShipConnectionIsCloseMsgWritten(ShipConnection* self, const uint8_t* msg, size_t msg_size);
+static void ShipConnectionTxBacklogMsgDelete(void* msg);
+static EebusError ShipConnectionPushTxBacklog(ShipConnection* self, ShipConnectionQueueMessage* queue_msg);
+static EebusError ShipConnectionSerializeAndSendMessageWithPriority(
+    ShipConnection* self,
+    const void* message,
+    MsgValueType value_type,
+    MessagePriority priority
+);
+static EebusError
+DataExchangeHandleSendSpineData(ShipConnection* self, const MessageBuffer* buf, MessagePriority priority);
 
 static const ShipConnectionInterface ship_connection_methods = {
     .data_writer_interface =
         {
             .destruct = Destruct,
             .write_message = WriteMessage,
+            .get_format = GetFormat,
         },
 
     .start = Start,
@@ -99,18 +118,32 @@ void ShipConnectionConstruct(
   self->sme_error      = kEebusErrorOk;
 
   self->is_access_methods_req_sent = false;
+  self->format                     = kMessageProtocolFormatTypeUTF8;
+  self->is_cbor_offered            = false;
 
   self->wait_for_ready_timer             = EebusTimerCreate(ShipConnectionTimeoutCallback, self);
   self->send_prolongation_request_timer  = EebusTimerCreate(ShipConnectionTimeoutCallback, self);
   self->prolongation_request_reply_timer = EebusTimerCreate(ShipConnectionTimeoutCallback, self);
+  self->close_timer                      = EebusTimerCreate(ShipConnectionTimeoutCallback, self);
 
   self->last_received_waiting_value = 0;
   self->shutdown_once               = false;
+  self->is_close_pending            = false;
+  self->close_is_hs_ended           = false;
+  self->close_mutex                 = EebusMutexCreate();
+  MessageBufferInit(&self->close_msg, NULL, 0);
 
   self->cancel    = false;
   self->msg_queue = NULL;
   self->thread    = NULL;
   MessageBufferInit(&self->msg, NULL, 0);
+
+  VectorConstructWithDeallocator(&self->tx_backlog, ShipConnectionTxBacklogMsgDelete);
+  self->tx_mutex = EebusMutexCreate();
+
+  self->tx_busy_cnt          = 0;
+  self->tx_backlog_depth_max = 0;
+  self->rx_busy_cnt          = 0;
 }
 
 ShipConnectionObject* ShipConnectionCreate(
@@ -134,13 +167,19 @@ void ShipConnectionQueueMsgDeallocator(void* msg) {
 
   ShipConnectionQueueMessage* queue_msg = (ShipConnectionQueueMessage*)msg;
 
-  if (queue_msg->type != kShipConnectionQueueMsgTypeDataReceived) {
+  if ((queue_msg->type != kShipConnectionQueueMsgTypeDataReceived)
+      && (queue_msg->type != kShipConnectionQueueMsgTypeSpineDataToSend)) {
     return;
   }
 
   MessageBufferRelease(&queue_msg->msg_buf);
 }
 
+void ShipConnectionTxBacklogMsgDelete(void* msg) {
+  ShipConnectionQueueMsgDeallocator(msg);
+  EEBUS_FREE(msg);
+}
+
 void Destruct(DataWriterObject* self) {
   ShipConnection* const sc = SHIP_CONNECTION(self);
 
@@ -168,10 +207,22 @@ void Destruct(DataWriterObject* self) {
   EebusTimerDelete(sc->prolongation_request_reply_timer);
   sc->prolongation_request_reply_timer = NULL;
 
+  EebusTimerDelete(sc->close_timer);
+  sc->close_timer = NULL;
+
   EebusQueueDelete(sc->msg_queue);
   sc->msg_queue = NULL;
 
+  VectorDestruct(&sc->tx_backlog);
+
+  EebusMutexDelete(sc->tx_mutex);
+  sc->tx_mutex = NULL;
+
   MessageBufferRelease(&sc->msg);
+  MessageBufferRelease(&sc->close_msg);
+
+  EebusMutexDelete(sc->close_mutex);
+  sc->close_mutex = NULL;
 
   StringDelete((char*)sc->remote_ship_id);
   sc->remote_ship_id = NULL;
@@ -303,6 +354,12 @@ void CloseConnection(ShipConnectionObject* self, bool safe, int32_t code, const
     return;
   };
 
+  if (sc->is_close_pending) {
+    // Close message has already been sent, do not wait for it to be written out anymore
+    ShipConnectionCompleteClose(sc);
+    return;
+  }
+
   EEBUS_TIMER_STOP(sc->wait_for_ready_timer);
   EEBUS_TIMER_STOP(sc->prolongation_request_reply_timer);
   EEBUS_TIMER_STOP(sc->send_prolongation_request_timer);
@@ -320,28 +377,139 @@ void CloseConnection(ShipConnectionObject* self, bool safe, int32_t code, const
         .reason = reason,
     };
 
-    ShipConnectionSerializeAndSendMessage(sc, &sme_close, kSmeClose);
-    EebusThreadUsleep(500000);  // Wait 0.5s for the message to be sent
-    WEBSOCKET_CLOSE(sc->websocket, 4001, "close");
-  } else {
-    WEBSOCKET_CLOSE(sc->websocket, (code != 0) ? code : 4001, reason);
+    ShipConnectionBeginClose(sc, &sme_close, is_hs_ended);
+    return;
   }
 
+  WEBSOCKET_CLOSE(sc->websocket, (code != 0) ? code : 4001, reason);
+
   sc->cancel        = true;
   sc->shutdown_once = true;
   INFO_PROVIDER_HANDLE_CONNECTION_CLOSED(sc->info_provider, self, is_hs_ended);
 }
 
-void WriteMessage(DataWriterObject* self, const uint8_t* msg, size_t msg_size) {
+void ShipConnectionBeginClose(ShipConnection* self, const ConnectionClose* sme_close, bool is_hs_ended) {
+  static const uint32_t kCloseFlushTimeout = 500;
+
+  self->close_is_hs_ended = is_hs_ended;
+
+  ShipMessageSerializeObject* const serialize = ShipMessageSerializeCreate(sme_close, kSmeClose);
+
+  const MessageBuffer* const buf = SHIP_MESSAGE_SERIALIZE_GET_BUFFER(serialize);
+
+  uint8_t* const close_msg = (buf != NULL) ? (uint8_t*)ArrayCopy(buf->data, buf->data_size, sizeof(uint8_t)) : NULL;
+  if (close_msg == NULL) {
+    ShipMessageSerializeDelete(serialize);
+    ShipConnectionCompleteClose(self);
+    return;
+  }
+
+  // Set prior to sending, as the write completion is reported from the websocket thread
+  EEBUS_MUTEX_LOCK(self->close_mutex);
+  MessageBufferRelease(&self->close_msg);
+  MessageBufferInit(&self->close_msg, close_msg, buf->data_size);
+  self->is_close_pending = true;
+  EEBUS_MUTEX_UNLOCK(self->close_mutex);
+
+  const EebusError ret = ShipConnectionSend(self, buf, kMessagePriorityControl);
+  ShipMessageSerializeDelete(serialize);
+
+  if (ret != kEebusErrorOk) {
+    ShipConnectionCompleteClose(self);
+    return;
+  }
+
+  EEBUS_TIMER_START(self->close_timer, kCloseFlushTimeout, false);
+}
+
+bool ShipConnectionIsCloseMsgWritten(ShipConnection* self, const uint8_t* msg, size_t msg_size) {
+  EEBUS_MUTEX_LOCK(self->close_mutex);
+  const bool is_close_msg = self->is_close_pending && (msg != NULL) && (msg_size == self->close_msg.data_size)
+                            && (memcmp(msg, self->close_msg.data, msg_size) == 0);
+  EEBUS_MUTEX_UNLOCK(self->close_mutex);
+
+  return is_close_msg;
+}
+
+void ShipConnectionCompleteClose(ShipConnection* self) {
+  EEBUS_TIMER_STOP(self->close_timer);
+
+  EEBUS_MUTEX_LOCK(self->close_mutex);
+  self->is_close_pending = false;
+  EEBUS_MUTEX_UNLOCK(self->close_mutex);
+
+  WEBSOCKET_CLOSE(self->websocket, 4001, "close");
+
+  self->cancel        = true;
+  self->shutdown_once = true;
+  INFO_PROVIDER_HANDLE_CONNECTION_CLOSED(self->info_provider, SHIP_CONNECTION_OBJECT(self), self->close_is_hs_ended);
+}
+
+MessageProtocolFormatType GetFormat(const DataWriterObject* self) {
+  return SHIP_CONNECTION(self)->format;
+}
+
+EebusError WriteMessage(DataWriterObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority) {
   ShipConnection* const sc = SHIP_CONNECTION(self);
 
-  ShipConnectionQueueMessage queue_msg;
+  ShipConnectionQueueMessage queue_msg = {
+      .type     = kShipConnectionQueueMsgTypeSpineDataToSend,
+      .priority = priority,
+  };
 
-  queue_msg.type          = kShipConnectionQueueMsgTypeSpineDataToSend;
   uint8_t* const msg_copy = (uint8_t*)ArrayCopy(msg, msg_size, sizeof(msg[0]));
+  if (msg_copy == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
   MessageBufferInit(&queue_msg.msg_buf, msg_copy, msg_size);
 
-  EEBUS_QUEUE_SEND(sc->msg_queue, &queue_msg, kTimeoutInfinite);
+  // SPINE writes while holding the device lock, never wait for the credit not to stall the whole device.
+  // The message is put into the backlog instead, keeping the order behind the messages deferred already
+  EEBUS_MUTEX_LOCK(sc->tx_mutex);
+  EebusError ret = kEebusErrorOk;
+  if ((VectorGetSize(&sc->tx_backlog) != 0) || (EEBUS_QUEUE_SEND(sc->msg_queue, &queue_msg, 0) != kEebusErrorOk)) {
+    ret = ShipConnectionPushTxBacklog(sc, &queue_msg);
+  }
+  EEBUS_MUTEX_UNLOCK(sc->tx_mutex);
+
+  return ret;
+}
+
+EebusError ShipConnectionPushTxBacklog(ShipConnection* self, ShipConnectionQueueMessage* queue_msg) {
+  ShipConnectionQueueMessage* const backlog_msg
+      = (ShipConnectionQueueMessage*)EEBUS_MALLOC(sizeof(ShipConnectionQueueMessage));
+  if (backlog_msg == NULL) {
+    MessageBufferRelease(&queue_msg->msg_buf);
+    return kEebusErrorMemoryAllocate;
+  }
+
+  *backlog_msg = *queue_msg;
+  VectorPushBack(&self->tx_backlog, backlog_msg);
+
+  if (VectorGetSize(&self->tx_backlog) > self->tx_backlog_depth_max) {
+    self->tx_backlog_depth_max = VectorGetSize(&self->tx_backlog);
+  }
+
+  ++self->tx_busy_cnt;
+  SHIP_CONNECTION_DEBUG_PRINTF("%s(), no write credit, %u messages deferred\n", __func__, self->tx_busy_cnt);
+  return kEebusErrorOk;
+}
+
+void ShipConnectionRetryTxBacklog(ShipConnection* self) {
+  EEBUS_MUTEX_LOCK(self->tx_mutex);
+  while (VectorGetSize(&self->tx_backlog) > 0) {
+    ShipConnectionQueueMessage* const backlog_msg
+        = (ShipConnectionQueueMessage*)VectorGetElement(&self->tx_backlog, 0);
+    if (EEBUS_QUEUE_SEND(self->msg_queue, backlog_msg, 0) != kEebusErrorOk) {
+      break;
+    }
+
+    // The message buffer is owned by the queue now
+    VectorRemove(&self->tx_backlog, backlog_msg);
+    EEBUS_FREE(backlog_msg);
+  }
+  EEBUS_MUTEX_UNLOCK(self->tx_mutex);
 }
 
 void ReportConnectionError(ShipConnection* self, EebusError err) {
@@ -375,19 +543,24 @@ void ReportConnectionError(ShipConnection* self, EebusError err) {
   INFO_PROVIDER_HANDLE_SHIP_STATE_UPDATE(self->info_provider, self->remote_ski, kSmeStateError, "");
 }
 
-void ShipConnectionWebsocketCallback(WebsocketCallbackType type, const void* in, size_t size, void* ctx) {
+EebusError ShipConnectionWebsocketCallback(WebsocketCallbackType type, const void* in, size_t size, void* ctx) {
   ShipConnection* const sc = SHIP_CONNECTION(ctx);
   if ((sc->cancel) || (sc->shutdown_once)) {
-    return;
+    return kEebusErrorOk;
   }
 
   if (type == kWebsocketCallbackTypeRead) {
-    ShipConnectionQueueMessage queue_msg;
-    queue_msg.type = kShipConnectionQueueMsgTypeDataReceived;
+    ShipConnectionQueueMessage queue_msg = {.type = kShipConnectionQueueMsgTypeDataReceived};
 
     uint8_t* const msg_copy = (uint8_t*)ArrayCopy(in, size, sizeof(uint8_t));
     MessageBufferInit(&queue_msg.msg_buf, msg_copy, size);
-    EEBUS_QUEUE_SEND(sc->msg_queue, &queue_msg, kTimeoutInfinite);
+
+    // Never block the websocket service thread, let it throttle the receiving instead
+    if (EEBUS_QUEUE_SEND(sc->msg_queue, &queue_msg, 0) != kEebusErrorOk) {
+      MessageBufferRelease(&queue_msg.msg_buf);
+      ++sc->rx_busy_cnt;
+      return kEebusErrorCommunicationBusy;
+    }
   } else if (type == kWebsocketCallbackTypeError) {
     static const ShipConnectionQueueMessage err_msg = {.type = kShipConnectionQueueMsgTypeWebsocketError};
     EEBUS_QUEUE_SEND(sc->msg_queue, &err_msg, kTimeoutInfinite);
@@ -395,15 +568,19 @@ void ShipConnectionWebsocketCallback(WebsocketCallbackType type, const void* in,
   } else if (type == kWebsocketCallbackTypeClose) {
     static const ShipConnectionQueueMessage close_msg = {.type = kShipConnectionQueueMsgTypeWebsocketClose};
     EEBUS_QUEUE_SEND(sc->msg_queue, &close_msg, kTimeoutInfinite);
+  } else if ((type == kWebsocketCallbackTypeWriteDone) && ShipConnectionIsCloseMsgWritten(sc, in, size)) {
+    // Only the close message flush is of interest. The websocket thread shall not block on the full queue,
+    // the close timer completes the close if the notification cannot be queued
+    static const ShipConnectionQueueMessage write_done_msg = {.type = kShipConnectionQueueMsgTypeWriteDone};
+    EEBUS_QUEUE_SEND(sc->msg_queue, &write_done_msg, 0);
   }
+
+  return kEebusErrorOk;
 }
 
 void ShipConnectionTimeoutCallback(void* ctx) {
   ShipConnection* const sc             = (ShipConnection*)ctx;
-  ShipConnectionQueueMessage queue_msg = {
-      kShipConnectionQueueMsgTypeTimeout,
-      {NULL, 0, NULL}
-  };
+  ShipConnectionQueueMessage queue_msg = {.type = kShipConnectionQueueMsgTypeTimeout};
   EEBUS_QUEUE_SEND(sc->msg_queue, &queue_msg, kTimeoutInfinite);
 }
 
@@ -439,8 +616,8 @@ void ShipConnectionCloseWithError(ShipConnection* self, const char* err) {
   SHIP_CONNECTION_CLOSE_CONNECTION(self, true, 0, err);
 }
 
-EebusError ShipConnectionSend(ShipConnection* self, const MessageBuffer* buf) {
-  const size_t ret = WEBSOCKET_WRITE(self->websocket, buf->data, buf->data_size);
+EebusError ShipConnectionSend(ShipConnection* self, const MessageBuffer* buf, MessagePriority priority) {
+  const size_t ret = WEBSOCKET_WRITE(self->websocket, buf->data, buf->data_size, priority);
   if (ret != buf->data_size) {
     SHIP_CONNECTION_DEBUG_PRINTF("%s(), websocket write error\n", __func__);
     return kEebusErrorCommunication;
@@ -502,7 +679,12 @@ bool ShipConnectionEvaluateInitMsg(const MessageBuffer* buf) {
   return true;
 }
 
-EebusError ShipConnectionSerializeAndSendMessage(ShipConnection* self, const void* message, MsgValueType value_type) {
+EebusError ShipConnectionSerializeAndSendMessageWithPriority(
+    ShipConnection* self,
+    const void* message,
+    MsgValueType value_type,
+    MessagePriority priority
+) {
   ShipMessageSerializeObject* const serialize = ShipMessageSerializeCreate(message, value_type);
 
   MessageBuffer* const buf = SHIP_MESSAGE_SERIALIZE_GET_BUFFER(serialize);
@@ -511,11 +693,15 @@ EebusError ShipConnectionSerializeAndSendMessage(ShipConnection* self, const voi
     return kEebusErrorParse;
   }
 
-  const EebusError ret = ShipConnectionSend(self, buf);
+  const EebusError ret = ShipConnectionSend(self, buf, priority);
   ShipMessageSerializeDelete(serialize);
   return ret;
 }
 
+EebusError ShipConnectionSerializeAndSendMessage(ShipConnection* self, const void* message, MsgValueType value_type) {
+  return ShipConnectionSerializeAndSendMessageWithPriority(self, message, value_type, kMessagePriorityControl);
+}
+
 EebusError
 SmeHelloStateSendHelloMsg(ShipConnection* self, ConnectionHelloPhase phase, uint32_t wait_duration, bool prolongation) {
   ConnectionHello sme_hello = {.phase = phase};
@@ -1037,15 +1223,14 @@ EebusError DataExchangeHandleClose(ShipConnection* self, const ConnectionClose*
         .phase = kConnectionClosePhaseTypeConfirm,
     };
 
-    ShipConnectionSerializeAndSendMessage(self, &sme_close_confirm, kSmeClose);
-    EebusThreadUsleep(500000);  // Wait 0.5s for the message to be sent
-    WEBSOCKET_CLOSE(self->websocket, 4001, "close");
+    // Connection is closed as soon as the confirmation is written out
+    ShipConnectionBeginClose(self, &sme_close_confirm, true);
   } else if (sme_close->phase == kConnectionClosePhaseTypeConfirm) {
     // We got a confirmation so close this connection
-    WEBSOCKET_CLOSE(self->websocket, 4001, "close");
+    self->close_is_hs_ended = true;
+    ShipConnectionCompleteClose(self);
   }
 
-  INFO_PROVIDER_HANDLE_CONNECTION_CLOSED(self->info_provider, SHIP_CONNECTION_OBJECT(self), true);
   return kEebusErrorOk;
 }
 
@@ -1064,7 +1249,12 @@ EebusError DataExchangeHandleReceive(ShipConnection* self, const MessageBuffer*
 
     if (data != NULL) {
       // Pass the payload to the SPINE read handler
-      SHIP_CONNECTION_DEBUG_PRINTF("Recv:    %s\n", (const char*)data->payload.data);
+      if (self->format == kMessageProtocolFormatTypeCbor) {
+        SHIP_CONNECTION_DEBUG_PRINTF("Recv:    %zu bytes of CBOR\n", data->payload.data_size);
+      } else {
+        SHIP_CONNECTION_DEBUG_PRINTF("Recv:    %s\n", (const char*)data->payload.data);
+      }
+
       DATA_READER_HANDLE_MESSAGE(self->data_reader, &data->payload);
       ret = kEebusErrorOk;
     } else {
@@ -1093,8 +1283,13 @@ EebusError DataExchangeHandleReceive(ShipConnection* self, const MessageBuffer*
   return ret;
 }
 
-EebusError DataExchangeHandleSendSpineData(ShipConnection* self, const MessageBuffer* buf) {
-  SHIP_CONNECTION_DEBUG_PRINTF("Send:    %s\n", (const char*)buf->data);
+EebusError DataExchangeHandleSendSpineData(ShipConnection* self, const MessageBuffer* buf, MessagePriority priority) {
+  if (self->format == kMessageProtocolFormatTypeCbor) {
+    SHIP_CONNECTION_DEBUG_PRINTF("Send:    %zu bytes of CBOR\n", buf->data_size);
+  } else {
+    SHIP_CONNECTION_DEBUG_PRINTF("Send:    %s\n", (const char*)buf->data);
+  }
+
   const Data data = {
       .header = {
           .protocol_id = SHIP_PROTOCOL_ID,
@@ -1104,7 +1299,7 @@ EebusError DataExchangeHandleSendSpineData(ShipConnection* self, const MessageBu
       .extension = NULL,
   };
 
-  return ShipConnectionSerializeAndSendMessage(self, &data, kData);
+  return ShipConnectionSerializeAndSendMessageWithPriority(self, &data, kData, priority);
 }
 
 EebusError DataExchangeHandle(ShipConnection* self) {
@@ -1116,22 +1311,39 @@ EebusError DataExchangeHandle(ShipConnection* self) {
     return queue_recv_ret;
   }
 
+  // The room is made, the deferred SPINE messages are queued behind the ones queued before them
+  ShipConnectionRetryTxBacklog(self);
+
   if (queue_msg.type == kShipConnectionQueueMsgTypeDataReceived) {
     const EebusError ret = DataExchangeHandleReceive(self, &queue_msg.msg_buf);
     MessageBufferRelease(&queue_msg.msg_buf);
     return ret;
   } else if (queue_msg.type == kShipConnectionQueueMsgTypeSpineDataToSend) {
-    const EebusError ret = DataExchangeHandleSendSpineData(self, &queue_msg.msg_buf);
+    // No more data is sent after the connection termination message
+    const EebusError ret
+        = self->is_close_pending ? kEebusErrorOk
+                                 : DataExchangeHandleSendSpineData(self, &queue_msg.msg_buf, queue_msg.priority);
     MessageBufferRelease(&queue_msg.msg_buf);
     return ret;
   } else if (queue_msg.type == kShipConnectionQueueMsgTypeCancel) {
     SHIP_CONNECTION_DEBUG_PRINTF("%s(), cancelled\n", __func__);
     return kEebusErrorOk;
+  } else if (self->is_close_pending
+             && ((queue_msg.type == kShipConnectionQueueMsgTypeWriteDone)
+                 || (queue_msg.type == kShipConnectionQueueMsgTypeTimeout)
+                 || (queue_msg.type == kShipConnectionQueueMsgTypeWebsocketClose)
+                 || (queue_msg.type == kShipConnectionQueueMsgTypeWebsocketError))) {
+    // Close message is written out, timed out or the remote has gone already
+    ShipConnectionCompleteClose(self);
+    return kEebusErrorOk;
+  } else if (queue_msg.type == kShipConnectionQueueMsgTypeWriteDone) {
+    return kEebusErrorOk;
   } else if (queue_msg.type == kShipConnectionQueueMsgTypeTimeout) {
     SHIP_CONNECTION_DEBUG_PRINTF("%s(), timed out\n", __func__);
     return kEebusErrorCommunication;
   } else if (queue_msg.type == kShipConnectionQueueMsgTypeWebsocketClose) {
-    SHIP_CONNECTION_CLOSE_CONNECTION(self, true, 0, NULL);
+    // Remote has closed the websocket already, no termination announce can be delivered
+    SHIP_CONNECTION_CLOSE_CONNECTION(self, false, 0, NULL);
     return kEebusErrorOk;
   } else if (queue_msg.type == kShipConnectionQueueMsgTypeWebsocketError) {
     return kEebusErrorCommunication;
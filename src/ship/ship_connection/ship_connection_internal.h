@@ -20,13 +20,16 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "src/common/api/eebus_mutex_interface.h"
 #include "src/common/api/eebus_queue_interface.h"
 #include "src/common/api/eebus_timer_interface.h"
 #include "src/common/eebus_errors.h"
 #include "src/common/eebus_thread/eebus_thread.h"
 #include "src/common/message_buffer.h"
+#include "src/common/vector.h"
 #include "src/ship/api/data_writer_interface.h"
 #include "src/ship/api/info_provider_interface.h"
+#include "src/ship/api/message_priority.h"
 #include "src/ship/api/tls_certificate_interface.h"
 #include "src/ship/api/websocket_creator_interface.h"
 #include "src/ship/api/websocket_interface.h"
@@ -51,6 +54,7 @@ enum ShipConnectionQueueMsgType {
   kShipConnectionQueueMsgTypeWebsocketError,
   kShipConnectionQueueMsgTypeWebsocketClose,
   kShipConnectionQueueMsgTypeCancel,
+  kShipConnectionQueueMsgTypeWriteDone,
 };
 
 typedef enum ShipConnectionQueueMsgType ShipConnectionQueueMsgType;
@@ -60,6 +64,8 @@ typedef struct ShipConnectionQueueMessage ShipConnectionQueueMessage;
 struct ShipConnectionQueueMessage {
   ShipConnectionQueueMsgType type;
   MessageBuffer msg_buf;
+  /** Websocket write priority of the SPINE data to send */
+  MessagePriority priority;
 };
 
 typedef struct {
@@ -78,19 +84,46 @@ typedef struct {
   SmeState sme_state;
   EebusError sme_error;
   bool is_access_methods_req_sent;
+  /** Message protocol format agreed on the protocol handshake */
+  MessageProtocolFormatType format;
+  /** CBOR is offered to the server on the protocol handshake, set by the client only if opted in for the SKI */
+  bool is_cbor_offered;
   EebusTimerObject* wait_for_ready_timer;
   EebusTimerObject* send_prolongation_request_timer;
   EebusTimerObject* prolongation_request_reply_timer;
+  // Fallback for the close message flush, in case the write completion is never reported
+  EebusTimerObject* close_timer;
   uint32_t last_received_waiting_value;
   // TODO: investigate better approach for call once in POSIX, e.g.
   // pthread_once_t shutdownOnce;
   bool shutdown_once;
+  // Close message is sent, the connection is closed once the message itself is written out.
+  // Changed by the SHIP thread only, under the close_mutex as the websocket thread reads it
+  bool is_close_pending;
+  /** Copy of the sent close message, its write completion is recognized by the content */
+  MessageBuffer close_msg;
+  /** Guards the close state shared with the websocket thread */
+  EebusMutexObject* close_mutex;
+  bool close_is_hs_ended;
 
   bool cancel;
 
   EebusQueueObject* msg_queue;
   EebusThreadObject* thread;
   MessageBuffer msg;
+
+  /** Outgoing SPINE messages waiting for the room in the queue, moved to the queue by the SHIP thread */
+  Vector tx_backlog;
+  /** Guards the outgoing SPINE messages backlog shared with the SPINE thread */
+  EebusMutexObject* tx_mutex;
+
+  // Flow control counters
+  /** Outgoing SPINE messages put into the backlog, as the queue has not been drained in time */
+  uint32_t tx_busy_cnt;
+  /** Maximum number of the outgoing SPINE messages in the backlog at once */
+  size_t tx_backlog_depth_max;
+  /** Received messages deferred by the websocket, as the queue was full */
+  uint32_t rx_busy_cnt;
 } ShipConnection;
 
 #define SHIP_CONNECTION(obj) ((ShipConnection*)(obj))
@@ -102,10 +135,12 @@ void ShipConnectionSetSmeState(ShipConnection* self, SmeState state);
 
 void ShipConnectionCloseWithError(ShipConnection* self, const char* error);
 
-EebusError ShipConnectionSend(ShipConnection* self, const MessageBuffer* buf);
+EebusError ShipConnectionSend(ShipConnection* self, const MessageBuffer* buf, MessagePriority priority);
 
 EebusError ShipConnectionReceive(ShipConnection* self, MessageBuffer* buf, uint32_t timeout);
 
+void ShipConnectionRetryTxBacklog(ShipConnection* self);
+
 bool ShipConnectionEvaluateInitMsg(const MessageBuffer* buf);
 
 void SmeProtHandshakeStateAbort(ShipConnection* self, MessageProtocolHandshakeErrorType error);
@@ -136,7 +171,7 @@ void SmeStateApproved(ShipConnection* self);
 
 void DataExchange(ShipConnection* self);
 
-void ShipConnectionWebsocketCallback(WebsocketCallbackType type, const void* in, size_t size, void* ctx);
+EebusError ShipConnectionWebsocketCallback(WebsocketCallbackType type, const void* in, size_t size, void* ctx);
 
 #ifdef __cplusplus
 }
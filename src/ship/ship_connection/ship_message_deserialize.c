@@ -16,6 +16,14 @@
 /**
  * @file
  * @brief Ship Message Deserialize implementation
+ *
+ * The message is recognised by the SHIP message type byte together with the name of
+ * a top level member via a lookup table, which also provides the size of the value
+ * to be allocated and the decoder filling it in.
+ *
+ * Data message carrying the CBOR encoded payload (see kMessageProtocolFormatTypeCbor)
+ * is CBOR encoded as well. Its layout is fixed, so it is walked straight through
+ * without building up a tree and the payload bytes are taken over as they are.
  */
 
 #ifdef __freertos__
@@ -27,13 +35,28 @@
 #include <string.h>
 
 #include "src/common/array_util.h"
+#include "src/common/cbor.h"
 #include "src/common/eebus_errors.h"
 #include "src/common/eebus_malloc.h"
+#include "src/common/json.h"
 #include "src/common/message_buffer.h"
 #include "src/common/string_util.h"
 #include "src/ship/api/ship_message_deserialize_interface.h"
 #include "src/ship/model/model.h"
 
+typedef EebusError (*ShipMessageDecoder)(void* value, const cJSON* json_ar);
+
+typedef struct ShipMessageDecoderEntry ShipMessageDecoderEntry;
+
+struct ShipMessageDecoderEntry {
+  /** Name of the single top level member the message is recognised by */
+  const char* key;
+  MsgType msg_type;
+  MsgValueType value_type;
+  size_t value_size;
+  ShipMessageDecoder decode;
+};
+
 typedef struct ShipMessageDeserialize ShipMessageDeserialize;
 
 struct ShipMessageDeserialize {
@@ -57,20 +80,97 @@ static const ShipMessageDeserializeInterface ship_message_deserialize_methods =
 };
 
 static void ShipMessageDeserializeConstruct(ShipMessageDeserialize* self, MessageBuffer* buf);
-static EebusError SmeHelloDeserialize(ConnectionHello* sme_hello, const cJSON* sme_hello_ar);
-static EebusError SmeProtocolHandshakeDeserialize(MessageProtocolHandshake* sme_prot_hs, const cJSON* sme_prot_hs_ar);
-static EebusError SmeProtocolHandshakeErrorDeserialize(
-    MessageProtocolHandshakeError* sme_prot_hs_err, const cJSON* sme_prot_hs_err_ar);
-static EebusError SmeConnectionPinStateDeserialize(ConnectionPinState* sme_pin_state, const cJSON* pin_state_ar);
-static EebusError SmeConnectionPinInputDeserialize(ConnectionPinInput* sme_pin_input, const cJSON* pin_input_ar);
-static EebusError SmeConnectionPinErrorDeserialize(ConnectionPinError* sme_pin_error, const cJSON* pin_error_ar);
-static EebusError DataDeserialize(Data* data, const cJSON* data_ar);
-static EebusError SmeConnectionAccessMethodsRequestDeserialize(
-    AccessMethodsRequest* access_metods_request, const cJSON* access_methods_req_ar);
-static EebusError SmeConnectionAccessMethodsDeserialize(
-    AccessMethods* sme_access_methods, const cJSON* access_methods_ar);
-static EebusError SmeCloseDeserialize(ConnectionClose* sme_close, const cJSON* close_ar);
+static EebusError SmeHelloDeserialize(void* value, const cJSON* sme_hello_ar);
+static EebusError SmeProtocolHandshakeDeserialize(void* value, const cJSON* sme_prot_hs_ar);
+static EebusError SmeProtocolHandshakeErrorDeserialize(void* value, const cJSON* sme_prot_hs_err_ar);
+static EebusError SmeConnectionPinStateDeserialize(void* value, const cJSON* pin_state_ar);
+static EebusError SmeConnectionPinInputDeserialize(void* value, const cJSON* pin_input_ar);
+static EebusError SmeConnectionPinErrorDeserialize(void* value, const cJSON* pin_error_ar);
+static EebusError DataDeserialize(void* value, const cJSON* data_ar);
+static EebusError SmeConnectionAccessMethodsRequestDeserialize(void* value, const cJSON* access_methods_req_ar);
+static EebusError SmeConnectionAccessMethodsDeserialize(void* value, const cJSON* access_methods_ar);
+static EebusError SmeCloseDeserialize(void* value, const cJSON* close_ar);
+static bool KeyEqualsIgnoreCase(const char* key, const char* other_key);
+static const ShipMessageDecoderEntry* FindDecoderByKey(MsgType msg_type, const char* key);
+static const ShipMessageDecoderEntry* FindDecoder(MsgType msg_type, const cJSON* json_root, const cJSON** json_ar);
 static void Deserialize(ShipMessageDeserialize* self, MessageBuffer* buf);
+static bool CborReadHead(const uint8_t** p, const uint8_t* end, uint8_t major_type, uint64_t* value);
+static bool CborReadKey(const uint8_t** p, const uint8_t* end, const char* key);
+static EebusError DataDeserializeCbor(Data* data, const uint8_t* buf, size_t buf_size);
+static void DeserializeCbor(ShipMessageDeserialize* self, const uint8_t* buf, size_t buf_size);
+
+static const ShipMessageDecoderEntry ship_message_decoders[] = {
+    {
+     .key        = "connectionHello",
+     .msg_type   = kMsgTypeControl,
+     .value_type = kSmeHello,
+     .value_size = sizeof(ConnectionHello),
+     .decode     = SmeHelloDeserialize,
+     },
+    {
+     .key        = "messageProtocolHandshake",
+     .msg_type   = kMsgTypeControl,
+     .value_type = kSmeProtocolHandshake,
+     .value_size = sizeof(MessageProtocolHandshake),
+     .decode     = SmeProtocolHandshakeDeserialize,
+     },
+    {
+     .key        = "messageProtocolHandshakeError",
+     .msg_type   = kMsgTypeControl,
+     .value_type = kSmeProtocolHandshakeError,
+     .value_size = sizeof(MessageProtocolHandshakeError),
+     .decode     = SmeProtocolHandshakeErrorDeserialize,
+     },
+    {
+     .key        = "connectionPinState",
+     .msg_type   = kMsgTypeControl,
+     .value_type = kSmeConnectionPinState,
+     .value_size = sizeof(ConnectionPinState),
+     .decode     = SmeConnectionPinStateDeserialize,
+     },
+    {
+     .key        = "connectionPinInput",
+     .msg_type   = kMsgTypeControl,
+     .value_type = kSmeConnectionPinInput,
+     .value_size = sizeof(ConnectionPinInput),
+     .decode     = SmeConnectionPinInputDeserialize,
+     },
+    {
+     .key        = "connectionPinError",
+     .msg_type   = kMsgTypeControl,
+     .value_type = kSmeConnectionPinError,
+     .value_size = sizeof(ConnectionPinError),
+     .decode     = SmeConnectionPinErrorDeserialize,
+     },
+    {
+     .key        = "accessMethodsRequest",
+     .msg_type   = kMsgTypeControl,
+     .value_type = kSmeConnectionAccessMethodsRequest,
+     .value_size = sizeof(AccessMethodsRequest),
+     .decode     = SmeConnectionAccessMethodsRequestDeserialize,
+     },
+    {
+     .key        = "accessMethods",
+     .msg_type   = kMsgTypeControl,
+     .value_type = kSmeConnectionAccessMethods,
+     .value_size = sizeof(AccessMethods),
+     .decode     = SmeConnectionAccessMethodsDeserialize,
+     },
+    {
+     .key        = "data",
+     .msg_type   = kMsgTypeData,
+     .value_type = kData,
+     .value_size = sizeof(Data),
+     .decode     = DataDeserialize,
+     },
+    {
+     .key        = "connectionClose",
+     .msg_type   = kMsgTypeEnd,
+     .value_type = kSmeClose,
+     .value_size = sizeof(ConnectionClose),
+     .decode     = SmeCloseDeserialize,
+     },
+};
 
 void ShipMessageDeserializeConstruct(ShipMessageDeserialize* self, MessageBuffer* buf) {
   // Override "virtual functions table"
@@ -200,7 +300,9 @@ bool ConnectionHelloParseProlongReq(ConnectionHello* sme_hello, cJSON* json_obj)
   return true;
 }
 
-EebusError SmeHelloDeserialize(ConnectionHello* sme_hello, const cJSON* sme_hello_ar) {
+EebusError SmeHelloDeserialize(void* value, const cJSON* sme_hello_ar) {
+  ConnectionHello* const sme_hello = (ConnectionHello*)value;
+
   if ((sme_hello == NULL) || (sme_hello_ar == NULL)) {
     return kEebusErrorInputArgument;
   }
@@ -280,32 +382,40 @@ bool MessageProtocolHandshakeParseFormats(MessageProtocolHandshake* sme_prot_hs,
     return false;
   }
 
-  const size_t format_size = cJSON_GetArraySize(format_ar);
-  if (format_size > ARRAY_SIZE(sme_prot_hs->formats.format)) {
-    return false;
-  }
-
-  for (size_t i = 0; i < format_size; ++i) {
+  size_t format_size = 0;
+  for (size_t i = 0; i < (size_t)cJSON_GetArraySize(format_ar); ++i) {
     cJSON* const format_i    = cJSON_GetArrayItem(format_ar, (int)i);
     const char* const format = cJSON_GetStringValue(format_i);
     if (format == NULL) {
       return false;
     }
 
+    MessageProtocolFormatType format_type = kMessageProtocolFormatTypeUTF8;
     if (!strcmp(format, "JSON-UTF8")) {
-      sme_prot_hs->formats.format[i] = kMessageProtocolFormatTypeUTF8;
+      format_type = kMessageProtocolFormatTypeUTF8;
     } else if (!strcmp(format, "JSON-UTF16")) {
-      sme_prot_hs->formats.format[i] = kMessageProtocolFormatTypeUTF16;
+      format_type = kMessageProtocolFormatTypeUTF16;
+    } else if (!strcmp(format, "openeebus-CBOR")) {
+      format_type = kMessageProtocolFormatTypeCbor;
     } else {
+      // The formats unknown to us are offered by the peer in addition, skip them
+      continue;
+    }
+
+    if (format_size >= ARRAY_SIZE(sme_prot_hs->formats.format)) {
       return false;
     }
+
+    sme_prot_hs->formats.format[format_size++] = format_type;
   }
 
   sme_prot_hs->formats.format_size = format_size;
   return true;
 }
 
-EebusError SmeProtocolHandshakeDeserialize(MessageProtocolHandshake* sme_prot_hs, const cJSON* sme_prot_hs_ar) {
+EebusError SmeProtocolHandshakeDeserialize(void* value, const cJSON* sme_prot_hs_ar) {
+  MessageProtocolHandshake* const sme_prot_hs = (MessageProtocolHandshake*)value;
+
   if ((sme_prot_hs == NULL) || (sme_prot_hs_ar == NULL)) {
     return kEebusErrorInputArgument;
   }
@@ -343,8 +453,9 @@ bool MessageProtocolHandshakeErrorParseError(MessageProtocolHandshakeError* sme_
          && (error <= kMessageProtocolHandshakeErrorTypeSelectionMismatch);
 }
 
-EebusError SmeProtocolHandshakeErrorDeserialize(
-    MessageProtocolHandshakeError* sme_prot_hs_err, const cJSON* sme_prot_hs_err_ar) {
+EebusError SmeProtocolHandshakeErrorDeserialize(void* value, const cJSON* sme_prot_hs_err_ar) {
+  MessageProtocolHandshakeError* const sme_prot_hs_err = (MessageProtocolHandshakeError*)value;
+
   if ((sme_prot_hs_err == NULL) || (sme_prot_hs_err_ar == NULL)) {
     return kEebusErrorInputArgument;
   }
@@ -407,7 +518,9 @@ bool ConnectionPinStateParseInputPermission(ConnectionPinState* sme_pin_state, c
   return true;
 }
 
-EebusError SmeConnectionPinStateDeserialize(ConnectionPinState* sme_pin_state, const cJSON* pin_state_ar) {
+EebusError SmeConnectionPinStateDeserialize(void* value, const cJSON* pin_state_ar) {
+  ConnectionPinState* const sme_pin_state = (ConnectionPinState*)value;
+
   if ((sme_pin_state == NULL) || (pin_state_ar == NULL)) {
     return kEebusErrorInputArgument;
   }
@@ -463,7 +576,9 @@ bool ConnectionPinInputParsePin(ConnectionPinInput* sme_pin_input, cJSON* json_o
   return true;
 }
 
-EebusError SmeConnectionPinInputDeserialize(ConnectionPinInput* sme_pin_input, const cJSON* pin_input_ar) {
+EebusError SmeConnectionPinInputDeserialize(void* value, const cJSON* pin_input_ar) {
+  ConnectionPinInput* const sme_pin_input = (ConnectionPinInput*)value;
+
   if ((sme_pin_input == NULL) || (pin_input_ar == NULL)) {
     return kEebusErrorInputArgument;
   }
@@ -490,7 +605,9 @@ bool ConnectionPinErrorParseError(ConnectionPinError* sme_pin_error, cJSON* json
   return sme_pin_error->error == kConnectionPinErrorTypeWrongPin;
 }
 
-EebusError SmeConnectionPinErrorDeserialize(ConnectionPinError* sme_pin_error, const cJSON* pin_error_ar) {
+EebusError SmeConnectionPinErrorDeserialize(void* value, const cJSON* pin_error_ar) {
+  ConnectionPinError* const sme_pin_error = (ConnectionPinError*)value;
+
   if ((sme_pin_error == NULL) || (pin_error_ar == NULL)) {
     return kEebusErrorInputArgument;
   }
@@ -535,7 +652,9 @@ bool DataParsePayload(Data* data, const cJSON* json_obj) {
   return true;
 }
 
-EebusError DataDeserialize(Data* data, const cJSON* data_ar) {
+EebusError DataDeserialize(void* value, const cJSON* data_ar) {
+  Data* const data = (Data*)value;
+
   if (data == NULL) {
     return kEebusErrorInputArgument;
   }
@@ -560,8 +679,9 @@ EebusError DataDeserialize(Data* data, const cJSON* data_ar) {
   return ok ? kEebusErrorOk : kEebusErrorParse;
 }
 
-EebusError SmeConnectionAccessMethodsRequestDeserialize(
-    AccessMethodsRequest* sme_access_methods_req, const cJSON* access_metods_req_ar) {
+EebusError SmeConnectionAccessMethodsRequestDeserialize(void* value, const cJSON* access_metods_req_ar) {
+  AccessMethodsRequest* const sme_access_methods_req = (AccessMethodsRequest*)value;
+
   if ((sme_access_methods_req == NULL) || (access_metods_req_ar == NULL)) {
     return kEebusErrorInputArgument;
   }
@@ -607,7 +727,9 @@ bool AccessMethodsParseDns(AccessMethods* sme_access_methods, cJSON* json_obj) {
   return sme_access_methods->dns.uri != NULL;
 }
 
-EebusError SmeConnectionAccessMethodsDeserialize(AccessMethods* sme_access_methods, const cJSON* access_methods_ar) {
+EebusError SmeConnectionAccessMethodsDeserialize(void* value, const cJSON* access_methods_ar) {
+  AccessMethods* const sme_access_methods = (AccessMethods*)value;
+
   if (sme_access_methods == NULL) {
     return kEebusErrorInputArgument;
   }
@@ -693,7 +815,9 @@ EebusError ConnectionCloseParseReason(ConnectionClose* sme_close, cJSON* json_ob
   return sme_close->reason != NULL;
 }
 
-EebusError SmeCloseDeserialize(ConnectionClose* sme_close, const cJSON* close_ar) {
+EebusError SmeCloseDeserialize(void* value, const cJSON* close_ar) {
+  ConnectionClose* const sme_close = (ConnectionClose*)value;
+
   if (sme_close == NULL) {
     return kEebusErrorInputArgument;
   }
@@ -730,66 +854,53 @@ EebusError SmeCloseDeserialize(ConnectionClose* sme_close, const cJSON* close_ar
   return ok ? kEebusErrorOk : kEebusErrorParse;
 }
 
-EebusError DeserializeControlMessage(ShipMessageDeserialize* self, cJSON* json_root) {
-  cJSON* json_ar = NULL;
-
-  if ((json_ar = cJSON_GetObjectItem(json_root, "connectionHello")) != NULL) {
-    self->value      = EEBUS_MALLOC(sizeof(ConnectionHello));
-    self->value_type = kSmeHello;
-    return SmeHelloDeserialize((ConnectionHello*)self->value, json_ar);
-  } else if ((json_ar = cJSON_GetObjectItem(json_root, "messageProtocolHandshake")) != NULL) {
-    self->value      = EEBUS_MALLOC(sizeof(MessageProtocolHandshake));
-    self->value_type = kSmeProtocolHandshake;
-    return SmeProtocolHandshakeDeserialize((MessageProtocolHandshake*)self->value, json_ar);
-  } else if ((json_ar = cJSON_GetObjectItem(json_root, "messageProtocolHandshakeError")) != NULL) {
-    self->value      = EEBUS_MALLOC(sizeof(MessageProtocolHandshakeError));
-    self->value_type = kSmeProtocolHandshakeError;
-    return SmeProtocolHandshakeErrorDeserialize((MessageProtocolHandshakeError*)self->value, json_ar);
-  } else if ((json_ar = cJSON_GetObjectItem(json_root, "connectionPinState")) != NULL) {
-    self->value      = EEBUS_MALLOC(sizeof(ConnectionPinState));
-    self->value_type = kSmeConnectionPinState;
-    return SmeConnectionPinStateDeserialize((ConnectionPinState*)self->value, json_ar);
-  } else if ((json_ar = cJSON_GetObjectItem(json_root, "connectionPinInput")) != NULL) {
-    self->value      = EEBUS_MALLOC(sizeof(ConnectionPinInput));
-    self->value_type = kSmeConnectionPinInput;
-    return SmeConnectionPinInputDeserialize((ConnectionPinInput*)self->value, json_ar);
-  } else if ((json_ar = cJSON_GetObjectItem(json_root, "connectionPinError")) != NULL) {
-    self->value      = EEBUS_MALLOC(sizeof(ConnectionPinError));
-    self->value_type = kSmeConnectionPinError;
-    return SmeConnectionPinErrorDeserialize((ConnectionPinError*)self->value, json_ar);
-  } else if ((json_ar = cJSON_GetObjectItem(json_root, "accessMethodsRequest")) != NULL) {
-    self->value      = EEBUS_MALLOC(sizeof(AccessMethodsRequest));
-    self->value_type = kSmeConnectionAccessMethodsRequest;
-    return SmeConnectionAccessMethodsRequestDeserialize((AccessMethodsRequest*)self->value, json_ar);
-  } else if ((json_ar = cJSON_GetObjectItem(json_root, "accessMethods")) != NULL) {
-    self->value      = EEBUS_MALLOC(sizeof(AccessMethods));
-    self->value_type = kSmeConnectionAccessMethods;
-    return SmeConnectionAccessMethodsDeserialize((AccessMethods*)self->value, json_ar);
-  } else {
-    return kEebusErrorInputArgument;
+bool KeyEqualsIgnoreCase(const char* key, const char* other_key) {
+  for (; (*key != '\0') && (*other_key != '\0'); ++key, ++other_key) {
+    if (tolower((unsigned char)*key) != tolower((unsigned char)*other_key)) {
+      return false;
+    }
   }
+
+  return *key == *other_key;
 }
 
-EebusError DeserializeDataMessage(ShipMessageDeserialize* self, cJSON* json_root) {
-  cJSON* json_ar = NULL;
-  if ((json_ar = cJSON_GetObjectItem(json_root, "data")) != NULL) {
-    self->value      = EEBUS_MALLOC(sizeof(Data));
-    self->value_type = kData;
-    return DataDeserialize((Data*)self->value, json_ar);
-  } else {
-    return kEebusErrorInputArgument;
+const ShipMessageDecoderEntry* FindDecoderByKey(MsgType msg_type, const char* key) {
+  for (size_t i = 0; i < ARRAY_SIZE(ship_message_decoders); ++i) {
+    const ShipMessageDecoderEntry* const entry = &ship_message_decoders[i];
+    if ((entry->msg_type == msg_type) && KeyEqualsIgnoreCase(entry->key, key)) {
+      return entry;
+    }
   }
+
+  return NULL;
 }
 
-EebusError DeserializeEndMessage(ShipMessageDeserialize* self, cJSON* json_root) {
-  cJSON* json_ar = NULL;
-  if ((json_ar = cJSON_GetObjectItem(json_root, "connectionClose")) != NULL) {
-    self->value      = EEBUS_MALLOC(sizeof(ConnectionClose));
-    self->value_type = kSmeClose;
-    return SmeCloseDeserialize((ConnectionClose*)self->value, json_ar);
-  } else {
-    return kEebusErrorInputArgument;
+const ShipMessageDecoderEntry* FindDecoder(MsgType msg_type, const cJSON* json_root, const cJSON** json_ar) {
+  // A SHIP message is an object with a single member named after the message, dispatch on it straight away
+  const cJSON* const json_msg = json_root->child;
+  if ((json_msg != NULL) && (json_msg->string != NULL)) {
+    const ShipMessageDecoderEntry* const entry = FindDecoderByKey(msg_type, json_msg->string);
+    if (entry != NULL) {
+      *json_ar = json_msg;
+      return entry;
+    }
+  }
+
+  // Otherwise the member names are looked up as before: the other members are ignored,
+  // the first table entry found wins
+  for (size_t i = 0; i < ARRAY_SIZE(ship_message_decoders); ++i) {
+    const ShipMessageDecoderEntry* const entry = &ship_message_decoders[i];
+    if (entry->msg_type != msg_type) {
+      continue;
+    }
+
+    *json_ar = cJSON_GetObjectItem(json_root, entry->key);
+    if (*json_ar != NULL) {
+      return entry;
+    }
   }
+
+  return NULL;
 }
 
 void Deserialize(ShipMessageDeserialize* self, MessageBuffer* buf) {
@@ -802,24 +913,34 @@ void Deserialize(ShipMessageDeserialize* self, MessageBuffer* buf) {
     return;
   }
 
+  // Json message always starts with '{', so that it is never taken for a CBOR map
+  if ((msg_type == kMsgTypeData) && CborIsMap(&buf->data[1], buf->data_size - 1)) {
+    DeserializeCbor(self, &buf->data[1], buf->data_size - 1);
+    return;
+  }
+
   if (!ShipMessageToString(buf)) {
     return;
   }
 
-  cJSON* const json_root = cJSON_Parse((const char*)buf->data);
+  // Parsed via the Json layer to keep the exact integers of the payload (e.g. msgCounter beyond 2^53)
+  cJSON* const json_root = (cJSON*)JsonParse((const char*)buf->data);
   if (json_root == NULL) {
     return;
   }
 
-  EebusError ret = kEebusErrorOk;
-  if (msg_type == kMsgTypeControl) {
-    ret = DeserializeControlMessage(self, json_root);
-  } else if (msg_type == kMsgTypeData) {
-    ret = DeserializeDataMessage(self, json_root);
-  } else if (msg_type == kMsgTypeEnd) {
-    ret = DeserializeEndMessage(self, json_root);
-  } else {
-    ret = kEebusErrorParse;
+  EebusError ret = kEebusErrorParse;
+  if ((msg_type == kMsgTypeControl) || (msg_type == kMsgTypeData) || (msg_type == kMsgTypeEnd)) {
+    const cJSON* json_ar = NULL;
+
+    const ShipMessageDecoderEntry* const entry = FindDecoder((MsgType)msg_type, json_root, &json_ar);
+    if (entry != NULL) {
+      self->value      = EEBUS_MALLOC(entry->value_size);
+      self->value_type = entry->value_type;
+      ret              = entry->decode(self->value, json_ar);
+    } else {
+      ret = kEebusErrorInputArgument;
+    }
   }
 
   cJSON_Delete(json_root);
@@ -828,3 +949,83 @@ void Deserialize(ShipMessageDeserialize* self, MessageBuffer* buf) {
     DeserializeReset(self);
   }
 }
+
+bool CborReadHead(const uint8_t** p, const uint8_t* end, uint8_t major_type, uint64_t* value) {
+  uint8_t read_major_type = 0;
+  uint8_t additional_info = 0;
+
+  const size_t head_size = CborDecodeHead(*p, (size_t)(end - *p), &read_major_type, &additional_info, value);
+  if ((head_size == 0) || (read_major_type != major_type)) {
+    return false;
+  }
+
+  *p += head_size;
+  return true;
+}
+
+bool CborReadKey(const uint8_t** p, const uint8_t* end, const char* key) {
+  uint64_t len = 0;
+  if (!CborReadHead(p, end, CBOR_MAJOR_TYPE_TEXT, &len)) {
+    return false;
+  }
+
+  if ((len != strlen(key)) || (len > (uint64_t)(end - *p)) || (memcmp(*p, key, (size_t)len) != 0)) {
+    return false;
+  }
+
+  *p += len;
+  return true;
+}
+
+EebusError DataDeserializeCbor(Data* data, const uint8_t* buf, size_t buf_size) {
+  MessageBufferInit(&data->payload, NULL, 0);
+  data->extension = NULL;
+
+  // {"data":[{"header":[{"protocolId":"..."}]},{"payload":{...}}]}
+  const uint8_t* p         = buf;
+  const uint8_t* const end = buf + buf_size;
+
+  uint64_t n = 0;
+
+  bool ok = CborReadHead(&p, end, CBOR_MAJOR_TYPE_MAP, &n) && (n == 1) && CborReadKey(&p, end, "data");
+  ok      = ok && CborReadHead(&p, end, CBOR_MAJOR_TYPE_ARRAY, &n) && (n == 2);
+  ok      = ok && CborReadHead(&p, end, CBOR_MAJOR_TYPE_MAP, &n) && (n == 1) && CborReadKey(&p, end, "header");
+  ok      = ok && CborReadHead(&p, end, CBOR_MAJOR_TYPE_ARRAY, &n) && (n == 1);
+  ok      = ok && CborReadHead(&p, end, CBOR_MAJOR_TYPE_MAP, &n) && (n == 1) && CborReadKey(&p, end, "protocolId");
+  ok      = ok && CborReadHead(&p, end, CBOR_MAJOR_TYPE_TEXT, &n);
+  if ((!ok) || (n >= sizeof(data->header.protocol_id)) || (n > (uint64_t)(end - p))) {
+    return kEebusErrorParse;
+  }
+
+  memcpy(data->header.protocol_id, p, (size_t)n);
+  data->header.protocol_id[n] = '\0';
+  p += n;
+
+  ok = CborReadHead(&p, end, CBOR_MAJOR_TYPE_MAP, &n) && (n == 1) && CborReadKey(&p, end, "payload");
+  if ((!ok) || !CborIsMap(p, (size_t)(end - p))) {
+    return kEebusErrorParse;
+  }
+
+  // The payload is the last item, it is validated by SPINE while parsing
+  const size_t payload_size = (size_t)(end - p);
+  uint8_t* const payload    = (uint8_t*)EEBUS_MALLOC(payload_size);
+  if (payload == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  memcpy(payload, p, payload_size);
+  MessageBufferInit(&data->payload, payload, payload_size);
+  return kEebusErrorOk;
+}
+
+void DeserializeCbor(ShipMessageDeserialize* self, const uint8_t* buf, size_t buf_size) {
+  self->value = EEBUS_MALLOC(sizeof(Data));
+  if (self->value == NULL) {
+    return;
+  }
+
+  self->value_type = kData;
+  if (DataDeserializeCbor((Data*)self->value, buf, buf_size) != kEebusErrorOk) {
+    DeserializeReset(self);
+  }
+}
@@ -16,25 +16,52 @@
 /**
  * @file
  * @brief Ship Message Serialize implementation
+ *
+ * SHIP messages have a fixed layout, so they are emitted from per message type
+ * templates straight into the output buffer rather than built up as cJSON tree
+ * and printed. The template is run twice: the first pass only counts the message
+ * length, the second one writes the message into a buffer allocated once with
+ * the exact size.
+ *
+ * Data message carrying the CBOR encoded payload (see kMessageProtocolFormatTypeCbor)
+ * is emitted with CBOR as well, keeping the same layout as the Json one.
  */
 
 #include "src/ship/ship_connection/ship_message_serialize.h"
 
-#ifdef __freertos__
-#include <cJSON.h>
-#else
-#include <cjson/cJSON.h>
-#endif  // __freertos__
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "src/common/array_util.h"
+#include "src/common/cbor.h"
 #include "src/common/eebus_errors.h"
 #include "src/common/eebus_malloc.h"
-#include "src/common/json.h"
 #include "src/common/message_buffer.h"
 #include "src/ship/api/ship_message_serialize_interface.h"
 #include "src/ship/model/model.h"
 
+typedef struct ShipMessageWriter ShipMessageWriter;
+
+struct ShipMessageWriter {
+  /** Output buffer, NULL while counting the message length */
+  char* buf;
+  size_t buf_size;
+  size_t len;
+  bool ok;
+};
+
+typedef bool (*ShipMessageTemplate)(const void* value, ShipMessageWriter* writer);
+
+typedef struct ShipMessageTemplateEntry ShipMessageTemplateEntry;
+
+struct ShipMessageTemplateEntry {
+  MsgValueType value_type;
+  MsgType msg_type;
+  ShipMessageTemplate write;
+};
+
 typedef struct ShipMessageSerialize ShipMessageSerialize;
 
 struct ShipMessageSerialize {
@@ -42,7 +69,6 @@ struct ShipMessageSerialize {
   ShipMessageSerializeObject obj;
 
   MessageBuffer* buf;
-  cJSON* json_obj;
 };
 
 #define SHIP_MESSAGE_SERIALIZE(obj) ((ShipMessageSerialize*)(obj))
@@ -57,27 +83,42 @@ static const ShipMessageSerializeInterface ship_message_serialize_methods = {
 
 static void ShipMessageSerializeConstruct(ShipMessageSerialize* self, const void* value, MsgValueType value_type);
 static void SerializeReset(ShipMessageSerialize* self);
-static EebusError SmeHelloSerialize(const ConnectionHello* sme_hello, cJSON* sme_hello_obj);
-static EebusError SmeProtocolHandshakeSerialize(const MessageProtocolHandshake* sme_prot_hs, cJSON* sme_prot_hs_obj);
-static EebusError SmeProtocolHandshakeErrorSerialize(
-    const MessageProtocolHandshakeError* sme_prot_hs_err, cJSON* sme_prot_hs_obj);
-static EebusError SmeConnectionPinStateSerialize(const ConnectionPinState* sme_pin_state, cJSON* pin_state_obj);
-static EebusError SmeConnectionPinInputSerialize(const ConnectionPinInput* sme_pin_input, cJSON* pin_input_obj);
-static EebusError SmeConnectionPinErrorSerialize(const ConnectionPinError* sme_pin_error, cJSON* pin_error_obj);
-static EebusError DataSerialize(const Data* data, cJSON* data_obj);
-static EebusError SmeConnectionAccessMethodsRequestSerialize(
-    const AccessMethodsRequest* access_metods_request, cJSON* access_metods_req_obj);
-static EebusError SmeConnectionAccessMethodsSerialize(
-    const AccessMethods* sme_access_methods, cJSON* access_methods_obj);
-static EebusError SmeCloseSerialize(const ConnectionClose* sme_close, cJSON* sme_close_obj);
+static void WriterWrite(ShipMessageWriter* writer, const char* s, size_t len);
+static void WriterPrintf(ShipMessageWriter* writer, const char* fmt, ...);
+static void WriterString(ShipMessageWriter* writer, const char* s);
+static void WriterCborHead(ShipMessageWriter* writer, uint8_t major_type, uint64_t value);
+static void WriterCborText(ShipMessageWriter* writer, const char* s);
+static bool SmeHelloWrite(const void* value, ShipMessageWriter* writer);
+static bool SmeProtocolHandshakeWrite(const void* value, ShipMessageWriter* writer);
+static bool SmeProtocolHandshakeErrorWrite(const void* value, ShipMessageWriter* writer);
+static bool SmeConnectionPinStateWrite(const void* value, ShipMessageWriter* writer);
+static bool SmeConnectionPinInputWrite(const void* value, ShipMessageWriter* writer);
+static bool SmeConnectionPinErrorWrite(const void* value, ShipMessageWriter* writer);
+static bool DataWrite(const void* value, ShipMessageWriter* writer);
+static bool DataWriteCbor(const Data* data, ShipMessageWriter* writer);
+static bool SmeConnectionAccessMethodsRequestWrite(const void* value, ShipMessageWriter* writer);
+static bool SmeConnectionAccessMethodsWrite(const void* value, ShipMessageWriter* writer);
+static bool SmeCloseWrite(const void* value, ShipMessageWriter* writer);
 static EebusError Serialize(ShipMessageSerialize* self, const void* value, MsgValueType value_type);
 
+static const ShipMessageTemplateEntry ship_message_templates[] = {
+    {kSmeHello,                          kMsgTypeControl, SmeHelloWrite                         },
+    {kSmeProtocolHandshake,              kMsgTypeControl, SmeProtocolHandshakeWrite             },
+    {kSmeProtocolHandshakeError,         kMsgTypeControl, SmeProtocolHandshakeErrorWrite        },
+    {kSmeConnectionPinState,             kMsgTypeControl, SmeConnectionPinStateWrite            },
+    {kSmeConnectionPinInput,             kMsgTypeControl, SmeConnectionPinInputWrite            },
+    {kSmeConnectionPinError,             kMsgTypeControl, SmeConnectionPinErrorWrite            },
+    {kData,                              kMsgTypeData,    DataWrite                             },
+    {kSmeConnectionAccessMethodsRequest, kMsgTypeControl, SmeConnectionAccessMethodsRequestWrite},
+    {kSmeConnectionAccessMethods,        kMsgTypeControl, SmeConnectionAccessMethodsWrite       },
+    {kSmeClose,                          kMsgTypeEnd,     SmeCloseWrite                         },
+};
+
 void ShipMessageSerializeConstruct(ShipMessageSerialize* self, const void* value, MsgValueType value_type) {
   // Override "virtual functions table"
   SHIP_MESSAGE_SERIALIZE_INTERFACE(self) = &ship_message_serialize_methods;
 
-  self->buf      = NULL;
-  self->json_obj = NULL;
+  self->buf = NULL;
 
   if ((value == NULL) || (value_type == kValueUndefined)) {
     return;
@@ -98,11 +139,6 @@ ShipMessageSerializeObject* ShipMessageSerializeCreate(const void* value, MsgVal
 }
 
 void SerializeReset(ShipMessageSerialize* self) {
-  if (self->json_obj != NULL) {
-    cJSON_Delete(self->json_obj);
-    self->json_obj = NULL;
-  }
-
   if (self->buf != NULL) {
     MessageBufferRelease(self->buf);
     EEBUS_FREE(self->buf);
@@ -123,532 +159,325 @@ void ShipMessageSerializeDelete(ShipMessageSerializeObject* self) {
 
 MessageBuffer* GetBuffer(const ShipMessageSerializeObject* self) { return SHIP_MESSAGE_SERIALIZE(self)->buf; }
 
-bool StringToShipMessage(char* s, MessageBuffer* buf, MsgType msg_type) {
-  if ((s == NULL) || (buf == NULL)) {
-    return false;
-  }
-
-  size_t len = strlen(s);
-
-  if (len < 2) {
-    return false;
+void WriterWrite(ShipMessageWriter* writer, const char* s, size_t len) {
+  if (writer->buf != NULL) {
+    memcpy(&writer->buf[writer->len], s, len);
   }
 
-  for (size_t i = len; i >= 1; --i) {
-    s[i] = s[i - 1];
-  }
-
-  s[0] = (char)msg_type;
-
-  MessageBufferInitWithDeallocator(buf, (uint8_t*)s, len + 1, cJSON_free);
-  return true;
+  writer->len += len;
 }
 
-bool ConnectionHelloAddPhase(const ConnectionHello* sme_hello, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
-  }
-
-  cJSON* const phase_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-
-  const char* phase = NULL;
-  if (sme_hello->phase == kConnectionHelloPhasePending) {
-    phase = "pending";
-  } else if (sme_hello->phase == kConnectionHelloPhaseReady) {
-    phase = "ready";
-  } else if (sme_hello->phase == kConnectionHelloPhaseAborted) {
-    phase = "aborted";
-  } else {
-    return false;
+void WriterPrintf(ShipMessageWriter* writer, const char* fmt, ...) {
+  if (!writer->ok) {
+    return;
   }
 
-  return cJSON_AddStringToObject(phase_obj, "phase", phase) != NULL;
-}
+  char* const dst       = (writer->buf != NULL) ? &writer->buf[writer->len] : NULL;
+  const size_t dst_size = (writer->buf != NULL) ? (writer->buf_size - writer->len) : 0;
 
-bool ConnectionHelloAddWaiting(const ConnectionHello* sme_hello, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
-  }
+  va_list args;
+  va_start(args, fmt);
+  const int len = vsnprintf(dst, dst_size, fmt, args);
+  va_end(args);
 
-  if (sme_hello->waiting == NULL) {
-    // "waiting" field is optional - nothing to be added here
-    return true;
+  if (len < 0) {
+    writer->ok = false;
+    return;
   }
 
-  cJSON* const waiting_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-  return cJSON_AddNumberToObject(waiting_obj, "waiting", *sme_hello->waiting) != NULL;
+  writer->len += (size_t)len;
 }
 
-bool ConnectionHelloAddProlongationRequest(const ConnectionHello* sme_hello, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
+void WriterString(ShipMessageWriter* writer, const char* s) {
+  if (s == NULL) {
+    writer->ok = false;
+    return;
   }
 
-  const bool* const prolong_req = sme_hello->prolongation_request;
-  if (prolong_req == NULL) {
-    // "prolongationRequest" field is optional - nothing to be added here
-    return true;
+  // Escape the same way cJSON does to keep the messages byte to byte identical
+  WriterWrite(writer, "\"", 1);
+  for (const unsigned char* c = (const unsigned char*)s; *c != '\0'; ++c) {
+    const char* escape = NULL;
+    switch (*c) {
+      case '\"': escape = "\\\""; break;
+      case '\\': escape = "\\\\"; break;
+      case '\b': escape = "\\b"; break;
+      case '\f': escape = "\\f"; break;
+      case '\n': escape = "\\n"; break;
+      case '\r': escape = "\\r"; break;
+      case '\t': escape = "\\t"; break;
+      default: break;
+    }
+
+    if (escape != NULL) {
+      WriterWrite(writer, escape, 2);
+    } else if (*c < 32) {
+      WriterPrintf(writer, "\\u%04x", *c);
+    } else {
+      WriterWrite(writer, (const char*)c, 1);
+    }
   }
 
-  cJSON* const prolong_req_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-  return cJSON_AddBoolToObject(prolong_req_obj, "prolongationRequest", *prolong_req) != NULL;
+  WriterWrite(writer, "\"", 1);
 }
 
-EebusError SmeHelloSerialize(const ConnectionHello* sme_hello, cJSON* sme_hello_obj) {
-  cJSON* const sme_hello_ar = cJSON_AddArrayToObject(sme_hello_obj, "connectionHello");
+void WriterCborHead(ShipMessageWriter* writer, uint8_t major_type, uint64_t value) {
+  uint8_t head[CBOR_HEAD_MAX_SIZE];
 
-  bool ok = (sme_hello_ar != NULL);
+  const size_t head_size = CborEncodeHead(head, major_type, value);
+  WriterWrite(writer, (const char*)head, head_size);
+}
 
-  ok = ok && ConnectionHelloAddPhase(sme_hello, sme_hello_ar);
-  ok = ok && ConnectionHelloAddWaiting(sme_hello, sme_hello_ar);
-  ok = ok && ConnectionHelloAddProlongationRequest(sme_hello, sme_hello_ar);
+void WriterCborText(ShipMessageWriter* writer, const char* s) {
+  const size_t len = strlen(s);
 
-  return ok ? kEebusErrorOk : kEebusErrorMemory;
+  WriterCborHead(writer, CBOR_MAJOR_TYPE_TEXT, len);
+  WriterWrite(writer, s, len);
 }
 
-bool MessageProtocolHandshakeAddType(const MessageProtocolHandshake* sme_prot_hs, cJSON* json_ar) {
-  if (json_ar == NULL) {
+bool SmeHelloWrite(const void* value, ShipMessageWriter* writer) {
+  static const char* const kPhases[] = {"pending", "ready", "aborted"};
+
+  const ConnectionHello* const sme_hello = (const ConnectionHello*)value;
+  if ((size_t)sme_hello->phase >= ARRAY_SIZE(kPhases)) {
     return false;
   }
 
-  cJSON* const handshake_type_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
+  WriterPrintf(writer, "{\"connectionHello\":[{\"phase\":\"%s\"}", kPhases[sme_hello->phase]);
 
-  const char* handshake_type_str = NULL;
-  if (sme_prot_hs->handshake_type == kProtocolHandshakeTypeAnnounceMax) {
-    handshake_type_str = "announceMax";
-  } else if (sme_prot_hs->handshake_type == kProtocolHandshakeTypeSelect) {
-    handshake_type_str = "select";
+  if (sme_hello->waiting != NULL) {
+    WriterPrintf(writer, ",{\"waiting\":%" PRIu32 "}", *sme_hello->waiting);
   }
 
-  cJSON* const handshake_type = cJSON_AddStringToObject(handshake_type_obj, "handshakeType", handshake_type_str);
-  return handshake_type != NULL;
-}
-
-bool MessageProtocolHandshakeAddVersion(const MessageProtocolHandshake* sme_prot_hs, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
+  if (sme_hello->prolongation_request != NULL) {
+    WriterPrintf(writer, ",{\"prolongationRequest\":%s}", *sme_hello->prolongation_request ? "true" : "false");
   }
 
-  cJSON* const version_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-  cJSON* const version_ar  = cJSON_AddArrayToObject(version_obj, "version");
-
-  cJSON* const version_0 = (cJSON*)JsonAddObjectToArray((JsonObject*)version_ar);
-  cJSON* const major     = cJSON_AddNumberToObject(version_0, "major", sme_prot_hs->version.major);
-
-  cJSON* const version_1 = (cJSON*)JsonAddObjectToArray((JsonObject*)version_ar);
-  cJSON* const minor     = cJSON_AddNumberToObject(version_1, "minor", sme_prot_hs->version.minor);
-
-  return (major != NULL) && (minor != NULL);
+  WriterPrintf(writer, "]}");
+  return writer->ok;
 }
 
-bool MessageProtocolHandshakeAddFormats(const MessageProtocolHandshake* sme_prot_hs, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
-  }
+bool SmeProtocolHandshakeWrite(const void* value, ShipMessageWriter* writer) {
+  static const char* const kHandshakeTypes[] = {"announceMax", "select"};
+  static const char* const kFormats[]        = {"JSON-UTF8", "JSON-UTF16", "openeebus-CBOR"};
 
-  if (sme_prot_hs->formats.format_size > ARRAY_SIZE(sme_prot_hs->formats.format)) {
+  const MessageProtocolHandshake* const sme_prot_hs = (const MessageProtocolHandshake*)value;
+  if (((size_t)sme_prot_hs->handshake_type >= ARRAY_SIZE(kHandshakeTypes))
+      || (sme_prot_hs->formats.format_size > ARRAY_SIZE(sme_prot_hs->formats.format))) {
     return false;
   }
 
-  cJSON* const formats_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-  cJSON* const formats_ar  = cJSON_AddArrayToObject(formats_obj, "formats");
-  cJSON* const formats_0   = (cJSON*)JsonAddObjectToArray((JsonObject*)formats_ar);
-  if (sme_prot_hs->formats.format_size == 0) {
-    return cJSON_AddNullToObject(formats_0, "format") != NULL;
-  }
-
-  cJSON* const format_ar = cJSON_AddArrayToObject(formats_0, "format");
-  if (format_ar == NULL) {
-    return false;
-  }
+  WriterPrintf(
+      writer,
+      "{\"messageProtocolHandshake\":[{\"handshakeType\":\"%s\"},"
+      "{\"version\":[{\"major\":%u},{\"minor\":%u}]},"
+      "{\"formats\":[{\"format\":",
+      kHandshakeTypes[sme_prot_hs->handshake_type],
+      (unsigned int)sme_prot_hs->version.major,
+      (unsigned int)sme_prot_hs->version.minor
+  );
 
-  for (size_t i = 0; i < sme_prot_hs->formats.format_size; ++i) {
-    const char* format_str = NULL;
-    if (sme_prot_hs->formats.format[i] == kMessageProtocolFormatTypeUTF8) {
-      format_str = "JSON-UTF8";
-    } else if (sme_prot_hs->formats.format[i] == kMessageProtocolFormatTypeUTF16) {
-      format_str = "JSON-UTF16";
-    }
+  if (sme_prot_hs->formats.format_size == 0) {
+    WriterPrintf(writer, "null");
+  } else {
+    for (size_t i = 0; i < sme_prot_hs->formats.format_size; ++i) {
+      const MessageProtocolFormatType format = sme_prot_hs->formats.format[i];
+      if ((size_t)format >= ARRAY_SIZE(kFormats)) {
+        return false;
+      }
 
-    if (JsonAddStringToArray((JsonObject*)format_ar, format_str) == NULL) {
-      return false;
+      WriterPrintf(writer, "%s\"%s\"", (i == 0) ? "[" : ",", kFormats[format]);
     }
-  }
-
-  return true;
-}
-
-EebusError SmeProtocolHandshakeSerialize(const MessageProtocolHandshake* sme_prot_hs, cJSON* sme_prot_hs_obj) {
-  cJSON* const sme_prot_hs_ar = cJSON_AddArrayToObject(sme_prot_hs_obj, "messageProtocolHandshake");
-
-  bool ok = (sme_prot_hs_ar != NULL);
-
-  ok = ok && MessageProtocolHandshakeAddType(sme_prot_hs, sme_prot_hs_ar);
-  ok = ok && MessageProtocolHandshakeAddVersion(sme_prot_hs, sme_prot_hs_ar);
-  ok = ok && MessageProtocolHandshakeAddFormats(sme_prot_hs, sme_prot_hs_ar);
 
-  return ok ? kEebusErrorOk : kEebusErrorMemory;
-}
-
-bool MessageProtocolHandshakeErrorAddError(const MessageProtocolHandshakeError* msg_prot_err_hs, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
+    WriterPrintf(writer, "]");
   }
 
-  cJSON* const handshake_err_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-  cJSON* const handshake_err     = cJSON_AddNumberToObject(handshake_err_obj, "error", msg_prot_err_hs->error);
-  return handshake_err != NULL;
+  WriterPrintf(writer, "}]}]}");
+  return writer->ok;
 }
 
-EebusError SmeProtocolHandshakeErrorSerialize(
-    const MessageProtocolHandshakeError* sme_prot_hs_err, cJSON* sme_prot_hs_obj) {
-  cJSON* const sme_prot_hs_err_ar = cJSON_AddArrayToObject(sme_prot_hs_obj, "messageProtocolHandshakeError");
+bool SmeProtocolHandshakeErrorWrite(const void* value, ShipMessageWriter* writer) {
+  const MessageProtocolHandshakeError* const sme_prot_hs_err = (const MessageProtocolHandshakeError*)value;
 
-  bool ok = (sme_prot_hs_err_ar != NULL);
-
-  ok = ok && MessageProtocolHandshakeErrorAddError(sme_prot_hs_err, sme_prot_hs_err_ar);
-
-  return ok ? kEebusErrorOk : kEebusErrorMemory;
+  WriterPrintf(writer, "{\"messageProtocolHandshakeError\":[{\"error\":%d}]}", (int)sme_prot_hs_err->error);
+  return writer->ok;
 }
 
-bool ConnectionPinStateAddPinState(const ConnectionPinState* sme_pin_state, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
-  }
+bool SmeConnectionPinStateWrite(const void* value, ShipMessageWriter* writer) {
+  static const char* const kPinStates[]         = {"required", "optional", "pinOk", "none"};
+  static const char* const kInputPermissions[] = {"busy", "ok"};
 
-  cJSON* const pin_state_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-
-  const char* pin_state_str = NULL;
-  if (sme_pin_state->pin_state == kPinStateTypeRequired) {
-    pin_state_str = "required";
-  } else if (sme_pin_state->pin_state == kPinStateTypeOptional) {
-    pin_state_str = "optional";
-  } else if (sme_pin_state->pin_state == kPinStateTypePinOk) {
-    pin_state_str = "pinOk";
-  } else if (sme_pin_state->pin_state == kPinStateTypeNone) {
-    pin_state_str = "none";
-  } else {
+  const ConnectionPinState* const sme_pin_state = (const ConnectionPinState*)value;
+  if ((size_t)sme_pin_state->pin_state >= ARRAY_SIZE(kPinStates)) {
     return false;
   }
 
-  return cJSON_AddStringToObject(pin_state_obj, "pinState", pin_state_str) != NULL;
-}
+  WriterPrintf(writer, "{\"connectionPinState\":[{\"pinState\":\"%s\"}", kPinStates[sme_pin_state->pin_state]);
 
-bool ConnectionPinStateAddInputPermission(const ConnectionPinState* sme_pin_state, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
-  }
-
-  if (sme_pin_state->input_permission == NULL) {
-    // "inputPermission" field is optional - nothing to be added here
-    return true;
-  }
-
-  PinInputPermissionType input_permission = *(sme_pin_state->input_permission);
-
-  cJSON* const in_permission_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
+  if (sme_pin_state->input_permission != NULL) {
+    const PinInputPermissionType input_permission = *sme_pin_state->input_permission;
+    if ((size_t)input_permission >= ARRAY_SIZE(kInputPermissions)) {
+      return false;
+    }
 
-  const char* input_permission_str = NULL;
-  if (input_permission == kPinInputPermissionTypeBusy) {
-    input_permission_str = "busy";
-  } else if (input_permission == kPinInputPermissionTypeOk) {
-    input_permission_str = "ok";
-  } else {
-    return false;
+    WriterPrintf(writer, ",{\"inputPermission\":\"%s\"}", kInputPermissions[input_permission]);
   }
 
-  return cJSON_AddStringToObject(in_permission_obj, "inputPermission", input_permission_str) != NULL;
+  WriterPrintf(writer, "]}");
+  return writer->ok;
 }
 
-EebusError SmeConnectionPinStateSerialize(const ConnectionPinState* sme_pin_state, cJSON* pin_state_obj) {
-  cJSON* const pin_state_ar = cJSON_AddArrayToObject(pin_state_obj, "connectionPinState");
+bool SmeConnectionPinInputWrite(const void* value, ShipMessageWriter* writer) {
+  const ConnectionPinInput* const sme_pin_input = (const ConnectionPinInput*)value;
 
-  bool ok = (pin_state_ar != NULL);
+  // Hexadecimal digits without leading zeros, "" for 0
+  const char* const fmt = (sme_pin_input->pin != 0) ? "{\"connectionPinInput\":[{\"pin\":\"%" PRIX64 "\"}]}"
+                                                    : "{\"connectionPinInput\":[{\"pin\":\"\"}]}";
 
-  ok = ok && ConnectionPinStateAddPinState(sme_pin_state, pin_state_ar);
-  ok = ok && ConnectionPinStateAddInputPermission(sme_pin_state, pin_state_ar);
-
-  return ok ? kEebusErrorOk : kEebusErrorMemory;
+  WriterPrintf(writer, fmt, sme_pin_input->pin);
+  return writer->ok;
 }
 
-bool ConnectionPinInputAddPin(const ConnectionPinInput* sme_pin_input, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
-  }
-
-  cJSON* const pin_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-
-  // Up to 16 hexadecimal digits + \0
-  char pin_str[17];
-  size_t pin_str_len = 0;
-  uint64_t pin       = sme_pin_input->pin;
-  while (pin > 0) {
-    char d = pin & 0xF;
-    d += (d < 10) ? '0' : ('A' - 10);
-    pin_str[pin_str_len++] = d;
-    pin >>= 4;
-  }
+bool SmeConnectionPinErrorWrite(const void* value, ShipMessageWriter* writer) {
+  const ConnectionPinError* const sme_pin_error = (const ConnectionPinError*)value;
 
-  pin_str[pin_str_len] = '\0';
-
-  for (size_t i = 0; i < pin_str_len / 2; ++i) {
-    char tmp   = pin_str[i];
-    pin_str[i] = pin_str[pin_str_len - i - 1];
-
-    pin_str[pin_str_len - i - 1] = tmp;
-  }
-
-  return cJSON_AddStringToObject(pin_obj, "pin", pin_str) != NULL;
+  WriterPrintf(writer, "{\"connectionPinError\":[{\"error\":%d}]}", (int)sme_pin_error->error);
+  return writer->ok;
 }
 
-EebusError SmeConnectionPinInputSerialize(const ConnectionPinInput* sme_pin_input, cJSON* pin_input_obj) {
-  cJSON* const pin_input_ar = cJSON_AddArrayToObject(pin_input_obj, "connectionPinInput");
-
-  bool ok = (pin_input_ar != NULL);
-
-  ok = ok && ConnectionPinInputAddPin(sme_pin_input, pin_input_ar);
-
-  return ok ? kEebusErrorOk : kEebusErrorMemory;
-}
-
-bool ConnectionPinErrorAddError(const ConnectionPinError* sme_pin_error, cJSON* json_ar) {
-  if (json_ar == NULL) {
+bool DataWrite(const void* value, ShipMessageWriter* writer) {
+  const Data* const data = (const Data*)value;
+  if (data->payload.data == NULL) {
     return false;
   }
 
-  cJSON* const error_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-
-  return cJSON_AddNumberToObject(error_obj, "error", sme_pin_error->error) != NULL;
-}
-
-EebusError SmeConnectionPinErrorSerialize(const ConnectionPinError* sme_pin_error, cJSON* pin_error_obj) {
-  cJSON* const pin_error_ar = cJSON_AddArrayToObject(pin_error_obj, "connectionPinError");
-
-  bool ok = (pin_error_ar != NULL);
+  // Json payload always starts with '{', so that it is never taken for a CBOR map
+  if (CborIsMap(data->payload.data, data->payload.data_size)) {
+    return DataWriteCbor(data, writer);
+  }
 
-  ok = ok && ConnectionPinErrorAddError(sme_pin_error, pin_error_ar);
+  WriterPrintf(writer, "{\"data\":[{\"header\":[{\"protocolId\":");
+  WriterString(writer, data->header.protocol_id);
+  // Payload is already a serialised SPINE datagram, it is copied as is
+  WriterPrintf(writer, "}]},{\"payload\":");
+  WriterWrite(writer, (const char*)data->payload.data, strlen((const char*)data->payload.data));
+  WriterPrintf(writer, "}]}");
 
-  return ok ? kEebusErrorOk : kEebusErrorMemory;
-}
+  // TODO: add extension serialization
 
-bool DataAddHeader(const Data* data, cJSON* data_ar) {
-  cJSON* const header_obj      = (cJSON*)JsonAddObjectToArray((JsonObject*)data_ar);
-  cJSON* const header_ar       = cJSON_AddArrayToObject(header_obj, "header");
-  cJSON* const protocol_id_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)header_ar);
-  return cJSON_AddStringToObject(protocol_id_obj, "protocolId", data->header.protocol_id) != NULL;
+  return writer->ok;
 }
 
-bool DataAddPayload(const Data* data, cJSON* data_ar) {
-  cJSON* const payload_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)data_ar);
-  return cJSON_AddRawToObject(payload_obj, "payload", (char*)data->payload.data) != NULL;
-}
-
-EebusError DataSerialize(const Data* data, cJSON* data_obj) {
-  cJSON* const data_ar = cJSON_AddArrayToObject(data_obj, "data");
-
-  bool ok = (data_ar != NULL);
+bool DataWriteCbor(const Data* data, ShipMessageWriter* writer) {
+  // {"data":[{"header":[{"protocolId":"..."}]},{"payload":{...}}]}
+  WriterCborHead(writer, CBOR_MAJOR_TYPE_MAP, 1);
+  WriterCborText(writer, "data");
+  WriterCborHead(writer, CBOR_MAJOR_TYPE_ARRAY, 2);
+  WriterCborHead(writer, CBOR_MAJOR_TYPE_MAP, 1);
+  WriterCborText(writer, "header");
+  WriterCborHead(writer, CBOR_MAJOR_TYPE_ARRAY, 1);
+  WriterCborHead(writer, CBOR_MAJOR_TYPE_MAP, 1);
+  WriterCborText(writer, "protocolId");
+  WriterCborText(writer, data->header.protocol_id);
+  WriterCborHead(writer, CBOR_MAJOR_TYPE_MAP, 1);
+  WriterCborText(writer, "payload");
+  // Payload is already a serialised SPINE datagram, it is copied as is
+  WriterWrite(writer, (const char*)data->payload.data, data->payload.data_size);
 
-  ok = ok && DataAddHeader(data, data_ar);
-  ok = ok && DataAddPayload(data, data_ar);
+  // TODO: add extension serialization
 
-  // TODO: add extension parsing
-
-  return ok ? kEebusErrorOk : kEebusErrorMemory;
+  return writer->ok;
 }
 
-EebusError SmeConnectionAccessMethodsRequestSerialize(
-    const AccessMethodsRequest* sme_access_metods_req, cJSON* access_metods_req_obj) {
-  cJSON* const access_methods_req_ar = cJSON_AddArrayToObject(access_metods_req_obj, "accessMethodsRequest");
-
-  return (access_methods_req_ar != NULL) ? kEebusErrorOk : kEebusErrorMemory;
+bool SmeConnectionAccessMethodsRequestWrite(const void* value, ShipMessageWriter* writer) {
+  WriterPrintf(writer, "{\"accessMethodsRequest\":[]}");
+  return writer->ok;
 }
 
-bool AccessMethodsAddId(const AccessMethods* sme_access_methods, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
-  }
+bool SmeConnectionAccessMethodsWrite(const void* value, ShipMessageWriter* writer) {
+  const AccessMethods* const sme_access_methods = (const AccessMethods*)value;
 
-  cJSON* const id_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-  return cJSON_AddStringToObject(id_obj, "id", sme_access_methods->id) != NULL;
-}
+  WriterPrintf(writer, "{\"accessMethods\":[{\"id\":");
+  WriterString(writer, sme_access_methods->id);
+  WriterPrintf(writer, "}");
 
-bool AccessMethodsAddDnsSdMdns(const AccessMethods* sme_access_methods, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
+  if (sme_access_methods->dns_sd_mdns) {
+    WriterPrintf(writer, ",{\"dnsSd_mDns\":[]}");
   }
 
-  if (sme_access_methods->dns_sd_mdns == false) {
-    // dnsSd_mDns is optional field so this is ok
-    return true;
+  if (sme_access_methods->dns.uri != NULL) {
+    WriterPrintf(writer, ",{\"dns\":[{\"uri\":");
+    WriterString(writer, sme_access_methods->dns.uri);
+    WriterPrintf(writer, "}]}");
   }
 
-  cJSON* const dns_sd_mdns_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-  return cJSON_AddArrayToObject(dns_sd_mdns_obj, "dnsSd_mDns") != NULL;
+  WriterPrintf(writer, "]}");
+  return writer->ok;
 }
 
-bool AccessMethodsAddDns(const AccessMethods* sme_access_methods, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
-  }
+bool SmeCloseWrite(const void* value, ShipMessageWriter* writer) {
+  static const char* const kPhases[] = {"announce", "confirm"};
 
-  if (sme_access_methods->dns.uri == false) {
-    // dns is optional field so this is ok
-    return true;
-  }
-
-  cJSON* const dns_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-  cJSON* const uri_ar  = cJSON_AddArrayToObject(dns_obj, "dns");
-  cJSON* const uri_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)uri_ar);
-  return cJSON_AddStringToObject(uri_obj, "uri", sme_access_methods->dns.uri) != NULL;
-}
-
-EebusError SmeConnectionAccessMethodsSerialize(const AccessMethods* sme_access_methods, cJSON* access_methods_obj) {
-  cJSON* const access_methods_ar = cJSON_AddArrayToObject(access_methods_obj, "accessMethods");
-
-  bool ok = (access_methods_ar != NULL);
-
-  ok = ok && AccessMethodsAddId(sme_access_methods, access_methods_ar);
-  ok = ok && AccessMethodsAddDnsSdMdns(sme_access_methods, access_methods_ar);
-  ok = ok && AccessMethodsAddDns(sme_access_methods, access_methods_ar);
-
-  return ok ? kEebusErrorOk : kEebusErrorMemory;
-}
-
-bool ConnectionCloseAddPhase(const ConnectionClose* sme_close, cJSON* json_ar) {
-  if (json_ar == NULL) {
+  const ConnectionClose* const sme_close = (const ConnectionClose*)value;
+  if ((size_t)sme_close->phase >= ARRAY_SIZE(kPhases)) {
     return false;
   }
 
-  cJSON* const phase_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
+  WriterPrintf(writer, "{\"connectionClose\":[{\"phase\":\"%s\"}", kPhases[sme_close->phase]);
 
-  const char* phase_str = NULL;
-  if (sme_close->phase == kConnectionClosePhaseTypeAnnounce) {
-    phase_str = "announce";
-  } else if (sme_close->phase == kConnectionClosePhaseTypeConfirm) {
-    phase_str = "confirm";
-  } else {
-    return false;
+  if (sme_close->max_time != NULL) {
+    WriterPrintf(writer, ",{\"maxTime\":%" PRIu32 "}", *sme_close->max_time);
   }
 
-  return cJSON_AddStringToObject(phase_obj, "phase", phase_str) != NULL;
-}
-
-bool ConnectionCloseAddMaxTime(const ConnectionClose* sme_close, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
-  }
-
-  if (sme_close->max_time == NULL) {
-    // maxTime is optional field so this is ok
-    return true;
+  if (sme_close->reason != NULL) {
+    WriterPrintf(writer, ",{\"reason\":");
+    WriterString(writer, sme_close->reason);
+    WriterPrintf(writer, "}");
   }
 
-  cJSON* const max_time_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-  return cJSON_AddNumberToObject(max_time_obj, "maxTime", *sme_close->max_time) != NULL;
+  WriterPrintf(writer, "]}");
+  return writer->ok;
 }
 
-bool ConnectionCloseAddReason(const ConnectionClose* sme_close, cJSON* json_ar) {
-  if (json_ar == NULL) {
-    return false;
+EebusError Serialize(ShipMessageSerialize* self, const void* value, MsgValueType value_type) {
+  const ShipMessageTemplateEntry* entry = NULL;
+  for (size_t i = 0; i < ARRAY_SIZE(ship_message_templates); ++i) {
+    if (ship_message_templates[i].value_type == value_type) {
+      entry = &ship_message_templates[i];
+      break;
+    }
   }
 
-  if (sme_close->reason == NULL) {
-    // reason is optional field so this is ok
-    return true;
+  if (entry == NULL) {
+    return kEebusErrorInputArgument;
   }
 
-  cJSON* const reason_obj = (cJSON*)JsonAddObjectToArray((JsonObject*)json_ar);
-  return cJSON_AddStringToObject(reason_obj, "reason", sme_close->reason) != NULL;
-}
-
-EebusError SmeCloseSerialize(const ConnectionClose* sme_close, cJSON* sme_close_obj) {
-  cJSON* const connection_close_ar = cJSON_AddArrayToObject(sme_close_obj, "connectionClose");
-
-  bool ok = (connection_close_ar != NULL);
-
-  ok = ok && ConnectionCloseAddPhase(sme_close, connection_close_ar);
-  ok = ok && ConnectionCloseAddMaxTime(sme_close, connection_close_ar);
-  ok = ok && ConnectionCloseAddReason(sme_close, connection_close_ar);
-
-  return ok ? kEebusErrorOk : kEebusErrorMemory;
-}
-
-EebusError SerializeMessage(ShipMessageSerialize* self, const void* value, MsgValueType value_type) {
-  switch (value_type) {
-    case kSmeHello: {
-      return SmeHelloSerialize((ConnectionHello*)value, self->json_obj);
-    }
-
-    case kSmeProtocolHandshake: {
-      return SmeProtocolHandshakeSerialize((MessageProtocolHandshake*)value, self->json_obj);
-    }
-
-    case kSmeProtocolHandshakeError: {
-      return SmeProtocolHandshakeErrorSerialize((MessageProtocolHandshakeError*)value, self->json_obj);
-    }
-
-    case kSmeConnectionPinState: {
-      return SmeConnectionPinStateSerialize((ConnectionPinState*)value, self->json_obj);
-    }
-
-    case kSmeConnectionPinInput: {
-      return SmeConnectionPinInputSerialize((ConnectionPinInput*)value, self->json_obj);
-    }
-
-    case kSmeConnectionPinError: {
-      return SmeConnectionPinErrorSerialize((ConnectionPinError*)value, self->json_obj);
-    }
-
-    case kData: {
-      return DataSerialize((Data*)value, self->json_obj);
-    }
-
-    case kSmeConnectionAccessMethodsRequest: {
-      return SmeConnectionAccessMethodsRequestSerialize((AccessMethodsRequest*)value, self->json_obj);
-    }
-
-    case kSmeConnectionAccessMethods: {
-      return SmeConnectionAccessMethodsSerialize((AccessMethods*)value, self->json_obj);
-    }
-
-    case kSmeClose: {
-      return SmeCloseSerialize((ConnectionClose*)value, self->json_obj);
-    }
-
-    default: {
-      return kEebusErrorInputArgument;
-    }
+  // The message type byte goes first
+  ShipMessageWriter writer = {.buf = NULL, .buf_size = 0, .len = 1, .ok = true};
+  if (!entry->write(value, &writer)) {
+    return kEebusErrorMemory;
   }
-}
 
-EebusError Serialize(ShipMessageSerialize* self, const void* value, MsgValueType value_type) {
-  self->buf      = (MessageBuffer*)EEBUS_MALLOC(sizeof(MessageBuffer));
-  self->json_obj = cJSON_CreateObject();
+  const size_t msg_size = writer.len;
 
-  if ((self->json_obj == NULL) || (self->buf == NULL)) {
+  char* const s = (char*)EEBUS_MALLOC(msg_size + 1);
+  if (s == NULL) {
     return kEebusErrorMemory;
   }
 
-  EebusError ret = SerializeMessage(self, value, value_type);
-  if (ret != kEebusErrorOk) {
-    return ret;
-  }
-
-  char* const s = cJSON_PrintUnformatted(self->json_obj);
-  if (s == NULL) {
+  self->buf = (MessageBuffer*)EEBUS_MALLOC(sizeof(MessageBuffer));
+  if (self->buf == NULL) {
+    EEBUS_FREE(s);
     return kEebusErrorMemory;
   }
 
-  const MsgType msg_type = (value_type == kSmeClose) ? kMsgTypeEnd
-                           : (value_type == kData)   ? kMsgTypeData
-                                                     : kMsgTypeControl;
+  MessageBufferInit(self->buf, (uint8_t*)s, msg_size);
 
-  if (!StringToShipMessage(s, self->buf, msg_type)) {
+  s[0]   = (char)entry->msg_type;
+  writer = (ShipMessageWriter){.buf = s, .buf_size = msg_size + 1, .len = 1, .ok = true};
+  if ((!entry->write(value, &writer)) || (writer.len != msg_size)) {
     return kEebusErrorMemory;
   }
 
-  // cJSON object is not required anymore
-  cJSON_Delete(self->json_obj);
-  self->json_obj = NULL;
   return kEebusErrorOk;
 }
@@ -17,22 +17,29 @@
 #include <pthread.h>
 #include <signal.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "ship_node_internal.h"
 #include "src/common/eebus_device_info.h"
 #include "src/common/eebus_mutex/eebus_mutex.h"
 #include "src/common/eebus_queue/eebus_queue.h"
 #include "src/common/eebus_thread/eebus_thread.h"
+#include "src/common/eebus_timer/eebus_timer.h"
 #include "src/common/service_details.h"
 #include "src/common/vector.h"
 #include "src/ship/api/http_server_interface.h"
 #include "src/ship/api/ship_node_interface.h"
 #include "src/ship/api/ship_node_reader_interface.h"
 #include "src/ship/api/tls_certificate_interface.h"
+#include "src/ship/mdns/mdns_entry_list.h"
 #include "src/ship/mdns/ship_mdns.h"
 #include "src/ship/ship_connection/ship_connection.h"
+#include "src/ship/ship_node/ship_node_reconnect.h"
 #include "src/ship/websocket/http_server.h"
+#include "src/ship/websocket/tls_session_cache.h"
 #include "src/ship/websocket/websocket_client_creator.h"
 
 /** Set SHIP_NODE_DEBUG 1 to enable debug prints */
@@ -47,12 +54,16 @@
 #define SHIP_NODE_DEBUG_PRINTF(fmt, ...)
 #endif  // SHIP_NODE_DEBUG
 
+/** Maximal number of the queue messages received at once */
+#define SHIP_NODE_QUEUE_BATCH_MAX_MSG 4
+
 enum ShipNodeQueueMsgType {
   kShipNodeQueueMsgTypeCancel,
   kShipNodeQueueMsgTypeMdnsEntriesFound,
   kShipNodeQueueMsgTypeShipConnectionClosed,
   kShipNodeQueueMsgTypeShipUnregisterSki,
   kShipNodeQueueMsgTypeShipRegisterSki,
+  kShipNodeQueueMsgTypeReconnectTick,
 };
 
 typedef enum ShipNodeQueueMsgType ShipNodeQueueMsgType;
@@ -73,11 +84,14 @@ static void ReportServiceShipId(InfoProviderObject* self, const char* service_id
 static bool IsWaitingForTrustAllowed(InfoProviderObject* self, const char* ski);
 static void HandleShipStateUpdate(InfoProviderObject* self, const char* ski, SmeState state, const char* err);
 static DataReaderObject* SetupRemoteDevice(InfoProviderObject* self, const char* ski, DataWriterObject* data_writer);
+static bool IsCborEnabledForSki(InfoProviderObject* self, const char* ski);
 static void Start(ShipNodeObject* self);
 static void Stop(ShipNodeObject* self);
 static void RegisterRemoteSki(ShipNodeObject* self, const char* ski, bool is_trusted);
 static void UnregisterRemoteSki(ShipNodeObject* self, const char* ski);
 static void CancelPairingWithSki(ShipNodeObject* self, const char* ski);
+static void AddRemoteService(ShipNodeObject* self, const MdnsEntry* entry);
+static void SetCborEnabledForSki(ShipNodeObject* self, const char* ski, bool enable);
 static void ShipNodeUnregisterSki(ShipNodeObject* self, const char* ski);
 static void ShipNodeRegisterSki(ShipNodeObject* self, const char* ski, bool is_trusted);
 
@@ -90,13 +104,16 @@ static const ShipNodeInterface ship_node_methods = {
         .is_waiting_for_trust_allowed     = IsWaitingForTrustAllowed,
         .handle_ship_state_update         = HandleShipStateUpdate,
         .setup_remote_device              = SetupRemoteDevice,
+        .is_cbor_enabled_for_ski          = IsCborEnabledForSki,
     },
 
-    .start                   = Start,
-    .stop                    = Stop,
-    .register_remote_ski     = RegisterRemoteSki,
-    .unregister_remote_ski   = UnregisterRemoteSki,
-    .cancel_pairing_with_ski = CancelPairingWithSki,
+    .start                    = Start,
+    .stop                     = Stop,
+    .register_remote_ski      = RegisterRemoteSki,
+    .unregister_remote_ski    = UnregisterRemoteSki,
+    .cancel_pairing_with_ski  = CancelPairingWithSki,
+    .add_remote_service       = AddRemoteService,
+    .set_cbor_enabled_for_ski = SetCborEnabledForSki,
 };
 
 static void ShipNodeConstruct(
@@ -111,8 +128,9 @@ static void ShipNodeConstruct(
     ServiceDetails* local_service_details
 );
 
-static void ShipNodeOnMdnsEntriesFoundCallback(Vector* found_entries, void* ctx);
+static void ShipNodeOnMdnsEntryChangedCallback(const MdnsEntry* entry, MdnsEntryChange change, void* ctx);
 static bool SkiMatches(const char* ski_a, const char* ski_b);
+static char* ShipNodeFindCborSki(const ShipNode* self, const char* ski);
 static void CloseShipConnection(ShipNode* self, ShipConnectionObject* sc, bool had_error);
 static bool ShipNodeFindService(ShipNode* self, MdnsEntry* found_entry);
 static void ShipNodeConnectToService(ShipNode* self, const MdnsEntry* found_entry);
@@ -121,6 +139,17 @@ static int
 ShipNodeOnWebsocketServerConnectionCallback(const char* ski, WebsocketCreatorObject* websocket_creator, void* ctx);
 static bool ShipNodeIsClientSupported(ShipNode* self);
 static bool ShipNodeIsServerSupported(ShipNode* self);
+static void ConnectionMappingDeallocator(void* mapping);
+static ConnectionMapping* ShipNodeGetConnectionMapping(ShipNode* self, const char* ski);
+static ConnectionMapping* ShipNodeAddConnectionMapping(ShipNode* self, const char* ski);
+static void ShipNodeScheduleReconnect(ShipNode* self, ConnectionMapping* mapping);
+static void ShipNodeReconnectTimeoutCallback(void* ctx);
+static void ShipNodeHandleReconnectTick(ShipNode* self);
+static void ShipNodeHandleMdnsEntriesFound(ShipNode* self);
+static void ShipNodeHandleQueueMessage(ShipNode* self, const ShipNodeQueueMessage* queue_msg);
+
+/** Period of the shared reconnect timer */
+static const uint32_t kReconnectTickMs = MILLISECONDS(500);
 
 static void ShipNodeQueueMsgDeallocator(void* msg) {
   if (msg == NULL) {
@@ -146,7 +175,11 @@ void ShipNodeConstruct(
   // Override "virtual function table"
   SHIP_NODE_INTERFACE(self) = &ship_node_methods;
 
-  self->mdns = ShipMdnsCreate(ski, device_info, service_name, port, ShipNodeOnMdnsEntriesFoundCallback, self);
+  // Without the service name the node is not announced, the remote services are added explicitly
+  self->mdns = NULL;
+  if (service_name != NULL) {
+    self->mdns = ShipMdnsCreate(ski, device_info, service_name, port, ShipNodeOnMdnsEntryChangedCallback, self);
+  }
 
   static const size_t kQueueMaxMsg = 10;
 
@@ -159,10 +192,12 @@ void ShipNodeConstruct(
   self->connection_thread     = NULL;
 
   self->remote_ski = NULL;
+  self->cbor_skis  = VectorCreate();
 
-  self->connections_table     = NULL;
+  self->connections_table     = VectorCreateWithDeallocator(ConnectionMappingDeallocator);
   self->ship_node_reader      = ship_node_reader;
   self->tsl_certificate       = tsl_certificate;
+  self->tls_session_cache     = TlsSessionCacheCreate(TLS_SESSION_CACHE_MAX_NUM_DEFAULT);
   self->local_service_details = local_service_details;
 
   self->http_server = HttpServerCreate(port, tsl_certificate, ShipNodeOnWebsocketServerConnectionCallback, self);
@@ -170,6 +205,10 @@ void ShipNodeConstruct(
   self->websocket_creator          = NULL;
   self->connection_attempt_running = false;
 
+  self->reconnect_timer            = EebusTimerCreate(ShipNodeReconnectTimeoutCallback, self);
+  self->is_reconnect_timer_running = false;
+  self->reconnect_prng_state       = ShipNodeReconnectSeed(ski, (uint64_t)time(NULL));
+
   if (strcmp(role, "server") == 0) {
     self->role = kShipRoleServer;
   } else if (strcmp(role, "client") == 0) {
@@ -214,6 +253,13 @@ void Destruct(InfoProviderObject* self) {
   StringDelete(sn->remote_ski);
   sn->remote_ski = NULL;
 
+  if (sn->cbor_skis != NULL) {
+    VectorFreeElements(sn->cbor_skis);
+    VectorDestruct(sn->cbor_skis);
+    EEBUS_FREE(sn->cbor_skis);
+    sn->cbor_skis = NULL;
+  }
+
   if (sn->mdns != NULL) {
     SHIP_MDNS_DESTRUCT(sn->mdns);
     EEBUS_FREE(sn->mdns);
@@ -241,26 +287,172 @@ void Destruct(InfoProviderObject* self) {
     sn->ship_connection = NULL;
   }
 
+  TlsSessionCacheDelete(sn->tls_session_cache);
+  sn->tls_session_cache = NULL;
+
+  EebusTimerDelete(sn->reconnect_timer);
+  sn->reconnect_timer = NULL;
+
+  if (sn->connections_table != NULL) {
+    VectorDestruct(sn->connections_table);
+    EEBUS_FREE(sn->connections_table);
+    sn->connections_table = NULL;
+  }
+
   EebusQueueDelete(sn->msg_queue);
   sn->msg_queue = NULL;
 
   sn->connection_attempt_running = false;
 }
 
-void ShipNodeOnMdnsEntriesFoundCallback(Vector* found_entries, void* ctx) {
+void ConnectionMappingDeallocator(void* mapping) {
+  ConnectionMapping* const cm = (ConnectionMapping*)mapping;
+  if (cm == NULL) {
+    return;
+  }
+
+  StringDelete((char*)cm->ski);
+  EEBUS_FREE(cm);
+}
+
+ConnectionMapping* ShipNodeGetConnectionMapping(ShipNode* self, const char* ski) {
+  for (size_t i = 0; i < VectorGetSize(self->connections_table); ++i) {
+    ConnectionMapping* const cm = (ConnectionMapping*)VectorGetElement(self->connections_table, i);
+    if (SkiMatches(cm->ski, ski)) {
+      return cm;
+    }
+  }
+
+  return NULL;
+}
+
+ConnectionMapping* ShipNodeAddConnectionMapping(ShipNode* self, const char* ski) {
+  ConnectionMapping* cm = ShipNodeGetConnectionMapping(self, ski);
+  if ((cm != NULL) || StringIsEmpty(ski)) {
+    return cm;
+  }
+
+  cm = (ConnectionMapping*)EEBUS_MALLOC(sizeof(ConnectionMapping));
+  if (cm == NULL) {
+    return NULL;
+  }
+
+  cm->ski                = StringCopy(ski);
+  cm->connection         = NULL;
+  cm->attempt_cnt        = 0;
+  cm->is_attempt_running = false;
+  cm->service_details    = NULL;
+  cm->is_retry_pending   = false;
+  cm->retry_delay_ms     = 0;
+  cm->is_announced       = false;
+
+  VectorPushBack(self->connections_table, cm);
+  return cm;
+}
+
+void ShipNodeScheduleReconnect(ShipNode* self, ConnectionMapping* mapping) {
+  mapping->is_retry_pending = true;
+  mapping->retry_delay_ms   = ShipNodeCalcReconnectDelay(&self->reconnect_prng_state, mapping->attempt_cnt);
+  SHIP_NODE_DEBUG_PRINTF("%s(), reconnect to %s in %ums\n", __func__, mapping->ski, mapping->retry_delay_ms);
+
+  if (!self->is_reconnect_timer_running) {
+    EEBUS_TIMER_START(self->reconnect_timer, kReconnectTickMs, true);
+    self->is_reconnect_timer_running = true;
+  }
+}
+
+void ShipNodeReconnectTimeoutCallback(void* ctx) {
+  ShipNode* const sn = (ShipNode*)ctx;
+
+  ShipNodeQueueMessage queue_msg = {
+      .type            = kShipNodeQueueMsgTypeReconnectTick,
+      .ship_connection = NULL,
+      .had_error       = false,
+      .ski             = NULL,
+  };
+
+  // Missed tick is caught up with the next one, so do not block the timer
+  EEBUS_QUEUE_SEND(sn->msg_queue, &queue_msg, 0);
+}
+
+void ShipNodeHandleReconnectTick(ShipNode* self) {
+  bool is_retry_pending = false;
+
+  EEBUS_MUTEX_LOCK(self->mutex);
+  for (size_t i = 0; i < VectorGetSize(self->connections_table); ++i) {
+    ConnectionMapping* const cm = (ConnectionMapping*)VectorGetElement(self->connections_table, i);
+    if (!cm->is_retry_pending) {
+      continue;
+    }
+
+    cm->retry_delay_ms = (cm->retry_delay_ms > kReconnectTickMs) ? cm->retry_delay_ms - kReconnectTickMs : 0;
+    if ((cm->retry_delay_ms > 0) || self->connection_attempt_running) {
+      is_retry_pending = true;
+      continue;
+    }
+
+    // Backoff elapsed, retry with the latest known service address.
+    // If the remote is not announced, wait for it to appear in the mDNS browse results
+    cm->is_retry_pending = false;
+
+    MdnsEntry found_entry;
+    if (SkiMatches(cm->ski, self->remote_ski) && ShipNodeFindService(self, &found_entry)) {
+      ShipNodeConnectToService(self, &found_entry);
+      is_retry_pending = is_retry_pending || cm->is_retry_pending;
+    }
+  }
+
+  if (!is_retry_pending) {
+    EEBUS_TIMER_STOP(self->reconnect_timer);
+    self->is_reconnect_timer_running = false;
+  }
+  EEBUS_MUTEX_UNLOCK(self->mutex);
+}
+
+void ShipNodeHandleMdnsEntriesFound(ShipNode* self) {
+  EEBUS_MUTEX_LOCK(self->mutex);
+
+  MdnsEntry found_entry;
+  const bool is_found         = ShipNodeFindService(self, &found_entry);
+  ConnectionMapping* const cm = ShipNodeAddConnectionMapping(self, self->remote_ski);
+
+  if (cm == NULL) {
+    if (is_found) {
+      ShipNodeConnectToService(self, &found_entry);
+    }
+  } else {
+    // Remote (re)appearing in the browse results is a fresh announcement,
+    // which is worth a retry without waiting for the backoff delay to elapse
+    const bool is_fresh = is_found && !cm->is_announced;
+    cm->is_announced    = is_found;
+
+    if (is_found && (!cm->is_retry_pending || is_fresh)) {
+      cm->is_retry_pending = false;
+      ShipNodeConnectToService(self, &found_entry);
+    }
+  }
+
+  self->search_for_remote_ski = false;
+  EEBUS_MUTEX_UNLOCK(self->mutex);
+}
+
+void ShipNodeOnMdnsEntryChangedCallback(const MdnsEntry* entry, MdnsEntryChange change, void* ctx) {
   ShipNode* const sn = (ShipNode*)ctx;
 
   if (sn->cancel) {
     return;
   }
 
-  if (found_entries == NULL) {
+  if (entry == NULL) {
     return;
   }
 
   EEBUS_MUTEX_LOCK(sn->mutex);
-  VectorFreeElements(sn->mdns_entries);
-  VectorMove(sn->mdns_entries, found_entries);
+  if (MdnsEntryListApplyChange(sn->mdns_entries, entry, change) != kEebusErrorOk) {
+    SHIP_NODE_DEBUG_PRINTF("%s(), failed to apply the change of %s\n", __func__, entry->name);
+  }
+
+  const bool is_remote_ski = SkiMatches(entry->ski, sn->remote_ski);
   EEBUS_MUTEX_UNLOCK(sn->mutex);
 
   sn->search_for_remote_ski = true;
@@ -268,7 +460,8 @@ void ShipNodeOnMdnsEntriesFoundCallback(Vector* found_entries, void* ctx) {
     SHIP_NODE_READER_ON_REMOTE_SERVICES_UPDATE(sn->ship_node_reader, sn->mdns_entries);
   }
 
-  if (ShipNodeIsClientSupported(sn)) {
+  // Only the changes concerning the registered remote are worth a look for the connection handling
+  if (is_remote_ski && ShipNodeIsClientSupported(sn)) {
     ShipNodeQueueMessage queue_msg = {
         .type            = kShipNodeQueueMsgTypeMdnsEntriesFound,
         .ship_connection = NULL,
@@ -294,6 +487,17 @@ void CloseShipConnection(ShipNode* self, ShipConnectionObject* sc, bool had_erro
   SHIP_CONNECTION_STOP(sc);
   SHIP_NODE_DEBUG_PRINTF("%s(), connection closed\n", __func__);
   SHIP_NODE_READER_ON_REMOTE_SKI_DISCONNECTED(self->ship_node_reader, SHIP_CONNECTION_GET_REMOTE_SKI(sc));
+
+  EEBUS_MUTEX_LOCK(self->mutex);
+  ConnectionMapping* const cm = ShipNodeGetConnectionMapping(self, SHIP_CONNECTION_GET_REMOTE_SKI(sc));
+  if (cm != NULL) {
+    cm->is_attempt_running = false;
+    if (ShipNodeIsClientSupported(self) && !self->cancel) {
+      ShipNodeScheduleReconnect(self, cm);
+    }
+  }
+  EEBUS_MUTEX_UNLOCK(self->mutex);
+
   ShipConnectionDelete(sc);
   self->ship_connection = NULL;
 
@@ -323,7 +527,17 @@ bool IsWaitingForTrustAllowed(InfoProviderObject* self, const char* ski) {
 }
 
 void HandleShipStateUpdate(InfoProviderObject* self, const char* ski, SmeState state, const char* err) {
-  const ShipNode* const sn = SHIP_NODE(self);
+  ShipNode* const sn = SHIP_NODE(self);
+
+  if (state == kDataExchange) {
+    // Connection is established, start the backoff from scratch next time
+    EEBUS_MUTEX_LOCK(sn->mutex);
+    ConnectionMapping* const cm = ShipNodeGetConnectionMapping(sn, ski);
+    if (cm != NULL) {
+      cm->attempt_cnt = 0;
+    }
+    EEBUS_MUTEX_UNLOCK(sn->mutex);
+  }
 
   SHIP_NODE_READER_ON_SHIP_STATE_UPDATE(sn->ship_node_reader, ski, state);
 }
@@ -342,6 +556,27 @@ bool SkiMatches(const char* ski_a, const char* ski_b) {
   return strcmp(ski_a, ski_b) == 0;
 }
 
+char* ShipNodeFindCborSki(const ShipNode* self, const char* ski) {
+  for (size_t i = 0; i < VectorGetSize(self->cbor_skis); ++i) {
+    char* const cbor_ski = (char*)VectorGetElement(self->cbor_skis, i);
+    if (SkiMatches(cbor_ski, ski)) {
+      return cbor_ski;
+    }
+  }
+
+  return NULL;
+}
+
+bool IsCborEnabledForSki(InfoProviderObject* self, const char* ski) {
+  ShipNode* const sn = SHIP_NODE(self);
+
+  EEBUS_MUTEX_LOCK(sn->mutex);
+  const bool is_cbor_enabled = (ShipNodeFindCborSki(sn, ski) != NULL);
+  EEBUS_MUTEX_UNLOCK(sn->mutex);
+
+  return is_cbor_enabled;
+}
+
 static bool ShipNodeFindService(ShipNode* self, MdnsEntry* found_entry) {
   if (self->cancel) {
     return false;
@@ -382,15 +617,23 @@ static void ShipNodeConnectToService(ShipNode* self, const MdnsEntry* found_entr
     --len;
   }
 
+  ConnectionMapping* const cm = ShipNodeAddConnectionMapping(self, found_entry->ski);
+  if (cm != NULL) {
+    ++cm->attempt_cnt;
+  }
+
   const char* const uri
       = StringFmtSprintf("wss://%.*s:%d%s", len, found_entry->host, found_entry->port, found_entry->path);
-  if (uri == NULL) {
-    return;
+  if (uri != NULL) {
+    self->websocket_creator
+        = WebsocketClientCreatorCreate(uri, self->tsl_certificate, self->tls_session_cache, self->remote_ski);
+    StringDelete((char*)uri);
   }
 
-  self->websocket_creator = WebsocketClientCreatorCreate(uri, self->tsl_certificate, self->remote_ski);
-  StringDelete((char*)uri);
   if (self->websocket_creator == NULL) {
+    if (cm != NULL) {
+      ShipNodeScheduleReconnect(self, cm);
+    }
     return;
   }
 
@@ -413,38 +656,57 @@ static void ShipNodeConnectToService(ShipNode* self, const MdnsEntry* found_entr
     self->ship_connection = NULL;
   }
 
+  if (cm != NULL) {
+    cm->is_attempt_running = self->connection_attempt_running;
+    if (!self->connection_attempt_running) {
+      ShipNodeScheduleReconnect(self, cm);
+    }
+  }
+
   WebsocketCreatorDelete(self->websocket_creator);
   self->websocket_creator = NULL;
 }
 
+void ShipNodeHandleQueueMessage(ShipNode* self, const ShipNodeQueueMessage* queue_msg) {
+  if (queue_msg->type == kShipNodeQueueMsgTypeMdnsEntriesFound) {
+    ShipNodeHandleMdnsEntriesFound(self);
+  } else if (queue_msg->type == kShipNodeQueueMsgTypeReconnectTick) {
+    ShipNodeHandleReconnectTick(self);
+  } else if (queue_msg->type == kShipNodeQueueMsgTypeShipConnectionClosed) {
+    CloseShipConnection(self, queue_msg->ship_connection, queue_msg->had_error);
+  } else if (queue_msg->type == kShipNodeQueueMsgTypeShipUnregisterSki) {
+    ShipNodeUnregisterSki(SHIP_NODE_OBJECT(self), queue_msg->ski);
+  } else if (queue_msg->type == kShipNodeQueueMsgTypeShipRegisterSki) {
+    ShipNodeRegisterSki(SHIP_NODE_OBJECT(self), queue_msg->ski, true);
+  }
+}
+
 void* ShipNodeConnectionLoop(void* ctx) {
-  ShipNode* const sn             = (ShipNode*)ctx;
-  ShipNodeQueueMessage queue_msg = {0};
-  EebusError err                 = kEebusErrorOk;
+  ShipNode* const sn = (ShipNode*)ctx;
+
+  ShipNodeQueueMessage queue_msgs[SHIP_NODE_QUEUE_BATCH_MAX_MSG];
+  size_t msg_num = 0;
 
   while (!sn->cancel) {
-    err = EEBUS_QUEUE_RECEIVE(sn->msg_queue, &queue_msg, kTimeoutInfinite);
+    const EebusError err = EEBUS_QUEUE_RECEIVE_MANY(
+        sn->msg_queue,
+        queue_msgs,
+        SHIP_NODE_QUEUE_BATCH_MAX_MSG,
+        &msg_num,
+        kTimeoutInfinite
+    );
     if (err != kEebusErrorOk) {
       continue;
     }
 
-    if (queue_msg.type == kShipNodeQueueMsgTypeMdnsEntriesFound) {
-      MdnsEntry found_entry;
-      EEBUS_MUTEX_LOCK(sn->mutex);
-      if (ShipNodeFindService(sn, &found_entry)) {
-        ShipNodeConnectToService(sn, &found_entry);
+    for (size_t i = 0; i < msg_num; ++i) {
+      // The messages following the cancellation are only released
+      if (!sn->cancel) {
+        ShipNodeHandleQueueMessage(sn, &queue_msgs[i]);
       }
 
-      sn->search_for_remote_ski = false;
-      EEBUS_MUTEX_UNLOCK(sn->mutex);
-    } else if (queue_msg.type == kShipNodeQueueMsgTypeShipConnectionClosed) {
-      CloseShipConnection(sn, queue_msg.ship_connection, queue_msg.had_error);
-    } else if (queue_msg.type == kShipNodeQueueMsgTypeShipUnregisterSki) {
-      ShipNodeUnregisterSki(SHIP_NODE_OBJECT(sn), queue_msg.ski);
-    } else if (queue_msg.type == kShipNodeQueueMsgTypeShipRegisterSki) {
-      ShipNodeRegisterSki(SHIP_NODE_OBJECT(sn), queue_msg.ski, true);
+      ShipNodeQueueMsgDeallocator(&queue_msgs[i]);
     }
-    ShipNodeQueueMsgDeallocator(&queue_msg);
   }
 
   return NULL;
@@ -494,7 +756,9 @@ void Start(ShipNodeObject* self) {
     HTTP_SERVER_START(sn->http_server);
   }
 
-  SHIP_MDNS_START(sn->mdns);
+  if (sn->mdns != NULL) {
+    SHIP_MDNS_START(sn->mdns);
+  }
 
   sn->connection_thread = EebusThreadCreate(ShipNodeConnectionLoop, sn, 4 * 1024);
   if (sn->connection_thread == NULL) {
@@ -507,6 +771,9 @@ void Stop(ShipNodeObject* self) {
 
   sn->cancel = true;
 
+  EEBUS_TIMER_STOP(sn->reconnect_timer);
+  sn->is_reconnect_timer_running = false;
+
   if (sn->connection_thread != NULL) {
     ShipNodeQueueMessage queue_msg = {.type = kShipNodeQueueMsgTypeCancel, .ski = NULL};
     EEBUS_QUEUE_SEND(sn->msg_queue, &queue_msg, kTimeoutInfinite);
@@ -515,7 +782,9 @@ void Stop(ShipNodeObject* self) {
     sn->connection_thread = NULL;
   }
 
-  SHIP_MDNS_STOP(sn->mdns);
+  if (sn->mdns != NULL) {
+    SHIP_MDNS_STOP(sn->mdns);
+  }
 
   if (ShipNodeIsServerSupported(sn)) {
     HTTP_SERVER_STOP(sn->http_server);
@@ -529,6 +798,11 @@ void ShipNodeRegisterSki(ShipNodeObject* self, const char* ski, bool is_trusted)
   StringDelete(sn->remote_ski);
   sn->remote_ski = StringCopy(ski);
   EEBUS_MUTEX_UNLOCK(sn->mutex);
+
+  // mDNS reports the changes only, so check whether the remote is already known
+  if (ShipNodeIsClientSupported(sn)) {
+    ShipNodeHandleMdnsEntriesFound(sn);
+  }
 }
 
 void RegisterRemoteSki(ShipNodeObject* self, const char* ski, bool is_trusted) {
@@ -550,6 +824,13 @@ void ShipNodeUnregisterSki(ShipNodeObject* self, const char* ski) {
   EEBUS_MUTEX_LOCK(sn->mutex);
   StringDelete(sn->remote_ski);
   sn->remote_ski = NULL;
+
+  // Forget the backoff state, so that no reconnect is attempted anymore
+  ConnectionMapping* const cm = ShipNodeGetConnectionMapping(sn, ski);
+  if (cm != NULL) {
+    VectorRemove(sn->connections_table, cm);
+    ConnectionMappingDeallocator(cm);
+  }
   EEBUS_MUTEX_UNLOCK(sn->mutex);
 
   // TODO: Fix possible situation that ShipConnection Start() is called
@@ -580,3 +861,28 @@ void UnregisterRemoteSki(ShipNodeObject* self, const char* ski) {
 void CancelPairingWithSki(ShipNodeObject* self, const char* ski) {
   // TODO: Implement method
 }
+
+void AddRemoteService(ShipNodeObject* self, const MdnsEntry* entry) {
+  ShipNodeOnMdnsEntryChangedCallback(entry, kMdnsEntryAdded, SHIP_NODE(self));
+}
+
+void SetCborEnabledForSki(ShipNodeObject* self, const char* ski, bool enable) {
+  ShipNode* const sn = SHIP_NODE(self);
+
+  if (StringIsEmpty(ski)) {
+    return;
+  }
+
+  EEBUS_MUTEX_LOCK(sn->mutex);
+  char* const cbor_ski = ShipNodeFindCborSki(sn, ski);
+  if (enable && (cbor_ski == NULL)) {
+    char* const ski_copy = StringCopy(ski);
+    if (ski_copy != NULL) {
+      VectorPushBack(sn->cbor_skis, ski_copy);
+    }
+  } else if (!enable && (cbor_ski != NULL)) {
+    VectorRemove(sn->cbor_skis, cbor_ski);
+    StringDelete(cbor_ski);
+  }
+  EEBUS_MUTEX_UNLOCK(sn->mutex);
+}
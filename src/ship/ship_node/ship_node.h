@@ -36,6 +36,8 @@ extern "C" {
 
 /**
  * @brief Create the new ShipNode instance
+ * @param service_name mDNS service name, NULL to run without mDNS.
+ * In that case the remote services are added with SHIP_NODE_ADD_REMOTE_SERVICE()
  * @param ssl_cert The loaded into memory SSL certificate
  * @param ssl_cert_size SSL certificate buffer size
  * Hint: see lws_context_creation_info Struct at:
@@ -17,10 +17,12 @@
 #define SRC_SHIP_SHIP_NODE_SHIP_NODE_INTERNAL_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "src/common/api/eebus_mutex_interface.h"
 #include "src/common/api/eebus_queue_interface.h"
 #include "src/common/api/eebus_thread_interface.h"
+#include "src/common/api/eebus_timer_interface.h"
 #include "src/common/service_details.h"
 #include "src/ship/api/http_server_interface.h"
 #include "src/ship/api/ship_connection_interface.h"
@@ -28,6 +30,7 @@
 #include "src/ship/api/ship_node_interface.h"
 #include "src/ship/api/ship_node_reader_interface.h"
 #include "src/ship/api/tls_certificate_interface.h"
+#include "src/ship/api/tls_session_cache_interface.h"
 #include "src/ship/api/websocket_creator_interface.h"
 #include "src/ship/ship_connection/types.h"
 
@@ -44,6 +47,12 @@ struct ConnectionMapping {
   int attempt_cnt;
   bool is_attempt_running;
   ServiceDetails* service_details;
+  /** Reconnect is scheduled and waits for the backoff delay to elapse */
+  bool is_retry_pending;
+  /** Time left until the scheduled reconnect, counted down by the reconnect timer */
+  uint32_t retry_delay_ms;
+  /** Remote service was present in the latest mDNS browse results */
+  bool is_announced;
 };
 
 typedef struct ShipNode ShipNode;
@@ -54,6 +63,8 @@ struct ShipNode {
 
   EebusQueueObject* msg_queue;
   char* remote_ski;
+  /** SKIs of the remote services opted in the CBOR encoding of SPINE datagrams */
+  Vector* cbor_skis;
   ShipMdnsObject* mdns;
   Vector* mdns_entries;
   EebusMutexObject* mutex;
@@ -61,9 +72,17 @@ struct ShipNode {
   bool cancel;
   EebusThreadObject* connection_thread;
 
-  ConnectionMapping* connections_table;
+  /** Connection attempts bookkeeping per remote SKI, ConnectionMapping elements */
+  Vector* connections_table;
+  /** Shared timer counting down the reconnect backoff delays of all the remote SKIs */
+  EebusTimerObject* reconnect_timer;
+  bool is_reconnect_timer_running;
+  /** Reconnect delay jitter generator state, seeded with the local SKI and the start time */
+  uint32_t reconnect_prng_state;
   ShipNodeReaderObject* ship_node_reader;
   const TlsCertificateObject* tsl_certificate;
+  /** TLS sessions of the remote devices connected as client, used for the session resumption on reconnect */
+  TlsSessionCacheObject* tls_session_cache;
   ServiceDetails* local_service_details;
   // Temporary single SHIP Connection object instance
   // for early stage of Ship Node development and testing.
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Ship Node reconnect backoff implementation
+ *
+ * Each node keeps its own xorshift32 generator state instead of using rand(),
+ * so the jitter neither depends on the global seed nor races with other rand() users.
+ */
+
+#include "src/ship/ship_node/ship_node_reconnect.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+static uint32_t NextRandom(uint32_t* prng_state);
+
+uint32_t ShipNodeReconnectSeed(const char* ski, uint64_t time) {
+  // FNV-1a over the SKI
+  uint32_t hash = 2166136261u;
+  for (const char* p = ski; (p != NULL) && (*p != '\0'); ++p) {
+    hash ^= (uint8_t)*p;
+    hash *= 16777619u;
+  }
+
+  hash ^= (uint32_t)time ^ (uint32_t)(time >> 32);
+
+  // Zero is the fixed point of xorshift
+  return (hash != 0) ? hash : 1;
+}
+
+uint32_t NextRandom(uint32_t* prng_state) {
+  uint32_t x = *prng_state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+
+  *prng_state = x;
+  return x;
+}
+
+uint32_t ShipNodeCalcReconnectDelay(uint32_t* prng_state, int attempt_cnt) {
+  // Exponential backoff: 2s, 4s, 8s, ... up to the limit
+  uint32_t delay = SHIP_NODE_RECONNECT_DELAY_MIN_MS;
+  for (int i = 1; (i < attempt_cnt) && (delay < SHIP_NODE_RECONNECT_DELAY_MAX_MS); ++i) {
+    delay *= 2;
+  }
+
+  if (delay > SHIP_NODE_RECONNECT_DELAY_MAX_MS) {
+    delay = SHIP_NODE_RECONNECT_DELAY_MAX_MS;
+  }
+
+  // Pick the delay randomly from the upper half, so that the peers do not retry in lockstep
+  return delay / 2 + NextRandom(prng_state) % (delay / 2 + 1);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Ship Node reconnect backoff declarations
+ */
+
+#ifndef SRC_SHIP_SHIP_NODE_SHIP_NODE_RECONNECT_H_
+#define SRC_SHIP_SHIP_NODE_SHIP_NODE_RECONNECT_H_
+
+#include <stdint.h>
+
+#include "src/common/api/eebus_timer_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/** Reconnect backoff delay after the first failed attempt */
+#define SHIP_NODE_RECONNECT_DELAY_MIN_MS SECONDS(2)
+/** Reconnect backoff delay upper limit */
+#define SHIP_NODE_RECONNECT_DELAY_MAX_MS SECONDS(120)
+
+/**
+ * @brief Get the seed of the reconnect delay pseudo random generator.
+ * The nodes started at the same time still get distinct sequences as long as their SKIs differ
+ * @param ski SKI of the local node
+ * @param time Current time, e.g. time(NULL)
+ * @return Non-zero generator state
+ */
+uint32_t ShipNodeReconnectSeed(const char* ski, uint64_t time);
+
+/**
+ * @brief Calculate the reconnect delay with the exponential backoff and the jitter
+ * @param prng_state Pseudo random generator state, initialized with ShipNodeReconnectSeed()
+ * @param attempt_cnt Number of the failed connection attempts
+ * @return Delay picked from the upper half of the backoff interval, in milliseconds
+ */
+uint32_t ShipNodeCalcReconnectDelay(uint32_t* prng_state, int attempt_cnt);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_SHIP_SHIP_NODE_SHIP_NODE_RECONNECT_H_
@@ -71,6 +71,10 @@ static bool CheckSki(const X509* cert, const char* ski);
 static EebusError LoadX509Certificate(TlsCertificate* self, const char* cert_file);
 static EVP_PKEY* PemPrivateKeyRead(const char* key_file);
 static EebusError LoadX509PrivateKey(TlsCertificate* self, const char* key_file);
+static EVP_PKEY* GenerateEcKey(void);
+static X509* GenerateSelfSignedCert(EVP_PKEY* pkey, const char* common_name, uint32_t valid_days);
+static EebusError SetCertificate(TlsCertificate* self, X509* x509_cert);
+static EebusError SetPrivateKey(TlsCertificate* self, EVP_PKEY* pkey);
 
 void TlsCertificateConstruct(TlsCertificate* self) {
   // Override "virtual functions table"
@@ -170,29 +174,32 @@ bool CheckSki(const X509* cert, const char* ski) {
   return ok;
 }
 
-EebusError LoadX509Certificate(TlsCertificate* self, const char* cert_file) {
-  X509* const pem_cert = PemCertRead(cert_file);
-  if (pem_cert == NULL) {
-    return kEebusErrorFileSystemNoFile;
-  }
-
-  // Transform PEM -> DER
+EebusError SetCertificate(TlsCertificate* self, X509* x509_cert) {
+  // Transform X509 -> DER
   uint8_t* cert = NULL;
 
-  self->cert_size = i2d_X509(pem_cert, &cert);
+  self->cert_size = i2d_X509(x509_cert, &cert);
 
   self->cert = cert;
-  if ((self->cert == NULL) || (self->cert_size == 0)) {
-    X509_free(pem_cert);
+  if ((self->cert == NULL) || (self->cert_size <= 0)) {
     return kEebusErrorMemoryAllocate;
   }
 
-  self->ski     = CalcSubjectKeyIdString(pem_cert);
-  const bool ok = CheckSki(pem_cert, self->ski);
+  self->ski = CalcSubjectKeyIdString(x509_cert);
+  return CheckSki(x509_cert, self->ski) ? kEebusErrorOk : kEebusErrorInit;
+}
+
+EebusError LoadX509Certificate(TlsCertificate* self, const char* cert_file) {
+  X509* const pem_cert = PemCertRead(cert_file);
+  if (pem_cert == NULL) {
+    return kEebusErrorFileSystemNoFile;
+  }
+
+  const EebusError err = SetCertificate(self, pem_cert);
 
   X509_free(pem_cert);
 
-  return ok ? kEebusErrorOk : kEebusErrorInit;
+  return err;
 }
 
 EVP_PKEY* PemPrivateKeyRead(const char* key_file) {
@@ -208,24 +215,80 @@ EVP_PKEY* PemPrivateKeyRead(const char* key_file) {
   return pkey;
 }
 
+EebusError SetPrivateKey(TlsCertificate* self, EVP_PKEY* pkey) {
+  uint8_t* pkey_der = NULL;
+
+  self->pkey_size = i2d_PrivateKey(pkey, &pkey_der);
+
+  self->pkey = pkey_der;
+  if ((self->pkey == NULL) || (self->pkey_size <= 0)) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  return kEebusErrorOk;
+}
+
 EebusError LoadX509PrivateKey(TlsCertificate* self, const char* key_file) {
   EVP_PKEY* const pem_pkey = PemPrivateKeyRead(key_file);
   if (pem_pkey == NULL) {
     return kEebusErrorFileSystemNoFile;
   }
 
-  uint8_t* pkey = NULL;
+  const EebusError err = SetPrivateKey(self, pem_pkey);
 
-  self->pkey_size = i2d_PrivateKey(pem_pkey, &pkey);
+  EVP_PKEY_free(pem_pkey);
+  return err;
+}
 
-  self->pkey = pkey;
-  if ((self->pkey == NULL) || (self->pkey_size == 0)) {
-    EVP_PKEY_free(pem_pkey);
-    return kEebusErrorMemoryAllocate;
+EVP_PKEY* GenerateEcKey(void) {
+  EVP_PKEY_CTX* const ctx = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, NULL);
+  if (ctx == NULL) {
+    return NULL;
   }
 
-  EVP_PKEY_free(pem_pkey);
-  return kEebusErrorOk;
+  EVP_PKEY* pkey = NULL;
+  if ((EVP_PKEY_keygen_init(ctx) != 1) || (EVP_PKEY_CTX_set_ec_paramgen_curve_nid(ctx, NID_X9_62_prime256v1) != 1)
+      || (EVP_PKEY_keygen(ctx, &pkey) != 1)) {
+    EVP_PKEY_free(pkey);
+    pkey = NULL;
+  }
+
+  EVP_PKEY_CTX_free(ctx);
+  return pkey;
+}
+
+X509* GenerateSelfSignedCert(EVP_PKEY* pkey, const char* common_name, uint32_t valid_days) {
+  X509* const cert = X509_new();
+  if (cert == NULL) {
+    return NULL;
+  }
+
+  X509_NAME* const name = X509_get_subject_name(cert);
+
+  bool ok = (X509_set_version(cert, 2) == 1) && (ASN1_INTEGER_set(X509_get_serialNumber(cert), 1) == 1)
+            && (X509_gmtime_adj(X509_getm_notBefore(cert), 0) != NULL)
+            && (X509_gmtime_adj(X509_getm_notAfter(cert), (long)valid_days * 24 * 60 * 60) != NULL)
+            && (X509_set_pubkey(cert, pkey) == 1)
+            && (X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_UTF8, (const uint8_t*)common_name, -1, -1, 0) == 1)
+            && (X509_set_issuer_name(cert, name) == 1);
+
+  if (ok) {
+    // SHIP identifies the node by the Subject Key Identifier, make it match the public key hash
+    X509V3_CTX ext_ctx;
+    X509V3_set_ctx(&ext_ctx, cert, cert, NULL, NULL, 0);
+
+    X509_EXTENSION* const ext = X509V3_EXT_conf_nid(NULL, &ext_ctx, NID_subject_key_identifier, "hash");
+
+    ok = (ext != NULL) && (X509_add_ext(cert, ext, -1) == 1);
+    X509_EXTENSION_free(ext);
+  }
+
+  if (!ok || (X509_sign(cert, pkey, EVP_sha256()) <= 0)) {
+    X509_free(cert);
+    return NULL;
+  }
+
+  return cert;
 }
 
 TlsCertificateObject* TlsCertificateLoadX509KeyPair(const char* cert_file, const char* key_file) {
@@ -250,6 +313,45 @@ TlsCertificateParseX509KeyPair(const char* cert_buf, size_t cert_buf_size, const
   return NULL;  // Not implemented
 }
 
+TlsCertificateObject* TlsCertificateCreateSelfSigned(const char* common_name, uint32_t valid_days) {
+  if ((common_name == NULL) || (valid_days == 0)) {
+    return NULL;
+  }
+
+  EVP_PKEY* const pkey = GenerateEcKey();
+  if (pkey == NULL) {
+    return NULL;
+  }
+
+  X509* const x509_cert = GenerateSelfSignedCert(pkey, common_name, valid_days);
+  if (x509_cert == NULL) {
+    EVP_PKEY_free(pkey);
+    return NULL;
+  }
+
+  TlsCertificate* const tls_certificate = (TlsCertificate*)EEBUS_MALLOC(sizeof(TlsCertificate));
+  if (tls_certificate == NULL) {
+    X509_free(x509_cert);
+    EVP_PKEY_free(pkey);
+    return NULL;
+  }
+
+  TlsCertificateConstruct(tls_certificate);
+
+  const bool ok = (SetCertificate(tls_certificate, x509_cert) == kEebusErrorOk)
+                  && (SetPrivateKey(tls_certificate, pkey) == kEebusErrorOk);
+
+  X509_free(x509_cert);
+  EVP_PKEY_free(pkey);
+
+  if (!ok) {
+    TlsCertificateDelete(TLS_CERTIFICATE_OBJECT(tls_certificate));
+    return NULL;
+  }
+
+  return TLS_CERTIFICATE_OBJECT(tls_certificate);
+}
+
 void Destruct(TlsCertificateObject* self) {
   TlsCertificate* const tls_cert = TLS_CERTIFICATE(self);
 
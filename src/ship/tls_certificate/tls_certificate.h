@@ -21,6 +21,8 @@
 #ifndef SRC_SHIP_TLS_CERTIFICATE_TLS_CERTIFICATE_H_
 #define SRC_SHIP_TLS_CERTIFICATE_TLS_CERTIFICATE_H_
 
+#include <stdint.h>
+
 #include "src/ship/api/tls_certificate_interface.h"
 
 #ifdef __cplusplus
@@ -32,6 +34,14 @@ TlsCertificateObject* TlsCertificateLoadX509KeyPair(const char* cert_file, const
 TlsCertificateObject*
 TlsCertificateParseX509KeyPair(const char* cert_buf, size_t cert_buf_size, const char* key_buf, size_t key_buf_size);
 
+/**
+ * @brief Generates a new self-signed EC P-256 certificate with the Subject Key Identifier extension set
+ * @param common_name Certificate subject Common Name
+ * @param valid_days Certificate validity period starting from now, days
+ * @return Certificate object on success, NULL otherwise
+ */
+TlsCertificateObject* TlsCertificateCreateSelfSigned(const char* common_name, uint32_t valid_days);
+
 static inline void TlsCertificateDelete(TlsCertificateObject* tls_certificate) {
   if (tls_certificate != NULL) {
     TLS_CERTIFICATE_DESTRUCT(tls_certificate);
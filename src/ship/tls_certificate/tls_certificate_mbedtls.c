@@ -18,11 +18,18 @@
  * @brief Tls Certificate mbedTLS based implementation
  */
 
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/ecp.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/pk.h>
+#include <mbedtls/sha1.h>
 #include <mbedtls/x509.h>
 #include <mbedtls/x509_crt.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #include "src/common/array_util.h"
 #include "src/common/debug.h"
@@ -45,6 +52,12 @@
 
 #define PKEY_BUF_SIZE 2048
 
+/** Self-signed certificate DER buffer size, well above the EC P-256 certificate size */
+#define SELF_SIGNED_CERT_BUF_SIZE 1024
+
+/** Certificate subject name buffer size, "CN=" prefix and the Common Name */
+#define SUBJECT_NAME_BUF_SIZE 128
+
 typedef struct TlsCertificate TlsCertificate;
 
 struct TlsCertificate {
@@ -82,8 +95,14 @@ static void TlsCertificateConstruct(TlsCertificate* self);
 static const char* CalcSubjectKeyIdStringWithBuf(const mbedtls_x509_crt* cert, unsigned char* buf, size_t buf_size);
 static const char* CalcSubjectKeyIdString(const mbedtls_x509_crt* cert);
 static bool CheckSki(const mbedtls_x509_crt* cert, const char* ski);
+static EebusError SetCertificate(TlsCertificate* self, const mbedtls_x509_crt* cert);
+static EebusError SetPrivateKey(TlsCertificate* self, const mbedtls_pk_context* pk);
 static EebusError ParseX509Certificate(TlsCertificate* self, const char* cert_buf, size_t cert_buf_size);
 static EebusError ParseX509PrivateKey(TlsCertificate* self, const char* key_buf, size_t key_buf_size);
+static EebusError GenerateEcKey(mbedtls_pk_context* pk, mbedtls_ctr_drbg_context* ctr_drbg);
+static bool FormatValidityTime(time_t time_val, char* buf, size_t buf_size);
+static EebusError GenerateSelfSignedCert(TlsCertificate* self, mbedtls_pk_context* pk,
+    mbedtls_ctr_drbg_context* ctr_drbg, const char* common_name, uint32_t valid_days);
 
 void TlsCertificateConstruct(TlsCertificate* self) {
   // Override "virtual functions table"
@@ -215,22 +234,26 @@ EebusError ParseX509Certificate(TlsCertificate* self, const char* cert_buf, size
     return kEebusErrorInit;
   }
 
-  // DER data is available in cert.raw.p and cert.raw.len
-  self->cert      = ArrayCopy(cert.raw.p, cert.raw.len, sizeof(uint8_t));
-  self->cert_size = cert.raw.len;
+  const EebusError err = SetCertificate(self, &cert);
+  mbedtls_x509_crt_free(&cert);
+  return err;
+}
+
+EebusError SetCertificate(TlsCertificate* self, const mbedtls_x509_crt* cert) {
+  // DER data is available in cert->raw.p and cert->raw.len
+  self->cert      = ArrayCopy(cert->raw.p, cert->raw.len, sizeof(uint8_t));
+  self->cert_size = cert->raw.len;
   if (self->cert == NULL) {
     TLS_CERTIFICATE_MBEDTLS_DEBUG_PRINTF("Failed to allocate memory for certificate\n");
-    mbedtls_x509_crt_free(&cert);
     return kEebusErrorMemoryAllocate;
   }
 
-  self->ski     = CalcSubjectKeyIdString(&cert);
-  const bool ok = CheckSki(&cert, self->ski);
+  self->ski     = CalcSubjectKeyIdString(cert);
+  const bool ok = CheckSki(cert, self->ski);
   if (!ok) {
     TLS_CERTIFICATE_MBEDTLS_DEBUG_PRINTF("Invalid Subject Key Identifier\n");
   }
 
-  mbedtls_x509_crt_free(&cert);
   return ok ? kEebusErrorOk : kEebusErrorInit;
 }
 
@@ -250,18 +273,24 @@ EebusError ParseX509PrivateKey(TlsCertificate* self, const char* key_buf, size_t
 
   if (ret != 0) {
     TLS_CERTIFICATE_MBEDTLS_DEBUG_PRINTF("mbedtls_pk_parse_key failed: -0x%04X\n", -ret);
+    mbedtls_pk_free(&pk);
     return kEebusErrorInit;
   }
 
-  // DER data is available in pk.raw.p and pk.raw.len
+  const EebusError err = SetPrivateKey(self, &pk);
+  mbedtls_pk_free(&pk);
+  return err;
+}
+
+EebusError SetPrivateKey(TlsCertificate* self, const mbedtls_pk_context* pk) {
   uint8_t* pkey_buf = EEBUS_MALLOC(PKEY_BUF_SIZE);
   if (pkey_buf == NULL) {
     return kEebusErrorMemoryAllocate;
   }
 
   memset(pkey_buf, 0, PKEY_BUF_SIZE);
-  self->pkey_size = mbedtls_pk_write_key_der(&pk, pkey_buf, PKEY_BUF_SIZE);
-  if (self->pkey_size == 0) {
+  self->pkey_size = mbedtls_pk_write_key_der(pk, pkey_buf, PKEY_BUF_SIZE);
+  if (self->pkey_size <= 0) {
     TLS_CERTIFICATE_MBEDTLS_DEBUG_PRINTF("mbedtls_pk_write_key_der failed\n");
     EEBUS_FREE(pkey_buf);
     return kEebusErrorInit;
@@ -282,6 +311,148 @@ TlsCertificateObject* TlsCertificateLoadX509KeyPair(const char* cert_file, const
   return NULL;  // Not implemented
 }
 
+EebusError GenerateEcKey(mbedtls_pk_context* pk, mbedtls_ctr_drbg_context* ctr_drbg) {
+  int ret = mbedtls_pk_setup(pk, mbedtls_pk_info_from_type(MBEDTLS_PK_ECKEY));
+  if (ret != 0) {
+    TLS_CERTIFICATE_MBEDTLS_DEBUG_PRINTF("mbedtls_pk_setup failed: -0x%04X\n", -ret);
+    return kEebusErrorInit;
+  }
+
+  ret = mbedtls_ecp_gen_key(MBEDTLS_ECP_DP_SECP256R1, mbedtls_pk_ec(*pk), mbedtls_ctr_drbg_random, ctr_drbg);
+  if (ret != 0) {
+    TLS_CERTIFICATE_MBEDTLS_DEBUG_PRINTF("mbedtls_ecp_gen_key failed: -0x%04X\n", -ret);
+    return kEebusErrorInit;
+  }
+
+  return kEebusErrorOk;
+}
+
+bool FormatValidityTime(time_t time_val, char* buf, size_t buf_size) {
+  struct tm tm;
+  if (gmtime_r(&time_val, &tm) == NULL) {
+    return false;
+  }
+
+  // mbedTLS expects the validity time as "YYYYMMDDhhmmss"
+  return strftime(buf, buf_size, "%Y%m%d%H%M%S", &tm) == (MBEDTLS_X509_RFC5280_UTC_TIME_LEN - 1);
+}
+
+EebusError GenerateSelfSignedCert(TlsCertificate* self, mbedtls_pk_context* pk,
+    mbedtls_ctr_drbg_context* ctr_drbg, const char* common_name, uint32_t valid_days) {
+  char subject_name[SUBJECT_NAME_BUF_SIZE];
+  const int subject_name_len = snprintf(subject_name, sizeof(subject_name), "CN=%s", common_name);
+  if ((subject_name_len < 0) || ((size_t)subject_name_len >= sizeof(subject_name))) {
+    TLS_CERTIFICATE_MBEDTLS_DEBUG_PRINTF("Common Name is too long\n");
+    return kEebusErrorInputArgument;
+  }
+
+  const time_t now = time(NULL);
+  char not_before[MBEDTLS_X509_RFC5280_UTC_TIME_LEN];
+  char not_after[MBEDTLS_X509_RFC5280_UTC_TIME_LEN];
+  if (!FormatValidityTime(now, not_before, sizeof(not_before))
+      || !FormatValidityTime(now + (time_t)valid_days * 24 * 60 * 60, not_after, sizeof(not_after))) {
+    return kEebusErrorInit;
+  }
+
+  static const unsigned char kSerial[] = {1};
+
+  mbedtls_x509write_cert crt;
+  mbedtls_x509write_crt_init(&crt);
+  mbedtls_x509write_crt_set_version(&crt, MBEDTLS_X509_CRT_VERSION_3);
+  mbedtls_x509write_crt_set_md_alg(&crt, MBEDTLS_MD_SHA256);
+  mbedtls_x509write_crt_set_subject_key(&crt, pk);
+  mbedtls_x509write_crt_set_issuer_key(&crt, pk);
+
+  // SHIP identifies the node by the Subject Key Identifier, mbedTLS sets it to the public key hash
+  bool ok = (mbedtls_x509write_crt_set_subject_name(&crt, subject_name) == 0)
+            && (mbedtls_x509write_crt_set_issuer_name(&crt, subject_name) == 0)
+            && (mbedtls_x509write_crt_set_serial_raw(&crt, (unsigned char*)kSerial, sizeof(kSerial)) == 0)
+            && (mbedtls_x509write_crt_set_validity(&crt, not_before, not_after) == 0)
+            && (mbedtls_x509write_crt_set_subject_key_identifier(&crt) == 0);
+
+  unsigned char* const cert_buf = ok ? EEBUS_MALLOC(SELF_SIGNED_CERT_BUF_SIZE) : NULL;
+
+  int cert_size = -1;
+  if (cert_buf != NULL) {
+    // The DER data is written at the end of the buffer
+    cert_size = mbedtls_x509write_crt_der(&crt, cert_buf, SELF_SIGNED_CERT_BUF_SIZE, mbedtls_ctr_drbg_random, ctr_drbg);
+  }
+
+  mbedtls_x509write_crt_free(&crt);
+
+  if (cert_size <= 0) {
+    TLS_CERTIFICATE_MBEDTLS_DEBUG_PRINTF("Failed to write the self-signed certificate: -0x%04X\n", -cert_size);
+    if (cert_buf != NULL) {
+      EEBUS_FREE(cert_buf);
+    }
+
+    return kEebusErrorInit;
+  }
+
+  mbedtls_x509_crt cert;
+  mbedtls_x509_crt_init(&cert);
+  const int ret = mbedtls_x509_crt_parse_der(&cert, cert_buf + SELF_SIGNED_CERT_BUF_SIZE - cert_size, cert_size);
+  EEBUS_FREE(cert_buf);
+
+  EebusError err = kEebusErrorInit;
+  if (ret == 0) {
+    err = SetCertificate(self, &cert);
+  } else {
+    TLS_CERTIFICATE_MBEDTLS_DEBUG_PRINTF("mbedtls_x509_crt_parse_der failed: -0x%04X\n", -ret);
+  }
+
+  mbedtls_x509_crt_free(&cert);
+  return err;
+}
+
+TlsCertificateObject* TlsCertificateCreateSelfSigned(const char* common_name, uint32_t valid_days) {
+  if ((common_name == NULL) || (valid_days == 0)) {
+    return NULL;
+  }
+
+  TlsCertificate* const tls_certificate = (TlsCertificate*)EEBUS_MALLOC(sizeof(TlsCertificate));
+  if (tls_certificate == NULL) {
+    return NULL;
+  }
+
+  TlsCertificateConstruct(tls_certificate);
+
+  static const char kPersonalization[] = "eebus_self_signed_cert";
+
+  mbedtls_entropy_context entropy;
+  mbedtls_ctr_drbg_context ctr_drbg;
+  mbedtls_pk_context pk;
+  mbedtls_entropy_init(&entropy);
+  mbedtls_ctr_drbg_init(&ctr_drbg);
+  mbedtls_pk_init(&pk);
+
+  const int ret = mbedtls_ctr_drbg_seed(
+      &ctr_drbg,
+      mbedtls_entropy_func,
+      &entropy,
+      (const unsigned char*)kPersonalization,
+      sizeof(kPersonalization) - 1
+  );
+  if (ret != 0) {
+    TLS_CERTIFICATE_MBEDTLS_DEBUG_PRINTF("mbedtls_ctr_drbg_seed failed: -0x%04X\n", -ret);
+  }
+
+  const bool ok = (ret == 0) && (GenerateEcKey(&pk, &ctr_drbg) == kEebusErrorOk)
+                  && (GenerateSelfSignedCert(tls_certificate, &pk, &ctr_drbg, common_name, valid_days) == kEebusErrorOk)
+                  && (SetPrivateKey(tls_certificate, &pk) == kEebusErrorOk);
+
+  mbedtls_pk_free(&pk);
+  mbedtls_ctr_drbg_free(&ctr_drbg);
+  mbedtls_entropy_free(&entropy);
+
+  if (!ok) {
+    TlsCertificateDelete(TLS_CERTIFICATE_OBJECT(tls_certificate));
+    return NULL;
+  }
+
+  return TLS_CERTIFICATE_OBJECT(tls_certificate);
+}
+
 TlsCertificateObject*
 TlsCertificateParseX509KeyPair(const char* cert_buf, size_t cert_buf_size, const char* key_buf, size_t key_buf_size) {
   TlsCertificate* const tls_certificate = (TlsCertificate*)EEBUS_MALLOC(sizeof(TlsCertificate));
@@ -57,6 +57,18 @@
 #define LWS_SERVER_OPTION_MBEDTLS_VERIFY_CLIENT_CERT_POST_HANDSHAKE 0
 #endif  // LWS_SERVER_OPTION_MBEDTLS_VERIFY_CLIENT_CERT_POST_HANDSHAKE
 
+/** TLS server side session resumption is configured directly on the OpenSSL context */
+#if defined(LWS_WITH_TLS) && !defined(LWS_WITH_MBEDTLS)
+#define HTTP_SERVER_OPENSSL_SESSIONS 1
+#else
+#define HTTP_SERVER_OPENSSL_SESSIONS 0
+#endif  // defined(LWS_WITH_TLS) && !defined(LWS_WITH_MBEDTLS)
+
+#if HTTP_SERVER_OPENSSL_SESSIONS
+/** Lifetime of the TLS sessions and session tickets issued to the SHIP clients */
+static const long kHttpServerTlsSessionTimeoutSec = 60 * 60;
+#endif  // HTTP_SERVER_OPENSSL_SESSIONS
+
 typedef struct HttpServer HttpServer;
 
 struct HttpServer {
@@ -108,6 +120,7 @@ static int HttpServerOnClientConnect(HttpServer* self, struct lws* wsi);
 static int HttpServerOnReceive(HttpServer* self, struct lws* wsi, void* in, size_t len);
 static int HttpServerOnWriteable(HttpServer* self, struct lws* wsi);
 static int HttpServerOnConnectionClose(HttpServer* self, struct lws* wsi);
+static int HttpServerOnSslContextInit(HttpServer* self, void* ssl_ctx);
 static int
 HttpServerServiceCallback(struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len);
 
@@ -172,6 +185,7 @@ void HttpServerStaggerCallback(lws_sorted_usec_list_t* sul) {
   if ((srv->ws_is_active) && (srv->ws != NULL)) {
     if (!WEBSOCKET_IS_CLOSED(srv->ws)) {
       WEBSOCKET_SCHEDULE_WRITE(srv->ws);
+      WebsocketRetryReceive(srv->ws);
     }
   }
 
@@ -365,6 +379,26 @@ int HttpServerOnConnectionClose(HttpServer* self, struct lws* wsi) {
   return 0;
 }
 
+int HttpServerOnSslContextInit(HttpServer* self, void* ssl_ctx) {
+#if HTTP_SERVER_OPENSSL_SESSIONS
+  SSL_CTX* const ctx = (SSL_CTX*)ssl_ctx;
+
+  // Let the reconnecting clients resume their session instead of running the full handshake.
+  // With the client certificate verification enabled OpenSSL refuses to resume
+  // unless the session id context is set
+  static const unsigned char kSessionIdContext[] = SHIP_WEBSOCKET_SUB_PROTOCOL;
+  if (SSL_CTX_set_session_id_context(ctx, kSessionIdContext, sizeof(kSessionIdContext) - 1) != 1) {
+    HTTP_SERVER_DEBUG_PRINTF("%s(), setting the session id context failed\n", __func__);
+    return 0;
+  }
+
+  SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+  SSL_CTX_clear_options(ctx, SSL_OP_NO_TICKET);
+  SSL_CTX_set_timeout(ctx, kHttpServerTlsSessionTimeoutSec);
+#endif  // HTTP_SERVER_OPENSSL_SESSIONS
+  return 0;
+}
+
 int HttpServerServiceCallback(struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len) {
   HTTP_SERVER_DEBUG_PRINTF("%s(), reason = %s\n", __func__, WebsocketLwsReasonToString(reason));
   HttpServer* const srv = lws_context_user(lws_get_context(wsi));
@@ -381,6 +415,8 @@ int HttpServerServiceCallback(struct lws* wsi, enum lws_callback_reasons reason,
 
     case LWS_CALLBACK_EVENT_WAIT_CANCELLED: ret = 0; break;
 
+    case LWS_CALLBACK_OPENSSL_LOAD_EXTRA_SERVER_VERIFY_CERTS: ret = HttpServerOnSslContextInit(srv, user); break;
+
     default: break;
   }
 
@@ -0,0 +1,256 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Tls Session Cache implementation
+ *
+ * Serialised TLS sessions are kept per remote device SKI rather than per
+ * host and port, as the address of a SHIP node discovered via mDNS may change
+ * between the connections while its SKI is stable. The table is small, so the
+ * lookup is linear and the least recently used entry is dropped when full.
+ */
+
+#include "src/ship/websocket/tls_session_cache.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "src/common/eebus_malloc.h"
+#include "src/common/eebus_mutex/eebus_mutex.h"
+#include "src/common/string_util.h"
+#include "src/ship/api/tls_session_cache_interface.h"
+
+typedef struct TlsSession TlsSession;
+
+struct TlsSession {
+  char* ski;
+  uint8_t* session;
+  size_t session_size;
+  uint64_t last_used;
+};
+
+typedef struct TlsSessionCache TlsSessionCache;
+
+struct TlsSessionCache {
+  /** Implements the Tls Session Cache Interface */
+  TlsSessionCacheObject obj;
+
+  EebusMutexObject* mutex;
+  TlsSession* sessions;
+  size_t size;
+  size_t max_num;
+  uint64_t use_cnt;
+};
+
+#define TLS_SESSION_CACHE(obj) ((TlsSessionCache*)(obj))
+
+static void Destruct(TlsSessionCacheObject* self);
+static EebusError Store(TlsSessionCacheObject* self, const char* ski, const uint8_t* session, size_t session_size);
+static size_t Load(TlsSessionCacheObject* self, const char* ski, uint8_t* buf, size_t buf_size);
+static void Remove(TlsSessionCacheObject* self, const char* ski);
+static size_t GetSize(const TlsSessionCacheObject* self);
+
+static const TlsSessionCacheInterface tls_session_cache_methods = {
+    .destruct = Destruct,
+    .store    = Store,
+    .load     = Load,
+    .remove   = Remove,
+    .get_size = GetSize,
+};
+
+static EebusError TlsSessionCacheConstruct(TlsSessionCache* self, size_t max_num);
+static void TlsSessionRelease(TlsSession* session);
+static size_t FindIndex(const TlsSessionCache* self, const char* ski);
+static size_t FindLeastRecentlyUsed(const TlsSessionCache* self);
+
+EebusError TlsSessionCacheConstruct(TlsSessionCache* self, size_t max_num) {
+  // Override "virtual functions table"
+  TLS_SESSION_CACHE_INTERFACE(self) = &tls_session_cache_methods;
+
+  self->size     = 0;
+  self->max_num  = max_num;
+  self->use_cnt  = 0;
+  self->mutex    = EebusMutexCreate();
+  self->sessions = (TlsSession*)EEBUS_MALLOC(max_num * sizeof(TlsSession));
+  if ((self->mutex == NULL) || (self->sessions == NULL)) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  return kEebusErrorOk;
+}
+
+TlsSessionCacheObject* TlsSessionCacheCreate(size_t max_num) {
+  if (max_num == 0) {
+    return NULL;
+  }
+
+  TlsSessionCache* const tls_session_cache = (TlsSessionCache*)EEBUS_MALLOC(sizeof(TlsSessionCache));
+  if (tls_session_cache == NULL) {
+    return NULL;
+  }
+
+  if (TlsSessionCacheConstruct(tls_session_cache, max_num) != kEebusErrorOk) {
+    TlsSessionCacheDelete(TLS_SESSION_CACHE_OBJECT(tls_session_cache));
+    return NULL;
+  }
+
+  return TLS_SESSION_CACHE_OBJECT(tls_session_cache);
+}
+
+void Destruct(TlsSessionCacheObject* self) {
+  TlsSessionCache* const tsc = TLS_SESSION_CACHE(self);
+
+  if (tsc->sessions != NULL) {
+    for (size_t i = 0; i < tsc->size; ++i) {
+      TlsSessionRelease(&tsc->sessions[i]);
+    }
+
+    EEBUS_FREE(tsc->sessions);
+    tsc->sessions = NULL;
+  }
+
+  tsc->size = 0;
+
+  EebusMutexDelete(tsc->mutex);
+  tsc->mutex = NULL;
+}
+
+void TlsSessionRelease(TlsSession* session) {
+  StringDelete(session->ski);
+  session->ski = NULL;
+
+  EEBUS_FREE(session->session);
+  session->session      = NULL;
+  session->session_size = 0;
+}
+
+size_t FindIndex(const TlsSessionCache* self, const char* ski) {
+  for (size_t i = 0; i < self->size; ++i) {
+    if (strcmp(self->sessions[i].ski, ski) == 0) {
+      return i;
+    }
+  }
+
+  return SIZE_MAX;
+}
+
+size_t FindLeastRecentlyUsed(const TlsSessionCache* self) {
+  size_t lru = 0;
+  for (size_t i = 1; i < self->size; ++i) {
+    if (self->sessions[i].last_used < self->sessions[lru].last_used) {
+      lru = i;
+    }
+  }
+
+  return lru;
+}
+
+EebusError Store(TlsSessionCacheObject* self, const char* ski, const uint8_t* session, size_t session_size) {
+  TlsSessionCache* const tsc = TLS_SESSION_CACHE(self);
+
+  if ((ski == NULL) || (session == NULL) || (session_size == 0)) {
+    return kEebusErrorInputArgument;
+  }
+
+  uint8_t* const session_copy = (uint8_t*)EEBUS_MALLOC(session_size);
+  if (session_copy == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  memcpy(session_copy, session, session_size);
+
+  EEBUS_MUTEX_LOCK(tsc->mutex);
+
+  size_t i = FindIndex(tsc, ski);
+  if (i != SIZE_MAX) {
+    EEBUS_FREE(tsc->sessions[i].session);
+  } else {
+    char* const ski_copy = StringCopy(ski);
+    if (ski_copy == NULL) {
+      EEBUS_MUTEX_UNLOCK(tsc->mutex);
+      EEBUS_FREE(session_copy);
+      return kEebusErrorMemoryAllocate;
+    }
+
+    if (tsc->size < tsc->max_num) {
+      i = tsc->size++;
+    } else {
+      i = FindLeastRecentlyUsed(tsc);
+      TlsSessionRelease(&tsc->sessions[i]);
+    }
+
+    tsc->sessions[i].ski = ski_copy;
+  }
+
+  tsc->sessions[i].session      = session_copy;
+  tsc->sessions[i].session_size = session_size;
+  tsc->sessions[i].last_used    = ++tsc->use_cnt;
+
+  EEBUS_MUTEX_UNLOCK(tsc->mutex);
+  return kEebusErrorOk;
+}
+
+size_t Load(TlsSessionCacheObject* self, const char* ski, uint8_t* buf, size_t buf_size) {
+  TlsSessionCache* const tsc = TLS_SESSION_CACHE(self);
+
+  if (ski == NULL) {
+    return 0;
+  }
+
+  EEBUS_MUTEX_LOCK(tsc->mutex);
+
+  size_t session_size = 0;
+
+  const size_t i = FindIndex(tsc, ski);
+  if (i != SIZE_MAX) {
+    session_size = tsc->sessions[i].session_size;
+    if ((buf != NULL) && (buf_size >= session_size)) {
+      memcpy(buf, tsc->sessions[i].session, session_size);
+      tsc->sessions[i].last_used = ++tsc->use_cnt;
+    }
+  }
+
+  EEBUS_MUTEX_UNLOCK(tsc->mutex);
+  return session_size;
+}
+
+void Remove(TlsSessionCacheObject* self, const char* ski) {
+  TlsSessionCache* const tsc = TLS_SESSION_CACHE(self);
+
+  if (ski == NULL) {
+    return;
+  }
+
+  EEBUS_MUTEX_LOCK(tsc->mutex);
+
+  const size_t i = FindIndex(tsc, ski);
+  if (i != SIZE_MAX) {
+    TlsSessionRelease(&tsc->sessions[i]);
+    tsc->sessions[i] = tsc->sessions[--tsc->size];
+  }
+
+  EEBUS_MUTEX_UNLOCK(tsc->mutex);
+}
+
+size_t GetSize(const TlsSessionCacheObject* self) {
+  TlsSessionCache* const tsc = TLS_SESSION_CACHE(self);
+
+  EEBUS_MUTEX_LOCK(tsc->mutex);
+  const size_t size = tsc->size;
+  EEBUS_MUTEX_UNLOCK(tsc->mutex);
+
+  return size;
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Tls Session Cache implementation declarations
+ */
+
+#ifndef SRC_SHIP_WEBSOCKET_TLS_SESSION_CACHE_H_
+#define SRC_SHIP_WEBSOCKET_TLS_SESSION_CACHE_H_
+
+#include <stddef.h>
+
+#include "src/common/eebus_malloc.h"
+#include "src/ship/api/tls_session_cache_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/** Default number of remote devices to keep the TLS sessions for */
+#define TLS_SESSION_CACHE_MAX_NUM_DEFAULT 8
+
+/**
+ * @brief Create the TLS session cache
+ * @param max_num Maximum number of the sessions kept
+ * @return Tls session cache object on success, NULL otherwise
+ */
+TlsSessionCacheObject* TlsSessionCacheCreate(size_t max_num);
+
+static inline void TlsSessionCacheDelete(TlsSessionCacheObject* tls_session_cache) {
+  if (tls_session_cache != NULL) {
+    TLS_SESSION_CACHE_DESTRUCT(tls_session_cache);
+    EEBUS_FREE(tls_session_cache);
+  }
+}
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_SHIP_WEBSOCKET_TLS_SESSION_CACHE_H_
@@ -41,6 +41,10 @@
 #include "src/ship/websocket/websocket_debug.h"
 
 static const size_t kWriteQueueSize = 25;
+/** Time to wait for the write queue to be drained, before the outgoing message is dropped */
+static const uint32_t kWriteQueueTimeout = 1000;
+/** Number of the higher priority frames written before the waiting lower priority frame gets its turn */
+static const uint32_t kWriteStarvationLimit = 8;
 
 typedef struct WriteMessage WriteMessage;
 
@@ -49,7 +53,18 @@ struct WriteMessage {
   size_t data_size;
 };
 
+typedef struct ReadMessage ReadMessage;
+
+struct ReadMessage {
+  uint8_t* data;
+  size_t data_size;
+};
+
 static void WebsocketWrQueueMsgRelease(void* msg);
+static void WebsocketRxBacklogMsgDelete(void* msg);
+static void WebsocketReceiveMessage(Websocket* self, const uint8_t* data, size_t data_size);
+static bool WebsocketWrQueuesAreEmpty(const Websocket* self);
+static EebusQueueObject* WebsocketSelectWrQueue(Websocket* self);
 
 EebusError WebsocketConstruct(Websocket* self, WebsocketCallback cb, void* ctx) {
   self->callback = cb;
@@ -58,7 +73,11 @@ EebusError WebsocketConstruct(Websocket* self, WebsocketCallback cb, void* ctx)
   self->is_closed   = false;
   self->close_error = 0;
 
-  self->wr_queue = NULL;
+  for (size_t i = 0; i < kMessagePriorityNum; ++i) {
+    self->wr_queues[i]    = NULL;
+    self->wr_skip_cnts[i] = 0;
+  }
+
   self->wr_mutex = NULL;
 
   memset(&self->sul_stagger, 0, sizeof(self->sul_stagger));
@@ -70,12 +89,27 @@ EebusError WebsocketConstruct(Websocket* self, WebsocketCallback cb, void* ctx)
   self->buf_tmp      = NULL;
   self->buf_tmp_size = 0;
 
-  self->wr_queue = EebusQueueCreate(kWriteQueueSize, sizeof(WriteMessage), WebsocketWrQueueMsgRelease);
-  if (self->wr_queue == NULL) {
-    WEBSOCKET_DEBUG_PRINTF("%s(), initialising write queue failed\n", __func__);
+  self->is_rx_throttled      = false;
+  self->wr_queue_depth       = 0;
+  self->wr_queue_depth_max   = 0;
+  self->wr_drop_cnt          = 0;
+  self->rx_backlog_depth_max = 0;
+  self->rx_throttle_cnt      = 0;
+
+  self->rx_backlog = VectorCreateWithDeallocator(WebsocketRxBacklogMsgDelete);
+  if (self->rx_backlog == NULL) {
+    WEBSOCKET_DEBUG_PRINTF("%s(), creating receive backlog failed\n", __func__);
     return kEebusErrorMemory;
   }
 
+  for (size_t i = 0; i < kMessagePriorityNum; ++i) {
+    self->wr_queues[i] = EebusQueueCreate(kWriteQueueSize, sizeof(WriteMessage), WebsocketWrQueueMsgRelease);
+    if (self->wr_queues[i] == NULL) {
+      WEBSOCKET_DEBUG_PRINTF("%s(), initialising write queue failed\n", __func__);
+      return kEebusErrorMemory;
+    }
+  }
+
   self->wr_mutex = EebusMutexCreate();
   if (self->wr_mutex == NULL) {
     WEBSOCKET_DEBUG_PRINTF("%s(), creating write mutex failed\n", __func__);
@@ -94,6 +128,14 @@ void WebsocketWrQueueMsgRelease(void* msg) {
   }
 }
 
+void WebsocketRxBacklogMsgDelete(void* msg) {
+  ReadMessage* const rd_msg = (ReadMessage*)msg;
+  if (rd_msg != NULL) {
+    EEBUS_FREE(rd_msg->data);
+    EEBUS_FREE(rd_msg);
+  }
+}
+
 void WebsocketDestruct(WebsocketObject* self) {
   Websocket* const ws = WEBSOCKET(self);
 
@@ -102,8 +144,16 @@ void WebsocketDestruct(WebsocketObject* self) {
   EebusMutexDelete(ws->wr_mutex);
   ws->wr_mutex = NULL;
 
-  EebusQueueDelete(ws->wr_queue);
-  ws->wr_queue = NULL;
+  for (size_t i = 0; i < kMessagePriorityNum; ++i) {
+    EebusQueueDelete(ws->wr_queues[i]);
+    ws->wr_queues[i] = NULL;
+  }
+
+  if (ws->rx_backlog != NULL) {
+    VectorDestruct(ws->rx_backlog);
+    EEBUS_FREE(ws->rx_backlog);
+    ws->rx_backlog = NULL;
+  }
 
   if (ws->lws_ctx != NULL) {
     lws_context_destroy(ws->lws_ctx);
@@ -116,17 +166,15 @@ void WebsocketDestruct(WebsocketObject* self) {
   }
 }
 
-void WebsocketUserCallback(const Websocket* self, WebsocketCallbackType type, const void* in, size_t size) {
-  if (self->callback != NULL) {
-    self->callback(type, in, size, self->context);
+EebusError WebsocketUserCallback(const Websocket* self, WebsocketCallbackType type, const void* in, size_t size) {
+  if (self->callback == NULL) {
+    return kEebusErrorOk;
   }
-}
 
-int32_t WebsocketTryWrite(Websocket* self, const uint8_t* msg, size_t msg_size) {
-  if (self->is_closed) {
-    return 0;
-  }
+  return self->callback(type, in, size, self->context);
+}
 
+int32_t WebsocketTryWrite(Websocket* self, const uint8_t* msg, size_t msg_size, MessagePriority priority) {
   const size_t data_size = msg_size + LWS_PRE;
   WriteMessage wr_msg    = {.data = (uint8_t*)EEBUS_MALLOC(data_size), .data_size = data_size};
   if (wr_msg.data == NULL) {
@@ -136,9 +184,24 @@ int32_t WebsocketTryWrite(Websocket* self, const uint8_t* msg, size_t msg_size)
   memset(wr_msg.data, 0, LWS_PRE);
   memcpy(&wr_msg.data[LWS_PRE], msg, msg_size);
 
-  const EebusError ret = EEBUS_QUEUE_SEND(self->wr_queue, &wr_msg, 0);
+  // Account the message before queueing it, as the service thread may write it out right away
+  EEBUS_MUTEX_LOCK(self->wr_mutex);
+  if (++self->wr_queue_depth > self->wr_queue_depth_max) {
+    self->wr_queue_depth_max = self->wr_queue_depth;
+  }
+  EEBUS_MUTEX_UNLOCK(self->wr_mutex);
+
+  // The queue is drained by the service thread, so wait a bit for the room instead of dropping a burst.
+  // The mutex is not held here, not to block the service thread on closing
+  const EebusError ret = EEBUS_QUEUE_SEND(self->wr_queues[priority], &wr_msg, kWriteQueueTimeout);
+
   if (ret != kEebusErrorOk) {
-    WEBSOCKET_DEBUG_PRINTF("%s(), error sending message to queue\n", __func__);
+    EEBUS_MUTEX_LOCK(self->wr_mutex);
+    --self->wr_queue_depth;
+    ++self->wr_drop_cnt;
+    EEBUS_MUTEX_UNLOCK(self->wr_mutex);
+
+    WEBSOCKET_DEBUG_PRINTF("%s(), write queue full, %u messages dropped\n", __func__, self->wr_drop_cnt);
     EEBUS_FREE(wr_msg.data);
     wr_msg.data = NULL;
     return 0;
@@ -147,14 +210,22 @@ int32_t WebsocketTryWrite(Websocket* self, const uint8_t* msg, size_t msg_size)
   return (int32_t)msg_size;
 }
 
-int32_t WebsocketWrite(WebsocketObject* self, const uint8_t* msg, size_t msg_size) {
+int32_t WebsocketWrite(WebsocketObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority) {
   Websocket* const ws = WEBSOCKET(self);
 
+  if ((uint32_t)priority >= kMessagePriorityNum) {
+    priority = kMessagePriorityData;
+  }
+
   EEBUS_MUTEX_LOCK(ws->wr_mutex);
-  const int32_t ret = WebsocketTryWrite(ws, msg, msg_size);
+  const bool is_closed = ws->is_closed;
   EEBUS_MUTEX_UNLOCK(ws->wr_mutex);
 
-  return ret;
+  if (is_closed) {
+    return 0;
+  }
+
+  return WebsocketTryWrite(ws, msg, msg_size, priority);
 }
 
 void WebsocketClose(WebsocketObject* self, int32_t close_code, const char* reason) {
@@ -178,17 +249,59 @@ int32_t WebsocketGetCloseError(const WebsocketObject* self) {
 void WebsocketScheduleWrite(WebsocketObject* self) {
   Websocket* const ws = WEBSOCKET(self);
 
-  if (!EEBUS_QUEUE_IS_EMPTY(ws->wr_queue)) {
+  if (!WebsocketWrQueuesAreEmpty(ws)) {
     lws_callback_on_writable(ws->wsi);
   }
 }
 
+bool WebsocketWrQueuesAreEmpty(const Websocket* self) {
+  for (size_t i = 0; i < kMessagePriorityNum; ++i) {
+    if (!EEBUS_QUEUE_IS_EMPTY(self->wr_queues[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+EebusQueueObject* WebsocketSelectWrQueue(Websocket* self) {
+  size_t selected = kMessagePriorityNum;
+
+  // A lower priority class that has waited long enough goes first, not to be starved by a steady higher priority flow
+  for (size_t i = kMessagePriorityNum; i-- > 0;) {
+    if (!EEBUS_QUEUE_IS_EMPTY(self->wr_queues[i]) && (self->wr_skip_cnts[i] >= kWriteStarvationLimit)) {
+      selected = i;
+      break;
+    }
+  }
+
+  for (size_t i = 0; (i < kMessagePriorityNum) && (selected == kMessagePriorityNum); ++i) {
+    if (!EEBUS_QUEUE_IS_EMPTY(self->wr_queues[i])) {
+      selected = i;
+    }
+  }
+
+  if (selected == kMessagePriorityNum) {
+    return NULL;
+  }
+
+  for (size_t i = selected + 1; i < kMessagePriorityNum; ++i) {
+    if (!EEBUS_QUEUE_IS_EMPTY(self->wr_queues[i])) {
+      ++self->wr_skip_cnts[i];
+    }
+  }
+
+  self->wr_skip_cnts[selected] = 0;
+  return self->wr_queues[selected];
+}
+
 void WebsocketStaggerCallback(lws_sorted_usec_list_t* sul) {
   Websocket* const ws = lws_container_of(sul, Websocket, sul_stagger);
 
   if (ws != NULL) {
     if (!WEBSOCKET_IS_CLOSED(WEBSOCKET_OBJECT(ws))) {
       WEBSOCKET_SCHEDULE_WRITE(WEBSOCKET_OBJECT(ws));
+      WebsocketRetryReceive(WEBSOCKET_OBJECT(ws));
     }
   }
 
@@ -202,23 +315,36 @@ int WebsocketOnWritable(WebsocketObject* self) {
 
   WriteMessage wr_msg = {0};
 
-  const EebusError ret = EEBUS_QUEUE_RECEIVE(ws->wr_queue, &wr_msg, 0);
+  EebusQueueObject* const wr_queue = WebsocketSelectWrQueue(ws);
+  if (wr_queue == NULL) {
+    return 0;
+  }
+
+  const EebusError ret = EEBUS_QUEUE_RECEIVE(wr_queue, &wr_msg, 0);
   if (ret != kEebusErrorOk) {
     WEBSOCKET_DEBUG_PRINTF("%s(), error receiving the message from queue\n", __func__);
     return 0;
   }
 
+  EEBUS_MUTEX_LOCK(ws->wr_mutex);
+  --ws->wr_queue_depth;
+  EEBUS_MUTEX_UNLOCK(ws->wr_mutex);
+
   const size_t sz = wr_msg.data_size - LWS_PRE;
 
   WEBSOCKET_DEBUG_HEXDUMP(&wr_msg.data[LWS_PRE], sz);
   const int n = lws_write(ws->wsi, &wr_msg.data[LWS_PRE], sz, LWS_WRITE_BINARY);
 
-  EEBUS_FREE(wr_msg.data);
   if (n < sz) {
+    EEBUS_FREE(wr_msg.data);
     WEBSOCKET_DEBUG_PRINTF("sending message failed: %d < %d\n", n, sz);
     return -1;
   }
 
+  // Pass the written message, so that the user is able to tell which one has been written out
+  WebsocketUserCallback(ws, kWebsocketCallbackTypeWriteDone, &wr_msg.data[LWS_PRE], sz);
+  EEBUS_FREE(wr_msg.data);
+
   lws_callback_on_writable(ws->wsi);
   return 0;
 }
@@ -263,10 +389,10 @@ int WebsocketOnReceive(WebsocketObject* self, void* in, size_t len) {
   if (lws_is_final_fragment(ws->wsi) && !lws_remaining_packet_payload(ws->wsi)) {
     if (ws->buf_tmp != NULL) {
       BufTmpAppend(ws, (const uint8_t*)in, len);
-      WebsocketUserCallback(ws, kWebsocketCallbackTypeRead, ws->buf_tmp, ws->buf_tmp_size);
+      WebsocketReceiveMessage(ws, ws->buf_tmp, ws->buf_tmp_size);
       BufTmpRelease(ws);
     } else {
-      WebsocketUserCallback(ws, kWebsocketCallbackTypeRead, in, len);
+      WebsocketReceiveMessage(ws, (const uint8_t*)in, len);
     }
   } else {
     BufTmpAppend(ws, (const uint8_t*)in, len);
@@ -274,6 +400,61 @@ int WebsocketOnReceive(WebsocketObject* self, void* in, size_t len) {
   return 0;
 }
 
+void WebsocketReceiveMessage(Websocket* self, const uint8_t* data, size_t data_size) {
+  // Keep the order, so the messages received while throttled are queued behind the backlog
+  if ((VectorGetSize(self->rx_backlog) == 0)
+      && (WebsocketUserCallback(self, kWebsocketCallbackTypeRead, data, data_size) != kEebusErrorCommunicationBusy)) {
+    return;
+  }
+
+  ReadMessage* const rd_msg = (ReadMessage*)EEBUS_MALLOC(sizeof(ReadMessage));
+  if (rd_msg == NULL) {
+    return;
+  }
+
+  rd_msg->data      = (uint8_t*)EEBUS_MALLOC(data_size);
+  rd_msg->data_size = data_size;
+  if (rd_msg->data == NULL) {
+    EEBUS_FREE(rd_msg);
+    return;
+  }
+
+  memcpy(rd_msg->data, data, data_size);
+  VectorPushBack(self->rx_backlog, rd_msg);
+
+  if (VectorGetSize(self->rx_backlog) > self->rx_backlog_depth_max) {
+    self->rx_backlog_depth_max = VectorGetSize(self->rx_backlog);
+  }
+
+  if (!self->is_rx_throttled) {
+    // Stop reading from the socket until the user catches up, the TCP window then throttles the remote
+    lws_rx_flow_control(self->wsi, 0);
+    self->is_rx_throttled = true;
+    ++self->rx_throttle_cnt;
+    WEBSOCKET_DEBUG_PRINTF("%s(), receiving throttled (%u times)\n", __func__, self->rx_throttle_cnt);
+  }
+}
+
+void WebsocketRetryReceive(WebsocketObject* self) {
+  Websocket* const ws = WEBSOCKET(self);
+
+  while (VectorGetSize(ws->rx_backlog) > 0) {
+    ReadMessage* const rd_msg = (ReadMessage*)VectorGetElement(ws->rx_backlog, 0);
+    if (WebsocketUserCallback(ws, kWebsocketCallbackTypeRead, rd_msg->data, rd_msg->data_size)
+        == kEebusErrorCommunicationBusy) {
+      return;
+    }
+
+    VectorRemove(ws->rx_backlog, rd_msg);
+    WebsocketRxBacklogMsgDelete(rd_msg);
+  }
+
+  if (ws->is_rx_throttled && (ws->wsi != NULL)) {
+    lws_rx_flow_control(ws->wsi, 1);
+    ws->is_rx_throttled = false;
+  }
+}
+
 int WebsocketOnClose(WebsocketObject* self) {
   Websocket* const ws = (Websocket*)WEBSOCKET(self);
   WEBSOCKET_DEBUG_PRINTF("%s(), websocket closed\n", __func__);
@@ -18,8 +18,11 @@
  * @brief Websocket Uri implementation
  */
 
+#include <stdlib.h>
+
 #include "src/common/eebus_thread/eebus_thread.h"
 #include "src/common/string_util.h"
+#include "src/ship/api/tls_session_cache_interface.h"
 #include "src/ship/websocket/websocket.h"
 #include "src/ship/websocket/websocket_debug.h"
 #include "src/ship/websocket/websocket_internal.h"
@@ -38,7 +41,9 @@ struct WebsocketClient {
   const char* path;
   int port;
   const TlsCertificateObject* tls_cert;
+  TlsSessionCacheObject* tls_session_cache;
   const char* remote_ski;
+  bool is_remote_ski_verified;
   struct lws_protocols protocols[2];
   struct lws_client_connect_info* lws_connect_info;
 };
@@ -60,6 +65,7 @@ static EebusError WebsocketClientConstruct(
     WebsocketClient* self,
     const char* uri,
     const TlsCertificateObject* tls_cert,
+    TlsSessionCacheObject* tls_session_cache,
     const char* remote_ski,
     WebsocketCallback cb,
     void* ctx
@@ -67,6 +73,12 @@ static EebusError WebsocketClientConstruct(
 static void* WebsocketClientLoop(void* parameters);
 static struct lws_client_connect_info* WebsocketClientConnectInfoCreate(WebsocketClient* self);
 static struct lws_context* WebsocketClientLwsContextCreate(WebsocketClient* self);
+#if defined(LWS_WITH_TLS_SESSIONS)
+static int WebsocketClientOnTlsSessionLoad(struct lws_context* lws_ctx, struct lws_tls_session_dump* info);
+static int WebsocketClientOnTlsSessionSave(struct lws_context* lws_ctx, struct lws_tls_session_dump* info);
+#endif  // LWS_WITH_TLS_SESSIONS
+static void WebsocketClientTlsSessionLoad(WebsocketClient* self);
+static void WebsocketClientTlsSessionSave(WebsocketClient* self);
 static EebusError WebsocketClientParse(WebsocketClient* self, char* uri);
 static EebusError WebsocketClientTryStart(WebsocketClient* self);
 static int WebsocketClientOnClientEstablished(WebsocketClient* self);
@@ -79,6 +91,7 @@ EebusError WebsocketClientConstruct(
     WebsocketClient* self,
     const char* uri,
     const TlsCertificateObject* tls_cert,
+    TlsSessionCacheObject* tls_session_cache,
     const char* remote_ski,
     WebsocketCallback cb,
     void* ctx
@@ -94,12 +107,14 @@ EebusError WebsocketClientConstruct(
   self->cancel = false;
   self->thread = NULL;
 
-  self->uri        = StringCopy(uri);
-  self->address    = NULL;
-  self->path       = NULL;
-  self->port       = 0;
-  self->tls_cert   = tls_cert;
-  self->remote_ski = StringCopy(remote_ski);
+  self->uri                    = StringCopy(uri);
+  self->address                = NULL;
+  self->path                   = NULL;
+  self->port                   = 0;
+  self->tls_cert               = tls_cert;
+  self->tls_session_cache      = tls_session_cache;
+  self->remote_ski             = StringCopy(remote_ski);
+  self->is_remote_ski_verified = false;
 
   self->protocols[0]
       = (struct lws_protocols){SHIP_WEBSOCKET_SUB_PROTOCOL, WebsocketClientServiceCallback, 0, 16 * 1024, 0, self, 0};
@@ -114,6 +129,8 @@ void* WebsocketClientLoop(void* parameters) {
   Websocket* const ws         = (Websocket*)parameters;
   WebsocketClient* const self = WEBSOCKET_CLIENT(ws);
 
+  WebsocketClientTlsSessionLoad(self);
+
   ws->wsi = lws_client_connect_via_info(self->lws_connect_info);
 
   if (ws->wsi == NULL) {
@@ -193,6 +210,85 @@ struct lws_context* WebsocketClientLwsContextCreate(WebsocketClient* self) {
   return lws_create_context(&lws_ctx_creation_info);
 }
 
+#if defined(LWS_WITH_TLS_SESSIONS)
+int WebsocketClientOnTlsSessionLoad(struct lws_context* lws_ctx, struct lws_tls_session_dump* info) {
+  WebsocketClient* const self = (WebsocketClient*)info->opaque;
+
+  const size_t session_size = TLS_SESSION_CACHE_LOAD(self->tls_session_cache, self->remote_ski, NULL, 0);
+  if (session_size == 0) {
+    return 1;
+  }
+
+  // lws releases the blob with free() once the session is deserialised
+  uint8_t* const session = (uint8_t*)malloc(session_size);
+  if (session == NULL) {
+    return 1;
+  }
+
+  if (TLS_SESSION_CACHE_LOAD(self->tls_session_cache, self->remote_ski, session, session_size) != session_size) {
+    // Replaced in between by another connection to the same remote device
+    free(session);
+    return 1;
+  }
+
+  info->blob     = session;
+  info->blob_len = session_size;
+  return 0;
+}
+
+int WebsocketClientOnTlsSessionSave(struct lws_context* lws_ctx, struct lws_tls_session_dump* info) {
+  WebsocketClient* const self = (WebsocketClient*)info->opaque;
+
+  const EebusError err = TLS_SESSION_CACHE_STORE(
+      self->tls_session_cache,
+      self->remote_ski,
+      (const uint8_t*)info->blob,
+      info->blob_len
+  );
+
+  return (err == kEebusErrorOk) ? 0 : 1;
+}
+#endif  // LWS_WITH_TLS_SESSIONS
+
+void WebsocketClientTlsSessionLoad(WebsocketClient* self) {
+#if defined(LWS_WITH_TLS_SESSIONS)
+  if ((self->tls_session_cache == NULL) || (self->remote_ski == NULL)) {
+    return;
+  }
+
+  // The session is cached per remote SKI, while lws looks it up by host and port.
+  // Import it under the address the remote device is reachable at now
+  struct lws_vhost* const vhost = lws_get_vhost_by_name(WEBSOCKET(self)->lws_ctx, "default");
+  if (vhost == NULL) {
+    return;
+  }
+
+  if (lws_tls_session_dump_load(vhost, self->address, (uint16_t)self->port, WebsocketClientOnTlsSessionLoad, self)
+      == 0) {
+    WEBSOCKET_DEBUG_PRINTF("%s(), resuming the TLS session with %s\n", __func__, self->remote_ski);
+  }
+#endif  // LWS_WITH_TLS_SESSIONS
+}
+
+void WebsocketClientTlsSessionSave(WebsocketClient* self) {
+#if defined(LWS_WITH_TLS_SESSIONS)
+  Websocket* const ws = WEBSOCKET(self);
+
+  // Only the sessions with the remote SKI verified are worth resuming
+  if ((self->tls_session_cache == NULL) || (!self->is_remote_ski_verified) || (ws->wsi == NULL)) {
+    return;
+  }
+
+  lws_tls_session_dump_save(
+      lws_get_vhost(ws->wsi),
+      self->address,
+      (uint16_t)self->port,
+      WebsocketClientOnTlsSessionSave,
+      self
+  );
+#endif  // LWS_WITH_TLS_SESSIONS
+}
+
 EebusError WebsocketClientParse(WebsocketClient* self, char* uri) {
   const char* path     = NULL;
   const char* protocol = NULL;
@@ -249,6 +345,7 @@ EebusError WebsocketClientTryStart(WebsocketClient* self) {
 WebsocketObject* WebsocketClientOpen(
     const char* uri,
     const TlsCertificateObject* tls_cert,
+    TlsSessionCacheObject* tls_session_cache,
     const char* remote_ski,
     WebsocketCallback cb,
     void* ctx
@@ -258,7 +355,7 @@ WebsocketObject* WebsocketClientOpen(
     return NULL;
   }
 
-  EebusError ret = WebsocketClientConstruct(ws, uri, tls_cert, remote_ski, cb, ctx);
+  EebusError ret = WebsocketClientConstruct(ws, uri, tls_cert, tls_session_cache, remote_ski, cb, ctx);
   if (ret != kEebusErrorOk) {
     WebsocketDelete(WEBSOCKET_OBJECT(ws));
     return NULL;
@@ -315,6 +412,10 @@ int WebsocketClientOnClientEstablished(WebsocketClient* self) {
 
   int ret = -1;
   if (strcmp(ski, self->remote_ski) == 0) {
+    // A resumed session carries the certificate of the peer it was established with,
+    // so the SKI check above holds for the abbreviated handshake as well
+    self->is_remote_ski_verified = true;
+    WebsocketClientTlsSessionSave(self);
     lws_sul_schedule(ws->lws_ctx, 0, &ws->sul_stagger, WebsocketStaggerCallback, kWebsocketStaggerDelay);
     lws_callback_on_writable(ws->wsi);
     ret = 0;
@@ -337,6 +438,8 @@ int WebsocketClientOnClientConnectionError(WebsocketClient* self, const char* in
 int WebsocketClientOnWsiDestroy(WebsocketClient* self) {
   Websocket* const ws = WEBSOCKET(self);
   WEBSOCKET_DEBUG_PRINTF("Destroying the wsi\n");
+  // TLS 1.3 session tickets are only received after the handshake, store the latest one
+  WebsocketClientTlsSessionSave(self);
   WebsocketUserCallback(ws, kWebsocketCallbackTypeClose, "", 0);
   return 0;
 }
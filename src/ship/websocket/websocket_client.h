@@ -24,6 +24,7 @@
 #include <stddef.h>
 
 #include "src/ship/api/tls_certificate_interface.h"
+#include "src/ship/api/tls_session_cache_interface.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ extern "C" {
 WebsocketObject* WebsocketClientOpen(
     const char* uri,
     const TlsCertificateObject* tls_cert,
+    TlsSessionCacheObject* tls_session_cache,
     const char* remote_ski,
     WebsocketCallback cb,
     void* ctx
@@ -21,6 +21,7 @@
 #include "src/common/eebus_malloc.h"
 #include "src/common/string_util.h"
 #include "src/ship/api/tls_certificate_interface.h"
+#include "src/ship/api/tls_session_cache_interface.h"
 #include "src/ship/api/websocket_creator_interface.h"
 #include "src/ship/websocket/websocket_client.h"
 
@@ -32,6 +33,7 @@ struct WebsocketClientCreator {
 
   const char* uri;
   TlsCertificateObject* tls_cert;
+  TlsSessionCacheObject* tls_session_cache;
   const char* remote_ski;
 };
 
@@ -49,6 +51,7 @@ static void WebsocketClientCreatorConstruct(
     WebsocketClientCreator* self,
     const char* uri,
     TlsCertificateObject* tls_cert,
+    TlsSessionCacheObject* tls_session_cache,
     const char* remote_ski
 );
 
@@ -56,22 +59,28 @@ void WebsocketClientCreatorConstruct(
     WebsocketClientCreator* self,
     const char* uri,
     TlsCertificateObject* tls_cert,
+    TlsSessionCacheObject* tls_session_cache,
     const char* remote_ski
 ) {
   // Override "virtual functions table"
   WEBSOCKET_CREATOR_INTERFACE(self) = &websocket_creator_methods;
 
-  self->uri        = StringCopy(uri);
-  self->tls_cert   = tls_cert;
-  self->remote_ski = StringCopy(remote_ski);
+  self->uri               = StringCopy(uri);
+  self->tls_cert          = tls_cert;
+  self->tls_session_cache = tls_session_cache;
+  self->remote_ski        = StringCopy(remote_ski);
 }
 
-WebsocketCreatorObject*
-WebsocketClientCreatorCreate(const char* uri, TlsCertificateObject* tls_cert, const char* remote_ski) {
+WebsocketCreatorObject* WebsocketClientCreatorCreate(
+    const char* uri,
+    TlsCertificateObject* tls_cert,
+    TlsSessionCacheObject* tls_session_cache,
+    const char* remote_ski
+) {
   WebsocketClientCreator* const websocket_creator
       = (WebsocketClientCreator*)EEBUS_MALLOC(sizeof(WebsocketClientCreator));
 
-  WebsocketClientCreatorConstruct(websocket_creator, uri, tls_cert, remote_ski);
+  WebsocketClientCreatorConstruct(websocket_creator, uri, tls_cert, tls_session_cache, remote_ski);
 
   return WEBSOCKET_CREATOR_OBJECT(websocket_creator);
 }
@@ -87,5 +96,5 @@ void Destruct(WebsocketCreatorObject* self) {
 
 WebsocketObject* Create(WebsocketCreatorObject* self, WebsocketCallback cb, void* ctx) {
   WebsocketClientCreator* const wsc = WEBSOCKET_CLIENT_CREATOR(self);
-  return WebsocketClientOpen(wsc->uri, wsc->tls_cert, wsc->remote_ski, cb, ctx);
+  return WebsocketClientOpen(wsc->uri, wsc->tls_cert, wsc->tls_session_cache, wsc->remote_ski, cb, ctx);
 }
@@ -25,6 +25,7 @@
 
 #include "src/common/eebus_malloc.h"
 #include "src/ship/api/tls_certificate_interface.h"
+#include "src/ship/api/tls_session_cache_interface.h"
 #include "src/ship/api/websocket_creator_interface.h"
 #include "src/ship/websocket/websocket_creator.h"
 
@@ -32,8 +33,12 @@
 extern "C" {
 #endif  // __cplusplus
 
-WebsocketCreatorObject*
-WebsocketClientCreatorCreate(const char* uri, const TlsCertificateObject* tls_cert, const char* remote_ski);
+WebsocketCreatorObject* WebsocketClientCreatorCreate(
+    const char* uri,
+    const TlsCertificateObject* tls_cert,
+    TlsSessionCacheObject* tls_session_cache,
+    const char* remote_ski
+);
 
 #ifdef __cplusplus
 }
@@ -26,6 +26,7 @@
 #include "src/common/api/eebus_queue_interface.h"
 #include "src/common/eebus_malloc.h"
 #include "src/common/eebus_mutex/eebus_mutex.h"
+#include "src/common/vector.h"
 #include "src/ship/api/tls_certificate_interface.h"
 #include "src/ship/api/websocket_interface.h"
 
@@ -56,9 +57,23 @@ struct Websocket {
   bool is_closed;
   int32_t close_error;
 
-  EebusQueueObject* wr_queue;
+  /** Write queue per priority class */
+  EebusQueueObject* wr_queues[kMessagePriorityNum];
+  /** Number of frames written while the class was waiting, used to prevent starvation */
+  uint32_t wr_skip_cnts[kMessagePriorityNum];
   EebusMutexObject* wr_mutex;
 
+  /** Read messages not accepted by the user yet, the receiving is throttled until they are */
+  Vector* rx_backlog;
+  bool is_rx_throttled;
+
+  // Flow control counters
+  size_t wr_queue_depth;
+  size_t wr_queue_depth_max;
+  uint32_t wr_drop_cnt;
+  size_t rx_backlog_depth_max;
+  uint32_t rx_throttle_cnt;
+
   uint8_t* buf_tmp;
   size_t buf_tmp_size;
   lws_sorted_usec_list_t sul_stagger;
@@ -69,13 +84,14 @@ struct Websocket {
 EebusError WebsocketConstruct(Websocket* self, WebsocketCallback cb, void* ctx);
 
 void WebsocketDestruct(WebsocketObject* self);
-int32_t WebsocketWrite(WebsocketObject* self, const uint8_t* msg, size_t msg_size);
+int32_t WebsocketWrite(WebsocketObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority);
 void WebsocketClose(WebsocketObject* self, int32_t close_code, const char* reason);
 bool WebsocketIsClosed(const WebsocketObject* self);
 int32_t WebsocketGetCloseError(const WebsocketObject* self);
 void WebsocketScheduleWrite(WebsocketObject* self);
 void WebsocketStaggerCallback(lws_sorted_usec_list_t* sul);
-void WebsocketUserCallback(const Websocket* self, WebsocketCallbackType type, const void* in, size_t size);
+EebusError WebsocketUserCallback(const Websocket* self, WebsocketCallbackType type, const void* in, size_t size);
+void WebsocketRetryReceive(WebsocketObject* self);
 
 int WebsocketOnWritable(WebsocketObject* self);
 int WebsocketOnReceive(WebsocketObject* self, void* in, size_t len);
@@ -55,6 +55,7 @@ struct BindingManagerInterface {
       BindingManagerObject* self, const BindingManagementDeleteCallType* data, DeviceRemoteObject* remote_device);
   void (*remove_device_bindings)(BindingManagerObject* self, DeviceRemoteObject* remote_device);
   void (*remove_entity_bindings)(BindingManagerObject* self, EntityRemoteObject* remote_entity);
+  void (*remove_feature_bindings)(BindingManagerObject* self, FeatureRemoteObject* remote_feature);
   bool (*has_binding)(
       const BindingManagerObject* self, const FeatureAddressType* local_addr, const FeatureAddressType* remote_addr);
   NodeManagementBindingDataType* (*create_binding_data)(
@@ -107,6 +108,12 @@ struct BindingManagerObject {
 #define BINDING_MANAGER_REMOVE_ENTITY_BINDINGS(obj, remote_entity) \
   (BINDING_MANAGER_INTERFACE(obj)->remove_entity_bindings(obj, remote_entity))
 
+/**
+ * @brief Binding Manager Remove Feature Bindings caller definition
+ */
+#define BINDING_MANAGER_REMOVE_FEATURE_BINDINGS(obj, remote_feature) \
+  (BINDING_MANAGER_INTERFACE(obj)->remove_feature_bindings(obj, remote_feature))
+
 /**
  * @brief Binding Manager Has Binding caller definition
  */
@@ -31,6 +31,7 @@
 #include "src/spine/api/entity_local_interface.h"
 #include "src/spine/api/feature_local_interface.h"
 #include "src/spine/api/heartbeat_manager_interface.h"
+#include "src/spine/api/remote_device_cache_interface.h"
 #include "src/spine/api/subscription_manager_interface.h"
 #include "src/spine/node_management/node_management.h"
 
@@ -38,6 +39,12 @@
 extern "C" {
 #endif  // __cplusplus
 
+/**
+ * @brief Called when a message is queued for the Device Local running in the external loop mode
+ * @param ctx Context passed on the external loop mode setup
+ */
+typedef void (*DeviceLocalWakeCallback)(void* ctx);
+
 /**
  * @brief Device Local Interface
  * (Device Local "virtual functions table" declaration)
@@ -60,6 +67,8 @@ struct DeviceLocalInterface {
 
   EebusError (*start)(DeviceLocalObject* self);
   void (*stop)(DeviceLocalObject* self);
+  void (*set_external_loop)(DeviceLocalObject* self, DeviceLocalWakeCallback wake_cb, void* ctx);
+  uint32_t (*step)(DeviceLocalObject* self, uint32_t elapsed_ms);
   DataReaderObject* (*setup_remote_device)(DeviceLocalObject* self, const char* ski, DataWriterObject* writer);
   void (*add_remote_device_for_ski)(DeviceLocalObject* self, const char* ski, DeviceRemoteObject* remote_device);
   EebusError (*request_remote_detailed_discovery_data)(
@@ -83,6 +92,8 @@ struct DeviceLocalInterface {
   NodeManagementObject* (*get_node_management)(const DeviceLocalObject* self);
   BindingManagerObject* (*get_binding_manager)(const DeviceLocalObject* self);
   SubscriptionManagerObject* (*get_subscription_manager)(const DeviceLocalObject* self);
+  void (*set_remote_device_cache)(DeviceLocalObject* self, RemoteDeviceCacheObject* remote_device_cache);
+  RemoteDeviceCacheObject* (*get_remote_device_cache)(const DeviceLocalObject* self);
   void (*notify_subscribers)(const DeviceLocalObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd);
   NodeManagementDetailedDiscoveryDeviceInformationType* (*create_information)(const DeviceLocalObject* self);
   void (*lock)(DeviceLocalObject* self);
@@ -116,6 +127,21 @@ struct DeviceLocalObject {
  */
 #define DEVICE_LOCAL_STOP(obj) (DEVICE_LOCAL_INTERFACE(obj)->stop(obj))
 
+/**
+ * @brief Device Local Set External Loop caller definition.
+ * Shall be called before start. Device Local creates neither thread nor tick timer then,
+ * the application drives it with DEVICE_LOCAL_STEP() from its own loop instead
+ */
+#define DEVICE_LOCAL_SET_EXTERNAL_LOOP(obj, wake_cb, ctx) \
+  (DEVICE_LOCAL_INTERFACE(obj)->set_external_loop(obj, wake_cb, ctx))
+
+/**
+ * @brief Device Local Step caller definition.
+ * Handles the queued messages and the elapsed ticks without blocking.
+ * Returns the time in ms until the next step is due
+ */
+#define DEVICE_LOCAL_STEP(obj, elapsed_ms) (DEVICE_LOCAL_INTERFACE(obj)->step(obj, elapsed_ms))
+
 /**
  * @brief Device Local Setup Remote Device caller definition
  */
@@ -211,6 +237,19 @@ struct DeviceLocalObject {
  */
 #define DEVICE_LOCAL_GET_SUBSCRIPTION_MANAGER(obj) (DEVICE_LOCAL_INTERFACE(obj)->get_subscription_manager(obj))
 
+/**
+ * @brief Device Local Set Remote Device Cache caller definition.
+ * The Device Local takes the ownership of the cache, the previously set one is deleted
+ */
+#define DEVICE_LOCAL_SET_REMOTE_DEVICE_CACHE(obj, remote_device_cache) \
+  (DEVICE_LOCAL_INTERFACE(obj)->set_remote_device_cache(obj, remote_device_cache))
+
+/**
+ * @brief Device Local Get Remote Device Cache caller definition.
+ * Returns NULL if remote device models are not cached
+ */
+#define DEVICE_LOCAL_GET_REMOTE_DEVICE_CACHE(obj) (DEVICE_LOCAL_INTERFACE(obj)->get_remote_device_cache(obj))
+
 /**
  * @brief Device Local Notify Subscribers caller definition
  */
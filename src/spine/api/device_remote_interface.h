@@ -31,10 +31,13 @@ extern "C" {
 #include "src/spine/api/device_interface.h"
 #include "src/spine/api/entity_remote_interface.h"
 #include "src/spine/api/feature_remote_interface.h"
+#include "src/spine/api/pending_requests_interface.h"
 #include "src/spine/api/sender_interface.h"
 #include "src/spine/model/network_management_types.h"
 #include "src/spine/model/node_management_types.h"
 
+typedef struct DeviceLocalObject DeviceLocalObject;
+
 /**
  * @brief Device Remote Interface
  * (Device Remote "virtual functions table" declaration)
@@ -56,6 +59,7 @@ struct DeviceRemoteInterface {
   DeviceInterface device_interface;
 
   const char* (*get_ski)(const DeviceRemoteObject* self);
+  DeviceLocalObject* (*get_local_device)(const DeviceRemoteObject* self);
   DataReaderObject* (*get_data_reader)(const DeviceRemoteObject* self);
   void (*add_entity)(DeviceRemoteObject* self, EntityRemoteObject* entity);
   EntityRemoteObject* (*release_entity)(
@@ -80,10 +84,13 @@ struct DeviceRemoteInterface {
   );
   EebusError (*handle_spine_messsage)(DeviceRemoteObject* self, MessageBuffer* msg);
   SenderObject* (*get_sender)(const DeviceRemoteObject* self);
+  PendingRequestsObject* (*get_pending_requests)(const DeviceRemoteObject* self);
   NodeManagementUseCaseDataType* (*use_cases_data_copy)(const DeviceRemoteObject* self);
   void (*update_device)(DeviceRemoteObject* self, const NetworkManagementDeviceDescriptionDataType* description);
   const Vector* (*add_entity_and_features)(
       DeviceRemoteObject* self, bool init, const NodeManagementDetailedDiscoveryDataType* data);
+  Vector* (*release_removed_entities)(
+      DeviceRemoteObject* self, bool init, const NodeManagementDetailedDiscoveryDataType* data);
   EebusError (*check_entity_information)(const DeviceRemoteObject* self, bool init,
       const NodeManagementDetailedDiscoveryEntityInformationType* entity_info);
 };
@@ -110,6 +117,11 @@ struct DeviceRemoteObject {
  */
 #define DEVICE_REMOTE_GET_SKI(obj) (DEVICE_REMOTE_INTERFACE(obj)->get_ski(obj))
 
+/**
+ * @brief Device Remote Get Local Device caller definition
+ */
+#define DEVICE_REMOTE_GET_LOCAL_DEVICE(obj) (DEVICE_REMOTE_INTERFACE(obj)->get_local_device(obj))
+
 /**
  * @brief Device Remote Get Data Reader caller definition
  */
@@ -159,6 +171,11 @@ struct DeviceRemoteObject {
  */
 #define DEVICE_REMOTE_GET_SENDER(obj) (DEVICE_REMOTE_INTERFACE(obj)->get_sender(obj))
 
+/**
+ * @brief Device Remote Get Pending Requests caller definition
+ */
+#define DEVICE_REMOTE_GET_PENDING_REQUESTS(obj) (DEVICE_REMOTE_INTERFACE(obj)->get_pending_requests(obj))
+
 /**
  * @brief Device Remote Use Cases Data Copy caller definition
  */
@@ -170,11 +187,23 @@ struct DeviceRemoteObject {
 #define DEVICE_REMOTE_UPDATE_DEVICE(obj, description) (DEVICE_REMOTE_INTERFACE(obj)->update_device(obj, description))
 
 /**
- * @brief Device Remote Add Entity And Features caller definition
+ * @brief Device Remote Add Entity And Features caller definition.
+ * Applies the detailed discovery data to the existing entities and features (the known features keep their data)
+ * and returns the newly added entities. With init set, data is considered to be the complete reply,
+ * otherwise the notify carrying the changes only
  */
 #define DEVICE_REMOTE_ADD_ENTITY_AND_FEATURES(obj, init, data) \
   (DEVICE_REMOTE_INTERFACE(obj)->add_entity_and_features(obj, init, data))
 
+/**
+ * @brief Device Remote Release Removed Entities caller definition.
+ * Detaches the entities removed according to the detailed discovery data and returns them,
+ * the caller is responsible for releasing the entities and the container.
+ * Shall be called prior to DEVICE_REMOTE_ADD_ENTITY_AND_FEATURES()
+ */
+#define DEVICE_REMOTE_RELEASE_REMOVED_ENTITIES(obj, init, data) \
+  (DEVICE_REMOTE_INTERFACE(obj)->release_removed_entities(obj, init, data))
+
 /**
  * @brief Device Remote Check Entity Information caller definition
  */
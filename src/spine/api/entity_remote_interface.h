@@ -54,6 +54,7 @@ struct EntityRemoteInterface {
   DeviceRemoteObject* (*get_device)(const EntityRemoteObject* self);
   void (*update_device_address)(EntityRemoteObject* self, const char* device_addr);
   void (*add_feature)(EntityRemoteObject* self, FeatureRemoteObject* feature);
+  void (*remove_feature)(EntityRemoteObject* self, FeatureRemoteObject* feature);
   void (*remove_all_features)(EntityRemoteObject* self);
   FeatureRemoteObject* (*get_feature_with_type_and_role)(
       const EntityRemoteObject* self, FeatureTypeType feature_type, RoleType role);
@@ -94,6 +95,12 @@ struct EntityRemoteObject {
  */
 #define ENTITY_REMOTE_ADD_FEATURE(obj, feature) (ENTITY_REMOTE_INTERFACE(obj)->add_feature(obj, feature))
 
+/**
+ * @brief Entity Remote Remove Feature caller definition.
+ * Removes the feature from the entity and releases it
+ */
+#define ENTITY_REMOTE_REMOVE_FEATURE(obj, feature) (ENTITY_REMOTE_INTERFACE(obj)->remove_feature(obj, feature))
+
 /**
  * @brief Entity Remote Remove All Features caller definition
  */
@@ -44,6 +44,7 @@ FeatureLink* FeatureLinkCreate(uint64_t id, FeatureLocalObject* server_feature,
 static inline void FeatureLinkDelete(FeatureLink* self) { EEBUS_FREE(self); };
 bool FeatureLinkRemoteDeviceMatch(const FeatureLink* self, const DeviceRemoteObject* remote_device);
 bool FeatureLinkRemoteEntityMatch(const FeatureLink* self, const EntityRemoteObject* remote_entity);
+bool FeatureLinkRemoteFeatureMatch(const FeatureLink* self, const FeatureRemoteObject* remote_feature);
 
 static inline const FeatureAddressType* FeatureLinkGetClientAddr(const FeatureLink* self) {
   return FEATURE_GET_ADDRESS(FEATURE_OBJECT(self->client_feature));
@@ -73,8 +73,8 @@ struct FeatureLocalInterface {
   EntityLocalObject* (*get_entity)(const FeatureLocalObject* self);
   const void* (*get_data)(const FeatureLocalObject* self, FunctionType function_type);
   void (*set_function_operations)(FeatureLocalObject* self, FunctionType type, bool read, bool write);
-  EebusError (*add_response_callback)(
-      FeatureLocalObject* self, MsgCounterType msg_counter_ref, ResponseMessageCallback cb, void* ctx);
+  EebusError (*add_response_callback)(FeatureLocalObject* self, const DeviceRemoteObject* remote_device,
+      MsgCounterType msg_counter_ref, ResponseMessageCallback cb, void* ctx);
   void (*add_result_callback)(FeatureLocalObject* self, ResponseMessageCallback cb, void* ctx);
   EebusError (*add_write_approval_callback)(FeatureLocalObject* self, WriteApprovalCallback cb, void* ctx);
   void (*approve_or_deny_write)(FeatureLocalObject* self, const Message* msg, const ErrorType* err);
@@ -92,6 +92,8 @@ struct FeatureLocalInterface {
       const FilterType* filter_partial, FeatureRemoteObject* dest_feature);
   EebusError (*request_remote_data_by_sender_address)(FeatureLocalObject* self, const CmdType* cmd,
       SenderObject* sender, const char* dest_ski, const FeatureAddressType* dest_addr, uint32_t max_delay);
+  EebusError (*add_pending_request)(
+      FeatureLocalObject* self, DeviceRemoteObject* remote_device, MsgCounterType msg_cnt, uint32_t max_delay);
   bool (*has_subscription_to_remote)(const FeatureLocalObject* self, const FeatureAddressType* remote_addr);
   EebusError (*subscribe_to_remote)(FeatureLocalObject* self, const FeatureAddressType* remote_addr);
   EebusError (*remove_remote_subscription)(FeatureLocalObject* self, const FeatureAddressType* remote_addr);
@@ -143,10 +145,12 @@ struct FeatureLocalObject {
   (FEATURE_LOCAL_INTERFACE(obj)->set_function_operations(obj, type, read, write))
 
 /**
- * @brief Feature Local Add Response Callback caller definition
+ * @brief Feature Local Add Response Callback caller definition.
+ * The message counters are maintained per remote device, so the callback is bound to
+ * the remote device the request has been sent to
  */
-#define FEATURE_LOCAL_ADD_RESPONSE_CALLBACK(obj, msg_counter_ref, cb, ctx) \
-  (FEATURE_LOCAL_INTERFACE(obj)->add_response_callback(obj, msg_counter_ref, cb, ctx))
+#define FEATURE_LOCAL_ADD_RESPONSE_CALLBACK(obj, remote_device, msg_counter_ref, cb, ctx) \
+  (FEATURE_LOCAL_INTERFACE(obj)->add_response_callback(obj, remote_device, msg_counter_ref, cb, ctx))
 
 /**
  * @brief Feature Local Add Result Callback caller definition
@@ -202,6 +206,13 @@ struct FeatureLocalObject {
   (FEATURE_LOCAL_INTERFACE(obj)->request_remote_data_by_sender_address(                                       \
       obj, cmd, sender, dest_ski, dest_addr, max_delay))
 
+/**
+ * @brief Feature Local Add Pending Request caller definition.
+ * Starts tracking the response deadline of a request sent to the remote device
+ */
+#define FEATURE_LOCAL_ADD_PENDING_REQUEST(obj, remote_device, msg_cnt, max_delay) \
+  (FEATURE_LOCAL_INTERFACE(obj)->add_pending_request(obj, remote_device, msg_cnt, max_delay))
+
 /**
  * @brief Feature Local Has Subscription To Remote caller definition
  */
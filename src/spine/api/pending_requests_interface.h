@@ -0,0 +1,134 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Pending Requests interface declarations
+ */
+
+#ifndef SRC_SPINE_API_PENDING_REQUESTS_INTERFACE_H_
+#define SRC_SPINE_API_PENDING_REQUESTS_INTERFACE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "src/common/eebus_errors.h"
+#include "src/spine/model/command_frame_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+typedef struct DeviceRemoteObject DeviceRemoteObject;
+
+/**
+ * @brief Called when a pending request expires without a reply or result
+ * @param remote_device Remote device the request has been sent to
+ * @param msg_cnt Message counter of the expired request
+ * @param ctx Context passed on request registration
+ */
+typedef void (*PendingRequestTimeoutCallback)(DeviceRemoteObject* remote_device, MsgCounterType msg_cnt, void* ctx);
+
+/**
+ * @brief Pending Requests Interface
+ * (Pending Requests "virtual functions table" declaration)
+ */
+typedef struct PendingRequestsInterface PendingRequestsInterface;
+
+/**
+ * @brief Pending Requests Object type definition
+ * ("abstract class", has no members but only pointer to
+ * "virtual functions table")
+ */
+typedef struct PendingRequestsObject PendingRequestsObject;
+
+/**
+ * @brief Pending Requests Interface Structure
+ */
+struct PendingRequestsInterface {
+  void (*destruct)(PendingRequestsObject* self);
+  EebusError (*add)(PendingRequestsObject* self, MsgCounterType msg_cnt, uint32_t max_delay_ms,
+      PendingRequestTimeoutCallback cb, void* ctx);
+  EebusError (*remove)(PendingRequestsObject* self, MsgCounterType msg_cnt);
+  bool (*is_full)(const PendingRequestsObject* self);
+  size_t (*get_size)(const PendingRequestsObject* self);
+  void (*tick)(PendingRequestsObject* self, uint32_t elapsed_ms);
+  void (*clear)(PendingRequestsObject* self);
+};
+
+/**
+ * @brief Pending Requests Object Structure
+ */
+struct PendingRequestsObject {
+  const PendingRequestsInterface* interface_;
+};
+
+/**
+ * @brief Pending Requests pointer typecast
+ */
+#define PENDING_REQUESTS_OBJECT(obj) ((PendingRequestsObject*)(obj))
+
+/**
+ * @brief Pending Requests Interface class pointer typecast
+ */
+#define PENDING_REQUESTS_INTERFACE(obj) (PENDING_REQUESTS_OBJECT(obj)->interface_)
+
+/**
+ * @brief Pending Requests Destruct caller definition
+ */
+#define PENDING_REQUESTS_DESTRUCT(obj) (PENDING_REQUESTS_INTERFACE(obj)->destruct(obj))
+
+/**
+ * @brief Pending Requests Add caller definition.
+ * The requests beyond the in-flight limit are still accepted up to the reserved headroom,
+ * returns kEebusErrorCommunicationBusy once the headroom is exhausted as well
+ */
+#define PENDING_REQUESTS_ADD(obj, msg_cnt, max_delay_ms, cb, ctx) \
+  (PENDING_REQUESTS_INTERFACE(obj)->add(obj, msg_cnt, max_delay_ms, cb, ctx))
+
+/**
+ * @brief Pending Requests Remove caller definition
+ */
+#define PENDING_REQUESTS_REMOVE(obj, msg_cnt) (PENDING_REQUESTS_INTERFACE(obj)->remove(obj, msg_cnt))
+
+/**
+ * @brief Pending Requests Is Full caller definition.
+ * Returns true once the in-flight requests limit is reached, the application requests have to be rejected then
+ */
+#define PENDING_REQUESTS_IS_FULL(obj) (PENDING_REQUESTS_INTERFACE(obj)->is_full(obj))
+
+/**
+ * @brief Pending Requests Get Size caller definition
+ */
+#define PENDING_REQUESTS_GET_SIZE(obj) (PENDING_REQUESTS_INTERFACE(obj)->get_size(obj))
+
+/**
+ * @brief Pending Requests Tick caller definition.
+ * Advances the table clock and expires the requests with elapsed deadline
+ */
+#define PENDING_REQUESTS_TICK(obj, elapsed_ms) (PENDING_REQUESTS_INTERFACE(obj)->tick(obj, elapsed_ms))
+
+/**
+ * @brief Pending Requests Clear caller definition.
+ * Expires all of the pending requests
+ */
+#define PENDING_REQUESTS_CLEAR(obj) (PENDING_REQUESTS_INTERFACE(obj)->clear(obj))
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_SPINE_API_PENDING_REQUESTS_INTERFACE_H_
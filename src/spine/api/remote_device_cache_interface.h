@@ -0,0 +1,130 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Remote Device Cache interface declarations
+ */
+
+#ifndef SRC_SPINE_API_REMOTE_DEVICE_CACHE_INTERFACE_H_
+#define SRC_SPINE_API_REMOTE_DEVICE_CACHE_INTERFACE_H_
+
+#include <stdbool.h>
+
+#include "src/common/eebus_errors.h"
+#include "src/spine/model/command_frame_types.h"
+#include "src/spine/model/datagram.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Remote Device Cache Interface
+ * (Remote Device Cache "virtual functions table" declaration)
+ */
+typedef struct RemoteDeviceCacheInterface RemoteDeviceCacheInterface;
+
+/**
+ * @brief Remote Device Cache Object type definition
+ * ("abstract class", has no members but only pointer to
+ * "virtual functions table")
+ */
+typedef struct RemoteDeviceCacheObject RemoteDeviceCacheObject;
+
+/**
+ * @brief Remote Device Cache Snapshot, keeps the files to be written out
+ * once the cache owner has released its lock
+ */
+typedef struct RemoteDeviceCacheSnapshot RemoteDeviceCacheSnapshot;
+
+/**
+ * @brief Remote Device Cache restore callback, called for each of the stored datagrams.
+ * Returns false if the datagram can not be applied anymore and has to be dropped from the cache
+ */
+typedef bool (*RemoteDeviceCacheRestoreCallback)(const DatagramType* datagram, void* ctx);
+
+/**
+ * @brief Remote Device Cache Interface Structure
+ */
+struct RemoteDeviceCacheInterface {
+  void (*destruct)(RemoteDeviceCacheObject* self);
+  void (*restore)(RemoteDeviceCacheObject* self, const char* ski, RemoteDeviceCacheRestoreCallback cb, void* ctx);
+  EebusError (*save)(RemoteDeviceCacheObject* self, const char* ski, const HeaderType* header, const CmdType* cmd);
+  EebusError (*flush)(RemoteDeviceCacheObject* self);
+  EebusError (*take_snapshot)(RemoteDeviceCacheObject* self, RemoteDeviceCacheSnapshot* snapshot);
+  void (*remove)(RemoteDeviceCacheObject* self, const char* ski);
+};
+
+/**
+ * @brief Remote Device Cache Object Structure
+ */
+struct RemoteDeviceCacheObject {
+  const RemoteDeviceCacheInterface* interface_;
+};
+
+/**
+ * @brief Remote Device Cache pointer typecast
+ */
+#define REMOTE_DEVICE_CACHE_OBJECT(obj) ((RemoteDeviceCacheObject*)(obj))
+
+/**
+ * @brief Remote Device Cache Interface class pointer typecast
+ */
+#define REMOTE_DEVICE_CACHE_INTERFACE(obj) (REMOTE_DEVICE_CACHE_OBJECT(obj)->interface_)
+
+/**
+ * @brief Remote Device Cache Destruct caller definition
+ */
+#define REMOTE_DEVICE_CACHE_DESTRUCT(obj) (REMOTE_DEVICE_CACHE_INTERFACE(obj)->destruct(obj))
+
+/**
+ * @brief Remote Device Cache Restore caller definition.
+ * Passes the datagrams stored for the SKI to the callback, the detailed discovery data goes first
+ */
+#define REMOTE_DEVICE_CACHE_RESTORE(obj, ski, cb, ctx) (REMOTE_DEVICE_CACHE_INTERFACE(obj)->restore(obj, ski, cb, ctx))
+
+/**
+ * @brief Remote Device Cache Save caller definition.
+ * Keeps the complete reply received from the remote feature, replacing the previous one of the same function.
+ * Returns kEebusErrorNoChange if the function is not cached or the data is the same
+ */
+#define REMOTE_DEVICE_CACHE_SAVE(obj, ski, header, cmd) \
+  (REMOTE_DEVICE_CACHE_INTERFACE(obj)->save(obj, ski, header, cmd))
+
+/**
+ * @brief Remote Device Cache Flush caller definition.
+ * Writes out the changes saved since the previous flush
+ */
+#define REMOTE_DEVICE_CACHE_FLUSH(obj) (REMOTE_DEVICE_CACHE_INTERFACE(obj)->flush(obj))
+
+/**
+ * @brief Remote Device Cache Take Snapshot caller definition.
+ * Moves the changes saved since the previous flush or snapshot to the snapshot without writing them,
+ * the outdated content of the snapshot is replaced. Returns kEebusErrorNoChange if nothing has changed
+ */
+#define REMOTE_DEVICE_CACHE_TAKE_SNAPSHOT(obj, snapshot) \
+  (REMOTE_DEVICE_CACHE_INTERFACE(obj)->take_snapshot(obj, snapshot))
+
+/**
+ * @brief Remote Device Cache Remove caller definition
+ */
+#define REMOTE_DEVICE_CACHE_REMOVE(obj, ski) (REMOTE_DEVICE_CACHE_INTERFACE(obj)->remove(obj, ski))
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_SPINE_API_REMOTE_DEVICE_CACHE_INTERFACE_H_
@@ -51,13 +51,13 @@ typedef struct SenderObject SenderObject;
 struct SenderInterface {
   void (*destruct)(SenderObject* self);
   EebusError (*read)(SenderObject* self, const FeatureAddressType* sender_addr, const FeatureAddressType* dest_addr,
-      const CmdType* cmd);
+      const CmdType* cmd, MsgCounterType* msg_cnt);
   EebusError (*reply)(
       SenderObject* self, const HeaderType* request_header, const FeatureAddressType* sender_addr, const CmdType* cmd);
   EebusError (*notify)(SenderObject* self, const FeatureAddressType* sender_addr, const FeatureAddressType* dest_addr,
       const CmdType* cmd);
   EebusError (*write)(SenderObject* self, const FeatureAddressType* sender_addr, const FeatureAddressType* dest_addr,
-      const CmdType* cmd);
+      const CmdType* cmd, MsgCounterType* msg_cnt);
   EebusError (*call_subscribe)(SenderObject* self, const FeatureAddressType* sender_addr,
       const FeatureAddressType* dest_addr, FeatureTypeType server_feature_type);
   EebusError (*call_unsubscribe)(
@@ -95,9 +95,11 @@ struct SenderObject {
 #define SENDER_DESTRUCT(obj) (SENDER_INTERFACE(obj)->destruct(obj))
 
 /**
- * @brief Sender Read caller definition
+ * @brief Sender Read caller definition.
+ * The counter of the sent message is stored to msg_cnt (if not NULL) to match the reply against
  */
-#define SEND_READ(obj, sender_addr, dest_addr, cmd) (SENDER_INTERFACE(obj)->read(obj, sender_addr, dest_addr, cmd))
+#define SEND_READ(obj, sender_addr, dest_addr, cmd, msg_cnt) \
+  (SENDER_INTERFACE(obj)->read(obj, sender_addr, dest_addr, cmd, msg_cnt))
 
 /**
  * @brief Sender Reply caller definition
@@ -111,9 +113,11 @@ struct SenderObject {
 #define SEND_NOTIFY(obj, sender_addr, dest_addr, cmd) (SENDER_INTERFACE(obj)->notify(obj, sender_addr, dest_addr, cmd))
 
 /**
- * @brief Sender Write caller definition
+ * @brief Sender Write caller definition.
+ * The counter of the sent message is stored to msg_cnt (if not NULL) to match the result against
  */
-#define SEND_WRITE(obj, sender_addr, dest_addr, cmd) (SENDER_INTERFACE(obj)->write(obj, sender_addr, dest_addr, cmd))
+#define SEND_WRITE(obj, sender_addr, dest_addr, cmd, msg_cnt) \
+  (SENDER_INTERFACE(obj)->write(obj, sender_addr, dest_addr, cmd, msg_cnt))
 
 /**
  * @brief Sender Call Subscribe caller definition
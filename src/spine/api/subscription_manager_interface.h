@@ -59,7 +59,8 @@ struct SubscriptionManagerInterface {
       const SubscriptionManagementDeleteCallType* data);
   void (*remove_device_subscriptions)(SubscriptionManagerObject* self, DeviceRemoteObject* remote_device);
   void (*remove_entity_subscriptions)(SubscriptionManagerObject* self, EntityRemoteObject* remote_entity);
-  void (*publish)(const SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd);
+  void (*remove_feature_subscriptions)(SubscriptionManagerObject* self, FeatureRemoteObject* remote_feature);
+  void (*publish)(SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd);
   NodeManagementSubscriptionDataType* (*create_subscription_data)(
       const SubscriptionManagerObject* self, DeviceRemoteObject* remote_device);
 };
@@ -110,6 +111,12 @@ struct SubscriptionManagerObject {
 #define SUBSCRIPTION_MANAGER_REMOVE_ENTITY_SUBSCRIPTIONS(obj, remote_entity) \
   (SUBSCRIPTION_MANAGER_INTERFACE(obj)->remove_entity_subscriptions(obj, remote_entity))
 
+/**
+ * @brief Subscription Manager Remove Feature Subscriptions caller definition
+ */
+#define SUBSCRIPTION_MANAGER_REMOVE_FEATURE_SUBSCRIPTIONS(obj, remote_feature) \
+  (SUBSCRIPTION_MANAGER_INTERFACE(obj)->remove_feature_subscriptions(obj, remote_feature))
+
 /**
  * @brief Subscription Manager Publish caller definition
  */
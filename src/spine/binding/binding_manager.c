@@ -48,19 +48,21 @@ static EebusError RemoveBinding(
     BindingManagerObject* self, const BindingManagementDeleteCallType* data, DeviceRemoteObject* remote_device);
 static void RemoveDeviceBindings(BindingManagerObject* self, DeviceRemoteObject* remote_device);
 static void RemoveEntityBindings(BindingManagerObject* self, EntityRemoteObject* remote_entity);
+static void RemoveFeatureBindings(BindingManagerObject* self, FeatureRemoteObject* remote_feature);
 static bool HasBinding(
     const BindingManagerObject* self, const FeatureAddressType* local_addr, const FeatureAddressType* remote_addr);
 static NodeManagementBindingDataType* CreateBindingData(
     const BindingManagerObject* self, const DeviceRemoteObject* remote_device);
 
 static const BindingManagerInterface binding_manager_methods = {
-    .destruct               = Destruct,
-    .add_binding            = AddBinding,
-    .remove_binding         = RemoveBinding,
-    .remove_device_bindings = RemoveDeviceBindings,
-    .remove_entity_bindings = RemoveEntityBindings,
-    .has_binding            = HasBinding,
-    .create_binding_data    = CreateBindingData,
+    .destruct                = Destruct,
+    .add_binding             = AddBinding,
+    .remove_binding          = RemoveBinding,
+    .remove_device_bindings  = RemoveDeviceBindings,
+    .remove_entity_bindings  = RemoveEntityBindings,
+    .remove_feature_bindings = RemoveFeatureBindings,
+    .has_binding             = HasBinding,
+    .create_binding_data     = CreateBindingData,
 };
 
 static void BindingManagerConstruct(BindingManager* self, const DeviceLocalObject* local_device);
@@ -239,6 +241,36 @@ void RemoveEntityBindings(BindingManagerObject* self, EntityRemoteObject* remote
   }
 }
 
+void RemoveFeatureBindings(BindingManagerObject* self, FeatureRemoteObject* remote_feature) {
+  BindingManager* const bm = BINDING_MANAGER(self);
+
+  if (remote_feature == NULL) {
+    return;
+  }
+
+  for (size_t i = 0; i < FeatureLinkContainerGetSize(&bm->binding_entries);) {
+    FeatureLink* const binding = FeatureLinkContainerGetElement(&bm->binding_entries, i);
+    if (FeatureLinkRemoteFeatureMatch(binding, remote_feature)) {
+      DeviceRemoteObject* const dr = FEATURE_REMOTE_GET_DEVICE(remote_feature);
+
+      const EventPayload payload = {
+          .ski           = DEVICE_REMOTE_GET_SKI(dr),
+          .event_type    = kEventTypeBindingChange,
+          .change_type   = kElementChangeRemove,
+          .device        = dr,
+          .entity        = FEATURE_REMOTE_GET_ENTITY(remote_feature),
+          .feature       = remote_feature,
+          .local_feature = binding->server_feature,
+      };
+
+      EventPublish(&payload);
+      FeatureLinkContainerRemove(&bm->binding_entries, binding);
+    } else {
+      ++i;
+    }
+  }
+}
+
 bool HasBinding(
     const BindingManagerObject* self, const FeatureAddressType* local_addr, const FeatureAddressType* remote_addr) {
   const BindingManager* const bm = BINDING_MANAGER(self);
@@ -34,6 +34,7 @@
 #include "src/spine/binding/binding_manager.h"
 #include "src/spine/device/data_reader.h"
 #include "src/spine/device/device_remote.h"
+#include "src/spine/device/remote_device_cache.h"
 #include "src/spine/device/sender.h"
 #include "src/spine/entity/entity_local.h"
 #include "src/spine/events/events.h"
@@ -58,6 +59,15 @@
 #define DEVICE_LOCAL_DEBUG_PRINTF(fmt, ...)
 #endif  // DEVICE_LOCAL_DEBUG
 
+/** Device Local tick timer period, ms */
+#define DEVICE_LOCAL_TICK_PERIOD_MS 1000
+
+/** Period of the application loop wake up repeated while the queue stays full in the external loop mode, ms */
+#define DEVICE_LOCAL_WAKE_RETRY_MS 100
+
+/** Maximal number of the queue messages handled under a single device lock */
+#define DEVICE_LOCAL_QUEUE_BATCH_MAX_MSG 8
+
 enum DeviceLocalQueueMsgType {
   kDeviceLocalQueueMsgTypeDataReceived,
   kDeviceLocalQueueMsgTypeTimerTick,
@@ -85,19 +95,36 @@ struct DeviceLocal {
   BindingManagerObject* binding_manager;
   NodeManagementObject* node_management;
   StringLut remote_devices;
+  RemoteDeviceCacheObject* remote_device_cache;
+  /** Cache changes taken under the device lock, written out by the loop thread after unlocking */
+  RemoteDeviceCacheSnapshot* remote_device_cache_snapshot;
 
   bool cancel;
   EebusQueueObject* msg_queue;
   EebusThreadObject* thread;
   EebusTimerObject* timer;
   EebusMutexObject* mutex;
+
+  bool external_loop;
+  DeviceLocalWakeCallback wake_cb;
+  void* wake_ctx;
+  uint32_t tick_remaining_ms;
 };
 
 #define DEVICE_LOCAL(obj) ((DeviceLocal*)(obj))
 
+typedef struct RemoteDeviceRestoreContext RemoteDeviceRestoreContext;
+
+struct RemoteDeviceRestoreContext {
+  DeviceLocal* device_local;
+  DeviceRemoteObject* remote_device;
+};
+
 static void Destruct(DeviceObject* self);
 static EebusError Start(DeviceLocalObject* self);
 static void Stop(DeviceLocalObject* self);
+static void SetExternalLoop(DeviceLocalObject* self, DeviceLocalWakeCallback wake_cb, void* ctx);
+static uint32_t Step(DeviceLocalObject* self, uint32_t elapsed_ms);
 static DataReaderObject* SetupRemoteDevice(DeviceLocalObject* self, const char* ski, DataWriterObject* writer);
 static void AddRemoteDeviceForSki(DeviceLocalObject* self, const char* ski, DeviceRemoteObject* remote_device);
 static EebusError RequestRemoteDetailedDiscoveryData(DeviceLocalObject* self, const DeviceRemoteObject* remote_device);
@@ -116,6 +143,8 @@ static EebusError HandleMessage(DeviceLocalObject* self, MessageBuffer* msg, Dev
 static NodeManagementObject* GetNodeManagement(const DeviceLocalObject* self);
 static BindingManagerObject* GetBindingManager(const DeviceLocalObject* self);
 static SubscriptionManagerObject* GetSubscriptionManager(const DeviceLocalObject* self);
+static void SetRemoteDeviceCache(DeviceLocalObject* self, RemoteDeviceCacheObject* remote_device_cache);
+static RemoteDeviceCacheObject* GetRemoteDeviceCache(const DeviceLocalObject* self);
 static void
 NotifySubscribers(const DeviceLocalObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd);
 static NodeManagementDetailedDiscoveryDeviceInformationType* CreateInformation(const DeviceLocalObject* self);
@@ -133,6 +162,8 @@ static const DeviceLocalInterface device_local_methods = {
 
     .start                                  = Start,
     .stop                                   = Stop,
+    .set_external_loop                      = SetExternalLoop,
+    .step                                   = Step,
     .setup_remote_device                    = SetupRemoteDevice,
     .add_remote_device_for_ski              = AddRemoteDeviceForSki,
     .request_remote_detailed_discovery_data = RequestRemoteDetailedDiscoveryData,
@@ -150,6 +181,8 @@ static const DeviceLocalInterface device_local_methods = {
     .get_node_management                    = GetNodeManagement,
     .get_binding_manager                    = GetBindingManager,
     .get_subscription_manager               = GetSubscriptionManager,
+    .set_remote_device_cache                = SetRemoteDeviceCache,
+    .get_remote_device_cache                = GetRemoteDeviceCache,
     .notify_subscribers                     = NotifySubscribers,
     .create_information                     = CreateInformation,
     .lock                                   = Lock,
@@ -164,6 +197,18 @@ static void DeviceLocalConstruct(
 static void DeviceLocalQueueMsgDeallocator(void* msg);
 static void DeivceLocalHandleEvent(const EventPayload* payload, void* ctx);
 static void RemoteDeviceDeleter(void* dr);
+static size_t HandleQueueMessages(DeviceLocalObject* self, uint32_t timeout_ms);
+static void WriteRemoteDeviceCache(DeviceLocal* self);
+static void RestoreRemoteDeviceModel(DeviceLocal* self, DeviceRemoteObject* remote_device);
+static bool RestoreRemoteDeviceDatagram(const DatagramType* datagram, void* ctx);
+static void
+CacheRemoteReply(DeviceLocal* self, DeviceRemoteObject* remote_device, const HeaderType* header, const CmdType* cmd);
+static EebusError ProcessCmd(
+    DeviceLocalObject* self,
+    const DatagramType* datagram,
+    const CmdType* cmd,
+    DeviceRemoteObject* remote_device
+);
 static EebusError
 ProcessDatagram(DeviceLocalObject* self, const DatagramType* datagram, DeviceRemoteObject* remote_device);
 
@@ -216,11 +261,18 @@ void DeviceLocalConstruct(
   self->binding_manager      = BindingManagerCreate(DEVICE_LOCAL_OBJECT(self));
   self->node_management      = NULL;
   StringLutInit(&self->remote_devices);
+  self->remote_device_cache          = NULL;
+  self->remote_device_cache_snapshot = RemoteDeviceCacheSnapshotCreate();
   self->cancel    = false;
   self->msg_queue = NULL;
   self->thread    = NULL;
   self->timer     = NULL;
 
+  self->external_loop     = false;
+  self->wake_cb           = NULL;
+  self->wake_ctx          = NULL;
+  self->tick_remaining_ms = DEVICE_LOCAL_TICK_PERIOD_MS;
+
   static const size_t kQueueMaxMsg = 15;
 
   self->msg_queue = EebusQueueCreate(kQueueMaxMsg, sizeof(DeviceLocalQueueMessage), DeviceLocalQueueMsgDeallocator);
@@ -265,6 +317,14 @@ void Destruct(DeviceObject* self) {
 
   StringLutRelease(&dl->remote_devices);
 
+  // The snapshot holds the older changes, so it goes before the cache flush on release
+  RemoteDeviceCacheSnapshotWrite(dl->remote_device_cache_snapshot);
+  RemoteDeviceCacheSnapshotDelete(dl->remote_device_cache_snapshot);
+  dl->remote_device_cache_snapshot = NULL;
+
+  RemoteDeviceCacheDelete(dl->remote_device_cache);
+  dl->remote_device_cache = NULL;
+
   EebusMutexDelete(dl->mutex);
   dl->mutex = NULL;
 
@@ -298,37 +358,86 @@ void DeviceLocalTick(DeviceLocalObject* self) {
       HEARTBEAT_MANAGER_TICK(hbm);
     }
   }
+
+  for (size_t i = 0; i < StringLutGetSize(&dl->remote_devices); ++i) {
+    DeviceRemoteObject* const dr = (DeviceRemoteObject*)StringLutGetElementValue(&dl->remote_devices, i);
+
+    PendingRequestsObject* const pending_requests = DEVICE_REMOTE_GET_PENDING_REQUESTS(dr);
+    if (pending_requests != NULL) {
+      PENDING_REQUESTS_TICK(pending_requests, DEVICE_LOCAL_TICK_PERIOD_MS);
+    }
+  }
+
+  // The replies cached since the previous tick are taken at once,
+  // the files are written by WriteRemoteDeviceCache() after the device lock is released
+  if ((dl->remote_device_cache != NULL) && (dl->remote_device_cache_snapshot != NULL)) {
+    REMOTE_DEVICE_CACHE_TAKE_SNAPSHOT(dl->remote_device_cache, dl->remote_device_cache_snapshot);
+  }
+}
+
+void WriteRemoteDeviceCache(DeviceLocal* self) {
+  if (self->remote_device_cache_snapshot != NULL) {
+    RemoteDeviceCacheSnapshotWrite(self->remote_device_cache_snapshot);
+  }
 }
 
 void HandleQueueMessage(DeviceLocalObject* self) {
+  HandleQueueMessages(self, kTimeoutInfinite);
+}
+
+size_t HandleQueueMessages(DeviceLocalObject* self, uint32_t timeout_ms) {
   DeviceLocal* const dl = DEVICE_LOCAL(self);
 
-  DeviceLocalQueueMessage queue_msg;
-  const EebusError queue_recv_ret = EEBUS_QUEUE_RECEIVE(dl->msg_queue, &queue_msg, kTimeoutInfinite);
+  // Take the whole burst at once, to process it under a single device lock
+  DeviceLocalQueueMessage queue_msgs[DEVICE_LOCAL_QUEUE_BATCH_MAX_MSG];
+  DatagramType* datagrams[DEVICE_LOCAL_QUEUE_BATCH_MAX_MSG] = {NULL};
+  size_t msg_num = 0;
+
+  const EebusError queue_recv_ret = EEBUS_QUEUE_RECEIVE_MANY(
+      dl->msg_queue,
+      queue_msgs,
+      DEVICE_LOCAL_QUEUE_BATCH_MAX_MSG,
+      &msg_num,
+      timeout_ms
+  );
 
   if (queue_recv_ret != kEebusErrorOk) {
-    DEVICE_LOCAL_DEBUG_PRINTF("%s(), error receiving the message from queue\n", __func__);
-    return;
+    if (timeout_ms == kTimeoutInfinite) {
+      DEVICE_LOCAL_DEBUG_PRINTF("%s(), error receiving the message from queue\n", __func__);
+    }
+
+    return 0;
   }
 
-  if (queue_msg.type == kDeviceLocalQueueMsgTypeDataReceived) {
-    DatagramType* const datagram = DatagramParse((const char*)queue_msg.msg_buf.data);
+  // Parsing needs no device lock
+  for (size_t i = 0; i < msg_num; ++i) {
+    if (queue_msgs[i].type == kDeviceLocalQueueMsgTypeDataReceived) {
+      datagrams[i] = DatagramParseMessage(queue_msgs[i].msg_buf.data, queue_msgs[i].msg_buf.data_size);
+    }
+  }
 
-    EEBUS_MUTEX_LOCK(dl->mutex);
-    ProcessDatagram(self, datagram, queue_msg.remote_device);
-    EEBUS_MUTEX_UNLOCK(dl->mutex);
+  EEBUS_MUTEX_LOCK(dl->mutex);
+  for (size_t i = 0; i < msg_num; ++i) {
+    if (queue_msgs[i].type == kDeviceLocalQueueMsgTypeDataReceived) {
+      ProcessDatagram(self, datagrams[i], queue_msgs[i].remote_device);
+    } else if (queue_msgs[i].type == kDeviceLocalQueueMsgTypeTimerTick) {
+      DeviceLocalTick(self);
+    } else if (queue_msgs[i].type == kDeviceLocalQueueMsgTypeCancel) {
+      DEVICE_LOCAL_DEBUG_PRINTF("%s(), cancelled\n", __func__);
+    } else {
+      DEVICE_LOCAL_DEBUG_PRINTF("%s(), invalid queue message type\n", __func__);
+    }
+  }
+  EEBUS_MUTEX_UNLOCK(dl->mutex);
 
-    DatagramDelete(datagram);
-    MessageBufferRelease(&queue_msg.msg_buf);
-  } else if (queue_msg.type == kDeviceLocalQueueMsgTypeTimerTick) {
-    EEBUS_MUTEX_LOCK(dl->mutex);
-    DeviceLocalTick(self);
-    EEBUS_MUTEX_UNLOCK(dl->mutex);
-  } else if (queue_msg.type == kDeviceLocalQueueMsgTypeCancel) {
-    DEVICE_LOCAL_DEBUG_PRINTF("%s(), cancelled\n", __func__);
-  } else {
-    DEVICE_LOCAL_DEBUG_PRINTF("%s(), invalid queue message type\n", __func__);
+  WriteRemoteDeviceCache(dl);
+
+  for (size_t i = 0; i < msg_num; ++i) {
+    DatagramDelete(datagrams[i]);
+    DeviceLocalQueueMsgDeallocator(&queue_msgs[i]);
   }
+
+  return msg_num;
 }
 
 void* DeviceLocalLoop(void* parameters) {
@@ -354,6 +463,12 @@ EebusError DeviceLocalTryStart(DeviceLocal* self) {
     return kEebusErrorMemory;
   }
 
+  if (self->external_loop) {
+    // Messages and ticks are handled by Step() called from the application loop
+    self->tick_remaining_ms = DEVICE_LOCAL_TICK_PERIOD_MS;
+    return kEebusErrorOk;
+  }
+
   self->thread = EebusThreadCreate(DeviceLocalLoop, self, 4 * 1024);
   if (self->thread == NULL) {
     DEVICE_LOCAL_DEBUG_PRINTF("%s(), start thread failed\n", __func__);
@@ -366,7 +481,7 @@ EebusError DeviceLocalTryStart(DeviceLocal* self) {
     return kEebusErrorMemoryAllocate;
   }
 
-  EEBUS_TIMER_START(self->timer, 1000, true);
+  EEBUS_TIMER_START(self->timer, DEVICE_LOCAL_TICK_PERIOD_MS, true);
 
   return kEebusErrorOk;
 }
@@ -406,6 +521,37 @@ static void Stop(DeviceLocalObject* self) {
   EEBUS_QUEUE_CLEAR(dl->msg_queue);
 }
 
+void SetExternalLoop(DeviceLocalObject* self, DeviceLocalWakeCallback wake_cb, void* ctx) {
+  DeviceLocal* const dl = DEVICE_LOCAL(self);
+
+  dl->external_loop = true;
+  dl->wake_cb       = wake_cb;
+  dl->wake_ctx      = ctx;
+}
+
+uint32_t Step(DeviceLocalObject* self, uint32_t elapsed_ms) {
+  DeviceLocal* const dl = DEVICE_LOCAL(self);
+
+  // A single batch per step, so that a busy remote cannot hold the application loop
+  HandleQueueMessages(self, 0);
+
+  while (elapsed_ms >= dl->tick_remaining_ms) {
+    elapsed_ms -= dl->tick_remaining_ms;
+
+    dl->tick_remaining_ms = DEVICE_LOCAL_TICK_PERIOD_MS;
+
+    EEBUS_MUTEX_LOCK(dl->mutex);
+    DeviceLocalTick(self);
+    EEBUS_MUTEX_UNLOCK(dl->mutex);
+
+    WriteRemoteDeviceCache(dl);
+  }
+
+  dl->tick_remaining_ms -= elapsed_ms;
+
+  return EEBUS_QUEUE_IS_EMPTY(dl->msg_queue) ? dl->tick_remaining_ms : 0;
+}
+
 void DeivceLocalHandleEvent(const EventPayload* payload, void* ctx) {
   DeviceLocal* const dl = (DeviceLocal*)(ctx);
   // Subscribe to NodeManagement after DetailedDiscovery is received
@@ -417,6 +563,11 @@ void DeivceLocalHandleEvent(const EventPayload* payload, void* ctx) {
     return;
   }
 
+  // Skip the remote devices of the other Device Local instances running in the same process
+  if ((payload->device != NULL) && (DEVICE_REMOTE_GET_LOCAL_DEVICE(payload->device) != DEVICE_LOCAL_OBJECT(dl))) {
+    return;
+  }
+
   DeviceRemoteObject* const remote_device
       = DEVICE_LOCAL_GET_REMOTE_DEVICE_WITH_SKI(DEVICE_LOCAL_OBJECT(dl), payload->ski);
   if (remote_device == NULL) {
@@ -467,6 +618,33 @@ DataReaderObject* SetupRemoteDevice(DeviceLocalObject* self, const char* ski, Da
   return DEVICE_REMOTE_GET_DATA_READER(dr);
 }
 
+void RestoreRemoteDeviceModel(DeviceLocal* self, DeviceRemoteObject* remote_device) {
+  // Restoring makes sense for the remote device not known yet only,
+  // the model known from the previous connection is used until the requested reply revalidates it
+  if ((self->remote_device_cache == NULL) || (DEVICE_GET_ADDRESS(DEVICE_OBJECT(remote_device)) != NULL)) {
+    return;
+  }
+
+  RemoteDeviceRestoreContext ctx = {
+      .device_local  = self,
+      .remote_device = remote_device,
+  };
+
+  const char* const ski = DEVICE_REMOTE_GET_SKI(remote_device);
+  REMOTE_DEVICE_CACHE_RESTORE(self->remote_device_cache, ski, RestoreRemoteDeviceDatagram, &ctx);
+}
+
+bool RestoreRemoteDeviceDatagram(const DatagramType* datagram, void* ctx) {
+  RemoteDeviceRestoreContext* const restore_ctx = (RemoteDeviceRestoreContext*)ctx;
+
+  // The stored replies go the same way as the received ones, so the same events are published.
+  // The one which is not accepted anymore (e.g. the local feature is gone) is dropped
+  DeviceLocalObject* const dl = DEVICE_LOCAL_OBJECT(restore_ctx->device_local);
+
+  const EebusError err = ProcessCmd(dl, datagram, datagram->payload->cmd[0], restore_ctx->remote_device);
+  return (err == kEebusErrorOk);
+}
+
 void RemoteDeviceDeleter(void* dr) {
   DeviceRemoteDelete((DeviceRemoteObject*)dr);
 }
@@ -488,9 +666,8 @@ void RemoveRemoteDeviceConnection(DeviceLocalObject* self, const char* ski) {
     return;
   }
 
-  DEVICE_LOCAL_REMOVE_REMOTE_DEVICE(self, ski);
-
-  // inform about the disconnection
+  // Inform about the disconnection while the remote device is still valid,
+  // the handlers are free to access it
   const EventPayload payload = {
       .ski         = ski,
       .event_type  = kEventTypeDeviceChange,
@@ -499,6 +676,10 @@ void RemoveRemoteDeviceConnection(DeviceLocalObject* self, const char* ski) {
   };
 
   EventPublish(&payload);
+
+  // The cache changes of the remote device are written out with the next tick
+  DEVICE_LOCAL_REMOVE_REMOTE_DEVICE(self, ski);
+
   EEBUS_MUTEX_UNLOCK(dl->mutex);
 }
 
@@ -527,6 +708,12 @@ void RemoveRemoteDevice(DeviceLocalObject* self, const char* ski) {
       .device = (char*)DEVICE_GET_ADDRESS(DEVICE_OBJECT(remote_device)),
   };
 
+  // Expire the requests which are not going to be answered anymore
+  PendingRequestsObject* const pending_requests = DEVICE_REMOTE_GET_PENDING_REQUESTS(remote_device);
+  if (pending_requests != NULL) {
+    PENDING_REQUESTS_CLEAR(pending_requests);
+  }
+
   // Remove all data caches for this device
   for (size_t i = 0; i < VectorGetSize(&dl->entities); ++i) {
     EntityLocalObject* const entity = VectorGetElement(&dl->entities, i);
@@ -696,6 +883,7 @@ void NotifySubscribersOfEntity(DeviceLocal* self, EntityLocalObject* entity, Net
 void AddEntity(DeviceLocalObject* self, EntityLocalObject* entity) {
   DeviceLocal* const dl = DEVICE_LOCAL(self);
   VectorPushBack(&dl->entities, entity);
+  NodeManagementInvalidateDetailedDiscoveryData(dl->node_management);
   NotifySubscribersOfEntity(dl, entity, kNetworkManagementStateChangeTypeAdded);
 }
 
@@ -713,6 +901,7 @@ void RemoveEntity(DeviceLocalObject* self, EntityLocalObject* entity) {
 
   NotifySubscribersOfEntity(dl, entity, kNetworkManagementStateChangeTypeRemoved);
   VectorRemove(&dl->entities, entity);
+  NodeManagementInvalidateDetailedDiscoveryData(dl->node_management);
   EntityLocalDelete(entity);
 }
 
@@ -816,9 +1005,28 @@ EebusError ProcessCmd(
     return err;
   }
 
+  if (message.cmd_classifier == kCommandClassifierTypeReply) {
+    CacheRemoteReply(DEVICE_LOCAL(self), remote_device, header, cmd);
+  }
+
   return kEebusErrorOk;
 }
 
+void CacheRemoteReply(
+    DeviceLocal* self,
+    DeviceRemoteObject* remote_device,
+    const HeaderType* header,
+    const CmdType* cmd
+) {
+  if (self->remote_device_cache == NULL) {
+    return;
+  }
+
+  // The cache keeps the replies it is able to restore only and skips the unchanged ones,
+  // the file itself is written on the tick
+  REMOTE_DEVICE_CACHE_SAVE(self->remote_device_cache, DEVICE_REMOTE_GET_SKI(remote_device), header, cmd);
+}
+
 EebusError ProcessDatagram(DeviceLocalObject* self, const DatagramType* datagram, DeviceRemoteObject* remote_device) {
   if (datagram == NULL) {
     DEVICE_LOCAL_DEBUG_PRINTF("%s(), datagram is NULL\n", __func__);
@@ -845,6 +1053,16 @@ EebusError ProcessDatagram(DeviceLocalObject* self, const DatagramType* datagram
     return kEebusErrorInputArgumentNull;
   }
 
+  const CommandClassifierType classifier = *datagram->header->cmd_classifier;
+  if (((classifier == kCommandClassifierTypeReply) || (classifier == kCommandClassifierTypeResult))
+      && (datagram->header->msg_cnt_ref != NULL)) {
+    // The request has been answered, stop tracking its response deadline
+    PendingRequestsObject* const pending_requests = DEVICE_REMOTE_GET_PENDING_REQUESTS(remote_device);
+    if (pending_requests != NULL) {
+      PENDING_REQUESTS_REMOVE(pending_requests, *datagram->header->msg_cnt_ref);
+    }
+  }
+
   EebusError err = kEebusErrorOk;
   for (size_t i = 0; i < datagram->payload->cmd_size; ++i) {
     if (datagram->payload->cmd[i] == NULL) {
@@ -874,6 +1092,13 @@ EebusError ProcessDatagram(DeviceLocalObject* self, const DatagramType* datagram
     }
   }
 
+  // The remote device knows the local one once the detailed discovery reply is sent. Restoring the model
+  // earlier makes the use cases send their requests from the features the remote device rejects as unknown
+  if ((err == kEebusErrorOk) && (classifier == kCommandClassifierTypeRead)
+      && (datagram->payload->cmd[0]->data_choice_type_id == kFunctionTypeNodeManagementDetailedDiscoveryData)) {
+    RestoreRemoteDeviceModel(DEVICE_LOCAL(self), remote_device);
+  }
+
   return err;
 }
 
@@ -888,7 +1113,24 @@ EebusError HandleMessage(DeviceLocalObject* self, MessageBuffer* msg, DeviceRemo
   MessageBufferInit(&queue_msg.msg_buf, NULL, 0);
   MessageBufferMove(msg, &queue_msg.msg_buf);
 
-  return EEBUS_QUEUE_SEND(dl->msg_queue, &queue_msg, kTimeoutInfinite);
+  if (dl->wake_cb == NULL) {
+    return EEBUS_QUEUE_SEND(dl->msg_queue, &queue_msg, kTimeoutInfinite);
+  }
+
+  // Only the application loop drains the queue. The fullness check is left to the queue send itself,
+  // which runs under the queue lock, and the application is woken up again for as long as the queue
+  // stays full, so a wake up consumed before the queue filled up cannot block this thread forever
+  EebusError err = EEBUS_QUEUE_SEND(dl->msg_queue, &queue_msg, 0);
+  while (err == kEebusErrorTime) {
+    dl->wake_cb(dl->wake_ctx);
+    err = EEBUS_QUEUE_SEND(dl->msg_queue, &queue_msg, DEVICE_LOCAL_WAKE_RETRY_MS);
+  }
+
+  if (err == kEebusErrorOk) {
+    dl->wake_cb(dl->wake_ctx);
+  }
+
+  return err;
 }
 
 NodeManagementObject* GetNodeManagement(const DeviceLocalObject* self) {
@@ -903,6 +1145,19 @@ SubscriptionManagerObject* GetSubscriptionManager(const DeviceLocalObject* self)
   return DEVICE_LOCAL(self)->subscription_manager;
 }
 
+void SetRemoteDeviceCache(DeviceLocalObject* self, RemoteDeviceCacheObject* remote_device_cache) {
+  DeviceLocal* const dl = DEVICE_LOCAL(self);
+
+  EEBUS_MUTEX_LOCK(dl->mutex);
+  RemoteDeviceCacheDelete(dl->remote_device_cache);
+  dl->remote_device_cache = remote_device_cache;
+  EEBUS_MUTEX_UNLOCK(dl->mutex);
+}
+
+RemoteDeviceCacheObject* GetRemoteDeviceCache(const DeviceLocalObject* self) {
+  return DEVICE_LOCAL(self)->remote_device_cache;
+}
+
 void NotifySubscribers(const DeviceLocalObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd) {
   const DeviceLocal* dl = DEVICE_LOCAL(self);
   SUBSCRIPTION_MANAGER_PUBLISH(dl->subscription_manager, feature_addr, cmd);
@@ -25,13 +25,17 @@
 #include "src/common/eebus_malloc.h"
 #include "src/common/num_ptr.h"
 #include "src/common/string_util.h"
+#include "src/spine/api/binding_manager_interface.h"
 #include "src/spine/api/device_local_interface.h"
 #include "src/spine/api/device_remote_interface.h"
 #include "src/spine/api/sender_interface.h"
+#include "src/spine/api/subscription_manager_interface.h"
 #include "src/spine/device/data_reader.h"
 #include "src/spine/device/sender.h"
 #include "src/spine/entity/entity_remote.h"
+#include "src/spine/events/events.h"
 #include "src/spine/feature/feature_remote.h"
+#include "src/spine/feature/pending_requests.h"
 
 typedef struct DeviceRemote DeviceRemote;
 
@@ -42,6 +46,7 @@ struct DeviceRemote {
   const char* ski;
   Vector entities;
   SenderObject* sender;
+  PendingRequestsObject* pending_requests;
   DeviceLocalObject* local_device;
   DataReaderObject* data_reader;
 };
@@ -50,6 +55,7 @@ struct DeviceRemote {
 
 static void Destruct(DeviceObject* self);
 static const char* GetSki(const DeviceRemoteObject* self);
+static DeviceLocalObject* GetLocalDevice(const DeviceRemoteObject* self);
 static DataReaderObject* GetDataReader(const DeviceRemoteObject* self);
 static void AddEntity(DeviceRemoteObject* self, EntityRemoteObject* entity);
 static EntityRemoteObject*
@@ -68,10 +74,13 @@ static FeatureRemoteObject* GetFeatureWithTypeAndRole(
 );
 static EebusError HandleSpineMesssage(DeviceRemoteObject* self, MessageBuffer* msg);
 static SenderObject* GetSender(const DeviceRemoteObject* self);
+static PendingRequestsObject* GetPendingRequests(const DeviceRemoteObject* self);
 static NodeManagementUseCaseDataType* UseCasesDataCopy(const DeviceRemoteObject* self);
 static void UpdateDevice(DeviceRemoteObject* self, const NetworkManagementDeviceDescriptionDataType* description);
 static const Vector*
 AddEntityAndFeatures(DeviceRemoteObject* self, bool init, const NodeManagementDetailedDiscoveryDataType* data);
+static Vector*
+ReleaseRemovedEntities(DeviceRemoteObject* self, bool init, const NodeManagementDetailedDiscoveryDataType* data);
 static EebusError CheckEntityInformation(
     const DeviceRemoteObject* self,
     bool init,
@@ -88,6 +97,7 @@ static const DeviceRemoteInterface device_remote_methods = {
     },
 
     .get_ski                        = GetSki,
+    .get_local_device               = GetLocalDevice,
     .get_data_reader                = GetDataReader,
     .add_entity                     = AddEntity,
     .release_entity                 = ReleaseEntity,
@@ -97,9 +107,11 @@ static const DeviceRemoteInterface device_remote_methods = {
     .get_feature_with_type_and_role = GetFeatureWithTypeAndRole,
     .handle_spine_messsage          = HandleSpineMesssage,
     .get_sender                     = GetSender,
+    .get_pending_requests           = GetPendingRequests,
     .use_cases_data_copy            = UseCasesDataCopy,
     .update_device                  = UpdateDevice,
     .add_entity_and_features        = AddEntityAndFeatures,
+    .release_removed_entities       = ReleaseRemovedEntities,
     .check_entity_information       = CheckEntityInformation,
 };
 
@@ -110,11 +122,33 @@ static EntityRemoteObject*
 AddEntityWithAddressAndType(DeviceRemote* self, const EntityAddressType* addr, EntityTypeType entity_type);
 static const char* DeviceInfoGetDeviceAddress(const NodeManagementDetailedDiscoveryDeviceInformationType* device_info);
 static bool EntityIdsMatch(const EntityAddressType* entity_addr, const FeatureAddressType* feature_addr);
-static void EntityRemoteAddFeaturesWithInfo(
-    EntityRemoteObject* entity,
+static bool IsStateChangeRemoved(const NetworkManagementStateChangeType* last_state_change);
+static bool IsFeatureListed(
+    const EntityRemoteObject* entity,
+    const FeatureRemoteObject* feature,
     const NodeManagementDetailedDiscoveryFeatureInformationType* const* feature_info,
     size_t feature_info_size
 );
+static void RemoveEntityFeature(DeviceRemote* self, EntityRemoteObject* entity, FeatureRemoteObject* feature);
+static void FeatureRemoteUpdateWithDescription(
+    FeatureRemoteObject* feature,
+    const NetworkManagementFeatureDescriptionDataType* feature_description
+);
+static bool EntityRemoteSyncFeaturesWithInfo(
+    DeviceRemote* self,
+    EntityRemoteObject* entity,
+    const NodeManagementDetailedDiscoveryFeatureInformationType* const* feature_info,
+    size_t feature_info_size,
+    bool complete
+);
+static const NodeManagementDetailedDiscoveryEntityInformationType*
+FindEntityInformation(const NodeManagementDetailedDiscoveryDataType* data, const EntityRemoteObject* entity);
+static bool IsEntityRemoved(
+    const DeviceRemote* self,
+    bool init,
+    const NodeManagementDetailedDiscoveryDataType* data,
+    const EntityRemoteObject* entity
+);
 
 EntityAddressType DeviceInfoEntityAddress(const DeviceRemoteObject* self) {
   static const uint32_t device_information_entity_id      = DEVICE_INFORMATION_ENTITY_ID;
@@ -158,10 +192,11 @@ void DeviceRemoteConstruct(DeviceRemote* self, DeviceLocalObject* local_device,
 
   VectorConstruct(&self->entities);
 
-  self->ski          = StringCopy(ski);
-  self->sender       = sender;
-  self->local_device = local_device;
-  self->data_reader  = DataReaderCreate(DEVICE_REMOTE_OBJECT(self));
+  self->ski              = StringCopy(ski);
+  self->sender           = sender;
+  self->pending_requests = PendingRequestsCreate(DEVICE_REMOTE_OBJECT(self), PENDING_REQUESTS_MAX_NUM_DEFAULT);
+  self->local_device     = local_device;
+  self->data_reader      = DataReaderCreate(DEVICE_REMOTE_OBJECT(self));
 
   // Add Node Management
   const EntityAddressType device_info_entity_addr = DeviceInfoEntityAddress(DEVICE_REMOTE_OBJECT(self));
@@ -204,6 +239,9 @@ void Destruct(DeviceObject* self) {
   SenderDelete(dr->sender);
   dr->sender = NULL;
 
+  PendingRequestsDelete(dr->pending_requests);
+  dr->pending_requests = NULL;
+
   DataReaderDelete(dr->data_reader);
   dr->data_reader = NULL;
 
@@ -214,6 +252,10 @@ const char* GetSki(const DeviceRemoteObject* self) {
   return DEVICE_REMOTE(self)->ski;
 }
 
+DeviceLocalObject* GetLocalDevice(const DeviceRemoteObject* self) {
+  return DEVICE_REMOTE(self)->local_device;
+}
+
 DataReaderObject* GetDataReader(const DeviceRemoteObject* self) {
   return DEVICE_REMOTE(self)->data_reader;
 }
@@ -288,6 +330,10 @@ SenderObject* GetSender(const DeviceRemoteObject* self) {
   return DEVICE_REMOTE(self)->sender;
 }
 
+PendingRequestsObject* GetPendingRequests(const DeviceRemoteObject* self) {
+  return DEVICE_REMOTE(self)->pending_requests;
+}
+
 NodeManagementUseCaseDataType* UseCasesDataCopy(const DeviceRemoteObject* self) {
   const EntityAddressType entity_addr = DeviceInfoEntityAddress(self);
   const FeatureRemoteObject* const nm = DEVICE_REMOTE_GET_FEATURE_WITH_TYPE_AND_ROLE(
@@ -314,7 +360,7 @@ void UpdateDevice(DeviceRemoteObject* self, const NetworkManagementDeviceDescrip
   }
 
   if (description->device_type != NULL) {
-    Int32Delete((int32_t*)device->feature_set);
+    Int32Delete((int32_t*)device->type);
     device->type = Int32Create(*description->device_type);
   }
 
@@ -337,6 +383,28 @@ const char* DeviceInfoGetDeviceAddress(const NodeManagementDetailedDiscoveryDevi
   return NULL;
 }
 
+void FeatureRemoteUpdateWithDescription(
+    FeatureRemoteObject* feature,
+    const NetworkManagementFeatureDescriptionDataType* feature_description
+) {
+  FEATURE_SET_DESCRIPTION(FEATURE_OBJECT(feature), feature_description->description);
+
+  if (feature_description->max_response_delay != NULL) {
+    FEATURE_REMOTE_SET_MAX_RESPONSE_DELAY(
+        feature,
+        (uint32_t)(EebusDurationToSeconds(feature_description->max_response_delay) * 1000)
+    );
+  }
+
+  if (feature_description->supported_function != NULL) {
+    FEATURE_REMOTE_SET_FUNCTION_OPERATIONS(
+        feature,
+        feature_description->supported_function,
+        feature_description->supported_function_size
+    );
+  }
+}
+
 FeatureRemoteObject* FeatureRemoteCreateWithInfo(
     EntityRemoteObject* entity,
     const NodeManagementDetailedDiscoveryFeatureInformationType* feature_info
@@ -365,23 +433,7 @@ FeatureRemoteObject* FeatureRemoteCreateWithInfo(
   const RoleType role = *feature_description->role;
 
   FeatureRemoteObject* const fr = FeatureRemoteCreate(feature_id, entity, feature_type, role);
-  FEATURE_SET_DESCRIPTION(FEATURE_OBJECT(fr), feature_description->description);
-
-  if (feature_description->max_response_delay != NULL) {
-    FEATURE_REMOTE_SET_MAX_RESPONSE_DELAY(
-        fr,
-        (uint32_t)EebusDurationToSeconds(feature_description->max_response_delay)
-    );
-  }
-
-  if (feature_description->supported_function != NULL) {
-    FEATURE_REMOTE_SET_FUNCTION_OPERATIONS(
-        fr,
-        feature_description->supported_function,
-        feature_description->supported_function_size
-    );
-  }
-
+  FeatureRemoteUpdateWithDescription(fr, feature_description);
   return fr;
 }
 
@@ -393,22 +445,111 @@ bool EntityIdsMatch(const EntityAddressType* entity_addr, const FeatureAddressTy
   return EntityAddressMatchIds(entity_addr, feature_addr->entity, feature_addr->entity_size);
 }
 
-void EntityRemoteAddFeaturesWithInfo(
-    EntityRemoteObject* entity,
+bool IsStateChangeRemoved(const NetworkManagementStateChangeType* last_state_change) {
+  return (last_state_change != NULL) && (*last_state_change == kNetworkManagementStateChangeTypeRemoved);
+}
+
+bool IsFeatureListed(
+    const EntityRemoteObject* entity,
+    const FeatureRemoteObject* feature,
     const NodeManagementDetailedDiscoveryFeatureInformationType* const* feature_info,
     size_t feature_info_size
 ) {
+  const EntityAddressType* const entity_addr   = ENTITY_GET_ADDRESS(ENTITY_OBJECT(entity));
+  const FeatureAddressType* const feature_addr = FEATURE_GET_ADDRESS(FEATURE_OBJECT(feature));
+
   for (size_t i = 0; i < feature_info_size; ++i) {
-    const FeatureAddressType* const feature_addr = feature_info[i]->description->feature_address;
-    const EntityAddressType* const entity_addr   = ENTITY_GET_ADDRESS(ENTITY_OBJECT(entity));
+    const NetworkManagementFeatureDescriptionDataType* const description = feature_info[i]->description;
+    if ((description == NULL) || !EntityIdsMatch(entity_addr, description->feature_address)) {
+      continue;
+    }
+
+    if ((description->feature_address->feature != NULL)
+        && (*description->feature_address->feature == *feature_addr->feature)) {
+      return !IsStateChangeRemoved(description->last_state_change);
+    }
+  }
+
+  return false;
+}
 
-    if (EntityIdsMatch(entity_addr, feature_addr)) {
-      FeatureRemoteObject* const fr = FeatureRemoteCreateWithInfo(entity, feature_info[i]);
+void RemoveEntityFeature(DeviceRemote* self, EntityRemoteObject* entity, FeatureRemoteObject* feature) {
+  // Subscriptions and bindings refer to the remote feature directly, so drop them before the feature is released.
+  // The ones of the sibling features stay untouched
+  if (self->local_device != NULL) {
+    SubscriptionManagerObject* const sm = DEVICE_LOCAL_GET_SUBSCRIPTION_MANAGER(self->local_device);
+    SUBSCRIPTION_MANAGER_REMOVE_FEATURE_SUBSCRIPTIONS(sm, feature);
+
+    BindingManagerObject* const bm = DEVICE_LOCAL_GET_BINDING_MANAGER(self->local_device);
+    BINDING_MANAGER_REMOVE_FEATURE_BINDINGS(bm, feature);
+  }
+
+  ENTITY_REMOTE_REMOVE_FEATURE(entity, feature);
+}
+
+bool EntityRemoteSyncFeaturesWithInfo(
+    DeviceRemote* self,
+    EntityRemoteObject* entity,
+    const NodeManagementDetailedDiscoveryFeatureInformationType* const* feature_info,
+    size_t feature_info_size,
+    bool complete
+) {
+  const EntityAddressType* const entity_addr = ENTITY_GET_ADDRESS(ENTITY_OBJECT(entity));
+  bool changed = false;
+
+  // The complete feature list is only known from the reply, notify reports the changed features only
+  if (complete) {
+    const Vector* const features = ENTITY_REMOTE_GET_FEATURES(entity);
+    for (size_t i = VectorGetSize(features); i > 0; --i) {
+      FeatureRemoteObject* const fr = (FeatureRemoteObject*)VectorGetElement(features, i - 1);
+      if (FEATURE_GET_TYPE(FEATURE_OBJECT(fr)) == kFeatureTypeTypeNodeManagement) {
+        continue;
+      }
+
+      if (!IsFeatureListed(entity, fr, feature_info, feature_info_size)) {
+        RemoveEntityFeature(self, entity, fr);
+        changed = true;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < feature_info_size; ++i) {
+    const NetworkManagementFeatureDescriptionDataType* const description = feature_info[i]->description;
+    if ((description == NULL) || !EntityIdsMatch(entity_addr, description->feature_address)) {
+      continue;
+    }
+
+    FeatureRemoteObject* fr = ENTITY_REMOTE_GET_FEATURE_WITH_ID(entity, description->feature_address->feature);
+    if (IsStateChangeRemoved(description->last_state_change)) {
       if (fr != NULL) {
-        ENTITY_REMOTE_ADD_FEATURE(entity, fr);
+        RemoveEntityFeature(self, entity, fr);
+        changed = true;
       }
+
+      continue;
+    }
+
+    // Keep the known feature together with its data, unless it has been replaced by a different one
+    if ((fr != NULL) && (description->feature_type != NULL) && (description->role != NULL)
+        && (FEATURE_GET_TYPE(FEATURE_OBJECT(fr)) == *description->feature_type)
+        && (FEATURE_GET_ROLE(FEATURE_OBJECT(fr)) == *description->role)) {
+      FeatureRemoteUpdateWithDescription(fr, description);
+      continue;
+    }
+
+    if (fr != NULL) {
+      RemoveEntityFeature(self, entity, fr);
     }
+
+    fr = FeatureRemoteCreateWithInfo(entity, feature_info[i]);
+    if (fr != NULL) {
+      ENTITY_REMOTE_ADD_FEATURE(entity, fr);
+    }
+
+    changed = true;
   }
+
+  return changed;
 }
 
 const Vector*
@@ -426,10 +567,21 @@ AddEntityAndFeatures(DeviceRemoteObject* self, bool init, const NodeManagementDe
       return NULL;
     }
 
+    if (IsStateChangeRemoved(ei->description->last_state_change)) {
+      continue;
+    }
+
     const EntityAddressType* const entity_addr = ei->description->entity_address;
 
     EntityRemoteObject* entity = DEVICE_REMOTE_GET_ENTITY(self, entity_addr->entity, entity_addr->entity_size);
-    if (entity == NULL) {
+
+    const bool is_new_entity = (entity == NULL);
+    if (is_new_entity) {
+      // The entity cannot be created without knowing its type
+      if (ei->description->entity_type == NULL) {
+        continue;
+      }
+
       entity = AddEntityWithAddressAndType(dr, entity_addr, *ei->description->entity_type);
       VectorPushBack(new_data, entity);
     }
@@ -444,13 +596,96 @@ AddEntityAndFeatures(DeviceRemoteObject* self, bool init, const NodeManagementDe
     }
 
     ENTITY_SET_DESCRIPTION(ENTITY_OBJECT(entity), ei->description->description);
-    ENTITY_REMOTE_REMOVE_ALL_FEATURES(entity);
-    EntityRemoteAddFeaturesWithInfo(entity, data->feature_information, data->feature_information_size);
+    const bool features_changed = EntityRemoteSyncFeaturesWithInfo(
+        dr, entity, data->feature_information, data->feature_information_size, init);
+
+    // The new entities are announced by the caller together with their features
+    if (!is_new_entity && features_changed) {
+      const EventPayload payload = {
+          .ski         = dr->ski,
+          .event_type  = kEventTypeEntityChange,
+          .change_type = kElementChangeUpdate,
+          .device      = self,
+          .entity      = entity,
+      };
+
+      EventPublish(&payload);
+    }
   }
 
   return new_data;
 }
 
+const NodeManagementDetailedDiscoveryEntityInformationType*
+FindEntityInformation(const NodeManagementDetailedDiscoveryDataType* data, const EntityRemoteObject* entity) {
+  const EntityAddressType* const entity_addr = ENTITY_GET_ADDRESS(ENTITY_OBJECT(entity));
+
+  for (size_t i = 0; i < data->entity_information_size; ++i) {
+    const NetworkManagementEntityDescriptionDataType* const description = data->entity_information[i]->description;
+    if ((description == NULL) || (description->entity_address == NULL)) {
+      continue;
+    }
+
+    const EntityAddressType* const addr = description->entity_address;
+    if (EntityAddressMatchIds(entity_addr, addr->entity, addr->entity_size)) {
+      return data->entity_information[i];
+    }
+  }
+
+  return NULL;
+}
+
+bool IsEntityRemoved(
+    const DeviceRemote* self,
+    bool init,
+    const NodeManagementDetailedDiscoveryDataType* data,
+    const EntityRemoteObject* entity
+) {
+  // The device information entity carries the Node Management and is never removed
+  const EntityAddressType device_info_entity_addr = DeviceInfoEntityAddress(DEVICE_REMOTE_OBJECT(self));
+  if (EntityAddressMatchIds(
+          ENTITY_GET_ADDRESS(ENTITY_OBJECT(entity)),
+          device_info_entity_addr.entity,
+          device_info_entity_addr.entity_size
+      )) {
+    return false;
+  }
+
+  const NodeManagementDetailedDiscoveryEntityInformationType* const ei = FindEntityInformation(data, entity);
+  if (ei == NULL) {
+    // Reply lists all of the entities, notify only the changed ones
+    return init;
+  }
+
+  if (IsStateChangeRemoved(ei->description->last_state_change)) {
+    return true;
+  }
+
+  // The entity with the same address but different type is a new one
+  const EntityTypeType* const entity_type = ei->description->entity_type;
+  return (entity_type != NULL) && (*entity_type != ENTITY_GET_TYPE(ENTITY_OBJECT(entity)));
+}
+
+Vector*
+ReleaseRemovedEntities(DeviceRemoteObject* self, bool init, const NodeManagementDetailedDiscoveryDataType* data) {
+  DeviceRemote* const dr = DEVICE_REMOTE(self);
+
+  Vector* const removed_entities = VectorCreate();
+  if (removed_entities == NULL) {
+    return NULL;
+  }
+
+  for (size_t i = VectorGetSize(&dr->entities); i > 0; --i) {
+    EntityRemoteObject* const entity = (EntityRemoteObject*)VectorGetElement(&dr->entities, i - 1);
+    if (IsEntityRemoved(dr, init, data, entity)) {
+      VectorRemove(&dr->entities, entity);
+      VectorPushBack(removed_entities, entity);
+    }
+  }
+
+  return removed_entities;
+}
+
 EebusError CheckEntityInformation(
     const DeviceRemoteObject* self,
     bool init,
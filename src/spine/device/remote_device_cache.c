@@ -0,0 +1,725 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Remote Device Cache implementation
+ *
+ * Keeps the last detailed discovery, use case and feature description replies
+ * received from each remote device, so that the remote device model can be
+ * restored right after reconnection without waiting for the round trips.
+ * The replies are kept in memory and written out on flush, so that the file
+ * is not rewritten on every reply. The snapshot takes the file contents
+ * over, so that the caller is free to write them without holding its lock.
+ */
+
+#include "src/spine/device/remote_device_cache.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "src/common/api/eebus_data_interface.h"
+#include "src/common/eebus_malloc.h"
+#include "src/common/json.h"
+#include "src/common/string_lut.h"
+#include "src/common/string_util.h"
+#include "src/common/vector.h"
+#include "src/spine/model/feature_types.h"
+#include "src/spine/model/model.h"
+
+typedef struct RemoteDeviceCacheEntry RemoteDeviceCacheEntry;
+
+struct RemoteDeviceCacheEntry {
+  char* ski;
+  /** Replies of the remote device, one per remote feature and function */
+  Vector datagrams;
+  /** Set if the datagrams differ from the file content */
+  bool is_dirty;
+};
+
+typedef struct RemoteDeviceCacheFile RemoteDeviceCacheFile;
+
+struct RemoteDeviceCacheFile {
+  char* path;
+  /** File content, NULL if the file is to be removed */
+  char* content;
+};
+
+struct RemoteDeviceCacheSnapshot {
+  /** Files not written yet, one per remote device */
+  Vector files;
+};
+
+typedef struct RemoteDeviceCache RemoteDeviceCache;
+
+struct RemoteDeviceCache {
+  /** Implements the Remote Device Cache Interface */
+  RemoteDeviceCacheObject obj;
+
+  char* dir;
+  StringLut entries;
+  /** Restored datagrams are applied as replies, those are not saved again */
+  bool is_restoring;
+};
+
+#define REMOTE_DEVICE_CACHE(obj) ((RemoteDeviceCache*)(obj))
+
+static void Destruct(RemoteDeviceCacheObject* self);
+static void Restore(RemoteDeviceCacheObject* self, const char* ski, RemoteDeviceCacheRestoreCallback cb, void* ctx);
+static EebusError Save(RemoteDeviceCacheObject* self, const char* ski, const HeaderType* header, const CmdType* cmd);
+static EebusError Flush(RemoteDeviceCacheObject* self);
+static EebusError TakeSnapshot(RemoteDeviceCacheObject* self, RemoteDeviceCacheSnapshot* snapshot);
+static void Remove(RemoteDeviceCacheObject* self, const char* ski);
+
+static const RemoteDeviceCacheInterface remote_device_cache_methods = {
+    .destruct      = Destruct,
+    .restore       = Restore,
+    .save          = Save,
+    .flush         = Flush,
+    .take_snapshot = TakeSnapshot,
+    .remove        = Remove,
+};
+
+static EebusError RemoteDeviceCacheConstruct(RemoteDeviceCache* self, const char* dir);
+static void DatagramDeallocator(void* datagram);
+static RemoteDeviceCacheEntry* EntryCreate(const char* ski);
+static void EntryDelete(void* entry);
+static const char* GetFilePath(const RemoteDeviceCache* self, const char* ski);
+static char* ReadFile(const char* path);
+static void LoadEntry(const RemoteDeviceCache* self, RemoteDeviceCacheEntry* entry);
+static RemoteDeviceCacheEntry* GetEntry(RemoteDeviceCache* self, const char* ski);
+static bool IsCachedFunction(FunctionType function_type);
+static FunctionType GetDatagramFunctionType(const DatagramType* datagram);
+static DatagramType* FindDatagram(const RemoteDeviceCacheEntry* entry, const DatagramType* datagram);
+static void RestoreDatagrams(
+    RemoteDeviceCacheEntry* entry,
+    bool is_discovery,
+    RemoteDeviceCacheRestoreCallback cb,
+    void* ctx
+);
+static void StringDeallocator(void* s);
+static EebusError PrintDatagrams(const Vector* datagrams, char** content);
+static EebusError WriteFile(const char* path, const char* content);
+static EebusError WriteEntry(const RemoteDeviceCache* self, const RemoteDeviceCacheEntry* entry);
+static void FileDelete(void* file);
+static RemoteDeviceCacheFile* FindFile(const RemoteDeviceCacheSnapshot* snapshot, const char* path);
+static EebusError SnapshotEntry(
+    const RemoteDeviceCache* self,
+    const RemoteDeviceCacheEntry* entry,
+    RemoteDeviceCacheSnapshot* snapshot
+);
+
+EebusError RemoteDeviceCacheConstruct(RemoteDeviceCache* self, const char* dir) {
+  // Override "virtual functions table"
+  REMOTE_DEVICE_CACHE_INTERFACE(self) = &remote_device_cache_methods;
+
+  StringLutInit(&self->entries);
+  self->is_restoring = false;
+
+  self->dir = StringCopy(dir);
+  if (self->dir == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  return kEebusErrorOk;
+}
+
+RemoteDeviceCacheObject* RemoteDeviceCacheCreate(const char* dir) {
+  if (StringIsEmpty(dir)) {
+    return NULL;
+  }
+
+  RemoteDeviceCache* const remote_device_cache = (RemoteDeviceCache*)EEBUS_MALLOC(sizeof(RemoteDeviceCache));
+  if (remote_device_cache == NULL) {
+    return NULL;
+  }
+
+  if (RemoteDeviceCacheConstruct(remote_device_cache, dir) != kEebusErrorOk) {
+    RemoteDeviceCacheDelete(REMOTE_DEVICE_CACHE_OBJECT(remote_device_cache));
+    return NULL;
+  }
+
+  return REMOTE_DEVICE_CACHE_OBJECT(remote_device_cache);
+}
+
+void Destruct(RemoteDeviceCacheObject* self) {
+  RemoteDeviceCache* const rdc = REMOTE_DEVICE_CACHE(self);
+
+  if (rdc->dir != NULL) {
+    Flush(self);
+  }
+
+  StringLutRelease(&rdc->entries);
+
+  StringDelete(rdc->dir);
+  rdc->dir = NULL;
+}
+
+void DatagramDeallocator(void* datagram) {
+  DatagramDelete((DatagramType*)datagram);
+}
+
+RemoteDeviceCacheEntry* EntryCreate(const char* ski) {
+  RemoteDeviceCacheEntry* const entry = (RemoteDeviceCacheEntry*)EEBUS_MALLOC(sizeof(RemoteDeviceCacheEntry));
+  if (entry == NULL) {
+    return NULL;
+  }
+
+  VectorConstructWithDeallocator(&entry->datagrams, DatagramDeallocator);
+  entry->is_dirty = false;
+
+  entry->ski = StringCopy(ski);
+  if (entry->ski == NULL) {
+    EntryDelete(entry);
+    return NULL;
+  }
+
+  return entry;
+}
+
+void EntryDelete(void* entry) {
+  RemoteDeviceCacheEntry* const rdce = (RemoteDeviceCacheEntry*)entry;
+  if (rdce == NULL) {
+    return;
+  }
+
+  VectorFreeElements(&rdce->datagrams);
+  VectorDestruct(&rdce->datagrams);
+  StringDelete(rdce->ski);
+  EEBUS_FREE(rdce);
+}
+
+const char* GetFilePath(const RemoteDeviceCache* self, const char* ski) {
+  if (StringIsEmpty(ski)) {
+    return NULL;
+  }
+
+  return StringFmtSprintf("%s/%s.json", self->dir, ski);
+}
+
+char* ReadFile(const char* path) {
+  FILE* const fp = fopen(path, "rb");
+  if (fp == NULL) {
+    return NULL;
+  }
+
+  char* buf = NULL;
+  if (fseek(fp, 0, SEEK_END) == 0) {
+    const long size = ftell(fp);
+    if ((size > 0) && (fseek(fp, 0, SEEK_SET) == 0)) {
+      buf = (char*)EEBUS_MALLOC((size_t)size + 1);
+    }
+
+    if ((buf != NULL) && (fread(buf, 1, (size_t)size, fp) == (size_t)size)) {
+      buf[size] = '\0';
+    } else {
+      EEBUS_FREE(buf);
+      buf = NULL;
+    }
+  }
+
+  fclose(fp);
+  return buf;
+}
+
+void LoadEntry(const RemoteDeviceCache* self, RemoteDeviceCacheEntry* entry) {
+  const char* const path = GetFilePath(self, entry->ski);
+  if (path == NULL) {
+    return;
+  }
+
+  char* const s = ReadFile(path);
+  StringDelete((char*)path);
+  if (s == NULL) {
+    return;
+  }
+
+  char* p = NULL;
+  for (char* line = StringToken(s, "\n", &p); line != NULL; line = StringToken(NULL, "\n", &p)) {
+    DatagramType* const datagram = DatagramParse(line);
+    if ((datagram != NULL) && IsCachedFunction(GetDatagramFunctionType(datagram))) {
+      VectorPushBack(&entry->datagrams, datagram);
+    } else {
+      // Drop the broken line, the file is rewritten on the next flush
+      DatagramDelete(datagram);
+      entry->is_dirty = true;
+    }
+  }
+
+  EEBUS_FREE(s);
+}
+
+RemoteDeviceCacheEntry* GetEntry(RemoteDeviceCache* self, const char* ski) {
+  RemoteDeviceCacheEntry* entry = (RemoteDeviceCacheEntry*)StringLutFind(&self->entries, ski);
+  if (entry != NULL) {
+    return entry;
+  }
+
+  entry = EntryCreate(ski);
+  if (entry == NULL) {
+    return NULL;
+  }
+
+  LoadEntry(self, entry);
+
+  if (StringLutInsert(&self->entries, ski, entry, EntryDelete) != kEebusErrorOk) {
+    EntryDelete(entry);
+    return NULL;
+  }
+
+  return entry;
+}
+
+bool IsCachedFunction(FunctionType function_type) {
+  switch (function_type) {
+    case kFunctionTypeNodeManagementDetailedDiscoveryData:
+    case kFunctionTypeNodeManagementUseCaseData:
+    case kFunctionTypeBillDescriptionListData:
+    case kFunctionTypeDeviceConfigurationKeyValueDescriptionListData:
+    case kFunctionTypeElectricalConnectionDescriptionListData:
+    case kFunctionTypeElectricalConnectionParameterDescriptionListData:
+    case kFunctionTypeHvacOperationModeDescriptionListData:
+    case kFunctionTypeHvacOverrunDescriptionListData:
+    case kFunctionTypeHvacSystemFunctionDescriptionListData:
+    case kFunctionTypeIncentiveDescriptionListData:
+    case kFunctionTypeLoadControlLimitDescriptionListData:
+    case kFunctionTypeMeasurementDescriptionListData:
+    case kFunctionTypeOperatingConstraintsPowerDescriptionListData:
+    case kFunctionTypePowerSequenceDescriptionListData:
+    case kFunctionTypeSetpointDescriptionListData:
+    case kFunctionTypeSupplyConditionDescriptionListData:
+    case kFunctionTypeTariffDescriptionListData:
+    case kFunctionTypeTaskManagementJobDescriptionListData:
+    case kFunctionTypeThresholdDescriptionListData:
+    case kFunctionTypeTierBoundaryDescriptionListData:
+    case kFunctionTypeTierDescriptionListData:
+    case kFunctionTypeTimeSeriesDescriptionListData:
+    case kFunctionTypeTimeTableDescriptionListData: return true;
+    default: return false;
+  }
+}
+
+FunctionType GetDatagramFunctionType(const DatagramType* datagram) {
+  if ((datagram->payload == NULL) || (datagram->payload->cmd_size != 1) || (datagram->payload->cmd[0] == NULL)) {
+    return kFunctionTypeNum;
+  }
+
+  return datagram->payload->cmd[0]->data_choice_type_id;
+}
+
+DatagramType* FindDatagram(const RemoteDeviceCacheEntry* entry, const DatagramType* datagram) {
+  const FunctionType function_type = GetDatagramFunctionType(datagram);
+
+  for (size_t i = 0; i < VectorGetSize(&entry->datagrams); ++i) {
+    DatagramType* const stored = (DatagramType*)VectorGetElement(&entry->datagrams, i);
+    if ((GetDatagramFunctionType(stored) == function_type)
+        && FeatureAddressCompare(stored->header->src_addr, datagram->header->src_addr)) {
+      return stored;
+    }
+  }
+
+  return NULL;
+}
+
+void RestoreDatagrams(
+    RemoteDeviceCacheEntry* entry,
+    bool is_discovery,
+    RemoteDeviceCacheRestoreCallback cb,
+    void* ctx
+) {
+  size_t i = 0;
+  while (i < VectorGetSize(&entry->datagrams)) {
+    DatagramType* const datagram = (DatagramType*)VectorGetElement(&entry->datagrams, i);
+
+    const FunctionType function_type = GetDatagramFunctionType(datagram);
+    if ((function_type == kFunctionTypeNodeManagementDetailedDiscoveryData) != is_discovery) {
+      ++i;
+    } else if (cb(datagram, ctx)) {
+      ++i;
+    } else {
+      VectorRemove(&entry->datagrams, datagram);
+      DatagramDelete(datagram);
+      entry->is_dirty = true;
+    }
+  }
+}
+
+void Restore(RemoteDeviceCacheObject* self, const char* ski, RemoteDeviceCacheRestoreCallback cb, void* ctx) {
+  RemoteDeviceCache* const rdc = REMOTE_DEVICE_CACHE(self);
+
+  if (StringIsEmpty(ski) || (cb == NULL)) {
+    return;
+  }
+
+  RemoteDeviceCacheEntry* const entry = GetEntry(rdc, ski);
+  if (entry == NULL) {
+    return;
+  }
+
+  // The features the other replies come from are known after the detailed discovery only
+  rdc->is_restoring = true;
+  RestoreDatagrams(entry, true, cb, ctx);
+  RestoreDatagrams(entry, false, cb, ctx);
+  rdc->is_restoring = false;
+}
+
+EebusError Save(RemoteDeviceCacheObject* self, const char* ski, const HeaderType* header, const CmdType* cmd) {
+  RemoteDeviceCache* const rdc = REMOTE_DEVICE_CACHE(self);
+
+  if ((header == NULL) || (cmd == NULL) || (cmd->data_choice == NULL)) {
+    return kEebusErrorInputArgumentNull;
+  }
+
+  if (StringIsEmpty(ski) || (header->src_addr == NULL) || (header->dest_addr == NULL)) {
+    return kEebusErrorInputArgument;
+  }
+
+  // Partial data can not be restored without the data it was applied to
+  if (rdc->is_restoring || (cmd->filter_size != 0) || !IsCachedFunction(cmd->data_choice_type_id)) {
+    return kEebusErrorNoChange;
+  }
+
+  // Keep the addresses and the data only, the message counters are meaningless for the next connection
+  static const CommandClassifierType cmd_classifier = kCommandClassifierTypeReply;
+
+  const CmdType* const cmds[1] = {cmd};
+
+  const HeaderType reply_header = {
+      .spec_version   = header->spec_version,
+      .src_addr       = header->src_addr,
+      .dest_addr      = header->dest_addr,
+      .cmd_classifier = &cmd_classifier,
+  };
+
+  const PayloadType payload = {
+      .cmd      = cmds,
+      .cmd_size = 1,
+  };
+
+  const DatagramType datagram = {
+      .header  = &reply_header,
+      .payload = &payload,
+  };
+
+  RemoteDeviceCacheEntry* const entry = GetEntry(rdc, ski);
+  if (entry == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  const EebusDataCfg* const cfg     = ModelGetDatagramCfg();
+  const DatagramType* const new_ptr = &datagram;
+
+  DatagramType* const stored = FindDatagram(entry, &datagram);
+  if ((stored != NULL) && EEBUS_DATA_COMPARE(cfg, &stored, cfg, &new_ptr)) {
+    return kEebusErrorNoChange;
+  }
+
+  DatagramType* const datagram_copy = DatagramCopy(&datagram);
+  if (datagram_copy == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  if (stored != NULL) {
+    VectorRemove(&entry->datagrams, stored);
+    DatagramDelete(stored);
+  }
+
+  VectorPushBack(&entry->datagrams, datagram_copy);
+  entry->is_dirty = true;
+  return kEebusErrorOk;
+}
+
+void StringDeallocator(void* s) {
+  JsonFree((char*)s);
+}
+
+EebusError PrintDatagrams(const Vector* datagrams, char** content) {
+  *content = NULL;
+  if (VectorGetSize(datagrams) == 0) {
+    return kEebusErrorOk;
+  }
+
+  Vector lines;
+  VectorConstructWithDeallocator(&lines, StringDeallocator);
+
+  EebusError err = kEebusErrorOk;
+  size_t size    = 0;
+  for (size_t i = 0; i < VectorGetSize(datagrams); ++i) {
+    char* const s = DatagramPrintUnformatted((const DatagramType*)VectorGetElement(datagrams, i));
+    if (s == NULL) {
+      err = kEebusErrorMemoryAllocate;
+      break;
+    }
+
+    VectorPushBack(&lines, s);
+    size += strlen(s) + 1;
+  }
+
+  if (err == kEebusErrorOk) {
+    *content = (char*)EEBUS_MALLOC(size + 1);
+    if (*content == NULL) {
+      err = kEebusErrorMemoryAllocate;
+    }
+  }
+
+  if (err == kEebusErrorOk) {
+    // The unformatted JSON has no line breaks, so each datagram takes a single line
+    char* p = *content;
+    for (size_t i = 0; i < VectorGetSize(&lines); ++i) {
+      const char* const s = (const char*)VectorGetElement(&lines, i);
+      const size_t s_size = strlen(s);
+      memcpy(p, s, s_size);
+      p[s_size] = '\n';
+      p += s_size + 1;
+    }
+
+    *p = '\0';
+  }
+
+  VectorFreeElements(&lines);
+  VectorDestruct(&lines);
+  return err;
+}
+
+EebusError WriteFile(const char* path, const char* content) {
+  if (content == NULL) {
+    remove(path);
+    return kEebusErrorOk;
+  }
+
+  const char* const tmp_path = StringFmtSprintf("%s.tmp", path);
+  if (tmp_path == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  // Write the complete content aside and replace the file at once,
+  // so that the interrupted write never leaves a truncated cache behind
+  EebusError err = kEebusErrorFileSystemAccess;
+
+  FILE* const fp = fopen(tmp_path, "wb");
+  if (fp != NULL) {
+    const size_t size = strlen(content);
+    err               = (fwrite(content, 1, size, fp) == size) ? kEebusErrorOk : kEebusErrorFileSystem;
+    if ((fclose(fp) != 0) && (err == kEebusErrorOk)) {
+      err = kEebusErrorFileSystem;
+    }
+  }
+
+  if ((err == kEebusErrorOk) && (rename(tmp_path, path) != 0)) {
+    // rename() does not replace the existing file on some platforms (e.g. Windows)
+    remove(path);
+    if (rename(tmp_path, path) != 0) {
+      err = kEebusErrorFileSystem;
+    }
+  }
+
+  if (err != kEebusErrorOk) {
+    remove(tmp_path);
+  }
+
+  StringDelete((char*)tmp_path);
+  return err;
+}
+
+EebusError WriteEntry(const RemoteDeviceCache* self, const RemoteDeviceCacheEntry* entry) {
+  const char* const path = GetFilePath(self, entry->ski);
+  if (path == NULL) {
+    return kEebusErrorInputArgument;
+  }
+
+  char* content  = NULL;
+  EebusError err = PrintDatagrams(&entry->datagrams, &content);
+  if (err == kEebusErrorOk) {
+    err = WriteFile(path, content);
+  }
+
+  EEBUS_FREE(content);
+  StringDelete((char*)path);
+  return err;
+}
+
+EebusError Flush(RemoteDeviceCacheObject* self) {
+  RemoteDeviceCache* const rdc = REMOTE_DEVICE_CACHE(self);
+
+  EebusError ret = kEebusErrorNoChange;
+  for (size_t i = 0; i < StringLutGetSize(&rdc->entries); ++i) {
+    RemoteDeviceCacheEntry* const entry = (RemoteDeviceCacheEntry*)StringLutGetElementValue(&rdc->entries, i);
+    if (!entry->is_dirty) {
+      continue;
+    }
+
+    // The entry is kept dirty on failure, the write is retried on the next flush
+    const EebusError err = WriteEntry(rdc, entry);
+    if (err != kEebusErrorOk) {
+      ret = err;
+    } else {
+      entry->is_dirty = false;
+      if (ret == kEebusErrorNoChange) {
+        ret = kEebusErrorOk;
+      }
+    }
+  }
+
+  return ret;
+}
+
+void FileDelete(void* file) {
+  RemoteDeviceCacheFile* const rdcf = (RemoteDeviceCacheFile*)file;
+  if (rdcf == NULL) {
+    return;
+  }
+
+  EEBUS_FREE(rdcf->content);
+  StringDelete(rdcf->path);
+  EEBUS_FREE(rdcf);
+}
+
+RemoteDeviceCacheFile* FindFile(const RemoteDeviceCacheSnapshot* snapshot, const char* path) {
+  for (size_t i = 0; i < VectorGetSize(&snapshot->files); ++i) {
+    RemoteDeviceCacheFile* const file = (RemoteDeviceCacheFile*)VectorGetElement(&snapshot->files, i);
+    if (!strcmp(file->path, path)) {
+      return file;
+    }
+  }
+
+  return NULL;
+}
+
+EebusError SnapshotEntry(
+    const RemoteDeviceCache* self,
+    const RemoteDeviceCacheEntry* entry,
+    RemoteDeviceCacheSnapshot* snapshot
+) {
+  char* const path = (char*)GetFilePath(self, entry->ski);
+  if (path == NULL) {
+    return kEebusErrorInputArgument;
+  }
+
+  char* content        = NULL;
+  const EebusError err = PrintDatagrams(&entry->datagrams, &content);
+  if (err != kEebusErrorOk) {
+    StringDelete(path);
+    return err;
+  }
+
+  // The content not written yet is outdated, replace it
+  RemoteDeviceCacheFile* file = FindFile(snapshot, path);
+  if (file != NULL) {
+    StringDelete(path);
+    EEBUS_FREE(file->content);
+    file->content = content;
+    return kEebusErrorOk;
+  }
+
+  file = (RemoteDeviceCacheFile*)EEBUS_MALLOC(sizeof(RemoteDeviceCacheFile));
+  if (file == NULL) {
+    EEBUS_FREE(content);
+    StringDelete(path);
+    return kEebusErrorMemoryAllocate;
+  }
+
+  file->path    = path;
+  file->content = content;
+  VectorPushBack(&snapshot->files, file);
+  return kEebusErrorOk;
+}
+
+EebusError TakeSnapshot(RemoteDeviceCacheObject* self, RemoteDeviceCacheSnapshot* snapshot) {
+  RemoteDeviceCache* const rdc = REMOTE_DEVICE_CACHE(self);
+
+  if (snapshot == NULL) {
+    return kEebusErrorInputArgumentNull;
+  }
+
+  EebusError ret = kEebusErrorNoChange;
+  for (size_t i = 0; i < StringLutGetSize(&rdc->entries); ++i) {
+    RemoteDeviceCacheEntry* const entry = (RemoteDeviceCacheEntry*)StringLutGetElementValue(&rdc->entries, i);
+    if (!entry->is_dirty) {
+      continue;
+    }
+
+    // The entry is kept dirty on failure, it is taken again with the next snapshot
+    const EebusError err = SnapshotEntry(rdc, entry, snapshot);
+    if (err != kEebusErrorOk) {
+      ret = err;
+    } else {
+      entry->is_dirty = false;
+      if (ret == kEebusErrorNoChange) {
+        ret = kEebusErrorOk;
+      }
+    }
+  }
+
+  return ret;
+}
+
+RemoteDeviceCacheSnapshot* RemoteDeviceCacheSnapshotCreate(void) {
+  RemoteDeviceCacheSnapshot* const snapshot
+      = (RemoteDeviceCacheSnapshot*)EEBUS_MALLOC(sizeof(RemoteDeviceCacheSnapshot));
+  if (snapshot == NULL) {
+    return NULL;
+  }
+
+  VectorConstructWithDeallocator(&snapshot->files, FileDelete);
+  return snapshot;
+}
+
+void RemoteDeviceCacheSnapshotDelete(RemoteDeviceCacheSnapshot* snapshot) {
+  if (snapshot == NULL) {
+    return;
+  }
+
+  VectorFreeElements(&snapshot->files);
+  VectorDestruct(&snapshot->files);
+  EEBUS_FREE(snapshot);
+}
+
+EebusError RemoteDeviceCacheSnapshotWrite(RemoteDeviceCacheSnapshot* snapshot) {
+  if (snapshot == NULL) {
+    return kEebusErrorInputArgumentNull;
+  }
+
+  EebusError ret = (VectorGetSize(&snapshot->files) == 0) ? kEebusErrorNoChange : kEebusErrorOk;
+
+  size_t i = 0;
+  while (i < VectorGetSize(&snapshot->files)) {
+    RemoteDeviceCacheFile* const file = (RemoteDeviceCacheFile*)VectorGetElement(&snapshot->files, i);
+
+    // The file is kept on failure, the write is retried on the next snapshot write
+    const EebusError err = WriteFile(file->path, file->content);
+    if (err != kEebusErrorOk) {
+      ret = err;
+      ++i;
+    } else {
+      VectorRemove(&snapshot->files, file);
+      FileDelete(file);
+    }
+  }
+
+  return ret;
+}
+
+void Remove(RemoteDeviceCacheObject* self, const char* ski) {
+  RemoteDeviceCache* const rdc = REMOTE_DEVICE_CACHE(self);
+
+  const char* const path = GetFilePath(rdc, ski);
+  if (path != NULL) {
+    remove(path);
+    StringDelete((char*)path);
+  }
+
+  StringLutRemove(&rdc->entries, ski);
+}
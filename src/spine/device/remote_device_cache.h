@@ -0,0 +1,73 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Remote Device Cache implementation declarations
+ */
+
+#ifndef SRC_SPINE_DEVICE_REMOTE_DEVICE_CACHE_H_
+#define SRC_SPINE_DEVICE_REMOTE_DEVICE_CACHE_H_
+
+#include "src/common/eebus_malloc.h"
+#include "src/spine/api/remote_device_cache_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Create the file based remote device cache.
+ * The detailed discovery, use case and feature description replies of each remote device
+ * are stored in the library JSON representation as "<dir>/<ski>.json", one datagram per line.
+ * The file is replaced on flush only and only if the data has changed
+ * @param dir Existing directory to keep the cache files in
+ * @return Remote device cache object on success, NULL otherwise
+ */
+RemoteDeviceCacheObject* RemoteDeviceCacheCreate(const char* dir);
+
+static inline void RemoteDeviceCacheDelete(RemoteDeviceCacheObject* remote_device_cache) {
+  if (remote_device_cache != NULL) {
+    REMOTE_DEVICE_CACHE_DESTRUCT(remote_device_cache);
+    EEBUS_FREE(remote_device_cache);
+  }
+}
+
+/**
+ * @brief Create the empty remote device cache snapshot
+ * @return Snapshot on success, NULL otherwise
+ */
+RemoteDeviceCacheSnapshot* RemoteDeviceCacheSnapshotCreate(void);
+
+/**
+ * @brief Delete the snapshot, the files not written yet are dropped
+ * @param snapshot Snapshot to be deleted
+ */
+void RemoteDeviceCacheSnapshotDelete(RemoteDeviceCacheSnapshot* snapshot);
+
+/**
+ * @brief Write out the files of the snapshot. The snapshot is independent of the cache,
+ * so no lock is needed as long as the snapshot is accessed by a single thread.
+ * The written files are dropped from the snapshot, the failed ones are kept for the next write
+ * @param snapshot Snapshot to be written
+ * @return kEebusErrorOk on success, kEebusErrorNoChange if there is nothing to write, error code otherwise
+ */
+EebusError RemoteDeviceCacheSnapshotWrite(RemoteDeviceCacheSnapshot* snapshot);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_SPINE_DEVICE_REMOTE_DEVICE_CACHE_H_
@@ -63,7 +63,8 @@ static EebusError Read(
     SenderObject* self,
     const FeatureAddressType* sender_addr,
     const FeatureAddressType* dest_addr,
-    const CmdType* cmd
+    const CmdType* cmd,
+    MsgCounterType* msg_cnt
 );
 static EebusError
 Reply(SenderObject* self, const HeaderType* request_header, const FeatureAddressType* sender_addr, const CmdType* cmd);
@@ -77,7 +78,8 @@ static EebusError Write(
     SenderObject* self,
     const FeatureAddressType* sender_addr,
     const FeatureAddressType* dest_addr,
-    const CmdType* cmd
+    const CmdType* cmd,
+    MsgCounterType* msg_cnt
 );
 static EebusError CallSubscribe(
     SenderObject* self,
@@ -127,9 +129,11 @@ static EebusError SendSpineMessage(
     const uint64_t* msg_counter_ref,
     bool request_ack,
     const CmdType* cmd,
-    size_t cmd_size
+    size_t cmd_size,
+    MsgCounterType* msg_cnt
 );
 static uint64_t SenderGetNextMsgCounter(Sender* self);
+static MessagePriority SenderGetMessagePriority(CommandClassifierType cmd_classifier, const CmdType* cmd);
 static FeatureAddressType NodeManagementAddress(const char* device_addr);
 static EebusError SendNodeManagmentCall(
     Sender* self,
@@ -161,6 +165,19 @@ void Destruct(SenderObject* self) {
   // Nothing to be deallocated yet
 }
 
+MessagePriority SenderGetMessagePriority(CommandClassifierType cmd_classifier, const CmdType* cmd) {
+  // Writes, replies and notifies carry the feature state, reordering them could leave the peer with a stale state
+  switch (cmd_classifier) {
+    case kCommandClassifierTypeResult: return kMessagePriorityResult;
+    case kCommandClassifierTypeNotify: {
+      // Missed heartbeats make the remote drop the connection
+      const bool is_heartbeat = (cmd->data_choice_type_id == kFunctionTypeDeviceDiagnosisHeartbeatData);
+      return is_heartbeat ? kMessagePriorityResult : kMessagePriorityData;
+    }
+    default: return kMessagePriorityData;
+  }
+}
+
 EebusError SendSpineMessage(
     Sender* self,
     CommandClassifierType cmd_classifier,
@@ -169,7 +186,8 @@ EebusError SendSpineMessage(
     const uint64_t* msg_counter_ref,
     bool request_ack,
     const CmdType* cmd,
-    size_t cmd_size
+    size_t cmd_size,
+    MsgCounterType* msg_cnt
 ) {
   if ((src_addr == NULL) || (dst_addr == NULL) || (cmd == NULL) || (cmd_size == 0)) {
     return kEebusErrorInputArgumentNull;
@@ -209,18 +227,38 @@ EebusError SendSpineMessage(
       },
   };
 
-  const char* const msg = DatagramPrintUnformatted(&datagram);
+  // CBOR is used only if both of the peers agreed on it during the SHIP handshake
+  size_t msg_size = 0;
+  uint8_t* msg    = NULL;
+  if (DATA_WRITER_GET_FORMAT(self->writer) == kMessageProtocolFormatTypeCbor) {
+    msg = DatagramPrintCbor(&datagram, &msg_size);
+    SENDER_DEBUG_PRINTF("%s: sending %zu bytes of CBOR\n", __func__, msg_size);
+  } else {
+    msg      = (uint8_t*)DatagramPrintUnformatted(&datagram);
+    msg_size = (msg != NULL) ? strlen((const char*)msg) + 1 : 0;
+    SENDER_DEBUG_PRINTF("%s: sending %s\n", __func__, (const char*)msg);
+  }
+
   if (msg == NULL) {
     EEBUS_FREE(p_cmd);
     return kEebusErrorMemoryAllocate;
   }
 
-  SENDER_DEBUG_PRINTF("%s: sending %s\n", __func__, msg);
-
-  DATA_WRITER_WRITE_MESSAGE(self->writer, (uint8_t*)msg, strlen(msg) + 1);
-  JsonFree((void*)msg);
+  // Busy connection is reported to the caller rather than the message being silently lost
+  const MessagePriority priority = SenderGetMessagePriority(cmd_classifier, &cmd[0]);
+  const EebusError err           = DATA_WRITER_WRITE_MESSAGE(self->writer, msg, msg_size, priority);
+  JsonFree(msg);
   EEBUS_FREE(p_cmd);
 
+  if (err != kEebusErrorOk) {
+    SENDER_DEBUG_PRINTF("%s: sending failed, error %d\n", __func__, err);
+    return err;
+  }
+
+  if (msg_cnt != NULL) {
+    *msg_cnt = msg_counter;
+  }
+
   return kEebusErrorOk;
 }
 
@@ -238,9 +276,20 @@ EebusError Read(
     SenderObject* self,
     const FeatureAddressType* sender_addr,
     const FeatureAddressType* dest_addr,
-    const CmdType* cmd
+    const CmdType* cmd,
+    MsgCounterType* msg_cnt
 ) {
-  return SendSpineMessage(SENDER(self), kCommandClassifierTypeRead, sender_addr, dest_addr, NULL, false, cmd, 1);
+  return SendSpineMessage(
+      SENDER(self),
+      kCommandClassifierTypeRead,
+      sender_addr,
+      dest_addr,
+      NULL,
+      false,
+      cmd,
+      1,
+      msg_cnt
+  );
 }
 
 EebusError
@@ -265,7 +314,8 @@ Reply(SenderObject* self, const HeaderType* request_header, const FeatureAddress
       request_header->msg_cnt,
       false,
       cmd,
-      1
+      1,
+      NULL
   );
 }
 
@@ -275,16 +325,37 @@ EebusError Notify(
     const FeatureAddressType* dest_addr,
     const CmdType* cmd
 ) {
-  return SendSpineMessage(SENDER(self), kCommandClassifierTypeNotify, sender_addr, dest_addr, NULL, false, cmd, 1);
+  return SendSpineMessage(
+      SENDER(self),
+      kCommandClassifierTypeNotify,
+      sender_addr,
+      dest_addr,
+      NULL,
+      false,
+      cmd,
+      1,
+      NULL
+  );
 }
 
 EebusError Write(
     SenderObject* self,
     const FeatureAddressType* sender_addr,
     const FeatureAddressType* dest_addr,
-    const CmdType* cmd
+    const CmdType* cmd,
+    MsgCounterType* msg_cnt
 ) {
-  return SendSpineMessage(SENDER(self), kCommandClassifierTypeWrite, sender_addr, dest_addr, NULL, true, cmd, 1);
+  return SendSpineMessage(
+      SENDER(self),
+      kCommandClassifierTypeWrite,
+      sender_addr,
+      dest_addr,
+      NULL,
+      true,
+      cmd,
+      1,
+      msg_cnt
+  );
 }
 
 FeatureAddressType NodeManagementAddress(const char* device_addr) {
@@ -316,7 +387,7 @@ EebusError SendNodeManagmentCall(
   const FeatureAddressType local_addr  = NodeManagementAddress(local_device);
   const FeatureAddressType remote_addr = NodeManagementAddress(remote_device);
 
-  return SendSpineMessage(self, kCommandClassifierTypeCall, &local_addr, &remote_addr, NULL, true, &cmd, 1);
+  return SendSpineMessage(self, kCommandClassifierTypeCall, &local_addr, &remote_addr, NULL, true, &cmd, 1, NULL);
 }
 
 EebusError CallSubscribe(
@@ -458,7 +529,8 @@ EebusError SendResult(
       request_header->msg_cnt,
       false,
       &cmd,
-      1
+      1,
+      NULL
   );
 }
 
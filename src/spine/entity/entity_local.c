@@ -28,6 +28,7 @@
 #include "src/spine/heartbeat/heartbeat_manager.h"
 #include "src/spine/model/model.h"
 #include "src/spine/model/node_management_types.h"
+#include "src/spine/node_management/node_management.h"
 
 typedef struct EntityLocal EntityLocal;
 
@@ -43,6 +44,8 @@ struct EntityLocal {
 #define ENTITY_LOCAL(obj) ((EntityLocal*)(obj))
 
 static void Destruct(EntityObject* self);
+static void SetDescription(EntityObject* self, const char* description);
+static void InvalidateDetailedDiscoveryData(const EntityLocal* self);
 static DeviceLocalObject* GetDevice(const EntityLocalObject* self);
 static HeartbeatManagerObject* GetHeartbeatManager(const EntityLocalObject* self);
 static void AddFeature(EntityLocalObject* self, FeatureLocalObject* feature);
@@ -70,7 +73,7 @@ static const EntityLocalInterface entity_local_methods = {
         .get_address         = EntityGetAddress,
         .get_type            = EntityGetType,
         .get_description     = EntityGetDescription,
-        .set_description     = EntitySetDescription,
+        .set_description     = SetDescription,
         .get_next_feature_id = EntityGetNextFeatureId,
     },
 
@@ -139,6 +142,15 @@ void Destruct(EntityObject* self) {
   EntityDestruct(self);
 }
 
+void SetDescription(EntityObject* self, const char* description) {
+  EntitySetDescription(self, description);
+  InvalidateDetailedDiscoveryData(ENTITY_LOCAL(self));
+}
+
+void InvalidateDetailedDiscoveryData(const EntityLocal* self) {
+  NodeManagementInvalidateDetailedDiscoveryData(DEVICE_LOCAL_GET_NODE_MANAGEMENT(self->device));
+}
+
 DeviceLocalObject* GetDevice(const EntityLocalObject* self) { return ENTITY_LOCAL(self)->device; }
 
 HeartbeatManagerObject* GetHeartbeatManager(const EntityLocalObject* self) {
@@ -148,6 +160,7 @@ HeartbeatManagerObject* GetHeartbeatManager(const EntityLocalObject* self) {
 void AddFeature(EntityLocalObject* self, FeatureLocalObject* feature) {
   EntityLocal* const enl = ENTITY_LOCAL(self);
   VectorPushBack(&enl->features, feature);
+  InvalidateDetailedDiscoveryData(enl);
 }
 
 FeatureLocalObject* GetFeatureWithTypeAndRole(
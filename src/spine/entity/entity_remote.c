@@ -41,6 +41,7 @@ static void Destruct(EntityObject* self);
 static DeviceRemoteObject* GetDevice(const EntityRemoteObject* self);
 static void UpdateDeviceAddress(EntityRemoteObject* self, const char* device_addr);
 static void AddFeature(EntityRemoteObject* self, FeatureRemoteObject* feature);
+static void RemoveFeature(EntityRemoteObject* self, FeatureRemoteObject* feature);
 static void RemoveAllFeatures(EntityRemoteObject* self);
 static FeatureRemoteObject* GetFeatureWithTypeAndRole(
     const EntityRemoteObject* self, FeatureTypeType feature_type, RoleType role);
@@ -60,6 +61,7 @@ static const EntityRemoteInterface entity_remote_methods = {
     .get_device                     = GetDevice,
     .update_device_address          = UpdateDeviceAddress,
     .add_feature                    = AddFeature,
+    .remove_feature                 = RemoveFeature,
     .remove_all_features            = RemoveAllFeatures,
     .get_feature_with_type_and_role = GetFeatureWithTypeAndRole,
     .get_feature_with_id            = GetFeatureWithId,
@@ -109,6 +111,13 @@ void AddFeature(EntityRemoteObject* self, FeatureRemoteObject* feature) {
   VectorPushBack(&enr->features, feature);
 }
 
+void RemoveFeature(EntityRemoteObject* self, FeatureRemoteObject* feature) {
+  EntityRemote* const enr = ENTITY_REMOTE(self);
+
+  VectorRemove(&enr->features, feature);
+  FeatureRemoteDelete(feature);
+}
+
 void RemoveAllFeatures(EntityRemoteObject* self) {
   EntityRemote* const enr = ENTITY_REMOTE(self);
 
@@ -19,19 +19,38 @@
  */
 
 #include <string.h>
+
+#include "src/common/debug.h"
 #include "src/common/eebus_malloc.h"
 #include "src/common/uint64_lut.h"
 #include "src/spine/api/device_local_interface.h"
+#include "src/spine/api/device_remote_interface.h"
 #include "src/spine/api/message.h"
+#include "src/spine/api/pending_requests_interface.h"
 #include "src/spine/events/events.h"
 #include "src/spine/feature/feature.h"
 #include "src/spine/feature/feature_local_internal.h"
 #include "src/spine/model/cmd.h"
 #include "src/spine/model/result_types.h"
+#include "src/spine/node_management/node_management.h"
+
+/** Set FEATURE_LOCAL_DEBUG 1 to enable debug prints */
+#ifndef FEATURE_LOCAL_DEBUG
+#define FEATURE_LOCAL_DEBUG 0
+#endif
+
+/** Feature Local debug printf(), enabled with FEATURE_LOCAL_DEBUG = 1 */
+#if FEATURE_LOCAL_DEBUG
+#define FEATURE_LOCAL_DEBUG_PRINTF(fmt, ...) DebugPrintf(fmt, ##__VA_ARGS__)
+#else
+#define FEATURE_LOCAL_DEBUG_PRINTF(fmt, ...)
+#endif  // FEATURE_LOCAL_DEBUG
 
 typedef struct ReponseMessageCbRecord ReponseMessageCbRecord;
 
 struct ReponseMessageCbRecord {
+  /** Remote device the request has been sent to, NULL for the result callbacks */
+  const DeviceRemoteObject* remote_device;
   ResponseMessageCallback cb;
   void* ctx;
 };
@@ -44,6 +63,7 @@ struct WriteApprovalCbRecord {
 };
 
 static EebusError HandleMessage(FeatureLocalObject* self, const Message* msg);
+static void InvalidateDetailedDiscoveryData(const FeatureLocal* self);
 
 static const FeatureLocalInterface feature_local_methods = {
      .feature_interface = {
@@ -53,7 +73,7 @@ static const FeatureLocalInterface feature_local_methods = {
          .get_role                = FeatureGetRole,
          .get_function_operations = FeatureGetFunctionOperations,
          .get_description         = FeatureGetDescription,
-         .set_description         = FeatureSetDescription,
+         .set_description         = FeatureLocalSetDescription,
          .to_string               = FeatureToString,
      },
  
@@ -71,6 +91,7 @@ static const FeatureLocalInterface feature_local_methods = {
      .set_data                              = FeatureLocalSetData,
      .request_remote_data                   = FeatureLocalRequestRemoteData,
      .request_remote_data_by_sender_address = FeatureLocalRequestRemoteDataBySenderAddress,
+     .add_pending_request                   = FeatureLocalAddPendingRequest,
      .has_subscription_to_remote            = FeatureLocalHasSubscriptionToRemote,
      .subscribe_to_remote                   = FeatureLocalSubscribeToRemote,
      .remove_remote_subscription            = FeatureLocalRemoveRemoteSubscription,
@@ -93,9 +114,11 @@ static void PublishDataUpdateEvent(
     CommandClassifierType cmd_classifier
 );
 static EebusError ProcessNotify(FeatureLocal* self, const Message* msg);
+static EebusError SendResult(FeatureLocal* self, const Message* msg, EebusError err);
 static EebusError ProcessWriteInternal(FeatureLocal* self, const Message* msg);
 static EebusError ProcessWrite(FeatureLocal* self, const Message* msg);
 static EebusError ProcessReply(FeatureLocal* self, const Message* msg);
+static void ProcessResponseTimeout(DeviceRemoteObject* remote_device, MsgCounterType msg_cnt, void* ctx);
 
 void FeatureLocalConstruct(
     FeatureLocal* self,
@@ -151,6 +174,17 @@ EntityLocalObject* FeatureLocalGetEntity(const FeatureLocalObject* self) {
   return FEATURE_LOCAL(self)->entity;
 }
 
+void InvalidateDetailedDiscoveryData(const FeatureLocal* self) {
+  // Node management is NULL while the device information entity is set up
+  DeviceLocalObject* const device = ENTITY_LOCAL_GET_DEVICE(self->entity);
+  NodeManagementInvalidateDetailedDiscoveryData(DEVICE_LOCAL_GET_NODE_MANAGEMENT(device));
+}
+
+void FeatureLocalSetDescription(FeatureObject* self, const char* description) {
+  FeatureSetDescription(self, description);
+  InvalidateDetailedDiscoveryData(FEATURE_LOCAL(self));
+}
+
 const void* FeatureLocalGetData(const FeatureLocalObject* self, FunctionType function_type) {
   const FunctionObject* const function = FeatureGetFunction(FEATURE(self), function_type);
   if (function == NULL) {
@@ -174,6 +208,7 @@ void FeatureLocalSetFunctionOperations(FeatureLocalObject* self, FunctionType ty
 
   // Partial reads are currently not supported
   FUNCTION_SET_OPERATIONS(function, read, false, write, true);
+  InvalidateDetailedDiscoveryData(FEATURE_LOCAL(self));
 
   if ((feature->role == kRoleTypeServer) && (feature->type == kFeatureTypeTypeDeviceDiagnosis)
       && (type == kFunctionTypeDeviceDiagnosisHeartbeatData)) {
@@ -184,11 +219,13 @@ void FeatureLocalSetFunctionOperations(FeatureLocalObject* self, FunctionType ty
   }
 }
 
-ReponseMessageCbRecord* ReponseMessageCbRecordCreate(ResponseMessageCallback cb, void* ctx) {
+ReponseMessageCbRecord*
+ReponseMessageCbRecordCreate(const DeviceRemoteObject* remote_device, ResponseMessageCallback cb, void* ctx) {
   ReponseMessageCbRecord* const resp_msg_record = (ReponseMessageCbRecord*)EEBUS_MALLOC(sizeof(ReponseMessageCbRecord));
   if (resp_msg_record != NULL) {
-    resp_msg_record->cb  = cb;
-    resp_msg_record->ctx = ctx;
+    resp_msg_record->remote_device = remote_device;
+    resp_msg_record->cb            = cb;
+    resp_msg_record->ctx           = ctx;
   }
 
   return resp_msg_record;
@@ -207,6 +244,7 @@ void ReponseMessageContainerDelete(void* p) {
 
 EebusError FeatureLocalAddResponseCallback(
     FeatureLocalObject* self,
+    const DeviceRemoteObject* remote_device,
     MsgCounterType msg_counter_ref,
     ResponseMessageCallback cb,
     void* ctx
@@ -218,7 +256,8 @@ EebusError FeatureLocalAddResponseCallback(
   if (resp_msg_cbs_vec != NULL) {
     for (size_t i = 0; i < VectorGetSize(resp_msg_cbs_vec); ++i) {
       const ReponseMessageCbRecord* const resp_msg_cb_record = VectorGetElement(resp_msg_cbs_vec, i);
-      if ((resp_msg_cb_record->cb == cb) && (resp_msg_cb_record->ctx == ctx)) {
+      if ((resp_msg_cb_record->remote_device == remote_device) && (resp_msg_cb_record->cb == cb)
+          && (resp_msg_cb_record->ctx == ctx)) {
         return kEebusErrorNoChange;
       }
     }
@@ -227,7 +266,7 @@ EebusError FeatureLocalAddResponseCallback(
     Uint64LutInsert(&fl->resp_msg_cbs, msg_counter_ref, resp_msg_cbs_vec, ReponseMessageContainerDelete);
   }
 
-  VectorPushBack(resp_msg_cbs_vec, ReponseMessageCbRecordCreate(cb, ctx));
+  VectorPushBack(resp_msg_cbs_vec, ReponseMessageCbRecordCreate(remote_device, cb, ctx));
   return kEebusErrorOk;
 }
 
@@ -237,17 +276,52 @@ void ProcessResponseMsgCallbacks(FeatureLocal* self, MsgCounterType msg_counter_
     return;
   }
 
-  for (size_t i = 0; i < VectorGetSize(resp_msg_cbs_vec); ++i) {
+  // The message counters are maintained per remote device,
+  // only the callbacks of requests sent to the responding device are concerned
+  for (size_t i = 0; i < VectorGetSize(resp_msg_cbs_vec);) {
     ReponseMessageCbRecord* const resp_msg_record = VectorGetElement(resp_msg_cbs_vec, i);
+    if (resp_msg_record->remote_device != resp_msg->device_remote) {
+      ++i;
+      continue;
+    }
+
+    VectorRemove(resp_msg_cbs_vec, resp_msg_record);
     resp_msg_record->cb(resp_msg, resp_msg_record->ctx);
+    EEBUS_FREE(resp_msg_record);
   }
 
-  Uint64LutRemove(&self->resp_msg_cbs, msg_counter_ref);
+  if (VectorGetSize(resp_msg_cbs_vec) == 0) {
+    Uint64LutRemove(&self->resp_msg_cbs, msg_counter_ref);
+  }
+}
+
+void ProcessResponseTimeout(DeviceRemoteObject* remote_device, MsgCounterType msg_cnt, void* ctx) {
+  FeatureLocal* const fl = FEATURE_LOCAL(ctx);
+
+  // Let the response callbacks know there will be no reply, this also releases the callback records
+  static const ErrorNumberType error_number = kErrorNumberTypeTimeout;
+
+  const ResultDataType result_data = {
+      .error_number = &error_number,
+      .description  = NULL,
+  };
+
+  const ResponseMessage resp_msg = {
+      .msg_cnt_ref    = msg_cnt,
+      .function_data  = &result_data,
+      .function_type  = kFunctionTypeResultData,
+      .feature_local  = FEATURE_LOCAL_OBJECT(fl),
+      .feature_remote = NULL,
+      .entity_remote  = NULL,
+      .device_remote  = remote_device,
+  };
+
+  ProcessResponseMsgCallbacks(fl, msg_cnt, &resp_msg);
 }
 
 void FeatureLocalAddResultCallback(FeatureLocalObject* self, ResponseMessageCallback cb, void* ctx) {
   FeatureLocal* const fl = FEATURE_LOCAL(self);
-  VectorPushBack(&fl->result_cbs, ReponseMessageCbRecordCreate(cb, ctx));
+  VectorPushBack(&fl->result_cbs, ReponseMessageCbRecordCreate(NULL, cb, ctx));
 }
 
 void ProcessResultCallbacks(FeatureLocal* self, const ResponseMessage* resp_msg) {
@@ -381,13 +455,21 @@ EebusError FeatureLocalRequestRemoteData(
     return kEebusErrorNoChange;
   }
 
+  const DeviceRemoteObject* const dest_device = FEATURE_REMOTE_GET_DEVICE(dest_feature);
+
+  // The in-flight limit applies to the application requests only,
+  // the SPINE internal requests (e.g. discovery) go through the headroom of the pending requests table
+  const PendingRequestsObject* const pending_requests = DEVICE_REMOTE_GET_PENDING_REQUESTS(dest_device);
+  if ((pending_requests != NULL) && PENDING_REQUESTS_IS_FULL(pending_requests)) {
+    FEATURE_LOCAL_DEBUG_PRINTF("%s(), too many requests in flight, read rejected\n", __func__);
+    return kEebusErrorCommunicationBusy;
+  }
+
   const CmdType* cmd = FUNCTION_CREATE_READ_CMD(function, filter_partial);
   if (cmd == NULL) {
     return kEebusErrorMemoryAllocate;
   }
 
-  const DeviceRemoteObject* const dest_device = FEATURE_REMOTE_GET_DEVICE(dest_feature);
-
   SenderObject* const sender     = DEVICE_REMOTE_GET_SENDER(dest_device);
   const char* const ski          = DEVICE_REMOTE_GET_SKI(dest_device);
   const FeatureAddressType* addr = FEATURE_GET_ADDRESS(FEATURE_OBJECT(dest_feature));
@@ -407,7 +489,41 @@ EebusError FeatureLocalRequestRemoteDataBySenderAddress(
     const FeatureAddressType* dest_addr,
     uint32_t max_delay
 ) {
-  return SEND_READ(sender, FEATURE_GET_ADDRESS(FEATURE_OBJECT(self)), dest_addr, cmd);
+  const DeviceLocalObject* const dl = FEATURE_LOCAL_GET_DEVICE(self);
+
+  DeviceRemoteObject* const dr = (dl != NULL) ? DEVICE_LOCAL_GET_REMOTE_DEVICE_WITH_SKI(dl, dest_ski) : NULL;
+
+  MsgCounterType msg_cnt = 0;
+
+  const EebusError err = SEND_READ(sender, FEATURE_GET_ADDRESS(FEATURE_OBJECT(self)), dest_addr, cmd, &msg_cnt);
+  if ((err != kEebusErrorOk) || (dr == NULL)) {
+    return err;
+  }
+
+  // The read has been sent already, the reply is handled as usual even if its deadline is not tracked
+  if (FEATURE_LOCAL_ADD_PENDING_REQUEST(self, dr, msg_cnt, max_delay) != kEebusErrorOk) {
+    FEATURE_LOCAL_DEBUG_PRINTF("%s(), read sent, response timeout not tracked\n", __func__);
+  }
+
+  return kEebusErrorOk;
+}
+
+EebusError FeatureLocalAddPendingRequest(
+    FeatureLocalObject* self,
+    DeviceRemoteObject* remote_device,
+    MsgCounterType msg_cnt,
+    uint32_t max_delay
+) {
+  if (remote_device == NULL) {
+    return kEebusErrorInputArgumentNull;
+  }
+
+  PendingRequestsObject* const pending_requests = DEVICE_REMOTE_GET_PENDING_REQUESTS(remote_device);
+  if (pending_requests == NULL) {
+    return kEebusErrorInit;
+  }
+
+  return PENDING_REQUESTS_ADD(pending_requests, msg_cnt, max_delay, ProcessResponseTimeout, self);
 }
 
 bool FeatureLocalHasSubscriptionToRemote(const FeatureLocalObject* self, const FeatureAddressType* remote_addr) {
@@ -674,31 +790,33 @@ EebusError ProcessWriteFunctionData(FeatureLocal* self, const Message* msg) {
   return kEebusErrorOk;
 }
 
-void SendResult(FeatureLocal* self, const Message* msg, EebusError err) {
+EebusError SendResult(FeatureLocal* self, const Message* msg, EebusError err) {
   SenderObject* const sender = MessageGetSender(msg);
 
   const FeatureAddressType* const addr = FEATURE_GET_ADDRESS(FEATURE_OBJECT(self));
 
   if (err == kEebusErrorOk) {
-    SEND_RESULT_SUCCESS(sender, msg->request_header, addr);
+    return SEND_RESULT_SUCCESS(sender, msg->request_header, addr);
   } else {
     const ErrorType err = {
         .description  = NULL,
         .error_number = kErrorNumberTypeGeneralError,
     };
 
-    SEND_RESULT_ERROR(sender, msg->request_header, addr, &err);
+    return SEND_RESULT_ERROR(sender, msg->request_header, addr, &err);
   }
 }
 
 EebusError ProcessWriteInternal(FeatureLocal* self, const Message* msg) {
+  // The write itself is answered with the result, the caller is informed about the result not being sent only,
+  // e.g. when the connection has no room for it at the moment
   const EebusError err = ProcessWriteFunctionData(self, msg);
   if (err != kEebusErrorOk) {
-    SendResult(self, msg, err);
+    return SendResult(self, msg, err);
   } else if (msg->request_header != NULL) {
     const bool* const ack_request = msg->request_header->ack_request;
     if ((ack_request != NULL) && (*ack_request)) {
-      SendResult(self, msg, kEebusErrorOk);
+      return SendResult(self, msg, kEebusErrorOk);
     }
   }
 
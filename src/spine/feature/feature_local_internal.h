@@ -56,10 +56,16 @@ EebusError FeatureLocalProcessResult(FeatureLocal* self, const Message* msg);
 void FeatureLocalDestruct(FeatureObject* self);
 DeviceLocalObject* FeatureLocalGetDevice(const FeatureLocalObject* self);
 EntityLocalObject* FeatureLocalGetEntity(const FeatureLocalObject* self);
+void FeatureLocalSetDescription(FeatureObject* self, const char* description);
 const void* FeatureLocalGetData(const FeatureLocalObject* self, FunctionType function_type);
 void FeatureLocalSetFunctionOperations(FeatureLocalObject* self, FunctionType type, bool read, bool write);
 EebusError FeatureLocalAddResponseCallback(
-    FeatureLocalObject* self, MsgCounterType msg_counter_ref, ResponseMessageCallback cb, void* ctx);
+    FeatureLocalObject* self,
+    const DeviceRemoteObject* remote_device,
+    MsgCounterType msg_counter_ref,
+    ResponseMessageCallback cb,
+    void* ctx
+);
 void FeatureLocalAddResultCallback(FeatureLocalObject* self, ResponseMessageCallback cb, void* ctx);
 EebusError FeatureLocalAddWriteApprovalCallback(FeatureLocalObject* self, WriteApprovalCallback cb, void* ctx);
 void FeatureLocalApproveOrDenyWrite(FeatureLocalObject* self, const Message* msg, const ErrorType* err);
@@ -83,6 +89,12 @@ EebusError FeatureLocalRequestRemoteDataBySenderAddress(
     const FeatureAddressType* dest_addr,
     uint32_t max_delay
 );
+EebusError FeatureLocalAddPendingRequest(
+    FeatureLocalObject* self,
+    DeviceRemoteObject* remote_device,
+    MsgCounterType msg_cnt,
+    uint32_t max_delay
+);
 bool FeatureLocalHasSubscriptionToRemote(const FeatureLocalObject* self, const FeatureAddressType* remote_addr);
 EebusError FeatureLocalSubscribeToRemote(FeatureLocalObject* self, const FeatureAddressType* remote_addr);
 EebusError FeatureLocalRemoveRemoteSubscription(FeatureLocalObject* self, const FeatureAddressType* remote_addr);
@@ -0,0 +1,268 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Pending Requests implementation
+ *
+ * Requests awaiting a reply or result are kept in a fixed size binary min-heap
+ * ordered by deadline, so the tick only has to look at the heap root to find
+ * out whether something has expired. The table clock is advanced by the tick,
+ * no system time is involved.
+ */
+
+#include "src/spine/feature/pending_requests.h"
+
+#include <stdint.h>
+
+#include "src/common/eebus_malloc.h"
+#include "src/spine/api/pending_requests_interface.h"
+
+typedef struct PendingRequest PendingRequest;
+
+struct PendingRequest {
+  MsgCounterType msg_cnt;
+  uint64_t deadline;
+  PendingRequestTimeoutCallback cb;
+  void* ctx;
+};
+
+typedef struct PendingRequests PendingRequests;
+
+struct PendingRequests {
+  /** Implements the Pending Requests Interface */
+  PendingRequestsObject obj;
+
+  DeviceRemoteObject* remote_device;
+  PendingRequest* heap;
+  size_t size;
+  size_t max_num;
+  size_t capacity;
+  uint64_t now_ms;
+};
+
+#define PENDING_REQUESTS(obj) ((PendingRequests*)(obj))
+
+static void Destruct(PendingRequestsObject* self);
+static EebusError Add(
+    PendingRequestsObject* self,
+    MsgCounterType msg_cnt,
+    uint32_t max_delay_ms,
+    PendingRequestTimeoutCallback cb,
+    void* ctx
+);
+static EebusError Remove(PendingRequestsObject* self, MsgCounterType msg_cnt);
+static bool IsFull(const PendingRequestsObject* self);
+static size_t GetSize(const PendingRequestsObject* self);
+static void Tick(PendingRequestsObject* self, uint32_t elapsed_ms);
+static void Clear(PendingRequestsObject* self);
+
+static const PendingRequestsInterface pending_requests_methods = {
+    .destruct = Destruct,
+    .add      = Add,
+    .remove   = Remove,
+    .is_full  = IsFull,
+    .get_size = GetSize,
+    .tick     = Tick,
+    .clear    = Clear,
+};
+
+static EebusError PendingRequestsConstruct(PendingRequests* self, DeviceRemoteObject* remote_device, size_t max_num);
+static void HeapSwap(PendingRequests* self, size_t i, size_t j);
+static void HeapSiftUp(PendingRequests* self, size_t i);
+static void HeapSiftDown(PendingRequests* self, size_t i);
+static PendingRequest HeapRemoveAt(PendingRequests* self, size_t i);
+static size_t FindIndex(const PendingRequests* self, MsgCounterType msg_cnt);
+
+EebusError PendingRequestsConstruct(PendingRequests* self, DeviceRemoteObject* remote_device, size_t max_num) {
+  // Override "virtual functions table"
+  PENDING_REQUESTS_INTERFACE(self) = &pending_requests_methods;
+
+  self->remote_device = remote_device;
+  self->size          = 0;
+  self->max_num       = max_num;
+  self->capacity      = max_num + PENDING_REQUESTS_RESERVED_NUM;
+  self->now_ms        = 0;
+  self->heap          = (PendingRequest*)EEBUS_MALLOC(self->capacity * sizeof(PendingRequest));
+  if (self->heap == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  return kEebusErrorOk;
+}
+
+PendingRequestsObject* PendingRequestsCreate(DeviceRemoteObject* remote_device, size_t max_num) {
+  if (max_num == 0) {
+    return NULL;
+  }
+
+  PendingRequests* const pending_requests = (PendingRequests*)EEBUS_MALLOC(sizeof(PendingRequests));
+  if (pending_requests == NULL) {
+    return NULL;
+  }
+
+  if (PendingRequestsConstruct(pending_requests, remote_device, max_num) != kEebusErrorOk) {
+    PendingRequestsDelete(PENDING_REQUESTS_OBJECT(pending_requests));
+    return NULL;
+  }
+
+  return PENDING_REQUESTS_OBJECT(pending_requests);
+}
+
+void Destruct(PendingRequestsObject* self) {
+  PendingRequests* const pr = PENDING_REQUESTS(self);
+
+  EEBUS_FREE(pr->heap);
+  pr->heap = NULL;
+  pr->size = 0;
+}
+
+void HeapSwap(PendingRequests* self, size_t i, size_t j) {
+  const PendingRequest tmp = self->heap[i];
+
+  self->heap[i] = self->heap[j];
+  self->heap[j] = tmp;
+}
+
+void HeapSiftUp(PendingRequests* self, size_t i) {
+  while (i > 0) {
+    const size_t parent = (i - 1) / 2;
+    if (self->heap[parent].deadline <= self->heap[i].deadline) {
+      break;
+    }
+
+    HeapSwap(self, parent, i);
+    i = parent;
+  }
+}
+
+void HeapSiftDown(PendingRequests* self, size_t i) {
+  for (;;) {
+    const size_t left  = 2 * i + 1;
+    const size_t right = left + 1;
+
+    size_t min = i;
+    if ((left < self->size) && (self->heap[left].deadline < self->heap[min].deadline)) {
+      min = left;
+    }
+
+    if ((right < self->size) && (self->heap[right].deadline < self->heap[min].deadline)) {
+      min = right;
+    }
+
+    if (min == i) {
+      break;
+    }
+
+    HeapSwap(self, min, i);
+    i = min;
+  }
+}
+
+PendingRequest HeapRemoveAt(PendingRequests* self, size_t i) {
+  const PendingRequest removed = self->heap[i];
+
+  self->heap[i] = self->heap[--self->size];
+  if (i < self->size) {
+    HeapSiftDown(self, i);
+    HeapSiftUp(self, i);
+  }
+
+  return removed;
+}
+
+size_t FindIndex(const PendingRequests* self, MsgCounterType msg_cnt) {
+  for (size_t i = 0; i < self->size; ++i) {
+    if (self->heap[i].msg_cnt == msg_cnt) {
+      return i;
+    }
+  }
+
+  return SIZE_MAX;
+}
+
+EebusError Add(
+    PendingRequestsObject* self,
+    MsgCounterType msg_cnt,
+    uint32_t max_delay_ms,
+    PendingRequestTimeoutCallback cb,
+    void* ctx
+) {
+  PendingRequests* const pr = PENDING_REQUESTS(self);
+
+  if (FindIndex(pr, msg_cnt) != SIZE_MAX) {
+    return kEebusErrorNoChange;
+  }
+
+  if (pr->size >= pr->capacity) {
+    return kEebusErrorCommunicationBusy;
+  }
+
+  pr->heap[pr->size] = (PendingRequest){
+      .msg_cnt  = msg_cnt,
+      .deadline = pr->now_ms + max_delay_ms,
+      .cb       = cb,
+      .ctx      = ctx,
+  };
+
+  HeapSiftUp(pr, pr->size++);
+  return kEebusErrorOk;
+}
+
+EebusError Remove(PendingRequestsObject* self, MsgCounterType msg_cnt) {
+  PendingRequests* const pr = PENDING_REQUESTS(self);
+
+  const size_t i = FindIndex(pr, msg_cnt);
+  if (i == SIZE_MAX) {
+    return kEebusErrorNoChange;
+  }
+
+  HeapRemoveAt(pr, i);
+  return kEebusErrorOk;
+}
+
+bool IsFull(const PendingRequestsObject* self) {
+  const PendingRequests* const pr = PENDING_REQUESTS(self);
+  return pr->size >= pr->max_num;
+}
+
+size_t GetSize(const PendingRequestsObject* self) {
+  return PENDING_REQUESTS(self)->size;
+}
+
+void Tick(PendingRequestsObject* self, uint32_t elapsed_ms) {
+  PendingRequests* const pr = PENDING_REQUESTS(self);
+
+  pr->now_ms += elapsed_ms;
+
+  while ((pr->size > 0) && (pr->heap[0].deadline <= pr->now_ms)) {
+    // Remove the entry prior to the callback, so that it is safe to add new requests from within
+    const PendingRequest expired = HeapRemoveAt(pr, 0);
+    if (expired.cb != NULL) {
+      expired.cb(pr->remote_device, expired.msg_cnt, expired.ctx);
+    }
+  }
+}
+
+void Clear(PendingRequestsObject* self) {
+  PendingRequests* const pr = PENDING_REQUESTS(self);
+
+  while (pr->size > 0) {
+    const PendingRequest expired = HeapRemoveAt(pr, 0);
+    if (expired.cb != NULL) {
+      expired.cb(pr->remote_device, expired.msg_cnt, expired.ctx);
+    }
+  }
+}
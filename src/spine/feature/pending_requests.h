@@ -0,0 +1,61 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Pending Requests implementation declarations
+ */
+
+#ifndef SRC_SPINE_FEATURE_PENDING_REQUESTS_H_
+#define SRC_SPINE_FEATURE_PENDING_REQUESTS_H_
+
+#include <stddef.h>
+
+#include "src/common/eebus_malloc.h"
+#include "src/spine/api/pending_requests_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/** Default limit of the requests awaiting a response from a single remote device */
+#define PENDING_REQUESTS_MAX_NUM_DEFAULT 32
+
+/**
+ * Number of requests accepted beyond the in-flight limit. The SPINE internal requests (e.g. the discovery reads)
+ * are not subject to the limit, the headroom keeps them tracked during the connection set up bursts
+ */
+#define PENDING_REQUESTS_RESERVED_NUM 8
+
+/**
+ * @brief Create the pending requests table
+ * @param remote_device Remote device the requests are sent to, passed to the timeout callbacks
+ * @param max_num Maximum number of requests in flight
+ * @return Pending requests object on success, NULL otherwise
+ */
+PendingRequestsObject* PendingRequestsCreate(DeviceRemoteObject* remote_device, size_t max_num);
+
+static inline void PendingRequestsDelete(PendingRequestsObject* pending_requests) {
+  if (pending_requests != NULL) {
+    PENDING_REQUESTS_DESTRUCT(pending_requests);
+    EEBUS_FREE(pending_requests);
+  }
+}
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_SPINE_FEATURE_PENDING_REQUESTS_H_
@@ -62,3 +62,7 @@ bool FeatureLinkRemoteEntityMatch(const FeatureLink* self, const EntityRemoteObj
 
   return EntityAddressCompare(remote_entity_addr, &clinet_entity_addr);
 }
+
+bool FeatureLinkRemoteFeatureMatch(const FeatureLink* self, const FeatureRemoteObject* remote_feature) {
+  return self->client_feature == remote_feature;
+}
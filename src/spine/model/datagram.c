@@ -20,6 +20,7 @@
 
 #include "src/spine/model/datagram.h"
 
+#include "src/common/cbor.h"
 #include "src/common/eebus_data/eebus_data.h"
 #include "src/spine/model/feature_types.h"
 #include "src/spine/model/model.h"
@@ -67,6 +68,23 @@ char* DatagramPrintUnformatted(const DatagramType* datagram) {
   return EEBUS_DATA_PRINT_UNFORMATTED(ModelGetDatagramCfg(), &datagram);
 }
 
+DatagramType* DatagramParseCbor(const uint8_t* buf, size_t buf_size) {
+  return (DatagramType*)EEBUS_DATA_PARSE_CBOR(ModelGetDatagramCfg(), buf, buf_size);
+}
+
+uint8_t* DatagramPrintCbor(const DatagramType* datagram, size_t* size) {
+  return EEBUS_DATA_PRINT_CBOR(ModelGetDatagramCfg(), &datagram, size);
+}
+
+DatagramType* DatagramParseMessage(const uint8_t* msg, size_t msg_size) {
+  // Json datagram always starts with '{', so that it is never taken for a CBOR map
+  if (CborIsMap(msg, msg_size)) {
+    return DatagramParseCbor(msg, msg_size);
+  }
+
+  return DatagramParse((const char*)msg);
+}
+
 DatagramType* DatagramCopy(const DatagramType* datagram) {
   DatagramType* datagram_copy = NULL;
   EEBUS_DATA_COPY(ModelGetDatagramCfg(), &datagram, &datagram_copy);
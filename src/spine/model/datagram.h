@@ -21,6 +21,9 @@
 #ifndef SRC_SPINE_MODEL_DATAGRAM_H_
 #define SRC_SPINE_MODEL_DATAGRAM_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "src/spine/model/command_frame_types.h"
 #include "src/spine/model/common_data_types.h"
 #include "src/spine/model/feature_types.h"
@@ -56,6 +59,14 @@ void DatagramDelete(DatagramType* datagram);
 
 DatagramType* DatagramParse(const char* s);
 char* DatagramPrintUnformatted(const DatagramType* datagram);
+DatagramType* DatagramParseCbor(const uint8_t* buf, size_t buf_size);
+uint8_t* DatagramPrintCbor(const DatagramType* datagram, size_t* size);
+
+/**
+ * @brief Parse the received datagram either encoded with Json or with CBOR,
+ * depending on the message protocol format agreed on the SHIP handshake
+ */
+DatagramType* DatagramParseMessage(const uint8_t* msg, size_t msg_size);
 DatagramType* DatagramCopy(const DatagramType* datagram);
 
 #ifdef __cplusplus
@@ -0,0 +1,513 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief SPINE generated codecs building blocks.
+ *
+ * The specialized codecs emitted by scripts/codegen/spine_codecs.py operate on the
+ * SPINE data structures directly. Every building block below behaves exactly as the
+ * related EEBUS Data method does, so that the generated and the interpreted
+ * (EebusDataInterface based) paths produce the same data and the same Json.
+ */
+
+#ifndef SRC_SPINE_MODEL_SPINE_CODEC_UTIL_H_
+#define SRC_SPINE_MODEL_SPINE_CODEC_UTIL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "src/common/api/eebus_data_interface.h"
+#include "src/common/eebus_data/eebus_data_base.h"
+#include "src/common/eebus_data/eebus_data_container.h"
+#include "src/common/eebus_data/eebus_data_enum.h"
+#include "src/common/eebus_data/eebus_data_sequence.h"
+#include "src/common/eebus_errors.h"
+#include "src/common/eebus_malloc.h"
+#include "src/common/json.h"
+#include "src/common/string_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/** Field index returned for the Json item name not found within sequence */
+#define SPINE_CODEC_NO_FIELD SIZE_MAX
+
+typedef EebusError (*SpineCodecFromJson)(void** data, const JsonObject* json_item);
+typedef EebusError (*SpineCodecToJson)(const void* data, JsonObject** json_item);
+typedef EebusError (*SpineCodecWrite)(void** data, const void* src);
+typedef bool (*SpineCodecCompare)(const void* a, const void* b);
+typedef void (*SpineCodecDelete)(void** data);
+
+static inline void* SpineCodecCreate(void** data, size_t size) {
+  *data = EEBUS_MALLOC(size);
+  if (*data != NULL) {
+    memset(*data, 0, size);
+  }
+
+  return *data;
+}
+
+static inline void SpineCodecFree(void** data) {
+  EEBUS_FREE(*data);
+  *data = NULL;
+}
+
+/**
+ * @brief Match the Json item name ignoring the case, the same way Json object item lookup does
+ */
+static inline bool SpineCodecNameEquals(const char* name, const char* json_name) {
+  for (; *name != '\0'; ++name, ++json_name) {
+    const char a = (char)(((*name >= 'A') && (*name <= 'Z')) ? (*name - 'A' + 'a') : *name);
+    const char b = (char)(((*json_name >= 'A') && (*json_name <= 'Z')) ? (*json_name - 'A' + 'a') : *json_name);
+    if (a != b) {
+      return false;
+    }
+  }
+
+  return *json_name == '\0';
+}
+
+/**
+ * @brief Find the sequence field with Json item name.
+ * The items usually come in the field order, so the field next to the previous one is tried first
+ * @param names Sequence field names
+ * @param names_size Number of the sequence fields
+ * @param hint Index of the field expected
+ * @param json_name Json item name
+ * @return Field index, SPINE_CODEC_NO_FIELD if sequence has no such a field
+ */
+static inline size_t
+SpineCodecFindField(const char* const* names, size_t names_size, size_t hint, const char* json_name) {
+  if (json_name == NULL) {
+    return SPINE_CODEC_NO_FIELD;
+  }
+
+  if ((hint < names_size) && (strcmp(names[hint], json_name) == 0)) {
+    return hint;
+  }
+
+  for (size_t i = 0; i < names_size; ++i) {
+    if (SpineCodecNameEquals(names[i], json_name)) {
+      return i;
+    }
+  }
+
+  return SPINE_CODEC_NO_FIELD;
+}
+
+/**
+ * @brief Append the named item to Json sequence (see EebusDataBaseToJsonObject()).
+ * The sequence is deleted on failure, including the failure of the item conversion
+ * @param json_seq Json sequence
+ * @param name Item name
+ * @param json_item Item to be appended, nothing is appended if NULL
+ * @param ret Result of the item conversion
+ * @return kEebusErrorOk on success, the error code otherwise
+ */
+static inline EebusError
+SpineCodecSequenceAppend(JsonObject** json_seq, const char* name, JsonObject* json_item, EebusError ret) {
+  if ((ret == kEebusErrorOk) && (json_item != NULL) && (!JsonAddItem(*json_seq, name, json_item, false))) {
+    JsonDelete(json_item);
+    ret = kEebusErrorMemoryAllocate;
+  }
+
+  if (ret != kEebusErrorOk) {
+    JsonDelete(*json_seq);
+    *json_seq = NULL;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Copy, compare and delete of the value kept by pointer (see EebusDataSimple methods)
+ */
+#define SPINE_CODEC_SIMPLE_DECL(name, type)                                                \
+  static inline EebusError SpineCodec##name##Write(const type** field, const type* src) {  \
+    if (src == NULL) {                                                                     \
+      SpineCodecFree((void**)field);                                                       \
+      return kEebusErrorOk;                                                                \
+    }                                                                                      \
+                                                                                           \
+    if ((*field == NULL) && (SpineCodecCreate((void**)field, sizeof(type)) == NULL)) {     \
+      return kEebusErrorMemoryAllocate;                                                    \
+    }                                                                                      \
+                                                                                           \
+    *(type*)*field = *src;                                                                 \
+    return kEebusErrorOk;                                                                  \
+  }                                                                                        \
+                                                                                           \
+  static inline bool SpineCodec##name##Compare(const type* a, const type* b) {             \
+    return ((a == NULL) || (b == NULL)) ? (a == b) : (*a == *b);                           \
+  }                                                                                        \
+                                                                                           \
+  static inline void SpineCodec##name##Delete(const type** field) { SpineCodecFree((void**)field); }
+
+/**
+ * @brief Numeric value codec (see JSON_NUM_CONV_DECL)
+ */
+#define SPINE_CODEC_NUMERIC_DECL(name, type, wide_type, get_wide, create_wide)                          \
+  SPINE_CODEC_SIMPLE_DECL(name, type)                                                                   \
+                                                                                                        \
+  static inline EebusError SpineCodec##name##FromJson(const type** field, const JsonObject* json_item) { \
+    if (!JsonIsNumber(json_item)) {                                                                     \
+      return kEebusErrorParse;                                                                          \
+    }                                                                                                   \
+                                                                                                        \
+    type* const buf = (type*)SpineCodecCreate((void**)field, sizeof(type));                             \
+    if (buf == NULL) {                                                                                  \
+      return kEebusErrorMemoryAllocate;                                                                 \
+    }                                                                                                   \
+                                                                                                        \
+    wide_type value = 0;                                                                                \
+    if (!get_wide(json_item, &value) || ((wide_type)(type)value != value)) {                            \
+      SpineCodecFree((void**)field);                                                                    \
+      return kEebusErrorParse;                                                                          \
+    }                                                                                                   \
+                                                                                                        \
+    *buf = (type)value;                                                                                 \
+    return kEebusErrorOk;                                                                               \
+  }                                                                                                     \
+                                                                                                        \
+  static inline EebusError SpineCodec##name##ToJson(const type* value, JsonObject** json_item) {        \
+    if (value == NULL) {                                                                                \
+      *json_item = NULL;                                                                                \
+      return kEebusErrorOk;                                                                             \
+    }                                                                                                   \
+                                                                                                        \
+    *json_item = create_wide((wide_type)*value);                                                        \
+    return (*json_item != NULL) ? kEebusErrorOk : kEebusErrorMemoryAllocate;                            \
+  }
+
+SPINE_CODEC_NUMERIC_DECL(Uint8, uint8_t, uint64_t, JsonGetUint64, JsonCreateUint64)
+SPINE_CODEC_NUMERIC_DECL(Uint16, uint16_t, uint64_t, JsonGetUint64, JsonCreateUint64)
+SPINE_CODEC_NUMERIC_DECL(Uint32, uint32_t, uint64_t, JsonGetUint64, JsonCreateUint64)
+SPINE_CODEC_NUMERIC_DECL(Uint64, uint64_t, uint64_t, JsonGetUint64, JsonCreateUint64)
+SPINE_CODEC_NUMERIC_DECL(Int8, int8_t, int64_t, JsonGetInt64, JsonCreateInt64)
+SPINE_CODEC_NUMERIC_DECL(Int16, int16_t, int64_t, JsonGetInt64, JsonCreateInt64)
+SPINE_CODEC_NUMERIC_DECL(Int32, int32_t, int64_t, JsonGetInt64, JsonCreateInt64)
+SPINE_CODEC_NUMERIC_DECL(Int64, int64_t, int64_t, JsonGetInt64, JsonCreateInt64)
+
+SPINE_CODEC_SIMPLE_DECL(Bool, bool)
+
+static inline EebusError SpineCodecBoolFromJson(const bool** field, const JsonObject* json_item) {
+  if (!JsonIsBool(json_item)) {
+    return kEebusErrorParse;
+  }
+
+  bool* const buf = (bool*)SpineCodecCreate((void**)field, sizeof(bool));
+  if (buf == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  *buf = JsonGetBool(json_item);
+  return kEebusErrorOk;
+}
+
+static inline EebusError SpineCodecBoolToJson(const bool* value, JsonObject** json_item) {
+  if (value == NULL) {
+    *json_item = NULL;
+    return kEebusErrorOk;
+  }
+
+  *json_item = JsonCreateBool(*value);
+  return (*json_item != NULL) ? kEebusErrorOk : kEebusErrorMemoryAllocate;
+}
+
+SPINE_CODEC_SIMPLE_DECL(Enum, int32_t)
+
+static inline EebusError
+SpineCodecEnumFromJson(const int32_t** field, const EnumMapping* lut, const JsonObject* json_item) {
+  if (!JsonIsString(json_item)) {
+    return kEebusErrorParse;
+  }
+
+  const char* const s = JsonGetString(json_item);
+  for (size_t i = 0; lut[i].name != NULL; ++i) {
+    if (!strcmp(lut[i].name, s)) {
+      int32_t* const buf = (int32_t*)SpineCodecCreate((void**)field, sizeof(int32_t));
+      if (buf == NULL) {
+        return kEebusErrorMemory;
+      }
+
+      *buf = lut[i].value;
+      return kEebusErrorOk;
+    }
+  }
+
+  return kEebusErrorParse;
+}
+
+static inline EebusError SpineCodecEnumToJson(const int32_t* value, const EnumMapping* lut, JsonObject** json_item) {
+  if (value == NULL) {
+    *json_item = NULL;
+    return kEebusErrorOk;
+  }
+
+  for (size_t i = 0; lut[i].name != NULL; ++i) {
+    if (lut[i].value == *value) {
+      *json_item = JsonCreateString(lut[i].name);
+      return (*json_item != NULL) ? kEebusErrorOk : kEebusErrorMemoryAllocate;
+    }
+  }
+
+  *json_item = NULL;
+  return kEebusErrorInputArgumentOutOfRange;
+}
+
+static inline EebusError SpineCodecStringFromJson(char** field, const JsonObject* json_item) {
+  if (!JsonIsString(json_item)) {
+    return kEebusErrorParse;
+  }
+
+  *field = StringCopy(JsonGetString(json_item));
+  return (*field != NULL) ? kEebusErrorOk : kEebusErrorParse;
+}
+
+static inline EebusError SpineCodecStringToJson(const char* s, JsonObject** json_item) {
+  if (s == NULL) {
+    *json_item = NULL;
+    return kEebusErrorOk;
+  }
+
+  *json_item = JsonCreateString(s);
+  return (*json_item != NULL) ? kEebusErrorOk : kEebusErrorMemoryAllocate;
+}
+
+static inline EebusError SpineCodecStringWrite(char** field, const char* src) {
+  if (src == NULL) {
+    SpineCodecFree((void**)field);
+    return kEebusErrorOk;
+  }
+
+  const size_t src_size = strlen(src) + 1;
+  if ((*field != NULL) && (strlen(*field) + 1 != src_size)) {
+    SpineCodecFree((void**)field);
+  }
+
+  if ((*field == NULL) && ((*field = (char*)EEBUS_MALLOC(src_size)) == NULL)) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  memcpy(*field, src, src_size);
+  return kEebusErrorOk;
+}
+
+static inline bool SpineCodecStringCompare(const char* a, const char* b) {
+  return ((a == NULL) || (b == NULL)) ? (a == b) : (strcmp(a, b) == 0);
+}
+
+static inline void SpineCodecStringDelete(char** field) { SpineCodecFree((void**)field); }
+
+/**
+ * @brief Sequence list codec (see EEBUS Data List methods)
+ */
+static inline void SpineCodecListDelete(void*** ar, size_t* ar_size, SpineCodecDelete delete_) {
+  if (*ar == NULL) {
+    return;
+  }
+
+  for (size_t i = 0; i < *ar_size; ++i) {
+    delete_(&(*ar)[i]);
+  }
+
+  SpineCodecFree((void**)ar);
+  *ar_size = 0;
+}
+
+static inline EebusError
+SpineCodecListFromJson(void*** ar, size_t* ar_size, const JsonObject* json_item, SpineCodecFromJson from_json) {
+  if (!JsonIsArray(json_item)) {
+    return kEebusErrorParse;
+  }
+
+  const size_t n = JsonGetArraySize(json_item);
+  if (n == 0) {
+    // Ok - empty array
+    return kEebusErrorOk;
+  }
+
+  if (SpineCodecCreate((void**)ar, n * sizeof(void*)) == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  *ar_size = n;
+
+  size_t i = 0;
+  for (const JsonObject* json_el = JsonGetChild(json_item); (json_el != NULL) && (i < n);
+       json_el = JsonGetNext(json_el), ++i) {
+    const EebusError ret = from_json(&(*ar)[i], json_el);
+    if (ret != kEebusErrorOk) {
+      return ret;
+    }
+  }
+
+  return kEebusErrorOk;
+}
+
+static inline EebusError
+SpineCodecListToJson(const void* const* ar, size_t ar_size, JsonObject** json_item, SpineCodecToJson to_json) {
+  if (ar == NULL) {
+    *json_item = NULL;
+    return kEebusErrorOk;
+  }
+
+  *json_item = JsonCreateArray();
+  if (*json_item == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  for (size_t i = 0; i < ar_size; ++i) {
+    JsonObject* json_el  = NULL;
+    const EebusError ret = to_json(ar[i], &json_el);
+    if (ret != kEebusErrorOk) {
+      JsonDelete(*json_item);
+      *json_item = NULL;
+      return ret;
+    }
+
+    if (!JsonAddItemToArray(*json_item, json_el)) {
+      JsonDelete(json_el);
+      JsonDelete(*json_item);
+      *json_item = NULL;
+      return kEebusErrorMemoryAllocate;
+    }
+  }
+
+  return kEebusErrorOk;
+}
+
+static inline EebusError SpineCodecListWrite(void*** ar, size_t* ar_size, const void* const* src_ar,
+    size_t src_ar_size, SpineCodecWrite write, SpineCodecDelete delete_) {
+  if (src_ar == NULL) {
+    SpineCodecListDelete(ar, ar_size, delete_);
+    return kEebusErrorOk;
+  }
+
+  if ((*ar != NULL) && (*ar_size != src_ar_size)) {
+    SpineCodecListDelete(ar, ar_size, delete_);
+  }
+
+  if ((*ar == NULL) && (SpineCodecCreate((void**)ar, src_ar_size * sizeof(void*)) == NULL)) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  *ar_size = src_ar_size;
+
+  for (size_t i = 0; i < src_ar_size; ++i) {
+    const EebusError ret = write(&(*ar)[i], src_ar[i]);
+    if (ret != kEebusErrorOk) {
+      return ret;
+    }
+  }
+
+  return kEebusErrorOk;
+}
+
+static inline bool SpineCodecListCompare(
+    const void* const* a_ar, size_t a_ar_size, const void* const* b_ar, size_t b_ar_size, SpineCodecCompare compare) {
+  if ((a_ar == NULL) || (b_ar == NULL)) {
+    return a_ar == b_ar;
+  }
+
+  if (a_ar_size != b_ar_size) {
+    return false;
+  }
+
+  for (size_t i = 0; i < a_ar_size; ++i) {
+    if (!compare(a_ar[i], b_ar[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Generated codec of SPINE container data, e.g. MeasurementListDataType.
+ * The container methods are overridden with the generated ones for encoding, decoding,
+ * copying, comparing and deleting, the rest of the methods are inherited.
+ * The Codec<name>FromJson/ToJson/Write/Compare/Delete functions are to be defined
+ * @param ce_cfg Container elements configuration, gives the interface name
+ * eebus_data_<ce_cfg>_codec_methods (see EEBUS_DATA_CHOICE_ELEMENT_CODEC)
+ * @param name Camel case name of the data
+ */
+#define SPINE_CODEC_CONTAINER_DECL(ce_cfg, name)                                                                      \
+  static EebusError Codec##name##FromJsonObjectItem(                                                                  \
+      const EebusDataCfg* cfg, void* base_addr, const JsonObject* json_item) {                                        \
+    return Codec##name##FromJson((void**)((uint8_t*)base_addr + cfg->offset), json_item);                             \
+  }                                                                                                                   \
+                                                                                                                      \
+  static EebusError Codec##name##ToJsonObjectItem(                                                                    \
+      const EebusDataCfg* cfg, const void* base_addr, JsonObject** json_item) {                                       \
+    return Codec##name##ToJson(*(const void* const*)((const uint8_t*)base_addr + cfg->offset), json_item);            \
+  }                                                                                                                   \
+                                                                                                                      \
+  static EebusError Codec##name##WriteItem(const EebusDataCfg* cfg, void* base_addr, const void* src_base_addr) {     \
+    void** const buf           = (void**)((uint8_t*)base_addr + cfg->offset);                                         \
+    const void* const* src_buf = (const void* const*)((const uint8_t*)src_base_addr + cfg->offset);                   \
+    return Codec##name##Write(buf, *src_buf);                                                                         \
+  }                                                                                                                   \
+                                                                                                                      \
+  static bool Codec##name##CompareItems(                                                                              \
+      const EebusDataCfg* a_cfg, const void* a_base_addr, const EebusDataCfg* b_cfg, const void* b_base_addr) {       \
+    if (!EEBUS_DATA_TYPE_EQ(a_cfg, b_cfg)) {                                                                          \
+      return false;                                                                                                   \
+    }                                                                                                                 \
+                                                                                                                      \
+    return Codec##name##Compare(*(const void* const*)((const uint8_t*)a_base_addr + a_cfg->offset),                   \
+        *(const void* const*)((const uint8_t*)b_base_addr + b_cfg->offset));                                          \
+  }                                                                                                                   \
+                                                                                                                      \
+  static void Codec##name##DeleteItem(const EebusDataCfg* cfg, void* base_addr) {                                     \
+    Codec##name##Delete((void**)((uint8_t*)base_addr + cfg->offset));                                                 \
+  }                                                                                                                   \
+                                                                                                                      \
+  static const EebusDataInterface eebus_data_##ce_cfg##_codec_methods = {                                             \
+      .create_empty          = EebusDataBaseCreateEmpty,                                                              \
+      .parse                 = EebusDataBaseParse,                                                                    \
+      .print_unformatted     = EebusDataBasePrintUnformatted,                                                         \
+      .parse_cbor            = EebusDataBaseParseCbor,                                                                \
+      .print_cbor            = EebusDataBasePrintCbor,                                                                \
+      .from_json_object_item = Codec##name##FromJsonObjectItem,                                                       \
+      .from_json_object      = EebusDataBaseFromJsonObject,                                                           \
+      .to_json_object_item   = Codec##name##ToJsonObjectItem,                                                         \
+      .to_json_object        = EebusDataBaseToJsonObject,                                                             \
+      .copy                  = EebusDataBaseCopy,                                                                     \
+      .copy_matching         = EebusDataContainerCopyMatching,                                                        \
+      .compare               = Codec##name##CompareItems,                                                             \
+      .is_null               = EebusDataSequenceIsNull,                                                               \
+      .is_empty              = EebusDataSequenceIsEmpty,                                                              \
+      .has_identifiers       = EebusDataSequenceHasIdentifiers,                                                       \
+      .selectors_match       = EebusDataContainerSelectorsMatch,                                                      \
+      .identifiers_match     = EebusDataSequenceIdentifiersMatch,                                                     \
+      .read_elements         = EebusDataSequenceReadElements,                                                         \
+      .write                 = Codec##name##WriteItem,                                                                \
+      .write_elements        = EebusDataSequenceWriteElements,                                                        \
+      .write_partial         = EebusDataContainerWritePartial,                                                        \
+      .delete_elements       = EebusDataSequenceDeleteElements,                                                       \
+      .delete_partial        = EebusDataContainerDeletePartial,                                                       \
+      .delete_               = Codec##name##DeleteItem,                                                               \
+  };
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_SPINE_MODEL_SPINE_CODEC_UTIL_H_
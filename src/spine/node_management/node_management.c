@@ -26,17 +26,18 @@
 #include "src/spine/feature/feature_local_internal.h"
 #include "src/spine/node_management/node_management_internal.h"
 
+static void Destruct(FeatureObject* self);
 static EebusError HandleMessage(FeatureLocalObject* self, const Message* msg);
 
 static const FeatureLocalInterface node_management_methods = {
     .feature_interface = {
-        .destruct                = FeatureLocalDestruct,
+        .destruct                = Destruct,
         .get_address             = FeatureGetAddress,
         .get_type                = FeatureGetType,
         .get_role                = FeatureGetRole,
         .get_function_operations = FeatureGetFunctionOperations,
         .get_description         = FeatureGetDescription,
-        .set_description         = FeatureSetDescription,
+        .set_description         = FeatureLocalSetDescription,
         .to_string               = FeatureToString,
     },
 
@@ -54,6 +55,7 @@ static const FeatureLocalInterface node_management_methods = {
     .set_data                              = FeatureLocalSetData,
     .request_remote_data                   = FeatureLocalRequestRemoteData,
     .request_remote_data_by_sender_address = FeatureLocalRequestRemoteDataBySenderAddress,
+    .add_pending_request                   = FeatureLocalAddPendingRequest,
     .has_subscription_to_remote            = FeatureLocalHasSubscriptionToRemote,
     .subscribe_to_remote                   = FeatureLocalSubscribeToRemote,
     .remove_remote_subscription            = FeatureLocalRemoveRemoteSubscription,
@@ -74,6 +76,8 @@ void NodeManagementConstruct(NodeManagement* self, uint32_t id, EntityLocalObjec
   //  Override "virtual functions table"
   FEATURE_LOCAL_INTERFACE(self) = &node_management_methods;
 
+  self->detailed_discovery_data = NULL;
+
   FeatureLocalObject* const fl = FEATURE_LOCAL_OBJECT(self);
   FEATURE_LOCAL_SET_FUNCTION_OPERATIONS(fl, kFunctionTypeNodeManagementDetailedDiscoveryData, true, false);
   FEATURE_LOCAL_SET_FUNCTION_OPERATIONS(fl, kFunctionTypeNodeManagementUseCaseData, true, false);
@@ -100,6 +104,11 @@ NodeManagementObject* NodeManagementCreate(uint32_t id, EntityLocalObject* entit
   return NODE_MANAGEMENT_OBJECT(node_management);
 }
 
+void Destruct(FeatureObject* self) {
+  NodeManagementReleaseDetailedDiscoveryData(NODE_MANAGEMENT(self));
+  FeatureLocalDestruct(self);
+}
+
 EebusError NodeManagementSendReply(
     const NodeManagement* self, const void* data, FunctionType data_type, const Message* msg) {
   CmdType cmd = {
@@ -52,6 +52,12 @@ static inline void NodeMnagementDelete(NodeManagementObject* node_management) {
 EebusError RequestDetailedDiscovery(
     NodeManagementObject* self, const char* remote_device_ski, const char* remote_device_addr, SenderObject* sender);
 
+/**
+ * @brief Invalidate the cached local device detailed discovery data.
+ * Has to be called each time the local entities, features, function operations or descriptions change
+ */
+void NodeManagementInvalidateDetailedDiscoveryData(NodeManagementObject* self);
+
 EebusError RequestUseCaseData(
     NodeManagementObject* self, const char* remote_device_ski, const char* remote_device_addr, SenderObject* sender);
 
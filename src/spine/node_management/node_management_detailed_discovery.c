@@ -19,8 +19,11 @@
  */
 
 #include "src/common/array_util.h"
+#include "src/spine/api/binding_manager_interface.h"
 #include "src/spine/api/device_local_interface.h"
+#include "src/spine/api/subscription_manager_interface.h"
 #include "src/spine/entity/entity.h"
+#include "src/spine/entity/entity_remote.h"
 #include "src/spine/events/events.h"
 #include "src/spine/feature/feature.h"
 #include "src/spine/model/command_frame_types.h"
@@ -166,23 +169,114 @@ EebusError AddInfo(NodeManagement* self, NodeManagementDetailedDiscoveryDataType
   return kEebusErrorOk;
 }
 
-// Handle incoming detailed discovery read call
-EebusError ProcessReadDetailedDiscoveryData(NodeManagement* self, const Message* msg) {
+const NodeManagementDetailedDiscoveryDataType* GetDetailedDiscoveryData(NodeManagement* self) {
+  if (self->detailed_discovery_data != NULL) {
+    return self->detailed_discovery_data;
+  }
+
   NodeManagementDetailedDiscoveryDataType* const discovery_data
       = NodeManagementDetailedDiscoveryDataCreate((const SpecificationVersionType*)&specification_version, 1);
   if (discovery_data == NULL) {
-    return kEebusErrorMemoryAllocate;
+    return NULL;
   }
 
   if (AddInfo(self, discovery_data) != kEebusErrorOk) {
     NodeManagementDetailedDiscoveryDataDelete(discovery_data);
+    return NULL;
+  }
+
+  self->detailed_discovery_data = discovery_data;
+  return discovery_data;
+}
+
+void NodeManagementReleaseDetailedDiscoveryData(NodeManagement* self) {
+  if (self->detailed_discovery_data != NULL) {
+    NodeManagementDetailedDiscoveryDataDelete(self->detailed_discovery_data);
+    self->detailed_discovery_data = NULL;
+  }
+}
+
+void NodeManagementInvalidateDetailedDiscoveryData(NodeManagementObject* self) {
+  if (self != NULL) {
+    NodeManagementReleaseDetailedDiscoveryData(NODE_MANAGEMENT(self));
+  }
+}
+
+// Handle incoming detailed discovery read call
+EebusError ProcessReadDetailedDiscoveryData(NodeManagement* self, const Message* msg) {
+  // The cached data is invalidated on any entity, feature, function operations or description change,
+  // so the same data can be replied to all of the remote devices until then
+  const NodeManagementDetailedDiscoveryDataType* const discovery_data = GetDetailedDiscoveryData(self);
+  if (discovery_data == NULL) {
+    return kEebusErrorMemoryAllocate;
+  }
+
+  return NodeManagementSendReply(self, discovery_data, kFunctionTypeNodeManagementDetailedDiscoveryData, msg);
+}
+
+EebusError ReleaseRemovedRemoteEntities(
+    NodeManagement* self,
+    DeviceRemoteObject* dr,
+    bool init,
+    const NodeManagementDetailedDiscoveryDataType* discovery_data
+) {
+  Vector* const entities = DEVICE_REMOTE_RELEASE_REMOVED_ENTITIES(dr, init, discovery_data);
+  if (entities == NULL) {
     return kEebusErrorMemoryAllocate;
   }
 
-  const EebusError err
-      = NodeManagementSendReply(self, discovery_data, kFunctionTypeNodeManagementDetailedDiscoveryData, msg);
-  NodeManagementDetailedDiscoveryDataDelete(discovery_data);
-  return err;
+  DeviceLocalObject* const dl = FEATURE_LOCAL_GET_DEVICE(FEATURE_LOCAL_OBJECT(self));
+
+  for (size_t i = 0; i < VectorGetSize(entities); ++i) {
+    EntityRemoteObject* const entity = VectorGetElement(entities, i);
+
+    SUBSCRIPTION_MANAGER_REMOVE_ENTITY_SUBSCRIPTIONS(DEVICE_LOCAL_GET_SUBSCRIPTION_MANAGER(dl), entity);
+    BINDING_MANAGER_REMOVE_ENTITY_BINDINGS(DEVICE_LOCAL_GET_BINDING_MANAGER(dl), entity);
+
+    // Publish event for each removed remote entity
+    const EventPayload payload = {
+        .ski           = DEVICE_REMOTE_GET_SKI(dr),
+        .event_type    = kEventTypeEntityChange,
+        .change_type   = kElementChangeRemove,
+        .device        = dr,
+        .entity        = entity,
+        .function_data = discovery_data,
+        .function_type = kFunctionTypeNodeManagementDetailedDiscoveryData,
+    };
+
+    EventPublish(&payload);
+    EntityRemoteDelete(entity);
+  }
+
+  VectorDestruct(entities);
+  EEBUS_FREE(entities);
+  return kEebusErrorOk;
+}
+
+void PublishAddedRemoteEntities(
+    DeviceRemoteObject* dr,
+    const Vector* entities,
+    const NodeManagementDetailedDiscoveryDataType* discovery_data
+) {
+  // Publish event for each added remote entity
+  for (size_t i = 0; i < VectorGetSize(entities); ++i) {
+    EntityRemoteObject* const entity = VectorGetElement(entities, i);
+
+    const EventPayload payload = {
+        .ski           = DEVICE_REMOTE_GET_SKI(dr),
+        .event_type    = kEventTypeEntityChange,
+        .change_type   = kElementChangeAdd,
+        .device        = dr,
+        .entity        = entity,
+        .function_data = discovery_data,
+        .function_type = kFunctionTypeNodeManagementDetailedDiscoveryData,
+    };
+
+    EventPublish(&payload);
+  }
+
+  VectorDestruct((Vector*)entities);
+  EEBUS_FREE((void*)entities);
 }
 
 EebusError ProcessReplyDetailedDiscoveryData(NodeManagement* self, const Message* msg) {
@@ -201,46 +295,31 @@ EebusError ProcessReplyDetailedDiscoveryData(NodeManagement* self, const Message
     return kEebusErrorInputArgument;
   }
 
+  // The device address is not known until the first reply is received
+  const bool is_initial_reply = (DEVICE_GET_ADDRESS(DEVICE_OBJECT(dr)) == NULL);
+
   DEVICE_REMOTE_UPDATE_DEVICE(dr, device_description);
 
-  // Temporary work around
-  // Store the feature remote address as all the features are removed from entities
-  // within the DEVICE_REMOTE_ADD_ENTITY_AND_FEATURES() call
-  FeatureAddressType* feature_remote_addr
-      = FeatureAddressCopy(FEATURE_GET_ADDRESS(FEATURE_OBJECT(msg->feature_remote)));
-  if (feature_remote_addr == NULL) {
-    return kEebusErrorInputArgumentNull;
+  // The reply carries the complete topology which is applied as a difference to the known one,
+  // so the remote feature data and the subscriptions of the unchanged entities are kept
+  const EebusError err = ReleaseRemovedRemoteEntities(self, dr, true, discovery_data);
+  if (err != kEebusErrorOk) {
+    return err;
   }
 
   const Vector* const entities = DEVICE_REMOTE_ADD_ENTITY_AND_FEATURES(dr, true, discovery_data);
   if (entities == NULL) {
-    FeatureAddressDelete(feature_remote_addr);
     return kEebusErrorMemoryAllocate;
   }
 
-  // Publish event for remote device added
-  const EventPayload payload = {
-      .ski           = DEVICE_REMOTE_GET_SKI(dr),
-      .event_type    = kEventTypeDeviceChange,
-      .change_type   = kElementChangeAdd,
-      .device        = dr,
-      .feature       = DEVICE_REMOTE_GET_FEATURE_WITH_ADDRESS(dr, feature_remote_addr),
-      .function_data = discovery_data,
-      .function_type = kFunctionTypeNodeManagementDetailedDiscoveryData,
-  };
-
-  EventPublish(&payload);
-
-  // Publish event for each added remote entity
-  for (size_t i = 0; i < VectorGetSize(entities); ++i) {
-    EntityRemoteObject* const entity = VectorGetElement(entities, i);
-
+  // Publish event for remote device added, re-announcing the topology does not add the device again
+  if (is_initial_reply) {
     const EventPayload payload = {
         .ski           = DEVICE_REMOTE_GET_SKI(dr),
-        .event_type    = kEventTypeEntityChange,
+        .event_type    = kEventTypeDeviceChange,
         .change_type   = kElementChangeAdd,
         .device        = dr,
-        .entity        = entity,
+        .feature       = msg->feature_remote,
         .function_data = discovery_data,
         .function_type = kFunctionTypeNodeManagementDetailedDiscoveryData,
     };
@@ -248,15 +327,33 @@ EebusError ProcessReplyDetailedDiscoveryData(NodeManagement* self, const Message
     EventPublish(&payload);
   }
 
-  FeatureAddressDelete(feature_remote_addr);
-  VectorDestruct((Vector*)entities);
-  EEBUS_FREE((void*)entities);
+  PublishAddedRemoteEntities(dr, entities, discovery_data);
   return kEebusErrorOk;
 }
 
 EebusError ProcessNotifyDetailedDiscoveryData(NodeManagement* self, const Message* msg) {
-  // TODO: Implement method
-  return kEebusErrorNotImplemented;
+  DeviceRemoteObject* const dr = msg->device_remote;
+
+  const NodeManagementDetailedDiscoveryDataType* const discovery_data
+      = (const NodeManagementDetailedDiscoveryDataType*)msg->cmd->data_choice;
+
+  if ((discovery_data->device_information != NULL) && (discovery_data->device_information->description != NULL)) {
+    DEVICE_REMOTE_UPDATE_DEVICE(dr, discovery_data->device_information->description);
+  }
+
+  // Notify carries the changed entities and features only
+  const EebusError err = ReleaseRemovedRemoteEntities(self, dr, false, discovery_data);
+  if (err != kEebusErrorOk) {
+    return err;
+  }
+
+  const Vector* const entities = DEVICE_REMOTE_ADD_ENTITY_AND_FEATURES(dr, false, discovery_data);
+  if (entities == NULL) {
+    return kEebusErrorInputArgument;
+  }
+
+  PublishAddedRemoteEntities(dr, entities, discovery_data);
+  return kEebusErrorOk;
 }
 
 EebusError HandleMsgDetailedDiscoveryData(NodeManagement* self, const Message* msg) {
@@ -23,6 +23,7 @@
 
 #include "src/common/eebus_errors.h"
 #include "src/spine/feature/feature_local_internal.h"
+#include "src/spine/model/node_management_types.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,6 +34,12 @@ typedef struct NodeManagement NodeManagement;
 struct NodeManagement {
   /** Inherits the Feature Local class */
   FeatureLocal obj;
+
+  /**
+   * Local device detailed discovery data replied to the remote read requests.
+   * Built on the first read and dropped on any change of the local device model
+   */
+  NodeManagementDetailedDiscoveryDataType* detailed_discovery_data;
 };
 
 #define NODE_MANAGEMENT(obj) ((NodeManagement*)(obj))
@@ -45,6 +52,11 @@ EebusError NodeManagementSendReply(
  */
 EebusError HandleMsgDetailedDiscoveryData(NodeManagement* self, const Message* msg);
 
+/**
+ * @brief Release the cached local device detailed discovery data
+ */
+void NodeManagementReleaseDetailedDiscoveryData(NodeManagement* self);
+
 EebusError HandleMsgSubscriptionData(NodeManagement* self, const Message* msg);
 EebusError HandleMsgSubscriptionRequestCall(NodeManagement* self, const Message* msg);
 EebusError HandleMsgSubscriptionDeleteCall(NodeManagement* self, const Message* msg);
@@ -18,6 +18,7 @@
  * @brief Subscription Manager implementation
  */
 
+#include "src/common/debug.h"
 #include "src/common/eebus_malloc.h"
 #include "src/spine/api/device_local_interface.h"
 #include "src/spine/api/feature_link.h"
@@ -26,6 +27,18 @@
 #include "src/spine/events/events.h"
 #include "src/spine/model/node_management_types.h"
 
+/** Set SUBSCRIPTION_MANAGER_DEBUG 1 to enable debug prints */
+#ifndef SUBSCRIPTION_MANAGER_DEBUG
+#define SUBSCRIPTION_MANAGER_DEBUG 0
+#endif
+
+/** Subscription Manager debug printf(), enabled with SUBSCRIPTION_MANAGER_DEBUG = 1 */
+#if SUBSCRIPTION_MANAGER_DEBUG
+#define SUBSCRIPTION_MANAGER_DEBUG_PRINTF(fmt, ...) DebugPrintf(fmt, ##__VA_ARGS__)
+#else
+#define SUBSCRIPTION_MANAGER_DEBUG_PRINTF(fmt, ...)
+#endif  // SUBSCRIPTION_MANAGER_DEBUG
+
 typedef struct SubscriptionManager SubscriptionManager;
 
 struct SubscriptionManager {
@@ -35,6 +48,8 @@ struct SubscriptionManager {
   DeviceLocalObject* local_device;
   uint64_t subscription_num;
   FeatureLinkContainer subscription_entries;
+  /** Notifies not sent, e.g. as the connection had no room for them */
+  uint32_t notify_fail_cnt;
 };
 
 #define SUBSCRIPTION_MANAGER(obj) ((SubscriptionManager*)(obj))
@@ -52,18 +67,20 @@ static EebusError RemoveSubscription(
 );
 static void RemoveDeviceSubscriptions(SubscriptionManagerObject* self, DeviceRemoteObject* remote_device);
 static void RemoveEntitySubscriptions(SubscriptionManagerObject* self, EntityRemoteObject* remote_entity);
-static void Publish(const SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd);
+static void RemoveFeatureSubscriptions(SubscriptionManagerObject* self, FeatureRemoteObject* remote_feature);
+static void Publish(SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd);
 static NodeManagementSubscriptionDataType*
 CreateSubscriptionData(const SubscriptionManagerObject* self, DeviceRemoteObject* remote_device);
 
 static const SubscriptionManagerInterface subscription_manager_methods = {
-    .destruct                    = Destruct,
-    .add_subscription            = AddSubscription,
-    .remove_subscription         = RemoveSubscription,
-    .remove_device_subscriptions = RemoveDeviceSubscriptions,
-    .remove_entity_subscriptions = RemoveEntitySubscriptions,
-    .publish                     = Publish,
-    .create_subscription_data    = CreateSubscriptionData,
+    .destruct                     = Destruct,
+    .add_subscription             = AddSubscription,
+    .remove_subscription          = RemoveSubscription,
+    .remove_device_subscriptions  = RemoveDeviceSubscriptions,
+    .remove_entity_subscriptions  = RemoveEntitySubscriptions,
+    .remove_feature_subscriptions = RemoveFeatureSubscriptions,
+    .publish                      = Publish,
+    .create_subscription_data     = CreateSubscriptionData,
 };
 
 static void SubscriptionManagerConstruct(SubscriptionManager* self, DeviceLocalObject* local_device);
@@ -76,6 +93,7 @@ void SubscriptionManagerConstruct(SubscriptionManager* self, DeviceLocalObject*
 
   self->local_device     = local_device;
   self->subscription_num = 0;
+  self->notify_fail_cnt  = 0;
   FeatureLinkContainerConstruct(&self->subscription_entries);
 }
 
@@ -245,6 +263,36 @@ void RemoveEntitySubscriptions(SubscriptionManagerObject* self, EntityRemoteObje
   }
 }
 
+void RemoveFeatureSubscriptions(SubscriptionManagerObject* self, FeatureRemoteObject* remote_feature) {
+  SubscriptionManager* const sm = SUBSCRIPTION_MANAGER(self);
+
+  if (remote_feature == NULL) {
+    return;
+  }
+
+  for (size_t i = 0; i < FeatureLinkContainerGetSize(&sm->subscription_entries);) {
+    FeatureLink* const subscription = FeatureLinkContainerGetElement(&sm->subscription_entries, i);
+    if (FeatureLinkRemoteFeatureMatch(subscription, remote_feature)) {
+      DeviceRemoteObject* const dr = FEATURE_REMOTE_GET_DEVICE(remote_feature);
+
+      EventPayload payload = {
+          .ski           = DEVICE_REMOTE_GET_SKI(dr),
+          .event_type    = kEventTypeSubscriptionChange,
+          .change_type   = kElementChangeRemove,
+          .device        = dr,
+          .entity        = FEATURE_REMOTE_GET_ENTITY(remote_feature),
+          .feature       = remote_feature,
+          .local_feature = subscription->server_feature,
+      };
+
+      EventPublish(&payload);
+      FeatureLinkContainerRemove(&sm->subscription_entries, subscription);
+    } else {
+      ++i;
+    }
+  }
+}
+
 Vector* GetFeatureSubscriptions(const SubscriptionManagerObject* self, FeatureAddressType feature_addr) {
   // TODO: Implement method
   return NULL;
@@ -294,19 +342,22 @@ EebusError AddSubscriptionEntries(
   return kEebusErrorOk;
 }
 
-void Publish(const SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd) {
-  const SubscriptionManager* const sm = SUBSCRIPTION_MANAGER(self);
+void Publish(SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd) {
+  SubscriptionManager* const sm = SUBSCRIPTION_MANAGER(self);
   for (size_t i = 0; i < FeatureLinkContainerGetSize(&sm->subscription_entries); ++i) {
     const FeatureLink* const subscription       = FeatureLinkContainerGetElement(&sm->subscription_entries, i);
     const FeatureAddressType* const server_addr = FeatureLinkGetServerAddr(subscription);
 
     if (FeatureAddressCompare(server_addr, feature_addr)) {
-      // TODO: Add error handling
       const FeatureRemoteObject* const client_feature = subscription->client_feature;
       const DeviceRemoteObject* const device_remote   = FEATURE_REMOTE_GET_DEVICE(client_feature);
 
+      // The other subscribers are notified anyway, the failed one is counted only
       SenderObject* const sender = DEVICE_REMOTE_GET_SENDER(device_remote);
-      SEND_NOTIFY(sender, server_addr, FeatureLinkGetClientAddr(subscription), cmd);
+      if (SEND_NOTIFY(sender, server_addr, FeatureLinkGetClientAddr(subscription), cmd) != kEebusErrorOk) {
+        ++sm->notify_fail_cnt;
+        SUBSCRIPTION_MANAGER_DEBUG_PRINTF("%s(), notify not sent, %u notifies failed\n", __func__, sm->notify_fail_cnt);
+      }
     }
   }
 }
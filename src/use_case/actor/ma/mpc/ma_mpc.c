@@ -125,6 +125,7 @@ MaMpcUseCaseConstruct(MaMpcUseCase* self, EntityLocalObject* local_entity, MaMpc
   USE_CASE_INTERFACE(self) = &mam_mpc_use_case_methods;
 
   self->ma_mpc_listener = ma_mpc_listener;
+  Uint64LutConstruct(&self->measurement_indexes);
   return AddFeatures(USE_CASE_OBJECT(self), local_entity);
 }
 
@@ -143,5 +144,29 @@ MaMpcUseCaseObject* MaMpcUseCaseCreate(EntityLocalObject* local_entity, MaMpcLis
 }
 
 void MaMpcUseCaseDestruct(UseCaseObject* self) {
+  MaMpcUseCase* const ma_mpc = MA_MPC_USE_CASE(self);
+
+  Uint64LutDestruct(&ma_mpc->measurement_indexes);
   UseCaseDestruct(self);
 }
+
+MaMpcMeasurementIndex* MaMpcGetMeasurementIndex(MaMpcUseCase* self, const EntityRemoteObject* entity) {
+  const uint64_t key = MaMpcMeasurementIndexKey(entity);
+
+  MaMpcMeasurementIndex* index = (MaMpcMeasurementIndex*)Uint64LutFind(&self->measurement_indexes, key);
+  if (index != NULL) {
+    return index;
+  }
+
+  index = MaMpcMeasurementIndexCreate();
+  if (index == NULL) {
+    return NULL;
+  }
+
+  if (Uint64LutInsert(&self->measurement_indexes, key, index, MaMpcMeasurementIndexDelete) != kEebusErrorOk) {
+    MaMpcMeasurementIndexDelete(index);
+    return NULL;
+  }
+
+  return index;
+}
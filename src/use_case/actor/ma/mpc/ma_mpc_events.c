@@ -18,9 +18,11 @@
  * @brief MA MPC events handling implementation
  */
 
+#include "src/spine/api/device_remote_interface.h"
 #include "src/spine/events/events.h"
 #include "src/use_case/actor/ma/mpc/ma_mpc_internal.h"
 #include "src/use_case/actor/ma/mpc/ma_mpc_measurement.h"
+#include "src/use_case/actor/ma/mpc/ma_mpc_measurement_index.h"
 #include "src/use_case/specialization/electrical_connection/electrical_connection_client.h"
 #include "src/use_case/specialization/measurement/measurement_client.h"
 
@@ -28,9 +30,11 @@ static void OnEntityAddedHandleElectricalConnection(const MaMpcUseCase* self, En
 static void OnEntityAddedHandleMeasurement(const MaMpcUseCase* self, EntityRemoteObject* entity);
 static void OnEntityAdded(MaMpcUseCase* self, EntityRemoteObject* payload);
 static void OnEntityRemoved(const MaMpcUseCase* self, EntityRemoteObject* entity);
+static void OnDescriptionDataUpdate(MaMpcUseCase* self, const EventPayload* payload);
 static void OnMeasurementDescriptionDataUpdate(MaMpcUseCase* self, const EventPayload* payload);
 static void OnMeasurementDataUpdate(MaMpcUseCase* self, const EventPayload* payload);
 static void OnDataChange(MaMpcUseCase* self, const EventPayload* payload);
+static void OnDeviceRemoved(MaMpcUseCase* self, const DeviceRemoteObject* device);
 
 void OnEntityAddedHandleElectricalConnection(const MaMpcUseCase* self, EntityRemoteObject* entity) {
   const UseCase* const use_case = USE_CASE(self);
@@ -94,6 +98,16 @@ void OnEntityRemoved(const MaMpcUseCase* self, EntityRemoteObject* entity) {
   }
 }
 
+void OnDescriptionDataUpdate(MaMpcUseCase* self, const EventPayload* payload) {
+  // The measurement ids have to be looked up again on next access
+  MaMpcMeasurementIndex* const index
+      = (MaMpcMeasurementIndex*)Uint64LutFind(&self->measurement_indexes, MaMpcMeasurementIndexKey(payload->entity));
+
+  if (index != NULL) {
+    MaMpcMeasurementIndexInvalidate(index);
+  }
+}
+
 void OnMeasurementDescriptionDataUpdate(MaMpcUseCase* self, const EventPayload* payload) {
   const UseCase* const use_case = USE_CASE(self);
 
@@ -124,22 +138,32 @@ void OnMeasurementDataUpdate(MaMpcUseCase* self, const EventPayload* payload) {
     return;
   }
 
+  MaMpcMeasurementIndex* const index = MaMpcGetMeasurementIndex(self, payload->entity);
+  if (index == NULL) {
+    return;
+  }
+
   const EntityAddressType* const entity_addr = ENTITY_GET_ADDRESS(ENTITY_OBJECT(payload->entity));
 
   for (size_t i = 0; i < measurement_list->measurement_data_size; ++i) {
     const MeasurementDataType* const measurement = measurement_list->measurement_data[i];
+    if ((measurement == NULL) || (measurement->measurement_id == NULL)) {
+      continue;
+    }
 
-    const MaMpcMeasurementObject* const mpc_measurement = MaMpcMeasurementGetInstance(&mcl, &ecl, measurement);
+    const MaMpcMeasurementObject* const mpc_measurement
+        = MaMpcMeasurementIndexGetInstance(index, &mcl, &ecl, *measurement->measurement_id);
     if (mpc_measurement == NULL) {
       continue;
     }
 
+    const MuMpcMeasurementNameId name_id = MA_MPC_MEASUREMENT_GET_NAME(mpc_measurement);
+
     ScaledValue value = {0};
-    if (MA_MPC_MEASUREMENT_GET_DATA_VALUE(mpc_measurement, &mcl, &ecl, &value) != kEebusErrorOk) {
+    if (MaMpcMeasurementIndexGetDataValue(index, name_id, &mcl, &ecl, &value) != kEebusErrorOk) {
       continue;
     }
 
-    const MuMpcMeasurementNameId name_id = MA_MPC_MEASUREMENT_GET_NAME(mpc_measurement);
     if (self->ma_mpc_listener != NULL) {
       MA_MPC_LISTENER_ON_MEASUREMENT_RECEIVE(self->ma_mpc_listener, name_id, &value, entity_addr);
     }
@@ -149,10 +173,17 @@ void OnMeasurementDataUpdate(MaMpcUseCase* self, const EventPayload* payload) {
 void OnDataChange(MaMpcUseCase* self, const EventPayload* payload) {
   switch (payload->function_type) {
     case kFunctionTypeMeasurementDescriptionListData: {
+      OnDescriptionDataUpdate(self, payload);
       OnMeasurementDescriptionDataUpdate(self, payload);
       break;
     }
 
+    case kFunctionTypeElectricalConnectionDescriptionListData:
+    case kFunctionTypeElectricalConnectionParameterDescriptionListData: {
+      OnDescriptionDataUpdate(self, payload);
+      break;
+    }
+
     case kFunctionTypeMeasurementListData: {
       OnMeasurementDataUpdate(self, payload);
       break;
@@ -162,9 +193,32 @@ void OnDataChange(MaMpcUseCase* self, const EventPayload* payload) {
   }
 }
 
+void OnDeviceRemoved(MaMpcUseCase* self, const DeviceRemoteObject* device) {
+  // The entities are released together with the device without a separate entity removal event,
+  // drop their measurement indexes so that no stale entry outlives the entity instance
+  const Vector* const entities = DEVICE_REMOTE_GET_ENTITIES(device);
+  for (size_t i = 0; i < VectorGetSize(entities); ++i) {
+    const EntityRemoteObject* const entity = (const EntityRemoteObject*)VectorGetElement(entities, i);
+    Uint64LutRemove(&self->measurement_indexes, MaMpcMeasurementIndexKey(entity));
+  }
+}
+
 void MaMpcHandleEvent(const EventPayload* payload, void* ctx) {
   MaMpcUseCase* eg_lpc_use_case = (MaMpcUseCase*)ctx;
 
+  if ((payload->event_type == kEventTypeDeviceChange) && (payload->change_type == kElementChangeRemove)) {
+    if (payload->device != NULL) {
+      OnDeviceRemoved(eg_lpc_use_case, payload->device);
+    }
+
+    return;
+  }
+
+  if ((payload->event_type == kEventTypeEntityChange) && (payload->change_type == kElementChangeRemove)) {
+    // Drop the measurement index regardless of the compatibility, the entity instance is about to be released
+    Uint64LutRemove(&eg_lpc_use_case->measurement_indexes, MaMpcMeasurementIndexKey(payload->entity));
+  }
+
   if (!USE_CASE_IS_ENTITY_COMPATIBLE(USE_CASE_OBJECT(eg_lpc_use_case), payload->entity)) {
     return;
   }
@@ -23,6 +23,8 @@
 
 #include <stdbool.h>
 
+#include "src/common/uint64_lut.h"
+#include "src/use_case/actor/ma/mpc/ma_mpc_measurement_index.h"
 #include "src/use_case/api/ma_mpc_listener_interface.h"
 #include "src/use_case/api/types.h"
 #include "src/use_case/specialization/device_diagnosis/device_diagnosis_client.h"
@@ -38,10 +40,27 @@ struct MaMpcUseCase {
   UseCase obj;
 
   MaMpcListenerObject* ma_mpc_listener;
+  /** Measurement indexes per remote entity, keyed with the remote entity instance */
+  Uint64Lut measurement_indexes;
 };
 
 #define MA_MPC_USE_CASE(obj) ((MaMpcUseCase*)(obj))
 
+/**
+ * @brief Get the measurement index of the remote entity, the index is created on first access
+ * @param self MA MPC use case instance
+ * @param entity Remote entity the index is related to
+ * @return Measurement index or NULL on memory allocation failure
+ */
+MaMpcMeasurementIndex* MaMpcGetMeasurementIndex(MaMpcUseCase* self, const EntityRemoteObject* entity);
+
+/**
+ * @brief Get the measurement index look-up table key of the remote entity
+ */
+static inline uint64_t MaMpcMeasurementIndexKey(const EntityRemoteObject* entity) {
+  return (uint64_t)(uintptr_t)entity;
+}
+
 #ifdef __cplusplus
 }
 #endif  // __cplusplus
@@ -18,6 +18,8 @@
  * @brief Ma Mpc Measurement implementation
  */
 
+#include "src/use_case/actor/ma/mpc/ma_mpc_measurement.h"
+
 #include "src/common/array_util.h"
 #include "src/use_case/api/ma_mpc_measurement_interface.h"
 #include "src/use_case/api/mpc_types.h"
@@ -33,13 +35,13 @@ typedef struct MaMpcMeasurement MaMpcMeasurement;
 typedef struct MaMpcMeasurement MaMpcMeasurement;
 
 /**
- * @brief MA MPC Measurement Read Strategy
+ * @brief MA MPC Measurement Id Resolution Strategy
  */
-typedef EebusError (*GetMeasurementDataStrategy)(
+typedef EebusError (*ResolveMeasurementIdStrategy)(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 );
 
 struct MaMpcMeasurement {
@@ -55,13 +57,19 @@ struct MaMpcMeasurement {
   const ElectricalConnectionPhaseNameType* phases;
   /** In case of per phase measurement, the phase the measurement refers to */
   const ElectricalConnectionPhaseNameType* in_reference_to;
-  /** The strategy to configure the measurement scope */
-  GetMeasurementDataStrategy get_measurement_strategy;
+  /** The strategy to find the measurement id matching the measurement scope */
+  ResolveMeasurementIdStrategy resolve_id_strategy;
 };
 
 #define MA_MPC_MEASUREMENT(obj) ((MaMpcMeasurement*)(obj))
 
 static MuMpcMeasurementNameId GetName(const MaMpcMeasurementObject* self);
+static EebusError ResolveMeasurementId(
+    const MaMpcMeasurementObject* self,
+    MeasurementClient* mcl,
+    ElectricalConnectionClient* eccl,
+    MeasurementIdType* measurement_id
+);
 static EebusError GetDataValue(
     const MaMpcMeasurementObject* self,
     MeasurementClient* mcl,
@@ -70,107 +78,108 @@ static EebusError GetDataValue(
 );
 
 static const MaMpcMeasurementInterface ma_mpc_measurement_scope_methods = {
-    .get_name       = GetName,
-    .get_data_value = GetDataValue,
+    .get_name               = GetName,
+    .resolve_measurement_id = ResolveMeasurementId,
+    .get_data_value         = GetDataValue,
 };
 
-static EebusError GetPowerStrategy(
+static EebusError ResolvePowerIdStrategy(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 );
-static EebusError GetCurrentStrategy(
+static EebusError ResolveCurrentIdStrategy(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 );
-static EebusError GetEnergyStrategy(
+static EebusError ResolveEnergyIdStrategy(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 );
-static EebusError GetVoltageStrategy(
+static EebusError ResolveVoltageIdStrategy(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 );
-static EebusError GetFrequencyStrategy(
+static EebusError ResolveFrequencyIdStrategy(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 );
 
-#define MA_MPC_MEASUREMENT_POWER_TOTAL                                               \
-  {                                                                                  \
-      .obj                      = {.interface_ = &ma_mpc_measurement_scope_methods}, \
-      .name                     = kMpcPowerTotal,                                    \
-      .measurement_type         = kMeasurementTypeTypePower,                         \
-      .scope                    = kScopeTypeTypeACPowerTotal,                        \
-      .phases                   = NULL,                                              \
-      .in_reference_to          = NULL,                                              \
-      .get_measurement_strategy = GetPowerStrategy,                                  \
+#define MA_MPC_MEASUREMENT_POWER_TOTAL                                          \
+  {                                                                             \
+      .obj                 = {.interface_ = &ma_mpc_measurement_scope_methods}, \
+      .name                = kMpcPowerTotal,                                    \
+      .measurement_type    = kMeasurementTypeTypePower,                         \
+      .scope               = kScopeTypeTypeACPowerTotal,                        \
+      .phases              = NULL,                                              \
+      .in_reference_to     = NULL,                                              \
+      .resolve_id_strategy = ResolvePowerIdStrategy,                            \
   }
 
-#define MA_MPC_MEASUREMENT_POWER(name_id, phase)                                                                   \
-  {                                                                                                                \
-      .obj                      = {.interface_ = &ma_mpc_measurement_scope_methods},                               \
-      .name                     = name_id,                                                                         \
-      .measurement_type         = kMeasurementTypeTypePower,                                                       \
-      .scope                    = kScopeTypeTypeACPower,                                                           \
-      .phases                   = &(ElectricalConnectionPhaseNameType){kElectricalConnectionPhaseNameType##phase}, \
-      .in_reference_to          = NULL,                                                                            \
-      .get_measurement_strategy = GetPowerStrategy,                                                                \
+#define MA_MPC_MEASUREMENT_POWER(name_id, phase)                                                              \
+  {                                                                                                           \
+      .obj                 = {.interface_ = &ma_mpc_measurement_scope_methods},                               \
+      .name                = name_id,                                                                         \
+      .measurement_type    = kMeasurementTypeTypePower,                                                       \
+      .scope               = kScopeTypeTypeACPower,                                                           \
+      .phases              = &(ElectricalConnectionPhaseNameType){kElectricalConnectionPhaseNameType##phase}, \
+      .in_reference_to     = NULL,                                                                            \
+      .resolve_id_strategy = ResolvePowerIdStrategy,                                                          \
   }
 
-#define MA_MPC_MEASUREMENT_ENERGY(name_id, energy_scope)                             \
-  {                                                                                  \
-      .obj                      = {.interface_ = &ma_mpc_measurement_scope_methods}, \
-      .name                     = name_id,                                           \
-      .measurement_type         = kMeasurementTypeTypeEnergy,                        \
-      .scope                    = energy_scope,                                      \
-      .phases                   = NULL,                                              \
-      .in_reference_to          = NULL,                                              \
-      .get_measurement_strategy = GetEnergyStrategy,                                 \
+#define MA_MPC_MEASUREMENT_ENERGY(name_id, energy_scope)                        \
+  {                                                                             \
+      .obj                 = {.interface_ = &ma_mpc_measurement_scope_methods}, \
+      .name                = name_id,                                           \
+      .measurement_type    = kMeasurementTypeTypeEnergy,                        \
+      .scope               = energy_scope,                                      \
+      .phases              = NULL,                                              \
+      .in_reference_to     = NULL,                                              \
+      .resolve_id_strategy = ResolveEnergyIdStrategy,                           \
   }
 
-#define MA_MPC_MEASUREMENT_CURRENT(name_id, phase)                                                                 \
-  {                                                                                                                \
-      .obj                      = {.interface_ = &ma_mpc_measurement_scope_methods},                               \
-      .name                     = name_id,                                                                         \
-      .measurement_type         = kMeasurementTypeTypeCurrent,                                                     \
-      .scope                    = kScopeTypeTypeACCurrent,                                                         \
-      .phases                   = &(ElectricalConnectionPhaseNameType){kElectricalConnectionPhaseNameType##phase}, \
-      .in_reference_to          = NULL,                                                                            \
-      .get_measurement_strategy = GetCurrentStrategy,                                                              \
+#define MA_MPC_MEASUREMENT_CURRENT(name_id, phase)                                                            \
+  {                                                                                                           \
+      .obj                 = {.interface_ = &ma_mpc_measurement_scope_methods},                               \
+      .name                = name_id,                                                                         \
+      .measurement_type    = kMeasurementTypeTypeCurrent,                                                     \
+      .scope               = kScopeTypeTypeACCurrent,                                                         \
+      .phases              = &(ElectricalConnectionPhaseNameType){kElectricalConnectionPhaseNameType##phase}, \
+      .in_reference_to     = NULL,                                                                            \
+      .resolve_id_strategy = ResolveCurrentIdStrategy,                                                        \
   }
 
-#define MA_MPC_MEASUREMENT_VOLTAGE(name_id, phase, ref_phase)                                                          \
-  {                                                                                                                    \
-      .obj                      = {.interface_ = &ma_mpc_measurement_scope_methods},                                   \
-      .name                     = name_id,                                                                             \
-      .measurement_type         = kMeasurementTypeTypeVoltage,                                                         \
-      .scope                    = kScopeTypeTypeACVoltage,                                                             \
-      .phases                   = &(ElectricalConnectionPhaseNameType){kElectricalConnectionPhaseNameType##phase},     \
-      .in_reference_to          = &(ElectricalConnectionPhaseNameType){kElectricalConnectionPhaseNameType##ref_phase}, \
-      .get_measurement_strategy = GetVoltageStrategy,                                                                  \
+#define MA_MPC_MEASUREMENT_VOLTAGE(name_id, phase, ref_phase)                                                     \
+  {                                                                                                               \
+      .obj                 = {.interface_ = &ma_mpc_measurement_scope_methods},                                   \
+      .name                = name_id,                                                                             \
+      .measurement_type    = kMeasurementTypeTypeVoltage,                                                         \
+      .scope               = kScopeTypeTypeACVoltage,                                                             \
+      .phases              = &(ElectricalConnectionPhaseNameType){kElectricalConnectionPhaseNameType##phase},     \
+      .in_reference_to     = &(ElectricalConnectionPhaseNameType){kElectricalConnectionPhaseNameType##ref_phase}, \
+      .resolve_id_strategy = ResolveVoltageIdStrategy,                                                            \
   }
 
-#define MA_MPC_MEASUREMENT_FREQUENCY                                                 \
-  {                                                                                  \
-      .obj                      = {.interface_ = &ma_mpc_measurement_scope_methods}, \
-      .name                     = kMpcFrequency,                                     \
-      .measurement_type         = kMeasurementTypeTypeFrequency,                     \
-      .scope                    = kScopeTypeTypeACFrequency,                         \
-      .phases                   = NULL,                                              \
-      .get_measurement_strategy = GetFrequencyStrategy,                              \
+#define MA_MPC_MEASUREMENT_FREQUENCY                                            \
+  {                                                                             \
+      .obj                 = {.interface_ = &ma_mpc_measurement_scope_methods}, \
+      .name                = kMpcFrequency,                                     \
+      .measurement_type    = kMeasurementTypeTypeFrequency,                     \
+      .scope               = kScopeTypeTypeACFrequency,                         \
+      .phases              = NULL,                                              \
+      .resolve_id_strategy = ResolveFrequencyIdStrategy,                        \
   }
 
-static const MaMpcMeasurement measurement_table[] = {
+static const MaMpcMeasurement measurement_table[MA_MPC_MEASUREMENTS_NUM] = {
     MA_MPC_MEASUREMENT_POWER_TOTAL,
     MA_MPC_MEASUREMENT_POWER(kMpcPowerPhaseA, A),
     MA_MPC_MEASUREMENT_POWER(kMpcPowerPhaseB, B),
@@ -189,6 +198,14 @@ static const MaMpcMeasurement measurement_table[] = {
     MA_MPC_MEASUREMENT_FREQUENCY,
 };
 
+const MaMpcMeasurementObject* MaMpcMeasurementGetInstanceWithIndex(size_t idx) {
+  if (idx >= ARRAY_SIZE(measurement_table)) {
+    return NULL;
+  }
+
+  return MA_MPC_MEASUREMENT_OBJECT(&measurement_table[idx]);
+}
+
 const MaMpcMeasurementObject* MaMpcMeasurementGetInstanceWithNameId(MuMpcMeasurementNameId name) {
   for (size_t i = 0; i < ARRAY_SIZE(measurement_table); ++i) {
     if (measurement_table[i].name == name) {
@@ -261,7 +278,7 @@ EebusError GetPhasesWithMeasurementId(
   return kEebusErrorOk;
 }
 
-const MaMpcMeasurement* MaMpcMeasurementGetInstance(
+const MaMpcMeasurementObject* MaMpcMeasurementGetInstance(
     const MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
     const MeasurementDataType* measurement_data
@@ -297,28 +314,72 @@ const MaMpcMeasurement* MaMpcMeasurementGetInstance(
             phases,
             in_reference_to
         )) {
-      return &measurement_table[i];
+      return MA_MPC_MEASUREMENT_OBJECT(&measurement_table[i]);
+    }
+  }
+
+  return NULL;
+}
+
+const MeasurementDataType* MaMpcMeasurementGetDataWithId(
+    const MeasurementListDataType* measurement_list,
+    MeasurementIdType measurement_id,
+    size_t* pos
+) {
+  if (measurement_list == NULL) {
+    return NULL;
+  }
+
+  // Check the position the data was found at last time first, the list layout rarely changes
+  if ((pos != NULL) && (*pos < measurement_list->measurement_data_size)) {
+    const MeasurementDataType* const measurement_data = measurement_list->measurement_data[*pos];
+    if ((measurement_data != NULL) && (measurement_data->measurement_id != NULL)
+        && (*measurement_data->measurement_id == measurement_id)) {
+      return measurement_data;
+    }
+  }
+
+  for (size_t i = 0; i < measurement_list->measurement_data_size; ++i) {
+    const MeasurementDataType* const measurement_data = measurement_list->measurement_data[i];
+    if ((measurement_data != NULL) && (measurement_data->measurement_id != NULL)
+        && (*measurement_data->measurement_id == measurement_id)) {
+      if (pos != NULL) {
+        *pos = i;
+      }
+
+      return measurement_data;
     }
   }
 
   return NULL;
 }
 
-bool CheckPhaseSpecificData(
+EebusError MaMpcMeasurementGetValue(const MeasurementDataType* measurement_data, ScaledValue* value) {
+  if ((measurement_data == NULL) || (measurement_data->value == NULL) || (measurement_data->value->number == NULL)) {
+    return kEebusErrorNotAvailable;
+  }
+
+  // If the value state is set and not normal, the value is not valid and should be ignored
+  // therefore we return an error
+  if ((measurement_data->value_state != NULL) && (*measurement_data->value_state != kMeasurementValueStateTypeNormal)) {
+    return kEebusErrorInvalid;
+  }
+
+  value->value = *measurement_data->value->number;
+  value->scale = (measurement_data->value->scale != NULL) ? *measurement_data->value->scale : 0;
+  return kEebusErrorOk;
+}
+
+bool CheckPhaseSpecificDescription(
     const MaMpcMeasurement* measurement,
-    const MeasurementClient* mcl,
     const ElectricalConnectionClient* eccl,
     const EnergyDirectionType* energy_direction,
-    const MeasurementDataType* item
+    MeasurementIdType measurement_id
 ) {
-  if ((item->value == NULL) || (item->value->number == NULL) || (item->measurement_id == NULL)) {
-    return false;
-  }
-
   if (measurement->phases != NULL) {
     const ElectricalConnectionPhaseNameType* phases          = NULL;
     const ElectricalConnectionPhaseNameType* in_reference_to = NULL;
-    if (GetPhasesWithMeasurementId(eccl, *item->measurement_id, &phases, &in_reference_to) != kEebusErrorOk) {
+    if (GetPhasesWithMeasurementId(eccl, measurement_id, &phases, &in_reference_to) != kEebusErrorOk) {
       return false;
     }
 
@@ -329,7 +390,7 @@ bool CheckPhaseSpecificData(
 
   if (energy_direction != NULL) {
     const ElectricalConnectionParameterDescriptionDataType filter = {
-        .measurement_id = item->measurement_id,
+        .measurement_id = &measurement_id,
     };
 
     const ElectricalConnectionDescriptionDataType* description
@@ -346,21 +407,15 @@ bool CheckPhaseSpecificData(
     }
   }
 
-  // If the value state is set and not normal, the value is not valid and should be ignored
-  // therefore we return an error
-  if ((item->value_state != NULL) && (*item->value_state != kMeasurementValueStateTypeNormal)) {
-    return false;
-  }
-
   return true;
 }
 
-EebusError GetPhaseSpecificData(
+EebusError ResolvePhaseSpecificId(
     const MaMpcMeasurement* measurement,
     const MeasurementClient* mcl,
     const ElectricalConnectionClient* eccl,
     const EnergyDirectionType* energy_direction,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 ) {
   const MeasurementDescriptionDataType filter = {
       .measurement_type = &measurement->measurement_type,
@@ -373,116 +428,91 @@ EebusError GetPhaseSpecificData(
 
   for (; !EebusDataListMatchIteratorIsDone(&it); EebusDataListMatchIteratorNext(&it)) {
     const MeasurementDescriptionDataType* description = EebusDataListMatchIteratorGet(&it);
+    if (description->measurement_id == NULL) {
+      continue;
+    }
 
-    const MeasurementDataType filter2 = {
-        .measurement_id = description->measurement_id,
-    };
+    if (CheckPhaseSpecificDescription(measurement, eccl, energy_direction, *description->measurement_id)) {
+      *measurement_id = *description->measurement_id;
+      return kEebusErrorOk;
+    }
+  }
 
-    const MeasurementListDataType* const measurement_list = MeasurementCommonGetMeasurements(&mcl->measurement_common);
+  return kEebusErrorNotAvailable;
+}
 
-    EebusDataListMatchIterator it2 = {0};
-    HelperListMatchFirst(kFunctionTypeMeasurementListData, measurement_list, &filter2, &it2);
+EebusError ResolveUniqueId(
+    const MaMpcMeasurement* measurement,
+    const MeasurementClient* mcl,
+    MeasurementIdType* measurement_id
+) {
+  const MeasurementDescriptionDataType filter = {
+      .measurement_type = &measurement->measurement_type,
+      .commodity_type   = &(CommodityTypeType){kCommodityTypeTypeElectricity},
+      .scope_type       = &measurement->scope,
+  };
 
-    for (; !EebusDataListMatchIteratorIsDone(&it2); EebusDataListMatchIteratorNext(&it2)) {
-      const MeasurementDataType* const measurement_data = EebusDataListMatchIteratorGet(&it2);
-      if (CheckPhaseSpecificData(measurement, mcl, eccl, energy_direction, measurement_data)) {
-        value->value = *measurement_data->value->number;
-        value->scale = (measurement_data->value->scale != NULL) ? *measurement_data->value->scale : 0;
-        return kEebusErrorOk;
-      }
-    }
+  // Assume there is only one unique result
+  EebusDataListMatchIterator it = {0};
+  MeasurementCommonGetMeasurementDescriptionMatchFirst(&mcl->measurement_common, &filter, &it);
+  if (EebusDataListMatchIteratorIsDone(&it)) {
+    return kEebusErrorNotAvailable;
   }
 
-  return kEebusErrorNotAvailable;
+  const MeasurementDescriptionDataType* description = EebusDataListMatchIteratorGet(&it);
+  if (description->measurement_id == NULL) {
+    return kEebusErrorNotAvailable;
+  }
+
+  *measurement_id = *description->measurement_id;
+  return kEebusErrorOk;
 }
 
-EebusError GetPowerStrategy(
+EebusError ResolvePowerIdStrategy(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 ) {
   static const EnergyDirectionType energy_direction = kEnergyDirectionTypeConsume;
-  return GetPhaseSpecificData(measurement, mcl, eccl, &energy_direction, value);
+  return ResolvePhaseSpecificId(measurement, mcl, eccl, &energy_direction, measurement_id);
 }
 
-EebusError GetCurrentStrategy(
+EebusError ResolveCurrentIdStrategy(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 ) {
   static const EnergyDirectionType energy_direction = kEnergyDirectionTypeConsume;
-  return GetPhaseSpecificData(measurement, mcl, eccl, &energy_direction, value);
+  return ResolvePhaseSpecificId(measurement, mcl, eccl, &energy_direction, measurement_id);
 }
 
-EebusError GetEnergyStrategy(
+EebusError ResolveEnergyIdStrategy(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 ) {
-  const MeasurementDescriptionDataType filter = {
-      .measurement_type = &measurement->measurement_type,
-      .commodity_type   = &(CommodityTypeType){kCommodityTypeTypeElectricity},
-      .scope_type       = &measurement->scope,
-  };
-
-  // Assume there is only one unique result
-  const MeasurementDataType* const measurement_data
-      = MeasurementCommonGetMeasurementWithFilter(&mcl->measurement_common, &filter);
-  if ((measurement_data == NULL) || (measurement_data->value == NULL) || (measurement_data->value->number == NULL)) {
-    return kEebusErrorNotAvailable;
-  }
-
-  // If the value state is set and not normal, the value is not valid and should be ignored
-  // therefore we return an error
-  if ((measurement_data->value_state != NULL) && (*measurement_data->value_state != kMeasurementValueStateTypeNormal)) {
-    return kEebusErrorInvalid;
-  }
-
-  value->value = *measurement_data->value->number;
-  value->scale = (measurement_data->value->scale != NULL) ? *measurement_data->value->scale : 0;
-  return kEebusErrorOk;
+  return ResolveUniqueId(measurement, mcl, measurement_id);
 }
 
-EebusError GetVoltageStrategy(
+EebusError ResolveVoltageIdStrategy(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 ) {
-  return GetPhaseSpecificData(measurement, mcl, eccl, NULL, value);
+  return ResolvePhaseSpecificId(measurement, mcl, eccl, NULL, measurement_id);
 }
 
-EebusError GetFrequencyStrategy(
+EebusError ResolveFrequencyIdStrategy(
     const MaMpcMeasurement* measurement,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
-    ScaledValue* value
+    MeasurementIdType* measurement_id
 ) {
-  const MeasurementDescriptionDataType filter = {
-      .measurement_type = &(MeasurementTypeType){kMeasurementTypeTypeFrequency},
-      .commodity_type   = &(CommodityTypeType){kCommodityTypeTypeElectricity},
-      .scope_type       = &(ScopeTypeType){kScopeTypeTypeACFrequency},
-  };
-
-  const MeasurementDataType* const measurement_data
-      = MeasurementCommonGetMeasurementWithFilter(&mcl->measurement_common, &filter);
-
-  if ((measurement_data == NULL) || (measurement_data->value == NULL) || (measurement_data->value->number == NULL)) {
-    return kEebusErrorNotAvailable;
-  }
-
-  // If the value state is set and not normal,
-  // the value is not valid and should be ignored therefore an error is returned
-  if ((measurement_data->value_state != NULL) && (*measurement_data->value_state != kMeasurementValueStateTypeNormal)) {
-    return kEebusErrorInvalid;
-  }
-
-  value->value = *measurement_data->value->number;
-  value->scale = (measurement_data->value->scale != NULL) ? *measurement_data->value->scale : 0;
-  return kEebusErrorOk;
+  return ResolveUniqueId(measurement, mcl, measurement_id);
 }
 
 MuMpcMeasurementNameId GetName(const MaMpcMeasurementObject* self) {
@@ -490,13 +520,33 @@ MuMpcMeasurementNameId GetName(const MaMpcMeasurementObject* self) {
   return measurement->name;
 }
 
+EebusError ResolveMeasurementId(
+    const MaMpcMeasurementObject* self,
+    MeasurementClient* mcl,
+    ElectricalConnectionClient* eccl,
+    MeasurementIdType* measurement_id
+) {
+  const MaMpcMeasurement* const measurement = MA_MPC_MEASUREMENT(self);
+
+  return measurement->resolve_id_strategy(measurement, mcl, eccl, measurement_id);
+}
+
 EebusError GetDataValue(
     const MaMpcMeasurementObject* self,
     MeasurementClient* mcl,
     ElectricalConnectionClient* eccl,
     ScaledValue* measurement_value
 ) {
-  const MaMpcMeasurement* const measurement = MA_MPC_MEASUREMENT(self);
+  MeasurementIdType measurement_id = 0;
+
+  const EebusError err = ResolveMeasurementId(self, mcl, eccl, &measurement_id);
+  if (err != kEebusErrorOk) {
+    return err;
+  }
+
+  const MeasurementListDataType* const measurement_list = MeasurementCommonGetMeasurements(&mcl->measurement_common);
+  const MeasurementDataType* const measurement_data
+      = MaMpcMeasurementGetDataWithId(measurement_list, measurement_id, NULL);
 
-  return measurement->get_measurement_strategy(measurement, mcl, eccl, measurement_value);
+  return MaMpcMeasurementGetValue(measurement_data, measurement_value);
 }
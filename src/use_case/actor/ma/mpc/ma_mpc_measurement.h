@@ -26,10 +26,15 @@
 #include "src/use_case/specialization/electrical_connection/electrical_connection_client.h"
 #include "src/use_case/specialization/measurement/measurement_client.h"
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif  // __cplusplus
 
+/** Number of the MA MPC Measurement instances (one per each measurement name id) */
+#define MA_MPC_MEASUREMENTS_NUM 16
+
 /**
  * @brief Search for a MA MPC Measurement instance matching the given measurement data
  * @param mcl Measurement Client instance
@@ -50,6 +55,35 @@ const MaMpcMeasurementObject* MaMpcMeasurementGetInstance(
  */
 const MaMpcMeasurementObject* MaMpcMeasurementGetInstanceWithNameId(MuMpcMeasurementNameId name);
 
+/**
+ * @brief Get the MA MPC Measurement instance with the given position
+ * @param idx Instance position, shall be less than MA_MPC_MEASUREMENTS_NUM
+ * @return MA MPC Measurement instance or NULL if out of range
+ */
+const MaMpcMeasurementObject* MaMpcMeasurementGetInstanceWithIndex(size_t idx);
+
+/**
+ * @brief Search for the measurement data with the given measurement id
+ * @param measurement_list Measurement list to search in
+ * @param measurement_id Measurement id to search for
+ * @param pos Optional position hint, checked first and updated with the actual data position
+ * @return Measurement data or NULL if not found
+ */
+const MeasurementDataType* MaMpcMeasurementGetDataWithId(
+    const MeasurementListDataType* measurement_list,
+    MeasurementIdType measurement_id,
+    size_t* pos
+);
+
+/**
+ * @brief Get the scaled value of the measurement data
+ * @param measurement_data Measurement data to get the value from
+ * @param value Scaled value to be filled in
+ * @return kEebusErrorOk on success, kEebusErrorInvalid if the value state is not normal,
+ * kEebusErrorNotAvailable if there is no value
+ */
+EebusError MaMpcMeasurementGetValue(const MeasurementDataType* measurement_data, ScaledValue* value);
+
 #ifdef __cplusplus
 }
 #endif  // __cplusplus
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Ma Mpc Measurement Index implementation
+ */
+
+#include "src/use_case/actor/ma/mpc/ma_mpc_measurement_index.h"
+
+#include "src/common/array_util.h"
+#include "src/common/eebus_malloc.h"
+
+static void Resolve(MaMpcMeasurementIndex* self, MeasurementClient* mcl, ElectricalConnectionClient* eccl);
+static MaMpcMeasurementSlot* GetSlotWithName(
+    MaMpcMeasurementIndex* self,
+    MuMpcMeasurementNameId name,
+    MeasurementClient* mcl,
+    ElectricalConnectionClient* eccl
+);
+
+MaMpcMeasurementIndex* MaMpcMeasurementIndexCreate(void) {
+  MaMpcMeasurementIndex* const index = (MaMpcMeasurementIndex*)EEBUS_MALLOC(sizeof(MaMpcMeasurementIndex));
+  if (index == NULL) {
+    return NULL;
+  }
+
+  for (size_t i = 0; i < ARRAY_SIZE(index->slots); ++i) {
+    index->slots[i] = (MaMpcMeasurementSlot){
+        .measurement = MaMpcMeasurementGetInstanceWithIndex(i),
+    };
+  }
+
+  index->is_valid = false;
+  return index;
+}
+
+void MaMpcMeasurementIndexDelete(void* self) {
+  EEBUS_FREE(self);
+}
+
+void MaMpcMeasurementIndexInvalidate(MaMpcMeasurementIndex* self) {
+  self->is_valid = false;
+}
+
+void Resolve(MaMpcMeasurementIndex* self, MeasurementClient* mcl, ElectricalConnectionClient* eccl) {
+  for (size_t i = 0; i < ARRAY_SIZE(self->slots); ++i) {
+    MaMpcMeasurementSlot* const slot = &self->slots[i];
+
+    slot->is_resolved = false;
+    slot->data_pos    = 0;
+
+    if (slot->measurement == NULL) {
+      continue;
+    }
+
+    const EebusError err
+        = MA_MPC_MEASUREMENT_RESOLVE_MEASUREMENT_ID(slot->measurement, mcl, eccl, &slot->measurement_id);
+
+    slot->is_resolved = (err == kEebusErrorOk);
+  }
+
+  self->is_valid = true;
+}
+
+MaMpcMeasurementSlot* GetSlotWithName(
+    MaMpcMeasurementIndex* self,
+    MuMpcMeasurementNameId name,
+    MeasurementClient* mcl,
+    ElectricalConnectionClient* eccl
+) {
+  if (!self->is_valid) {
+    Resolve(self, mcl, eccl);
+  }
+
+  for (size_t i = 0; i < ARRAY_SIZE(self->slots); ++i) {
+    MaMpcMeasurementSlot* const slot = &self->slots[i];
+    if ((slot->measurement != NULL) && (MA_MPC_MEASUREMENT_GET_NAME(slot->measurement) == name)) {
+      return slot;
+    }
+  }
+
+  return NULL;
+}
+
+EebusError MaMpcMeasurementIndexGetDataValue(
+    MaMpcMeasurementIndex* self,
+    MuMpcMeasurementNameId name,
+    MeasurementClient* mcl,
+    ElectricalConnectionClient* eccl,
+    ScaledValue* value
+) {
+  MaMpcMeasurementSlot* const slot = GetSlotWithName(self, name, mcl, eccl);
+  if (slot == NULL) {
+    return kEebusErrorNotSupported;
+  }
+
+  if (!slot->is_resolved) {
+    return kEebusErrorNotAvailable;
+  }
+
+  const MeasurementListDataType* const measurement_list = MeasurementCommonGetMeasurements(&mcl->measurement_common);
+  const MeasurementDataType* const measurement_data
+      = MaMpcMeasurementGetDataWithId(measurement_list, slot->measurement_id, &slot->data_pos);
+
+  return MaMpcMeasurementGetValue(measurement_data, value);
+}
+
+const MaMpcMeasurementObject* MaMpcMeasurementIndexGetInstance(
+    MaMpcMeasurementIndex* self,
+    MeasurementClient* mcl,
+    ElectricalConnectionClient* eccl,
+    MeasurementIdType measurement_id
+) {
+  if (!self->is_valid) {
+    Resolve(self, mcl, eccl);
+  }
+
+  for (size_t i = 0; i < ARRAY_SIZE(self->slots); ++i) {
+    const MaMpcMeasurementSlot* const slot = &self->slots[i];
+    if (slot->is_resolved && (slot->measurement_id == measurement_id)) {
+      return slot->measurement;
+    }
+  }
+
+  return NULL;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Ma Mpc Measurement Index declarations
+ *
+ * The index keeps the measurement ids resolved from the remote entity descriptions,
+ * so that the measurement data lookup does not have to walk the descriptions on each call.
+ */
+
+#ifndef SRC_USE_CASE_ACTOR_MA_MPC_MA_MPC_MEASUREMENT_INDEX_H_
+#define SRC_USE_CASE_ACTOR_MA_MPC_MA_MPC_MEASUREMENT_INDEX_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "src/use_case/actor/ma/mpc/ma_mpc_measurement.h"
+#include "src/use_case/api/ma_mpc_measurement_interface.h"
+#include "src/use_case/specialization/electrical_connection/electrical_connection_client.h"
+#include "src/use_case/specialization/measurement/measurement_client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+typedef struct MaMpcMeasurementSlot MaMpcMeasurementSlot;
+
+struct MaMpcMeasurementSlot {
+  const MaMpcMeasurementObject* measurement;
+  /** Set if the remote entity provides the measurement */
+  bool is_resolved;
+  MeasurementIdType measurement_id;
+  /** Position of the measurement data within the measurement list it has been found at last time */
+  size_t data_pos;
+};
+
+typedef struct MaMpcMeasurementIndex MaMpcMeasurementIndex;
+
+struct MaMpcMeasurementIndex {
+  /** Cleared when the remote descriptions change, the slots are resolved again on next lookup */
+  bool is_valid;
+  MaMpcMeasurementSlot slots[MA_MPC_MEASUREMENTS_NUM];
+};
+
+/**
+ * @brief Create the empty (invalid) Measurement Index
+ * @return Measurement Index instance or NULL on memory allocation failure
+ */
+MaMpcMeasurementIndex* MaMpcMeasurementIndexCreate(void);
+
+/**
+ * @brief Release the Measurement Index, used as the entity look-up table value deleter
+ * @param self Measurement Index instance to be released
+ */
+void MaMpcMeasurementIndexDelete(void* self);
+
+/**
+ * @brief Mark the Measurement Index as outdated
+ * @param self Measurement Index instance
+ */
+void MaMpcMeasurementIndexInvalidate(MaMpcMeasurementIndex* self);
+
+/**
+ * @brief Get the measurement value using the resolved measurement id
+ * @param self Measurement Index instance
+ * @param name Measurement Name Id to get the value for
+ * @param mcl Measurement Client instance
+ * @param eccl Electrical Connection Client instance
+ * @param value Scaled value to be filled in
+ * @return kEebusErrorOk on success, error code otherwise
+ */
+EebusError MaMpcMeasurementIndexGetDataValue(
+    MaMpcMeasurementIndex* self,
+    MuMpcMeasurementNameId name,
+    MeasurementClient* mcl,
+    ElectricalConnectionClient* eccl,
+    ScaledValue* value
+);
+
+/**
+ * @brief Search for the MA MPC Measurement instance resolved to the given measurement id
+ * @param self Measurement Index instance
+ * @param mcl Measurement Client instance
+ * @param eccl Electrical Connection Client instance
+ * @param measurement_id Measurement id to search for
+ * @return MA MPC Measurement instance or NULL if not found
+ */
+const MaMpcMeasurementObject* MaMpcMeasurementIndexGetInstance(
+    MaMpcMeasurementIndex* self,
+    MeasurementClient* mcl,
+    ElectricalConnectionClient* eccl,
+    MeasurementIdType measurement_id
+);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // SRC_USE_CASE_ACTOR_MA_MPC_MA_MPC_MEASUREMENT_INDEX_H_
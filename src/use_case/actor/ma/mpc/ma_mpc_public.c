@@ -22,11 +22,11 @@
 
 #include "src/use_case/actor/ma/mpc/ma_mpc.h"
 #include "src/use_case/actor/ma/mpc/ma_mpc_internal.h"
-#include "src/use_case/actor/ma/mpc/ma_mpc_measurement.h"
+#include "src/use_case/actor/ma/mpc/ma_mpc_measurement_index.h"
 #include "src/use_case/use_case.h"
 
 EebusError MaMpcGetMeasurementDataInternal(
-    const MaMpcUseCase* self,
+    MaMpcUseCase* self,
     MuMpcMeasurementNameId measurement_name_id,
     const EntityAddressType* remote_entity_addr,
     ScaledValue* measurement_value
@@ -54,13 +54,12 @@ EebusError MaMpcGetMeasurementDataInternal(
     return err;
   }
 
-  const MaMpcMeasurementObject* const measurement = MaMpcMeasurementGetInstanceWithNameId(measurement_name_id);
-
-  if (measurement == NULL) {
-    return kEebusErrorNotSupported;
+  MaMpcMeasurementIndex* const index = MaMpcGetMeasurementIndex(self, remote_entity);
+  if (index == NULL) {
+    return kEebusErrorMemoryAllocate;
   }
 
-  return MA_MPC_MEASUREMENT_GET_DATA_VALUE(measurement, &mcl, &ecl, measurement_value);
+  return MaMpcMeasurementIndexGetDataValue(index, measurement_name_id, &mcl, &ecl, measurement_value);
 }
 
 EebusError MaMpcGetMeasurementData(
@@ -18,6 +18,7 @@
 
 #include "src/common/array_util.h"
 #include "src/common/eebus_mutex/eebus_mutex.h"
+#include "src/common/eebus_timer/eebus_timer.h"
 #include "src/use_case/actor/mu/mpc/mu_mpc_internal.h"
 #include "src/use_case/actor/mu/mpc/mu_mpc_measurement.h"
 #include "src/use_case/actor/mu/mpc/mu_mpc_monitor.h"
@@ -44,6 +45,7 @@ static EebusError MuMpcUseCaseConstruct(
 );
 
 static void AddFeatures(UseCaseObject* self, EntityLocalObject* entity);
+static bool IsPublishingTimed(const MuMpcUseCase* self);
 
 EebusError AddMuMpcScenario1(MuMpcUseCase* self, const MuMpcMonitorPowerConfig* power_cfg) {
   MuMpcMonitorObject* const power_monitor = MuMpcMonitorPowerCreate(power_cfg);
@@ -227,6 +229,17 @@ void AddFeatures(UseCaseObject* self, EntityLocalObject* entity) {
   MeasurementConstraintsDelete(measurement_constraints);
 }
 
+bool IsPublishingTimed(const MuMpcUseCase* self) {
+  for (size_t i = 0; i < VectorGetSize(&self->monitors); ++i) {
+    const MuMpcMonitorObject* const mu_mpc_monitor = (const MuMpcMonitorObject*)VectorGetElement(&self->monitors, i);
+    if (MU_MPC_MONITOR_IS_PUBLISHING_TIMED(mu_mpc_monitor)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 void MuMpcMonitorDeallocator(void* p) {
   MuMpcMonitorDelete((MuMpcMonitorObject*)p);
 }
@@ -244,6 +257,7 @@ EebusError MuMpcUseCaseConstruct(
   VectorConstructWithDeallocator(&self->monitors, MuMpcMonitorDeallocator);
 
   self->use_case_scenarios_size = 0;
+  self->publishing_timer        = NULL;
 
   self->mutex = EebusMutexCreate();
   if (self->mutex == NULL) {
@@ -301,6 +315,15 @@ EebusError MuMpcUseCaseConstruct(
 
   AddFeatures(USE_CASE_OBJECT(self), local_entity);
 
+  if (IsPublishingTimed(self)) {
+    self->publishing_timer = EebusTimerCreate(MuMpcPublishingTimerCallback, self);
+    if (self->publishing_timer == NULL) {
+      return kEebusErrorMemoryAllocate;
+    }
+
+    EEBUS_TIMER_START(self->publishing_timer, MU_MPC_PUBLISHING_TIMER_PERIOD_MS, true);
+  }
+
   return kEebusErrorOk;
 }
 
@@ -326,6 +349,12 @@ MuMpcUseCaseCreate(EntityLocalObject* local_entity, ElectricalConnectionIdType e
 void Destruct(UseCaseObject* self) {
   MuMpcUseCase* const mu_mpc_use_case = MU_MPC_USE_CASE(self);
 
+  if (mu_mpc_use_case->publishing_timer != NULL) {
+    EEBUS_TIMER_STOP(mu_mpc_use_case->publishing_timer);
+    EebusTimerDelete(mu_mpc_use_case->publishing_timer);
+    mu_mpc_use_case->publishing_timer = NULL;
+  }
+
   EebusMutexDelete(mu_mpc_use_case->mutex);
   mu_mpc_use_case->mutex = NULL;
 
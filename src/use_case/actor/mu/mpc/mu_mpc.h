@@ -49,6 +49,16 @@
  * // MuMpcSetMeasurementDataCache(mu_mpc, kMpcPowerTotal, &(ScaledValue){1000, 0}, timestamp, value_src)
  * // are skipped.
  * @endcode
+ * Measurements sampled together can be applied with a single call, only the changed ones are sent:
+ * @code{.c}
+ * const MuMpcMeasurementSample samples[] = {
+ *     {kMpcCurrentPhaseA, {33, -1}, &timestamp, NULL},
+ *     {kMpcCurrentPhaseB, {35, -1}, &timestamp, NULL},
+ *     {kMpcCurrentPhaseC, {31, -1}, &timestamp, NULL},
+ * };
+ *
+ * MuMpcUpdateMeasurementData(mu_mpc, samples, ARRAY_SIZE(samples));
+ * @endcode
  */
 
 #ifndef SRC_USE_CASE_ACTOR_MU_MPC_MU_MPC_H_
@@ -84,6 +94,25 @@ struct MuMpcConfig {
   const MuMpcMonitorFrequencyConfig* frequency_cfg;
 };
 
+/**
+ * @brief Mu Mpc Measurement Sample to be passed to MuMpcUpdateMeasurementData()
+ */
+typedef struct MuMpcMeasurementSample MuMpcMeasurementSample;
+
+/**
+ * @brief Mu Mpc Measurement Sample structure
+ */
+struct MuMpcMeasurementSample {
+  /** The measurement name id to set the value for */
+  MuMpcMeasurementNameId name;
+  /** The value to set for the measurement */
+  ScaledValue value;
+  /** Measurement timestamp, can be NULL */
+  const EebusDateTime* timestamp;
+  /** Value state which shall be set if it differs from the normal, set NULL otherwise */
+  const MeasurementValueStateType* value_state;
+};
+
 typedef struct MuMpcUseCaseObject MuMpcUseCaseObject;
 
 struct MuMpcUseCaseObject {
@@ -177,6 +206,23 @@ EebusError MuMpcSetMeasurementDataCache(
  */
 EebusError MuMpcUpdate(const MuMpcUseCaseObject* self);
 
+/**
+ * @brief Set a batch of measurements data in MU MPC cache and push the changed ones to the local feature
+ * at once. Equivalent to the sequence of MuMpcSetMeasurementDataCache() calls followed by MuMpcUpdate(),
+ * but the cache is locked once per batch. Measurements which values, timestamp and value state are
+ * equal to the already applied ones are not sent again
+ * @param self MU MPC Use Case instance to set the measurements for
+ * @param samples Array of measurement samples, see MuMpcSetMeasurementDataCache() for the supported names
+ * @param samples_size Number of the samples in array
+ * @return EebusError indicating the result of the operation. If any of samples is not supported,
+ * the processing stops with kEebusErrorNotSupported and the update is not triggered
+ */
+EebusError MuMpcUpdateMeasurementData(
+    MuMpcUseCaseObject* self,
+    const MuMpcMeasurementSample* samples,
+    size_t samples_size
+);
+
 /**
  * @brief Set the total energy consumed value in MU MPC cache. This data value will be applied
  * to the local feature fith following remotes update when MuMpcUpdate() is triggered
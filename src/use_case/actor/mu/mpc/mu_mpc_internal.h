@@ -20,12 +20,19 @@
 #include <stddef.h>
 
 #include "src/common/api/eebus_mutex_interface.h"
+#include "src/common/api/eebus_timer_interface.h"
 #include "src/spine/model/measurement_types.h"
 #include "src/use_case/actor/mu/mpc/mu_mpc_measurement.h"
 #include "src/use_case/actor/mu/mpc/mu_mpc_monitor.h"
 #include "src/use_case/api/types.h"
 #include "src/use_case/use_case.h"
 
+/** Total number of the measurements within all of the MU MPC scenarios */
+#define MU_MPC_MEASUREMENTS_MAX_NUM 16
+
+/** Publishing timer period in ms, the resolution of the timed publishing policies */
+#define MU_MPC_PUBLISHING_TIMER_PERIOD_MS 1000
+
 typedef struct MuMpcUseCase MuMpcUseCase;
 
 struct MuMpcUseCase {
@@ -42,8 +49,17 @@ struct MuMpcUseCase {
   UseCaseInfo mu_mpc_use_case_info;
 
   EebusMutexObject* mutex;
+
+  /** Created only if any of the measurements has the timed publishing policy */
+  EebusTimerObject* publishing_timer;
 };
 
 #define MU_MPC_USE_CASE(self) ((MuMpcUseCase*)(self))
 
+/**
+ * @brief Publishing timer callback. Publishes the changes held back by the minimum interval
+ * and refreshes the measurements silent for longer than the maximum silence
+ */
+void MuMpcPublishingTimerCallback(void* ctx);
+
 #endif  // SRC_USE_CASE_ACTOR_MU_MPC_MU_MPC_INTERNAL_H_
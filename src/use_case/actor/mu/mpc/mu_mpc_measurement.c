@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "src/common/array_util.h"
@@ -56,8 +58,33 @@ struct MuMpcMeasurement {
   MeasurementConstraintsDataType* constraints;
   /** The strategy to configure the measurement scope */
   MeasurementConfigurationStrategy cfg_strategy;
-  /** Cache for the measurement data */
-  MeasurementDataType* measurement_data;
+  /** Cache for the measurement data, all of the pointers refer to the preallocated slot members below */
+  MeasurementDataType measurement_data;
+  /** Set when the cached data differs from the data flushed last time */
+  bool is_changed;
+  /** Set when the cache contains any data */
+  bool has_data;
+  /** Set when the cached data has been flushed and is waiting for the commit */
+  bool is_flushed;
+  /** Preallocated measurement data cache slot */
+  MeasurementValueTypeType value_type;
+  NumberType number;
+  ScaleType scale;
+  ScaledNumberType value;
+  AbsoluteOrRelativeTimeType timestamp;
+  MeasurementValueStateType value_state;
+  AbsoluteOrRelativeTimeType start_time;
+  AbsoluteOrRelativeTimeType end_time;
+  TimePeriodType evaluation_period;
+  /** The publishing policy, applied if has_publishing_policy is set only */
+  MuMpcPublishingPolicy publishing_policy;
+  bool has_publishing_policy;
+  /** Set when the cache has been published at least once */
+  bool is_published;
+  /** The last published value, value state and publication monotonic time */
+  ScaledValue published_value;
+  MeasurementValueStateType published_value_state;
+  uint64_t published_time_ms;
 };
 
 #define MEASUREMENT(obj) ((MuMpcMeasurement*)(obj))
@@ -81,16 +108,20 @@ static EebusError SetDataCache(
     const EebusDateTime* start_time,
     const EebusDateTime* end_time
 );
-static MeasurementDataType* ReleaseDataCache(MuMpcMeasurementObject* self);
+static bool IsPublishingTimed(const MuMpcMeasurementObject* self);
+static const MeasurementDataType* FlushDataCache(MuMpcMeasurementObject* self, uint64_t now_ms, bool timed_only);
+static void CommitDataCache(MuMpcMeasurementObject* self, uint64_t now_ms);
 
 static const MuMpcMeasurementInterface measurement_scope_methods = {
-    .destruct           = Destruct,
-    .get_name           = GetName,
-    .get_data_value     = GetDataValue,
-    .get_constraints    = GetConstraints,
-    .configure          = Configure,
-    .set_data_cache     = SetDataCache,
-    .release_data_cache = ReleaseDataCache,
+    .destruct            = Destruct,
+    .get_name            = GetName,
+    .get_data_value      = GetDataValue,
+    .get_constraints     = GetConstraints,
+    .configure           = Configure,
+    .set_data_cache      = SetDataCache,
+    .is_publishing_timed = IsPublishingTimed,
+    .flush_data_cache    = FlushDataCache,
+    .commit_data_cache   = CommitDataCache,
 };
 
 static EebusError MuMpcMeasurementConstruct(
@@ -101,6 +132,16 @@ static EebusError MuMpcMeasurementConstruct(
     const MuMpcMeasurementConfig* cfg,
     MeasurementConfigurationStrategy cfg_strategy
 );
+static bool IsTimeEqual(const AbsoluteOrRelativeTimeType* time, const EebusDateTime* date_time);
+static MeasurementValueStateType GetValueState(const MeasurementDataType* data);
+static int64_t ScaleNumber(int64_t number, int8_t scale, int8_t target_scale);
+static uint64_t GetMagnitude(int64_t number);
+static uint64_t GetDistance(int64_t a, int64_t b);
+static uint64_t MultiplySaturated(uint64_t a, uint64_t b);
+static uint64_t GetRelativeDeadband(uint64_t magnitude, uint32_t permille);
+static bool HasElapsed(uint64_t since_ms, uint32_t interval_s, uint64_t now_ms);
+static bool IsSignificantChange(const MuMpcMeasurement* self);
+static bool IsPublishingDue(const MuMpcMeasurement* self, uint64_t now_ms);
 
 EebusError MuMpcMeasurementConstruct(
     MuMpcMeasurement* self,
@@ -120,12 +161,28 @@ EebusError MuMpcMeasurementConstruct(
   self->value_source     = 0;
   self->constraints      = NULL;
   self->cfg_strategy     = cfg_strategy;
-  self->measurement_data = NULL;
+  self->is_changed       = false;
+  self->has_data         = false;
+  self->is_flushed       = false;
+  self->is_published     = false;
+  self->value_type       = kMeasurementValueTypeTypeValue;
+  self->value            = (ScaledNumberType){.number = &self->number, .scale = &self->scale};
+  self->measurement_data = (MeasurementDataType){
+      .measurement_id = &self->id,
+      .value_type     = &self->value_type,
+      .value          = &self->value,
+      .value_source   = &self->value_source,
+  };
 
   if (cfg == NULL) {
     return kEebusErrorInputArgumentNull;
   }
 
+  self->has_publishing_policy = (cfg->publishing_policy != NULL);
+  if (self->has_publishing_policy) {
+    self->publishing_policy = *cfg->publishing_policy;
+  }
+
   if (cfg->constraints != NULL) {
     self->constraints = MeasurementConstraintsDataCopy(cfg->constraints);
     if (self->constraints == NULL) {
@@ -162,9 +219,6 @@ void Destruct(MuMpcMeasurementObject* self) {
 
   MeasurementConstraintsDataDelete(measurement->constraints);
   measurement->constraints = NULL;
-
-  MeasurementDataDelete(measurement->measurement_data);
-  measurement->measurement_data = NULL;
 }
 
 MuMpcMeasurementNameId GetName(const MuMpcMeasurementObject* self) {
@@ -221,6 +275,14 @@ EebusError Configure(
   return err;
 }
 
+bool IsTimeEqual(const AbsoluteOrRelativeTimeType* time, const EebusDateTime* date_time) {
+  if ((time == NULL) || (date_time == NULL)) {
+    return (time == NULL) && (date_time == NULL);
+  }
+
+  return EebusDateTimeCompare(&time->date_time, date_time) == 0;
+}
+
 EebusError SetDataCache(
     MuMpcMeasurementObject* self,
     const ScaledValue* measured_value,
@@ -230,49 +292,217 @@ EebusError SetDataCache(
     const EebusDateTime* end_time
 ) {
   MuMpcMeasurement* const measurement = MEASUREMENT(self);
+  MeasurementDataType* const data     = &measurement->measurement_data;
 
   if (measured_value == NULL) {
     return kEebusErrorInputArgumentNull;
   }
 
-  // If measurement data already exists, release it
-  MeasurementDataDelete(measurement->measurement_data);
+  // The evaluation period is only set if both of the start and end times are given
+  if ((start_time == NULL) || (end_time == NULL)) {
+    start_time = NULL;
+    end_time   = NULL;
+  }
+
+  const TimePeriodType* const period = data->evaluation_period;
+
+  // Nothing has to be sent again if the cache already contains the same data
+  const bool is_equal = measurement->has_data && (measurement->number == measured_value->value)
+                        && (measurement->scale == measured_value->scale) && IsTimeEqual(data->timestamp, timestamp)
+                        && ((data->value_state == NULL) == (value_state == NULL))
+                        && ((value_state == NULL) || (*data->value_state == *value_state))
+                        && IsTimeEqual((period != NULL) ? period->start_time : NULL, start_time)
+                        && IsTimeEqual((period != NULL) ? period->end_time : NULL, end_time);
+  if (is_equal) {
+    return kEebusErrorOk;
+  }
 
-  const AbsoluteOrRelativeTimeType* const start_time_tmp = ABSOLUTE_OR_RELATIVE_TIME_PTR(start_time);
-  const AbsoluteOrRelativeTimeType* const end_time_tmp   = ABSOLUTE_OR_RELATIVE_TIME_PTR(end_time);
+  measurement->number = measured_value->value;
+  measurement->scale  = measured_value->scale;
 
-  const TimePeriodType* const evaluation_period_tmp
-      = ((start_time_tmp != NULL) && (end_time_tmp != NULL))
-            ? &(TimePeriodType){.start_time = start_time_tmp, .end_time = end_time_tmp}
-            : NULL;
+  data->timestamp = NULL;
+  if (timestamp != NULL) {
+    measurement->timestamp = (AbsoluteOrRelativeTimeType){
+        .type      = kAbsoluteOrRelativeTimeTypeDateTime,
+        .date_time = *timestamp,
+    };
 
-  const MeasurementDataType measurement_data_new = {
-      .measurement_id    = &measurement->id,
-      .value_type        = &(MeasurementValueTypeType){kMeasurementValueTypeTypeValue},
-      .timestamp         = ABSOLUTE_OR_RELATIVE_TIME_PTR(timestamp),
-      .value             = &(ScaledNumberType){.number = &measured_value->value, .scale = &measured_value->scale},
-      .evaluation_period = evaluation_period_tmp,
-      .value_source      = &measurement->value_source,
-      .value_tendency    = NULL,
-      .value_state       = value_state,
-  };
+    data->timestamp = &measurement->timestamp;
+  }
+
+  data->value_state = NULL;
+  if (value_state != NULL) {
+    measurement->value_state = *value_state;
+    data->value_state        = &measurement->value_state;
+  }
 
-  measurement->measurement_data = MeasurementDataCopy(&measurement_data_new);
-  if (measurement->measurement_data == NULL) {
-    return kEebusErrorMemoryAllocate;
+  data->evaluation_period = NULL;
+  if (start_time != NULL) {
+    measurement->start_time = (AbsoluteOrRelativeTimeType){
+        .type      = kAbsoluteOrRelativeTimeTypeDateTime,
+        .date_time = *start_time,
+    };
+
+    measurement->end_time = (AbsoluteOrRelativeTimeType){
+        .type      = kAbsoluteOrRelativeTimeTypeDateTime,
+        .date_time = *end_time,
+    };
+
+    measurement->evaluation_period = (TimePeriodType){
+        .start_time = &measurement->start_time,
+        .end_time   = &measurement->end_time,
+    };
+
+    data->evaluation_period = &measurement->evaluation_period;
   }
 
+  measurement->has_data   = true;
+  measurement->is_changed = true;
   return kEebusErrorOk;
 }
 
-MeasurementDataType* ReleaseDataCache(MuMpcMeasurementObject* self) {
+MeasurementValueStateType GetValueState(const MeasurementDataType* data) {
+  return (data->value_state != NULL) ? *data->value_state : kMeasurementValueStateTypeNormal;
+}
+
+int64_t ScaleNumber(int64_t number, int8_t scale, int8_t target_scale) {
+  for (; (scale > target_scale) && (number != 0); --scale) {
+    // Saturate instead of overflow, the values out of range are far off any deadband anyway
+    if (number > INT64_MAX / 10) {
+      return INT64_MAX;
+    }
+
+    if (number < INT64_MIN / 10) {
+      return INT64_MIN;
+    }
+
+    number *= 10;
+  }
+
+  return number;
+}
+
+uint64_t GetMagnitude(int64_t number) {
+  return (number < 0) ? (0 - (uint64_t)number) : (uint64_t)number;
+}
+
+uint64_t GetDistance(int64_t a, int64_t b) {
+  return (a >= b) ? ((uint64_t)a - (uint64_t)b) : ((uint64_t)b - (uint64_t)a);
+}
+
+uint64_t MultiplySaturated(uint64_t a, uint64_t b) {
+  if ((a != 0) && (b > UINT64_MAX / a)) {
+    return UINT64_MAX;
+  }
+
+  return a * b;
+}
+
+uint64_t GetRelativeDeadband(uint64_t magnitude, uint32_t permille) {
+  // floor(magnitude * permille / 1000) without the intermediate overflow
+  const uint64_t whole    = MultiplySaturated(magnitude / 1000, permille);
+  const uint64_t fraction = (magnitude % 1000) * permille / 1000;
+  return (whole > UINT64_MAX - fraction) ? UINT64_MAX : whole + fraction;
+}
+
+bool HasElapsed(uint64_t since_ms, uint32_t interval_s, uint64_t now_ms) {
+  return now_ms - since_ms >= (uint64_t)interval_s * 1000;
+}
+
+bool IsSignificantChange(const MuMpcMeasurement* self) {
+  const MuMpcPublishingPolicy* const policy = &self->publishing_policy;
+
+  if (GetValueState(&self->measurement_data) != self->published_value_state) {
+    return true;
+  }
+
+  // Bring the values to the common (finest) scale prior to comparison
+  int8_t scale = self->scale;
+  if (self->published_value.scale < scale) {
+    scale = self->published_value.scale;
+  }
+
+  if (policy->absolute_deadband.scale < scale) {
+    scale = policy->absolute_deadband.scale;
+  }
+
+  const int64_t value     = ScaleNumber(self->number, self->scale, scale);
+  const int64_t published = ScaleNumber(self->published_value.value, self->published_value.scale, scale);
+  const int64_t deadband  = ScaleNumber(policy->absolute_deadband.value, policy->absolute_deadband.scale, scale);
+
+  const uint64_t delta = GetDistance(value, published);
+  if (delta <= GetMagnitude(deadband)) {
+    return false;
+  }
+
+  return delta > GetRelativeDeadband(GetMagnitude(published), policy->relative_deadband_permille);
+}
+
+bool IsPublishingDue(const MuMpcMeasurement* self, uint64_t now_ms) {
+  const MuMpcPublishingPolicy* const policy = &self->publishing_policy;
+
+  if ((policy->max_silence_s != 0) && HasElapsed(self->published_time_ms, policy->max_silence_s, now_ms)) {
+    return true;  // Forced refresh
+  }
+
+  if (!self->is_changed) {
+    return false;
+  }
+
+  // Keep the change pending until the minimum interval elapses
+  if ((policy->min_interval_s != 0) && !HasElapsed(self->published_time_ms, policy->min_interval_s, now_ms)) {
+    return false;
+  }
+
+  return IsSignificantChange(self);
+}
+
+bool IsPublishingTimed(const MuMpcMeasurementObject* self) {
+  const MuMpcMeasurement* const measurement = MEASUREMENT(self);
+  const MuMpcPublishingPolicy* const policy = &measurement->publishing_policy;
+
+  return measurement->has_publishing_policy && ((policy->min_interval_s != 0) || (policy->max_silence_s != 0));
+}
+
+const MeasurementDataType* FlushDataCache(MuMpcMeasurementObject* self, uint64_t now_ms, bool timed_only) {
   MuMpcMeasurement* const measurement = MEASUREMENT(self);
 
-  MeasurementDataType* const measurement_data = measurement->measurement_data;
+  measurement->is_flushed = false;
+
+  if (!measurement->has_data) {
+    return NULL;
+  }
+
+  // The other changes wait for the application update
+  if (timed_only && !(IsPublishingTimed(self) && measurement->is_published)) {
+    return NULL;
+  }
 
-  measurement->measurement_data = NULL;
+  if (measurement->has_publishing_policy && measurement->is_published) {
+    if (!IsPublishingDue(measurement, now_ms)) {
+      return NULL;
+    }
+  } else if (!measurement->is_changed) {
+    return NULL;
+  }
+
+  measurement->is_flushed = true;
+  return &measurement->measurement_data;
+}
+
+void CommitDataCache(MuMpcMeasurementObject* self, uint64_t now_ms) {
+  MuMpcMeasurement* const measurement = MEASUREMENT(self);
+
+  if (!measurement->is_flushed) {
+    return;
+  }
 
-  return measurement_data;
+  measurement->is_flushed            = false;
+  measurement->is_changed            = false;
+  measurement->is_published          = true;
+  measurement->published_value       = (ScaledValue){.value = measurement->number, .scale = measurement->scale};
+  measurement->published_value_state = GetValueState(&measurement->measurement_data);
+  measurement->published_time_ms     = now_ms;
 }
 
 //-------------------------------------------------------------------------------------------//
@@ -27,6 +27,7 @@
 #define SRC_USE_CASE_ACTOR_MU_MPC_MEASUREMENT_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "src/common/eebus_errors.h"
 #include "src/common/eebus_malloc.h"
@@ -37,7 +38,36 @@ extern "C" {
 #endif  // __cplusplus
 
 /**
- * @brief Measurement configuration containing value source and constraints.
+ * @brief Measurement publishing policy. Allows to skip sending the insignificant value changes
+ * to the remote subscribers. All of the criteria are optional and disabled with zero
+ */
+typedef struct MuMpcPublishingPolicy MuMpcPublishingPolicy;
+
+/**
+ * @brief Measurement publishing policy structure
+ */
+struct MuMpcPublishingPolicy {
+  /** The value is published only if differs from the last published one by more than the absolute deadband */
+  ScaledValue absolute_deadband;
+  /**
+   * The value is published only if differs from the last published one by more than
+   * the relative deadband, in per mille of the last published value
+   */
+  uint32_t relative_deadband_permille;
+  /**
+   * Minimum interval between two consecutive publications in seconds.
+   * The change held back is published by the publishing timer once the interval elapses
+   */
+  uint32_t min_interval_s;
+  /**
+   * Maximum silence in seconds, the cached value is published by the publishing timer once this interval
+   * elapses since the previous publication, even if it is not significant
+   */
+  uint32_t max_silence_s;
+};
+
+/**
+ * @brief Measurement configuration containing value source, constraints and publishing policy.
  */
 typedef struct MuMpcMeasurementConfig MuMpcMeasurementConfig;
 
@@ -49,6 +79,8 @@ struct MuMpcMeasurementConfig {
   MeasurementValueSourceType value_source;
   /** The constraints for the current values (optional can be NULL) */
   MeasurementConstraintsDataType* constraints;
+  /** The publishing policy (optional can be NULL, every change is published then) */
+  const MuMpcPublishingPolicy* publishing_policy;
 };
 
 /**
@@ -49,14 +49,25 @@ static EebusError Configure(
 );
 static MuMpcMeasurementObject*
 GetMeasurement(const MuMpcMonitorObject* self, MuMpcMeasurementNameId measurement_name_id);
-static EebusError FlushMeasurementCache(MuMpcMonitorObject* self, MeasurementListDataType* measurement_data_list);
+static bool IsPublishingTimed(const MuMpcMonitorObject* self);
+static EebusError FlushMeasurementCache(
+    MuMpcMonitorObject* self,
+    uint64_t now_ms,
+    bool timed_only,
+    const MeasurementDataType** measurement_data,
+    size_t measurement_data_capacity,
+    size_t* measurement_data_size
+);
+static void CommitMeasurementCache(MuMpcMonitorObject* self, uint64_t now_ms);
 
 static const MuMpcMonitorInterface mu_mpc_monitor_methods = {
-    .destruct                = Destruct,
-    .get_name                = GetName,
-    .configure               = Configure,
-    .get_measurement         = GetMeasurement,
-    .flush_measurement_cache = FlushMeasurementCache,
+    .destruct                 = Destruct,
+    .get_name                 = GetName,
+    .configure                = Configure,
+    .get_measurement          = GetMeasurement,
+    .is_publishing_timed      = IsPublishingTimed,
+    .flush_measurement_cache  = FlushMeasurementCache,
+    .commit_measurement_cache = CommitMeasurementCache,
 };
 
 typedef struct MeasurementParameters {
@@ -208,34 +219,59 @@ MuMpcMeasurementObject* GetMeasurement(const MuMpcMonitorObject* self, MuMpcMeas
   return NULL;
 }
 
-EebusError FlushMeasurementCache(MuMpcMonitorObject* self, MeasurementListDataType* measurement_data_list) {
+bool IsPublishingTimed(const MuMpcMonitorObject* self) {
+  const MuMpcMonitor* const monitor = MU_MPC_MONITOR(self);
+
+  for (size_t i = 0; i < VectorGetSize(&monitor->measurements); ++i) {
+    const MuMpcMeasurementObject* const measurement
+        = (const MuMpcMeasurementObject*)VectorGetElement(&monitor->measurements, i);
+    if (MU_MPC_MEASUREMENT_IS_PUBLISHING_TIMED(measurement)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+EebusError FlushMeasurementCache(
+    MuMpcMonitorObject* self,
+    uint64_t now_ms,
+    bool timed_only,
+    const MeasurementDataType** measurement_data,
+    size_t measurement_data_capacity,
+    size_t* measurement_data_size
+) {
   MuMpcMonitor* const monitor = MU_MPC_MONITOR(self);
 
-  if (measurement_data_list == NULL) {
+  if ((measurement_data == NULL) || (measurement_data_size == NULL)) {
     return kEebusErrorInputArgumentNull;
   }
 
   for (size_t i = 0; i < VectorGetSize(&monitor->measurements); ++i) {
     MuMpcMeasurementObject* const measurement = (MuMpcMeasurementObject*)VectorGetElement(&monitor->measurements, i);
 
-    MeasurementDataType* data = MU_MPC_MEASUREMENT_RELEASE_DATA_CACHE(measurement);
+    const MeasurementDataType* const data = MU_MPC_MEASUREMENT_FLUSH_DATA_CACHE(measurement, now_ms, timed_only);
     if (data != NULL) {
-      EebusError err = EebusDataListDataAppend(
-          (void***)&measurement_data_list->measurement_data,
-          &measurement_data_list->measurement_data_size,
-          data
-      );
-
-      if (err != kEebusErrorOk) {
-        MeasurementDataDelete(data);
-        return err;
+      if (*measurement_data_size >= measurement_data_capacity) {
+        return kEebusErrorInputSize;
       }
+
+      measurement_data[(*measurement_data_size)++] = data;
     }
   }
 
   return kEebusErrorOk;
 }
 
+void CommitMeasurementCache(MuMpcMonitorObject* self, uint64_t now_ms) {
+  MuMpcMonitor* const monitor = MU_MPC_MONITOR(self);
+
+  for (size_t i = 0; i < VectorGetSize(&monitor->measurements); ++i) {
+    MuMpcMeasurementObject* const measurement = (MuMpcMeasurementObject*)VectorGetElement(&monitor->measurements, i);
+    MU_MPC_MEASUREMENT_COMMIT_DATA_CACHE(measurement, now_ms);
+  }
+}
+
 //-------------------------------------------------------------------------------------------//
 //
 // MuMpcMonitorPower Object Creation (Scenario 1)
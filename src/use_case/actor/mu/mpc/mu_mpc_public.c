@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "src/common/array_util.h"
+#include "src/common/eebus_timer/eebus_timer.h"
 #include "src/use_case/actor/mu/mpc/mu_mpc.h"
 #include "src/use_case/actor/mu/mpc/mu_mpc_internal.h"
 #include "src/use_case/api/types.h"
@@ -130,9 +131,34 @@ EebusError MuMpcSetMeasurementDataCache(
   );
 }
 
-EebusError MuMpcUpdate(const MuMpcUseCaseObject* self) {
-  UseCase* const use_case    = USE_CASE(self);
-  MuMpcUseCase* const mu_mpc = MU_MPC_USE_CASE(self);
+EebusError MuMpcUpdateInternal(MuMpcUseCase* self, bool timed_only) {
+  UseCase* const use_case = USE_CASE(self);
+
+  // The wall clock can be adjusted at any time, the policy intervals are measured with the monotonic one
+  const uint64_t now_ms = EebusTimerGetMonotonicTimeMs();
+
+  const MeasurementDataType* measurement_data[MU_MPC_MEASUREMENTS_MAX_NUM];
+  size_t measurement_data_size = 0;
+
+  for (size_t i = 0; i < VectorGetSize(&self->monitors); ++i) {
+    MuMpcMonitorObject* const mu_mpc_monitor = (MuMpcMonitorObject*)VectorGetElement(&self->monitors, i);
+
+    const EebusError err = MU_MPC_MONITOR_FLUSH_MEASUREMENT_CACHE(
+        mu_mpc_monitor,
+        now_ms,
+        timed_only,
+        measurement_data,
+        ARRAY_SIZE(measurement_data),
+        &measurement_data_size
+    );
+    if (err != kEebusErrorOk) {
+      return err;
+    }
+  }
+
+  if (measurement_data_size == 0) {
+    return kEebusErrorOk;
+  }
 
   MeasurementServer msrv = {0};
 
@@ -141,31 +167,84 @@ EebusError MuMpcUpdate(const MuMpcUseCaseObject* self) {
     return err;
   }
 
-  MeasurementListDataType* const measurement_data_list = MeasurementsCreateEmpty();
-  if (measurement_data_list == NULL) {
-    return kEebusErrorMemoryAllocate;
+  const MeasurementListDataType measurement_data_list = {measurement_data, measurement_data_size};
+
+  DEVICE_LOCAL_LOCK(use_case->local_device);
+  err = MeasurementServerUpdateMeasurements(&msrv, &measurement_data_list, NULL, NULL);
+  DEVICE_LOCAL_UNLOCK(use_case->local_device);
+
+  if (err != kEebusErrorOk) {
+    return err;  // Keep the changes pending, so they are retried with the next update
   }
 
-  EEBUS_MUTEX_LOCK(mu_mpc->mutex);
-  for (size_t i = 0; i < VectorGetSize(&mu_mpc->monitors); ++i) {
-    MuMpcMonitorObject* const mu_mpc_monitor = (MuMpcMonitorObject*)VectorGetElement(&mu_mpc->monitors, i);
-    EebusError err = MU_MPC_MONITOR_FLUSH_MEASUREMENT_CACHE(mu_mpc_monitor, measurement_data_list);
-    if (err != kEebusErrorOk) {
-      EEBUS_MUTEX_UNLOCK(mu_mpc->mutex);
-      return err;
-    }
+  for (size_t i = 0; i < VectorGetSize(&self->monitors); ++i) {
+    MuMpcMonitorObject* const mu_mpc_monitor = (MuMpcMonitorObject*)VectorGetElement(&self->monitors, i);
+    MU_MPC_MONITOR_COMMIT_MEASUREMENT_CACHE(mu_mpc_monitor, now_ms);
   }
 
+  return kEebusErrorOk;
+}
+
+EebusError MuMpcUpdate(const MuMpcUseCaseObject* self) {
+  MuMpcUseCase* const mu_mpc = MU_MPC_USE_CASE(self);
+
+  EebusError err = kEebusErrorOk;
+
+  // The flushed data refers to the measurement cache slots, keep them untouched until the update is done
+  EEBUS_MUTEX_LOCK(mu_mpc->mutex);
+  err = MuMpcUpdateInternal(mu_mpc, false);
   EEBUS_MUTEX_UNLOCK(mu_mpc->mutex);
 
-  if (measurement_data_list->measurement_data_size > 0) {
-    DEVICE_LOCAL_LOCK(use_case->local_device);
-    err = MeasurementServerUpdateMeasurements(&msrv, measurement_data_list, NULL, NULL);
-    DEVICE_LOCAL_UNLOCK(use_case->local_device);
+  return err;
+}
+
+void MuMpcPublishingTimerCallback(void* ctx) {
+  MuMpcUseCase* const mu_mpc = MU_MPC_USE_CASE(ctx);
+
+  EEBUS_MUTEX_LOCK(mu_mpc->mutex);
+  MuMpcUpdateInternal(mu_mpc, true);
+  EEBUS_MUTEX_UNLOCK(mu_mpc->mutex);
+}
+
+EebusError MuMpcUpdateMeasurementData(
+    MuMpcUseCaseObject* self,
+    const MuMpcMeasurementSample* samples,
+    size_t samples_size
+) {
+  MuMpcUseCase* const mu_mpc = MU_MPC_USE_CASE(self);
+
+  if ((samples == NULL) && (samples_size != 0)) {
+    return kEebusErrorInputArgumentNull;
   }
 
-  MeasurementsDelete(measurement_data_list);
-  return kEebusErrorOk;
+  EebusError err = kEebusErrorOk;
+
+  EEBUS_MUTEX_LOCK(mu_mpc->mutex);
+  for (size_t i = 0; (i < samples_size) && (err == kEebusErrorOk); ++i) {
+    const MuMpcMeasurementSample* const sample = &samples[i];
+
+    MuMpcMeasurementObject* const measurement = GetMeasurement(mu_mpc, sample->name);
+    if (measurement == NULL) {
+      err = kEebusErrorNotSupported;
+    } else {
+      err = MU_MPC_MEASUREMENT_SET_DATA_CACHE(
+          measurement,
+          &sample->value,
+          sample->timestamp,
+          sample->value_state,
+          NULL,
+          NULL
+      );
+    }
+  }
+
+  if (err == kEebusErrorOk) {
+    err = MuMpcUpdateInternal(mu_mpc, false);
+  }
+
+  EEBUS_MUTEX_UNLOCK(mu_mpc->mutex);
+
+  return err;
 }
 
 EebusError MuMpcSetEnergyConsumedCache(
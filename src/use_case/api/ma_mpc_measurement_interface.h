@@ -49,6 +49,12 @@ typedef struct MaMpcMeasurementObject MaMpcMeasurementObject;
  */
 struct MaMpcMeasurementInterface {
   MuMpcMeasurementNameId (*get_name)(const MaMpcMeasurementObject* self);
+  EebusError (*resolve_measurement_id)(
+      const MaMpcMeasurementObject* self,
+      MeasurementClient* mcl,
+      ElectricalConnectionClient* eccl,
+      MeasurementIdType* measurement_id
+  );
   EebusError (*get_data_value)(
       const MaMpcMeasurementObject* self,
       MeasurementClient* mcl,
@@ -79,6 +85,13 @@ struct MaMpcMeasurementObject {
  */
 #define MA_MPC_MEASUREMENT_GET_NAME(obj) (MA_MPC_MEASUREMENT_INTERFACE(obj)->get_name(obj))
 
+/**
+ * @brief Ma Mpc Measurement Resolve Measurement Id caller definition.
+ * Looks up the remote measurement id using the measurement and electrical connection descriptions only
+ */
+#define MA_MPC_MEASUREMENT_RESOLVE_MEASUREMENT_ID(obj, mcl, eccl, measurement_id) \
+  (MA_MPC_MEASUREMENT_INTERFACE(obj)->resolve_measurement_id(obj, mcl, eccl, measurement_id))
+
 /**
  * @brief Ma Mpc Measurement Get Data Value caller definition
  */
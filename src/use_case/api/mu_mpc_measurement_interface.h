@@ -21,6 +21,9 @@
 #ifndef SRC_USE_CASE_API_MU_MPC_MEASUREMENT_INTERFACE_H_
 #define SRC_USE_CASE_API_MU_MPC_MEASUREMENT_INTERFACE_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "src/common/eebus_errors.h"
 #include "src/spine/model/common_data_types.h"
 #include "src/spine/model/measurement_types.h"
@@ -72,7 +75,9 @@ struct MuMpcMeasurementInterface {
       const EebusDateTime* start_time,
       const EebusDateTime* end_time
   );
-  MeasurementDataType* (*release_data_cache)(MuMpcMeasurementObject* self);
+  bool (*is_publishing_timed)(const MuMpcMeasurementObject* self);
+  const MeasurementDataType* (*flush_data_cache)(MuMpcMeasurementObject* self, uint64_t now_ms, bool timed_only);
+  void (*commit_data_cache)(MuMpcMeasurementObject* self, uint64_t now_ms);
 };
 
 /**
@@ -126,9 +131,28 @@ struct MuMpcMeasurementObject {
   (MU_MPC_MEASUREMENT_INTERFACE(obj)->set_data_cache(obj, measured_value, timestamp, value_state, start_time, end_time))
 
 /**
- * @brief Mu Mpc Measurement Release Data Cache caller definition
+ * @brief Mu Mpc Measurement Is Publishing Timed caller definition.
+ * Returns true if the publishing policy has the minimum interval or the maximum silence set
+ */
+#define MU_MPC_MEASUREMENT_IS_PUBLISHING_TIMED(obj) (MU_MPC_MEASUREMENT_INTERFACE(obj)->is_publishing_timed(obj))
+
+/**
+ * @brief Mu Mpc Measurement Flush Data Cache caller definition.
+ * Returns the cached data if it has to be published according to the publishing policy, NULL otherwise.
+ * The policy intervals are measured with the monotonic time now_ms. With timed_only set,
+ * only the measurements with the timed publishing policy are considered.
+ * The returned data is owned by the measurement and stays valid until the next Set Data Cache call.
+ * The cache is kept unchanged until MU_MPC_MEASUREMENT_COMMIT_DATA_CACHE() is called
+ */
+#define MU_MPC_MEASUREMENT_FLUSH_DATA_CACHE(obj, now_ms, timed_only) \
+  (MU_MPC_MEASUREMENT_INTERFACE(obj)->flush_data_cache(obj, now_ms, timed_only))
+
+/**
+ * @brief Mu Mpc Measurement Commit Data Cache caller definition.
+ * Marks the data returned by the last flush as published. Has to be called once the data is sent only
  */
-#define MU_MPC_MEASUREMENT_RELEASE_DATA_CACHE(obj) (MU_MPC_MEASUREMENT_INTERFACE(obj)->release_data_cache(obj))
+#define MU_MPC_MEASUREMENT_COMMIT_DATA_CACHE(obj, now_ms) \
+  (MU_MPC_MEASUREMENT_INTERFACE(obj)->commit_data_cache(obj, now_ms))
 
 #ifdef __cplusplus
 }
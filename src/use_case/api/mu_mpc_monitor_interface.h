@@ -21,6 +21,10 @@
 #ifndef SRC_USE_CASE_API_MU_MPC_MONITOR_INTERFACE_H_
 #define SRC_USE_CASE_API_MU_MPC_MONITOR_INTERFACE_H_
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #include "src/common/eebus_errors.h"
 #include "src/use_case/api/mu_mpc_measurement_interface.h"
 #include "src/use_case/api/types.h"
@@ -61,7 +65,16 @@ struct MuMpcMonitorInterface {
       const MuMpcMonitorObject* self,
       MuMpcMeasurementNameId measurement_name_id
   );
-  EebusError (*flush_measurement_cache)(MuMpcMonitorObject* self, MeasurementListDataType* measurement_data_list);
+  bool (*is_publishing_timed)(const MuMpcMonitorObject* self);
+  EebusError (*flush_measurement_cache)(
+      MuMpcMonitorObject* self,
+      uint64_t now_ms,
+      bool timed_only,
+      const MeasurementDataType** measurement_data,
+      size_t measurement_data_capacity,
+      size_t* measurement_data_size
+  );
+  void (*commit_measurement_cache)(MuMpcMonitorObject* self, uint64_t now_ms);
 };
 
 /**
@@ -104,10 +117,24 @@ struct MuMpcMonitorObject {
   (MU_MPC_MONITOR_INTERFACE(obj)->get_measurement(obj, measurement_name_id))
 
 /**
- * @brief Mu Mpc Monitor Flush Measurement Cache caller definition
+ * @brief Mu Mpc Monitor Is Publishing Timed caller definition.
+ * Returns true if any of the measurements has the timed publishing policy
+ */
+#define MU_MPC_MONITOR_IS_PUBLISHING_TIMED(obj) (MU_MPC_MONITOR_INTERFACE(obj)->is_publishing_timed(obj))
+
+/**
+ * @brief Mu Mpc Monitor Flush Measurement Cache caller definition.
+ * Appends the measurements data due to be published to the data array starting at data_size
+ */
+#define MU_MPC_MONITOR_FLUSH_MEASUREMENT_CACHE(obj, now_ms, timed_only, data, data_capacity, data_size) \
+  (MU_MPC_MONITOR_INTERFACE(obj)->flush_measurement_cache(obj, now_ms, timed_only, data, data_capacity, data_size))
+
+/**
+ * @brief Mu Mpc Monitor Commit Measurement Cache caller definition.
+ * Marks the measurements data returned by the last flush as published
  */
-#define MU_MPC_MONITOR_FLUSH_MEASUREMENT_CACHE(obj, measurement_data_list) \
-  (MU_MPC_MONITOR_INTERFACE(obj)->flush_measurement_cache(obj, measurement_data_list))
+#define MU_MPC_MONITOR_COMMIT_MEASUREMENT_CACHE(obj, now_ms) \
+  (MU_MPC_MONITOR_INTERFACE(obj)->commit_measurement_cache(obj, now_ms))
 
 #ifdef __cplusplus
 }
@@ -103,7 +103,7 @@ EebusError Unbind(FeatureInfoClient* self) {
 
 EebusError
 AddResponseCallback(FeatureInfoClient* self, MsgCounterType msg_counter_ref, ResponseMessageCallback cb, void* ctx) {
-  return FEATURE_LOCAL_ADD_RESPONSE_CALLBACK(self->local_feature, msg_counter_ref, cb, ctx);
+  return FEATURE_LOCAL_ADD_RESPONSE_CALLBACK(self->local_feature, self->remote_device, msg_counter_ref, cb, ctx);
 }
 
 void AddResultCallback(FeatureInfoClient* self, ResponseMessageCallback cb, void* ctx) {
@@ -138,7 +138,7 @@ EebusError WriteCmd(FeatureInfoClient* self, const CmdType* cmd) {
     return kEebusErrorInputArgumentNull;
   }
 
-  const FeatureLocalObject* const fl  = self->local_feature;
+  FeatureLocalObject* const fl        = self->local_feature;
   const FeatureRemoteObject* const fr = self->remote_feature;
 
   SenderObject* const sender = DEVICE_REMOTE_GET_SENDER(self->remote_device);
@@ -153,5 +153,17 @@ EebusError WriteCmd(FeatureInfoClient* self, const CmdType* cmd) {
     return kEebusErrorNoChange;
   }
 
-  return SEND_WRITE(sender, sender_addr, dest_addr, cmd);
+  const PendingRequestsObject* const pending_requests = DEVICE_REMOTE_GET_PENDING_REQUESTS(self->remote_device);
+  if ((pending_requests != NULL) && PENDING_REQUESTS_IS_FULL(pending_requests)) {
+    return kEebusErrorCommunicationBusy;
+  }
+
+  MsgCounterType msg_cnt = 0;
+
+  const EebusError err = SEND_WRITE(sender, sender_addr, dest_addr, cmd, &msg_cnt);
+  if (err != kEebusErrorOk) {
+    return err;
+  }
+
+  return FEATURE_LOCAL_ADD_PENDING_REQUEST(fl, self->remote_device, msg_cnt, FEATURE_REMOTE_GET_MAX_RESPONSE_DELAY(fr));
 }
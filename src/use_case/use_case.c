@@ -21,12 +21,16 @@
 #include "src/use_case/use_case.h"
 
 #include "src/common/eebus_malloc.h"
+#include "src/spine/api/device_remote_interface.h"
 #include "src/spine/api/entity_local_interface.h"
+#include "src/spine/api/entity_remote_interface.h"
 #include "src/spine/events/events.h"
 #include "src/spine/model/usecase_information_types.h"
 #include "src/use_case/api/use_case_interface.h"
 
 static void UseCaseEntityAddUseCaseInfo(UseCase* self);
+static bool UseCaseIsLocalDeviceEvent(const UseCase* self, const EventPayload* payload);
+static void UseCaseHandleEvent(const EventPayload* payload, void* ctx);
 
 void UseCaseEntityAddUseCaseInfo(UseCase* self) {
   const UseCaseInfo* const info = self->info;
@@ -49,6 +53,25 @@ void UseCaseEntityAddUseCaseInfo(UseCase* self) {
   EEBUS_FREE(scenarios);
 }
 
+bool UseCaseIsLocalDeviceEvent(const UseCase* self, const EventPayload* payload) {
+  const DeviceRemoteObject* remote_device = payload->device;
+  if ((remote_device == NULL) && (payload->entity != NULL)) {
+    remote_device = ENTITY_REMOTE_GET_DEVICE(payload->entity);
+  }
+
+  // Events are published to all of the handlers in the process, while there can be
+  // several Device Local instances, e.g. the in-process simulated peers
+  return (remote_device == NULL) || (DEVICE_REMOTE_GET_LOCAL_DEVICE(remote_device) == self->local_device);
+}
+
+void UseCaseHandleEvent(const EventPayload* payload, void* ctx) {
+  UseCase* const uc = USE_CASE(ctx);
+
+  if (UseCaseIsLocalDeviceEvent(uc, payload)) {
+    uc->event_handler(payload, ctx);
+  }
+}
+
 void UseCaseConstruct(
     UseCase* self, const UseCaseInfo* info, EntityLocalObject* local_entity, EventHandler event_handler) {
   self->info         = info;
@@ -57,7 +80,7 @@ void UseCaseConstruct(
   UseCaseEntityAddUseCaseInfo(self);
   self->event_handler = event_handler;
   if (self->event_handler != NULL) {
-    EventSubscribe(kEventHandlerLevelApplication, event_handler, self);
+    EventSubscribe(kEventHandlerLevelApplication, UseCaseHandleEvent, self);
   }
 }
 
@@ -65,7 +88,7 @@ void UseCaseDestruct(UseCaseObject* self) {
   UseCase* use_case = USE_CASE(self);
 
   if (use_case->event_handler != NULL) {
-    EventUnsubscribe(kEventHandlerLevelApplication, use_case->event_handler, self);
+    EventUnsubscribe(kEventHandlerLevelApplication, UseCaseHandleEvent, self);
   }
 
   // TODO: Check if use case info from should be removed from entity here
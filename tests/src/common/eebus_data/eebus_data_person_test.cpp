@@ -104,6 +104,24 @@ INSTANTIATE_TEST_SUITE_P(
     )
 );
 
+TEST(DataPersonTests, DataPersonNumberOutOfRangeTest) {
+  // Arrange: Initialize the message with age beyond the uint8_t range and a fractional one
+  std::unique_ptr<char[], decltype(&JsonFree)> s_overflow{
+      JsonUnformat(R"({"person": [{"name": "John Doe"}, {"age": 256}]})"sv), JsonFree};
+  std::unique_ptr<char[], decltype(&JsonFree)> s_fraction{
+      JsonUnformat(R"({"person": [{"name": "John Doe"}, {"age": 43.5}]})"sv), JsonFree};
+  ASSERT_NE(s_overflow, nullptr) << "Wrong test input!";
+  ASSERT_NE(s_fraction, nullptr) << "Wrong test input!";
+
+  // Act: Run the Json Parse
+  std::unique_ptr<Person, decltype(&PersonDelete)> person_overflow{PersonParse(s_overflow.get()), PersonDelete};
+  std::unique_ptr<Person, decltype(&PersonDelete)> person_fraction{PersonParse(s_fraction.get()), PersonDelete};
+
+  // Assert: Verify the value is rejected rather than truncated
+  EXPECT_EQ(person_overflow, nullptr);
+  EXPECT_EQ(person_fraction, nullptr);
+}
+
 struct DataPersonReadElementsTestInput {
   std::string_view description  = ""sv;
   std::string_view dst_msg_in   = ""sv;
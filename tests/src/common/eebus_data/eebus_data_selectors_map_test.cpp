@@ -0,0 +1,179 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "src/common/eebus_data/eebus_data_selectors_map.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+
+#include "person.h"
+#include "person_json.inc"
+#include "src/common/eebus_data/eebus_data_sequence.h"
+
+namespace {
+
+using SelectorsMapCachePtr = std::unique_ptr<SelectorsMapCache, decltype(&SelectorsMapCacheDelete)>;
+
+// Only the names are used to build the map
+const EebusDataCfg data_cfg[] = {
+    {.name = "id"},
+    {.name = "value"},
+    {.name = "unit"},
+    EEBUS_DATA_END,
+};
+
+const EebusDataCfg selectors_cfg[] = {
+    {.name = "unit"},
+    {.name = "scope"},
+    {.name = "id"},
+    EEBUS_DATA_END,
+};
+
+constexpr size_t kWideSelectorsSize = SELECTORS_MAP_FIELDS_MAX + 1;
+
+std::array<EebusDataCfg, kWideSelectorsSize + 1> CreateWideSelectorsCfg() {
+  std::array<EebusDataCfg, kWideSelectorsSize + 1> cfg{};
+  for (size_t i = 0; i < kWideSelectorsSize; ++i) {
+    cfg[i].name = "id";
+  }
+
+  return cfg;
+}
+
+SelectorsMapCachePtr CreateCache(size_t capacity) {
+  return SelectorsMapCachePtr{SelectorsMapCacheCreate(capacity), SelectorsMapCacheDelete};
+}
+
+}  // namespace
+
+TEST(SelectorsMapTests, SelectorsMapCacheCreateInputArgs) {
+  EXPECT_EQ(SelectorsMapCacheCreate(0), nullptr);
+  EXPECT_EQ(SelectorsMapCacheCreate(3), nullptr);
+
+  // The default cache is not released
+  SelectorsMapCacheDelete(SelectorsMapCacheGetDefault());
+  SelectorsMapCacheDelete(nullptr);
+}
+
+TEST(SelectorsMapTests, SelectorsMapCacheGetBuildsOnce) {
+  SelectorsMapCachePtr cache = CreateCache(4);
+  ASSERT_NE(cache, nullptr);
+
+  const SelectorsMap* const map = SelectorsMapCacheGet(cache.get(), data_cfg, selectors_cfg);
+  ASSERT_NE(map, nullptr);
+  EXPECT_EQ(SelectorsMapGetDataIdx(map, 0), 2);
+  EXPECT_EQ(SelectorsMapGetDataIdx(map, 1), SELECTORS_MAP_NO_FIELD);
+  EXPECT_EQ(SelectorsMapGetDataIdx(map, 2), 0);
+  EXPECT_EQ(SelectorsMapGetDataIdx(map, SELECTORS_MAP_FIELDS_MAX), SELECTORS_MAP_NO_FIELD);
+
+  // The next lookups hit the cached map
+  EXPECT_EQ(SelectorsMapCacheGet(cache.get(), data_cfg, selectors_cfg), map);
+  EXPECT_EQ(SelectorsMapCacheReserve(cache.get(), data_cfg, selectors_cfg), nullptr);
+
+  // The configuration pair is ordered
+  const SelectorsMap* const swapped_map = SelectorsMapCacheGet(cache.get(), selectors_cfg, data_cfg);
+  ASSERT_NE(swapped_map, nullptr);
+  EXPECT_NE(swapped_map, map);
+  EXPECT_EQ(SelectorsMapGetDataIdx(swapped_map, 0), 2);
+  EXPECT_EQ(SelectorsMapGetDataIdx(swapped_map, 1), SELECTORS_MAP_NO_FIELD);
+}
+
+TEST(SelectorsMapTests, SelectorsMapCacheGetWideSelectors) {
+  SelectorsMapCachePtr cache = CreateCache(4);
+  ASSERT_NE(cache, nullptr);
+
+  const std::array<EebusDataCfg, kWideSelectorsSize + 1> wide_selectors_cfg = CreateWideSelectorsCfg();
+
+  // The selectors wider than the map are matched by names
+  EXPECT_EQ(SelectorsMapCacheGet(cache.get(), data_cfg, wide_selectors_cfg.data()), nullptr);
+
+  // The incomplete map is cached still, so it is not rebuilt on each lookup
+  EXPECT_EQ(SelectorsMapCacheReserve(cache.get(), data_cfg, wide_selectors_cfg.data()), nullptr);
+  EXPECT_EQ(SelectorsMapCacheGet(cache.get(), data_cfg, wide_selectors_cfg.data()), nullptr);
+}
+
+TEST(SelectorsMapTests, SelectorsMapCacheGetFullCache) {
+  SelectorsMapCachePtr cache = CreateCache(2);
+  ASSERT_NE(cache, nullptr);
+
+  const SelectorsMap* const map = SelectorsMapCacheGet(cache.get(), data_cfg, selectors_cfg);
+  ASSERT_NE(map, nullptr);
+  ASSERT_NE(SelectorsMapCacheGet(cache.get(), selectors_cfg, data_cfg), nullptr);
+
+  // No slot is left for the next pair, it is matched by names
+  EXPECT_EQ(SelectorsMapCacheGet(cache.get(), data_cfg, data_cfg), nullptr);
+  EXPECT_EQ(SelectorsMapCacheReserve(cache.get(), data_cfg, data_cfg), nullptr);
+
+  // The cached pairs are still found
+  EXPECT_EQ(SelectorsMapCacheGet(cache.get(), data_cfg, selectors_cfg), map);
+}
+
+TEST(SelectorsMapTests, SelectorsMapCacheGetSlotBeingBuilt) {
+  SelectorsMapCachePtr cache = CreateCache(4);
+  ASSERT_NE(cache, nullptr);
+
+  // Another thread has reserved the slot and is building the map right now
+  SelectorsMap* const map = SelectorsMapCacheReserve(cache.get(), data_cfg, selectors_cfg);
+  ASSERT_NE(map, nullptr);
+
+  EXPECT_EQ(SelectorsMapCacheGet(cache.get(), data_cfg, selectors_cfg), nullptr);
+  EXPECT_EQ(SelectorsMapCacheReserve(cache.get(), data_cfg, selectors_cfg), nullptr);
+
+  SelectorsMapCachePublish(map);
+  EXPECT_EQ(SelectorsMapCacheGet(cache.get(), data_cfg, selectors_cfg), map);
+  EXPECT_EQ(SelectorsMapGetDataIdx(map, 0), 2);
+}
+
+TEST(SelectorsMapTests, SelectorsMatchWithAndWithoutMap) {
+  std::unique_ptr<Person, decltype(&PersonDelete)> person{
+      PersonParse(R"({"person":[{"name":"John Doe"},{"age":43}]})"),
+      PersonDelete
+  };
+  std::unique_ptr<Person, decltype(&PersonDelete)> same_name{
+      PersonParse(R"({"person":[{"name":"John Doe"}]})"),
+      PersonDelete
+  };
+  std::unique_ptr<Person, decltype(&PersonDelete)> other_name{
+      PersonParse(R"({"person":[{"name":"Jane Doe"}]})"),
+      PersonDelete
+  };
+  ASSERT_NE(person, nullptr);
+  ASSERT_NE(same_name, nullptr);
+  ASSERT_NE(other_name, nullptr);
+
+  const Person* const person_addr     = person.get();
+  const Person* const same_name_addr  = same_name.get();
+  const Person* const other_name_addr = other_name.get();
+
+  const SelectorsMap* const map = EebusDataSequenceGetSelectorsMap(&person_data_cfg, &person_data_cfg);
+  ASSERT_NE(map, nullptr);
+
+  // The name lookup fallback gives the same result as the map
+  for (const SelectorsMap* selectors_map : {map, static_cast<const SelectorsMap*>(nullptr)}) {
+    EXPECT_TRUE(EebusDataSequenceSelectorsMatchWithMap(
+        &person_data_cfg, &person_addr, &person_data_cfg, &same_name_addr, selectors_map
+    ));
+    EXPECT_FALSE(EebusDataSequenceSelectorsMatchWithMap(
+        &person_data_cfg, &person_addr, &person_data_cfg, &other_name_addr, selectors_map
+    ));
+  }
+
+  // No map for the non sequence configurations
+  const EebusDataCfg* const name_cfg = &person_sequence_data_cfg[0];
+  EXPECT_EQ(EebusDataSequenceGetSelectorsMap(name_cfg, &person_data_cfg), nullptr);
+  EXPECT_EQ(EebusDataSequenceGetSelectorsMap(&person_data_cfg, name_cfg), nullptr);
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "src/common/eebus_date_time/eebus_date.h"
+#include "src/common/eebus_date_time/eebus_date_time.h"
+#include "src/common/eebus_date_time/eebus_duration.h"
+#include "src/common/eebus_date_time/eebus_time.h"
+#include "src/common/string_util.h"
+
+using namespace std::literals;
+
+// The allocation free parsers and formatters are checked against
+// the generic EebusXxxParse() and EebusXxxToString() implementations
+
+static bool operator==(const EebusDate& a, const EebusDate& b) {
+  return EebusDateCompare(&a, &b) == 0;
+}
+
+static bool operator==(const EebusTime& a, const EebusTime& b) {
+  return EebusTimeCompare(&a, &b) == 0;
+}
+
+static bool operator==(const EebusDateTime& a, const EebusDateTime& b) {
+  return EebusDateTimeCompare(&a, &b) == 0;
+}
+
+static bool operator==(const EebusDuration& a, const EebusDuration& b) {
+  return (a.years == b.years) && (a.months == b.months) && (a.days == b.days) && (a.hours == b.hours)
+         && (a.minutes == b.minutes) && (a.seconds == b.seconds);
+}
+
+template <typename T, typename ParseWithLength, typename Parse, typename Format, typename ToString>
+static void CheckRoundTrip(
+    std::string_view s,
+    ParseWithLength parse_with_length,
+    Parse parse,
+    Format format,
+    ToString to_string
+) {
+  // Pass the view of a longer buffer to make sure nothing is read beyond the length
+  const std::string buf = std::string{s} + "0Z:T-";
+
+  T value          = {};
+  T expected_value = {};
+
+  const EebusError err = parse_with_length(buf.data(), s.size(), &value);
+  ASSERT_EQ(err, parse(std::string{s}.c_str(), &expected_value)) << s;
+  if (err != kEebusErrorOk) {
+    return;
+  }
+
+  EXPECT_TRUE(value == expected_value) << s;
+
+  std::unique_ptr<char[], decltype(&StringDelete)> expected_s{to_string(&expected_value), &StringDelete};
+  ASSERT_NE(expected_s, nullptr) << s;
+
+  char formatted[EEBUS_DURATION_STRING_SIZE];
+  EXPECT_EQ(format(&value, formatted, sizeof(formatted)), strlen(expected_s.get())) << s;
+  EXPECT_STREQ(formatted, expected_s.get()) << s;
+}
+
+TEST(EebusDateTimeRoundTripTest, Date) {
+  for (const auto s : {
+           "2025-06-01"sv,
+           "0000-01-01"sv,
+           "2100-12-31"sv,
+           "2024-02-29"sv,
+           "2023-02-29"sv,
+           "2101-01-01"sv,
+           "2025-13-01"sv,
+           "2025-00-10"sv,
+           "2025-6-1"sv,
+           "+2025-06-01"sv,
+           " 2025-06-01"sv,
+           "2025-06-01x"sv,
+           "2025/06/01"sv,
+           "2025-06-0a"sv,
+           "20250601"sv,
+           ""sv,
+       }) {
+    CheckRoundTrip<EebusDate>(s, EebusDateParseWithLength, EebusDateParse, EebusDateFormat, EebusDateToString);
+  }
+}
+
+TEST(EebusDateTimeRoundTripTest, Time) {
+  for (const auto s : {
+           "12:00:00"sv,
+           "12:00:00Z"sv,
+           "23:59:59.999Z"sv,
+           "00:00:00."sv,
+           "00:00:00.5"sv,
+           "12:00:00Zjunk"sv,
+           "1:2:3"sv,
+           "24:00:00"sv,
+           "12:60:00"sv,
+           "12:00:60Z"sv,
+           "12:00"sv,
+           "12-00-00"sv,
+           " 12:00:00"sv,
+           "12:00:00.Zx"sv,
+           ""sv,
+       }) {
+    CheckRoundTrip<EebusTime>(s, EebusTimeParseWithLength, EebusTimeParse, EebusTimeFormat, EebusTimeToString);
+  }
+}
+
+TEST(EebusDateTimeRoundTripTest, DateTime) {
+  for (const auto s : {
+           "2025-06-01T12:00:00Z"sv,
+           "2025-06-01T12:00:00"sv,
+           "2025-06-01T12:00:00.123Z"sv,
+           "2025-6-1T1:2:3Z"sv,
+           "2024-02-29T23:59:59Z"sv,
+           "2025-02-29T12:00:00Z"sv,
+           "2025-06-01 12:00:00"sv,
+           "2025-06-01T"sv,
+           "2025-06-01T25:00:00Z"sv,
+           "12025-06-01T12:00:00Z"sv,
+           "T12:00:00"sv,
+           ""sv,
+       }) {
+    CheckRoundTrip<EebusDateTime>(
+        s,
+        EebusDateTimeParseWithLength,
+        EebusDateTimeParse,
+        EebusDateTimeFormat,
+        EebusDateTimeToString
+    );
+  }
+}
+
+TEST(EebusDateTimeRoundTripTest, Duration) {
+  for (const auto s : {
+           "PT0S"sv,
+           "P"sv,
+           "PT"sv,
+           "PT15M"sv,
+           "PT2H"sv,
+           "P1M"sv,
+           "P1Y2M3DT4H5M6S"sv,
+           "+P1D"sv,
+           "P999999999DT999999999S"sv,
+           "P1234567890D"sv,
+           "P1D2D"sv,
+           "PT1M1H"sv,
+           "P1H"sv,
+           "PT1Y"sv,
+           "PT1.5S"sv,
+           "PT1H2"sv,
+           "P1DTT"sv,
+           "1D"sv,
+           "-"sv,
+           ""sv,
+       }) {
+    CheckRoundTrip<EebusDuration>(
+        s,
+        EebusDurationParseWithLength,
+        EebusDurationParse,
+        EebusDurationFormat,
+        EebusDurationToString
+    );
+  }
+}
+
+TEST(EebusDateTimeRoundTripTest, NegativeDuration) {
+  for (const auto s : {"-PT2H"sv, "-P1Y2M3DT4H5M6S"sv, "-P1D"sv, "-PT0S"sv, "P-1D"sv}) {
+    EebusDuration duration          = {};
+    EebusDuration expected_duration = {};
+    ASSERT_EQ(EebusDurationParseWithLength(s.data(), s.size(), &duration), kEebusErrorOk) << s;
+    ASSERT_EQ(EebusDurationParse(std::string{s}.c_str(), &expected_duration), kEebusErrorOk) << s;
+    EXPECT_TRUE(duration == expected_duration) << s;
+
+    // Formatted negative duration is parsed back to the same value
+    char buf[EEBUS_DURATION_STRING_SIZE];
+    const size_t len = EebusDurationFormat(&duration, buf, sizeof(buf));
+    ASSERT_NE(len, 0) << s;
+
+    EebusDuration parsed_duration = {};
+    ASSERT_EQ(EebusDurationParseWithLength(buf, len, &parsed_duration), kEebusErrorOk) << buf;
+    EXPECT_TRUE(parsed_duration == duration) << buf;
+  }
+
+  static constexpr EebusDuration duration = {.days = -1, .hours = -2};
+
+  char buf[EEBUS_DURATION_STRING_SIZE];
+  EXPECT_EQ(EebusDurationFormat(&duration, buf, sizeof(buf)), strlen("-P1DT2H"));
+  EXPECT_STREQ(buf, "-P1DT2H");
+}
+
+TEST(EebusDateTimeRoundTripTest, FormatLimits) {
+  static constexpr EebusDuration max_duration = {
+      .years   = INT32_MIN,
+      .months  = INT32_MIN,
+      .days    = INT32_MIN,
+      .hours   = INT32_MIN,
+      .minutes = INT32_MIN,
+      .seconds = INT32_MIN,
+  };
+
+  char buf[EEBUS_DURATION_STRING_SIZE];
+  EXPECT_EQ(EebusDurationFormat(&max_duration, buf, sizeof(buf)), sizeof(buf) - 1);
+  EXPECT_STREQ(buf, "-P2147483648Y2147483648M2147483648DT2147483648H2147483648M2147483648S");
+
+  static constexpr EebusDuration duration = {.hours = 2};
+  EXPECT_EQ(EebusDurationFormat(&duration, buf, strlen("PT2H")), 0);
+  EXPECT_EQ(EebusDurationFormat(&duration, buf, strlen("PT2H") + 1), strlen("PT2H"));
+
+  static constexpr EebusDuration invalid_duration = {.hours = 2, .minutes = -1};
+  EXPECT_EQ(EebusDurationFormat(&invalid_duration, buf, sizeof(buf)), 0);
+
+  static constexpr EebusDateTime date_time = {
+      .date = {.year = 2025, .month = 6, .day = 1},
+      .time = {.hour = 12, .min = 0, .sec = 0},
+  };
+
+  EXPECT_EQ(EebusDateTimeFormat(&date_time, buf, EEBUS_DATE_TIME_STRING_SIZE - 1), 0);
+  EXPECT_EQ(EebusDateTimeFormat(&date_time, buf, EEBUS_DATE_TIME_STRING_SIZE), EEBUS_DATE_TIME_STRING_SIZE - 1);
+  EXPECT_STREQ(buf, "2025-06-01T12:00:00Z");
+
+  static constexpr EebusDateTime invalid_date_time = {
+      .date = {.year = 2025, .month = 2, .day = 29},
+      .time = {.hour = 12, .min = 0, .sec = 0},
+  };
+
+  EXPECT_EQ(EebusDateTimeFormat(&invalid_date_time, buf, sizeof(buf)), 0);
+}
@@ -85,3 +85,44 @@ TEST(EebusQueueTest, EebusQueueTestGeneric) {
   EXPECT_EQ(heap_used, 0);
   CheckForMemoryLeaks();
 }
+
+TEST(EebusQueueTest, EebusQueueTestReceiveMany) {
+  static const size_t kQueueMaxSize = 5;
+  std::unique_ptr<EebusQueueObject, decltype(&EebusQueueDelete)> queue{
+      EebusQueueCreate(kQueueMaxSize, sizeof(int32_t), nullptr),
+      &EebusQueueDelete
+  };
+
+  ASSERT_NE(queue, nullptr) << "Failed to create EebusQueue";
+
+  int32_t msgs_rd[3] = {0};
+  size_t num         = 0;
+  EXPECT_EQ(EEBUS_QUEUE_RECEIVE_MANY(queue.get(), msgs_rd, 3, &num, 1), kEebusErrorTime);
+  EXPECT_EQ(num, 0);
+
+  // Wrap around the cyclic buffer
+  for (int32_t msg_wr = 1; msg_wr <= 3; ++msg_wr) {
+    EXPECT_EQ(EEBUS_QUEUE_SEND(queue.get(), &msg_wr, 0), kEebusErrorOk);
+    EXPECT_EQ(EEBUS_QUEUE_RECEIVE(queue.get(), &msgs_rd[0], 0), kEebusErrorOk);
+  }
+
+  for (int32_t msg_wr = 1; msg_wr <= 4; ++msg_wr) {
+    EXPECT_EQ(EEBUS_QUEUE_SEND(queue.get(), &msg_wr, 0), kEebusErrorOk);
+  }
+
+  EXPECT_EQ(EEBUS_QUEUE_RECEIVE_MANY(queue.get(), msgs_rd, 3, &num, 0), kEebusErrorOk);
+  ASSERT_EQ(num, 3);
+  EXPECT_EQ(msgs_rd[0], 1);
+  EXPECT_EQ(msgs_rd[1], 2);
+  EXPECT_EQ(msgs_rd[2], 3);
+
+  EXPECT_EQ(EEBUS_QUEUE_RECEIVE_MANY(queue.get(), msgs_rd, 3, &num, 0), kEebusErrorOk);
+  ASSERT_EQ(num, 1);
+  EXPECT_EQ(msgs_rd[0], 4);
+  EXPECT_TRUE(EEBUS_QUEUE_IS_EMPTY(queue.get()));
+
+  queue.reset();
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/common/eebus_queue/eebus_queue.h"
+#include "src/common/eebus_queue/eebus_queue_mpsc.h"
+
+#include "tests/src/memory_leak.inc"
+
+namespace {
+
+using QueuePtr = std::unique_ptr<EebusQueueObject, decltype(&EebusQueueDelete)>;
+
+struct BenchmarkMessage {
+  uint32_t producer_id;
+  uint32_t seq;
+};
+
+int released_msg_num = 0;
+
+void CountReleasedMessage(void* msg) {
+  (void)msg;
+  ++released_msg_num;
+}
+
+/**
+ * @brief Push kMsgNum messages from each of the producer threads through the queue and
+ * check that every producer's messages are received once and in order
+ * @return Elapsed time in microseconds
+ */
+int64_t RunProducersConsumer(EebusQueueObject* queue, uint32_t producers_num, uint32_t msg_num) {
+  std::vector<uint32_t> next_seq(producers_num, 0);
+  std::vector<std::thread> producers;
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t id = 0; id < producers_num; ++id) {
+    producers.emplace_back([queue, id, msg_num]() {
+      for (uint32_t seq = 0; seq < msg_num; ++seq) {
+        const BenchmarkMessage msg = {.producer_id = id, .seq = seq};
+        EXPECT_EQ(EEBUS_QUEUE_SEND(queue, &msg, kTimeoutInfinite), kEebusErrorOk);
+      }
+    });
+  }
+
+  for (uint32_t i = 0; i < producers_num * msg_num; ++i) {
+    BenchmarkMessage msg = {};
+    EXPECT_EQ(EEBUS_QUEUE_RECEIVE(queue, &msg, kTimeoutInfinite), kEebusErrorOk);
+    if (msg.producer_id < producers_num) {
+      EXPECT_EQ(msg.seq, next_seq[msg.producer_id]++);
+    } else {
+      ADD_FAILURE() << "Unexpected producer id " << msg.producer_id;
+    }
+  }
+
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+}  // namespace
+
+TEST(EebusQueueMpscTest, EebusQueueMpscTestGeneric) {
+  static const size_t kQueueMaxSize = 8;
+  QueuePtr queue{EebusQueueMpscCreate(kQueueMaxSize, sizeof(int32_t), nullptr), &EebusQueueDelete};
+
+  ASSERT_NE(queue, nullptr) << "Failed to create EebusQueueMpsc";
+  ASSERT_TRUE(EEBUS_QUEUE_IS_EMPTY(queue.get()));
+  ASSERT_FALSE(EEBUS_QUEUE_IS_FULL(queue.get()));
+
+  // Go around the ring a few times
+  int32_t msg_wr = 1;
+  int32_t msg_rd = 0;
+  for (int lap = 0; lap < 3; ++lap) {
+    for (int i = 0; i < kQueueMaxSize; ++i) {
+      EXPECT_FALSE(EEBUS_QUEUE_IS_FULL(queue.get()));
+      EXPECT_EQ(EEBUS_QUEUE_SEND(queue.get(), &msg_wr, 0), kEebusErrorOk);
+      ++msg_wr;
+    }
+
+    ASSERT_TRUE(EEBUS_QUEUE_IS_FULL(queue.get()));
+    EXPECT_EQ(EEBUS_QUEUE_SEND(queue.get(), &msg_wr, 1), kEebusErrorTime);
+
+    msg_wr -= kQueueMaxSize;
+    for (int i = 0; i < kQueueMaxSize; ++i) {
+      EXPECT_FALSE(EEBUS_QUEUE_IS_EMPTY(queue.get()));
+      EXPECT_EQ(EEBUS_QUEUE_RECEIVE(queue.get(), &msg_rd, 0), kEebusErrorOk);
+      EXPECT_EQ(msg_rd, msg_wr);
+      ++msg_wr;
+    }
+
+    ASSERT_TRUE(EEBUS_QUEUE_IS_EMPTY(queue.get()));
+    EXPECT_EQ(EEBUS_QUEUE_RECEIVE(queue.get(), &msg_rd, 1), kEebusErrorTime);
+  }
+
+  queue.reset();
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+TEST(EebusQueueMpscTest, EebusQueueMpscTestClear) {
+  QueuePtr queue{EebusQueueMpscCreate(3, sizeof(int32_t), CountReleasedMessage), &EebusQueueDelete};
+
+  ASSERT_NE(queue, nullptr) << "Failed to create EebusQueueMpsc";
+
+  // Capacity is rounded up to the power of two
+  const int32_t msg_wr = 1;
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(EEBUS_QUEUE_SEND(queue.get(), &msg_wr, 0), kEebusErrorOk);
+  }
+
+  EXPECT_TRUE(EEBUS_QUEUE_IS_FULL(queue.get()));
+
+  released_msg_num = 0;
+  EEBUS_QUEUE_CLEAR(queue.get());
+  EXPECT_EQ(released_msg_num, 4);
+  EXPECT_TRUE(EEBUS_QUEUE_IS_EMPTY(queue.get()));
+
+  EXPECT_EQ(EEBUS_QUEUE_SEND(queue.get(), &msg_wr, 0), kEebusErrorOk);
+  queue.reset();
+  EXPECT_EQ(released_msg_num, 5);
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+TEST(EebusQueueMpscTest, EebusQueueMpscTestReceiveMany) {
+  QueuePtr queue{EebusQueueMpscCreate(4, sizeof(int32_t), nullptr), &EebusQueueDelete};
+
+  ASSERT_NE(queue, nullptr) << "Failed to create EebusQueueMpsc";
+
+  int32_t msgs_rd[3] = {0};
+  size_t num         = 0;
+  EXPECT_EQ(EEBUS_QUEUE_RECEIVE_MANY(queue.get(), msgs_rd, 3, &num, 1), kEebusErrorTime);
+  EXPECT_EQ(num, 0);
+
+  for (int32_t msg_wr = 1; msg_wr <= 4; ++msg_wr) {
+    EXPECT_EQ(EEBUS_QUEUE_SEND(queue.get(), &msg_wr, 0), kEebusErrorOk);
+  }
+
+  EXPECT_EQ(EEBUS_QUEUE_RECEIVE_MANY(queue.get(), msgs_rd, 3, &num, 0), kEebusErrorOk);
+  ASSERT_EQ(num, 3);
+  EXPECT_EQ(msgs_rd[0], 1);
+  EXPECT_EQ(msgs_rd[1], 2);
+  EXPECT_EQ(msgs_rd[2], 3);
+
+  EXPECT_EQ(EEBUS_QUEUE_RECEIVE_MANY(queue.get(), msgs_rd, 3, &num, 0), kEebusErrorOk);
+  ASSERT_EQ(num, 1);
+  EXPECT_EQ(msgs_rd[0], 4);
+  EXPECT_TRUE(EEBUS_QUEUE_IS_EMPTY(queue.get()));
+
+  queue.reset();
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+TEST(EebusQueueMpscTest, EebusQueueMpscTestWakeUp) {
+  QueuePtr queue{EebusQueueMpscCreate(1, sizeof(int32_t), nullptr), &EebusQueueDelete};
+
+  ASSERT_NE(queue, nullptr) << "Failed to create EebusQueueMpsc";
+
+  // Parked consumer is woken up by the producer
+  std::thread producer([&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const int32_t msg_wr = 7;
+    EXPECT_EQ(EEBUS_QUEUE_SEND(queue.get(), &msg_wr, 0), kEebusErrorOk);
+  });
+
+  int32_t msg_rd = 0;
+  EXPECT_EQ(EEBUS_QUEUE_RECEIVE(queue.get(), &msg_rd, 5000), kEebusErrorOk);
+  EXPECT_EQ(msg_rd, 7);
+  producer.join();
+
+  // Parked producer is woken up by the consumer
+  EXPECT_EQ(EEBUS_QUEUE_SEND(queue.get(), &msg_rd, 0), kEebusErrorOk);
+  std::thread consumer([&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    int32_t msg = 0;
+    EXPECT_EQ(EEBUS_QUEUE_RECEIVE(queue.get(), &msg, 0), kEebusErrorOk);
+  });
+
+  EXPECT_EQ(EEBUS_QUEUE_SEND(queue.get(), &msg_rd, 5000), kEebusErrorOk);
+  consumer.join();
+
+  queue.reset();
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+TEST(EebusQueueMpscTest, EebusQueueMpscTestBenchmark) {
+  static const size_t kQueueMaxSize   = 32;
+  static const uint32_t kProducersNum = 4;
+  static const uint32_t kMsgNum       = 50000;
+
+  QueuePtr mutex_queue{EebusQueueCreate(kQueueMaxSize, sizeof(BenchmarkMessage), nullptr), &EebusQueueDelete};
+  QueuePtr mpsc_queue{EebusQueueMpscCreate(kQueueMaxSize, sizeof(BenchmarkMessage), nullptr), &EebusQueueDelete};
+
+  ASSERT_NE(mutex_queue, nullptr) << "Failed to create EebusQueue";
+  ASSERT_NE(mpsc_queue, nullptr) << "Failed to create EebusQueueMpsc";
+
+  const int64_t mutex_us = RunProducersConsumer(mutex_queue.get(), kProducersNum, kMsgNum);
+  const int64_t mpsc_us  = RunProducersConsumer(mpsc_queue.get(), kProducersNum, kMsgNum);
+
+  std::cout << "[ BENCHMARK] " << kProducersNum << " producers x " << kMsgNum << " messages: mutex queue "
+            << mutex_us << " us, lock-free queue " << mpsc_us << " us" << std::endl;
+
+  EXPECT_TRUE(EEBUS_QUEUE_IS_EMPTY(mutex_queue.get()));
+  EXPECT_TRUE(EEBUS_QUEUE_IS_EMPTY(mpsc_queue.get()));
+
+  mutex_queue.reset();
+  mpsc_queue.reset();
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
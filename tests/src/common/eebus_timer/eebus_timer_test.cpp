@@ -127,3 +127,12 @@ INSTANTIATE_TEST_SUITE_P(
         }
     )
 );
+
+TEST_F(EebusTimerTestSuite, EebusTimerMonotonicTimeTest) {
+  const uint64_t start_ms = EebusTimerGetMonotonicTimeMs();
+  sleep(1);
+  const uint64_t elapsed_ms = EebusTimerGetMonotonicTimeMs() - start_ms;
+
+  EXPECT_GE(elapsed_ms, SECONDS(1) - MILLISECONDS(20));
+  EXPECT_LE(elapsed_ms, SECONDS(1) + MILLISECONDS(200));
+}
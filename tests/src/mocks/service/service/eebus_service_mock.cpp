@@ -44,6 +44,8 @@ static void UnregisterRemoteSki(EebusServiceObject* self, const char* ski);
 static void CancelPairingWithSki(EebusServiceObject* self, const char* ski);
 static void SetPairingPossible(EebusServiceObject* self, bool is_pairing_possible);
 static const char* GetLocalSki(EebusServiceObject* self);
+static void AddRemoteService(EebusServiceObject* self, const MdnsEntry* entry);
+static void SetCborEnabledForSki(EebusServiceObject* self, const char* ski, bool enable);
 
 static const EebusServiceInterface eebus_service_methods = {
     .ship_node_reader_interface = {
@@ -68,6 +70,8 @@ static const EebusServiceInterface eebus_service_methods = {
     .cancel_pairing_with_ski             = CancelPairingWithSki,
     .set_pairing_possible                = SetPairingPossible,
     .get_local_ski                       = GetLocalSki,
+    .add_remote_service                  = AddRemoteService,
+    .set_cbor_enabled_for_ski            = SetCborEnabledForSki,
 };
 
 static void EebusServiceMockConstruct(EebusServiceMock* self);
@@ -182,3 +186,13 @@ const char* GetLocalSki(EebusServiceObject* self) {
   EebusServiceMock* const mock = EEBUS_SERVICE_MOCK(self);
   return mock->gmock->GetLocalSki(self);
 }
+
+void AddRemoteService(EebusServiceObject* self, const MdnsEntry* entry) {
+  EebusServiceMock* const mock = EEBUS_SERVICE_MOCK(self);
+  mock->gmock->AddRemoteService(self, entry);
+}
+
+void SetCborEnabledForSki(EebusServiceObject* self, const char* ski, bool enable) {
+  EebusServiceMock* const mock = EEBUS_SERVICE_MOCK(self);
+  mock->gmock->SetCborEnabledForSki(self, ski, enable);
+}
@@ -42,6 +42,8 @@ class EebusServiceGMockInterface : public ShipNodeReaderGMockInterface {
   virtual void CancelPairingWithSki(EebusServiceObject* self, const char* ski)                                  = 0;
   virtual void SetPairingPossible(EebusServiceObject* self, bool is_pairing_possible)                           = 0;
   virtual const char* GetLocalSki(EebusServiceObject* self)                                                     = 0;
+  virtual void AddRemoteService(EebusServiceObject* self, const MdnsEntry* entry)                              = 0;
+  virtual void SetCborEnabledForSki(EebusServiceObject* self, const char* ski, bool enable)                    = 0;
 };
 
 class EebusServiceGMock : public EebusServiceGMockInterface {
@@ -66,6 +68,8 @@ class EebusServiceGMock : public EebusServiceGMockInterface {
   MOCK_METHOD2(CancelPairingWithSki, void(EebusServiceObject*, const char*));
   MOCK_METHOD2(SetPairingPossible, void(EebusServiceObject*, bool));
   MOCK_METHOD1(GetLocalSki, const char*(EebusServiceObject*));
+  MOCK_METHOD2(AddRemoteService, void(EebusServiceObject*, const MdnsEntry*));
+  MOCK_METHOD3(SetCborEnabledForSki, void(EebusServiceObject*, const char*, bool));
 };
 
 typedef struct EebusServiceMock {
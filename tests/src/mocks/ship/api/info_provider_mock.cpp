@@ -30,6 +30,7 @@ void ReportServiceShipId(InfoProviderObject* self, const char* service_id, const
 bool IsWaitingForTrustAllowed(InfoProviderObject*, const char* ski);
 void HandleShipStateUpdate(InfoProviderObject* self, const char* ski, SmeState state, const char* err);
 DataReaderObject* SetupRemoteDevice(InfoProviderObject* self, const char* ski, DataWriterObject* data_writer);
+bool IsCborEnabledForSki(InfoProviderObject* self, const char* ski);
 
 static const InfoProviderInterface info_provider_mock_methods = {
     .destruct                         = Destruct,
@@ -39,6 +40,7 @@ static const InfoProviderInterface info_provider_mock_methods = {
     .is_waiting_for_trust_allowed     = IsWaitingForTrustAllowed,
     .handle_ship_state_update         = HandleShipStateUpdate,
     .setup_remote_device              = SetupRemoteDevice,
+    .is_cbor_enabled_for_ski          = IsCborEnabledForSki,
 };
 
 InfoProviderMock* CreateInfoProviderMock(void) {
@@ -87,3 +89,8 @@ DataReaderObject* SetupRemoteDevice(InfoProviderObject* self, const char* ski, D
   InfoProviderMock* const mock = INFO_PROVIDER_MOCK(self);
   return mock->gmock->SetupRemoteDevice(self, ski, data_writer);
 }
+
+bool IsCborEnabledForSki(InfoProviderObject* self, const char* ski) {
+  InfoProviderMock* const mock = INFO_PROVIDER_MOCK(self);
+  return mock->gmock->IsCborEnabledForSki(self, ski);
+}
@@ -38,6 +38,7 @@ class InfoProviderMockInterface {
   virtual void HandleShipStateUpdate(InfoProviderObject* self, const char* ski, SmeState state, const char* err) = 0;
   virtual DataReaderObject* SetupRemoteDevice(InfoProviderObject* self, const char* ski, DataWriterObject* data_writer)
       = 0;
+  virtual bool IsCborEnabledForSki(InfoProviderObject* self, const char* ski)                                    = 0;
 };
 
 class InfoProviderGMock : public InfoProviderMockInterface {
@@ -53,6 +54,7 @@ class InfoProviderGMock : public InfoProviderMockInterface {
       SetupRemoteDevice,
       DataReaderObject*(InfoProviderObject* self, const char* ski, DataWriterObject* data_writer)
   );
+  MOCK_METHOD2(IsCborEnabledForSki, bool(InfoProviderObject*, const char*));
 };
 
 typedef struct InfoProviderMock {
@@ -26,11 +26,14 @@
 #include "src/ship/api/data_writer_interface.h"
 
 static void Destruct(DataWriterObject* self);
-static void WriteMessage(DataWriterObject* self, const uint8_t* msg, size_t msg_size);
+static EebusError
+WriteMessage(DataWriterObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority);
+static MessageProtocolFormatType GetFormat(const DataWriterObject* self);
 
 static const DataWriterInterface data_writer_methods = {
     .destruct      = Destruct,
     .write_message = WriteMessage,
+    .get_format    = GetFormat,
 };
 
 static void DataWriterMockConstruct(DataWriterMock* self);
@@ -56,7 +59,12 @@ void Destruct(DataWriterObject* self) {
   delete mock->gmock;
 }
 
-void WriteMessage(DataWriterObject* self, const uint8_t* msg, size_t msg_size) {
+EebusError WriteMessage(DataWriterObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority) {
   DataWriterMock* const mock = DATA_WRITER_MOCK(self);
-  mock->gmock->WriteMessage(self, msg, msg_size);
+  return mock->gmock->WriteMessage(self, msg, msg_size, priority);
+}
+
+MessageProtocolFormatType GetFormat(const DataWriterObject* self) {
+  DataWriterMock* const mock = DATA_WRITER_MOCK(self);
+  return mock->gmock->GetFormat(self);
 }
@@ -31,15 +31,18 @@
 class DataWriterGMockInterface {
  public:
   virtual ~DataWriterGMockInterface() {};
-  virtual void Destruct(DataWriterObject* self)                                          = 0;
-  virtual void WriteMessage(DataWriterObject* self, const uint8_t* msg, size_t msg_size) = 0;
+  virtual void Destruct(DataWriterObject* self) = 0;
+  virtual EebusError WriteMessage(DataWriterObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority)
+      = 0;
+  virtual MessageProtocolFormatType GetFormat(const DataWriterObject* self) = 0;
 };
 
 class DataWriterGMock : public DataWriterGMockInterface {
  public:
   virtual ~DataWriterGMock() {};
   MOCK_METHOD1(Destruct, void(DataWriterObject*));
-  MOCK_METHOD3(WriteMessage, void(DataWriterObject*, const uint8_t*, size_t));
+  MOCK_METHOD4(WriteMessage, EebusError(DataWriterObject*, const uint8_t*, size_t, MessagePriority));
+  MOCK_METHOD1(GetFormat, MessageProtocolFormatType(const DataWriterObject*));
 };
 
 typedef struct DataWriterMock {
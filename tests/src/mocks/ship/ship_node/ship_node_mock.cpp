@@ -32,11 +32,14 @@ void ReportServiceShipId(InfoProviderObject* self, const char* service_id, const
 bool IsWaitingForTrustAllowed(InfoProviderObject*, const char* ski);
 void HandleShipStateUpdate(InfoProviderObject* self, const char* ski, SmeState state, const char* err);
 DataReaderObject* SetupRemoteDevice(InfoProviderObject* self, const char* ski, DataWriterObject* data_writer);
+bool IsCborEnabledForSki(InfoProviderObject* self, const char* ski);
 static void Start(ShipNodeObject* self);
 static void Stop(ShipNodeObject* self);
 static void RegisterRemoteSki(ShipNodeObject* self, const char* ski, bool is_trusted);
 static void UnregisterRemoteSki(ShipNodeObject* self, const char* ski);
 static void CancelPairingWithSki(ShipNodeObject* self, const char* ski);
+static void AddRemoteService(ShipNodeObject* self, const MdnsEntry* entry);
+static void SetCborEnabledForSki(ShipNodeObject* self, const char* ski, bool enable);
 
 static const ShipNodeInterface ship_node_methods = {
     .info_provider_interface = {
@@ -47,13 +50,16 @@ static const ShipNodeInterface ship_node_methods = {
         .is_waiting_for_trust_allowed     = IsWaitingForTrustAllowed,
         .handle_ship_state_update         = HandleShipStateUpdate,
         .setup_remote_device              = SetupRemoteDevice,
+        .is_cbor_enabled_for_ski          = IsCborEnabledForSki,
     },
 
-    .start                   = Start,
-    .stop                    = Stop,
-    .register_remote_ski     = RegisterRemoteSki,
-    .unregister_remote_ski   = UnregisterRemoteSki,
-    .cancel_pairing_with_ski = CancelPairingWithSki,
+    .start                    = Start,
+    .stop                     = Stop,
+    .register_remote_ski      = RegisterRemoteSki,
+    .unregister_remote_ski    = UnregisterRemoteSki,
+    .cancel_pairing_with_ski  = CancelPairingWithSki,
+    .add_remote_service       = AddRemoteService,
+    .set_cbor_enabled_for_ski = SetCborEnabledForSki,
 };
 
 static void ShipNodeMockConstruct(ShipNodeMock* self);
@@ -109,6 +115,11 @@ DataReaderObject* SetupRemoteDevice(InfoProviderObject* self, const char* ski, D
   return mock->gmock->SetupRemoteDevice(self, ski, data_writer);
 }
 
+bool IsCborEnabledForSki(InfoProviderObject* self, const char* ski) {
+  ShipNodeMock* const mock = SHIP_NODE_MOCK(self);
+  return mock->gmock->IsCborEnabledForSki(self, ski);
+}
+
 void Start(ShipNodeObject* self) {
   ShipNodeMock* const mock = SHIP_NODE_MOCK(self);
   mock->gmock->Start(self);
@@ -133,3 +144,13 @@ void CancelPairingWithSki(ShipNodeObject* self, const char* ski) {
   ShipNodeMock* const mock = SHIP_NODE_MOCK(self);
   mock->gmock->CancelPairingWithSki(self, ski);
 }
+
+void AddRemoteService(ShipNodeObject* self, const MdnsEntry* entry) {
+  ShipNodeMock* const mock = SHIP_NODE_MOCK(self);
+  mock->gmock->AddRemoteService(self, entry);
+}
+
+void SetCborEnabledForSki(ShipNodeObject* self, const char* ski, bool enable) {
+  ShipNodeMock* const mock = SHIP_NODE_MOCK(self);
+  mock->gmock->SetCborEnabledForSki(self, ski, enable);
+}
@@ -36,6 +36,8 @@ class ShipNodeGMockInterface : public InfoProviderMock {
   virtual void RegisterRemoteSki(ShipNodeObject* self, const char* ski, bool is_trusted) = 0;
   virtual void UnregisterRemoteSki(ShipNodeObject* self, const char* ski)                = 0;
   virtual void CancelPairingWithSki(ShipNodeObject* self, const char* ski)               = 0;
+  virtual void AddRemoteService(ShipNodeObject* self, const MdnsEntry* entry)            = 0;
+  virtual void SetCborEnabledForSki(ShipNodeObject* self, const char* ski, bool enable)  = 0;
 };
 
 class ShipNodeGMock : public ShipNodeGMockInterface {
@@ -51,11 +53,14 @@ class ShipNodeGMock : public ShipNodeGMockInterface {
       SetupRemoteDevice,
       DataReaderObject*(InfoProviderObject* self, const char* ski, DataWriterObject* data_writer)
   );
+  MOCK_METHOD2(IsCborEnabledForSki, bool(InfoProviderObject*, const char*));
   MOCK_METHOD1(Start, void(ShipNodeObject*));
   MOCK_METHOD1(Stop, void(ShipNodeObject*));
   MOCK_METHOD3(RegisterRemoteSki, void(ShipNodeObject*, const char*, bool));
   MOCK_METHOD2(UnregisterRemoteSki, void(ShipNodeObject*, const char*));
   MOCK_METHOD2(CancelPairingWithSki, void(ShipNodeObject*, const char*));
+  MOCK_METHOD2(AddRemoteService, void(ShipNodeObject*, const MdnsEntry*));
+  MOCK_METHOD3(SetCborEnabledForSki, void(ShipNodeObject*, const char*, bool));
 };
 
 typedef struct ShipNodeMock {
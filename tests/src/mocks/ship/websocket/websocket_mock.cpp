@@ -26,7 +26,7 @@
 #include "src/ship/api/websocket_interface.h"
 
 static void Destruct(WebsocketObject* self);
-static int32_t Write(WebsocketObject* self, const uint8_t* msg, size_t msg_size);
+static int32_t Write(WebsocketObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority);
 static void Close(WebsocketObject* self, int32_t close_code, const char* reason);
 static bool IsClosed(const WebsocketObject* self);
 static int32_t GetCloseError(const WebsocketObject* self);
@@ -64,9 +64,9 @@ void Destruct(WebsocketObject* self) {
   delete mock->gmock;
 }
 
-int32_t Write(WebsocketObject* self, const uint8_t* msg, size_t msg_size) {
+int32_t Write(WebsocketObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority) {
   WebsocketMock* const mock = WEBSOCKET_MOCK(self);
-  return mock->gmock->Write(self, msg, msg_size);
+  return mock->gmock->Write(self, msg, msg_size, priority);
 }
 
 void Close(WebsocketObject* self, int32_t close_code, const char* reason) {
@@ -30,19 +30,19 @@
 class WebsocketGMockInterface {
  public:
   virtual ~WebsocketGMockInterface() {};
-  virtual void Destruct(WebsocketObject* self)                                      = 0;
-  virtual int32_t Write(WebsocketObject* self, const uint8_t* msg, size_t msg_size) = 0;
-  virtual void Close(WebsocketObject* self, int32_t close_code, const char* reason) = 0;
-  virtual bool IsClosed(const WebsocketObject* self)                                = 0;
-  virtual int32_t GetCloseError(const WebsocketObject* self)                        = 0;
-  virtual void ScheduleWrite(WebsocketObject* self)                                 = 0;
+  virtual void Destruct(WebsocketObject* self)                                                                = 0;
+  virtual int32_t Write(WebsocketObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority) = 0;
+  virtual void Close(WebsocketObject* self, int32_t close_code, const char* reason)                           = 0;
+  virtual bool IsClosed(const WebsocketObject* self)                                                          = 0;
+  virtual int32_t GetCloseError(const WebsocketObject* self)                                                  = 0;
+  virtual void ScheduleWrite(WebsocketObject* self)                                                           = 0;
 };
 
 class WebsocketGMock : public WebsocketGMockInterface {
  public:
   virtual ~WebsocketGMock() {};
   MOCK_METHOD1(Destruct, void(WebsocketObject*));
-  MOCK_METHOD3(Write, int32_t(WebsocketObject*, const uint8_t*, size_t));
+  MOCK_METHOD4(Write, int32_t(WebsocketObject*, const uint8_t*, size_t, MessagePriority));
   MOCK_METHOD3(Close, void(WebsocketObject*, int32_t, const char*));
   MOCK_METHOD1(IsClosed, bool(const WebsocketObject*));
   MOCK_METHOD1(GetCloseError, int32_t(const WebsocketObject*));
@@ -35,6 +35,7 @@ static EebusError RemoveBinding(
 );
 static void RemoveDeviceBindings(BindingManagerObject* self, DeviceRemoteObject* remote_device);
 static void RemoveEntityBindings(BindingManagerObject* self, EntityRemoteObject* remote_entity);
+static void RemoveFeatureBindings(BindingManagerObject* self, FeatureRemoteObject* remote_feature);
 static bool HasBinding(
     const BindingManagerObject* self,
     const FeatureAddressType* local_addr,
@@ -44,13 +45,14 @@ static NodeManagementBindingDataType*
 CreateBindingData(const BindingManagerObject* self, const DeviceRemoteObject* remote_device);
 
 static const BindingManagerInterface binding_manager_methods = {
-    .destruct               = Destruct,
-    .add_binding            = AddBinding,
-    .remove_binding         = RemoveBinding,
-    .remove_device_bindings = RemoveDeviceBindings,
-    .remove_entity_bindings = RemoveEntityBindings,
-    .has_binding            = HasBinding,
-    .create_binding_data    = CreateBindingData,
+    .destruct                = Destruct,
+    .add_binding             = AddBinding,
+    .remove_binding          = RemoveBinding,
+    .remove_device_bindings  = RemoveDeviceBindings,
+    .remove_entity_bindings  = RemoveEntityBindings,
+    .remove_feature_bindings = RemoveFeatureBindings,
+    .has_binding             = HasBinding,
+    .create_binding_data     = CreateBindingData,
 };
 
 static void BindingManagerMockConstruct(BindingManagerMock* self);
@@ -104,6 +106,11 @@ void RemoveEntityBindings(BindingManagerObject* self, EntityRemoteObject* remote
   mock->gmock->RemoveEntityBindings(self, remote_entity);
 }
 
+void RemoveFeatureBindings(BindingManagerObject* self, FeatureRemoteObject* remote_feature) {
+  BindingManagerMock* const mock = BINDING_MANAGER_MOCK(self);
+  mock->gmock->RemoveFeatureBindings(self, remote_feature);
+}
+
 bool HasBinding(
     const BindingManagerObject* self,
     const FeatureAddressType* local_addr,
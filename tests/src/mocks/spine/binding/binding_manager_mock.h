@@ -43,6 +43,7 @@ class BindingManagerGMockInterface {
   )                                                                                                = 0;
   virtual void RemoveDeviceBindings(BindingManagerObject* self, DeviceRemoteObject* remote_device) = 0;
   virtual void RemoveEntityBindings(BindingManagerObject* self, EntityRemoteObject* remote_entity) = 0;
+  virtual void RemoveFeatureBindings(BindingManagerObject* self, FeatureRemoteObject* remote_feature) = 0;
   virtual bool HasBinding(
       const BindingManagerObject* self,
       const FeatureAddressType* local_addr,
@@ -68,6 +69,7 @@ class BindingManagerGMock : public BindingManagerGMockInterface {
   );
   MOCK_METHOD2(RemoveDeviceBindings, void(BindingManagerObject*, DeviceRemoteObject*));
   MOCK_METHOD2(RemoveEntityBindings, void(BindingManagerObject*, EntityRemoteObject*));
+  MOCK_METHOD2(RemoveFeatureBindings, void(BindingManagerObject*, FeatureRemoteObject*));
   MOCK_METHOD3(HasBinding, bool(const BindingManagerObject*, const FeatureAddressType*, const FeatureAddressType*));
   MOCK_METHOD2(
       CreateBindingData,
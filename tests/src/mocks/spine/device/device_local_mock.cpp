@@ -32,6 +32,8 @@ static const NetworkManagementFeatureSetType* GetFeatureSet(const DeviceObject*
 static const NodeManagementDestinationDataType* CreateDestinationData(const DeviceObject* self);
 static EebusError Start(DeviceLocalObject* self);
 static void Stop(DeviceLocalObject* self);
+static void SetExternalLoop(DeviceLocalObject* self, DeviceLocalWakeCallback wake_cb, void* ctx);
+static uint32_t Step(DeviceLocalObject* self, uint32_t elapsed_ms);
 static DataReaderObject* SetupRemoteDevice(DeviceLocalObject* self, const char* ski, DataWriterObject* writer);
 static void AddRemoteDeviceForSki(DeviceLocalObject* self, const char* ski, DeviceRemoteObject* remote_device);
 static EebusError RequestRemoteDetailedDiscoveryData(DeviceLocalObject* self, const DeviceRemoteObject* remote_device);
@@ -50,6 +52,8 @@ static EebusError HandleMessage(DeviceLocalObject* self, MessageBuffer* msg, Dev
 static NodeManagementObject* GetNodeManagement(const DeviceLocalObject* self);
 static BindingManagerObject* GetBindingManager(const DeviceLocalObject* self);
 static SubscriptionManagerObject* GetSubscriptionManager(const DeviceLocalObject* self);
+static void SetRemoteDeviceCache(DeviceLocalObject* self, RemoteDeviceCacheObject* remote_device_cache);
+static RemoteDeviceCacheObject* GetRemoteDeviceCache(const DeviceLocalObject* self);
 static void
 NotifySubscribers(const DeviceLocalObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd);
 static NodeManagementDetailedDiscoveryDeviceInformationType* CreateInformation(const DeviceLocalObject* self);
@@ -67,6 +71,8 @@ static const DeviceLocalInterface device_local_methods = {
 
     .start                                  = Start,
     .stop                                   = Stop,
+    .set_external_loop                      = SetExternalLoop,
+    .step                                   = Step,
     .setup_remote_device                    = SetupRemoteDevice,
     .add_remote_device_for_ski              = AddRemoteDeviceForSki,
     .request_remote_detailed_discovery_data = RequestRemoteDetailedDiscoveryData,
@@ -84,6 +90,8 @@ static const DeviceLocalInterface device_local_methods = {
     .get_node_management                    = GetNodeManagement,
     .get_binding_manager                    = GetBindingManager,
     .get_subscription_manager               = GetSubscriptionManager,
+    .set_remote_device_cache                = SetRemoteDeviceCache,
+    .get_remote_device_cache                = GetRemoteDeviceCache,
     .notify_subscribers                     = NotifySubscribers,
     .create_information                     = CreateInformation,
     .lock                                   = Lock,
@@ -143,6 +151,16 @@ void Stop(DeviceLocalObject* self) {
   mock->gmock->Stop(self);
 }
 
+void SetExternalLoop(DeviceLocalObject* self, DeviceLocalWakeCallback wake_cb, void* ctx) {
+  DeviceLocalMock* const mock = DEVICE_LOCAL_MOCK(self);
+  mock->gmock->SetExternalLoop(self, wake_cb, ctx);
+}
+
+uint32_t Step(DeviceLocalObject* self, uint32_t elapsed_ms) {
+  DeviceLocalMock* const mock = DEVICE_LOCAL_MOCK(self);
+  return mock->gmock->Step(self, elapsed_ms);
+}
+
 DataReaderObject* SetupRemoteDevice(DeviceLocalObject* self, const char* ski, DataWriterObject* writer) {
   DeviceLocalMock* const mock = DEVICE_LOCAL_MOCK(self);
   return mock->gmock->SetupRemoteDevice(self, ski, writer);
@@ -228,6 +246,16 @@ SubscriptionManagerObject* GetSubscriptionManager(const DeviceLocalObject* self)
   return mock->gmock->GetSubscriptionManager(self);
 }
 
+void SetRemoteDeviceCache(DeviceLocalObject* self, RemoteDeviceCacheObject* remote_device_cache) {
+  DeviceLocalMock* const mock = DEVICE_LOCAL_MOCK(self);
+  mock->gmock->SetRemoteDeviceCache(self, remote_device_cache);
+}
+
+RemoteDeviceCacheObject* GetRemoteDeviceCache(const DeviceLocalObject* self) {
+  DeviceLocalMock* const mock = DEVICE_LOCAL_MOCK(self);
+  return mock->gmock->GetRemoteDeviceCache(self);
+}
+
 void NotifySubscribers(const DeviceLocalObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd) {
   DeviceLocalMock* const mock = DEVICE_LOCAL_MOCK(self);
   mock->gmock->NotifySubscribers(self, feature_addr, cmd);
@@ -33,6 +33,8 @@ class DeviceLocalGMockInterface : public DeviceGMockInterface {
   virtual ~DeviceLocalGMockInterface() {};
   virtual EebusError Start(DeviceLocalObject* self)                                                               = 0;
   virtual void Stop(DeviceLocalObject* self)                                                                      = 0;
+  virtual void SetExternalLoop(DeviceLocalObject* self, DeviceLocalWakeCallback wake_cb, void* ctx)              = 0;
+  virtual uint32_t Step(DeviceLocalObject* self, uint32_t elapsed_ms)                                            = 0;
   virtual DataReaderObject* SetupRemoteDevice(DeviceLocalObject* self, const char* ski, DataWriterObject* writer) = 0;
   virtual void AddRemoteDeviceForSki(DeviceLocalObject* self, const char* ski, DeviceRemoteObject* remote_device) = 0;
   virtual EebusError RequestRemoteDetailedDiscoveryData(
@@ -58,6 +60,8 @@ class DeviceLocalGMockInterface : public DeviceGMockInterface {
   virtual NodeManagementObject* GetNodeManagement(const DeviceLocalObject* self)                                   = 0;
   virtual BindingManagerObject* GetBindingManager(const DeviceLocalObject* self)                                   = 0;
   virtual SubscriptionManagerObject* GetSubscriptionManager(const DeviceLocalObject* self)                         = 0;
+  virtual void SetRemoteDeviceCache(DeviceLocalObject* self, RemoteDeviceCacheObject* remote_device_cache)         = 0;
+  virtual RemoteDeviceCacheObject* GetRemoteDeviceCache(const DeviceLocalObject* self)                             = 0;
   virtual void
   NotifySubscribers(const DeviceLocalObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd)
       = 0;
@@ -76,6 +80,8 @@ class DeviceLocalGMock : public DeviceLocalGMockInterface {
   MOCK_METHOD1(CreateDestinationData, const NodeManagementDestinationDataType*(const DeviceObject*));
   MOCK_METHOD1(Start, EebusError(DeviceLocalObject*));
   MOCK_METHOD1(Stop, void(DeviceLocalObject*));
+  MOCK_METHOD3(SetExternalLoop, void(DeviceLocalObject*, DeviceLocalWakeCallback, void*));
+  MOCK_METHOD2(Step, uint32_t(DeviceLocalObject*, uint32_t));
   MOCK_METHOD3(SetupRemoteDevice, DataReaderObject*(DeviceLocalObject*, const char*, DataWriterObject*));
   MOCK_METHOD3(AddRemoteDeviceForSki, void(DeviceLocalObject*, const char*, DeviceRemoteObject*));
   MOCK_METHOD2(RequestRemoteDetailedDiscoveryData, EebusError(DeviceLocalObject*, const DeviceRemoteObject*));
@@ -93,6 +99,8 @@ class DeviceLocalGMock : public DeviceLocalGMockInterface {
   MOCK_METHOD1(GetNodeManagement, NodeManagementObject*(const DeviceLocalObject*));
   MOCK_METHOD1(GetBindingManager, BindingManagerObject*(const DeviceLocalObject*));
   MOCK_METHOD1(GetSubscriptionManager, SubscriptionManagerObject*(const DeviceLocalObject*));
+  MOCK_METHOD2(SetRemoteDeviceCache, void(DeviceLocalObject*, RemoteDeviceCacheObject*));
+  MOCK_METHOD1(GetRemoteDeviceCache, RemoteDeviceCacheObject*(const DeviceLocalObject*));
   MOCK_METHOD3(NotifySubscribers, void(const DeviceLocalObject*, const FeatureAddressType*, const CmdType*));
   MOCK_METHOD1(CreateInformation, NodeManagementDetailedDiscoveryDeviceInformationType*(const DeviceLocalObject*));
   MOCK_METHOD1(Lock, void(DeviceLocalObject*));
@@ -31,6 +31,7 @@ static const DeviceTypeType* GetDeviceType(const DeviceObject* self);
 static const NetworkManagementFeatureSetType* GetFeatureSet(const DeviceObject* self);
 static const NodeManagementDestinationDataType* CreateDestinationData(const DeviceObject* self);
 static const char* GetSki(const DeviceRemoteObject* self);
+static DeviceLocalObject* GetLocalDevice(const DeviceRemoteObject* self);
 static DataReaderObject* GetDataReader(const DeviceRemoteObject* self);
 static void AddEntity(DeviceRemoteObject* self, EntityRemoteObject* entity);
 static EntityRemoteObject*
@@ -49,10 +50,13 @@ static FeatureRemoteObject* GetFeatureWithTypeAndRole(
 );
 static EebusError HandleSpineMesssage(DeviceRemoteObject* self, MessageBuffer* msg);
 static SenderObject* GetSender(const DeviceRemoteObject* self);
+static PendingRequestsObject* GetPendingRequests(const DeviceRemoteObject* self);
 static NodeManagementUseCaseDataType* UseCasesDataCopy(const DeviceRemoteObject* self);
 static void UpdateDevice(DeviceRemoteObject* self, const NetworkManagementDeviceDescriptionDataType* description);
 static const Vector*
 AddEntityAndFeatures(DeviceRemoteObject* self, bool init, const NodeManagementDetailedDiscoveryDataType* data);
+static Vector*
+ReleaseRemovedEntities(DeviceRemoteObject* self, bool init, const NodeManagementDetailedDiscoveryDataType* data);
 static EebusError CheckEntityInformation(
     const DeviceRemoteObject* self,
     bool init,
@@ -69,6 +73,7 @@ static const DeviceRemoteInterface device_remote_methods = {
     },
 
     .get_ski                        = GetSki,
+    .get_local_device               = GetLocalDevice,
     .get_data_reader                = GetDataReader,
     .add_entity                     = AddEntity,
     .release_entity                 = ReleaseEntity,
@@ -78,9 +83,11 @@ static const DeviceRemoteInterface device_remote_methods = {
     .get_feature_with_type_and_role = GetFeatureWithTypeAndRole,
     .handle_spine_messsage          = HandleSpineMesssage,
     .get_sender                     = GetSender,
+    .get_pending_requests           = GetPendingRequests,
     .use_cases_data_copy            = UseCasesDataCopy,
     .update_device                  = UpdateDevice,
     .add_entity_and_features        = AddEntityAndFeatures,
+    .release_removed_entities       = ReleaseRemovedEntities,
     .check_entity_information       = CheckEntityInformation,
 };
 
@@ -132,6 +139,11 @@ const char* GetSki(const DeviceRemoteObject* self) {
   return mock->gmock->GetSki(self);
 }
 
+DeviceLocalObject* GetLocalDevice(const DeviceRemoteObject* self) {
+  DeviceRemoteMock* const mock = DEVICE_REMOTE_MOCK(self);
+  return mock->gmock->GetLocalDevice(self);
+}
+
 DataReaderObject* GetDataReader(const DeviceRemoteObject* self) {
   DeviceRemoteMock* const mock = DEVICE_REMOTE_MOCK(self);
   return mock->gmock->GetDataReader(self);
@@ -184,6 +196,11 @@ SenderObject* GetSender(const DeviceRemoteObject* self) {
   return mock->gmock->GetSender(self);
 }
 
+PendingRequestsObject* GetPendingRequests(const DeviceRemoteObject* self) {
+  DeviceRemoteMock* const mock = DEVICE_REMOTE_MOCK(self);
+  return mock->gmock->GetPendingRequests(self);
+}
+
 NodeManagementUseCaseDataType* UseCasesDataCopy(const DeviceRemoteObject* self) {
   DeviceRemoteMock* const mock = DEVICE_REMOTE_MOCK(self);
   return mock->gmock->UseCasesDataCopy(self);
@@ -200,6 +217,12 @@ AddEntityAndFeatures(DeviceRemoteObject* self, bool init, const NodeManagementDe
   return mock->gmock->AddEntityAndFeatures(self, init, data);
 }
 
+Vector*
+ReleaseRemovedEntities(DeviceRemoteObject* self, bool init, const NodeManagementDetailedDiscoveryDataType* data) {
+  DeviceRemoteMock* const mock = DEVICE_REMOTE_MOCK(self);
+  return mock->gmock->ReleaseRemovedEntities(self, init, data);
+}
+
 EebusError CheckEntityInformation(
     const DeviceRemoteObject* self,
     bool init,
@@ -32,6 +32,7 @@ class DeviceRemoteGMockInterface : public DeviceGMockInterface {
  public:
   virtual ~DeviceRemoteGMockInterface() {};
   virtual const char* GetSki(const DeviceRemoteObject* self)                   = 0;
+  virtual DeviceLocalObject* GetLocalDevice(const DeviceRemoteObject* self)    = 0;
   virtual DataReaderObject* GetDataReader(const DeviceRemoteObject* self)      = 0;
   virtual void AddEntity(DeviceRemoteObject* self, EntityRemoteObject* entity) = 0;
   virtual EntityRemoteObject*
@@ -54,12 +55,16 @@ class DeviceRemoteGMockInterface : public DeviceGMockInterface {
   )                                                                                       = 0;
   virtual EebusError HandleSpineMesssage(DeviceRemoteObject* self, MessageBuffer* msg)    = 0;
   virtual SenderObject* GetSender(const DeviceRemoteObject* self)                         = 0;
+  virtual PendingRequestsObject* GetPendingRequests(const DeviceRemoteObject* self)       = 0;
   virtual NodeManagementUseCaseDataType* UseCasesDataCopy(const DeviceRemoteObject* self) = 0;
   virtual void UpdateDevice(DeviceRemoteObject* self, const NetworkManagementDeviceDescriptionDataType* description)
       = 0;
   virtual const Vector*
   AddEntityAndFeatures(DeviceRemoteObject* self, bool init, const NodeManagementDetailedDiscoveryDataType* data)
       = 0;
+  virtual Vector*
+  ReleaseRemovedEntities(DeviceRemoteObject* self, bool init, const NodeManagementDetailedDiscoveryDataType* data)
+      = 0;
   virtual EebusError CheckEntityInformation(
       const DeviceRemoteObject* self,
       bool init,
@@ -76,6 +81,7 @@ class DeviceRemoteGMock : public DeviceRemoteGMockInterface {
   MOCK_METHOD1(GetFeatureSet, const NetworkManagementFeatureSetType*(const DeviceObject*));
   MOCK_METHOD1(CreateDestinationData, const NodeManagementDestinationDataType*(const DeviceObject*));
   MOCK_METHOD1(GetSki, const char*(const DeviceRemoteObject*));
+  MOCK_METHOD1(GetLocalDevice, DeviceLocalObject*(const DeviceRemoteObject*));
   MOCK_METHOD1(GetDataReader, DataReaderObject*(const DeviceRemoteObject*));
   MOCK_METHOD2(AddEntity, void(DeviceRemoteObject*, EntityRemoteObject*));
   MOCK_METHOD3(ReleaseEntity, EntityRemoteObject*(DeviceRemoteObject*, const uint32_t* const*, size_t));
@@ -88,12 +94,17 @@ class DeviceRemoteGMock : public DeviceRemoteGMockInterface {
   );
   MOCK_METHOD2(HandleSpineMesssage, EebusError(DeviceRemoteObject*, MessageBuffer*));
   MOCK_METHOD1(GetSender, SenderObject*(const DeviceRemoteObject*));
+  MOCK_METHOD1(GetPendingRequests, PendingRequestsObject*(const DeviceRemoteObject*));
   MOCK_METHOD1(UseCasesDataCopy, NodeManagementUseCaseDataType*(const DeviceRemoteObject*));
   MOCK_METHOD2(UpdateDevice, void(DeviceRemoteObject*, const NetworkManagementDeviceDescriptionDataType*));
   MOCK_METHOD3(
       AddEntityAndFeatures,
       const Vector*(DeviceRemoteObject*, bool, const NodeManagementDetailedDiscoveryDataType*)
   );
+  MOCK_METHOD3(
+      ReleaseRemovedEntities,
+      Vector*(DeviceRemoteObject*, bool, const NodeManagementDetailedDiscoveryDataType*)
+  );
   MOCK_METHOD3(
       CheckEntityInformation,
       EebusError(const DeviceRemoteObject*, bool, const NodeManagementDetailedDiscoveryEntityInformationType*)
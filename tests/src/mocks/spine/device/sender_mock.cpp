@@ -30,7 +30,8 @@ static EebusError Read(
     SenderObject* self,
     const FeatureAddressType* sender_addr,
     const FeatureAddressType* dest_addr,
-    const CmdType* cmd
+    const CmdType* cmd,
+    MsgCounterType* msg_cnt
 );
 static EebusError
 Reply(SenderObject* self, const HeaderType* request_header, const FeatureAddressType* sender_addr, const CmdType* cmd);
@@ -44,7 +45,8 @@ static EebusError Write(
     SenderObject* self,
     const FeatureAddressType* sender_addr,
     const FeatureAddressType* dest_addr,
-    const CmdType* cmd
+    const CmdType* cmd,
+    MsgCounterType* msg_cnt
 );
 static EebusError CallSubscribe(
     SenderObject* self,
@@ -112,10 +114,11 @@ EebusError Read(
     SenderObject* self,
     const FeatureAddressType* sender_addr,
     const FeatureAddressType* dest_addr,
-    const CmdType* cmd
+    const CmdType* cmd,
+    MsgCounterType* msg_cnt
 ) {
   SenderMock* const mock = SENDER_MOCK(self);
-  return mock->gmock->Read(self, sender_addr, dest_addr, cmd);
+  return mock->gmock->Read(self, sender_addr, dest_addr, cmd, msg_cnt);
 }
 
 EebusError
@@ -138,10 +141,11 @@ EebusError Write(
     SenderObject* self,
     const FeatureAddressType* sender_addr,
     const FeatureAddressType* dest_addr,
-    const CmdType* cmd
+    const CmdType* cmd,
+    MsgCounterType* msg_cnt
 ) {
   SenderMock* const mock = SENDER_MOCK(self);
-  return mock->gmock->Write(self, sender_addr, dest_addr, cmd);
+  return mock->gmock->Write(self, sender_addr, dest_addr, cmd, msg_cnt);
 }
 
 EebusError CallSubscribe(
@@ -34,6 +34,7 @@ static uint32_t GetNextFeatureId(EntityObject* self);
 static DeviceRemoteObject* GetDevice(const EntityRemoteObject* self);
 static void UpdateDeviceAddress(EntityRemoteObject* self, const char* device_addr);
 static void AddFeature(EntityRemoteObject* self, FeatureRemoteObject* feature);
+static void RemoveFeature(EntityRemoteObject* self, FeatureRemoteObject* feature);
 static void RemoveAllFeatures(EntityRemoteObject* self);
 static FeatureRemoteObject*
 GetFeatureWithTypeAndRole(const EntityRemoteObject* self, FeatureTypeType feature_type, RoleType role);
@@ -53,6 +54,7 @@ static const EntityRemoteInterface entity_remote_methods = {
     .get_device                     = GetDevice,
     .update_device_address          = UpdateDeviceAddress,
     .add_feature                    = AddFeature,
+    .remove_feature                 = RemoveFeature,
     .remove_all_features            = RemoveAllFeatures,
     .get_feature_with_type_and_role = GetFeatureWithTypeAndRole,
     .get_feature_with_id            = GetFeatureWithId,
@@ -122,6 +124,11 @@ void AddFeature(EntityRemoteObject* self, FeatureRemoteObject* feature) {
   mock->gmock->AddFeature(self, feature);
 }
 
+void RemoveFeature(EntityRemoteObject* self, FeatureRemoteObject* feature) {
+  EntityRemoteMock* const mock = ENTITY_REMOTE_MOCK(self);
+  mock->gmock->RemoveFeature(self, feature);
+}
+
 void RemoveAllFeatures(EntityRemoteObject* self) {
   EntityRemoteMock* const mock = ENTITY_REMOTE_MOCK(self);
   mock->gmock->RemoveAllFeatures(self);
@@ -34,6 +34,7 @@ class EntityRemoteGMockInterface : public EntityGMockInterface {
   virtual DeviceRemoteObject* GetDevice(const EntityRemoteObject* self)               = 0;
   virtual void UpdateDeviceAddress(EntityRemoteObject* self, const char* device_addr) = 0;
   virtual void AddFeature(EntityRemoteObject* self, FeatureRemoteObject* feature)     = 0;
+  virtual void RemoveFeature(EntityRemoteObject* self, FeatureRemoteObject* feature)  = 0;
   virtual void RemoveAllFeatures(EntityRemoteObject* self)                            = 0;
   virtual FeatureRemoteObject*
   GetFeatureWithTypeAndRole(const EntityRemoteObject* self, FeatureTypeType feature_type, RoleType role)
@@ -54,6 +55,7 @@ class EntityRemoteGMock : public EntityRemoteGMockInterface {
   MOCK_METHOD1(GetDevice, DeviceRemoteObject*(const EntityRemoteObject*));
   MOCK_METHOD2(UpdateDeviceAddress, void(EntityRemoteObject*, const char*));
   MOCK_METHOD2(AddFeature, void(EntityRemoteObject*, FeatureRemoteObject*));
+  MOCK_METHOD2(RemoveFeature, void(EntityRemoteObject*, FeatureRemoteObject*));
   MOCK_METHOD1(RemoveAllFeatures, void(EntityRemoteObject*));
   MOCK_METHOD3(GetFeatureWithTypeAndRole, FeatureRemoteObject*(const EntityRemoteObject*, FeatureTypeType, RoleType));
   MOCK_METHOD2(GetFeatureWithId, FeatureRemoteObject*(const EntityRemoteObject*, const uint32_t*));
@@ -29,8 +29,13 @@ static DeviceLocalObject* GetDevice(const FeatureLocalObject* self);
 static EntityLocalObject* GetEntity(const FeatureLocalObject* self);
 static const void* GetData(const FeatureLocalObject* self, FunctionType function_type);
 static void SetFunctionOperations(FeatureLocalObject* self, FunctionType type, bool read, bool write);
-static EebusError
-AddResponseCallback(FeatureLocalObject* self, MsgCounterType msg_counter_ref, ResponseMessageCallback cb, void* ctx);
+static EebusError AddResponseCallback(
+    FeatureLocalObject* self,
+    const DeviceRemoteObject* remote_device,
+    MsgCounterType msg_counter_ref,
+    ResponseMessageCallback cb,
+    void* ctx
+);
 static void AddResultCallback(FeatureLocalObject* self, ResponseMessageCallback cb, void* ctx);
 static EebusError AddWriteApprovalCallback(FeatureLocalObject* self, WriteApprovalCallback cb, void* ctx);
 static void ApproveOrDenyWrite(FeatureLocalObject* self, const Message* msg, const ErrorType* err);
@@ -58,6 +63,12 @@ static EebusError RequestRemoteDataBySenderAddress(
     const FeatureAddressType* dest_addr,
     uint32_t max_delay
 );
+static EebusError AddPendingRequest(
+    FeatureLocalObject* self,
+    DeviceRemoteObject* remote_device,
+    MsgCounterType msg_cnt,
+    uint32_t max_delay
+);
 static bool HasSubscriptionToRemote(const FeatureLocalObject* self, const FeatureAddressType* remote_addr);
 static EebusError SubscribeToRemote(FeatureLocalObject* self, const FeatureAddressType* remote_addr);
 static EebusError RemoveRemoteSubscription(FeatureLocalObject* self, const FeatureAddressType* remote_addr);
@@ -95,6 +106,7 @@ static const FeatureLocalInterface feature_local_methods = {
     .set_data                              = SetData,
     .request_remote_data                   = RequestRemoteData,
     .request_remote_data_by_sender_address = RequestRemoteDataBySenderAddress,
+    .add_pending_request                   = AddPendingRequest,
     .has_subscription_to_remote            = HasSubscriptionToRemote,
     .subscribe_to_remote                   = SubscribeToRemote,
     .remove_remote_subscription            = RemoveRemoteSubscription,
@@ -185,10 +197,15 @@ void SetFunctionOperations(FeatureLocalObject* self, FunctionType type, bool rea
   mock->gmock->SetFunctionOperations(self, type, read, write);
 }
 
-EebusError
-AddResponseCallback(FeatureLocalObject* self, MsgCounterType msg_counter_ref, ResponseMessageCallback cb, void* ctx) {
+EebusError AddResponseCallback(
+    FeatureLocalObject* self,
+    const DeviceRemoteObject* remote_device,
+    MsgCounterType msg_counter_ref,
+    ResponseMessageCallback cb,
+    void* ctx
+) {
   FeatureLocalMock* const mock = FEATURE_LOCAL_MOCK(self);
-  return mock->gmock->AddResponseCallback(self, msg_counter_ref, cb, ctx);
+  return mock->gmock->AddResponseCallback(self, remote_device, msg_counter_ref, cb, ctx);
 }
 
 void AddResultCallback(FeatureLocalObject* self, ResponseMessageCallback cb, void* ctx) {
@@ -254,6 +271,16 @@ EebusError RequestRemoteDataBySenderAddress(
   return mock->gmock->RequestRemoteDataBySenderAddress(self, cmd, sender, dest_ski, dest_addr, max_delay);
 }
 
+EebusError AddPendingRequest(
+    FeatureLocalObject* self,
+    DeviceRemoteObject* remote_device,
+    MsgCounterType msg_cnt,
+    uint32_t max_delay
+) {
+  FeatureLocalMock* const mock = FEATURE_LOCAL_MOCK(self);
+  return mock->gmock->AddPendingRequest(self, remote_device, msg_cnt, max_delay);
+}
+
 bool HasSubscriptionToRemote(const FeatureLocalObject* self, const FeatureAddressType* remote_addr) {
   FeatureLocalMock* const mock = FEATURE_LOCAL_MOCK(self);
   return mock->gmock->HasSubscriptionToRemote(self, remote_addr);
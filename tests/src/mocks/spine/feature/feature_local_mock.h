@@ -35,9 +35,13 @@ class FeatureLocalGMockInterface : public FeatureGMockInterface {
   virtual EntityLocalObject* GetEntity(const FeatureLocalObject* self)                                   = 0;
   virtual const void* GetData(const FeatureLocalObject* self, FunctionType function_type)                = 0;
   virtual void SetFunctionOperations(FeatureLocalObject* self, FunctionType type, bool read, bool write) = 0;
-  virtual EebusError
-  AddResponseCallback(FeatureLocalObject* self, MsgCounterType msg_counter_ref, ResponseMessageCallback cb, void* ctx)
-      = 0;
+  virtual EebusError AddResponseCallback(
+      FeatureLocalObject* self,
+      const DeviceRemoteObject* remote_device,
+      MsgCounterType msg_counter_ref,
+      ResponseMessageCallback cb,
+      void* ctx
+  ) = 0;
   virtual void AddResultCallback(FeatureLocalObject* self, ResponseMessageCallback cb, void* ctx)            = 0;
   virtual EebusError AddWriteApprovalCallback(FeatureLocalObject* self, WriteApprovalCallback cb, void* ctx) = 0;
   virtual void ApproveOrDenyWrite(FeatureLocalObject* self, const Message* msg, const ErrorType* err)        = 0;
@@ -65,6 +69,12 @@ class FeatureLocalGMockInterface : public FeatureGMockInterface {
       const FeatureAddressType* dest_addr,
       uint32_t max_delay
   )                                                                                                                = 0;
+  virtual EebusError AddPendingRequest(
+      FeatureLocalObject* self,
+      DeviceRemoteObject* remote_device,
+      MsgCounterType msg_cnt,
+      uint32_t max_delay
+  )                                                                                                                = 0;
   virtual bool HasSubscriptionToRemote(const FeatureLocalObject* self, const FeatureAddressType* remote_addr)      = 0;
   virtual EebusError SubscribeToRemote(FeatureLocalObject* self, const FeatureAddressType* remote_addr)            = 0;
   virtual EebusError RemoveRemoteSubscription(FeatureLocalObject* self, const FeatureAddressType* remote_addr)     = 0;
@@ -92,7 +102,10 @@ class FeatureLocalGMock : public FeatureLocalGMockInterface {
   MOCK_METHOD1(GetEntity, EntityLocalObject*(const FeatureLocalObject*));
   MOCK_METHOD2(GetData, const void*(const FeatureLocalObject*, FunctionType));
   MOCK_METHOD4(SetFunctionOperations, void(FeatureLocalObject*, FunctionType, bool, bool));
-  MOCK_METHOD4(AddResponseCallback, EebusError(FeatureLocalObject*, MsgCounterType, ResponseMessageCallback, void*));
+  MOCK_METHOD5(
+      AddResponseCallback,
+      EebusError(FeatureLocalObject*, const DeviceRemoteObject*, MsgCounterType, ResponseMessageCallback, void*)
+  );
   MOCK_METHOD3(AddResultCallback, void(FeatureLocalObject*, ResponseMessageCallback, void*));
   MOCK_METHOD3(AddWriteApprovalCallback, EebusError(FeatureLocalObject*, WriteApprovalCallback, void*));
   MOCK_METHOD3(ApproveOrDenyWrite, void(FeatureLocalObject*, const Message*, const ErrorType*));
@@ -111,6 +124,7 @@ class FeatureLocalGMock : public FeatureLocalGMockInterface {
       RequestRemoteDataBySenderAddress,
       EebusError(FeatureLocalObject*, const CmdType*, SenderObject*, const char*, const FeatureAddressType*, uint32_t)
   );
+  MOCK_METHOD4(AddPendingRequest, EebusError(FeatureLocalObject*, DeviceRemoteObject*, MsgCounterType, uint32_t));
   MOCK_METHOD2(HasSubscriptionToRemote, bool(const FeatureLocalObject*, const FeatureAddressType*));
   MOCK_METHOD2(SubscribeToRemote, EebusError(FeatureLocalObject*, const FeatureAddressType*));
   MOCK_METHOD2(RemoveRemoteSubscription, EebusError(FeatureLocalObject*, const FeatureAddressType*));
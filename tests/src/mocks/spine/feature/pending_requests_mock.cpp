@@ -26,19 +26,27 @@
 #include "src/spine/api/pending_requests_interface.h"
 
 static void Destruct(PendingRequestsObject* self);
-static void AddRequest(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt, uint32_t max_delay);
-static EebusError SetData(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt, const FunctionData* data);
-static EebusError SetResult(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt, EebusError result);
-static const FunctionData* GetData(const PendingRequestsObject* self, const char* ski, uint64_t msg_cnt);
-static EebusError Remove(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt);
+static EebusError Add(
+    PendingRequestsObject* self,
+    MsgCounterType msg_cnt,
+    uint32_t max_delay_ms,
+    PendingRequestTimeoutCallback cb,
+    void* ctx
+);
+static EebusError Remove(PendingRequestsObject* self, MsgCounterType msg_cnt);
+static bool IsFull(const PendingRequestsObject* self);
+static size_t GetSize(const PendingRequestsObject* self);
+static void Tick(PendingRequestsObject* self, uint32_t elapsed_ms);
+static void Clear(PendingRequestsObject* self);
 
 static const PendingRequestsInterface pending_requests_methods = {
-    .destruct    = Destruct,
-    .add_request = AddRequest,
-    .set_data    = SetData,
-    .set_result  = SetResult,
-    .get_data    = GetData,
-    .remove      = Remove,
+    .destruct = Destruct,
+    .add      = Add,
+    .remove   = Remove,
+    .is_full  = IsFull,
+    .get_size = GetSize,
+    .tick     = Tick,
+    .clear    = Clear,
 };
 
 static void PendingRequestsMockConstruct(PendingRequestsMock* self);
@@ -64,27 +72,38 @@ void Destruct(PendingRequestsObject* self) {
   delete mock->gmock;
 }
 
-void AddRequest(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt, uint32_t max_delay) {
+EebusError Add(
+    PendingRequestsObject* self,
+    MsgCounterType msg_cnt,
+    uint32_t max_delay_ms,
+    PendingRequestTimeoutCallback cb,
+    void* ctx
+) {
   PendingRequestsMock* const mock = PENDING_REQUESTS_MOCK(self);
-  mock->gmock->AddRequest(self, ski, msg_cnt, max_delay);
+  return mock->gmock->Add(self, msg_cnt, max_delay_ms, cb, ctx);
 }
 
-EebusError SetData(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt, const FunctionData* data) {
+EebusError Remove(PendingRequestsObject* self, MsgCounterType msg_cnt) {
   PendingRequestsMock* const mock = PENDING_REQUESTS_MOCK(self);
-  return mock->gmock->SetData(self, ski, msg_cnt, data);
+  return mock->gmock->Remove(self, msg_cnt);
 }
 
-EebusError SetResult(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt, EebusError result) {
+bool IsFull(const PendingRequestsObject* self) {
   PendingRequestsMock* const mock = PENDING_REQUESTS_MOCK(self);
-  return mock->gmock->SetResult(self, ski, msg_cnt, result);
+  return mock->gmock->IsFull(self);
 }
 
-const FunctionData* GetData(const PendingRequestsObject* self, const char* ski, uint64_t msg_cnt) {
+size_t GetSize(const PendingRequestsObject* self) {
   PendingRequestsMock* const mock = PENDING_REQUESTS_MOCK(self);
-  return mock->gmock->GetData(self, ski, msg_cnt);
+  return mock->gmock->GetSize(self);
 }
 
-EebusError Remove(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt) {
+void Tick(PendingRequestsObject* self, uint32_t elapsed_ms) {
   PendingRequestsMock* const mock = PENDING_REQUESTS_MOCK(self);
-  return mock->gmock->Remove(self, ski, msg_cnt);
+  mock->gmock->Tick(self, elapsed_ms);
+}
+
+void Clear(PendingRequestsObject* self) {
+  PendingRequestsMock* const mock = PENDING_REQUESTS_MOCK(self);
+  mock->gmock->Clear(self);
 }
@@ -30,24 +30,31 @@
 class PendingRequestsGMockInterface {
  public:
   virtual ~PendingRequestsGMockInterface() {};
-  virtual void Destruct(PendingRequestsObject* self)                                                          = 0;
-  virtual void AddRequest(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt, uint32_t max_delay) = 0;
-  virtual EebusError SetData(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt, const FunctionData* data)
-      = 0;
-  virtual EebusError SetResult(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt, EebusError result) = 0;
-  virtual const FunctionData* GetData(const PendingRequestsObject* self, const char* ski, uint64_t msg_cnt)       = 0;
-  virtual EebusError Remove(PendingRequestsObject* self, const char* ski, uint64_t msg_cnt)                       = 0;
+  virtual void Destruct(PendingRequestsObject* self) = 0;
+  virtual EebusError Add(
+      PendingRequestsObject* self,
+      MsgCounterType msg_cnt,
+      uint32_t max_delay_ms,
+      PendingRequestTimeoutCallback cb,
+      void* ctx
+  )                                                                              = 0;
+  virtual EebusError Remove(PendingRequestsObject* self, MsgCounterType msg_cnt) = 0;
+  virtual bool IsFull(const PendingRequestsObject* self)                         = 0;
+  virtual size_t GetSize(const PendingRequestsObject* self)                      = 0;
+  virtual void Tick(PendingRequestsObject* self, uint32_t elapsed_ms)            = 0;
+  virtual void Clear(PendingRequestsObject* self)                                = 0;
 };
 
 class PendingRequestsGMock : public PendingRequestsGMockInterface {
  public:
   virtual ~PendingRequestsGMock() {};
   MOCK_METHOD1(Destruct, void(PendingRequestsObject*));
-  MOCK_METHOD4(AddRequest, void(PendingRequestsObject*, const char*, uint64_t, uint32_t));
-  MOCK_METHOD4(SetData, EebusError(PendingRequestsObject*, const char*, uint64_t, const FunctionData*));
-  MOCK_METHOD4(SetResult, EebusError(PendingRequestsObject*, const char*, uint64_t, EebusError));
-  MOCK_METHOD3(GetData, const FunctionData*(const PendingRequestsObject*, const char*, uint64_t));
-  MOCK_METHOD3(Remove, EebusError(PendingRequestsObject*, const char*, uint64_t));
+  MOCK_METHOD5(Add, EebusError(PendingRequestsObject*, MsgCounterType, uint32_t, PendingRequestTimeoutCallback, void*));
+  MOCK_METHOD2(Remove, EebusError(PendingRequestsObject*, MsgCounterType));
+  MOCK_METHOD1(IsFull, bool(const PendingRequestsObject*));
+  MOCK_METHOD1(GetSize, size_t(const PendingRequestsObject*));
+  MOCK_METHOD2(Tick, void(PendingRequestsObject*, uint32_t));
+  MOCK_METHOD1(Clear, void(PendingRequestsObject*));
 };
 
 typedef struct PendingRequestsMock {
@@ -38,18 +38,20 @@ static EebusError RemoveSubscription(
 );
 static void RemoveDeviceSubscriptions(SubscriptionManagerObject* self, DeviceRemoteObject* remote_device);
 static void RemoveEntitySubscriptions(SubscriptionManagerObject* self, EntityRemoteObject* remote_entity);
-static void Publish(const SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd);
+static void RemoveFeatureSubscriptions(SubscriptionManagerObject* self, FeatureRemoteObject* remote_feature);
+static void Publish(SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd);
 static NodeManagementSubscriptionDataType*
 CreateSubscriptionData(const SubscriptionManagerObject* self, DeviceRemoteObject* remote_device);
 
 static const SubscriptionManagerInterface subscription_manager_methods = {
-    .destruct                    = Destruct,
-    .add_subscription            = AddSubscription,
-    .remove_subscription         = RemoveSubscription,
-    .remove_device_subscriptions = RemoveDeviceSubscriptions,
-    .remove_entity_subscriptions = RemoveEntitySubscriptions,
-    .publish                     = Publish,
-    .create_subscription_data    = CreateSubscriptionData,
+    .destruct                     = Destruct,
+    .add_subscription             = AddSubscription,
+    .remove_subscription          = RemoveSubscription,
+    .remove_device_subscriptions  = RemoveDeviceSubscriptions,
+    .remove_entity_subscriptions  = RemoveEntitySubscriptions,
+    .remove_feature_subscriptions = RemoveFeatureSubscriptions,
+    .publish                      = Publish,
+    .create_subscription_data     = CreateSubscriptionData,
 };
 
 static void SubscriptionManagerMockConstruct(SubscriptionManagerMock* self);
@@ -103,7 +105,12 @@ void RemoveEntitySubscriptions(SubscriptionManagerObject* self, EntityRemoteObje
   mock->gmock->RemoveEntitySubscriptions(self, remote_entity);
 }
 
-void Publish(const SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd) {
+void RemoveFeatureSubscriptions(SubscriptionManagerObject* self, FeatureRemoteObject* remote_feature) {
+  SubscriptionManagerMock* const mock = SUBSCRIPTION_MANAGER_MOCK(self);
+  mock->gmock->RemoveFeatureSubscriptions(self, remote_feature);
+}
+
+void Publish(SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd) {
   SubscriptionManagerMock* const mock = SUBSCRIPTION_MANAGER_MOCK(self);
   mock->gmock->Publish(self, feature_addr, cmd);
 }
@@ -43,9 +43,8 @@ class SubscriptionManagerGMockInterface {
   )                                                                                                          = 0;
   virtual void RemoveDeviceSubscriptions(SubscriptionManagerObject* self, DeviceRemoteObject* remote_device) = 0;
   virtual void RemoveEntitySubscriptions(SubscriptionManagerObject* self, EntityRemoteObject* remote_entity) = 0;
-  virtual void
-  Publish(const SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd)
-      = 0;
+  virtual void RemoveFeatureSubscriptions(SubscriptionManagerObject* self, FeatureRemoteObject* remote_feature) = 0;
+  virtual void Publish(SubscriptionManagerObject* self, const FeatureAddressType* feature_addr, const CmdType* cmd) = 0;
   virtual NodeManagementSubscriptionDataType* CreateSubscriptionData(
       const SubscriptionManagerObject* self,
       DeviceRemoteObject* remote_device
@@ -66,7 +65,8 @@ class SubscriptionManagerGMock : public SubscriptionManagerGMockInterface {
   );
   MOCK_METHOD2(RemoveDeviceSubscriptions, void(SubscriptionManagerObject*, DeviceRemoteObject*));
   MOCK_METHOD2(RemoveEntitySubscriptions, void(SubscriptionManagerObject*, EntityRemoteObject*));
-  MOCK_METHOD3(Publish, void(const SubscriptionManagerObject*, const FeatureAddressType*, const CmdType*));
+  MOCK_METHOD2(RemoveFeatureSubscriptions, void(SubscriptionManagerObject*, FeatureRemoteObject*));
+  MOCK_METHOD3(Publish, void(SubscriptionManagerObject*, const FeatureAddressType*, const CmdType*));
   MOCK_METHOD2(
       CreateSubscriptionData,
       NodeManagementSubscriptionDataType*(const SubscriptionManagerObject*, DeviceRemoteObject*)
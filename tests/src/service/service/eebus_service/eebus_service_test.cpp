@@ -26,6 +26,7 @@
 #include "src/common/vector.h"
 #include "src/ship/ship_node/ship_node.h"
 #include "src/spine/device/device_local.h"
+#include "src/spine/device/remote_device_cache.h"
 #include "src/spine/model/entity_types.h"
 #include "src/spine/model/feature_types.h"
 
@@ -53,6 +54,10 @@ DeviceLocalCreate(const EebusDeviceInfo* device_info, const NetworkManagementFea
   return DEVICE_LOCAL_OBJECT(device_local_mock);
 }
 
+RemoteDeviceCacheObject* RemoteDeviceCacheCreate(const char* dir) {
+  return nullptr;
+}
+
 static ShipNodeMock* ship_node_mock;
 
 ShipNodeObject* ShipNodeCreate(
@@ -170,3 +175,19 @@ TEST_F(EebusServiceTestSuite, eebus_service_start_stop) {
   EXPECT_CALL(*device_local_mock->gmock, Stop(DEVICE_LOCAL_OBJECT(device_local_mock)));
   EEBUS_SERVICE_STOP(EEBUS_SERVICE_OBJECT(service_));
 }
+
+TEST_F(EebusServiceTestSuite, eebus_service_add_remote_service) {
+  const MdnsEntry entry = {
+      .name    = "remote",
+      .host    = "127.0.0.1",
+      .port    = 4711,
+      .txtvers = "1",
+      .id      = "remote",
+      .path    = "/ship/",
+      .ski     = "remote-ski",
+      .reg     = "false",
+  };
+
+  EXPECT_CALL(*ship_node_mock->gmock, AddRemoteService(SHIP_NODE_OBJECT(ship_node_mock), &entry));
+  EEBUS_SERVICE_ADD_REMOTE_SERVICE(service_, &entry);
+}
@@ -179,6 +179,10 @@ TEST(ConfigurationTests, eebus_service_config_fields_test) {
   EebusServiceConfigSetRegisterAutoAccept(cfg.get(), true);
   EXPECT_EQ(EebusServiceConfigGetRegisterAutoAccept(cfg.get()), true);
 
+  EXPECT_EQ(EebusServiceConfigGetMdnsDisabled(cfg.get()), false);
+  EebusServiceConfigSetMdnsDisabled(cfg.get(), true);
+  EXPECT_EQ(EebusServiceConfigGetMdnsDisabled(cfg.get()), true);
+
   EXPECT_STREQ(EebusServiceConfigGetShipId(cfg.get()), "brand-serial");
 
   EXPECT_STREQ(EebusServiceConfigGetMdnsServiceName(cfg.get()), "brand-serial");
@@ -89,6 +89,41 @@ TEST_P(MdnsEntrySetResolveInfoTests, MdnsEntrySetResolveInfoTests) {
   CheckForMemoryLeaks();
 }
 
+TEST(MdnsEntryTests, MdnsEntryCopyAndCompare) {
+  static const char txt_record[] = "\011txtvers=1"
+                                   "\013path=/ship/"
+                                   "\054ski=0a88ab0d65f2b0116cadbdf1cf955512d4795b52";
+
+  std::unique_ptr<MdnsEntry, decltype(&MdnsEntryDelete)> mdns_entry{
+      MdnsEntryCreate("test_name", ".local", 1),
+      &MdnsEntryDelete
+  };
+
+  MdnsEntrySetHost(mdns_entry.get(), "DESKTOP-IAKQS71.local.");
+  MdnsEntrySetPort(mdns_entry.get(), 4769);
+  ASSERT_EQ(MdnsEntryParseTxtRecord(mdns_entry.get(), txt_record, sizeof(txt_record) - 1), kEebusErrorOk);
+
+  std::unique_ptr<MdnsEntry, decltype(&MdnsEntryDelete)> mdns_entry_copy{
+      MdnsEntryCopy(mdns_entry.get()),
+      &MdnsEntryDelete
+  };
+
+  ASSERT_NE(mdns_entry_copy, nullptr);
+  EXPECT_NE(MdnsEntryGetSki(mdns_entry_copy.get()), MdnsEntryGetSki(mdns_entry.get()));
+  EXPECT_EQ(StringPtr(MdnsEntryGetSki(mdns_entry_copy.get())), StringPtr(MdnsEntryGetSki(mdns_entry.get())));
+  EXPECT_TRUE(MdnsEntryIsEqual(mdns_entry_copy.get(), mdns_entry.get()));
+
+  // A moved service is reported as changed
+  MdnsEntrySetPort(mdns_entry_copy.get(), 4770);
+  EXPECT_FALSE(MdnsEntryIsEqual(mdns_entry_copy.get(), mdns_entry.get()));
+
+  mdns_entry_copy.reset();
+  mdns_entry.reset();
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
 INSTANTIATE_TEST_SUITE_P(
     MdnsEntrySetResolveInfoTests,
     MdnsEntrySetResolveInfoTests,
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "src/ship/mdns/mdns_entry_list.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tests/src/memory_leak.inc"
+
+namespace {
+
+using ChangeRecord = std::pair<std::string, MdnsEntryChange>;
+
+MdnsEntry* CreateEntry(const char* name, const char* host, int port) {
+  MdnsEntry* const entry = MdnsEntryCreate(name, "local.", 0);
+  EXPECT_NE(entry, nullptr);
+  EXPECT_EQ(MdnsEntrySetHost(entry, host), kEebusErrorOk);
+  MdnsEntrySetPort(entry, port);
+  return entry;
+}
+
+void CollectChange(const MdnsEntry* entry, MdnsEntryChange change, void* context) {
+  static_cast<std::vector<ChangeRecord>*>(context)->emplace_back(MdnsEntryGetName(entry), change);
+}
+
+}  // namespace
+
+class MdnsEntryListTests : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    VectorConstructWithDeallocator(&known_entries_, MdnsEntryDeallocator);
+    VectorConstructWithDeallocator(&new_entries_, MdnsEntryDeallocator);
+  }
+
+  void TearDown() override {
+    VectorFreeElements(&known_entries_);
+    VectorDestruct(&known_entries_);
+    VectorFreeElements(&new_entries_);
+    VectorDestruct(&new_entries_);
+
+    EXPECT_EQ(heap_used, 0);
+    CheckForMemoryLeaks();
+  }
+
+  Vector known_entries_;
+  Vector new_entries_;
+};
+
+TEST_F(MdnsEntryListTests, MdnsEntryListDiffReportsChanges) {
+  VectorPushBack(&known_entries_, CreateEntry("removed", "host-a.local.", 4711));
+  VectorPushBack(&known_entries_, CreateEntry("unchanged", "host-b.local.", 4711));
+  VectorPushBack(&known_entries_, CreateEntry("changed", "host-c.local.", 4711));
+
+  VectorPushBack(&new_entries_, CreateEntry("added", "host-d.local.", 4711));
+  VectorPushBack(&new_entries_, CreateEntry("unchanged", "host-b.local.", 4711));
+  VectorPushBack(&new_entries_, CreateEntry("changed", "host-c.local.", 4712));
+
+  std::vector<ChangeRecord> changes;
+  MdnsEntryListDiff(&known_entries_, &new_entries_, CollectChange, &changes);
+
+  // Removals come first, so a service can not appear twice in between
+  const std::vector<ChangeRecord> expected_changes = {
+      {"removed", kMdnsEntryRemoved},
+      {"added", kMdnsEntryAdded},
+      {"changed", kMdnsEntryChanged},
+  };
+  EXPECT_EQ(changes, expected_changes);
+
+  // The known entries are replaced with the new ones
+  EXPECT_EQ(VectorGetSize(&new_entries_), 0);
+  ASSERT_EQ(VectorGetSize(&known_entries_), 3);
+  EXPECT_EQ(MdnsEntryListFind(&known_entries_, "removed"), nullptr);
+  ASSERT_NE(MdnsEntryListFind(&known_entries_, "changed"), nullptr);
+  EXPECT_EQ(MdnsEntryGetPort(MdnsEntryListFind(&known_entries_, "changed")), 4712);
+
+  // The same result again is not a change
+  VectorPushBack(&new_entries_, CreateEntry("added", "host-d.local.", 4711));
+  VectorPushBack(&new_entries_, CreateEntry("unchanged", "host-b.local.", 4711));
+  VectorPushBack(&new_entries_, CreateEntry("changed", "host-c.local.", 4712));
+
+  changes.clear();
+  MdnsEntryListDiff(&known_entries_, &new_entries_, CollectChange, &changes);
+  EXPECT_TRUE(changes.empty());
+  EXPECT_EQ(VectorGetSize(&known_entries_), 3);
+}
+
+TEST_F(MdnsEntryListTests, MdnsEntryListMergeTakesOwnership) {
+  MdnsEntryChange change = kMdnsEntryRemoved;
+
+  MdnsEntry* const entry = CreateEntry("service", "host-a.local.", 4711);
+  EXPECT_TRUE(MdnsEntryListMerge(&known_entries_, entry, &change));
+  EXPECT_EQ(change, kMdnsEntryAdded);
+  EXPECT_EQ(MdnsEntryListFind(&known_entries_, "service"), entry);
+
+  // Re-announcement with the same data is released and not reported
+  change = kMdnsEntryRemoved;
+  EXPECT_FALSE(MdnsEntryListMerge(&known_entries_, CreateEntry("service", "host-a.local.", 4711), &change));
+  EXPECT_EQ(change, kMdnsEntryRemoved);
+  EXPECT_EQ(MdnsEntryListFind(&known_entries_, "service"), entry);
+
+  MdnsEntry* const moved_entry = CreateEntry("service", "host-b.local.", 4711);
+  EXPECT_TRUE(MdnsEntryListMerge(&known_entries_, moved_entry, &change));
+  EXPECT_EQ(change, kMdnsEntryChanged);
+  EXPECT_EQ(MdnsEntryListFind(&known_entries_, "service"), moved_entry);
+  EXPECT_EQ(VectorGetSize(&known_entries_), 1);
+}
+
+TEST_F(MdnsEntryListTests, MdnsEntryListApplyChangeCopiesEntry) {
+  MdnsEntry* const entry = CreateEntry("service", "host-a.local.", 4711);
+  EXPECT_EQ(MdnsEntryListApplyChange(&known_entries_, entry, kMdnsEntryAdded), kEebusErrorOk);
+
+  const MdnsEntry* const entry_copy = MdnsEntryListFind(&known_entries_, "service");
+  ASSERT_NE(entry_copy, nullptr);
+  EXPECT_NE(entry_copy, entry);
+  EXPECT_TRUE(MdnsEntryIsEqual(entry_copy, entry));
+  MdnsEntryDelete(entry);
+
+  MdnsEntry* const moved_entry = CreateEntry("service", "host-b.local.", 4711);
+  EXPECT_EQ(MdnsEntryListApplyChange(&known_entries_, moved_entry, kMdnsEntryChanged), kEebusErrorOk);
+  ASSERT_EQ(VectorGetSize(&known_entries_), 1);
+  EXPECT_STREQ(MdnsEntryGetHost(MdnsEntryListFind(&known_entries_, "service")), "host-b.local.");
+
+  EXPECT_EQ(MdnsEntryListApplyChange(&known_entries_, moved_entry, kMdnsEntryRemoved), kEebusErrorOk);
+  EXPECT_EQ(VectorGetSize(&known_entries_), 0);
+  MdnsEntryDelete(moved_entry);
+
+  // Removal of the unknown entry is harmless
+  MdnsEntry* const unknown_entry = CreateEntry("unknown", "host-c.local.", 4711);
+  EXPECT_EQ(MdnsEntryListApplyChange(&known_entries_, unknown_entry, kMdnsEntryRemoved), kEebusErrorOk);
+  EXPECT_EQ(VectorGetSize(&known_entries_), 0);
+  MdnsEntryDelete(unknown_entry);
+}
@@ -53,7 +53,7 @@ TEST_P(ShipConnectionCmiStateSendInitMessageTests, CmiClientInitMessageSendTest)
     ret_num_bytes = 0;
   }
 
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, message_size))
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, message_size, _))
       .WillOnce(Return(static_cast<int32_t>(ret_num_bytes)));
   EXPECT_CALL(*ifp_mock->gmock, HandleShipStateUpdate(sc.info_provider, testing::StrCaseEq(TEST_REMOTE_SKI),
                                     GetParam().expected_sme_state, testing::StrCaseEq("")));
@@ -28,6 +28,7 @@ using testing::Return;
 struct ShipProtHandshakeClientInitTestInput {
   std::string_view description     = ""sv;
   const char* close_error_msg      = "";
+  bool is_cbor_enabled             = false;
   std::string_view msg             = R"({"messageProtocolHandshake": [
                                         {"handshakeType": "announceMax"},
                                         {"version": [{"major": 1}, {"minor": 0}]},
@@ -52,9 +53,11 @@ TEST_P(ShipConnectionProtocolHandshakeClientInitTests, ProtHandshakeClientInitSt
 
   const size_t msg_size      = strlen(s) + 1;
   const size_t ret_num_bytes = GetParam().msg_send_successful ? msg_size : 0;
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_size))
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_size, _))
       .WillOnce(Return(static_cast<int32_t>(ret_num_bytes)));
 
+  EXPECT_CALL(*ifp_mock->gmock, IsCborEnabledForSki(sc.info_provider, testing::StrCaseEq(TEST_REMOTE_SKI)))
+      .WillOnce(Return(GetParam().is_cbor_enabled));
   EXPECT_CALL(*wfr_timer_mock->gmock, Stop(sc.wait_for_ready_timer)).Times(2);
   EXPECT_CALL(*spr_timer_mock->gmock, Stop(sc.send_prolongation_request_timer));
   EXPECT_CALL(*prr_timer_mock->gmock, Stop(sc.prolongation_request_reply_timer));
@@ -74,6 +77,7 @@ TEST_P(ShipConnectionProtocolHandshakeClientInitTests, ProtHandshakeClientInitSt
 
   // Assert: SME state changed accordingly
   EXPECT_EQ(SHIP_CONNECTION_GET_SHIP_STATE(&sc, NULL), GetParam().expected_sme_state);
+  EXPECT_EQ(sc.is_cbor_offered, GetParam().is_cbor_enabled);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -88,6 +92,17 @@ INSTANTIATE_TEST_SUITE_P(
             .description         = "Message successfully sent"sv,
             .msg_send_successful = true,
             .expected_sme_state  = kSmeProtHStateClientListenChoice,
+        },
+        ShipProtHandshakeClientInitTestInput{
+            .description         = "Message offering CBOR to the server opted in successfully sent"sv,
+            .is_cbor_enabled     = true,
+            .msg                 = R"({"messageProtocolHandshake": [
+                                      {"handshakeType": "announceMax"},
+                                      {"version": [{"major": 1}, {"minor": 0}]},
+                                      {"formats": [{"format": ["JSON-UTF8", "openeebus-CBOR"]}]}
+                                    ]})"sv,
+            .msg_send_successful = true,
+            .expected_sme_state  = kSmeProtHStateClientListenChoice,
         }
     )
 );
@@ -33,6 +33,8 @@ struct ShipProtHandshakeClientListenChoiceTestInput {
   SmeState expected_sme_state               = kSmeStateError;
   bool msg_send_successful                  = false;
   std::string_view abort_err_msg            = R"({"messageProtocolHandshakeError":[{"error":2}]})";
+  bool is_cbor_offered                      = false;
+  MessageProtocolFormatType expected_format = kMessageProtocolFormatTypeUTF8;
 };
 class ShipConnectionProtocolHandshakeClientListenChoiceBadMessageFormatReceivedTests
     : public ShipConnectionTestSuite,
@@ -75,7 +77,7 @@ TEST_P(
   EXPECT_CALL(*prr_timer_mock->gmock, Stop(sc.prolongation_request_reply_timer));
 
   const size_t abort_msg_size = GetParam().abort_err_msg.size() + 1;
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size)).WillOnce(Return(0));
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size, _)).WillOnce(Return(0));
   EXPECT_CALL(
       *ifp_mock->gmock,
       HandleShipStateUpdate(
@@ -152,7 +154,7 @@ TEST_P(
   EXPECT_CALL(*prr_timer_mock->gmock, Stop(sc.prolongation_request_reply_timer));
 
   const size_t abort_msg_size = GetParam().abort_err_msg.size() + 1;
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size)).WillOnce(Return(0));
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size, _)).WillOnce(Return(0));
   EXPECT_CALL(
       *ifp_mock->gmock,
       HandleShipStateUpdate(
@@ -165,6 +167,7 @@ TEST_P(
   ExpectCloseWithError(GetParam().close_error_msg, false);
 
   // Act: Check message format errors
+  sc.is_cbor_offered = GetParam().is_cbor_offered;
   SmeProtHandshakeStateClientListenChoice(&sc);
 
   // Assert: SME state changed accordingly
@@ -214,6 +217,14 @@ INSTANTIATE_TEST_SUITE_P(
                               {"version": [{"major": 1}, {"minor": 0}]},
                               {"formats": [{"format": ["JSON-UTF16"]}]}
                            ]})"sv,
+        },
+        ShipProtHandshakeClientListenChoiceTestInput{
+            .description = "CBOR selected without being offered"sv,
+            .msg         = R"({"messageProtocolHandshake": [
+                              {"handshakeType": "select"},
+                              {"version": [{"major": 1}, {"minor": 0}]},
+                              {"formats": [{"format": ["openeebus-CBOR"]}]}
+                           ]})"sv,
         }
     )
 );
@@ -242,7 +253,7 @@ TEST_P(
   // Expect message send function calls
   const size_t msg_len       = strlen(s) + 1;
   const size_t ret_num_bytes = GetParam().msg_send_successful ? msg_len : 0;
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_len))
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_len, _))
       .WillOnce(Return(static_cast<int32_t>(ret_num_bytes)));
   EXPECT_CALL(
       *ifp_mock->gmock,
@@ -256,10 +267,12 @@ TEST_P(
   ExpectCloseWithError(GetParam().close_error_msg, false);
 
   // Act: Send message
+  sc.is_cbor_offered = GetParam().is_cbor_offered;
   SmeProtHandshakeStateClientListenChoice(&sc);
 
-  // Assert: SME state changed accordingly
+  // Assert: SME state and format changed accordingly
   EXPECT_EQ(SHIP_CONNECTION_GET_SHIP_STATE(&sc, NULL), GetParam().expected_sme_state);
+  EXPECT_EQ(sc.format, GetParam().expected_format);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -285,6 +298,32 @@ INSTANTIATE_TEST_SUITE_P(
                                     ]})"sv,
             .expected_sme_state  = kSmeProtHStateClientOk,
             .msg_send_successful = true,
+        },
+        ShipProtHandshakeClientListenChoiceTestInput{
+            .description         = "CBOR offered, JSON only server selects JSON"sv,
+            .close_error_msg     = "",
+            .msg                 = R"({"messageProtocolHandshake": [
+                                      {"handshakeType": "select"},
+                                      {"version": [{"major": 1}, {"minor": 0}]},
+                                      {"formats": [{"format": ["JSON-UTF8"]}]}
+                                    ]})"sv,
+            .expected_sme_state  = kSmeProtHStateClientOk,
+            .msg_send_successful = true,
+            .is_cbor_offered     = true,
+            .expected_format     = kMessageProtocolFormatTypeUTF8,
+        },
+        ShipProtHandshakeClientListenChoiceTestInput{
+            .description         = "CBOR offered and selected"sv,
+            .close_error_msg     = "",
+            .msg                 = R"({"messageProtocolHandshake": [
+                                      {"handshakeType": "select"},
+                                      {"version": [{"major": 1}, {"minor": 0}]},
+                                      {"formats": [{"format": ["openeebus-CBOR"]}]}
+                                    ]})"sv,
+            .expected_sme_state  = kSmeProtHStateClientOk,
+            .msg_send_successful = true,
+            .is_cbor_offered     = true,
+            .expected_format     = kMessageProtocolFormatTypeCbor,
         }
     )
 );
@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 
 #include <string_view>
+#include <vector>
 
 #include "mocks/ship/api/data_reader_mock.h"
 #include "src/common/json.h"
@@ -241,10 +242,12 @@ TEST_F(ShipConnectionTestSuite, ShipConnectionDataExchangeSendSpineDataTest) {
   );
 
   // Add message to queue
-  queue_msg.type = kShipConnectionQueueMsgTypeSpineDataToSend;
+  queue_msg.type     = kShipConnectionQueueMsgTypeSpineDataToSend;
+  queue_msg.priority = kMessagePriorityResult;
   EEBUS_QUEUE_SEND(sc.msg_queue, &queue_msg, sizeof(queue_msg));
 
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, _))
+  // SPINE data keeps the priority given by the sender
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, _, kMessagePriorityResult))
       .WillOnce(WithArgs<1, 2>(Invoke([](const uint8_t* msg, size_t msg_size) -> int32_t {
         EXPECT_NE(msg, nullptr);
         EXPECT_GT(msg_size, 1);
@@ -276,3 +279,112 @@ TEST_F(ShipConnectionTestSuite, ShipConnectionDataExchangeSendSpineDataTest) {
   EXPECT_EQ(SHIP_CONNECTION_GET_SHIP_STATE(&sc, NULL), kDataExchange);
   ExpectCloseWithError("", true);
 }
+
+TEST_F(ShipConnectionTestSuite, ShipConnectionDataExchangeCloseOnWriteDoneTest) {
+  // Arrange: Data exchange in progress
+  sc.is_access_methods_req_sent = true;
+  SetShipConnectionState(kDataExchange);
+
+  EXPECT_CALL(*wfr_timer_mock->gmock, Stop(sc.wait_for_ready_timer));
+  EXPECT_CALL(*prr_timer_mock->gmock, Stop(sc.prolongation_request_reply_timer));
+  EXPECT_CALL(*spr_timer_mock->gmock, Stop(sc.send_prolongation_request_timer));
+
+  // Connection termination announce is sent, the close is deferred until it is written out
+  std::vector<uint8_t> close_msg;
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, _, kMessagePriorityControl))
+      .WillOnce(WithArgs<1, 2>(Invoke([&close_msg](const uint8_t* msg, size_t msg_size) {
+        close_msg.assign(msg, msg + msg_size);
+        return static_cast<int32_t>(msg_size);
+      })));
+  EXPECT_CALL(*close_timer_mock->gmock, Start(sc.close_timer, _, false));
+  EXPECT_CALL(*websocket_mock->gmock, Close(_, _, _)).Times(0);
+
+  // Act: Close the connection safely
+  SHIP_CONNECTION_CLOSE_CONNECTION(SHIP_CONNECTION_OBJECT(&sc), true, 0, "");
+
+  // Assert: Connection is still alive until the write completion
+  EXPECT_TRUE(sc.is_close_pending);
+  EXPECT_FALSE(sc.shutdown_once);
+  testing::Mock::VerifyAndClearExpectations(websocket_mock->gmock);
+
+  // Act: Report the write completion of the message queued before the close message
+  static constexpr uint8_t kOtherMsg[] = {1, '{', '}'};
+  ShipConnectionWebsocketCallback(kWebsocketCallbackTypeWriteDone, kOtherMsg, sizeof(kOtherMsg), &sc);
+
+  // Assert: Nothing to be handled, the close message is still on its way
+  EXPECT_TRUE(EEBUS_QUEUE_IS_EMPTY(sc.msg_queue));
+
+  // Act: Report the write completion of the close message and handle it
+  ASSERT_FALSE(close_msg.empty());
+  ShipConnectionWebsocketCallback(kWebsocketCallbackTypeWriteDone, close_msg.data(), close_msg.size(), &sc);
+  EXPECT_FALSE(EEBUS_QUEUE_IS_EMPTY(sc.msg_queue));
+
+  EXPECT_CALL(*close_timer_mock->gmock, Stop(sc.close_timer));
+  ExpectCloseWithError("close", true);
+  DataExchange(&sc);
+
+  // Assert: Connection is closed without waiting for the timeout
+  EXPECT_FALSE(sc.is_close_pending);
+  EXPECT_TRUE(sc.shutdown_once);
+}
+
+TEST_F(ShipConnectionTestSuite, ShipConnectionDataExchangeBackpressureTest) {
+  // Arrange: Fill the connection queue up
+  SetShipConnectionState(kDataExchange);
+
+  static const uint8_t msg[] = {kMsgTypeData, '{', '}'};
+
+  while (!EEBUS_QUEUE_IS_FULL(sc.msg_queue)) {
+    ASSERT_EQ(ShipConnectionWebsocketCallback(kWebsocketCallbackTypeRead, msg, sizeof(msg), &sc), kEebusErrorOk);
+  }
+
+  // Act & Assert: Received message is pushed back to the websocket instead of blocking it
+  EXPECT_EQ(
+      ShipConnectionWebsocketCallback(kWebsocketCallbackTypeRead, msg, sizeof(msg), &sc),
+      kEebusErrorCommunicationBusy
+  );
+  EXPECT_EQ(sc.rx_busy_cnt, 1);
+
+  // Act & Assert: Outgoing SPINE messages are deferred to the backlog with no write credit left
+  static const uint8_t spine_msg[] = {'{', '}'};
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(
+        DATA_WRITER_WRITE_MESSAGE(DATA_WRITER_OBJECT(&sc), spine_msg, sizeof(spine_msg), kMessagePriorityData),
+        kEebusErrorOk
+    );
+  }
+
+  EXPECT_EQ(sc.tx_busy_cnt, 2);
+  EXPECT_EQ(VectorGetSize(&sc.tx_backlog), 2);
+  EXPECT_EQ(sc.tx_backlog_depth_max, 2);
+
+  // Act: The SHIP thread takes a message from the queue
+  ShipConnectionQueueMessage queue_msg;
+  ASSERT_EQ(EEBUS_QUEUE_RECEIVE(sc.msg_queue, &queue_msg, 0), kEebusErrorOk);
+  EXPECT_EQ(queue_msg.type, kShipConnectionQueueMsgTypeDataReceived);
+  MessageBufferRelease(&queue_msg.msg_buf);
+  ShipConnectionRetryTxBacklog(&sc);
+
+  // Assert: The oldest deferred message takes the freed room, the other one stays in the backlog
+  EXPECT_TRUE(EEBUS_QUEUE_IS_FULL(sc.msg_queue));
+  EXPECT_EQ(VectorGetSize(&sc.tx_backlog), 1);
+
+  // Act: Drain the queue, moving the backlog on each message taken
+  std::vector<ShipConnectionQueueMsgType> queue_msg_types;
+  while (EEBUS_QUEUE_RECEIVE(sc.msg_queue, &queue_msg, 0) == kEebusErrorOk) {
+    queue_msg_types.push_back(queue_msg.type);
+    MessageBufferRelease(&queue_msg.msg_buf);
+    ShipConnectionRetryTxBacklog(&sc);
+  }
+
+  // Assert: Nothing is lost, the SPINE messages are queued behind the received ones
+  ASSERT_GE(queue_msg_types.size(), 3);
+  EXPECT_EQ(queue_msg_types[queue_msg_types.size() - 1], kShipConnectionQueueMsgTypeSpineDataToSend);
+  EXPECT_EQ(queue_msg_types[queue_msg_types.size() - 2], kShipConnectionQueueMsgTypeSpineDataToSend);
+  EXPECT_EQ(queue_msg_types[queue_msg_types.size() - 3], kShipConnectionQueueMsgTypeDataReceived);
+  EXPECT_EQ(VectorGetSize(&sc.tx_backlog), 0);
+
+  // Make room for the cancel message on stop
+  EEBUS_QUEUE_CLEAR(sc.msg_queue);
+  ExpectCloseWithError("", true);
+}
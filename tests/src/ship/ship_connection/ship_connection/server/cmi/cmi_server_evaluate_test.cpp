@@ -88,7 +88,7 @@ TEST_P(ShipConnectionServerCmiStateEvaluateInitMessageTests, CmiStateServerEvalu
 
   if (GetParam().expected_sme_state != kSmeStateError) {
     // Message is sent, expect call
-    EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_size))
+    EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_size, _))
         .WillOnce(Return(static_cast<int32_t>(msg_size)));
   }
 
@@ -71,7 +71,7 @@ TEST_P(
   EXPECT_CALL(*prr_timer_mock->gmock, Stop(sc.prolongation_request_reply_timer));
 
   const size_t abort_msg_size = GetParam().abort_err_msg.size() + 1;
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size)).WillOnce(Return(0));
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size, _)).WillOnce(Return(0));
   EXPECT_CALL(
       *ifp_mock->gmock,
       HandleShipStateUpdate(
@@ -152,7 +152,7 @@ TEST_P(
 
   if (GetParam().expected_sme_state == kSmeStateError) {
     const size_t abort_msg_size = GetParam().abort_err_msg.size() + 1;
-    EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size)).WillOnce(Return(0));
+    EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size, _)).WillOnce(Return(0));
   }
 
   EXPECT_CALL(
@@ -33,6 +33,13 @@ struct ShipProtHandshakeServerListenProposalTestInput {
   SmeState expected_sme_state               = kSmeStateError;
   bool msg_send_successful                  = false;
   std::string_view abort_err_msg            = R"({"messageProtocolHandshakeError":[{"error":2}]})";
+  bool is_cbor_enabled                      = false;
+  MessageProtocolFormatType expected_format = kMessageProtocolFormatTypeUTF8;
+  std::string_view agreement_msg            = R"({"messageProtocolHandshake": [
+                                                  {"handshakeType": "select"},
+                                                  {"version": [{"major": 1}, {"minor": 0}]},
+                                                  {"formats": [{"format": ["JSON-UTF8"]}]}
+                                                ]})"sv;
 };
 
 class ShipConnectionProtocolHandshakeServerListenProposalMessageReceiveTests
@@ -76,7 +83,7 @@ TEST_P(
   EXPECT_CALL(*prr_timer_mock->gmock, Stop(sc.prolongation_request_reply_timer));
 
   const size_t abort_msg_size = GetParam().abort_err_msg.size() + 1;
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size)).WillOnce(Return(0));
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size, _)).WillOnce(Return(0));
   EXPECT_CALL(
       *ifp_mock->gmock,
       HandleShipStateUpdate(
@@ -156,7 +163,7 @@ TEST_P(
   EXPECT_CALL(*prr_timer_mock->gmock, Stop(sc.prolongation_request_reply_timer));
 
   const size_t abort_msg_size = GetParam().abort_err_msg.size() + 1;
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size)).WillOnce(Return(0));
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, abort_msg_size, _)).WillOnce(Return(0));
   EXPECT_CALL(
       *ifp_mock->gmock,
       HandleShipStateUpdate(
@@ -224,20 +231,16 @@ TEST_P(
   queue_msg.type = GetParam().queue_msg_type;
   EEBUS_QUEUE_SEND(sc.msg_queue, &queue_msg, sizeof(queue_msg));
 
-  const std::string_view version_agreement_msg = R"({"messageProtocolHandshake": [
-                                                    {"handshakeType": "select"},
-                                                    {"version": [{"major": 1}, {"minor": 0}]},
-                                                    {"formats": [{"format": ["JSON-UTF8"]}]}
-                                                  ]})"sv;
-
-  std::unique_ptr<char[], decltype(&JsonFree)> version_msg(JsonUnformat(version_agreement_msg), JsonFree);
+  std::unique_ptr<char[], decltype(&JsonFree)> version_msg(JsonUnformat(GetParam().agreement_msg), JsonFree);
   ASSERT_NE(s, nullptr) << "Wrong test input!";
 
   const size_t version_agreement_msg_size = strlen(version_msg.get()) + 1;
   const size_t ret_num_bytes              = GetParam().msg_send_successful ? version_agreement_msg_size : 0;
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, static_cast<int32_t>(version_agreement_msg_size)))
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, static_cast<int32_t>(version_agreement_msg_size), _))
       .WillOnce(Return(static_cast<int32_t>(ret_num_bytes)));
   EXPECT_CALL(*wfr_timer_mock->gmock, Start(sc.wait_for_ready_timer, cmiTimeout, false));
+  EXPECT_CALL(*ifp_mock->gmock, IsCborEnabledForSki(sc.info_provider, testing::StrCaseEq(TEST_REMOTE_SKI)))
+      .WillOnce(Return(GetParam().is_cbor_enabled));
 
   // Expect timer function calls
   EXPECT_CALL(*wfr_timer_mock->gmock, Stop(sc.wait_for_ready_timer)).Times(3);
@@ -258,8 +261,9 @@ TEST_P(
   // Act: Check message send handling
   SmeProtHandshakeStateServerListenProposal(&sc);
 
-  // Assert: SME state changed accordingly
+  // Assert: SME state and format changed accordingly
   EXPECT_EQ(SHIP_CONNECTION_GET_SHIP_STATE(&sc, NULL), GetParam().expected_sme_state);
+  EXPECT_EQ(sc.format, GetParam().expected_format);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -277,6 +281,35 @@ INSTANTIATE_TEST_SUITE_P(
             .expected_sme_state  = kSmeProtHStateServerListenConfirm,
             .msg_send_successful = true,
         },
+        ShipProtHandshakeServerListenProposalTestInput{
+            .description         = "CBOR offered by the client opted in, CBOR selected"sv,
+            .close_error_msg     = "",
+            .msg                 = R"({"messageProtocolHandshake": [
+                                      {"handshakeType": "announceMax"},
+                                      {"version": [{"major": 1}, {"minor": 0}]},
+                                      {"formats": [{"format": ["JSON-UTF8", "openeebus-CBOR"]}]}
+                                    ]})"sv,
+            .expected_sme_state  = kSmeProtHStateServerListenConfirm,
+            .msg_send_successful = true,
+            .is_cbor_enabled     = true,
+            .expected_format     = kMessageProtocolFormatTypeCbor,
+            .agreement_msg       = R"({"messageProtocolHandshake": [
+                                      {"handshakeType": "select"},
+                                      {"version": [{"major": 1}, {"minor": 0}]},
+                                      {"formats": [{"format": ["openeebus-CBOR"]}]}
+                                    ]})"sv,
+        },
+        ShipProtHandshakeServerListenProposalTestInput{
+            .description         = "CBOR offered by the client not opted in, JSON selected"sv,
+            .close_error_msg     = "",
+            .msg                 = R"({"messageProtocolHandshake": [
+                                      {"handshakeType": "announceMax"},
+                                      {"version": [{"major": 1}, {"minor": 0}]},
+                                      {"formats": [{"format": ["JSON-UTF8", "openeebus-CBOR"]}]}
+                                    ]})"sv,
+            .expected_sme_state  = kSmeProtHStateServerListenConfirm,
+            .msg_send_successful = true,
+        },
         ShipProtHandshakeServerListenProposalTestInput{
             .description     = "Proper version message received, error while sending agreement message"sv,
             .close_error_msg = "Error serializing protocol handshake ship message",
@@ -68,10 +68,11 @@ void ShipConnectionTestSuite::SetUp() {
   );
 
   SHIP_CONNECTION_START(SHIP_CONNECTION_OBJECT(&sc), WEBSOCKET_CREATOR_OBJECT(websocket_creator_mock));
-  wfr_timer_mock = EEBUS_TIMER_MOCK(sc.wait_for_ready_timer);
-  prr_timer_mock = EEBUS_TIMER_MOCK(sc.prolongation_request_reply_timer);
-  spr_timer_mock = EEBUS_TIMER_MOCK(sc.send_prolongation_request_timer);
-  websocket_mock = WEBSOCKET_MOCK(sc.websocket);
+  wfr_timer_mock   = EEBUS_TIMER_MOCK(sc.wait_for_ready_timer);
+  prr_timer_mock   = EEBUS_TIMER_MOCK(sc.prolongation_request_reply_timer);
+  spr_timer_mock   = EEBUS_TIMER_MOCK(sc.send_prolongation_request_timer);
+  close_timer_mock = EEBUS_TIMER_MOCK(sc.close_timer);
+  websocket_mock   = WEBSOCKET_MOCK(sc.websocket);
 }
 
 void ShipConnectionTestSuite::TearDown() {
@@ -81,6 +82,7 @@ void ShipConnectionTestSuite::TearDown() {
   EXPECT_CALL(*wfr_timer_mock->gmock, Destruct(sc.wait_for_ready_timer));
   EXPECT_CALL(*spr_timer_mock->gmock, Destruct(sc.send_prolongation_request_timer));
   EXPECT_CALL(*prr_timer_mock->gmock, Destruct(sc.prolongation_request_reply_timer));
+  EXPECT_CALL(*close_timer_mock->gmock, Destruct(sc.close_timer));
   SHIP_CONNECTION_DESTRUCT(&sc);
 
   EXPECT_CALL(*ifp_mock->gmock, Destruct(INFO_PROVIDER_OBJECT(ifp_mock)));
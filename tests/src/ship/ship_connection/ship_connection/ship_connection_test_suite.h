@@ -46,6 +46,9 @@ class ShipConnectionTestSuite : public testing::Test {
 
   /** Mock for the prolongation-request-reply timer */
   EebusTimerMock* prr_timer_mock;
+
+  /** Mock for the close message flush timer */
+  EebusTimerMock* close_timer_mock;
   TlsCertificateMock* tls_cert_mock;
   InfoProviderMock* ifp_mock;
   WebsocketMock* websocket_mock;
@@ -49,7 +49,7 @@ TEST_P(ShipConnectionHelloStatePendingInitTests, SmeHelloPendingInitTest) {
   // Calculate message size and expect function calls
   const size_t msg_size      = strlen(s.get()) + 1;
   const size_t ret_num_bytes = GetParam().msg_send_successful ? msg_size : 0;
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_size))
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_size, _))
       .WillOnce(Return(static_cast<int32_t>(ret_num_bytes)));
   EXPECT_CALL(*wfr_timer_mock->gmock, Stop(sc.wait_for_ready_timer));
   EXPECT_CALL(*spr_timer_mock->gmock, Stop(sc.send_prolongation_request_timer)).Times(2);
@@ -191,7 +191,7 @@ TEST_P(
 
     const size_t msg_size      = remaining_time_msg.size() + 1;
     const size_t ret_num_bytes = GetParam().msg_send_successful ? msg_size : 0;
-    EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_size))
+    EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_size, _))
         .WillOnce(Return(static_cast<int32_t>(ret_num_bytes)));
     EXPECT_CALL(*wfr_timer_mock->gmock, Start(sc.wait_for_ready_timer, tHelloInit, false)).Times(2);
   } else {
@@ -58,7 +58,7 @@ TEST_P(ShipConnectionPinCheckInitTests, SmePinCheckInit) {
   // Calculate message length and expect message to be sent or not
   const size_t msg_size      = strlen(s.get()) + 1;
   const size_t ret_num_bytes = GetParam().msg_send_successful ? msg_size : 0;
-  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_size))
+  EXPECT_CALL(*websocket_mock->gmock, Write(sc.websocket, _, msg_size, _))
       .WillOnce(Return(static_cast<int32_t>(ret_num_bytes)));
 
   // Expect timer function calls
@@ -157,3 +157,50 @@ INSTANTIATE_TEST_SUITE_P(
         }
     )
 );
+
+TEST(DataDeserializeTests, DataDeserializeCborPayloadTest) {
+  // Arrange: Initialize the message buffer with CBOR encoded data message
+  static const std::string_view kPayload = "\xA1\x68" "datagram" "\x80"sv;
+
+  MessageBuffer buf;
+  MessageBufferInitWithStringView(&buf, "\002"
+                                        "\xA1\x64" "data" "\x82"
+                                        "\xA1\x66" "header" "\x81"
+                                        "\xA1\x6A" "protocolId" "\x65" "ee1.0"
+                                        "\xA1\x67" "payload"
+                                        "\xA1\x68" "datagram" "\x80"sv);
+
+  // Act: Run the Data deserialization
+  auto deserialize = ShipMessageDeserializeCreate(&buf);
+
+  void* const value = SHIP_MESSAGE_DESERIALIZE_GET_VALUE(deserialize);
+  auto data         = reinterpret_cast<Data*>(value);
+
+  // Assert: Verify the CBOR payload is taken as is
+  EXPECT_EQ(SHIP_MESSAGE_DESERIALIZE_GET_VALUE_TYPE(deserialize), kData);
+  ASSERT_NE(data, nullptr);
+  EXPECT_THAT(data, DataEq("ee1.0"sv, kPayload));
+
+  MessageBufferRelease(&buf);
+  ShipMessageDeserializeDelete(deserialize);
+}
+
+TEST(DataDeserializeTests, DataDeserializeCborTruncatedTest) {
+  // Arrange: Initialize the message buffer with CBOR encoded data message lacking the payload end
+  MessageBuffer buf;
+  MessageBufferInitWithStringView(&buf, "\002"
+                                        "\xA1\x64" "data" "\x82"
+                                        "\xA1\x66" "header" "\x81"
+                                        "\xA1\x6A" "protocolId" "\x65" "ee1.0"
+                                        "\xA1\x67" "payload"sv);
+
+  // Act: Run the Data deserialization
+  auto deserialize = ShipMessageDeserializeCreate(&buf);
+
+  // Assert: Verify the message is rejected
+  EXPECT_EQ(SHIP_MESSAGE_DESERIALIZE_GET_VALUE_TYPE(deserialize), kValueUndefined);
+  EXPECT_EQ(SHIP_MESSAGE_DESERIALIZE_GET_VALUE(deserialize), nullptr);
+
+  MessageBufferRelease(&buf);
+  ShipMessageDeserializeDelete(deserialize);
+}
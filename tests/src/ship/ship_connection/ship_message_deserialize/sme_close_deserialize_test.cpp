@@ -156,6 +156,46 @@ INSTANTIATE_TEST_SUITE_P(
             .phase       = kConnectionClosePhaseTypeAnnounce,
             .max_time    = std::make_shared<uint32_t>(20000),
             .reason      = std::make_shared<std::string_view>("Unexpected error"),
+        },
+        SmeCloseCloseDeserializeTestInput{
+            .description = "Test connection close message name is case insensitive"sv,
+            .msg         = "\003{\"ConnectionClose\":[{\"phase\":\"announce\"}]}"sv,
+            .value_type  = kSmeClose,
+            .phase       = kConnectionClosePhaseTypeAnnounce,
+            .max_time    = nullptr,
+            .reason      = nullptr,
+        },
+        SmeCloseCloseDeserializeTestInput{
+            .description = "Test connection close with the unknown members ignored"sv,
+            .msg         = "\003{\"extension\":[],\"connectionClose\":[{\"phase\":\"confirm\"}],\"other\":1}"sv,
+            .value_type  = kSmeClose,
+            .phase       = kConnectionClosePhaseTypeConfirm,
+            .max_time    = nullptr,
+            .reason      = nullptr,
+        },
+        SmeCloseCloseDeserializeTestInput{
+            .description = "Test connection close followed by the unknown members"sv,
+            .msg         = "\003{\"CONNECTIONCLOSE\":[{\"phase\":\"announce\"}],\"other\":1}"sv,
+            .value_type  = kSmeClose,
+            .phase       = kConnectionClosePhaseTypeAnnounce,
+            .max_time    = nullptr,
+            .reason      = nullptr,
+        },
+        SmeCloseCloseDeserializeTestInput{
+            .description = "Test connection close message unknown"sv,
+            .msg         = "\003{\"connectionOpen\":[{\"phase\":\"confirm\"}]}"sv,
+            .value_type  = kValueUndefined,
+            .phase       = static_cast<ConnectionClosePhaseType>(0),
+            .max_time    = nullptr,
+            .reason      = nullptr,
+        },
+        SmeCloseCloseDeserializeTestInput{
+            .description = "Test connection close sent with the control message type"sv,
+            .msg         = "\001{\"connectionClose\":[{\"phase\":\"confirm\"}]}"sv,
+            .value_type  = kValueUndefined,
+            .phase       = static_cast<ConnectionClosePhaseType>(0),
+            .max_time    = nullptr,
+            .reason      = nullptr,
         }
     )
 );
@@ -167,6 +167,28 @@ INSTANTIATE_TEST_SUITE_P(
             .version        = {2, 3},
             .formats        = {{kMessageProtocolFormatTypeUTF8, kMessageProtocolFormatTypeUTF16}, 2},
         },
+        SmeProtocolHandshakeDeserializeTestInput{
+            .description    = "Test type = announceMax, version = {1, 0}, formats = {JSON-UTF8,openeebus-CBOR}"sv,
+            .msg            = "\001{\"messageProtocolHandshake\":["
+                              "{\"handshakeType\":\"announceMax\"},"
+                              "{\"version\":[{\"major\":1},{\"minor\":0}]},"
+                              "{\"formats\":[{\"format\":[\"JSON-UTF8\",\"openeebus-CBOR\"]}]}]}"sv,
+            .value_type     = kSmeProtocolHandshake,
+            .handshake_type = kProtocolHandshakeTypeAnnounceMax,
+            .version        = {1, 0},
+            .formats        = {{kMessageProtocolFormatTypeUTF8, kMessageProtocolFormatTypeCbor}, 2},
+        },
+        SmeProtocolHandshakeDeserializeTestInput{
+            .description    = "Test unknown format is skipped, formats = {XML,JSON-UTF8}"sv,
+            .msg            = "\001{\"messageProtocolHandshake\":["
+                              "{\"handshakeType\":\"announceMax\"},"
+                              "{\"version\":[{\"major\":1},{\"minor\":0}]},"
+                              "{\"formats\":[{\"format\":[\"XML\",\"JSON-UTF8\"]}]}]}"sv,
+            .value_type     = kSmeProtocolHandshake,
+            .handshake_type = kProtocolHandshakeTypeAnnounceMax,
+            .version        = {1, 0},
+            .formats        = {{kMessageProtocolFormatTypeUTF8}, 1},
+        },
         SmeProtocolHandshakeDeserializeTestInput{
             .description    = "Test type = announceMax, version = {0, 1}, formats = null"sv,
             .msg            = "\001{\"messageProtocolHandshake\":["
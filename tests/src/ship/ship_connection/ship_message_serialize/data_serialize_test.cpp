@@ -124,3 +124,31 @@ INSTANTIATE_TEST_SUITE_P(
         }
     )
 );
+
+TEST(DataSerializeTests, DataSerializeCborPayloadTest) {
+  // Arrange: Initialize the Data with CBOR encoded payload {"datagram":[]}
+  static const uint8_t kPayload[] = {0xA1, 0x68, 'd', 'a', 't', 'a', 'g', 'r', 'a', 'm', 0x80};
+
+  Data data;
+  strcpy(data.header.protocol_id, "ee1.0");
+  MessageBufferInitWithDeallocator(&data.payload, const_cast<uint8_t*>(kPayload), sizeof(kPayload), NULL);
+
+  // Act: Run the Data serialization procedure
+  auto serialize = ShipMessageSerializeCreate(&data, kData);
+
+  const MessageBuffer* const buf = SHIP_MESSAGE_SERIALIZE_GET_BUFFER(serialize);
+
+  // Assert: Verify the message is CBOR encoded as well, the payload is copied as is
+  static const std::string_view kMsg = "\002"
+                                       "\xA1\x64" "data" "\x82"
+                                       "\xA1\x66" "header" "\x81"
+                                       "\xA1\x6A" "protocolId" "\x65" "ee1.0"
+                                       "\xA1\x67" "payload"
+                                       "\xA1\x68" "datagram" "\x80"sv;
+
+  ASSERT_NE(buf, nullptr);
+  EXPECT_EQ(std::string_view(reinterpret_cast<const char*>(buf->data), buf->data_size), kMsg);
+
+  MessageBufferRelease(&data.payload);
+  ShipMessageSerializeDelete(serialize);
+}
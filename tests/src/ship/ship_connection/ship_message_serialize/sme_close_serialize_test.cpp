@@ -124,6 +124,15 @@ INSTANTIATE_TEST_SUITE_P(
                            "[{\"phase\":\"announce\"},"
                            "{\"maxTime\":20000},"
                            "{\"reason\":\"Unexpected error\"}]}"sv,
+        },
+        SmeCloseSerializeTestInput{
+            .description = "Test connection close with reason requiring escaping"sv,
+            .phase       = kConnectionClosePhaseTypeAnnounce,
+            .max_time    = nullptr,
+            .reason      = std::make_shared<std::string_view>("\"Bad\" \\ state\n\x01"),
+            .msg         = "\003{\"connectionClose\":"
+                           "[{\"phase\":\"announce\"},"
+                           "{\"reason\":\"\\\"Bad\\\" \\\\ state\\n\\u0001\"}]}"sv,
         }
     )
 );
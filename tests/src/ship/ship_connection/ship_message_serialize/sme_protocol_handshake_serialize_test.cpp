@@ -96,6 +96,16 @@ INSTANTIATE_TEST_SUITE_P(
                               "{\"version\":[{\"major\":2},{\"minor\":3}]},"
                               "{\"formats\":[{\"format\":[\"JSON-UTF8\",\"JSON-UTF16\"]}]}]}"sv,
         },
+        SmeProtocolHandshakeSerializeTestInput{
+            .description    = "Test type = announceMax, version = {1, 0}, formats = {JSON-UTF8,openeebus-CBOR}"sv,
+            .handshake_type = kProtocolHandshakeTypeAnnounceMax,
+            .version        = {1, 0},
+            .formats        = {{kMessageProtocolFormatTypeUTF8, kMessageProtocolFormatTypeCbor}, 2},
+            .msg            = "\001{\"messageProtocolHandshake\":["
+                              "{\"handshakeType\":\"announceMax\"},"
+                              "{\"version\":[{\"major\":1},{\"minor\":0}]},"
+                              "{\"formats\":[{\"format\":[\"JSON-UTF8\",\"openeebus-CBOR\"]}]}]}"sv,
+        },
         SmeProtocolHandshakeSerializeTestInput{
             .description    = "Test type = announceMax, version = {0, 1}, formats = null"sv,
             .handshake_type = kProtocolHandshakeTypeSelect,
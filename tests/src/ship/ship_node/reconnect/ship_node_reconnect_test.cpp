@@ -0,0 +1,88 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "src/ship/ship_node/ship_node_reconnect.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace {
+
+constexpr char kSkiA[] = "1234567890ABCDEF1234567890ABCDEF12345678";
+constexpr char kSkiB[] = "1234567890ABCDEF1234567890ABCDEF12345679";
+
+constexpr uint64_t kStartTime = 1735689600;
+
+std::vector<uint32_t> CalcDelays(uint32_t prng_state, int attempt_cnt, size_t n) {
+  std::vector<uint32_t> delays;
+  for (size_t i = 0; i < n; ++i) {
+    delays.push_back(ShipNodeCalcReconnectDelay(&prng_state, attempt_cnt));
+  }
+
+  return delays;
+}
+
+}  // namespace
+
+TEST(ShipNodeReconnectTest, ShipNodeReconnectTestDelayWithinBackoffInterval) {
+  uint32_t prng_state = ShipNodeReconnectSeed(kSkiA, kStartTime);
+
+  uint32_t backoff = SHIP_NODE_RECONNECT_DELAY_MIN_MS;
+  for (int attempt_cnt = 1; attempt_cnt <= 12; ++attempt_cnt) {
+    for (int i = 0; i < 100; ++i) {
+      const uint32_t delay = ShipNodeCalcReconnectDelay(&prng_state, attempt_cnt);
+      EXPECT_GE(delay, backoff / 2) << "attempt " << attempt_cnt;
+      EXPECT_LE(delay, backoff) << "attempt " << attempt_cnt;
+    }
+
+    backoff = std::min(backoff * 2, static_cast<uint32_t>(SHIP_NODE_RECONNECT_DELAY_MAX_MS));
+  }
+
+  // The attempt counter is not bounded, the delay is
+  EXPECT_LE(ShipNodeCalcReconnectDelay(&prng_state, 1000), SHIP_NODE_RECONNECT_DELAY_MAX_MS);
+}
+
+TEST(ShipNodeReconnectTest, ShipNodeReconnectTestDelayIsJittered) {
+  const std::vector<uint32_t> delays = CalcDelays(ShipNodeReconnectSeed(kSkiA, kStartTime), 6, 32);
+  EXPECT_GT(std::set<uint32_t>(delays.begin(), delays.end()).size(), 16);
+}
+
+TEST(ShipNodeReconnectTest, ShipNodeReconnectTestSeed) {
+  // Same SKI and time give the same sequence
+  EXPECT_EQ(
+      CalcDelays(ShipNodeReconnectSeed(kSkiA, kStartTime), 6, 8),
+      CalcDelays(ShipNodeReconnectSeed(kSkiA, kStartTime), 6, 8)
+  );
+
+  // The nodes started at the same time do not retry in lockstep
+  EXPECT_NE(
+      CalcDelays(ShipNodeReconnectSeed(kSkiA, kStartTime), 6, 8),
+      CalcDelays(ShipNodeReconnectSeed(kSkiB, kStartTime), 6, 8)
+  );
+
+  // The restarted node does not repeat its previous sequence
+  EXPECT_NE(
+      CalcDelays(ShipNodeReconnectSeed(kSkiA, kStartTime), 6, 8),
+      CalcDelays(ShipNodeReconnectSeed(kSkiA, kStartTime + 1), 6, 8)
+  );
+
+  // The generator state never gets stuck at zero
+  EXPECT_NE(ShipNodeReconnectSeed(nullptr, 0), 0);
+  EXPECT_NE(ShipNodeReconnectSeed("", 0), 0);
+}
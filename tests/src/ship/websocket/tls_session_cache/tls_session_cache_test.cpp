@@ -0,0 +1,106 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "src/ship/websocket/tls_session_cache.h"
+
+#include "tests/src/memory_leak.inc"
+
+namespace {
+
+std::vector<uint8_t> LoadSession(TlsSessionCacheObject* tls_session_cache, const char* ski) {
+  std::vector<uint8_t> session(TLS_SESSION_CACHE_LOAD(tls_session_cache, ski, nullptr, 0));
+  if (!session.empty()) {
+    EXPECT_EQ(TLS_SESSION_CACHE_LOAD(tls_session_cache, ski, session.data(), session.size()), session.size());
+  }
+
+  return session;
+}
+
+}  // namespace
+
+TEST(TlsSessionCacheTest, TlsSessionCacheTestStoreAndLoad) {
+  std::unique_ptr<TlsSessionCacheObject, decltype(&TlsSessionCacheDelete)> tls_session_cache{
+      TlsSessionCacheCreate(TLS_SESSION_CACHE_MAX_NUM_DEFAULT),
+      &TlsSessionCacheDelete
+  };
+
+  ASSERT_NE(tls_session_cache, nullptr) << "Failed to create TlsSessionCache";
+
+  const std::vector<uint8_t> session_a{1, 2, 3, 4};
+  const std::vector<uint8_t> session_b{5, 6, 7, 8, 9, 10};
+
+  EXPECT_TRUE(LoadSession(tls_session_cache.get(), "ski_a").empty());
+  EXPECT_EQ(
+      TLS_SESSION_CACHE_STORE(tls_session_cache.get(), "ski_a", session_a.data(), session_a.size()),
+      kEebusErrorOk
+  );
+  EXPECT_EQ(TLS_SESSION_CACHE_STORE(tls_session_cache.get(), "ski_a", nullptr, 0), kEebusErrorInputArgument);
+  EXPECT_EQ(LoadSession(tls_session_cache.get(), "ski_a"), session_a);
+
+  // The session is not copied into a buffer too small to hold it
+  uint8_t buf[2] = {};
+  EXPECT_EQ(TLS_SESSION_CACHE_LOAD(tls_session_cache.get(), "ski_a", buf, sizeof(buf)), session_a.size());
+  EXPECT_EQ(buf[0], 0);
+
+  // Storing a new session for the same remote device replaces the previous one
+  EXPECT_EQ(
+      TLS_SESSION_CACHE_STORE(tls_session_cache.get(), "ski_a", session_b.data(), session_b.size()),
+      kEebusErrorOk
+  );
+  EXPECT_EQ(LoadSession(tls_session_cache.get(), "ski_a"), session_b);
+  EXPECT_EQ(TLS_SESSION_CACHE_GET_SIZE(tls_session_cache.get()), 1);
+
+  TLS_SESSION_CACHE_REMOVE(tls_session_cache.get(), "ski_a");
+  EXPECT_TRUE(LoadSession(tls_session_cache.get(), "ski_a").empty());
+  EXPECT_EQ(TLS_SESSION_CACHE_GET_SIZE(tls_session_cache.get()), 0);
+
+  tls_session_cache.reset();
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+TEST(TlsSessionCacheTest, TlsSessionCacheTestEvictLeastRecentlyUsed) {
+  std::unique_ptr<TlsSessionCacheObject, decltype(&TlsSessionCacheDelete)> tls_session_cache{
+      TlsSessionCacheCreate(2),
+      &TlsSessionCacheDelete
+  };
+
+  ASSERT_NE(tls_session_cache, nullptr) << "Failed to create TlsSessionCache";
+
+  const std::vector<uint8_t> session{1, 2, 3};
+
+  EXPECT_EQ(TLS_SESSION_CACHE_STORE(tls_session_cache.get(), "ski_a", session.data(), session.size()), kEebusErrorOk);
+  EXPECT_EQ(TLS_SESSION_CACHE_STORE(tls_session_cache.get(), "ski_b", session.data(), session.size()), kEebusErrorOk);
+
+  // Resuming the session with "ski_a" makes "ski_b" the least recently used one
+  EXPECT_EQ(LoadSession(tls_session_cache.get(), "ski_a"), session);
+  EXPECT_EQ(TLS_SESSION_CACHE_STORE(tls_session_cache.get(), "ski_c", session.data(), session.size()), kEebusErrorOk);
+
+  EXPECT_EQ(TLS_SESSION_CACHE_GET_SIZE(tls_session_cache.get()), 2);
+  EXPECT_EQ(LoadSession(tls_session_cache.get(), "ski_a"), session);
+  EXPECT_TRUE(LoadSession(tls_session_cache.get(), "ski_b").empty());
+  EXPECT_EQ(LoadSession(tls_session_cache.get(), "ski_c"), session);
+
+  tls_session_cache.reset();
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
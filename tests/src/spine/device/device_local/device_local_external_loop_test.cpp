@@ -0,0 +1,189 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/spine/device/device_local.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "mocks/common/eebus_timer/eebus_timer_mock.h"
+#include "mocks/ship/ship_connection/data_writer_mock.h"
+#include "src/common/eebus_malloc.h"
+#include "src/common/eebus_timer/eebus_timer.h"
+#include "src/common/message_buffer.h"
+#include "tests/src/memory_leak.inc"
+#include "tests/src/spine/device/device_local/discovery_request.inc"
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::WithArgs;
+
+EebusTimerObject* EebusTimerCreate(EebusTimerTimeoutCallback cb, void* ctx) {
+  return EEBUS_TIMER_OBJECT(EebusTimerMockCreate());
+}
+
+EebusError PrintMessage(const uint8_t* msg, size_t msg_size) { return kEebusErrorOk; }
+
+void DeviceLocalExternalLoopTestInternal() {
+  const EebusDeviceInfo device_info = {
+      .type       = "EnergyManagementSystem",
+      .vendor     = "Demo",
+      .brand      = "Demo",
+      .model      = "HEMS",
+      .serial_num = "123456789",
+      .ship_id    = "Demo",
+      .address    = "d:_n:Demo_HEMS-123456789",
+  };
+
+  static constexpr NetworkManagementFeatureSetType feature_set = kNetworkManagementFeatureSetTypeSmart;
+
+  std::unique_ptr<DataWriterMock, decltype(&DataWriterMockDelete)> data_write_mock{
+      DataWriterMockCreate(),
+      DataWriterMockDelete
+  };
+  std::unique_ptr<DeviceLocalObject, decltype(&DeviceLocalDelete)> device_local{
+      DeviceLocalCreate(&device_info, &feature_set),
+      DeviceLocalDelete
+  };
+
+  int wake_cnt = 0;
+  DEVICE_LOCAL_SET_EXTERNAL_LOOP(device_local.get(), [](void* ctx) { ++*static_cast<int*>(ctx); }, &wake_cnt);
+  ASSERT_EQ(DEVICE_LOCAL_START(device_local.get()), kEebusErrorOk);
+
+  // Nothing queued, the next step is due with the tick
+  EXPECT_EQ(DEVICE_LOCAL_STEP(device_local.get(), 0), 1000);
+  EXPECT_EQ(DEVICE_LOCAL_STEP(device_local.get(), 400), 600);
+  EXPECT_EQ(DEVICE_LOCAL_STEP(device_local.get(), 2700), 900);
+
+  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _, _)).WillRepeatedly(WithArgs<1, 2>(Invoke(PrintMessage)));
+  DataReaderObject* const data_reader
+      = DEVICE_LOCAL_SETUP_REMOTE_DEVICE(device_local.get(), "1111", DATA_WRITER_OBJECT(data_write_mock.get()));
+
+  // The received message wakes the application loop up, and is handled on the next step
+  MessageBuffer msg_buf;
+  MessageBufferInitWithDeallocator(&msg_buf, const_cast<uint8_t*>(discovery_request), sizeof(discovery_request), NULL);
+  DATA_READER_HANDLE_MESSAGE(data_reader, &msg_buf);
+  MessageBufferRelease(&msg_buf);
+  EXPECT_EQ(wake_cnt, 1);
+
+  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _, _)).WillOnce(WithArgs<1, 2>(Invoke(PrintMessage)));
+  EXPECT_EQ(DEVICE_LOCAL_STEP(device_local.get(), 100), 800);
+  testing::Mock::VerifyAndClearExpectations(data_write_mock->gmock);
+
+  DEVICE_LOCAL_STOP(device_local.get());
+
+  EXPECT_CALL(*data_write_mock->gmock, Destruct(_)).WillOnce(Return());
+}
+
+TEST(DeviceLocalExternalLoopTest, DeviceLocalExternalLoopTest) {
+  DeviceLocalExternalLoopTestInternal();
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+void DeviceLocalExternalLoopQueueFullTestInternal() {
+  const EebusDeviceInfo device_info = {
+      .type       = "EnergyManagementSystem",
+      .vendor     = "Demo",
+      .brand      = "Demo",
+      .model      = "HEMS",
+      .serial_num = "123456789",
+      .ship_id    = "Demo",
+      .address    = "d:_n:Demo_HEMS-123456789",
+  };
+
+  static constexpr NetworkManagementFeatureSetType feature_set = kNetworkManagementFeatureSetTypeSmart;
+
+  std::unique_ptr<DataWriterMock, decltype(&DataWriterMockDelete)> data_write_mock{
+      DataWriterMockCreate(),
+      DataWriterMockDelete
+  };
+  std::unique_ptr<DeviceLocalObject, decltype(&DeviceLocalDelete)> device_local{
+      DeviceLocalCreate(&device_info, &feature_set),
+      DeviceLocalDelete
+  };
+
+  // The wake callback is invoked from the thread handing the messages over
+  std::atomic<int> wake_cnt{0};
+  DEVICE_LOCAL_SET_EXTERNAL_LOOP(
+      device_local.get(),
+      [](void* ctx) { ++*static_cast<std::atomic<int>*>(ctx); },
+      &wake_cnt
+  );
+  ASSERT_EQ(DEVICE_LOCAL_START(device_local.get()), kEebusErrorOk);
+
+  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _, _)).WillRepeatedly(WithArgs<1, 2>(Invoke(PrintMessage)));
+  DataReaderObject* const data_reader
+      = DEVICE_LOCAL_SETUP_REMOTE_DEVICE(device_local.get(), "1111", DATA_WRITER_OBJECT(data_write_mock.get()));
+
+  // More messages than the queue holds, nothing is drained until the application steps
+  static constexpr int kMsgNum = 64;
+
+  std::atomic<int> sent_cnt{0};
+  std::thread sender([data_reader, &sent_cnt]() {
+    for (int i = 0; i < kMsgNum; ++i) {
+      MessageBuffer msg_buf;
+      MessageBufferInitWithDeallocator(
+          &msg_buf,
+          const_cast<uint8_t*>(discovery_request),
+          sizeof(discovery_request),
+          NULL
+      );
+      DATA_READER_HANDLE_MESSAGE(data_reader, &msg_buf);
+      MessageBufferRelease(&msg_buf);
+      ++sent_cnt;
+    }
+  });
+
+  // The sender waits for the space on the full queue and keeps waking the application loop up meanwhile
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while ((wake_cnt < sent_cnt + 2) && (std::chrono::steady_clock::now() < deadline)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  EXPECT_LT(sent_cnt, kMsgNum);
+  EXPECT_GE(wake_cnt, sent_cnt + 2);
+
+  // Each step makes the space for the next batch
+  while (sent_cnt < kMsgNum) {
+    DEVICE_LOCAL_STEP(device_local.get(), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  sender.join();
+
+  // Drain the rest, the step is due with the tick only once the queue is empty
+  for (int i = 0; (i < kMsgNum) && (DEVICE_LOCAL_STEP(device_local.get(), 0) == 0); ++i) {
+  }
+
+  EXPECT_EQ(DEVICE_LOCAL_STEP(device_local.get(), 0), 1000);
+  testing::Mock::VerifyAndClearExpectations(data_write_mock->gmock);
+
+  DEVICE_LOCAL_STOP(device_local.get());
+
+  EXPECT_CALL(*data_write_mock->gmock, Destruct(_)).WillOnce(Return());
+}
+
+TEST(DeviceLocalExternalLoopTest, DeviceLocalExternalLoopQueueFullTest) {
+  DeviceLocalExternalLoopQueueFullTestInternal();
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
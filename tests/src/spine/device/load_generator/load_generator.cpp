@@ -0,0 +1,746 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief SPINE multi-peer load generator
+ *
+ * Drives a single Controllable System / Monitored Unit device (CS LPC and MU MPC,
+ * as the heat pump example) with a number of simulated Energy Guard / Monitoring
+ * Appliance peers (EG LPC and MA MPC, as the HEMS example) connected in-process with
+ * the Loopback Data Writer, i.e. without SHIP, TLS and websockets.
+ *
+ * The peers connect (discovery, use case discovery, subscriptions and bindings) and
+ * then run the given number of rounds. Each round is one second of simulated time:
+ * the MU publishes a new power measurement, every peer reads the load control limits
+ * and the peer holding the Load Control binding writes new limits, then the heartbeats
+ * are exchanged.
+ *
+ * Reported are the processing latency percentiles of the messages received by the
+ * CS/MU device, its throughput and the heap used per connected peer on both sides.
+ *
+ * Usage: load_generator [peers number] [rounds number] [writes per round] [json|cbor]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __freertos__
+#include <cJSON.h>
+#else
+#include <cjson/cJSON.h>
+#endif  // __freertos__
+
+#include "src/common/array_util.h"
+#include "src/common/eebus_malloc.h"
+#include "src/common/eebus_timer/eebus_timer.h"
+#include "src/spine/api/entity_remote_interface.h"
+#include "src/spine/api/feature_local_interface.h"
+#include "src/spine/device/device_local.h"
+#include "src/spine/entity/entity_local.h"
+#include "src/spine/model/entity_types.h"
+#include "src/use_case/actor/cs/lpc/cs_lpc.h"
+#include "src/use_case/actor/eg/lpc/eg_lpc.h"
+#include "src/use_case/actor/ma/mpc/ma_mpc.h"
+#include "src/use_case/actor/mu/mpc/mu_mpc.h"
+#include "tests/src/spine/device/loopback/loopback_data_writer.h"
+
+namespace {
+
+//-------------------------------------------------------------------------------------------//
+//
+// Heap accounting
+//
+//-------------------------------------------------------------------------------------------//
+
+/**
+ * @brief Heap owner the allocations are accounted to, selected by the side being run
+ */
+enum HeapBucket : uint32_t {
+  kHeapBucketCs,
+  kHeapBucketPeers,
+  kHeapBucketNum,
+};
+
+struct HeapAllocation {
+  size_t size;
+  HeapBucket bucket;
+};
+
+HeapBucket heap_bucket           = kHeapBucketPeers;
+size_t heap_used[kHeapBucketNum] = {0};
+// Releases are accounted to the bucket of the allocation, whichever side does them
+std::unordered_map<void*, HeapAllocation> heap_allocations;
+
+void* AccountingMalloc(size_t size) {
+  void* const p = malloc(size);
+  if (p == nullptr) {
+    return nullptr;
+  }
+
+  // A block released with free() directly is dropped once its address is reused
+  const auto it = heap_allocations.find(p);
+  if (it != heap_allocations.end()) {
+    heap_used[it->second.bucket] -= it->second.size;
+  }
+
+  heap_allocations[p] = {size, heap_bucket};
+  heap_used[heap_bucket] += size;
+  return p;
+}
+
+void AccountingFree(void* p) {
+  if (p == nullptr) {
+    return;
+  }
+
+  const auto it = heap_allocations.find(p);
+  if (it != heap_allocations.end()) {
+    heap_used[it->second.bucket] -= it->second.size;
+    heap_allocations.erase(it);
+  }
+
+  free(p);
+}
+
+/**
+ * @brief Selects the heap bucket for the scope lifetime
+ */
+class HeapScope {
+ public:
+  explicit HeapScope(HeapBucket bucket) : prev_(heap_bucket) { heap_bucket = bucket; }
+  ~HeapScope() { heap_bucket = prev_; }
+
+  HeapScope(const HeapScope&)            = delete;
+  HeapScope& operator=(const HeapScope&) = delete;
+
+ private:
+  HeapBucket prev_;
+};
+
+//-------------------------------------------------------------------------------------------//
+//
+// Listeners
+//
+//-------------------------------------------------------------------------------------------//
+
+struct Peer;
+
+struct CsLpcCounter {
+  /** Implements the CS LPC Listener Interface */
+  CsLpcListenerObject obj;
+  size_t power_limits_num;
+  size_t heartbeats_num;
+};
+
+void CsLpcCounterDestruct(CsLpcListenerObject* self) {}
+
+void CsLpcCounterOnPowerLimitReceive(
+    CsLpcListenerObject* self,
+    const ScaledValue* power_limit,
+    const DurationType* duration,
+    bool is_active
+) {
+  ++reinterpret_cast<CsLpcCounter*>(self)->power_limits_num;
+}
+
+void CsLpcCounterOnFailsafePowerLimitReceive(CsLpcListenerObject* self, const ScaledValue* power_limit) {}
+
+void CsLpcCounterOnFailsafeDurationReceive(CsLpcListenerObject* self, const DurationType* duration) {}
+
+void CsLpcCounterOnHeartbeatReceive(CsLpcListenerObject* self, uint64_t heartbeat_counter) {
+  ++reinterpret_cast<CsLpcCounter*>(self)->heartbeats_num;
+}
+
+const CsLpcListenerInterface cs_lpc_counter_methods = {
+    .destruct                        = CsLpcCounterDestruct,
+    .on_power_limit_receive          = CsLpcCounterOnPowerLimitReceive,
+    .on_failsafe_power_limit_receive = CsLpcCounterOnFailsafePowerLimitReceive,
+    .on_failsafe_duration_receive    = CsLpcCounterOnFailsafeDurationReceive,
+    .on_heartbeat_receive            = CsLpcCounterOnHeartbeatReceive,
+};
+
+struct EgLpcCounter {
+  /** Implements the EG LPC Listener Interface */
+  EgLpcListenerObject obj;
+  Peer* peer;
+};
+
+struct MaMpcCounter {
+  /** Implements the MA MPC Listener Interface */
+  MaMpcListenerObject obj;
+  Peer* peer;
+};
+
+//-------------------------------------------------------------------------------------------//
+//
+// Devices
+//
+//-------------------------------------------------------------------------------------------//
+
+constexpr NetworkManagementFeatureSetType kFeatureSet = kNetworkManagementFeatureSetTypeSmart;
+constexpr uint32_t kHeartbeatTimeoutSeconds           = 60;
+constexpr uint32_t kRoundPeriodMs                     = 1000;
+constexpr ElectricalConnectionIdType kElectricalConnectionId = 0;
+constexpr char kCsSki[]                               = "ffffffffffffffffffffffffffffffffffffffff";
+
+using DeviceLocalPtr = std::unique_ptr<DeviceLocalObject, decltype(&DeviceLocalDelete)>;
+using DataWriterPtr  = std::unique_ptr<DataWriterObject, decltype(&LoopbackDataWriterDelete)>;
+
+EntityLocalObject* AddEntity(DeviceLocalObject* device_local, EntityTypeType entity_type) {
+  uint32_t entity_ids[1] = {static_cast<uint32_t>(VectorGetSize(DEVICE_LOCAL_GET_ENTITIES(device_local)))};
+  return EntityLocalCreate(device_local, entity_type, entity_ids, ARRAY_SIZE(entity_ids), kHeartbeatTimeoutSeconds);
+}
+
+struct Cs {
+  DeviceLocalPtr device{nullptr, DeviceLocalDelete};
+  std::unique_ptr<CsLpcUseCaseObject, decltype(&CsLpcUseCaseDelete)> cs_lpc{nullptr, CsLpcUseCaseDelete};
+  std::unique_ptr<MuMpcUseCaseObject, decltype(&MuMpcUseCaseDelete)> mu_mpc{nullptr, MuMpcUseCaseDelete};
+  CsLpcCounter cs_lpc_counter = {{&cs_lpc_counter_methods}, 0, 0};
+
+  ~Cs() {
+    // Use cases are released before the device, as the examples do
+    cs_lpc.reset();
+    mu_mpc.reset();
+    device.reset();
+  }
+};
+
+struct Peer {
+  std::string ski;
+  std::string address;
+
+  DeviceLocalPtr device{nullptr, DeviceLocalDelete};
+  EntityLocalObject* entity = nullptr;
+  std::unique_ptr<EgLpcUseCaseObject, decltype(&EgLpcUseCaseDelete)> eg_lpc{nullptr, EgLpcUseCaseDelete};
+  std::unique_ptr<MaMpcUseCaseObject, decltype(&MaMpcUseCaseDelete)> ma_mpc{nullptr, MaMpcUseCaseDelete};
+  EgLpcCounter eg_lpc_counter = {};
+  MaMpcCounter ma_mpc_counter = {};
+
+  /** Carries the messages from the CS to the peer */
+  DataWriterPtr cs_writer{nullptr, LoopbackDataWriterDelete};
+  /** Carries the messages from the peer to the CS */
+  DataWriterPtr peer_writer{nullptr, LoopbackDataWriterDelete};
+
+  EntityAddressType* cs_entity_addr = nullptr;
+  size_t measurements_num           = 0;
+
+  /**
+   * @brief Releases the use cases and the device, the writers are kept
+   * as long as the CS device refers them
+   */
+  void ReleaseDevice() {
+    EntityAddressDelete(cs_entity_addr);
+    cs_entity_addr = nullptr;
+    eg_lpc.reset();
+    ma_mpc.reset();
+    device.reset();
+  }
+
+  ~Peer() { ReleaseDevice(); }
+};
+
+void EgLpcCounterDestruct(EgLpcListenerObject* self) {}
+
+void EgLpcCounterOnRemoteEntityConnect(EgLpcListenerObject* self, const EntityAddressType* entity_addr) {
+  Peer* const peer = reinterpret_cast<EgLpcCounter*>(self)->peer;
+  if (peer->cs_entity_addr == nullptr) {
+    peer->cs_entity_addr = EntityAddressCopy(entity_addr);
+  }
+}
+
+void EgLpcCounterOnRemoteEntityDisconnect(EgLpcListenerObject* self, const EntityAddressType* entity_addr) {}
+
+void EgLpcCounterOnPowerLimitReceive(
+    EgLpcListenerObject* self,
+    const ScaledValue* power_limit,
+    const DurationType* duration,
+    bool is_active
+) {}
+
+void EgLpcCounterOnFailsafePowerLimitReceive(EgLpcListenerObject* self, const ScaledValue* power_limit) {}
+
+void EgLpcCounterOnFailsafeDurationReceive(EgLpcListenerObject* self, const DurationType* duration) {}
+
+void EgLpcCounterOnHeartbeatReceive(EgLpcListenerObject* self, uint64_t heartbeat_counter) {}
+
+const EgLpcListenerInterface eg_lpc_counter_methods = {
+    .destruct                        = EgLpcCounterDestruct,
+    .on_remote_entity_connect        = EgLpcCounterOnRemoteEntityConnect,
+    .on_remote_entity_disconnect     = EgLpcCounterOnRemoteEntityDisconnect,
+    .on_power_limit_receive          = EgLpcCounterOnPowerLimitReceive,
+    .on_failsafe_power_limit_receive = EgLpcCounterOnFailsafePowerLimitReceive,
+    .on_failsafe_duration_receive    = EgLpcCounterOnFailsafeDurationReceive,
+    .on_heartbeat_receive            = EgLpcCounterOnHeartbeatReceive,
+};
+
+void MaMpcCounterDestruct(MaMpcListenerObject* self) {}
+
+void MaMpcCounterOnRemoteEntityConnect(MaMpcListenerObject* self, const EntityAddressType* entity_addr) {}
+
+void MaMpcCounterOnRemoteEntityDisconnect(MaMpcListenerObject* self, const EntityAddressType* entity_addr) {}
+
+void MaMpcCounterOnMeasurementReceive(
+    MaMpcListenerObject* self,
+    MuMpcMeasurementNameId name_id,
+    const ScaledValue* measurement_value,
+    const EntityAddressType* remote_entity_addr
+) {
+  ++reinterpret_cast<MaMpcCounter*>(self)->peer->measurements_num;
+}
+
+const MaMpcListenerInterface ma_mpc_counter_methods = {
+    .destruct                    = MaMpcCounterDestruct,
+    .on_remote_entity_connect    = MaMpcCounterOnRemoteEntityConnect,
+    .on_remote_entity_disconnect = MaMpcCounterOnRemoteEntityDisconnect,
+    .on_measurement_receive      = MaMpcCounterOnMeasurementReceive,
+};
+
+bool CreateCs(Cs* cs) {
+  static const EebusDeviceInfo device_info = {
+      .type       = "HeatGenerationSystem",
+      .vendor     = "Demo",
+      .brand      = "Demo",
+      .model      = "HeatPump",
+      .serial_num = "123456789",
+      .ship_id    = "Demo",
+      .address    = "d:_n:Demo_HeatPump-123456789",
+  };
+
+  static const MuMpcMeasurementConfig measurement_cfg = {
+      .value_source = kMeasurementValueSourceTypeMeasuredValue,
+  };
+
+  // Single phase power monitoring only, the other scenarios are not subscribed by the peers
+  static const MuMpcConfig mu_mpc_cfg = {
+      .power_cfg = {.power_total_cfg = measurement_cfg, .power_phase_a_cfg = &measurement_cfg},
+  };
+
+  HeapScope heap_scope{kHeapBucketCs};
+
+  cs->device.reset(DeviceLocalCreate(&device_info, &kFeatureSet));
+  if (cs->device == nullptr) {
+    return false;
+  }
+
+  EntityLocalObject* const entity = AddEntity(cs->device.get(), kEntityTypeTypeHeatPumpAppliance);
+  if (entity == nullptr) {
+    return false;
+  }
+
+  cs->cs_lpc.reset(CsLpcUseCaseCreate(entity, kElectricalConnectionId, &cs->cs_lpc_counter.obj));
+  cs->mu_mpc.reset(MuMpcUseCaseCreate(entity, kElectricalConnectionId, &mu_mpc_cfg));
+  DEVICE_LOCAL_ADD_ENTITY(cs->device.get(), entity);
+  if ((cs->cs_lpc == nullptr) || (cs->mu_mpc == nullptr)) {
+    return false;
+  }
+
+  SetConsumptionLimit(cs->cs_lpc.get(), 4200, 0, false, true);
+
+  DEVICE_LOCAL_SET_EXTERNAL_LOOP(cs->device.get(), nullptr, nullptr);
+  return DEVICE_LOCAL_START(cs->device.get()) == kEebusErrorOk;
+}
+
+bool CreatePeer(Peer* peer, size_t index, MessageProtocolFormatType format) {
+  char ski[41] = {0};
+  snprintf(ski, sizeof(ski), "%040zx", index + 1);
+  peer->ski     = ski;
+  peer->address = "d:_n:Sim_HEMS-" + std::to_string(index + 1);
+
+  const EebusDeviceInfo device_info = {
+      .type       = "EnergyManagementSystem",
+      .vendor     = "Sim",
+      .brand      = "Sim",
+      .model      = "HEMS",
+      .serial_num = peer->address.c_str() + strlen("d:_n:Sim_HEMS-"),
+      .ship_id    = peer->ski.c_str(),
+      .address    = peer->address.c_str(),
+  };
+
+  HeapScope heap_scope{kHeapBucketPeers};
+
+  peer->device.reset(DeviceLocalCreate(&device_info, &kFeatureSet));
+  if (peer->device == nullptr) {
+    return false;
+  }
+
+  peer->entity = AddEntity(peer->device.get(), kEntityTypeTypeCEM);
+  if (peer->entity == nullptr) {
+    return false;
+  }
+
+  peer->eg_lpc_counter = {{&eg_lpc_counter_methods}, peer};
+  peer->ma_mpc_counter = {{&ma_mpc_counter_methods}, peer};
+  peer->eg_lpc.reset(EgLpcUseCaseCreate(peer->entity, &peer->eg_lpc_counter.obj));
+  peer->ma_mpc.reset(MaMpcUseCaseCreate(peer->entity, &peer->ma_mpc_counter.obj));
+  DEVICE_LOCAL_ADD_ENTITY(peer->device.get(), peer->entity);
+  if ((peer->eg_lpc == nullptr) || (peer->ma_mpc == nullptr)) {
+    return false;
+  }
+
+  peer->cs_writer.reset(LoopbackDataWriterCreate(format));
+  peer->peer_writer.reset(LoopbackDataWriterCreate(format));
+  if ((peer->cs_writer == nullptr) || (peer->peer_writer == nullptr)) {
+    return false;
+  }
+
+  DEVICE_LOCAL_SET_EXTERNAL_LOOP(peer->device.get(), nullptr, nullptr);
+  return DEVICE_LOCAL_START(peer->device.get()) == kEebusErrorOk;
+}
+
+/**
+ * @brief Sets up the remote devices on both of the sides, the same as LoopbackConnect()
+ * does but with the heap accounted to the side the allocations are made for
+ */
+bool ConnectPeer(Cs* cs, Peer* peer) {
+  DataReaderObject* cs_reader = nullptr;
+  {
+    HeapScope heap_scope{kHeapBucketCs};
+    cs_reader = DEVICE_LOCAL_SETUP_REMOTE_DEVICE(cs->device.get(), peer->ski.c_str(), peer->cs_writer.get());
+  }
+
+  DataReaderObject* peer_reader = nullptr;
+  {
+    HeapScope heap_scope{kHeapBucketPeers};
+    peer_reader = DEVICE_LOCAL_SETUP_REMOTE_DEVICE(peer->device.get(), kCsSki, peer->peer_writer.get());
+  }
+
+  if ((cs_reader == nullptr) || (peer_reader == nullptr)) {
+    return false;
+  }
+
+  LoopbackDataWriterSetReceiver(peer->cs_writer.get(), peer->device.get(), peer_reader);
+  LoopbackDataWriterSetReceiver(peer->peer_writer.get(), cs->device.get(), cs_reader);
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------//
+//
+// Load
+//
+//-------------------------------------------------------------------------------------------//
+
+struct PhaseStats {
+  std::vector<double> cs_latency_ns;
+  double cs_busy_ns    = 0.0;
+  size_t peer_msg_num  = 0;
+  double wall_ns       = 0.0;
+};
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedNs(Clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Exchanges the messages until all of the devices are idle
+ *
+ * The peers are served round robin; the CS gets the messages one by one,
+ * so that the processing time of every single message is measured.
+ */
+void Pump(Cs* cs, std::vector<std::unique_ptr<Peer>>& peers, PhaseStats* stats) {
+  bool busy = true;
+  while (busy) {
+    busy = false;
+
+    for (const std::unique_ptr<Peer>& peer : peers) {
+      {
+        HeapScope heap_scope{kHeapBucketPeers};
+        stats->peer_msg_num += LoopbackDataWriterProcess(peer->cs_writer.get(), LOOPBACK_PROCESS_BATCH_MAX_MSG);
+      }
+
+      HeapScope heap_scope{kHeapBucketCs};
+      for (size_t i = 0; i < LOOPBACK_PROCESS_BATCH_MAX_MSG; ++i) {
+        const Clock::time_point start = Clock::now();
+        if (LoopbackDataWriterProcess(peer->peer_writer.get(), 1) == 0) {
+          break;
+        }
+
+        const double elapsed_ns = ElapsedNs(start);
+        stats->cs_latency_ns.push_back(elapsed_ns);
+        stats->cs_busy_ns += elapsed_ns;
+      }
+
+      busy = busy || (LoopbackDataWriterGetPendingNum(peer->cs_writer.get()) != 0)
+             || (LoopbackDataWriterGetPendingNum(peer->peer_writer.get()) != 0);
+    }
+  }
+}
+
+/**
+ * @brief Advances the simulated time of all of the devices, e.g. to send the heartbeats
+ */
+void Tick(Cs* cs, std::vector<std::unique_ptr<Peer>>& peers, uint32_t elapsed_ms) {
+  {
+    HeapScope heap_scope{kHeapBucketCs};
+    DEVICE_LOCAL_STEP(cs->device.get(), elapsed_ms);
+  }
+
+  HeapScope heap_scope{kHeapBucketPeers};
+  for (const std::unique_ptr<Peer>& peer : peers) {
+    DEVICE_LOCAL_STEP(peer->device.get(), elapsed_ms);
+  }
+}
+
+void ReadLimits(Peer* peer) {
+  DeviceRemoteObject* const remote_device = DEVICE_LOCAL_GET_REMOTE_DEVICE_WITH_SKI(peer->device.get(), kCsSki);
+  if ((remote_device == nullptr) || (peer->cs_entity_addr == nullptr)) {
+    return;
+  }
+
+  EntityRemoteObject* const remote_entity
+      = DEVICE_REMOTE_GET_ENTITY(remote_device, peer->cs_entity_addr->entity, peer->cs_entity_addr->entity_size);
+
+  if (remote_entity == nullptr) {
+    return;
+  }
+
+  FeatureLocalObject* const local_feature
+      = ENTITY_LOCAL_GET_FEATURE_WITH_TYPE_AND_ROLE(peer->entity, kFeatureTypeTypeLoadControl, kRoleTypeClient);
+  FeatureRemoteObject* const remote_feature
+      = ENTITY_REMOTE_GET_FEATURE_WITH_TYPE_AND_ROLE(remote_entity, kFeatureTypeTypeLoadControl, kRoleTypeServer);
+  if ((local_feature == nullptr) || (remote_feature == nullptr)) {
+    return;
+  }
+
+  FEATURE_LOCAL_REQUEST_REMOTE_DATA(local_feature, kFunctionTypeLoadControlLimitListData, nullptr, remote_feature);
+}
+
+void WriteLimit(Peer* peer, int64_t value) {
+  const LoadLimit limit = {
+      .value     = {.value = value, .scale = 0},
+      .duration  = {.hours = 1},
+      .is_active = true,
+  };
+
+  EgLpcSetActivePowerConsumptionLimit(peer->eg_lpc.get(), peer->cs_entity_addr, &limit);
+}
+
+/**
+ * @brief Runs one second of the simulated time
+ * @return Number of the limits written
+ */
+size_t RunRound(Cs* cs, std::vector<std::unique_ptr<Peer>>& peers, size_t round, size_t writes_num) {
+  {
+    HeapScope heap_scope{kHeapBucketCs};
+    const MuMpcMeasurementSample sample = {
+        .name  = kMpcPowerTotal,
+        .value = {.value = static_cast<int64_t>(1000 + round), .scale = 0},
+    };
+
+    MuMpcUpdateMeasurementData(cs->mu_mpc.get(), &sample, 1);
+  }
+
+  HeapScope heap_scope{kHeapBucketPeers};
+  for (const std::unique_ptr<Peer>& peer : peers) {
+    ReadLimits(peer.get());
+  }
+
+  // Only the first peer connected holds the Load Control binding and is allowed to write
+  for (size_t i = 0; i < writes_num; ++i) {
+    WriteLimit(peers.front().get(), static_cast<int64_t>(1000 + round * writes_num + i));
+  }
+
+  return writes_num;
+}
+
+//-------------------------------------------------------------------------------------------//
+//
+// Report
+//
+//-------------------------------------------------------------------------------------------//
+
+double Percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+
+  const size_t rank = static_cast<size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+  return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+}
+
+void PrintPhase(const char* name, PhaseStats stats) {
+  std::sort(stats.cs_latency_ns.begin(), stats.cs_latency_ns.end());
+
+  const size_t cs_msg_num = stats.cs_latency_ns.size();
+  const double cs_msg_per_sec
+      = (stats.cs_busy_ns > 0.0) ? static_cast<double>(cs_msg_num) * 1e9 / stats.cs_busy_ns : 0.0;
+  const double msg_per_sec
+      = (stats.wall_ns > 0.0) ? static_cast<double>(cs_msg_num + stats.peer_msg_num) * 1e9 / stats.wall_ns : 0.0;
+
+  printf(
+      "%-10s %10zu %12.0f %10.1f %10.1f %10.1f %12zu %12.0f %10.3f\n",
+      name,
+      cs_msg_num,
+      cs_msg_per_sec,
+      Percentile(stats.cs_latency_ns, 0.50) / 1e3,
+      Percentile(stats.cs_latency_ns, 0.99) / 1e3,
+      stats.cs_latency_ns.empty() ? 0.0 : stats.cs_latency_ns.back() / 1e3,
+      stats.peer_msg_num,
+      msg_per_sec,
+      stats.wall_ns / 1e9
+  );
+}
+
+}  // namespace
+
+// Devices run in external loop mode, no timers are created
+extern "C" EebusTimerObject* EebusTimerCreate(EebusTimerTimeoutCallback cb, void* ctx) { return nullptr; }
+extern "C" uint64_t EebusTimerGetMonotonicTimeMs(void) { return 0; }
+
+// Allocations done by the stack are accounted with MEMORY_LEAKS_TEST hooks
+extern "C" void* test_malloc(size_t size, const char* file_name, int line) {
+  (void)file_name;
+  (void)line;
+  return AccountingMalloc(size);
+}
+
+extern "C" void test_free(void* p) { AccountingFree(p); }
+
+int main(int argc, char* argv[]) {
+  const size_t peers_num  = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 100;
+  const size_t rounds_num = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 10;
+  const size_t writes_num = (argc > 3) ? strtoul(argv[3], nullptr, 10) : 1;
+  const bool cbor         = (argc > 4) && (strcmp(argv[4], "cbor") == 0);
+  if (peers_num == 0) {
+    return EXIT_FAILURE;
+  }
+
+  const MessageProtocolFormatType format = cbor ? kMessageProtocolFormatTypeCbor : kMessageProtocolFormatTypeUTF8;
+
+  // Allocations done by cJSON are accounted as well
+  cJSON_Hooks hooks = {.malloc_fn = AccountingMalloc, .free_fn = AccountingFree};
+  cJSON_InitHooks(&hooks);
+
+  bool ok = true;
+  {
+    std::unique_ptr<Cs> cs = std::make_unique<Cs>();
+    if (!CreateCs(cs.get())) {
+      fprintf(stderr, "Failed to create the CS/MU device\n");
+      return EXIT_FAILURE;
+    }
+
+    const size_t cs_heap_base = heap_used[kHeapBucketCs];
+
+    std::vector<std::unique_ptr<Peer>> peers;
+    peers.reserve(peers_num);
+    for (size_t i = 0; i < peers_num; ++i) {
+      peers.push_back(std::make_unique<Peer>());
+      if (!CreatePeer(peers.back().get(), i, format)) {
+        fprintf(stderr, "Failed to create the peer %zu\n", i);
+        return EXIT_FAILURE;
+      }
+    }
+
+    // Connect all of the peers, the discovery, subscriptions and bindings follow
+    PhaseStats connect_stats;
+    Clock::time_point start = Clock::now();
+    for (const std::unique_ptr<Peer>& peer : peers) {
+      ok = ConnectPeer(cs.get(), peer.get()) && ok;
+    }
+
+    Pump(cs.get(), peers, &connect_stats);
+    connect_stats.wall_ns = ElapsedNs(start);
+
+    const size_t connected_num = static_cast<size_t>(std::count_if(peers.begin(), peers.end(), [](const auto& peer) {
+      return peer->cs_entity_addr != nullptr;
+    }));
+
+    const size_t cs_heap_connected   = heap_used[kHeapBucketCs];
+    const size_t peers_heap_connected = heap_used[kHeapBucketPeers];
+
+    // Steady state
+    PhaseStats steady_stats;
+    size_t limits_written = 0;
+    start                 = Clock::now();
+    for (size_t round = 0; round < rounds_num; ++round) {
+      limits_written += RunRound(cs.get(), peers, round, writes_num);
+      Pump(cs.get(), peers, &steady_stats);
+      Tick(cs.get(), peers, kRoundPeriodMs);
+      Pump(cs.get(), peers, &steady_stats);
+    }
+
+    steady_stats.wall_ns = ElapsedNs(start);
+
+    size_t measurements_num = 0;
+    for (const std::unique_ptr<Peer>& peer : peers) {
+      measurements_num += peer->measurements_num;
+    }
+
+    printf(
+        "peers: %zu (%zu connected), rounds: %zu, writes per round: %zu, format: %s\n\n",
+        peers_num,
+        connected_num,
+        rounds_num,
+        writes_num,
+        cbor ? "cbor" : "json"
+    );
+
+    printf(
+        "%-10s %10s %12s %10s %10s %10s %12s %12s %10s\n",
+        "phase",
+        "cs msgs",
+        "cs msgs/s",
+        "p50 us",
+        "p99 us",
+        "max us",
+        "peer msgs",
+        "msgs/s",
+        "wall s"
+    );
+
+    PrintPhase("connect", connect_stats);
+    PrintPhase("steady", steady_stats);
+
+    printf("\n");
+    printf("cs heap base:            %12zu B\n", cs_heap_base);
+    printf("cs heap per peer:        %12.0f B\n", static_cast<double>(cs_heap_connected - cs_heap_base) / peers_num);
+    printf("simulated peer heap:     %12.0f B\n", static_cast<double>(peers_heap_connected) / peers_num);
+    printf("cs heap after steady:    %12zu B\n", heap_used[kHeapBucketCs]);
+    printf("limits written/received: %12zu / %zu\n", limits_written, cs->cs_lpc_counter.power_limits_num);
+    printf("measurements received:   %12zu\n", measurements_num);
+
+    ok = ok && (connected_num == peers_num) && (cs->cs_lpc_counter.power_limits_num == limits_written);
+
+    // Writers shall be released after both of the devices referring them
+    for (const std::unique_ptr<Peer>& peer : peers) {
+      peer->ReleaseDevice();
+    }
+
+    cs.reset();
+    peers.clear();
+  }
+
+  if ((heap_used[kHeapBucketCs] != 0) || (heap_used[kHeapBucketPeers] != 0)) {
+    fprintf(
+        stderr,
+        "Heap not released: %zu B (cs), %zu B (peers)\n",
+        heap_used[kHeapBucketCs],
+        heap_used[kHeapBucketPeers]
+    );
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
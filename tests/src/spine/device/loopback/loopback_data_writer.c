@@ -0,0 +1,242 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Loopback Data Writer implementation
+ */
+
+#include "tests/src/spine/device/loopback/loopback_data_writer.h"
+
+#include <string.h>
+
+#include "src/common/message_buffer.h"
+
+typedef struct LoopbackMessage LoopbackMessage;
+
+struct LoopbackMessage {
+  MessageBuffer msg_buf;
+  LoopbackMessage* next;
+};
+
+typedef struct LoopbackDataWriter LoopbackDataWriter;
+
+struct LoopbackDataWriter {
+  /** Implements the Data Writer Interface */
+  DataWriterObject obj;
+
+  MessageProtocolFormatType format;
+  DeviceLocalObject* device;
+  DataReaderObject* reader;
+
+  LoopbackMessage* head;
+  LoopbackMessage* tail;
+
+  size_t pending_num;
+  size_t written_num;
+  size_t written_bytes;
+};
+
+#define LOOPBACK_DATA_WRITER(obj) ((LoopbackDataWriter*)(obj))
+
+static void Destruct(DataWriterObject* self);
+static EebusError
+WriteMessage(DataWriterObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority);
+static MessageProtocolFormatType GetFormat(const DataWriterObject* self);
+
+static const DataWriterInterface loopback_data_writer_methods = {
+    .destruct      = Destruct,
+    .write_message = WriteMessage,
+    .get_format    = GetFormat,
+};
+
+static void LoopbackDataWriterConstruct(LoopbackDataWriter* self, MessageProtocolFormatType format);
+static LoopbackMessage* PopMessage(LoopbackDataWriter* self);
+
+void LoopbackDataWriterConstruct(LoopbackDataWriter* self, MessageProtocolFormatType format) {
+  // Override "virtual functions table"
+  DATA_WRITER_INTERFACE(self) = &loopback_data_writer_methods;
+
+  self->format        = format;
+  self->device        = NULL;
+  self->reader        = NULL;
+  self->head          = NULL;
+  self->tail          = NULL;
+  self->pending_num   = 0;
+  self->written_num   = 0;
+  self->written_bytes = 0;
+}
+
+DataWriterObject* LoopbackDataWriterCreate(MessageProtocolFormatType format) {
+  LoopbackDataWriter* const writer = (LoopbackDataWriter*)EEBUS_MALLOC(sizeof(LoopbackDataWriter));
+  if (writer == NULL) {
+    return NULL;
+  }
+
+  LoopbackDataWriterConstruct(writer, format);
+
+  return DATA_WRITER_OBJECT(writer);
+}
+
+void Destruct(DataWriterObject* self) {
+  LoopbackDataWriter* const writer = LOOPBACK_DATA_WRITER(self);
+
+  LoopbackMessage* msg = PopMessage(writer);
+  while (msg != NULL) {
+    MessageBufferRelease(&msg->msg_buf);
+    EEBUS_FREE(msg);
+    msg = PopMessage(writer);
+  }
+}
+
+EebusError WriteMessage(DataWriterObject* self, const uint8_t* msg, size_t msg_size, MessagePriority priority) {
+  LoopbackDataWriter* const writer = LOOPBACK_DATA_WRITER(self);
+
+  if ((msg == NULL) || (msg_size == 0)) {
+    return kEebusErrorInputArgument;
+  }
+
+  // The caller releases the message right after writing, so that a copy has to be kept
+  LoopbackMessage* const loopback_msg = (LoopbackMessage*)EEBUS_MALLOC(sizeof(LoopbackMessage));
+  uint8_t* const data                 = (uint8_t*)EEBUS_MALLOC(msg_size);
+  if ((loopback_msg == NULL) || (data == NULL)) {
+    EEBUS_FREE(loopback_msg);
+    EEBUS_FREE(data);
+    return kEebusErrorMemoryAllocate;
+  }
+
+  memcpy(data, msg, msg_size);
+  MessageBufferInit(&loopback_msg->msg_buf, data, msg_size);
+  loopback_msg->next = NULL;
+
+  if (writer->tail == NULL) {
+    writer->head = loopback_msg;
+  } else {
+    writer->tail->next = loopback_msg;
+  }
+
+  writer->tail = loopback_msg;
+  ++writer->pending_num;
+  ++writer->written_num;
+  writer->written_bytes += msg_size;
+
+  return kEebusErrorOk;
+}
+
+MessageProtocolFormatType GetFormat(const DataWriterObject* self) {
+  const LoopbackDataWriter* const writer = LOOPBACK_DATA_WRITER(self);
+  return writer->format;
+}
+
+LoopbackMessage* PopMessage(LoopbackDataWriter* self) {
+  LoopbackMessage* const msg = self->head;
+  if (msg == NULL) {
+    return NULL;
+  }
+
+  self->head = msg->next;
+  if (self->head == NULL) {
+    self->tail = NULL;
+  }
+
+  --self->pending_num;
+  return msg;
+}
+
+void LoopbackDataWriterSetReceiver(DataWriterObject* self, DeviceLocalObject* device, DataReaderObject* reader) {
+  LoopbackDataWriter* const writer = LOOPBACK_DATA_WRITER(self);
+
+  writer->device = device;
+  writer->reader = reader;
+}
+
+size_t LoopbackDataWriterGetPendingNum(const DataWriterObject* self) {
+  const LoopbackDataWriter* const writer = LOOPBACK_DATA_WRITER(self);
+  return writer->pending_num;
+}
+
+size_t LoopbackDataWriterGetWrittenNum(const DataWriterObject* self) {
+  const LoopbackDataWriter* const writer = LOOPBACK_DATA_WRITER(self);
+  return writer->written_num;
+}
+
+size_t LoopbackDataWriterGetWrittenBytes(const DataWriterObject* self) {
+  const LoopbackDataWriter* const writer = LOOPBACK_DATA_WRITER(self);
+  return writer->written_bytes;
+}
+
+bool LoopbackDataWriterDeliver(DataWriterObject* self) {
+  LoopbackDataWriter* const writer = LOOPBACK_DATA_WRITER(self);
+
+  if (writer->reader == NULL) {
+    return false;
+  }
+
+  LoopbackMessage* const msg = PopMessage(writer);
+  if (msg == NULL) {
+    return false;
+  }
+
+  // The Data Reader takes over the message buffer
+  DATA_READER_HANDLE_MESSAGE(writer->reader, &msg->msg_buf);
+  MessageBufferRelease(&msg->msg_buf);
+  EEBUS_FREE(msg);
+
+  return true;
+}
+
+size_t LoopbackDataWriterProcess(DataWriterObject* self, size_t max_msg_num) {
+  LoopbackDataWriter* const writer = LOOPBACK_DATA_WRITER(self);
+
+  if (max_msg_num > LOOPBACK_PROCESS_BATCH_MAX_MSG) {
+    max_msg_num = LOOPBACK_PROCESS_BATCH_MAX_MSG;
+  }
+
+  size_t msg_num = 0;
+  while ((msg_num < max_msg_num) && LoopbackDataWriterDeliver(self)) {
+    ++msg_num;
+  }
+
+  if ((msg_num != 0) && (writer->device != NULL)) {
+    DEVICE_LOCAL_STEP(writer->device, 0);
+  }
+
+  return msg_num;
+}
+
+EebusError LoopbackConnect(
+    DeviceLocalObject* device_a,
+    const char* ski_a,
+    DataWriterObject* writer_a,
+    DeviceLocalObject* device_b,
+    const char* ski_b,
+    DataWriterObject* writer_b
+) {
+  if ((device_a == NULL) || (device_b == NULL) || (writer_a == NULL) || (writer_b == NULL)) {
+    return kEebusErrorInputArgumentNull;
+  }
+
+  // Each of the sides sees the other one as a remote device with the other's SKI
+  DataReaderObject* const reader_a = DEVICE_LOCAL_SETUP_REMOTE_DEVICE(device_a, ski_b, writer_a);
+  DataReaderObject* const reader_b = DEVICE_LOCAL_SETUP_REMOTE_DEVICE(device_b, ski_a, writer_b);
+  if ((reader_a == NULL) || (reader_b == NULL)) {
+    return kEebusErrorInit;
+  }
+
+  LoopbackDataWriterSetReceiver(writer_a, device_b, reader_b);
+  LoopbackDataWriterSetReceiver(writer_b, device_a, reader_a);
+
+  return kEebusErrorOk;
+}
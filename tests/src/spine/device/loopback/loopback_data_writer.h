@@ -0,0 +1,124 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Loopback Data Writer declarations
+ *
+ * In-process replacement of the SHIP connection for driving SPINE Device Local
+ * instances without SHIP, TLS and websockets. The outgoing messages are kept in
+ * a FIFO and passed to the Data Reader of the peer Device Local only when
+ * LoopbackDataWriterDeliver() is called, so that the caller fully controls the
+ * order and timing of the message processing.
+ *
+ * The Device Local instances are expected to run in external loop mode
+ * (see DEVICE_LOCAL_SET_EXTERNAL_LOOP()) without the wake callback:
+ * LoopbackDataWriterProcess() steps the receiving Device Local right after the delivery.
+ */
+
+#ifndef TESTS_SRC_SPINE_DEVICE_LOOPBACK_LOOPBACK_DATA_WRITER_H_
+#define TESTS_SRC_SPINE_DEVICE_LOOPBACK_LOOPBACK_DATA_WRITER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "src/common/eebus_errors.h"
+#include "src/common/eebus_malloc.h"
+#include "src/ship/api/data_reader_interface.h"
+#include "src/ship/api/data_writer_interface.h"
+#include "src/ship/model/model.h"
+#include "src/spine/api/device_local_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Maximum number of messages processed at once, matches the Device Local
+ * queue batch so that a single step always drains the delivered messages
+ */
+#define LOOPBACK_PROCESS_BATCH_MAX_MSG 8
+
+DataWriterObject* LoopbackDataWriterCreate(MessageProtocolFormatType format);
+
+static inline void LoopbackDataWriterDelete(DataWriterObject* writer) {
+  if (writer != NULL) {
+    DATA_WRITER_DESTRUCT(writer);
+    EEBUS_FREE(writer);
+  }
+}
+
+/**
+ * @brief Set the receiving Device Local and its Data Reader the written messages are delivered to
+ */
+void LoopbackDataWriterSetReceiver(DataWriterObject* self, DeviceLocalObject* device, DataReaderObject* reader);
+
+/**
+ * @brief Get the number of the written messages waiting for the delivery
+ */
+size_t LoopbackDataWriterGetPendingNum(const DataWriterObject* self);
+
+/**
+ * @brief Get the total number of the messages written so far
+ */
+size_t LoopbackDataWriterGetWrittenNum(const DataWriterObject* self);
+
+/**
+ * @brief Get the total size of the messages written so far in bytes
+ */
+size_t LoopbackDataWriterGetWrittenBytes(const DataWriterObject* self);
+
+/**
+ * @brief Pass the oldest pending message to the Data Reader
+ * @return true if a message has been delivered, false if there were no pending messages
+ * or no Data Reader is set
+ */
+bool LoopbackDataWriterDeliver(DataWriterObject* self);
+
+/**
+ * @brief Deliver up to max_msg_num pending messages and let the receiving Device Local process them
+ * @param max_msg_num Maximum number of messages to be delivered, limited to LOOPBACK_PROCESS_BATCH_MAX_MSG
+ * @return Number of the messages processed
+ */
+size_t LoopbackDataWriterProcess(DataWriterObject* self, size_t max_msg_num);
+
+/**
+ * @brief Connect two Device Local instances with each other
+ *
+ * Sets up the remote device on both of the sides which starts the detailed discovery.
+ * The messages are exchanged only on LoopbackDataWriterProcess() calls then.
+ *
+ * @param device_a First Device Local to be connected
+ * @param ski_a SKI the first Device Local is known with to the second one
+ * @param writer_a Loopback Data Writer carrying the messages from the first Device Local to the second one
+ * @param device_b Second Device Local to be connected
+ * @param ski_b SKI the second Device Local is known with to the first one
+ * @param writer_b Loopback Data Writer carrying the messages from the second Device Local to the first one
+ * @return kEebusErrorOk on success, error code otherwise
+ */
+EebusError LoopbackConnect(
+    DeviceLocalObject* device_a,
+    const char* ski_a,
+    DataWriterObject* writer_a,
+    DeviceLocalObject* device_b,
+    const char* ski_b,
+    DataWriterObject* writer_b
+);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // TESTS_SRC_SPINE_DEVICE_LOOPBACK_LOOPBACK_DATA_WRITER_H_
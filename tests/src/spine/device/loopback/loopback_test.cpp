@@ -0,0 +1,665 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tests/src/spine/device/loopback/loopback_data_writer.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mocks/use_case/api/cs_lpc_listener_mock.h"
+#include "mocks/use_case/api/eg_lpc_listener_mock.h"
+#include "src/common/array_util.h"
+#include "src/common/eebus_timer/eebus_timer.h"
+#include "src/spine/device/device_local.h"
+#include "src/spine/device/remote_device_cache.h"
+#include "src/spine/entity/entity_local.h"
+#include "src/spine/events/events.h"
+#include "src/spine/model/command_frame_types.h"
+#include "src/spine/model/node_management_types.h"
+#include "src/spine/model/entity_types.h"
+#include "src/use_case/actor/cs/lpc/cs_lpc.h"
+#include "src/use_case/actor/eg/lpc/eg_lpc.h"
+#include "tests/src/memory_leak.inc"
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::WithArgs;
+
+// Devices run in external loop mode, no timers are created
+EebusTimerObject* EebusTimerCreate(EebusTimerTimeoutCallback cb, void* ctx) { return nullptr; }
+
+namespace {
+
+static constexpr NetworkManagementFeatureSetType kFeatureSet = kNetworkManagementFeatureSetTypeSmart;
+static constexpr uint32_t kHeartbeatTimeout                  = 60;
+static constexpr char kCsSki[]                               = "1111";
+static constexpr char kEgSki[]                               = "2222";
+
+const EebusDeviceInfo cs_device_info = {
+    .type       = "HeatGenerationSystem",
+    .vendor     = "Demo",
+    .brand      = "Demo",
+    .model      = "HeatPump",
+    .serial_num = "123456789",
+    .ship_id    = "Demo",
+    .address    = "d:_n:Demo_HeatPump-123456789",
+};
+
+const EebusDeviceInfo eg_device_info = {
+    .type       = "EnergyManagementSystem",
+    .vendor     = "Demo",
+    .brand      = "Demo",
+    .model      = "HEMS",
+    .serial_num = "987654321",
+    .ship_id    = "Demo",
+    .address    = "d:_n:Demo_HEMS-987654321",
+};
+
+using DeviceLocalPtr = std::unique_ptr<DeviceLocalObject, decltype(&DeviceLocalDelete)>;
+using DataWriterPtr  = std::unique_ptr<DataWriterObject, decltype(&LoopbackDataWriterDelete)>;
+
+EntityLocalObject* AddEntity(DeviceLocalObject* device_local, EntityTypeType entity_type) {
+  uint32_t entity_ids[1] = {static_cast<uint32_t>(VectorGetSize(DEVICE_LOCAL_GET_ENTITIES(device_local)))};
+  return EntityLocalCreate(device_local, entity_type, entity_ids, ARRAY_SIZE(entity_ids), kHeartbeatTimeout);
+}
+
+struct DisconnectCheck {
+  DeviceLocalObject* device_local;
+  const char* ski;
+  size_t remove_num;
+  bool is_device_valid;
+};
+
+/**
+ * @brief Checks the removed remote device is still accessible while the disconnection is published
+ */
+void OnDeviceRemove(const EventPayload* payload, void* ctx) {
+  DisconnectCheck* const check = static_cast<DisconnectCheck*>(ctx);
+
+  if ((payload->event_type != kEventTypeDeviceChange) || (payload->change_type != kElementChangeRemove)
+      || (strcmp(payload->ski, check->ski) != 0)) {
+    return;
+  }
+
+  const DeviceRemoteObject* const registered = DEVICE_LOCAL_GET_REMOTE_DEVICE_WITH_SKI(check->device_local, check->ski);
+
+  ++check->remove_num;
+  check->is_device_valid = (payload->device != nullptr) && (registered == payload->device);
+}
+
+/**
+ * @brief Exchange the messages in both directions until there is nothing left to be delivered
+ */
+size_t Pump(DataWriterObject* writer_a, DataWriterObject* writer_b) {
+  size_t msg_num = 0;
+  while ((LoopbackDataWriterGetPendingNum(writer_a) != 0) || (LoopbackDataWriterGetPendingNum(writer_b) != 0)) {
+    msg_num += LoopbackDataWriterProcess(writer_a, LOOPBACK_PROCESS_BATCH_MAX_MSG);
+    msg_num += LoopbackDataWriterProcess(writer_b, LOOPBACK_PROCESS_BATCH_MAX_MSG);
+  }
+
+  return msg_num;
+}
+
+/**
+ * @brief Collects the changes of the remote entities published while the discovery notify is processed
+ */
+struct DiscoveryChangeCheck {
+  const char* ski;
+  size_t entity_add_num;
+  size_t entity_update_num;
+  std::vector<FeatureTypeType> unsubscribed_feature_types;
+};
+
+void OnDiscoveryChange(const EventPayload* payload, void* ctx) {
+  DiscoveryChangeCheck* const check = static_cast<DiscoveryChangeCheck*>(ctx);
+
+  if ((payload->ski == nullptr) || (strcmp(payload->ski, check->ski) != 0)) {
+    return;
+  }
+
+  if (payload->event_type == kEventTypeEntityChange) {
+    if (payload->change_type == kElementChangeAdd) {
+      ++check->entity_add_num;
+    } else if (payload->change_type == kElementChangeUpdate) {
+      ++check->entity_update_num;
+    }
+  } else if ((payload->event_type == kEventTypeSubscriptionChange) && (payload->change_type == kElementChangeRemove)) {
+    check->unsubscribed_feature_types.push_back(FEATURE_GET_TYPE(FEATURE_OBJECT(payload->feature)));
+  }
+}
+
+/**
+ * @brief Send the Detailed Discovery notify from the Node Management of device to the one of the peer
+ */
+EebusError NotifyDetailedDiscovery(
+    DeviceLocalObject* device,
+    const char* peer_ski,
+    const char* peer_addr,
+    const NodeManagementDetailedDiscoveryDataType* data
+) {
+  DeviceRemoteObject* const peer = DEVICE_LOCAL_GET_REMOTE_DEVICE_WITH_SKI(device, peer_ski);
+  if (peer == nullptr) {
+    return kEebusErrorInputArgument;
+  }
+
+  static constexpr uint32_t kNodeManagementId = 0;
+  const uint32_t* const entity_ids[]          = {&kNodeManagementId};
+
+  const FeatureAddressType sender_addr = {
+      .device      = DEVICE_GET_ADDRESS(DEVICE_OBJECT(device)),
+      .entity      = entity_ids,
+      .entity_size = ARRAY_SIZE(entity_ids),
+      .feature     = &kNodeManagementId,
+  };
+
+  const FeatureAddressType dest_addr = {
+      .device      = peer_addr,
+      .entity      = entity_ids,
+      .entity_size = ARRAY_SIZE(entity_ids),
+      .feature     = &kNodeManagementId,
+  };
+
+  const CmdType cmd = {
+      .data_choice         = data,
+      .data_choice_type_id = kFunctionTypeNodeManagementDetailedDiscoveryData,
+  };
+
+  return SEND_NOTIFY(DEVICE_REMOTE_GET_SENDER(peer), &sender_addr, &dest_addr, &cmd);
+}
+
+/**
+ * @brief Notify the single feature change of the given entity
+ */
+EebusError NotifyFeatureChange(
+    DeviceLocalObject* device,
+    const char* peer_ski,
+    const char* peer_addr,
+    const NetworkManagementEntityDescriptionDataType* entity_description,
+    const NetworkManagementFeatureDescriptionDataType* feature_description
+) {
+  const NodeManagementDetailedDiscoveryEntityInformationType entity_info   = {.description = entity_description};
+  const NodeManagementDetailedDiscoveryFeatureInformationType feature_info = {.description = feature_description};
+
+  const NodeManagementDetailedDiscoveryEntityInformationType* const entity_infos[]   = {&entity_info};
+  const NodeManagementDetailedDiscoveryFeatureInformationType* const feature_infos[] = {&feature_info};
+
+  const NodeManagementDetailedDiscoveryDataType data = {
+      .entity_information       = entity_infos,
+      .entity_information_size  = ARRAY_SIZE(entity_infos),
+      .feature_information      = feature_infos,
+      .feature_information_size = (feature_description != nullptr) ? ARRAY_SIZE(feature_infos) : 0,
+  };
+
+  return NotifyDetailedDiscovery(device, peer_ski, peer_addr, &data);
+}
+
+/**
+ * @brief Collects the remote device model changes published while the connection is set up
+ */
+struct RestoreCheck {
+  const char* ski;
+  size_t device_add_num;
+  size_t entity_add_num;
+  std::vector<FunctionType> data_function_types;
+};
+
+void OnRestoreChange(const EventPayload* payload, void* ctx) {
+  RestoreCheck* const check = static_cast<RestoreCheck*>(ctx);
+
+  if ((payload->ski == nullptr) || (strcmp(payload->ski, check->ski) != 0)) {
+    return;
+  }
+
+  if ((payload->event_type == kEventTypeDeviceChange) && (payload->change_type == kElementChangeAdd)) {
+    ++check->device_add_num;
+  } else if ((payload->event_type == kEventTypeEntityChange) && (payload->change_type == kElementChangeAdd)) {
+    ++check->entity_add_num;
+  } else if (payload->event_type == kEventTypeDataChange) {
+    check->data_function_types.push_back(payload->function_type);
+  }
+}
+
+bool HasFunctionType(const RestoreCheck& check, FunctionType function_type) {
+  const std::vector<FunctionType>& function_types = check.data_function_types;
+  return std::find(function_types.begin(), function_types.end(), function_type) != function_types.end();
+}
+
+std::string GetCacheFilePath(const char* ski) { return testing::TempDir() + "/" + ski + ".json"; }
+
+}  // namespace
+
+class LoopbackTests : public ::testing::TestWithParam<MessageProtocolFormatType> {};
+
+void LoopbackTestInternal(MessageProtocolFormatType format) {
+  DataWriterPtr cs_writer{LoopbackDataWriterCreate(format), LoopbackDataWriterDelete};
+  DataWriterPtr eg_writer{LoopbackDataWriterCreate(format), LoopbackDataWriterDelete};
+  ASSERT_NE(cs_writer, nullptr);
+  ASSERT_NE(eg_writer, nullptr);
+
+  std::unique_ptr<CsLpcListenerMock, decltype(&CsLpcListenerMockDelete)> cs_lpc_listener_mock{
+      CsLpcListenerMockCreate(),
+      CsLpcListenerMockDelete
+  };
+
+  std::unique_ptr<EgLpcListenerMock, decltype(&EgLpcListenerMockDelete)> eg_lpc_listener_mock{
+      EgLpcListenerMockCreate(),
+      EgLpcListenerMockDelete
+  };
+
+  // Devices shall be released before the writers, the pending messages refer the remote devices
+  DeviceLocalPtr cs_device{DeviceLocalCreate(&cs_device_info, &kFeatureSet), DeviceLocalDelete};
+  DeviceLocalPtr eg_device{DeviceLocalCreate(&eg_device_info, &kFeatureSet), DeviceLocalDelete};
+
+  EntityLocalObject* const cs_entity = AddEntity(cs_device.get(), kEntityTypeTypeHeatPumpAppliance);
+  EntityLocalObject* const eg_entity = AddEntity(eg_device.get(), kEntityTypeTypeCEM);
+
+  std::unique_ptr<CsLpcUseCaseObject, decltype(&CsLpcUseCaseDelete)> cs_lpc{
+      CsLpcUseCaseCreate(cs_entity, 0, CS_LPC_LISTENER_OBJECT(cs_lpc_listener_mock.get())),
+      CsLpcUseCaseDelete
+  };
+
+  std::unique_ptr<EgLpcUseCaseObject, decltype(&EgLpcUseCaseDelete)> eg_lpc{
+      EgLpcUseCaseCreate(eg_entity, EG_LPC_LISTENER_OBJECT(eg_lpc_listener_mock.get())),
+      EgLpcUseCaseDelete
+  };
+
+  ASSERT_NE(cs_lpc, nullptr);
+  ASSERT_NE(eg_lpc, nullptr);
+
+  EXPECT_EQ(SetConsumptionLimit(cs_lpc.get(), 4200, 0, false, true), kEebusErrorOk);
+
+  DEVICE_LOCAL_ADD_ENTITY(cs_device.get(), cs_entity);
+  DEVICE_LOCAL_ADD_ENTITY(eg_device.get(), eg_entity);
+
+  DEVICE_LOCAL_SET_EXTERNAL_LOOP(cs_device.get(), nullptr, nullptr);
+  DEVICE_LOCAL_SET_EXTERNAL_LOOP(eg_device.get(), nullptr, nullptr);
+  ASSERT_EQ(DEVICE_LOCAL_START(cs_device.get()), kEebusErrorOk);
+  ASSERT_EQ(DEVICE_LOCAL_START(eg_device.get()), kEebusErrorOk);
+
+  // 1. Connect the devices, the discovery, subscriptions and bindings follow
+  EntityAddressType* cs_entity_addr = nullptr;
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, OnRemoteEntityConnect(_, _))
+      .WillOnce(WithArgs<1>(Invoke([&cs_entity_addr](const EntityAddressType* entity_addr) {
+        cs_entity_addr = EntityAddressCopy(entity_addr);
+      })));
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, OnPowerLimitReceive(_, _, _, _)).WillRepeatedly(Return());
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, OnFailsafePowerLimitReceive(_, _)).WillRepeatedly(Return());
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, OnFailsafeDurationReceive(_, _)).WillRepeatedly(Return());
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, OnHeartbeatReceive(_, _)).WillRepeatedly(Return());
+  EXPECT_CALL(*cs_lpc_listener_mock->gmock, OnHeartbeatReceive(_, _)).WillRepeatedly(Return());
+
+  ASSERT_EQ(
+      LoopbackConnect(cs_device.get(), kCsSki, cs_writer.get(), eg_device.get(), kEgSki, eg_writer.get()),
+      kEebusErrorOk
+  );
+
+  EXPECT_GT(Pump(cs_writer.get(), eg_writer.get()), 0);
+  ASSERT_NE(cs_entity_addr, nullptr);
+
+  // 2. The initial limit has been read by the Energy Guard
+  LoadLimit limit = {};
+  EXPECT_EQ(EgLpcGetActivePowerConsumptionLimit(eg_lpc.get(), cs_entity_addr, &limit), kEebusErrorOk);
+  EXPECT_EQ(limit.value.value, 4200);
+  EXPECT_EQ(limit.value.scale, 0);
+  EXPECT_FALSE(limit.is_active);
+
+  // 3. Write the new limit and check it is received by the Controllable System
+  EXPECT_CALL(*cs_lpc_listener_mock->gmock, OnPowerLimitReceive(_, _, _, _))
+      .WillOnce(WithArgs<1, 3>(Invoke([](const ScaledValue* power_limit, bool is_active) {
+        ASSERT_NE(power_limit, nullptr);
+        EXPECT_EQ(power_limit->value, 100);
+        EXPECT_EQ(power_limit->scale, 0);
+        EXPECT_TRUE(is_active);
+      })));
+
+  const LoadLimit new_limit = {
+      .value     = {.value = 100, .scale = 0},
+      .duration  = {.hours = 1},
+      .is_active = true,
+  };
+
+  EXPECT_EQ(EgLpcSetActivePowerConsumptionLimit(eg_lpc.get(), cs_entity_addr, &new_limit), kEebusErrorOk);
+  EXPECT_GT(Pump(cs_writer.get(), eg_writer.get()), 0);
+
+  EXPECT_EQ(GetConsumptionLimit(cs_lpc.get(), &limit), kEebusErrorOk);
+  EXPECT_EQ(limit.value.value, 100);
+  EXPECT_TRUE(limit.is_active);
+
+  // 4. The change is notified back to the subscribed Energy Guard
+  EXPECT_EQ(EgLpcGetActivePowerConsumptionLimit(eg_lpc.get(), cs_entity_addr, &limit), kEebusErrorOk);
+  EXPECT_EQ(limit.value.value, 100);
+  EXPECT_TRUE(limit.is_active);
+
+  EXPECT_EQ(LoopbackDataWriterGetPendingNum(cs_writer.get()), 0);
+  EXPECT_EQ(LoopbackDataWriterGetPendingNum(eg_writer.get()), 0);
+  EXPECT_GT(LoopbackDataWriterGetWrittenNum(cs_writer.get()), 0);
+  EXPECT_GT(LoopbackDataWriterGetWrittenNum(eg_writer.get()), 0);
+
+  // 5. The feature changes notified by the Energy Guard keep the subscriptions of the sibling features
+  DeviceRemoteObject* const eg_remote = DEVICE_LOCAL_GET_REMOTE_DEVICE_WITH_SKI(cs_device.get(), kEgSki);
+  ASSERT_NE(eg_remote, nullptr);
+
+  const EntityAddressType* const eg_entity_addr = ENTITY_GET_ADDRESS(ENTITY_OBJECT(eg_entity));
+  EntityRemoteObject* const eg_remote_entity
+      = DEVICE_REMOTE_GET_ENTITY(eg_remote, eg_entity_addr->entity, eg_entity_addr->entity_size);
+  ASSERT_NE(eg_remote_entity, nullptr);
+
+  const FeatureRemoteObject* const eg_load_control  = ENTITY_REMOTE_GET_FEATURE_WITH_TYPE_AND_ROLE(
+      eg_remote_entity, kFeatureTypeTypeLoadControl, kRoleTypeClient);
+  const FeatureRemoteObject* const eg_device_config = ENTITY_REMOTE_GET_FEATURE_WITH_TYPE_AND_ROLE(
+      eg_remote_entity, kFeatureTypeTypeDeviceConfiguration, kRoleTypeClient);
+  ASSERT_NE(eg_load_control, nullptr);
+  ASSERT_NE(eg_device_config, nullptr);
+
+  const EntityTypeType cem_type = kEntityTypeTypeCEM;
+
+  const NetworkManagementEntityDescriptionDataType eg_description = {
+      .entity_address = eg_entity_addr,
+      .entity_type    = &cem_type,
+  };
+
+  DiscoveryChangeCheck change_check = {.ski = kEgSki};
+  ASSERT_EQ(EventSubscribe(kEventHandlerLevelApplication, OnDiscoveryChange, &change_check), kEebusErrorOk);
+
+  // 5.1. Remove the Device Configuration client, the Load Control subscription stays
+  const uint32_t device_config_id = *FEATURE_GET_ADDRESS(FEATURE_OBJECT(eg_device_config))->feature;
+
+  const FeatureAddressType device_config_addr = {
+      .device      = eg_device_info.address,
+      .entity      = eg_entity_addr->entity,
+      .entity_size = eg_entity_addr->entity_size,
+      .feature     = &device_config_id,
+  };
+
+  const NetworkManagementStateChangeType removed = kNetworkManagementStateChangeTypeRemoved;
+
+  const NetworkManagementFeatureDescriptionDataType removed_device_config = {
+      .feature_address   = &device_config_addr,
+      .last_state_change = &removed,
+  };
+
+  ASSERT_EQ(
+      NotifyFeatureChange(eg_device.get(), kCsSki, cs_device_info.address, &eg_description, &removed_device_config),
+      kEebusErrorOk
+  );
+
+  EXPECT_GT(Pump(cs_writer.get(), eg_writer.get()), 0);
+  EXPECT_EQ(ENTITY_REMOTE_GET_FEATURE_WITH_ID(eg_remote_entity, &device_config_id), nullptr);
+  EXPECT_EQ(
+      ENTITY_REMOTE_GET_FEATURE_WITH_TYPE_AND_ROLE(eg_remote_entity, kFeatureTypeTypeLoadControl, kRoleTypeClient),
+      eg_load_control
+  );
+  EXPECT_EQ(change_check.entity_update_num, 1);
+  EXPECT_EQ(change_check.unsubscribed_feature_types, std::vector<FeatureTypeType>{kFeatureTypeTypeDeviceConfiguration});
+
+  // 5.2. Add the new Measurement client to the known entity
+  const uint32_t measurement_id = 100;
+
+  const FeatureAddressType measurement_addr = {
+      .device      = eg_device_info.address,
+      .entity      = eg_entity_addr->entity,
+      .entity_size = eg_entity_addr->entity_size,
+      .feature     = &measurement_id,
+  };
+
+  const FeatureTypeType measurement_type = kFeatureTypeTypeMeasurement;
+  const RoleType client_role             = kRoleTypeClient;
+
+  const NetworkManagementFeatureDescriptionDataType added_measurement = {
+      .feature_address = &measurement_addr,
+      .feature_type    = &measurement_type,
+      .role            = &client_role,
+  };
+
+  change_check.unsubscribed_feature_types.clear();
+  ASSERT_EQ(
+      NotifyFeatureChange(eg_device.get(), kCsSki, cs_device_info.address, &eg_description, &added_measurement),
+      kEebusErrorOk
+  );
+
+  EXPECT_GT(Pump(cs_writer.get(), eg_writer.get()), 0);
+  const FeatureRemoteObject* const added = ENTITY_REMOTE_GET_FEATURE_WITH_ID(eg_remote_entity, &measurement_id);
+  ASSERT_NE(added, nullptr);
+  EXPECT_EQ(FEATURE_GET_TYPE(FEATURE_OBJECT(added)), kFeatureTypeTypeMeasurement);
+  EXPECT_EQ(change_check.entity_update_num, 2);
+  EXPECT_TRUE(change_check.unsubscribed_feature_types.empty());
+
+  // 5.3. Replace the Load Control client by the Measurement client with the same id
+  const uint32_t load_control_id = *FEATURE_GET_ADDRESS(FEATURE_OBJECT(eg_load_control))->feature;
+
+  const FeatureAddressType load_control_addr = {
+      .device      = eg_device_info.address,
+      .entity      = eg_entity_addr->entity,
+      .entity_size = eg_entity_addr->entity_size,
+      .feature     = &load_control_id,
+  };
+
+  const NetworkManagementFeatureDescriptionDataType replaced_load_control = {
+      .feature_address = &load_control_addr,
+      .feature_type    = &measurement_type,
+      .role            = &client_role,
+  };
+
+  ASSERT_EQ(
+      NotifyFeatureChange(eg_device.get(), kCsSki, cs_device_info.address, &eg_description, &replaced_load_control),
+      kEebusErrorOk
+  );
+
+  EXPECT_GT(Pump(cs_writer.get(), eg_writer.get()), 0);
+  const FeatureRemoteObject* const replaced = ENTITY_REMOTE_GET_FEATURE_WITH_ID(eg_remote_entity, &load_control_id);
+  ASSERT_NE(replaced, nullptr);
+  EXPECT_EQ(FEATURE_GET_TYPE(FEATURE_OBJECT(replaced)), kFeatureTypeTypeMeasurement);
+  EXPECT_EQ(change_check.entity_update_num, 3);
+  EXPECT_EQ(change_check.unsubscribed_feature_types, std::vector<FeatureTypeType>{kFeatureTypeTypeLoadControl});
+
+  // 5.4. The new entity without the type is ignored
+  const uint32_t unknown_entity_id     = 7;
+  const uint32_t* const unknown_ids[]  = {&unknown_entity_id};
+  const EntityAddressType unknown_addr = {
+      .device      = eg_device_info.address,
+      .entity      = unknown_ids,
+      .entity_size = ARRAY_SIZE(unknown_ids),
+  };
+
+  const NetworkManagementEntityDescriptionDataType untyped_entity_description = {.entity_address = &unknown_addr};
+  ASSERT_EQ(
+      NotifyFeatureChange(eg_device.get(), kCsSki, cs_device_info.address, &untyped_entity_description, nullptr),
+      kEebusErrorOk
+  );
+
+  EXPECT_GT(Pump(cs_writer.get(), eg_writer.get()), 0);
+  EXPECT_EQ(DEVICE_REMOTE_GET_ENTITY(eg_remote, unknown_ids, ARRAY_SIZE(unknown_ids)), nullptr);
+  EXPECT_EQ(change_check.entity_add_num, 0);
+  EXPECT_EQ(change_check.entity_update_num, 3);
+
+  EXPECT_EQ(EventUnsubscribe(kEventHandlerLevelApplication, OnDiscoveryChange, &change_check), kEebusErrorOk);
+
+  // 6. Disconnect, the use cases filtering the events by the local device shall not touch the released device
+  DisconnectCheck disconnect_check = {.device_local = eg_device.get(), .ski = kCsSki};
+  ASSERT_EQ(EventSubscribe(kEventHandlerLevelApplication, OnDeviceRemove, &disconnect_check), kEebusErrorOk);
+
+  DEVICE_LOCAL_REMOVE_REMOTE_DEVICE_CONNECTION(eg_device.get(), kCsSki);
+  DEVICE_LOCAL_REMOVE_REMOTE_DEVICE_CONNECTION(cs_device.get(), kEgSki);
+
+  EXPECT_EQ(EventUnsubscribe(kEventHandlerLevelApplication, OnDeviceRemove, &disconnect_check), kEebusErrorOk);
+  EXPECT_EQ(disconnect_check.remove_num, 1);
+  EXPECT_TRUE(disconnect_check.is_device_valid);
+  EXPECT_EQ(DEVICE_LOCAL_GET_REMOTE_DEVICE_WITH_SKI(eg_device.get(), kCsSki), nullptr);
+  EXPECT_EQ(DEVICE_LOCAL_GET_REMOTE_DEVICE_WITH_SKI(cs_device.get(), kEgSki), nullptr);
+
+  // Nothing is sent to the disconnected peer anymore
+  EXPECT_EQ(EgLpcSetActivePowerConsumptionLimit(eg_lpc.get(), cs_entity_addr, &new_limit), kEebusErrorNoChange);
+  EXPECT_EQ(LoopbackDataWriterGetPendingNum(eg_writer.get()), 0);
+
+  EntityAddressDelete(cs_entity_addr);
+
+  EXPECT_CALL(*cs_lpc_listener_mock->gmock, Destruct(_)).WillOnce(Return());
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, Destruct(_)).WillOnce(Return());
+
+  DEVICE_LOCAL_STOP(cs_device.get());
+  DEVICE_LOCAL_STOP(eg_device.get());
+}
+
+TEST_P(LoopbackTests, LoopbackTests) {
+  LoopbackTestInternal(GetParam());
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+/**
+ * @brief Connects the Energy Guard keeping the remote device cache to the Controllable System,
+ * the changes published by the Energy Guard before it receives any reply are collected
+ */
+void LoopbackTestCacheSessionInternal(MessageProtocolFormatType format, RestoreCheck* check) {
+  DataWriterPtr cs_writer{LoopbackDataWriterCreate(format), LoopbackDataWriterDelete};
+  DataWriterPtr eg_writer{LoopbackDataWriterCreate(format), LoopbackDataWriterDelete};
+  ASSERT_NE(cs_writer, nullptr);
+  ASSERT_NE(eg_writer, nullptr);
+
+  std::unique_ptr<CsLpcListenerMock, decltype(&CsLpcListenerMockDelete)> cs_lpc_listener_mock{
+      CsLpcListenerMockCreate(),
+      CsLpcListenerMockDelete
+  };
+
+  std::unique_ptr<EgLpcListenerMock, decltype(&EgLpcListenerMockDelete)> eg_lpc_listener_mock{
+      EgLpcListenerMockCreate(),
+      EgLpcListenerMockDelete
+  };
+
+  DeviceLocalPtr cs_device{DeviceLocalCreate(&cs_device_info, &kFeatureSet), DeviceLocalDelete};
+  DeviceLocalPtr eg_device{DeviceLocalCreate(&eg_device_info, &kFeatureSet), DeviceLocalDelete};
+
+  RemoteDeviceCacheObject* const cache = RemoteDeviceCacheCreate(testing::TempDir().c_str());
+  ASSERT_NE(cache, nullptr);
+  DEVICE_LOCAL_SET_REMOTE_DEVICE_CACHE(eg_device.get(), cache);
+
+  EntityLocalObject* const cs_entity = AddEntity(cs_device.get(), kEntityTypeTypeHeatPumpAppliance);
+  EntityLocalObject* const eg_entity = AddEntity(eg_device.get(), kEntityTypeTypeCEM);
+
+  std::unique_ptr<CsLpcUseCaseObject, decltype(&CsLpcUseCaseDelete)> cs_lpc{
+      CsLpcUseCaseCreate(cs_entity, 0, CS_LPC_LISTENER_OBJECT(cs_lpc_listener_mock.get())),
+      CsLpcUseCaseDelete
+  };
+
+  std::unique_ptr<EgLpcUseCaseObject, decltype(&EgLpcUseCaseDelete)> eg_lpc{
+      EgLpcUseCaseCreate(eg_entity, EG_LPC_LISTENER_OBJECT(eg_lpc_listener_mock.get())),
+      EgLpcUseCaseDelete
+  };
+
+  ASSERT_NE(cs_lpc, nullptr);
+  ASSERT_NE(eg_lpc, nullptr);
+
+  EXPECT_EQ(SetConsumptionLimit(cs_lpc.get(), 4200, 0, false, true), kEebusErrorOk);
+
+  DEVICE_LOCAL_ADD_ENTITY(cs_device.get(), cs_entity);
+  DEVICE_LOCAL_ADD_ENTITY(eg_device.get(), eg_entity);
+
+  DEVICE_LOCAL_SET_EXTERNAL_LOOP(cs_device.get(), nullptr, nullptr);
+  DEVICE_LOCAL_SET_EXTERNAL_LOOP(eg_device.get(), nullptr, nullptr);
+  ASSERT_EQ(DEVICE_LOCAL_START(cs_device.get()), kEebusErrorOk);
+  ASSERT_EQ(DEVICE_LOCAL_START(eg_device.get()), kEebusErrorOk);
+
+  // The restored entity is announced before any reply is received, the reply may announce the same one again
+  EntityAddressType* cs_entity_addr = nullptr;
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, OnRemoteEntityConnect(_, _))
+      .WillRepeatedly(WithArgs<1>(Invoke([&cs_entity_addr](const EntityAddressType* entity_addr) {
+        if (cs_entity_addr == nullptr) {
+          cs_entity_addr = EntityAddressCopy(entity_addr);
+        }
+      })));
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, OnPowerLimitReceive(_, _, _, _)).WillRepeatedly(Return());
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, OnFailsafePowerLimitReceive(_, _)).WillRepeatedly(Return());
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, OnFailsafeDurationReceive(_, _)).WillRepeatedly(Return());
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, OnHeartbeatReceive(_, _)).WillRepeatedly(Return());
+  EXPECT_CALL(*cs_lpc_listener_mock->gmock, OnHeartbeatReceive(_, _)).WillRepeatedly(Return());
+
+  ASSERT_EQ(
+      LoopbackConnect(cs_device.get(), kCsSki, cs_writer.get(), eg_device.get(), kEgSki, eg_writer.get()),
+      kEebusErrorOk
+  );
+
+  // The model is restored once the Energy Guard answers the detailed discovery read,
+  // i.e. before any reply of the Controllable System is received
+  ASSERT_EQ(EventSubscribe(kEventHandlerLevelApplication, OnRestoreChange, check), kEebusErrorOk);
+  EXPECT_EQ(LoopbackDataWriterProcess(cs_writer.get(), 1), 1);
+  EXPECT_EQ(EventUnsubscribe(kEventHandlerLevelApplication, OnRestoreChange, check), kEebusErrorOk);
+
+  // The actual replies revalidate the restored model, the use case works as usual
+  EXPECT_GT(Pump(cs_writer.get(), eg_writer.get()), 0);
+  ASSERT_NE(cs_entity_addr, nullptr);
+
+  LoadLimit limit = {};
+  EXPECT_EQ(EgLpcGetActivePowerConsumptionLimit(eg_lpc.get(), cs_entity_addr, &limit), kEebusErrorOk);
+  EXPECT_EQ(limit.value.value, 4200);
+
+  // The cached replies are written out by the next tick, after the device lock is released
+  DEVICE_LOCAL_REMOVE_REMOTE_DEVICE_CONNECTION(eg_device.get(), kCsSki);
+  DEVICE_LOCAL_REMOVE_REMOTE_DEVICE_CONNECTION(cs_device.get(), kEgSki);
+  DEVICE_LOCAL_STEP(eg_device.get(), 1000);
+
+  FILE* const fp = fopen(GetCacheFilePath(kCsSki).c_str(), "rb");
+  EXPECT_NE(fp, nullptr);
+  if (fp != nullptr) {
+    fclose(fp);
+  }
+
+  EXPECT_EQ(fopen((GetCacheFilePath(kCsSki) + ".tmp").c_str(), "rb"), nullptr);
+
+  EntityAddressDelete(cs_entity_addr);
+
+  EXPECT_CALL(*cs_lpc_listener_mock->gmock, Destruct(_)).WillOnce(Return());
+  EXPECT_CALL(*eg_lpc_listener_mock->gmock, Destruct(_)).WillOnce(Return());
+
+  DEVICE_LOCAL_STOP(cs_device.get());
+  DEVICE_LOCAL_STOP(eg_device.get());
+}
+
+TEST_P(LoopbackTests, LoopbackTestsRemoteDeviceCacheRestore) {
+  std::remove(GetCacheFilePath(kCsSki).c_str());
+
+  // Nothing is known on the first connection, the model is built from the replies
+  RestoreCheck first_check = {.ski = kCsSki};
+  LoopbackTestCacheSessionInternal(GetParam(), &first_check);
+  EXPECT_EQ(first_check.device_add_num, 0);
+  EXPECT_EQ(first_check.entity_add_num, 0);
+  EXPECT_TRUE(first_check.data_function_types.empty());
+
+  // On reconnection the model, the use cases and the descriptions are restored without waiting for the replies
+  RestoreCheck second_check = {.ski = kCsSki};
+  LoopbackTestCacheSessionInternal(GetParam(), &second_check);
+  EXPECT_EQ(second_check.device_add_num, 1);
+  EXPECT_GT(second_check.entity_add_num, 0);
+  EXPECT_TRUE(HasFunctionType(second_check, kFunctionTypeNodeManagementUseCaseData));
+  EXPECT_TRUE(HasFunctionType(second_check, kFunctionTypeLoadControlLimitDescriptionListData));
+  EXPECT_TRUE(HasFunctionType(second_check, kFunctionTypeDeviceConfigurationKeyValueDescriptionListData));
+  EXPECT_FALSE(HasFunctionType(second_check, kFunctionTypeLoadControlLimitListData));
+
+  std::remove(GetCacheFilePath(kCsSki).c_str());
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    LoopbackTests,
+    LoopbackTests,
+    ::testing::Values(kMessageProtocolFormatTypeUTF8, kMessageProtocolFormatTypeCbor)
+);
@@ -0,0 +1,322 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/common/json.h"
+#include "src/spine/device/remote_device_cache.h"
+#include "src/spine/model/datagram.h"
+#include "src/spine/model/function_types.h"
+
+#include "tests/src/memory_leak.inc"
+
+namespace {
+
+constexpr char kSki[] = "a1b2c3d4e5f60718293a4b5c6d7e8f9012345678";
+
+constexpr char kDiscoveryReply[] = R"({"datagram":[{"header":[{"specificationVersion":"1.3.0"},)"
+                                   R"({"addressSource":[{"device":"d:_n:Test_123"},{"entity":[0]},{"feature":0}]},)"
+                                   R"({"addressDestination":[{"device":"d:_n:Local_1"},{"entity":[0]},{"feature":0}]},)"
+                                   R"({"msgCounter":7},{"msgCounterReference":1},{"cmdClassifier":"reply"}]},)"
+                                   R"({"payload":[{"cmd":[[{"nodeManagementDetailedDiscoveryData":[)"
+                                   R"({"specificationVersionList":[{"specificationVersion":["1.3.0"]}]},)"
+                                   R"({"deviceInformation":[{"description":[)"
+                                   R"({"deviceAddress":[{"device":"d:_n:Test_123"}]},)"
+                                   R"({"deviceType":"HeatGenerationSystem"},)"
+                                   R"({"networkFeatureSet":"smart"}]}]},)"
+                                   R"({"entityInformation":[[{"description":[)"
+                                   R"({"entityAddress":[{"device":"d:_n:Test_123"},{"entity":[0]}]},)"
+                                   R"({"entityType":"DeviceInformation"}]}]]},)"
+                                   R"({"featureInformation":[[{"description":[)"
+                                   R"({"featureAddress":[{"device":"d:_n:Test_123"},{"entity":[0]},{"feature":0}]},)"
+                                   R"({"featureType":"NodeManagement"},)"
+                                   R"({"role":"special"}]}]]}]}]]}]}]})";
+
+constexpr char kDescriptionReply[] = R"({"datagram":[{"header":[{"specificationVersion":"1.3.0"},)"
+                                     R"({"addressSource":[{"device":"d:_n:Test_123"},{"entity":[1]},{"feature":2}]},)"
+                                     R"({"addressDestination":[{"device":"d:_n:Local_1"},{"entity":[1]},)"
+                                     R"({"feature":3}]},)"
+                                     R"({"msgCounter":8},{"msgCounterReference":2},{"cmdClassifier":"reply"}]},)"
+                                     R"({"payload":[{"cmd":[[{"measurementDescriptionListData":[)"
+                                     R"({"measurementDescriptionData":[[{"measurementId":0},)"
+                                     R"({"measurementType":"power"},{"commodityType":"electricity"}]]}]}]]}]}]})";
+
+constexpr char kChangedDescriptionReply[] = R"({"datagram":[{"header":[{"specificationVersion":"1.3.0"},)"
+                                            R"({"addressSource":[{"device":"d:_n:Test_123"},{"entity":[1]},)"
+                                            R"({"feature":2}]},)"
+                                            R"({"addressDestination":[{"device":"d:_n:Local_1"},{"entity":[1]},)"
+                                            R"({"feature":3}]},)"
+                                            R"({"msgCounter":9},{"msgCounterReference":3},{"cmdClassifier":"reply"}]},)"
+                                            R"({"payload":[{"cmd":[[{"measurementDescriptionListData":[)"
+                                            R"({"measurementDescriptionData":[[{"measurementId":0},)"
+                                            R"({"measurementType":"current"}]]}]}]]}]}]})";
+
+constexpr char kMeasurementReply[] = R"({"datagram":[{"header":[{"specificationVersion":"1.3.0"},)"
+                                     R"({"addressSource":[{"device":"d:_n:Test_123"},{"entity":[1]},{"feature":2}]},)"
+                                     R"({"addressDestination":[{"device":"d:_n:Local_1"},{"entity":[1]},)"
+                                     R"({"feature":3}]},)"
+                                     R"({"msgCounter":10},{"msgCounterReference":4},{"cmdClassifier":"reply"}]},)"
+                                     R"({"payload":[{"cmd":[[{"measurementListData":[)"
+                                     R"({"measurementData":[[{"measurementId":0},{"value":[{"number":5}]}]]}]}]]}]}]})";
+
+using RemoteDeviceCachePtr = std::unique_ptr<RemoteDeviceCacheObject, decltype(&RemoteDeviceCacheDelete)>;
+
+RemoteDeviceCachePtr CreateCache() {
+  return RemoteDeviceCachePtr{RemoteDeviceCacheCreate(testing::TempDir().c_str()), &RemoteDeviceCacheDelete};
+}
+
+std::string GetFilePath() { return testing::TempDir() + "/" + kSki + ".json"; }
+
+bool IsFileExisting(const std::string& path) {
+  FILE* const fp = fopen(path.c_str(), "rb");
+  if (fp == nullptr) {
+    return false;
+  }
+
+  fclose(fp);
+  return true;
+}
+
+EebusError Save(RemoteDeviceCacheObject* cache, const char* ski, const char* msg) {
+  DatagramType* const datagram = DatagramParse(msg);
+  EXPECT_NE(datagram, nullptr) << "Failed to parse the test datagram";
+  if (datagram == nullptr) {
+    return kEebusErrorParse;
+  }
+
+  const EebusError err = REMOTE_DEVICE_CACHE_SAVE(cache, ski, datagram->header, datagram->payload->cmd[0]);
+  DatagramDelete(datagram);
+  return err;
+}
+
+struct RestoreRecord {
+  FunctionType function_type;
+  std::string msg;
+};
+
+struct RestoreContext {
+  std::vector<RestoreRecord> records;
+  FunctionType dropped_function_type = kFunctionTypeNum;
+};
+
+bool CollectDatagram(const DatagramType* datagram, void* ctx) {
+  RestoreContext* const restore_ctx = static_cast<RestoreContext*>(ctx);
+
+  char* const s = DatagramPrintUnformatted(datagram);
+  EXPECT_NE(s, nullptr);
+
+  const FunctionType function_type = datagram->payload->cmd[0]->data_choice_type_id;
+  restore_ctx->records.push_back({function_type, (s != nullptr) ? s : ""});
+  JsonFree(s);
+
+  return function_type != restore_ctx->dropped_function_type;
+}
+
+RestoreContext Restore(RemoteDeviceCacheObject* cache, FunctionType dropped_function_type = kFunctionTypeNum) {
+  RestoreContext ctx;
+  ctx.dropped_function_type = dropped_function_type;
+  REMOTE_DEVICE_CACHE_RESTORE(cache, kSki, CollectDatagram, &ctx);
+  return ctx;
+}
+
+std::vector<FunctionType> GetFunctionTypes(const RestoreContext& ctx) {
+  std::vector<FunctionType> function_types;
+  for (const RestoreRecord& record : ctx.records) {
+    function_types.push_back(record.function_type);
+  }
+
+  return function_types;
+}
+
+}  // namespace
+
+class RemoteDeviceCacheTests : public ::testing::Test {
+ protected:
+  void SetUp() override { std::remove(GetFilePath().c_str()); }
+
+  void TearDown() override {
+    std::remove(GetFilePath().c_str());
+
+    EXPECT_EQ(heap_used, 0);
+    CheckForMemoryLeaks();
+  }
+};
+
+TEST_F(RemoteDeviceCacheTests, RemoteDeviceCacheTestSaveRestoreRemove) {
+  EXPECT_EQ(RemoteDeviceCacheCreate(""), nullptr);
+
+  RemoteDeviceCachePtr cache = CreateCache();
+  ASSERT_NE(cache, nullptr) << "Failed to create RemoteDeviceCache";
+
+  // Nothing is known about the remote device yet
+  EXPECT_TRUE(Restore(cache.get()).records.empty());
+
+  EXPECT_EQ(Save(cache.get(), kSki, kDescriptionReply), kEebusErrorOk);
+  EXPECT_EQ(Save(cache.get(), kSki, kDiscoveryReply), kEebusErrorOk);
+  EXPECT_EQ(Save(cache.get(), "", kDiscoveryReply), kEebusErrorInputArgument);
+
+  // The same reply again is not a change, the varying data is not cached at all
+  EXPECT_EQ(Save(cache.get(), kSki, kDiscoveryReply), kEebusErrorNoChange);
+  EXPECT_EQ(Save(cache.get(), kSki, kMeasurementReply), kEebusErrorNoChange);
+
+  // The detailed discovery goes first, the features of the other replies are known after it only
+  const RestoreContext ctx = Restore(cache.get());
+  EXPECT_EQ(
+      GetFunctionTypes(ctx),
+      (std::vector<FunctionType>{
+          kFunctionTypeNodeManagementDetailedDiscoveryData,
+          kFunctionTypeMeasurementDescriptionListData
+      })
+  );
+
+  // The message counters are not kept
+  for (const RestoreRecord& record : ctx.records) {
+    EXPECT_EQ(record.msg.find("msgCounter"), std::string::npos);
+  }
+
+  // Nothing is written until the flush
+  EXPECT_FALSE(IsFileExisting(GetFilePath()));
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_FLUSH(cache.get()), kEebusErrorOk);
+  EXPECT_TRUE(IsFileExisting(GetFilePath()));
+  EXPECT_FALSE(IsFileExisting(GetFilePath() + ".tmp"));
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_FLUSH(cache.get()), kEebusErrorNoChange);
+
+  REMOTE_DEVICE_CACHE_REMOVE(cache.get(), kSki);
+  EXPECT_FALSE(IsFileExisting(GetFilePath()));
+  EXPECT_TRUE(Restore(cache.get()).records.empty());
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_FLUSH(cache.get()), kEebusErrorNoChange);
+}
+
+TEST_F(RemoteDeviceCacheTests, RemoteDeviceCacheTestReload) {
+  RemoteDeviceCachePtr cache = CreateCache();
+  ASSERT_NE(cache, nullptr);
+
+  EXPECT_EQ(Save(cache.get(), kSki, kDiscoveryReply), kEebusErrorOk);
+  EXPECT_EQ(Save(cache.get(), kSki, kDescriptionReply), kEebusErrorOk);
+  const RestoreContext saved_ctx = Restore(cache.get());
+
+  // The pending changes are written out on release
+  cache.reset();
+  EXPECT_TRUE(IsFileExisting(GetFilePath()));
+
+  cache = CreateCache();
+  ASSERT_NE(cache, nullptr);
+
+  const RestoreContext loaded_ctx = Restore(cache.get());
+  ASSERT_EQ(loaded_ctx.records.size(), saved_ctx.records.size());
+  for (size_t i = 0; i < saved_ctx.records.size(); ++i) {
+    EXPECT_EQ(loaded_ctx.records[i].function_type, saved_ctx.records[i].function_type);
+    EXPECT_EQ(loaded_ctx.records[i].msg, saved_ctx.records[i].msg);
+  }
+
+  // The reply received again on reconnection does not rewrite the file
+  EXPECT_EQ(Save(cache.get(), kSki, kDiscoveryReply), kEebusErrorNoChange);
+  EXPECT_EQ(Save(cache.get(), kSki, kDescriptionReply), kEebusErrorNoChange);
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_FLUSH(cache.get()), kEebusErrorNoChange);
+
+  // The changed one replaces the previous reply of the same remote feature and function
+  EXPECT_EQ(Save(cache.get(), kSki, kChangedDescriptionReply), kEebusErrorOk);
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_FLUSH(cache.get()), kEebusErrorOk);
+
+  const RestoreContext changed_ctx = Restore(cache.get());
+  ASSERT_EQ(changed_ctx.records.size(), 2);
+  EXPECT_NE(changed_ctx.records[1].msg.find("current"), std::string::npos);
+  EXPECT_EQ(changed_ctx.records[1].msg.find("power"), std::string::npos);
+}
+
+TEST_F(RemoteDeviceCacheTests, RemoteDeviceCacheTestDropRejected) {
+  RemoteDeviceCachePtr cache = CreateCache();
+  ASSERT_NE(cache, nullptr);
+
+  EXPECT_EQ(Save(cache.get(), kSki, kDiscoveryReply), kEebusErrorOk);
+  EXPECT_EQ(Save(cache.get(), kSki, kDescriptionReply), kEebusErrorOk);
+
+  // The reply which can not be applied anymore is dropped
+  EXPECT_EQ(Restore(cache.get(), kFunctionTypeMeasurementDescriptionListData).records.size(), 2);
+  EXPECT_EQ(
+      GetFunctionTypes(Restore(cache.get())),
+      std::vector<FunctionType>{kFunctionTypeNodeManagementDetailedDiscoveryData}
+  );
+
+  // The broken lines of the file are dropped as well
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_FLUSH(cache.get()), kEebusErrorOk);
+  cache.reset();
+
+  FILE* const fp = fopen(GetFilePath().c_str(), "ab");
+  ASSERT_NE(fp, nullptr);
+  fputs("{\"datagram\":[broken\n", fp);
+  fclose(fp);
+
+  cache = CreateCache();
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(
+      GetFunctionTypes(Restore(cache.get())),
+      std::vector<FunctionType>{kFunctionTypeNodeManagementDetailedDiscoveryData}
+  );
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_FLUSH(cache.get()), kEebusErrorOk);
+}
+
+TEST_F(RemoteDeviceCacheTests, RemoteDeviceCacheTestSnapshot) {
+  RemoteDeviceCachePtr cache = CreateCache();
+  ASSERT_NE(cache, nullptr);
+
+  std::unique_ptr<RemoteDeviceCacheSnapshot, decltype(&RemoteDeviceCacheSnapshotDelete)> snapshot{
+      RemoteDeviceCacheSnapshotCreate(),
+      &RemoteDeviceCacheSnapshotDelete
+  };
+  ASSERT_NE(snapshot, nullptr);
+
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_TAKE_SNAPSHOT(cache.get(), nullptr), kEebusErrorInputArgumentNull);
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_TAKE_SNAPSHOT(cache.get(), snapshot.get()), kEebusErrorNoChange);
+  EXPECT_EQ(RemoteDeviceCacheSnapshotWrite(snapshot.get()), kEebusErrorNoChange);
+
+  EXPECT_EQ(Save(cache.get(), kSki, kDiscoveryReply), kEebusErrorOk);
+  EXPECT_EQ(Save(cache.get(), kSki, kDescriptionReply), kEebusErrorOk);
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_TAKE_SNAPSHOT(cache.get(), snapshot.get()), kEebusErrorOk);
+
+  // The newer content replaces the one not written yet
+  EXPECT_EQ(Save(cache.get(), kSki, kChangedDescriptionReply), kEebusErrorOk);
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_TAKE_SNAPSHOT(cache.get(), snapshot.get()), kEebusErrorOk);
+
+  // Nothing is written until the snapshot write, the changes are not pending in the cache anymore
+  EXPECT_FALSE(IsFileExisting(GetFilePath()));
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_FLUSH(cache.get()), kEebusErrorNoChange);
+  EXPECT_FALSE(IsFileExisting(GetFilePath()));
+
+  EXPECT_EQ(RemoteDeviceCacheSnapshotWrite(snapshot.get()), kEebusErrorOk);
+  EXPECT_TRUE(IsFileExisting(GetFilePath()));
+  EXPECT_FALSE(IsFileExisting(GetFilePath() + ".tmp"));
+  EXPECT_EQ(RemoteDeviceCacheSnapshotWrite(snapshot.get()), kEebusErrorNoChange);
+
+  cache = CreateCache();
+  ASSERT_NE(cache, nullptr);
+
+  const RestoreContext loaded_ctx = Restore(cache.get());
+  ASSERT_EQ(loaded_ctx.records.size(), 2);
+  EXPECT_NE(loaded_ctx.records[1].msg.find("current"), std::string::npos);
+
+  // The file of the remote device with all the replies dropped is removed
+  EXPECT_EQ(Restore(cache.get(), kFunctionTypeNodeManagementDetailedDiscoveryData).records.size(), 2);
+  EXPECT_EQ(Restore(cache.get(), kFunctionTypeMeasurementDescriptionListData).records.size(), 1);
+  EXPECT_EQ(REMOTE_DEVICE_CACHE_TAKE_SNAPSHOT(cache.get(), snapshot.get()), kEebusErrorOk);
+  EXPECT_TRUE(IsFileExisting(GetFilePath()));
+  EXPECT_EQ(RemoteDeviceCacheSnapshotWrite(snapshot.get()), kEebusErrorOk);
+  EXPECT_FALSE(IsFileExisting(GetFilePath()));
+}
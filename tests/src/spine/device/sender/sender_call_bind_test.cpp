@@ -50,7 +50,7 @@ TEST_P(SenderCallBindTests, SenderCallBindTests) {
   SenderObject* sender = GetSender();
   SenderSetMsgCounter(sender, GetParam().msg_cnt);
 
-  ExpectMessageWrite(GetParam().msg);
+  ExpectMessageWrite(GetParam().msg, kMessagePriorityData);
 
   // Act: Run the CallBind()
   const EebusError ret = SEND_CALL_BIND(sender, sender_addr.get(), dest_addr.get(), GetParam().server_feature_type);
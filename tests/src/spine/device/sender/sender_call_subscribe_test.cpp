@@ -54,7 +54,7 @@ TEST_P(SenderCallSubscribeTests, SenderCallSubscribeTests) {
   SenderObject* sender = GetSender();
   SenderSetMsgCounter(sender, GetParam().msg_cnt);
 
-  ExpectMessageWrite(GetParam().msg);
+  ExpectMessageWrite(GetParam().msg, kMessagePriorityData);
 
   // Act: Run the CallSubscribe()
   const EebusError ret
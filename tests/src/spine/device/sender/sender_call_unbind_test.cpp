@@ -52,7 +52,7 @@ TEST_P(SenderCallUnbindTests, SenderCallUnbindTests) {
   SenderObject* sender = GetSender();
   SenderSetMsgCounter(sender, GetParam().msg_cnt);
 
-  ExpectMessageWrite(GetParam().msg);
+  ExpectMessageWrite(GetParam().msg, kMessagePriorityData);
 
   // Act: Run the CallUnbind()
   const EebusError ret = SEND_CALL_UNBIND(sender, sender_addr.get(), dest_addr.get());
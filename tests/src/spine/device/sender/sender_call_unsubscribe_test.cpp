@@ -52,7 +52,7 @@ TEST_P(SenderCallUnsubscribeTests, SenderCallUnsubscribeTests) {
   SenderObject* sender = GetSender();
   SenderSetMsgCounter(sender, GetParam().msg_cnt);
 
-  ExpectMessageWrite(GetParam().msg);
+  ExpectMessageWrite(GetParam().msg, kMessagePriorityData);
 
   // Act: Run the CallUnsubscribe()
   const EebusError ret = SEND_CALL_UNSUBSCRIBE(sender, sender_addr.get(), dest_addr.get());
@@ -34,6 +34,7 @@ struct SenderNotifyTestInput {
   ValuePtr<FeatureAddressTestData> dest_addr   = nullptr;
   FunctionType data_type_id                    = static_cast<FunctionType>(0);
   uint64_t msg_cnt                             = 0;
+  MessagePriority priority                     = kMessagePriorityData;
   std::string_view msg                         = ""sv;
 };
 
@@ -64,7 +65,7 @@ TEST_P(SenderNotifyTests, SenderNotifyTests) {
   SenderObject* sender = GetSender();
   SenderSetMsgCounter(sender, GetParam().msg_cnt);
 
-  ExpectMessageWrite(GetParam().msg);
+  ExpectMessageWrite(GetParam().msg, GetParam().priority);
 
   // Act: Run the Notify()
   const EebusError ret = SEND_NOTIFY(sender, sender_addr.get(), dest_addr.get(), &cmd);
@@ -135,6 +136,36 @@ INSTANTIATE_TEST_SUITE_P(
                                 ]}
                               ]}
                             ]})"sv,
+        },
+        SenderNotifyTestInput{
+            .description  = "Test Device Diagnosis Heartbeat Data notify (sent ahead of the other notifies)"sv,
+            .sender_addr  = FEATURE_ADDRESS_TEST_DATA("d:_i:Demo_EVSE-234567890", {0}, 3),
+            .dest_addr    = FEATURE_ADDRESS_TEST_DATA("d:_i:36013_3019197057", {0}, 4),
+            .data_type_id = kFunctionTypeDeviceDiagnosisHeartbeatData,
+            .msg_cnt      = 2,
+            .priority     = kMessagePriorityResult,
+            .msg          = R"({"datagram":[
+                              {"header":[
+                                {"specificationVersion":"1.3.0"},
+                                {"addressSource":[
+                                  {"device":"d:_i:Demo_EVSE-234567890"},
+                                  {"entity":[0]},
+                                  {"feature":3}
+                                ]},
+                                {"addressDestination":[
+                                  {"device":"d:_i:36013_3019197057"},
+                                  {"entity":[0]},
+                                  {"feature":4}
+                                ]},
+                                {"msgCounter":3},
+                                {"cmdClassifier":"notify"}
+                              ]},
+                              {"payload":[
+                                {"cmd":[
+                                  [{"deviceDiagnosisHeartbeatData":[]}]
+                                ]}
+                              ]}
+                            ]})"sv,
         }
     )
 );
@@ -64,14 +64,16 @@ TEST_P(SenderReadTests, SenderReadTests) {
   SenderObject* sender = GetSender();
   SenderSetMsgCounter(sender, GetParam().msg_cnt);
 
-  ExpectMessageWrite(GetParam().msg);
+  ExpectMessageWrite(GetParam().msg, kMessagePriorityData);
 
   // Act: Run the Read()
-  const EebusError ret = SEND_READ(sender, sender_addr.get(), dest_addr.get(), &cmd);
+  MsgCounterType msg_cnt = 0;
+  const EebusError ret   = SEND_READ(sender, sender_addr.get(), dest_addr.get(), &cmd, &msg_cnt);
 
   // Assert: Verify with expected return value,
   // Note: output message checks are done within mock expectation call
   EXPECT_EQ(ret, kEebusErrorOk);
+  EXPECT_EQ(msg_cnt, GetParam().msg_cnt + 1);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -164,3 +166,93 @@ INSTANTIATE_TEST_SUITE_P(
         }
     )
 );
+
+TEST_F(SenderTestSuite, SenderReadBusyTest) {
+  // Arrange: Connection with no write credit left
+  std::unique_ptr<FeatureAddressType, decltype(&FeatureAddressDelete)> sender_addr{
+      TestDataToFeatureAddress(FEATURE_ADDRESS_TEST_DATA("d:_i:Demo_EVSE-234567890", {0}, 0).get()),
+      FeatureAddressDelete
+  };
+  std::unique_ptr<FeatureAddressType, decltype(&FeatureAddressDelete)> dest_addr{
+      TestDataToFeatureAddress(FEATURE_ADDRESS_TEST_DATA(nullptr, {0}, 0).get()),
+      FeatureAddressDelete
+  };
+
+  std::unique_ptr<void, std::function<void(void*)>> spine_data{
+      ModelFunctionDataCreateEmpty(kFunctionTypeNodeManagementDetailedDiscoveryData),
+      [](void* p) -> void { ModelFunctionDataDelete(kFunctionTypeNodeManagementDetailedDiscoveryData, p); }
+  };
+
+  ASSERT_NE(spine_data, nullptr);
+
+  CmdType cmd = {
+      .data_choice         = spine_data.get(),
+      .data_choice_type_id = kFunctionTypeNodeManagementDetailedDiscoveryData,
+  };
+
+  ExpectMessageWriteBusy();
+
+  // Act: Run the Read()
+  MsgCounterType msg_cnt = 0;
+  const EebusError ret   = SEND_READ(GetSender(), sender_addr.get(), dest_addr.get(), &cmd, &msg_cnt);
+
+  // Assert: Busy connection is reported to the caller, no message counter is returned
+  EXPECT_EQ(ret, kEebusErrorCommunicationBusy);
+  EXPECT_EQ(msg_cnt, 0);
+}
+
+TEST_F(SenderTestSuite, SenderReadCborTest) {
+  // Arrange: Connection with CBOR agreed on the SHIP handshake
+  std::unique_ptr<FeatureAddressType, decltype(&FeatureAddressDelete)> sender_addr{
+      TestDataToFeatureAddress(FEATURE_ADDRESS_TEST_DATA("d:_i:Demo_EVSE-234567890", {0}, 0).get()),
+      FeatureAddressDelete
+  };
+  std::unique_ptr<FeatureAddressType, decltype(&FeatureAddressDelete)> dest_addr{
+      TestDataToFeatureAddress(FEATURE_ADDRESS_TEST_DATA(nullptr, {0}, 0).get()),
+      FeatureAddressDelete
+  };
+
+  std::unique_ptr<void, std::function<void(void*)>> spine_data{
+      ModelFunctionDataCreateEmpty(kFunctionTypeNodeManagementUseCaseData),
+      [](void* p) -> void { ModelFunctionDataDelete(kFunctionTypeNodeManagementUseCaseData, p); }
+  };
+
+  ASSERT_NE(spine_data, nullptr);
+
+  CmdType cmd = {
+      .data_choice         = spine_data.get(),
+      .data_choice_type_id = kFunctionTypeNodeManagementUseCaseData,
+  };
+
+  static constexpr std::string_view kMsg = R"({"datagram":[
+                                                {"header":[
+                                                  {"specificationVersion":"1.3.0"},
+                                                  {"addressSource":[
+                                                    {"device":"d:_i:Demo_EVSE-234567890"},
+                                                    {"entity":[0]},
+                                                    {"feature":0}
+                                                  ]},
+                                                  {"addressDestination":[
+                                                    {"entity":[0]},
+                                                    {"feature":0}
+                                                  ]},
+                                                  {"msgCounter":1},
+                                                  {"cmdClassifier":"read"}
+                                                ]},
+                                                {"payload":[
+                                                  {"cmd":[
+                                                    [{"nodeManagementUseCaseData":[]}]
+                                                  ]}
+                                                ]}
+                                              ]})"sv;
+
+  ExpectCborMessageWrite(kMsg, kMessagePriorityData);
+
+  // Act: Run the Read()
+  MsgCounterType msg_cnt = 0;
+  const EebusError ret   = SEND_READ(GetSender(), sender_addr.get(), dest_addr.get(), &cmd, &msg_cnt);
+
+  // Assert: Message is encoded with CBOR, the content checks are done within mock expectation call
+  EXPECT_EQ(ret, kEebusErrorOk);
+  EXPECT_EQ(msg_cnt, 1);
+}
@@ -70,7 +70,7 @@ TEST_P(SenderReplyTests, SenderReplyTests) {
   SenderObject* sender = GetSender();
   SenderSetMsgCounter(sender, GetParam().msg_cnt);
 
-  ExpectMessageWrite(GetParam().msg);
+  ExpectMessageWrite(GetParam().msg, kMessagePriorityData);
 
   // Act: Run the Reply()
   const EebusError ret = SEND_REPLY(sender, &header, sender_addr.get(), &cmd);
@@ -71,7 +71,7 @@ TEST_P(SenderResultErrorTests, SenderResultErrorTests) {
   SenderObject* sender = GetSender();
   SenderSetMsgCounter(sender, GetParam().msg_cnt);
 
-  ExpectMessageWrite(GetParam().msg);
+  ExpectMessageWrite(GetParam().msg, kMessagePriorityResult);
 
   // Act: Run the ResultError()
   const EebusError ret = SEND_RESULT_ERROR(sender, &header, sender_addr.get(), &err);
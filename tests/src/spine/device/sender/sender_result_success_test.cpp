@@ -63,7 +63,7 @@ TEST_P(SenderResultSuccessTests, SenderResultSuccessTests) {
   SenderObject* sender = GetSender();
   SenderSetMsgCounter(sender, GetParam().msg_cnt);
 
-  ExpectMessageWrite(GetParam().msg);
+  ExpectMessageWrite(GetParam().msg, kMessagePriorityResult);
 
   // Act: Run the ResultSuccess()
   const EebusError ret = SEND_RESULT_SUCCESS(sender, &header, sender_addr.get());
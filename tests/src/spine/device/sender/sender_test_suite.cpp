@@ -25,6 +25,7 @@
 
 using testing::_;
 using testing::Invoke;
+using testing::Return;
 using testing::WithArgs;
 
 std::unique_ptr<DataWriterMock, decltype(&DataWriterMockDelete)> SenderTestSuite::writer_mock_{nullptr, nullptr};
@@ -33,18 +34,40 @@ std::unique_ptr<SenderObject, decltype(&SenderDelete)> SenderTestSuite::sender_{
 void SenderTestSuite::SetUp() {
   writer_mock_ = decltype(writer_mock_){DataWriterMockCreate(), DataWriterMockDelete};
   sender_      = decltype(sender_){SenderCreate(DATA_WRITER_OBJECT(writer_mock_.get())), SenderDelete};
+
+  EXPECT_CALL(*writer_mock_->gmock, GetFormat(_)).WillRepeatedly(Return(kMessageProtocolFormatTypeUTF8));
 }
 
-void SenderTestSuite::ExpectMessageWrite(const std::string_view& msg_expected) {
-  EXPECT_CALL(*writer_mock_->gmock, WriteMessage(_, _, _))
+void SenderTestSuite::ExpectMessageWrite(const std::string_view& msg_expected, MessagePriority priority) {
+  EXPECT_CALL(*writer_mock_->gmock, WriteMessage(_, _, _, priority))
       .WillOnce(WithArgs<1, 2>(Invoke([&msg_expected](const uint8_t* msg, size_t msg_size) {
         std::unique_ptr<char[], decltype(&JsonFree)> s{JsonUnformat(msg_expected), JsonFree};
         EXPECT_STREQ(s.get(), reinterpret_cast<const char*>(msg));
         const size_t msg_size_expected = (s != nullptr) ? strlen(s.get()) + 1 : 0;
         EXPECT_EQ(msg_size, msg_size_expected);
+        return kEebusErrorOk;
       })));
 }
 
+void SenderTestSuite::ExpectCborMessageWrite(const std::string_view& msg_expected, MessagePriority priority) {
+  EXPECT_CALL(*writer_mock_->gmock, GetFormat(_)).WillRepeatedly(Return(kMessageProtocolFormatTypeCbor));
+  EXPECT_CALL(*writer_mock_->gmock, WriteMessage(_, _, _, priority))
+      .WillOnce(WithArgs<1, 2>(Invoke([&msg_expected](const uint8_t* msg, size_t msg_size) {
+        std::unique_ptr<JsonObject, decltype(&JsonDelete)> json{JsonParseCbor(msg, msg_size), JsonDelete};
+        EXPECT_NE(json, nullptr);
+        std::unique_ptr<char[], decltype(&JsonFree)> s{JsonPrintUnformatted(json.get()), JsonFree};
+        std::unique_ptr<char[], decltype(&JsonFree)> s_expected{JsonUnformat(msg_expected), JsonFree};
+        EXPECT_STREQ(s.get(), s_expected.get());
+        // The binary encoding has to pay off
+        EXPECT_LT(msg_size, strlen(s_expected.get()));
+        return kEebusErrorOk;
+      })));
+}
+
+void SenderTestSuite::ExpectMessageWriteBusy() {
+  EXPECT_CALL(*writer_mock_->gmock, WriteMessage(_, _, _, _)).WillOnce(Return(kEebusErrorCommunicationBusy));
+}
+
 void SenderTestSuite::TearDown() {
   EXPECT_CALL(*writer_mock_->gmock, Destruct(DATA_WRITER_OBJECT(writer_mock_.get())));
   SenderTestSuite::sender_.reset();
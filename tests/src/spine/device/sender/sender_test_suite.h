@@ -36,7 +36,9 @@ class SenderTestSuite : public testing::Test {
   static inline SenderObject* GetSender() { return sender_.get(); }
 
  protected:
-  static void ExpectMessageWrite(const std::string_view& msg);
+  static void ExpectMessageWrite(const std::string_view& msg, MessagePriority priority);
+  static void ExpectCborMessageWrite(const std::string_view& msg, MessagePriority priority);
+  static void ExpectMessageWriteBusy();
 
  private:
   static std::unique_ptr<DataWriterMock, decltype(&DataWriterMockDelete)> writer_mock_;
@@ -64,14 +64,16 @@ TEST_P(SenderWriteTests, SenderWriteTests) {
   SenderObject* sender = GetSender();
   SenderSetMsgCounter(sender, GetParam().msg_cnt);
 
-  ExpectMessageWrite(GetParam().msg);
+  ExpectMessageWrite(GetParam().msg, kMessagePriorityData);
 
   // Act: Run the Write()
-  const EebusError ret = SEND_WRITE(sender, sender_addr.get(), dest_addr.get(), &cmd);
+  MsgCounterType msg_cnt = 0;
+  const EebusError ret   = SEND_WRITE(sender, sender_addr.get(), dest_addr.get(), &cmd, &msg_cnt);
 
   // Assert: Verify with expected return value,
   // Note: output message checks are done within mock expectation call
   EXPECT_EQ(ret, kEebusErrorOk);
+  EXPECT_EQ(msg_cnt, GetParam().msg_cnt + 1);
 }
 
 INSTANTIATE_TEST_SUITE_P(
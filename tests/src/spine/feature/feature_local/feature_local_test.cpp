@@ -0,0 +1,260 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "mocks/common/eebus_timer/eebus_timer_mock.h"
+#include "mocks/ship/ship_connection/data_writer_mock.h"
+#include "src/common/array_util.h"
+#include "src/common/eebus_timer/eebus_timer.h"
+#include "src/spine/device/device_local.h"
+#include "src/spine/entity/entity_local.h"
+#include "src/spine/feature/feature.h"
+#include "src/spine/feature/pending_requests.h"
+#include "src/spine/model/cmd.h"
+#include "src/spine/model/result_types.h"
+#include "src/spine/model/specification_version.h"
+#include "src/spine/node_management/node_management_internal.h"
+#include "tests/src/memory_leak.inc"
+
+using testing::_;
+using testing::Return;
+
+namespace {
+
+struct ResponseRecord {
+  DeviceRemoteObject* device_remote;
+  MsgCounterType msg_cnt_ref;
+  bool is_timeout;
+};
+
+void CollectResponse(const ResponseMessage* response_msg, void* ctx) {
+  bool is_timeout = false;
+  if (response_msg->function_type == kFunctionTypeResultData) {
+    const ResultDataType* const result_data = static_cast<const ResultDataType*>(response_msg->function_data);
+    is_timeout = (result_data->error_number != nullptr) && (*result_data->error_number == kErrorNumberTypeTimeout);
+  }
+
+  static_cast<std::vector<ResponseRecord>*>(ctx)->push_back(
+      {response_msg->device_remote, response_msg->msg_cnt_ref, is_timeout}
+  );
+}
+
+bool IsDetailedDiscoveryDataCached(NodeManagementObject* node_management) {
+  return NODE_MANAGEMENT(node_management)->detailed_discovery_data != nullptr;
+}
+
+void CacheDetailedDiscoveryData(NodeManagementObject* node_management) {
+  NodeManagementInvalidateDetailedDiscoveryData(node_management);
+  NODE_MANAGEMENT(node_management)->detailed_discovery_data
+      = NodeManagementDetailedDiscoveryDataCreate((const SpecificationVersionType*)&specification_version, 1);
+}
+
+}  // namespace
+
+EebusTimerObject* EebusTimerCreate(EebusTimerTimeoutCallback cb, void* ctx) {
+  return EEBUS_TIMER_OBJECT(EebusTimerMockCreate());
+}
+
+void FeatureLocalTestResponseTimeoutInternal() {
+  const EebusDeviceInfo device_info = {
+      .type       = "EnergyManagementSystem",
+      .vendor     = "Demo",
+      .brand      = "Demo",
+      .model      = "HEMS",
+      .serial_num = "123456789",
+      .ship_id    = "Demo",
+      .address    = "d:_n:OpenEEBUS_123456789",
+  };
+
+  static constexpr NetworkManagementFeatureSetType feature_set = kNetworkManagementFeatureSetTypeSmart;
+
+  // The remote devices number their messages independently, so both use the same message counter
+  static constexpr MsgCounterType msg_cnt = 100;
+
+  std::unique_ptr<DataWriterMock, decltype(&DataWriterMockDelete)> data_writer_mock{
+      DataWriterMockCreate(),
+      DataWriterMockDelete
+  };
+  std::unique_ptr<DeviceLocalObject, decltype(&DeviceLocalDelete)> device_local{
+      DeviceLocalCreate(&device_info, &feature_set),
+      DeviceLocalDelete
+  };
+
+  uint32_t entity_ids[1] = {static_cast<uint32_t>(VectorGetSize(DEVICE_LOCAL_GET_ENTITIES(device_local.get())))};
+
+  EntityLocalObject* const entity
+      = EntityLocalCreate(device_local.get(), kEntityTypeTypeCEM, entity_ids, ARRAY_SIZE(entity_ids), 4);
+  FeatureLocalObject* const feature
+      = ENTITY_LOCAL_ADD_FEATURE_WITH_TYPE_AND_ROLE(entity, kFeatureTypeTypeMeasurement, kRoleTypeClient);
+  DEVICE_LOCAL_ADD_ENTITY(device_local.get(), entity);
+
+  EXPECT_CALL(*data_writer_mock->gmock, WriteMessage(_, _, _, _)).WillRepeatedly(Return(kEebusErrorOk));
+  DEVICE_LOCAL_SETUP_REMOTE_DEVICE(device_local.get(), "1111", DATA_WRITER_OBJECT(data_writer_mock.get()));
+  DEVICE_LOCAL_SETUP_REMOTE_DEVICE(device_local.get(), "2222", DATA_WRITER_OBJECT(data_writer_mock.get()));
+
+  DeviceRemoteObject* const device_a = DEVICE_LOCAL_GET_REMOTE_DEVICE_WITH_SKI(device_local.get(), "1111");
+  DeviceRemoteObject* const device_b = DEVICE_LOCAL_GET_REMOTE_DEVICE_WITH_SKI(device_local.get(), "2222");
+  ASSERT_NE(device_a, nullptr);
+  ASSERT_NE(device_b, nullptr);
+
+  std::vector<ResponseRecord> responses_a;
+  std::vector<ResponseRecord> responses_b;
+
+  EXPECT_EQ(
+      FEATURE_LOCAL_ADD_RESPONSE_CALLBACK(feature, device_a, msg_cnt, CollectResponse, &responses_a),
+      kEebusErrorOk
+  );
+  EXPECT_EQ(
+      FEATURE_LOCAL_ADD_RESPONSE_CALLBACK(feature, device_b, msg_cnt, CollectResponse, &responses_b),
+      kEebusErrorOk
+  );
+  EXPECT_EQ(
+      FEATURE_LOCAL_ADD_RESPONSE_CALLBACK(feature, device_b, msg_cnt, CollectResponse, &responses_b),
+      kEebusErrorNoChange
+  );
+
+  EXPECT_EQ(FEATURE_LOCAL_ADD_PENDING_REQUEST(feature, device_a, msg_cnt, 1000), kEebusErrorOk);
+  EXPECT_EQ(FEATURE_LOCAL_ADD_PENDING_REQUEST(feature, device_b, msg_cnt, 5000), kEebusErrorOk);
+
+  // The expired request of the first device must not consume the callback of the second one
+  PENDING_REQUESTS_TICK(DEVICE_REMOTE_GET_PENDING_REQUESTS(device_a), 1000);
+  ASSERT_EQ(responses_a.size(), 1);
+  EXPECT_EQ(responses_a[0].device_remote, device_a);
+  EXPECT_EQ(responses_a[0].msg_cnt_ref, msg_cnt);
+  EXPECT_TRUE(responses_a[0].is_timeout);
+  EXPECT_TRUE(responses_b.empty());
+
+  PENDING_REQUESTS_TICK(DEVICE_REMOTE_GET_PENDING_REQUESTS(device_b), 5000);
+  EXPECT_EQ(responses_a.size(), 1);
+  ASSERT_EQ(responses_b.size(), 1);
+  EXPECT_EQ(responses_b[0].device_remote, device_b);
+  EXPECT_EQ(responses_b[0].msg_cnt_ref, msg_cnt);
+  EXPECT_TRUE(responses_b[0].is_timeout);
+
+  // The callbacks are released once invoked
+  PENDING_REQUESTS_TICK(DEVICE_REMOTE_GET_PENDING_REQUESTS(device_a), 10000);
+  PENDING_REQUESTS_TICK(DEVICE_REMOTE_GET_PENDING_REQUESTS(device_b), 10000);
+  EXPECT_EQ(responses_a.size(), 1);
+  EXPECT_EQ(responses_b.size(), 1);
+
+  // The read sent already is not reported as failed if there is no pending requests slot left for it
+  constexpr size_t pending_requests_capacity = PENDING_REQUESTS_MAX_NUM_DEFAULT + PENDING_REQUESTS_RESERVED_NUM;
+  for (size_t i = 1; i <= pending_requests_capacity; ++i) {
+    EXPECT_EQ(FEATURE_LOCAL_ADD_PENDING_REQUEST(feature, device_a, msg_cnt + i, 1000), kEebusErrorOk);
+  }
+
+  EXPECT_NE(FEATURE_LOCAL_ADD_PENDING_REQUEST(feature, device_a, msg_cnt, 1000), kEebusErrorOk);
+
+  FunctionObject* const function = FeatureGetFunction(FEATURE(feature), kFunctionTypeMeasurementListData);
+  ASSERT_NE(function, nullptr);
+
+  const CmdType* const cmd = FUNCTION_CREATE_READ_CMD(function, nullptr);
+  ASSERT_NE(cmd, nullptr);
+
+  static constexpr uint32_t remote_entity_id = 1;
+
+  static constexpr const uint32_t* const remote_entity_ids[] = {&remote_entity_id};
+
+  static constexpr uint32_t remote_feature_id = 2;
+
+  const FeatureAddressType remote_feature_addr = {
+      .device      = "d:_n:Remote_1111",
+      .entity      = remote_entity_ids,
+      .entity_size = ARRAY_SIZE(remote_entity_ids),
+      .feature     = &remote_feature_id,
+  };
+
+  EXPECT_CALL(*data_writer_mock->gmock, WriteMessage(_, _, _, _)).WillOnce(Return(kEebusErrorOk));
+  EXPECT_EQ(
+      FEATURE_LOCAL_REQUEST_REMOTE_DATA_BY_SENDER_ADDRESS(
+          feature,
+          cmd,
+          DEVICE_REMOTE_GET_SENDER(device_a),
+          "1111",
+          &remote_feature_addr,
+          1000
+      ),
+      kEebusErrorOk
+  );
+  CmdDelete((CmdType*)cmd);
+
+  EXPECT_CALL(*data_writer_mock->gmock, Destruct(_)).WillOnce(Return());
+}
+
+TEST(FeatureLocalTest, FeatureLocalTestResponseTimeoutPerRemoteDevice) {
+  FeatureLocalTestResponseTimeoutInternal();
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+void FeatureLocalTestDetailedDiscoveryInvalidationInternal() {
+  const EebusDeviceInfo device_info = {
+      .type       = "EnergyManagementSystem",
+      .vendor     = "Demo",
+      .brand      = "Demo",
+      .model      = "HEMS",
+      .serial_num = "123456789",
+      .ship_id    = "Demo",
+      .address    = "d:_n:OpenEEBUS_123456789",
+  };
+
+  static constexpr NetworkManagementFeatureSetType feature_set = kNetworkManagementFeatureSetTypeSmart;
+
+  std::unique_ptr<DeviceLocalObject, decltype(&DeviceLocalDelete)> device_local{
+      DeviceLocalCreate(&device_info, &feature_set),
+      DeviceLocalDelete
+  };
+
+  NodeManagementObject* const node_management = DEVICE_LOCAL_GET_NODE_MANAGEMENT(device_local.get());
+  ASSERT_NE(node_management, nullptr);
+
+  uint32_t entity_ids[1] = {static_cast<uint32_t>(VectorGetSize(DEVICE_LOCAL_GET_ENTITIES(device_local.get())))};
+
+  EntityLocalObject* const entity
+      = EntityLocalCreate(device_local.get(), kEntityTypeTypeCEM, entity_ids, ARRAY_SIZE(entity_ids), 4);
+  DEVICE_LOCAL_ADD_ENTITY(device_local.get(), entity);
+
+  // Each change of the data sent in the detailed discovery reply drops the cached one
+  CacheDetailedDiscoveryData(node_management);
+  FeatureLocalObject* const feature
+      = ENTITY_LOCAL_ADD_FEATURE_WITH_TYPE_AND_ROLE(entity, kFeatureTypeTypeMeasurement, kRoleTypeServer);
+  EXPECT_FALSE(IsDetailedDiscoveryDataCached(node_management));
+
+  CacheDetailedDiscoveryData(node_management);
+  FEATURE_LOCAL_SET_FUNCTION_OPERATIONS(feature, kFunctionTypeMeasurementListData, true, false);
+  EXPECT_FALSE(IsDetailedDiscoveryDataCached(node_management));
+
+  CacheDetailedDiscoveryData(node_management);
+  FEATURE_SET_DESCRIPTION(FEATURE_OBJECT(feature), "Measurement");
+  EXPECT_FALSE(IsDetailedDiscoveryDataCached(node_management));
+
+  CacheDetailedDiscoveryData(node_management);
+  ENTITY_SET_DESCRIPTION(ENTITY_OBJECT(entity), "CEM");
+  EXPECT_FALSE(IsDetailedDiscoveryDataCached(node_management));
+
+  CacheDetailedDiscoveryData(node_management);
+  DEVICE_LOCAL_REMOVE_ENTITY(device_local.get(), entity);
+  EXPECT_FALSE(IsDetailedDiscoveryDataCached(node_management));
+}
+
+TEST(FeatureLocalTest, FeatureLocalTestDetailedDiscoveryInvalidation) {
+  FeatureLocalTestDetailedDiscoveryInvalidationInternal();
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
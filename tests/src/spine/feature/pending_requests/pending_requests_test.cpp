@@ -0,0 +1,130 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "src/spine/feature/pending_requests.h"
+
+#include "tests/src/memory_leak.inc"
+
+namespace {
+
+// Only the pointer value is used, the table never dereferences the remote device
+DeviceRemoteObject* const kRemoteDevice = reinterpret_cast<DeviceRemoteObject*>(0x1000);
+
+void CollectExpired(DeviceRemoteObject* remote_device, MsgCounterType msg_cnt, void* ctx) {
+  EXPECT_EQ(remote_device, kRemoteDevice);
+  static_cast<std::vector<MsgCounterType>*>(ctx)->push_back(msg_cnt);
+}
+
+}  // namespace
+
+TEST(PendingRequestsTest, PendingRequestsTestExpireInDeadlineOrder) {
+  std::unique_ptr<PendingRequestsObject, decltype(&PendingRequestsDelete)> pending_requests{
+      PendingRequestsCreate(kRemoteDevice, 8),
+      &PendingRequestsDelete
+  };
+
+  ASSERT_NE(pending_requests, nullptr) << "Failed to create PendingRequests";
+
+  std::vector<MsgCounterType> expired;
+
+  EXPECT_EQ(PENDING_REQUESTS_ADD(pending_requests.get(), 1, 3000, CollectExpired, &expired), kEebusErrorOk);
+  EXPECT_EQ(PENDING_REQUESTS_ADD(pending_requests.get(), 2, 1000, CollectExpired, &expired), kEebusErrorOk);
+  EXPECT_EQ(PENDING_REQUESTS_ADD(pending_requests.get(), 3, 2000, CollectExpired, &expired), kEebusErrorOk);
+  EXPECT_EQ(PENDING_REQUESTS_ADD(pending_requests.get(), 4, 10000, CollectExpired, &expired), kEebusErrorOk);
+  EXPECT_EQ(PENDING_REQUESTS_ADD(pending_requests.get(), 4, 10000, CollectExpired, &expired), kEebusErrorNoChange);
+  EXPECT_EQ(PENDING_REQUESTS_GET_SIZE(pending_requests.get()), 4);
+
+  PENDING_REQUESTS_TICK(pending_requests.get(), 999);
+  EXPECT_TRUE(expired.empty());
+
+  PENDING_REQUESTS_TICK(pending_requests.get(), 1);
+  EXPECT_EQ(expired, (std::vector<MsgCounterType>{2}));
+
+  PENDING_REQUESTS_TICK(pending_requests.get(), 5000);
+  EXPECT_EQ(expired, (std::vector<MsgCounterType>{2, 3, 1}));
+  EXPECT_EQ(PENDING_REQUESTS_GET_SIZE(pending_requests.get()), 1);
+
+  // The deadline is counted from the moment of the request registration
+  EXPECT_EQ(PENDING_REQUESTS_ADD(pending_requests.get(), 5, 1000, CollectExpired, &expired), kEebusErrorOk);
+  PENDING_REQUESTS_TICK(pending_requests.get(), 1000);
+  EXPECT_EQ(expired, (std::vector<MsgCounterType>{2, 3, 1, 5}));
+
+  PENDING_REQUESTS_CLEAR(pending_requests.get());
+  EXPECT_EQ(expired, (std::vector<MsgCounterType>{2, 3, 1, 5, 4}));
+  EXPECT_EQ(PENDING_REQUESTS_GET_SIZE(pending_requests.get()), 0);
+
+  pending_requests.reset();
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+TEST(PendingRequestsTest, PendingRequestsTestRemoveAndLimit) {
+  static const size_t kMaxNum = 4;
+  std::unique_ptr<PendingRequestsObject, decltype(&PendingRequestsDelete)> pending_requests{
+      PendingRequestsCreate(kRemoteDevice, kMaxNum),
+      &PendingRequestsDelete
+  };
+
+  ASSERT_NE(pending_requests, nullptr) << "Failed to create PendingRequests";
+
+  std::vector<MsgCounterType> expired;
+
+  for (MsgCounterType msg_cnt = 1; msg_cnt <= kMaxNum; ++msg_cnt) {
+    EXPECT_FALSE(PENDING_REQUESTS_IS_FULL(pending_requests.get()));
+    EXPECT_EQ(
+        PENDING_REQUESTS_ADD(pending_requests.get(), msg_cnt, msg_cnt * 1000, CollectExpired, &expired),
+        kEebusErrorOk
+    );
+  }
+
+  ASSERT_TRUE(PENDING_REQUESTS_IS_FULL(pending_requests.get()));
+
+  // The requests beyond the limit are accepted until the reserved headroom is exhausted
+  for (MsgCounterType msg_cnt = 11; msg_cnt <= 10 + PENDING_REQUESTS_RESERVED_NUM; ++msg_cnt) {
+    EXPECT_EQ(PENDING_REQUESTS_ADD(pending_requests.get(), msg_cnt, 1000, CollectExpired, &expired), kEebusErrorOk);
+  }
+
+  EXPECT_EQ(
+      PENDING_REQUESTS_ADD(pending_requests.get(), 10, 1000, CollectExpired, &expired),
+      kEebusErrorCommunicationBusy
+  );
+
+  for (MsgCounterType msg_cnt = 11; msg_cnt <= 10 + PENDING_REQUESTS_RESERVED_NUM; ++msg_cnt) {
+    EXPECT_EQ(PENDING_REQUESTS_REMOVE(pending_requests.get(), msg_cnt), kEebusErrorOk);
+  }
+
+  EXPECT_TRUE(PENDING_REQUESTS_IS_FULL(pending_requests.get()));
+
+  // Answered requests never expire
+  EXPECT_EQ(PENDING_REQUESTS_REMOVE(pending_requests.get(), 1), kEebusErrorOk);
+  EXPECT_EQ(PENDING_REQUESTS_REMOVE(pending_requests.get(), 3), kEebusErrorOk);
+  EXPECT_EQ(PENDING_REQUESTS_REMOVE(pending_requests.get(), 3), kEebusErrorNoChange);
+  EXPECT_FALSE(PENDING_REQUESTS_IS_FULL(pending_requests.get()));
+
+  PENDING_REQUESTS_TICK(pending_requests.get(), 10000);
+  EXPECT_EQ(expired, (std::vector<MsgCounterType>{2, 4}));
+  EXPECT_EQ(PENDING_REQUESTS_GET_SIZE(pending_requests.get()), 0);
+
+  pending_requests.reset();
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
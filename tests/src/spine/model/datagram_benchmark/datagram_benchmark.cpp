@@ -0,0 +1,297 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief SPINE datagram encode/decode microbenchmark
+ *
+ * Measures the time and the heap usage per operation of the datagram parsing and
+ * printing (Json and CBOR) and of the generic data model operations (copy, compare,
+ * partial write) on a corpus of datagrams exchanged by the shipped use cases.
+ *
+ * Usage: datagram_benchmark [iterations number] [datagram name filter]
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef __freertos__
+#include <cJSON.h>
+#else
+#include <cjson/cJSON.h>
+#endif  // __freertos__
+
+#include "src/common/eebus_data/eebus_data.h"
+#include "src/common/eebus_malloc.h"
+#include "src/common/json.h"
+#include "src/spine/model/datagram.h"
+#include "src/spine/model/model.h"
+#include "tests/src/spine/model/datagram_payload/sma_discovery_data_reply.inc"
+#include "tests/src/spine/model/datagram_payload/sma_use_case_data_reply.inc"
+#include "tests/src/use_case/actor/cs/lpc/failsafe_duration_write.inc"
+#include "tests/src/use_case/actor/cs/lpc/heartbeat_notify.inc"
+#include "tests/src/use_case/actor/cs/lpc/limits_write.inc"
+#include "tests/src/use_case/actor/ma/mpc/electrical_connection_description_reply.inc"
+#include "tests/src/use_case/actor/ma/mpc/electrical_connection_parameter_description_reply.inc"
+#include "tests/src/use_case/actor/ma/mpc/measurement_notify_power.inc"
+#include "tests/src/use_case/actor/ma/mpc/measurement_reply.inc"
+
+namespace {
+
+struct HeapCounters {
+  size_t allocations_num = 0;
+  size_t allocated_bytes = 0;
+};
+
+HeapCounters heap_counters;
+
+void* CountingMalloc(size_t size) {
+  ++heap_counters.allocations_num;
+  heap_counters.allocated_bytes += size;
+  return malloc(size);
+}
+
+void CountingFree(void* p) { free(p); }
+
+struct OpStats {
+  double ns_per_op       = 0.0;
+  double allocs_per_op   = 0.0;
+  double bytes_per_op    = 0.0;
+  size_t processed_bytes = 0;  // Json or CBOR bytes processed per operation, 0 if not applicable
+};
+
+/**
+ * @brief Runs op iterations_num times, cleanup is called on each op result afterwards
+ * so that the release of the op results is not accounted
+ */
+template <typename Op, typename Cleanup>
+OpStats Measure(size_t iterations_num, size_t processed_bytes, Op op, Cleanup cleanup) {
+  std::vector<void*> results(iterations_num);
+
+  heap_counters = {};
+
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations_num; ++i) {
+    results[i] = op();
+  }
+
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  const HeapCounters counters = heap_counters;
+  for (void* const result : results) {
+    cleanup(result);
+  }
+
+  const double n = static_cast<double>(iterations_num);
+  return OpStats{
+      .ns_per_op       = elapsed.count() / n,
+      .allocs_per_op   = static_cast<double>(counters.allocations_num) / n,
+      .bytes_per_op    = static_cast<double>(counters.allocated_bytes) / n,
+      .processed_bytes = processed_bytes,
+  };
+}
+
+void PrintStats(std::string_view name, const char* op_name, const OpStats& stats) {
+  const double ops_per_sec = 1e9 / stats.ns_per_op;
+
+  char mb_per_sec[16] = "-";
+  if (stats.processed_bytes != 0) {
+    snprintf(mb_per_sec, sizeof(mb_per_sec), "%.2f", static_cast<double>(stats.processed_bytes) * ops_per_sec / 1e6);
+  }
+
+  printf(
+      "%-56.*s %-14s %12.0f %12.0f %10s %10.2f %12.1f\n",
+      static_cast<int>(name.size()),
+      name.data(),
+      op_name,
+      stats.ns_per_op,
+      ops_per_sec,
+      mb_per_sec,
+      stats.allocs_per_op,
+      stats.bytes_per_op
+  );
+}
+
+void NoCleanup(void*) {}
+
+void DatagramCleanup(void* datagram) { DatagramDelete(static_cast<DatagramType*>(datagram)); }
+
+void JsonCleanup(void* s) { JsonFree(s); }
+
+const FilterType* FindPartialFilter(const CmdType* cmd) {
+  for (size_t i = 0; i < cmd->filter_size; ++i) {
+    const FilterType* const filter = cmd->filter[i];
+    if ((filter->cmd_ctrl != NULL) && EEBUS_TAG_TO_BOOL(filter->cmd_ctrl->partial)) {
+      return filter;
+    }
+  }
+
+  return nullptr;
+}
+
+bool RunDatagram(std::string_view name, const char* s, size_t iterations_num) {
+  DatagramType* const datagram = DatagramParse(s);
+  if ((datagram == nullptr) || (datagram->payload == nullptr) || (datagram->payload->cmd_size == 0)) {
+    DatagramDelete(datagram);
+    fprintf(stderr, "%.*s: failed to parse\n", static_cast<int>(name.size()), name.data());
+    return false;
+  }
+
+  char* const json = DatagramPrintUnformatted(datagram);
+
+  size_t cbor_size = 0;
+  uint8_t* const cbor = DatagramPrintCbor(datagram, &cbor_size);
+  if ((json == nullptr) || (cbor == nullptr)) {
+    JsonFree(json);
+    JsonFree(cbor);
+    DatagramDelete(datagram);
+    fprintf(stderr, "%.*s: failed to print\n", static_cast<int>(name.size()), name.data());
+    return false;
+  }
+
+  const size_t json_size = strlen(json);
+
+  PrintStats(name, "parse", Measure(iterations_num, json_size, [&] { return DatagramParse(json); }, DatagramCleanup));
+  PrintStats(name, "print", Measure(iterations_num, json_size, [&] {
+    return DatagramPrintUnformatted(datagram);
+  }, JsonCleanup));
+
+  PrintStats(name, "parse_cbor", Measure(iterations_num, cbor_size, [&] {
+    return DatagramParseCbor(cbor, cbor_size);
+  }, DatagramCleanup));
+
+  PrintStats(name, "print_cbor", Measure(iterations_num, cbor_size, [&] {
+    size_t size = 0;
+    return DatagramPrintCbor(datagram, &size);
+  }, JsonCleanup));
+
+  // The data model operations are measured on the function data of the first command
+  const CmdType* const cmd      = datagram->payload->cmd[0];
+  const FunctionType function   = static_cast<FunctionType>(cmd->data_choice_type_id);
+  const EebusDataCfg* const cfg = ModelGetDataCfg(function);
+  const void* const data        = cmd->data_choice;
+
+  auto data_cleanup = [cfg](void* data_copy) { EEBUS_DATA_DELETE(cfg, &data_copy); };
+
+  PrintStats(name, "copy", Measure(iterations_num, 0, [&] {
+    void* data_copy = nullptr;
+    EEBUS_DATA_COPY(cfg, &data, &data_copy);
+    return data_copy;
+  }, data_cleanup));
+
+  void* data_copy = nullptr;
+  EEBUS_DATA_COPY(cfg, &data, &data_copy);
+
+  bool equal = true;
+  PrintStats(name, "compare", Measure(iterations_num, 0, [&]() -> void* {
+    equal = equal && EEBUS_DATA_COMPARE(cfg, &data, cfg, &data_copy);
+    return nullptr;
+  }, NoCleanup));
+
+  const FilterType* const filter = FindPartialFilter(cmd);
+  if (filter != nullptr) {
+    // The partial update is applied to the current data as the local function would do on notify/write
+    const EebusDataCfg* const selectors_cfg = ModelGetDataSelectorsCfg(function);
+    const void* const selectors             = filter->data_selectors_choice;
+
+    PrintStats(name, "write_partial", Measure(iterations_num, 0, [&]() -> void* {
+      EEBUS_DATA_WRITE_PARTIAL(cfg, &data_copy, &data, selectors_cfg, &selectors, NULL);
+      return nullptr;
+    }, NoCleanup));
+  }
+
+  EEBUS_DATA_DELETE(cfg, &data_copy);
+  JsonFree(cbor);
+  JsonFree(json);
+  DatagramDelete(datagram);
+
+  if (!equal) {
+    fprintf(stderr, "%.*s: copy differs from the original\n", static_cast<int>(name.size()), name.data());
+  }
+
+  return equal;
+}
+
+template <size_t n>
+const char* AsString(const uint8_t (&s)[n]) {
+  return reinterpret_cast<const char*>(s);
+}
+
+struct CorpusEntry {
+  std::string_view name;
+  const char* datagram;
+};
+
+const CorpusEntry corpus[] = {
+    {"measurementListData reply", AsString(measurement_reply)},
+    {"measurementListData notify partial", AsString(measurement_notify_power)},
+    {"loadControlLimitListData write partial", AsString(limits_write)},
+    {"deviceConfigurationKeyValueListData write partial", AsString(failsafe_duration_write)},
+    {"electricalConnectionDescriptionListData reply", AsString(electrical_connection_description_reply)},
+    {"electricalConnectionParameterDescriptionListData reply", AsString(electrical_connection_parameter_description_reply)},
+    {"nodeManagementDetailedDiscoveryData reply", sma_discovery_data_reply.data()},
+    {"nodeManagementUseCaseData reply", sma_use_case_data_reply.data()},
+    {"deviceDiagnosisHeartbeatData notify", AsString(heartbeat_notify)},
+};
+
+}  // namespace
+
+// Allocations done by the stack are counted with MEMORY_LEAKS_TEST hooks
+extern "C" void* test_malloc(size_t size, const char* file_name, int line) {
+  (void)file_name;
+  (void)line;
+  return CountingMalloc(size);
+}
+
+extern "C" void test_free(void* p) { CountingFree(p); }
+
+int main(int argc, char* argv[]) {
+  const size_t iterations_num = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000;
+  const char* const filter    = (argc > 2) ? argv[2] : "";
+  if (iterations_num == 0) {
+    return EXIT_FAILURE;
+  }
+
+  // Allocations done by cJSON are counted as well
+  cJSON_Hooks hooks = {.malloc_fn = CountingMalloc, .free_fn = CountingFree};
+  cJSON_InitHooks(&hooks);
+
+  printf(
+      "%-56s %-14s %12s %12s %10s %10s %12s\n",
+      "datagram",
+      "op",
+      "ns/op",
+      "ops/s",
+      "MB/s",
+      "allocs/op",
+      "bytes/op"
+  );
+
+  bool ok = true;
+  for (const CorpusEntry& entry : corpus) {
+    if (strstr(std::string{entry.name}.c_str(), filter) == nullptr) {
+      continue;
+    }
+
+    ok = RunDatagram(entry.name, entry.datagram, iterations_num) && ok;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -55,6 +55,28 @@ TEST(DatagramDeserializeTests, DatagramDeserializeInputArgs) {
   EXPECT_EQ(datagram, nullptr);
 }
 
+TEST(DatagramDeserializeTests, DatagramDeserializeFractionalInteger) {
+  // The fractional value of an integer field is not truncated, the whole datagram is rejected
+  std::unique_ptr<char[], decltype(&JsonFree)> s{
+      JsonUnformat(R"({"datagram": [
+        {"header": [
+          {"specificationVersion": "1.1.1"},
+          {"addressSource": [{"entity": [0]}, {"feature": 0}]},
+          {"addressDestination": [{"entity": [0]}, {"feature": 0}]},
+          {"msgCounter": 1.5},
+          {"cmdClassifier": "reply"}
+        ]},
+        {"payload": []}
+      ]})"sv),
+      JsonFree
+  };
+  ASSERT_NE(s, nullptr) << "Wrong test input!";
+
+  std::unique_ptr<DatagramType, decltype(&DatagramDelete)> const datagram{DatagramParse(s.get()), DatagramDelete};
+
+  EXPECT_EQ(datagram, nullptr);
+}
+
 TEST_P(DatagramDeserializeTests, DatagramDeserializeTests) {
   // Arrange: Initialize the message buffer with parameters from test input
   std::unique_ptr<char[], decltype(&JsonFree)> s{JsonUnformat(GetParam().msg), JsonFree};
@@ -349,6 +371,28 @@ INSTANTIATE_TEST_SUITE_P(
             .msg_cnt        = ValuePtrCreate<uint64_t>(100),
             .msg_cnt_ref    = ValuePtrCreate<uint64_t>(1),
             .cmd_classifier = ValuePtrCreate<CommandClassifierType>(kCommandClassifierTypeCall),
+        },
+        DatagramDeserializeTestInput{
+            .description = "Test datagram header message counters beyond the double precision"sv,
+            .msg =
+                R"({"datagram": [
+                  {"header": [
+                    {"specificationVersion": "1.1.1"},
+                    {"addressSource": [{"entity": [0]}, {"feature": 0}]},
+                    {"addressDestination": [{"entity": [0]}, {"feature": 0}]},
+                    {"msgCounter": 18446744073709551615},
+                    {"msgCounterReference": 9007199254740993},
+                    {"cmdClassifier": "reply"}
+                  ]},
+                  {"payload": []}
+                ]})"sv,
+            .is_valid       = true,
+            .spec_version   = "1.1.1",
+            .src_addr       = FEATURE_ADDRESS_TEST_DATA(nullptr, {0}, 0),
+            .dest_addr      = FEATURE_ADDRESS_TEST_DATA(nullptr, {0}, 0),
+            .msg_cnt        = ValuePtrCreate<uint64_t>(UINT64_MAX),
+            .msg_cnt_ref    = ValuePtrCreate<uint64_t>(9007199254740993),
+            .cmd_classifier = ValuePtrCreate<CommandClassifierType>(kCommandClassifierTypeReply),
         }
     )
 );
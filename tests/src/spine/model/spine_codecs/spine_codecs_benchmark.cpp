@@ -0,0 +1,148 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file
+ * @brief Compares the interpreted EEBUS Data Container methods against
+ * the generated SPINE codecs on a measurement list of configurable size.
+ *
+ * Usage: spine_codecs_benchmark [items number] [iterations number]
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "src/common/eebus_data/eebus_data.h"
+#include "src/common/json.h"
+#include "src/spine/model/model.h"
+
+namespace {
+
+struct Timings {
+  double parse_us   = 0.0;
+  double print_us   = 0.0;
+  double copy_us    = 0.0;
+  double compare_us = 0.0;
+  double delete_us  = 0.0;
+};
+
+std::string MeasurementListJson(size_t items_num) {
+  std::string s = R"({"measurementListData":[{"measurementData":[)";
+  for (size_t i = 0; i < items_num; ++i) {
+    if (i != 0) {
+      s += ",";
+    }
+
+    s += R"([{"measurementId":)" + std::to_string(i) + R"(},{"valueType":"value"},)";
+    s += R"({"timestamp":"2025-06-01T12:00:00Z"},)";
+    s += R"({"value":[{"number":)" + std::to_string(i * 10) + R"(},{"scale":-1}]},)";
+    s += R"({"valueSource":"measuredValue"},{"valueState":"normal"}])";
+  }
+
+  return s + "]}]}";
+}
+
+template <typename F>
+double MeasureUs(size_t iterations_num, F f) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations_num; ++i) {
+    f();
+  }
+
+  const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / static_cast<double>(iterations_num);
+}
+
+bool Run(const EebusDataCfg* cfg, const std::string& s, size_t iterations_num, Timings* timings) {
+  void* data = EEBUS_DATA_PARSE(cfg, s.c_str());
+  if (data == nullptr) {
+    return false;
+  }
+
+  void* data_copy = nullptr;
+  bool equal      = true;
+
+  timings->parse_us = MeasureUs(iterations_num, [&] {
+    void* tmp = EEBUS_DATA_PARSE(cfg, s.c_str());
+    EEBUS_DATA_DELETE(cfg, &tmp);
+  });
+
+  timings->print_us = MeasureUs(iterations_num, [&] { JsonFree(EEBUS_DATA_PRINT_UNFORMATTED(cfg, &data)); });
+
+  timings->copy_us = MeasureUs(iterations_num, [&] {
+    EEBUS_DATA_DELETE(cfg, &data_copy);
+    EEBUS_DATA_COPY(cfg, &data, &data_copy);
+  });
+
+  timings->compare_us = MeasureUs(iterations_num, [&] {
+    equal = equal && EEBUS_DATA_COMPARE(cfg, &data, cfg, &data_copy);
+  });
+
+  std::chrono::duration<double, std::micro> delete_elapsed{0};
+  for (size_t i = 0; i < iterations_num; ++i) {
+    void* tmp = nullptr;
+    EEBUS_DATA_COPY(cfg, &data, &tmp);
+    const auto start = std::chrono::steady_clock::now();
+    EEBUS_DATA_DELETE(cfg, &tmp);
+    delete_elapsed += std::chrono::steady_clock::now() - start;
+  }
+
+  timings->delete_us = delete_elapsed.count() / static_cast<double>(iterations_num);
+
+  EEBUS_DATA_DELETE(cfg, &data_copy);
+  EEBUS_DATA_DELETE(cfg, &data);
+  return equal;
+}
+
+void PrintTimings(const char* name, const Timings& timings) {
+  printf(
+      "%-8s parse %10.2f us, print %10.2f us, copy %10.2f us, compare %10.2f us, delete %10.2f us\n",
+      name,
+      timings.parse_us,
+      timings.print_us,
+      timings.copy_us,
+      timings.compare_us,
+      timings.delete_us
+  );
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const size_t items_num      = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 256;
+  const size_t iterations_num = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 200;
+  if (iterations_num == 0) {
+    return EXIT_FAILURE;
+  }
+
+  const EebusDataCfg* const cfg = ModelGetDataCfg(kFunctionTypeMeasurementListData);
+  EebusDataCfg generic_cfg      = *cfg;
+  generic_cfg.interface_        = &eebus_data_container_methods;
+
+  const std::string s = MeasurementListJson(items_num);
+  printf("measurementListData, %zu items, %zu bytes, %zu iterations\n", items_num, s.size(), iterations_num);
+
+  Timings generic_timings;
+  Timings codec_timings;
+  if (!Run(&generic_cfg, s, iterations_num, &generic_timings) || !Run(cfg, s, iterations_num, &codec_timings)) {
+    fprintf(stderr, "Benchmark run failed\n");
+    return EXIT_FAILURE;
+  }
+
+  PrintTimings("generic", generic_timings);
+  PrintTimings("codec", codec_timings);
+  return EXIT_SUCCESS;
+}
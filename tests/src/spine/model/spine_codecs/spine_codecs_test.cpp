@@ -0,0 +1,281 @@
+/*
+ * Copyright 2025 NIBE AB
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+#include "src/common/eebus_data/eebus_data.h"
+#include "src/common/json.h"
+#include "src/spine/model/model.h"
+#include "tests/src/json.h"
+
+#include "tests/src/memory_leak.inc"
+
+using namespace std::literals;
+
+struct CodecTestInput {
+  std::string_view description = ""sv;
+  FunctionType function_type   = kFunctionTypeNum;
+  std::string_view msg         = ""sv;
+  // Json expected to be printed, same as msg if empty
+  std::string_view expected = ""sv;
+};
+
+std::ostream& operator<<(std::ostream& os, CodecTestInput test_input) {
+  return os << test_input.description;
+}
+
+/**
+ * @brief Function data configuration using the interpreted EEBUS Data Container methods
+ */
+static EebusDataCfg GenericCfg(const EebusDataCfg* cfg) {
+  EebusDataCfg generic_cfg = *cfg;
+  generic_cfg.interface_   = &eebus_data_container_methods;
+  return generic_cfg;
+}
+
+static std::string Print(const EebusDataCfg* cfg, void* data) {
+  std::unique_ptr<char[], decltype(&JsonFree)> s{EEBUS_DATA_PRINT_UNFORMATTED(cfg, &data), JsonFree};
+  return (s != nullptr) ? std::string{s.get()} : std::string{};
+}
+
+class SpineCodecsTests : public ::testing::TestWithParam<CodecTestInput> {};
+
+TEST_P(SpineCodecsTests, SpineCodecsTests) {
+  const EebusDataCfg* const cfg  = ModelGetDataCfg(GetParam().function_type);
+  const EebusDataCfg generic_cfg = GenericCfg(cfg);
+
+  // Make sure the specialized codec is in use
+  ASSERT_NE(EEBUS_DATA_INTERFACE(cfg), &eebus_data_container_methods);
+  ASSERT_TRUE(EEBUS_DATA_IS_CONTAINER(cfg));
+
+  std::unique_ptr<char[], decltype(&JsonFree)> s{JsonUnformat(GetParam().msg), JsonFree};
+  ASSERT_NE(s, nullptr) << "Wrong test input!";
+
+  std::unique_ptr<char[], decltype(&JsonFree)> expected{
+      JsonUnformat(GetParam().expected.empty() ? GetParam().msg : GetParam().expected), JsonFree};
+  ASSERT_NE(expected, nullptr) << "Wrong test input!";
+
+  void* data         = EEBUS_DATA_PARSE(cfg, s.get());
+  void* generic_data = EEBUS_DATA_PARSE(&generic_cfg, s.get());
+  ASSERT_NE(data, nullptr);
+  ASSERT_NE(generic_data, nullptr);
+
+  EXPECT_EQ(Print(cfg, data), expected.get());
+  EXPECT_EQ(Print(&generic_cfg, generic_data), expected.get());
+
+  // Both paths shall produce the very same data
+  EXPECT_TRUE(EEBUS_DATA_COMPARE(&generic_cfg, &data, &generic_cfg, &generic_data));
+  EXPECT_TRUE(EEBUS_DATA_COMPARE(cfg, &data, cfg, &generic_data));
+
+  void* data_copy = nullptr;
+  EXPECT_EQ(EEBUS_DATA_COPY(cfg, &data, &data_copy), kEebusErrorOk);
+  EXPECT_TRUE(EEBUS_DATA_COMPARE(cfg, &data, cfg, &data_copy));
+  EXPECT_EQ(Print(cfg, data_copy), expected.get());
+
+  // Overwrite the data of another shape
+  EXPECT_EQ(EEBUS_DATA_COPY(cfg, &data, &generic_data), kEebusErrorOk);
+  EXPECT_TRUE(EEBUS_DATA_COMPARE(cfg, &data, cfg, &generic_data));
+
+  EEBUS_DATA_DELETE(cfg, &data);
+  EEBUS_DATA_DELETE(cfg, &data_copy);
+  EEBUS_DATA_DELETE(&generic_cfg, &generic_data);
+  EXPECT_EQ(data, nullptr);
+  EXPECT_EQ(data_copy, nullptr);
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SpineCodecsTests,
+    SpineCodecsTests,
+    ::testing::Values(
+        CodecTestInput{
+            .description   = "Measurement list data"sv,
+            .function_type = kFunctionTypeMeasurementListData,
+            .msg           = R"({"measurementListData": [{"measurementData": [
+              [
+                {"measurementId": 1},
+                {"valueType": "value"},
+                {"timestamp": "2025-06-01T12:00:00Z"},
+                {"value": [{"number": 2300}, {"scale": -1}]},
+                {"valueSource": "measuredValue"},
+                {"valueState": "normal"}
+              ],
+              [
+                {"measurementId": 4294967295},
+                {"valueType": "averageValue"},
+                {"value": [{"number": -9223372036854775808}, {"scale": 0}]},
+                {"evaluationPeriod": [{"startTime": "2025-06-01T12:00:00Z"}, {"endTime": "PT15M"}]}
+              ]
+            ]}]})"sv,
+        },
+        CodecTestInput{
+            .description   = "Measurement list data fields out of order, duplicated and unknown"sv,
+            .function_type = kFunctionTypeMeasurementListData,
+            .msg           = R"({"measurementListData": [{"measurementData": [
+              [
+                {"value": [{"scale": 3}, {"number": 5}]},
+                {"MeasurementId": 7},
+                {"measurementId": 8},
+                {"unknown": "field"},
+                {"valueType": "minValue", "valueState": "error"}
+              ],
+              []
+            ]}]})"sv,
+            .expected      = R"({"measurementListData": [{"measurementData": [
+              [
+                {"measurementId": 7},
+                {"valueType": "minValue"},
+                {"value": [{"number": 5}, {"scale": 3}]},
+                {"valueState": "error"}
+              ],
+              []
+            ]}]})"sv,
+        },
+        CodecTestInput{
+            .description   = "Measurement list data empty"sv,
+            .function_type = kFunctionTypeMeasurementListData,
+            .msg           = R"({"measurementListData": [{"measurementData": []}]})"sv,
+            .expected      = R"({"measurementListData": []})"sv,
+        },
+        CodecTestInput{
+            .description   = "Load control limit list data"sv,
+            .function_type = kFunctionTypeLoadControlLimitListData,
+            .msg           = R"({"loadControlLimitListData": [{"loadControlLimitData": [
+              [
+                {"limitId": 0},
+                {"isLimitChangeable": true},
+                {"isLimitActive": false},
+                {"value": [{"number": 4200}, {"scale": 0}]}
+              ],
+              [
+                {"limitId": 1},
+                {"isLimitActive": true},
+                {"timePeriod": [{"endTime": "PT2H"}]}
+              ]
+            ]}]})"sv,
+        },
+        CodecTestInput{
+            .description   = "Electrical connection description list data"sv,
+            .function_type = kFunctionTypeElectricalConnectionDescriptionListData,
+            .msg           = R"({"electricalConnectionDescriptionListData": [{"electricalConnectionDescriptionData": [
+              [
+                {"electricalConnectionId": 0},
+                {"powerSupplyType": "ac"},
+                {"acConnectedPhases": "abc"},
+                {"acRmsPeriodDuration": "PT1S"},
+                {"positiveEnergyDirection": "consume"},
+                {"scopeType": "acPowerTotal"},
+                {"label": "Grid"},
+                {"description": "Grid connection point"}
+              ]
+            ]}]})"sv,
+        },
+        CodecTestInput{
+            .description   = "Electrical connection permitted value set list data"sv,
+            .function_type = kFunctionTypeElectricalConnectionPermittedValueSetListData,
+            .msg           = R"({"electricalConnectionPermittedValueSetListData": [
+              {"electricalConnectionPermittedValueSetData": [
+                [
+                  {"electricalConnectionId": 0},
+                  {"parameterId": 1},
+                  {"permittedValueSet": [
+                    [
+                      {"value": [[{"number": 230}, {"scale": 0}]]},
+                      {"range": [[{"min": [{"number": 6}, {"scale": 0}]}, {"max": [{"number": 32}, {"scale": 0}]}]]}
+                    ]
+                  ]}
+                ],
+                [
+                  {"electricalConnectionId": 0},
+                  {"parameterId": 2}
+                ]
+              ]}
+            ]})"sv,
+        }
+    )
+);
+
+class SpineCodecsInvalidInputTests : public ::testing::TestWithParam<CodecTestInput> {};
+
+TEST_P(SpineCodecsInvalidInputTests, SpineCodecsInvalidInputTests) {
+  const EebusDataCfg* const cfg  = ModelGetDataCfg(GetParam().function_type);
+  const EebusDataCfg generic_cfg = GenericCfg(cfg);
+
+  std::unique_ptr<char[], decltype(&JsonFree)> s{JsonUnformat(GetParam().msg), JsonFree};
+  ASSERT_NE(s, nullptr) << "Wrong test input!";
+
+  // Both paths shall reject the input and release everything allocated so far
+  EXPECT_EQ(EEBUS_DATA_PARSE(cfg, s.get()), nullptr);
+  EXPECT_EQ(EEBUS_DATA_PARSE(&generic_cfg, s.get()), nullptr);
+
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SpineCodecsInvalidInputTests,
+    SpineCodecsInvalidInputTests,
+    ::testing::Values(
+        CodecTestInput{
+            .description   = "Sequence expected"sv,
+            .function_type = kFunctionTypeMeasurementListData,
+            .msg           = R"({"measurementListData": [{"measurementData": [{"measurementId": 1}]}]})"sv,
+        },
+        CodecTestInput{
+            .description   = "Number expected"sv,
+            .function_type = kFunctionTypeMeasurementListData,
+            .msg           = R"({"measurementListData": [{"measurementData": [[{"measurementId": "1"}]]}]})"sv,
+        },
+        CodecTestInput{
+            .description   = "Number out of range"sv,
+            .function_type = kFunctionTypeMeasurementListData,
+            .msg           = R"({"measurementListData": [{"measurementData": [
+              [{"measurementId": 1}, {"value": [{"number": 1}, {"scale": 128}]}]
+            ]}]})"sv,
+        },
+        CodecTestInput{
+            .description   = "Unknown enum value"sv,
+            .function_type = kFunctionTypeMeasurementListData,
+            .msg           = R"({"measurementListData": [{"measurementData": [
+              [{"measurementId": 1}, {"valueType": "value"}],
+              [{"measurementId": 2}, {"valueType": "unknownValue"}]
+            ]}]})"sv,
+        },
+        CodecTestInput{
+            .description   = "Bool expected"sv,
+            .function_type = kFunctionTypeLoadControlLimitListData,
+            .msg           = R"({"loadControlLimitListData": [{"loadControlLimitData": [[{"isLimitActive": 1}]]}]})"sv,
+        },
+        CodecTestInput{
+            .description   = "String expected"sv,
+            .function_type = kFunctionTypeElectricalConnectionDescriptionListData,
+            .msg           = R"({"electricalConnectionDescriptionListData": [{"electricalConnectionDescriptionData": [
+              [{"electricalConnectionId": 0}, {"label": 1}]
+            ]}]})"sv,
+        },
+        CodecTestInput{
+            .description   = "Invalid duration"sv,
+            .function_type = kFunctionTypeElectricalConnectionDescriptionListData,
+            .msg           = R"({"electricalConnectionDescriptionListData": [{"electricalConnectionDescriptionData": [
+              [{"electricalConnectionId": 0}, {"acRmsPeriodDuration": "1S"}]
+            ]}]})"sv,
+        }
+    )
+);
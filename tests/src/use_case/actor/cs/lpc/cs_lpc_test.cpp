@@ -83,11 +83,12 @@ void HandleMessage(
   HandleQueueMessage(device_local);
 }
 
-void PrintMessage(const uint8_t* msg, size_t msg_size) {
+EebusError PrintMessage(const uint8_t* msg, size_t msg_size) {
 #if 0
   std::string_view s(reinterpret_cast<const char*>(msg));
   std::cout << "\n" << s << "\n" << std::endl;
 #endif
+  return kEebusErrorOk;
 }
 
 void CsLpclTestInternal() {
@@ -142,7 +143,7 @@ void CsLpclTestInternal() {
   DEVICE_LOCAL_ADD_ENTITY(device_local.get(), entity);
 
   // 1. Setup the Data Reader and expecte send the detailed discovery request
-  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _)).WillRepeatedly(WithArgs<1, 2>(Invoke(PrintMessage)));
+  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _, _)).WillRepeatedly(WithArgs<1, 2>(Invoke(PrintMessage)));
   DataReaderObject* const data_reader
       = DEVICE_LOCAL_SETUP_REMOTE_DEVICE(device_local.get(), remote_ski, DATA_WRITER_OBJECT(data_write_mock.get()));
   // 2. Receive the detailed discovery request and send the repsonse
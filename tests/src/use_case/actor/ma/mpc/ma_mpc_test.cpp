@@ -24,6 +24,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <string>
 
 #include "mocks/common/eebus_timer/eebus_timer_mock.h"
 #include "mocks/ship/ship_connection/data_writer_mock.h"
@@ -35,6 +36,7 @@
 #include "src/spine/device/device_local.h"
 #include "src/spine/device/device_local_internal.h"
 #include "src/spine/entity/entity_local.h"
+#include "src/use_case/actor/ma/mpc/ma_mpc_internal.h"
 #include "tests/src/json.h"
 #include "tests/src/memory_leak.inc"
 #include "tests/src/use_case/actor/ma/mpc/discovery_request.inc"
@@ -82,11 +84,27 @@ void HandleMessage(
   HandleQueueMessage(device_local);
 }
 
-void PrintMessage(const uint8_t* msg, size_t msg_size) {
+void HandleMessage(DeviceLocalObject* device_local, DataReaderObject* data_reader, const std::string& msg) {
+  // Pass the terminating null character as well, the same as with the static messages
+  HandleMessage(device_local, data_reader, reinterpret_cast<const uint8_t*>(msg.c_str()), msg.size() + 1);
+}
+
+std::string ReplaceMessageText(std::string s, const std::string& from, const std::string& to) {
+  const size_t pos = s.find(from);
+  EXPECT_NE(pos, std::string::npos) << "No " << from << " found in the test message";
+  if (pos != std::string::npos) {
+    s.replace(pos, from.size(), to);
+  }
+
+  return s;
+}
+
+EebusError PrintMessage(const uint8_t* msg, size_t msg_size) {
 #if 0
   std::string_view s(reinterpret_cast<const char*>(msg));
   std::cout << "\n" << s << "\n" << std::endl;
 #endif
+  return kEebusErrorOk;
 }
 
 void ExpectMeasurementsReceive(
@@ -152,7 +170,7 @@ void MaMpcTestInternal() {
   DEVICE_LOCAL_ADD_ENTITY(device_local.get(), entity);
 
   // 1. Setup the Data Reader and expect to send the detailed discovery request
-  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _)).WillRepeatedly(WithArgs<1, 2>(Invoke(PrintMessage)));
+  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _, _)).WillRepeatedly(WithArgs<1, 2>(Invoke(PrintMessage)));
   DataReaderObject* const data_reader
       = DEVICE_LOCAL_SETUP_REMOTE_DEVICE(device_local.get(), remote_ski, DATA_WRITER_OBJECT(data_write_mock.get()));
   // 2. Receive the detailed discovery request and send the response
@@ -277,10 +295,72 @@ void MaMpcTestInternal() {
   expected_data.insert(expected_frequency.begin(), expected_frequency.end());
 
   for (const auto& [name_id, scaled_value] : expected_data) {
-    MaMpcGetMeasurementData(use_case.get(), name_id, &remote_entity_addr, &value);
+    EXPECT_EQ(MaMpcGetMeasurementData(use_case.get(), name_id, &remote_entity_addr, &value), kEebusErrorOk);
+    EXPECT_THAT(value, ScaledValueMatcher(scaled_value.value, scaled_value.scale));
+  }
+
+  // 21. Get the measurements again, now the resolved measurement ids are reused
+  for (const auto& [name_id, scaled_value] : expected_data) {
+    EXPECT_EQ(MaMpcGetMeasurementData(use_case.get(), name_id, &remote_entity_addr, &value), kEebusErrorOk);
     EXPECT_THAT(value, ScaledValueMatcher(scaled_value.value, scaled_value.scale));
   }
 
+  // 22. Receive the detailed discovery once again, the known entities and features with their data are kept
+  HandleMessage(device_local.get(), data_reader, discovery_response, sizeof(discovery_response));
+
+  for (const auto& [name_id, scaled_value] : expected_data) {
+    EXPECT_EQ(MaMpcGetMeasurementData(use_case.get(), name_id, &remote_entity_addr, &value), kEebusErrorOk);
+    EXPECT_THAT(value, ScaledValueMatcher(scaled_value.value, scaled_value.scale));
+  }
+
+  const auto unknown_name_id = static_cast<MuMpcMeasurementNameId>(kMpcMonitorFrequency | 0x0F);
+  EXPECT_EQ(
+      MaMpcGetMeasurementData(use_case.get(), unknown_name_id, &remote_entity_addr, &value),
+      kEebusErrorNotSupported
+  );
+
+  // 23. Receive the changed descriptions, the frequency is measured with another id now.
+  // The resolved measurement id is dropped, the stale value of the previous id is not returned anymore
+  static constexpr char frequency_id[]         = R"("measurementId": 15)";
+  static constexpr char changed_frequency_id[] = R"("measurementId": 16)";
+
+  const std::string parameter_description
+      = reinterpret_cast<const char*>(electrical_connection_parameter_description_reply);
+  const std::string measurement_description = reinterpret_cast<const char*>(measurement_description_reply);
+  const std::string frequency_notify        = reinterpret_cast<const char*>(measurement_notify_frequency);
+
+  HandleMessage(
+      device_local.get(),
+      data_reader,
+      ReplaceMessageText(parameter_description, frequency_id, changed_frequency_id)
+  );
+  HandleMessage(
+      device_local.get(),
+      data_reader,
+      ReplaceMessageText(measurement_description, frequency_id, changed_frequency_id)
+  );
+
+  ExpectMeasurementsReceive(ma_mpc_listener_mock->gmock, {{kMpcFrequency, {.value = 499, .scale = -1}}});
+  HandleMessage(
+      device_local.get(),
+      data_reader,
+      ReplaceMessageText(
+          ReplaceMessageText(frequency_notify, frequency_id, changed_frequency_id),
+          R"("number": 500)",
+          R"("number": 499)"
+      )
+  );
+
+  EXPECT_EQ(MaMpcGetMeasurementData(use_case.get(), kMpcFrequency, &remote_entity_addr, &value), kEebusErrorOk);
+  EXPECT_THAT(value, ScaledValueMatcher(499, -1));
+
+  // 24. Disconnect the remote device, the measurement indexes of its entities are dropped
+  const Vector* const measurement_indexes = &MA_MPC_USE_CASE(use_case.get())->measurement_indexes.records;
+  EXPECT_NE(VectorGetSize(measurement_indexes), 0);
+  DEVICE_LOCAL_REMOVE_REMOTE_DEVICE_CONNECTION(device_local.get(), remote_ski);
+  EXPECT_EQ(VectorGetSize(measurement_indexes), 0);
+  EXPECT_EQ(MaMpcGetMeasurementData(use_case.get(), kMpcFrequency, &remote_entity_addr, &value), kEebusErrorNoChange);
+
   EXPECT_CALL(*data_write_mock->gmock, Destruct(_)).WillOnce(Return());
   EXPECT_CALL(*ma_mpc_listener_mock->gmock, Destruct(_)).WillOnce(Return());
 }
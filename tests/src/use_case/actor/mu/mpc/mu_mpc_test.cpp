@@ -24,6 +24,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <string>
 
 #include "mocks/common/eebus_timer/eebus_timer_mock.h"
 #include "mocks/ship/ship_connection/data_writer_mock.h"
@@ -54,10 +55,19 @@ using testing::Invoke;
 using testing::Return;
 using testing::WithArgs;
 
+static EebusTimerTimeoutCallback timer_cb = nullptr;
+static void* timer_ctx                     = nullptr;
+static uint64_t monotonic_time_ms          = 0;
+
 EebusTimerObject* EebusTimerCreate(EebusTimerTimeoutCallback cb, void* ctx) {
+  // Keep the last created timer callback to fire it from the test
+  timer_cb  = cb;
+  timer_ctx = ctx;
   return EEBUS_TIMER_OBJECT(EebusTimerMockCreate());
 }
 
+uint64_t EebusTimerGetMonotonicTimeMs(void) { return monotonic_time_ms; }
+
 void HandleMessage(
     DeviceLocalObject* device_local,
     DataReaderObject* data_reader,
@@ -71,11 +81,12 @@ void HandleMessage(
   HandleQueueMessage(device_local);
 }
 
-void PrintMessage(const uint8_t* msg, size_t msg_size) {
+EebusError PrintMessage(const uint8_t* msg, size_t msg_size) {
 #if 0
   std::string_view s(reinterpret_cast<const char*>(msg));
   std::cout << "\n" << s << "\n" << std::endl;
 #endif
+  return kEebusErrorOk;
 }
 
 void MuMpcTestInternal() {
@@ -193,10 +204,40 @@ void MuMpcTestInternal() {
   EXPECT_EQ(value.value, 50);
   EXPECT_EQ(value.scale, 0);
 
+  static constexpr MuMpcMeasurementSample samples[] = {
+      { kMpcPowerTotal, {1200, 0}, &timestamp, NULL},
+      {kMpcPowerPhaseA,  {400, 0}, &timestamp, NULL},
+      {  kMpcFrequency, {499, -1},       NULL, NULL},
+  };
+
+  EXPECT_EQ(MuMpcUpdateMeasurementData(use_case.get(), samples, ARRAY_SIZE(samples)), kEebusErrorOk);
+
+  MuMpcGetMeasurementData(use_case.get(), kMpcPowerTotal, &value);
+  EXPECT_EQ(value.value, 1200);
+  EXPECT_EQ(value.scale, 0);
+
+  MuMpcGetMeasurementData(use_case.get(), kMpcPowerPhaseA, &value);
+  EXPECT_EQ(value.value, 400);
+  EXPECT_EQ(value.scale, 0);
+
+  MuMpcGetMeasurementData(use_case.get(), kMpcFrequency, &value);
+  EXPECT_EQ(value.value, 499);
+  EXPECT_EQ(value.scale, -1);
+
+  // Voltage monitor is not configured
+  static constexpr MuMpcMeasurementSample voltage_samples[] = {
+      {kMpcVoltagePhaseA, {230, 0}, NULL, NULL},
+  };
+
+  EXPECT_EQ(
+      MuMpcUpdateMeasurementData(use_case.get(), voltage_samples, ARRAY_SIZE(voltage_samples)),
+      kEebusErrorNotSupported
+  );
+
   DEVICE_LOCAL_ADD_ENTITY(device_local.get(), entity);
 
   // 1. Setup the Data Reader and expecte send the detailed discovery request
-  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _)).WillRepeatedly(WithArgs<1, 2>(Invoke(PrintMessage)));
+  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _, _)).WillRepeatedly(WithArgs<1, 2>(Invoke(PrintMessage)));
   DataReaderObject* const data_reader
       = DEVICE_LOCAL_SETUP_REMOTE_DEVICE(device_local.get(), remote_ski, DATA_WRITER_OBJECT(data_write_mock.get()));
   // 2. Receive the detailed discovery request and send the repsonse
@@ -254,6 +295,41 @@ void MuMpcTestInternal() {
   // 13. Receive the Use Case reply
   HandleMessage(device_local.get(), data_reader, use_case_reply, sizeof(use_case_reply));
 
+  // 14. Nothing is notified if the measurements have not changed
+  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _, _)).Times(0);
+  EXPECT_EQ(MuMpcUpdateMeasurementData(use_case.get(), samples, ARRAY_SIZE(samples)), kEebusErrorOk);
+  testing::Mock::VerifyAndClearExpectations(data_write_mock->gmock);
+
+  // 15. Single notification is sent for the changed measurements
+  std::string notify_msg;
+  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _, _))
+      .WillOnce(WithArgs<1, 2>(Invoke([&notify_msg](const uint8_t* msg, size_t msg_size) {
+        notify_msg.assign(reinterpret_cast<const char*>(msg), msg_size);
+        return kEebusErrorOk;
+      })));
+  static constexpr MuMpcMeasurementSample changed_samples[] = {
+      {kMpcPowerTotal, {1300, 0}, &timestamp, NULL},
+      { kMpcFrequency, {499, -1},       NULL, NULL},
+  };
+
+  EXPECT_EQ(MuMpcUpdateMeasurementData(use_case.get(), changed_samples, ARRAY_SIZE(changed_samples)), kEebusErrorOk);
+  testing::Mock::VerifyAndClearExpectations(data_write_mock->gmock);
+
+  EXPECT_NE(notify_msg.find(R"({"cmdClassifier":"notify"})"), std::string::npos) << notify_msg;
+  EXPECT_NE(notify_msg.find(R"({"function":"measurementListData"})"), std::string::npos) << notify_msg;
+  EXPECT_NE(
+      notify_msg.find(
+          R"([{"measurementId":0},{"valueType":"value"},{"timestamp":"2025-07-01T12:00:00Z"},)"
+          R"({"value":[{"number":1300},{"scale":0}]},{"valueSource":"measuredValue"}])"
+      ),
+      std::string::npos
+  ) << notify_msg;
+
+  // 16. The published change is not notified again
+  EXPECT_CALL(*data_write_mock->gmock, WriteMessage(_, _, _, _)).Times(0);
+  EXPECT_EQ(MuMpcUpdateMeasurementData(use_case.get(), changed_samples, ARRAY_SIZE(changed_samples)), kEebusErrorOk);
+  testing::Mock::VerifyAndClearExpectations(data_write_mock->gmock);
+
   EXPECT_CALL(*data_write_mock->gmock, Destruct(_)).WillOnce(Return());
 }
 
@@ -262,3 +338,151 @@ TEST(MuMpcTest, MuMpcTest) {
   EXPECT_EQ(heap_used, 0);
   CheckForMemoryLeaks();
 }
+
+void MuMpcPublishingPolicyTestInternal() {
+  const EebusDeviceInfo device_info = {
+      .type       = "EnergyManagementSystem",
+      .vendor     = "Demo",
+      .brand      = "Demo",
+      .model      = "HEMS",
+      .serial_num = "123456789",
+      .ship_id    = "Demo",
+      .address    = "d:_n:Demo_HEMS-123456789",
+  };
+
+  static constexpr NetworkManagementFeatureSetType feature_set = kNetworkManagementFeatureSetTypeSmart;
+
+  std::unique_ptr<DeviceLocalObject, decltype(&DeviceLocalDelete)> device_local{
+      DeviceLocalCreate(&device_info, &feature_set),
+      DeviceLocalDelete
+  };
+
+  uint32_t entity_ids[1] = {static_cast<uint32_t>(VectorGetSize(DEVICE_LOCAL_GET_ENTITIES(device_local.get())))};
+
+  EntityLocalObject* const entity = EntityLocalCreate(
+      device_local.get(),
+      kEntityTypeTypeHeatPumpAppliance,
+      entity_ids,
+      ARRAY_SIZE(entity_ids),
+      4
+  );
+
+  static constexpr MuMpcPublishingPolicy deadband_policy = {
+      .absolute_deadband          = {10, 0},
+      .relative_deadband_permille = 20,
+      .max_silence_s              = 60,
+  };
+
+  static constexpr MuMpcPublishingPolicy min_interval_policy = {
+      .min_interval_s = 3600,
+  };
+
+  static constexpr MuMpcMeasurementConfig power_cfg = {
+      .value_source      = kMeasurementValueSourceTypeMeasuredValue,
+      .publishing_policy = &deadband_policy,
+  };
+
+  static constexpr MuMpcMeasurementConfig frequency_cfg = {
+      .value_source      = kMeasurementValueSourceTypeMeasuredValue,
+      .publishing_policy = &min_interval_policy,
+  };
+
+  static constexpr MuMpcMonitorFrequencyConfig frequency_monitor_cfg = {
+      .frequency_cfg = frequency_cfg,
+  };
+
+  static constexpr MuMpcConfig cfg {
+    .power_cfg = {
+        .power_total_cfg   = power_cfg,
+        .power_phase_a_cfg = &power_cfg,
+    },
+
+    .frequency_cfg = &frequency_monitor_cfg
+  };
+
+  timer_cb          = nullptr;
+  monotonic_time_ms = 1000;
+
+  std::unique_ptr<MuMpcUseCaseObject, decltype(&MuMpcUseCaseDelete)> use_case{
+      MuMpcUseCaseCreate(entity, 1, &cfg),
+      MuMpcUseCaseDelete
+  };
+
+  // The timed publishing policies are applied by the publishing timer as well
+  ASSERT_NE(timer_cb, nullptr);
+  EXPECT_EQ(timer_ctx, use_case.get());
+
+  DEVICE_LOCAL_ADD_ENTITY(device_local.get(), entity);
+
+  const auto update = [&use_case](MuMpcMeasurementNameId name, ScaledValue value) {
+    const MuMpcMeasurementSample samples[] = {
+        {name, value, NULL, NULL},
+    };
+
+    EXPECT_EQ(MuMpcUpdateMeasurementData(use_case.get(), samples, ARRAY_SIZE(samples)), kEebusErrorOk);
+
+    ScaledValue published = {0};
+    EXPECT_EQ(MuMpcGetMeasurementData(use_case.get(), name, &published), kEebusErrorOk);
+    return published.value;
+  };
+
+  // The first value is always published
+  EXPECT_EQ(update(kMpcPowerTotal, {1000, 0}), 1000);
+  // Within the absolute deadband
+  EXPECT_EQ(update(kMpcPowerTotal, {1010, 0}), 1000);
+  // Within the relative deadband (2% of 1000)
+  EXPECT_EQ(update(kMpcPowerTotal, {1020, 0}), 1000);
+  // Out of both deadbands, compared to the last published value
+  EXPECT_EQ(update(kMpcPowerTotal, {1021, 0}), 1021);
+  // Different scale of the same value is not significant
+  EXPECT_EQ(update(kMpcPowerTotal, {10210, -1}), 1021);
+  // Value state change is always significant
+  static constexpr MeasurementValueStateType value_state = kMeasurementValueStateTypeError;
+  static constexpr MuMpcMeasurementSample error_samples[] = {
+      {kMpcPowerTotal, {1025, 0}, NULL, &value_state},
+  };
+
+  EXPECT_EQ(MuMpcUpdateMeasurementData(use_case.get(), error_samples, ARRAY_SIZE(error_samples)), kEebusErrorOk);
+  EXPECT_EQ(update(kMpcPowerTotal, {1030, 0}), 1030);
+  // Measurements are published independently
+  EXPECT_EQ(update(kMpcPowerPhaseA, {300, 0}), 300);
+
+  // Out of range values saturate instead of overflow on the scaling
+  EXPECT_EQ(update(kMpcPowerPhaseA, {0, 0}), 0);
+  EXPECT_EQ(update(kMpcPowerPhaseA, {1, 64}), 1);
+  EXPECT_EQ(update(kMpcPowerPhaseA, {-1, 64}), -1);
+
+  // Minimum interval holds the changes back
+  EXPECT_EQ(update(kMpcFrequency, {50, 0}), 50);
+  EXPECT_EQ(update(kMpcFrequency, {49, 0}), 50);
+
+  const auto get_published = [&use_case](MuMpcMeasurementNameId name) {
+    ScaledValue published = {0};
+    EXPECT_EQ(MuMpcGetMeasurementData(use_case.get(), name, &published), kEebusErrorOk);
+    return published.value;
+  };
+
+  // The timer publishes the change held back once the minimum interval elapses
+  monotonic_time_ms += 3599 * 1000;
+  timer_cb(timer_ctx);
+  EXPECT_EQ(get_published(kMpcFrequency), 50);
+
+  monotonic_time_ms += 1000;
+  timer_cb(timer_ctx);
+  EXPECT_EQ(get_published(kMpcFrequency), 49);
+
+  // The insignificant change is published by the timer after the maximum silence only
+  EXPECT_EQ(update(kMpcPowerTotal, {1035, 0}), 1030);
+  timer_cb(timer_ctx);
+  EXPECT_EQ(get_published(kMpcPowerTotal), 1030);
+
+  monotonic_time_ms += 60 * 1000;
+  timer_cb(timer_ctx);
+  EXPECT_EQ(get_published(kMpcPowerTotal), 1035);
+}
+
+TEST(MuMpcTest, MuMpcPublishingPolicyTest) {
+  MuMpcPublishingPolicyTestInternal();
+  EXPECT_EQ(heap_used, 0);
+  CheckForMemoryLeaks();
+}